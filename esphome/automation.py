@@ -84,6 +84,7 @@ def validate_potentially_or_condition(value):
 
 DelayAction = cg.esphome_ns.class_("DelayAction", Action, cg.Component)
 LambdaAction = cg.esphome_ns.class_("LambdaAction", Action)
+LambdaSequenceAction = cg.esphome_ns.class_("LambdaSequenceAction", Action)
 IfAction = cg.esphome_ns.class_("IfAction", Action)
 WhileAction = cg.esphome_ns.class_("WhileAction", Action)
 RepeatAction = cg.esphome_ns.class_("RepeatAction", Action)
@@ -394,11 +395,39 @@ async def build_action(full_config, template_arg, args):
     return await builder(config, action_id, template_arg, args)
 
 
+async def _build_lambda_sequence(configs, template_arg, args):
+    # Consecutive lambda actions run one after the other without ever waiting, so they
+    # become a single action calling each lambda in turn. The action checks between
+    # lambdas whether the automation was stopped, keeping the stop semantics.
+    lambdas = []
+    for full_config in configs:
+        _, config = cg.extract_registry_entry_config(ACTION_REGISTRY, full_config)
+        lambdas.append(await cg.process_lambda(config, args, return_type=cg.void))
+    action_id = configs[0][CONF_TYPE_ID].copy()
+    action_id.type = LambdaSequenceAction
+    return cg.new_Pvariable(action_id, template_arg, lambdas)
+
+
 async def build_action_list(config, templ, arg_type):
     actions = []
+    lambdas = []
+
+    async def flush_lambdas():
+        if len(lambdas) == 1:
+            actions.append(await build_action(lambdas[0], templ, arg_type))
+        elif lambdas:
+            actions.append(await _build_lambda_sequence(lambdas, templ, arg_type))
+        lambdas.clear()
+
     for conf in config:
+        registry_entry, _ = cg.extract_registry_entry_config(ACTION_REGISTRY, conf)
+        if registry_entry.name == "lambda":
+            lambdas.append(conf)
+            continue
+        await flush_lambdas()
         action = await build_action(conf, templ, arg_type)
         actions.append(action)
+    await flush_lambdas()
     return actions
 
 
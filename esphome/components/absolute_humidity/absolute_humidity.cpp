@@ -7,6 +7,9 @@ namespace absolute_humidity {
 static const char *const TAG = "absolute_humidity.sensor";
 
 void AbsoluteHumidityComponent::setup() {
+  // loop() only runs after a source published
+  this->disable_loop();
+
   ESP_LOGD(TAG, "  Added callback for temperature '%s'", this->temperature_sensor_->get_name().c_str());
   this->temperature_sensor_->add_on_state_callback([this](float state) { this->temperature_callback_(state); });
   if (this->temperature_sensor_->has_state()) {
@@ -48,10 +51,7 @@ void AbsoluteHumidityComponent::dump_config() {
 float AbsoluteHumidityComponent::get_setup_priority() const { return setup_priority::DATA; }
 
 void AbsoluteHumidityComponent::loop() {
-  if (!this->next_update_) {
-    return;
-  }
-  this->next_update_ = false;
+  this->disable_loop();
 
   // Ensure we have source data
   const bool no_temperature = std::isnan(this->temperature_);
@@ -28,13 +28,14 @@ class AbsoluteHumidityComponent : public sensor::Sensor, public Component {
   void loop() override;
 
  protected:
+  // Both sources usually publish together, so the result is calculated once in the next loop() instead of per source
   void temperature_callback_(float state) {
-    this->next_update_ = true;
     this->temperature_ = state;
+    this->enable_loop();
   }
   void humidity_callback_(float state) {
-    this->next_update_ = true;
     this->humidity_ = state;
+    this->enable_loop();
   }
 
   /** Buck equation for saturation vapor pressure in kPa.
@@ -65,8 +66,6 @@ class AbsoluteHumidityComponent : public sensor::Sensor, public Component {
   sensor::Sensor *temperature_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
 
-  bool next_update_{false};
-
   float temperature_{NAN};
   float humidity_{NAN};
   SaturationVaporPressureEquation equation_;
@@ -74,10 +74,18 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
   }
 
   while (this->available() != 0) {
-    uint8_t data;
-    if (!this->read_byte(&data))
+    size_t len = 1;
+    if (this->frame_.size() >= 6) {
+      // The header has been checked, the rest of the frame is read at once
+      const size_t frame_size = get_frame_size_((this->frame_[3] << 8) + this->frame_[4] + 1);
+      len = std::min<size_t>(this->available(), frame_size - this->frame_.size());
+    }
+    const size_t pos = this->frame_.size();
+    this->frame_.resize(pos + len);
+    if (!this->read_array(&this->frame_[pos], len)) {
+      this->frame_.resize(pos);
       break;
-    this->frame_.push_back(data);
+    }
     this->last_byte_ = now;
 
     switch (this->parse_frame_(it)) {
@@ -13,6 +13,13 @@
 #include "hal/adc_types.h"  // This defines ADC_CHANNEL_MAX
 #endif                      // USE_ESP32
 
+#ifdef USE_ADC_CONTINUOUS
+#include "esphome/core/helpers.h"
+#include "esp_adc/adc_continuous.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #ifdef USE_ZEPHYR
 #include <zephyr/drivers/adc.h>
 #endif
@@ -128,6 +135,19 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   void set_autorange(bool autorange) { this->autorange_ = autorange; }
 #endif  // USE_ESP32
 
+#ifdef USE_ADC_CONTINUOUS
+  /// Let the ADC sample continuously through DMA instead of reading it on request.
+  /// A task sums up the samples as they arrive, sample() then returns the result of the last frame.
+  /// @param sample_rate The number of samples per second.
+  void set_continuous(uint32_t sample_rate) {
+    this->continuous_ = true;
+    this->sample_rate_ = sample_rate;
+  }
+
+  bool start_statistics() override;
+  bool stop_statistics(voltage_sampler::SampleStatistics &stats) override;
+#endif  // USE_ADC_CONTINUOUS
+
 #ifdef USE_RP2040
   void set_is_temperature() { this->is_temperature_ = true; }
 #endif  // USE_RP2040
@@ -141,6 +161,7 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
 #ifdef USE_ESP32
   float sample_autorange_();
   float sample_fixed_attenuation_();
+  bool setup_oneshot_();
   bool autorange_{false};
   adc_oneshot_unit_handle_t adc_handle_{nullptr};
   adc_cali_handle_t calibration_handle_{nullptr};
@@ -157,6 +178,35 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   static adc_oneshot_unit_handle_t shared_adc_handles[2];
 #endif  // USE_ESP32
 
+#ifdef USE_ADC_CONTINUOUS
+  /// Raw sums over a number of samples, so the sampling task never converts single samples.
+  struct RawStatistics {
+    uint32_t count{0};
+    uint64_t sum{0};
+    uint64_t sum_squares{0};
+    uint16_t min{UINT16_MAX};
+    uint16_t max{0};
+
+    void merge(const RawStatistics &other);
+  };
+
+  bool setup_continuous_();
+  float sample_continuous_();
+  /// Convert a raw continuous mode reading to the sensor's unit.
+  float raw_to_value_(float raw);
+  static void sampling_task(void *arg);
+
+  bool continuous_{false};
+  uint32_t sample_rate_{0};
+  adc_continuous_handle_t continuous_handle_{nullptr};
+  TaskHandle_t task_handle_{nullptr};
+  /// Guards last_frame_, window_ and window_open_, which the sampling task writes.
+  Mutex lock_;
+  RawStatistics last_frame_;
+  RawStatistics window_;
+  bool window_open_{false};
+#endif  // USE_ADC_CONTINUOUS
+
 #ifdef USE_RP2040
   bool is_temperature_{false};
 #endif  // USE_RP2040
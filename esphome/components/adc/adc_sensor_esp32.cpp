@@ -3,6 +3,8 @@
 #include "adc_sensor.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace adc {
 
@@ -10,6 +12,19 @@ static const char *const TAG = "adc.esp32";
 
 adc_oneshot_unit_handle_t ADCSensor::shared_adc_handles[2] = {nullptr, nullptr};
 
+#ifdef USE_ADC_CONTINUOUS
+/// Samples per DMA frame, the sampling task wakes up once per frame.
+static const size_t SAMPLES_PER_FRAME = 256;
+static const size_t CONV_FRAME_SIZE = SAMPLES_PER_FRAME * SOC_ADC_DIGI_RESULT_BYTES;
+static const uint32_t TASK_STACK_SIZE = 2048 + CONV_FRAME_SIZE;
+static const UBaseType_t TASK_PRIORITY = 5;
+/// Calibration takes readings of the oneshot width, which can be wider than the DMA readings.
+static const uint8_t DIGI_TO_CALI_SHIFT = SOC_ADC_RTC_MAX_BITWIDTH - SOC_ADC_DIGI_MAX_BITWIDTH;
+static const uint32_t DIGI_RAW_MAX = (1 << SOC_ADC_DIGI_MAX_BITWIDTH) - 1;
+/// Half the span in raw counts over which the calibration is taken as linear, to scale the AC part.
+static const float SLOPE_SPAN = 64.0f;
+#endif  // USE_ADC_CONTINUOUS
+
 const LogString *attenuation_to_str(adc_atten_t attenuation) {
   switch (attenuation) {
     case ADC_ATTEN_DB_0:
@@ -37,37 +52,15 @@ const LogString *adc_unit_to_str(adc_unit_t unit) {
 }
 
 void ADCSensor::setup() {
-  // Check if another sensor already initialized this ADC unit
-  if (ADCSensor::shared_adc_handles[this->adc_unit_] == nullptr) {
-    adc_oneshot_unit_init_cfg_t init_config = {};  // Zero initialize
-    init_config.unit_id = this->adc_unit_;
-    init_config.ulp_mode = ADC_ULP_MODE_DISABLE;
-#if USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 || USE_ESP32_VARIANT_ESP32H2
-    init_config.clk_src = ADC_DIGI_CLK_SRC_DEFAULT;
-#endif  // USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 ||
-        // USE_ESP32_VARIANT_ESP32H2
-    esp_err_t err = adc_oneshot_new_unit(&init_config, &ADCSensor::shared_adc_handles[this->adc_unit_]);
-    if (err != ESP_OK) {
-      ESP_LOGE(TAG, "Error initializing %s: %d", LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)), err);
-      this->mark_failed();
-      return;
-    }
-  }
-  this->adc_handle_ = ADCSensor::shared_adc_handles[this->adc_unit_];
-
-  this->setup_flags_.handle_init_complete = true;
-
-  adc_oneshot_chan_cfg_t config = {
-      .atten = this->attenuation_,
-      .bitwidth = ADC_BITWIDTH_DEFAULT,
-  };
-  esp_err_t err = adc_oneshot_config_channel(this->adc_handle_, this->channel_, &config);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error configuring channel: %d", err);
+#ifdef USE_ADC_CONTINUOUS
+  bool ok = this->continuous_ ? this->setup_continuous_() : this->setup_oneshot_();
+#else
+  bool ok = this->setup_oneshot_();
+#endif
+  if (!ok) {
     this->mark_failed();
     return;
   }
-  this->setup_flags_.config_complete = true;
 
   // Initialize ADC calibration
   if (this->calibration_handle_ == nullptr) {
@@ -84,7 +77,7 @@ void ADCSensor::setup() {
     cali_config.atten = this->attenuation_;
     cali_config.bitwidth = ADC_BITWIDTH_DEFAULT;
 
-    err = adc_cali_create_scheme_curve_fitting(&cali_config, &handle);
+    esp_err_t err = adc_cali_create_scheme_curve_fitting(&cali_config, &handle);
     if (err == ESP_OK) {
       this->calibration_handle_ = handle;
       this->setup_flags_.calibration_complete = true;
@@ -102,7 +95,7 @@ void ADCSensor::setup() {
       .default_vref = 1100,  // Default reference voltage in mV
 #endif  // !defined(USE_ESP32_VARIANT_ESP32S2)
     };
-    err = adc_cali_create_scheme_line_fitting(&cali_config, &handle);
+    esp_err_t err = adc_cali_create_scheme_line_fitting(&cali_config, &handle);
     if (err == ESP_OK) {
       this->calibration_handle_ = handle;
       this->setup_flags_.calibration_complete = true;
@@ -117,6 +110,197 @@ void ADCSensor::setup() {
   this->setup_flags_.init_complete = true;
 }
 
+bool ADCSensor::setup_oneshot_() {
+  // Check if another sensor already initialized this ADC unit
+  if (ADCSensor::shared_adc_handles[this->adc_unit_] == nullptr) {
+    adc_oneshot_unit_init_cfg_t init_config = {};  // Zero initialize
+    init_config.unit_id = this->adc_unit_;
+    init_config.ulp_mode = ADC_ULP_MODE_DISABLE;
+#if USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 || USE_ESP32_VARIANT_ESP32H2
+    init_config.clk_src = ADC_DIGI_CLK_SRC_DEFAULT;
+#endif  // USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 ||
+        // USE_ESP32_VARIANT_ESP32H2
+    esp_err_t err = adc_oneshot_new_unit(&init_config, &ADCSensor::shared_adc_handles[this->adc_unit_]);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Error initializing %s: %d", LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)), err);
+      return false;
+    }
+  }
+  this->adc_handle_ = ADCSensor::shared_adc_handles[this->adc_unit_];
+
+  this->setup_flags_.handle_init_complete = true;
+
+  adc_oneshot_chan_cfg_t config = {
+      .atten = this->attenuation_,
+      .bitwidth = ADC_BITWIDTH_DEFAULT,
+  };
+  esp_err_t err = adc_oneshot_config_channel(this->adc_handle_, this->channel_, &config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error configuring channel: %d", err);
+    return false;
+  }
+  this->setup_flags_.config_complete = true;
+  return true;
+}
+
+#ifdef USE_ADC_CONTINUOUS
+bool ADCSensor::setup_continuous_() {
+  adc_continuous_handle_cfg_t handle_config = {};
+  handle_config.max_store_buf_size = CONV_FRAME_SIZE * 4;
+  handle_config.conv_frame_size = CONV_FRAME_SIZE;
+  esp_err_t err = adc_continuous_new_handle(&handle_config, &this->continuous_handle_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error initializing continuous mode: %d", err);
+    return false;
+  }
+  this->setup_flags_.handle_init_complete = true;
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = this->attenuation_;
+  pattern.channel = this->channel_;
+  pattern.unit = this->adc_unit_;
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  adc_continuous_config_t config = {};
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = this->sample_rate_;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+#if defined(USE_ESP32_VARIANT_ESP32) || defined(USE_ESP32_VARIANT_ESP32S2)
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+#else
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+#endif
+  err = adc_continuous_config(this->continuous_handle_, &config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error configuring continuous mode: %d", err);
+    return false;
+  }
+  this->setup_flags_.config_complete = true;
+
+  if (xTaskCreate(ADCSensor::sampling_task, "adc_sampling", TASK_STACK_SIZE, this, TASK_PRIORITY,
+                  &this->task_handle_) != pdPASS) {
+    ESP_LOGE(TAG, "Could not create sampling task");
+    return false;
+  }
+  err = adc_continuous_start(this->continuous_handle_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error starting continuous mode: %d", err);
+    return false;
+  }
+  return true;
+}
+
+void ADCSensor::RawStatistics::merge(const RawStatistics &other) {
+  this->count += other.count;
+  this->sum += other.sum;
+  this->sum_squares += other.sum_squares;
+  this->min = std::min(this->min, other.min);
+  this->max = std::max(this->max, other.max);
+}
+
+void ADCSensor::sampling_task(void *arg) {
+  auto *sensor = static_cast<ADCSensor *>(arg);
+  uint8_t frame[CONV_FRAME_SIZE];
+
+  while (true) {
+    uint32_t length = 0;
+    if (adc_continuous_read(sensor->continuous_handle_, frame, sizeof(frame), &length, portMAX_DELAY) != ESP_OK)
+      continue;
+
+    // A single pass over the frame gathers everything mean, RMS and peak are made of
+    RawStatistics stats;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+      const auto *result = reinterpret_cast<const adc_digi_output_data_t *>(&frame[i]);
+#if defined(USE_ESP32_VARIANT_ESP32) || defined(USE_ESP32_VARIANT_ESP32S2)
+      const uint16_t raw = result->type1.data;
+#else
+      const uint16_t raw = result->type2.data;
+#endif
+      stats.sum += raw;
+      stats.sum_squares += uint32_t(raw) * raw;
+      stats.min = std::min(stats.min, raw);
+      stats.max = std::max(stats.max, raw);
+    }
+    stats.count = length / SOC_ADC_DIGI_RESULT_BYTES;
+    if (stats.count == 0)
+      continue;
+
+    LockGuard guard(sensor->lock_);
+    sensor->last_frame_ = stats;
+    if (sensor->window_open_)
+      sensor->window_.merge(stats);
+  }
+}
+
+float ADCSensor::raw_to_value_(float raw) {
+  if (this->output_raw_)
+    return raw;
+  if (this->calibration_handle_ != nullptr) {
+    const int clamped = clamp<int>(lroundf(raw), 0, DIGI_RAW_MAX);
+    int voltage_mv;
+    if (adc_cali_raw_to_voltage(this->calibration_handle_, clamped << DIGI_TO_CALI_SHIFT, &voltage_mv) == ESP_OK)
+      return voltage_mv / 1000.0f;
+  }
+  return raw * 3.3f / DIGI_RAW_MAX;
+}
+
+float ADCSensor::sample_continuous_() {
+  RawStatistics frame;
+  {
+    LockGuard guard(this->lock_);
+    frame = this->last_frame_;
+  }
+  if (frame.count == 0)
+    return NAN;
+
+  switch (this->sampling_mode_) {
+    case SamplingMode::MIN:
+      return this->raw_to_value_(frame.min);
+    case SamplingMode::MAX:
+      return this->raw_to_value_(frame.max);
+    default:
+      return this->raw_to_value_(float(frame.sum) / frame.count);
+  }
+}
+
+bool ADCSensor::start_statistics() {
+  if (!this->continuous_ || this->is_failed())
+    return false;
+  LockGuard guard(this->lock_);
+  this->window_ = RawStatistics();
+  this->window_open_ = true;
+  return true;
+}
+
+bool ADCSensor::stop_statistics(voltage_sampler::SampleStatistics &stats) {
+  RawStatistics window;
+  {
+    LockGuard guard(this->lock_);
+    if (!this->window_open_)
+      return false;
+    window = this->window_;
+    this->window_open_ = false;
+  }
+
+  stats.count = window.count;
+  if (window.count == 0)
+    return true;
+  const float mean = float(window.sum) / window.count;
+  const float variance = float(window.sum_squares) / window.count - mean * mean;
+  const float ac_rms = variance > 0 ? std::sqrt(variance) : 0.0f;
+  // The calibration is close to linear over a small span, so its slope around the mean scales the AC part
+  const float low = std::max(mean - SLOPE_SPAN, 0.0f);
+  const float high = std::min(mean + SLOPE_SPAN, float(DIGI_RAW_MAX));
+  const float slope = (this->raw_to_value_(high) - this->raw_to_value_(low)) / (high - low);
+
+  stats.mean = this->raw_to_value_(mean);
+  stats.ac_rms = ac_rms * slope;
+  stats.min = this->raw_to_value_(window.min);
+  stats.max = this->raw_to_value_(window.max);
+  return true;
+}
+#endif  // USE_ADC_CONTINUOUS
+
 void ADCSensor::dump_config() {
   LOG_SENSOR("", "ADC Sensor", this);
   LOG_PIN("  Pin: ", this->pin_);
@@ -129,6 +313,10 @@ void ADCSensor::dump_config() {
                 this->channel_, LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)),
                 this->autorange_ ? "Auto" : LOG_STR_ARG(attenuation_to_str(this->attenuation_)), this->sample_count_,
                 LOG_STR_ARG(sampling_mode_to_str(this->sampling_mode_)));
+#ifdef USE_ADC_CONTINUOUS
+  if (this->continuous_)
+    ESP_LOGCONFIG(TAG, "  Continuous:    %" PRIu32 " Hz", this->sample_rate_);
+#endif
 
   ESP_LOGCONFIG(
       TAG,
@@ -144,6 +332,10 @@ void ADCSensor::dump_config() {
 }
 
 float ADCSensor::sample() {
+#ifdef USE_ADC_CONTINUOUS
+  if (this->continuous_)
+    return this->sample_continuous_();
+#endif
   if (this->autorange_) {
     return this->sample_autorange_();
   } else {
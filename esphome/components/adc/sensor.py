@@ -3,6 +3,7 @@ import logging
 import esphome.codegen as cg
 from esphome.components import sensor, voltage_sampler
 from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32
 from esphome.components.nrf52.const import AIN_TO_GPIO, EXTRA_ADC
 from esphome.components.zephyr import (
     zephyr_add_overlay,
@@ -13,10 +14,14 @@ from esphome.config_helpers import filter_source_files_from_platform
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ATTENUATION,
+    CONF_CONTINUOUS,
     CONF_ID,
     CONF_NUMBER,
     CONF_PIN,
+    CONF_PLATFORM,
     CONF_RAW,
+    CONF_SAMPLE_RATE,
+    CONF_SENSOR,
     DEVICE_CLASS_VOLTAGE,
     PLATFORM_NRF52,
     STATE_CLASS_MEASUREMENT,
@@ -24,6 +29,7 @@ from esphome.const import (
     PlatformFramework,
 )
 from esphome.core import CORE
+import esphome.final_validate as fv
 
 from . import (
     ATTENUATION_MODES,
@@ -62,9 +68,51 @@ def validate_config(config):
         # Alter value here so `config` command prints the recommended change
         config[CONF_ATTENUATION] = _attenuation("12db")
 
+    if config.get(CONF_CONTINUOUS):
+        if config.get(CONF_ATTENUATION) == "auto":
+            raise cv.Invalid("Automatic attenuation cannot be used in continuous mode")
+        if config[CONF_SAMPLES] > 1:
+            raise cv.Invalid(
+                "Multisampling cannot be used in continuous mode, "
+                "every DMA frame is aggregated already"
+            )
+        variant = get_esp32_variant()
+        if config[CONF_PIN][CONF_NUMBER] not in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL.get(
+            variant, {}
+        ):
+            raise cv.Invalid("Continuous mode only works with ADC1 pins")
+        low, high = (20000, 2000000) if variant == VARIANT_ESP32 else (611, 83333)
+        sample_rate = config.setdefault(CONF_SAMPLE_RATE, 20000)
+        if not low <= sample_rate <= high:
+            raise cv.Invalid(
+                f"The sample rate must be between {low} and {high} Hz on {variant}",
+                [CONF_SAMPLE_RATE],
+            )
+    elif CONF_SAMPLE_RATE in config:
+        raise cv.Invalid(f"{CONF_SAMPLE_RATE} requires {CONF_CONTINUOUS} to be set")
+
+    return config
+
+
+def _final_validate(config):
+    # The continuous driver takes ADC1 for itself, oneshot reads on it would fail
+    if not config.get(CONF_CONTINUOUS):
+        return config
+    adc1_pins = ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[get_esp32_variant()]
+    for conf in fv.full_config.get().get(CONF_SENSOR, []):
+        if conf[CONF_PLATFORM] != "adc" or conf[CONF_ID] == config[CONF_ID]:
+            continue
+        if conf[CONF_PIN][CONF_NUMBER] in adc1_pins:
+            raise cv.Invalid(
+                f"'{conf[CONF_ID]}' cannot use ADC1 while '{config[CONF_ID]}' "
+                "samples it continuously"
+            )
     return config
 
 
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 ADCSensor = adc_ns.class_(
     "ADCSensor", sensor.Sensor, cg.PollingComponent, voltage_sampler.VoltageSampler
 )
@@ -91,6 +139,10 @@ CONFIG_SCHEMA = cv.All(
             cv.OnlyWith(CONF_NRF_SAADC, PLATFORM_NRF52): cv.declare_id(adc_dt_spec),
             cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
             cv.Optional(CONF_SAMPLING_MODE, default="avg"): _sampling_mode,
+            cv.Optional(CONF_CONTINUOUS): cv.All(cv.only_on_esp32, cv.boolean),
+            cv.Optional(CONF_SAMPLE_RATE): cv.All(
+                cv.only_on_esp32, cv.frequency, cv.int_
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s")),
@@ -124,6 +176,10 @@ async def to_code(config):
             else:
                 cg.add(var.set_attenuation(attenuation))
 
+        if config.get(CONF_CONTINUOUS):
+            cg.add_define("USE_ADC_CONTINUOUS")
+            cg.add(var.set_continuous(config[CONF_SAMPLE_RATE]))
+
         variant = get_esp32_variant()
         pin_num = config[CONF_PIN][CONF_NUMBER]
         if (
@@ -2,6 +2,7 @@ import logging
 
 from esphome import automation
 import esphome.codegen as cg
+from esphome.components.const import CONF_BYTE_ORDER
 import esphome.components.image as espImage
 import esphome.config_validation as cv
 from esphome.const import CONF_ID, CONF_REPEAT
@@ -101,6 +102,8 @@ async def to_code(config):
         image_type,
         trans_value,
     )
+    if config.get(CONF_BYTE_ORDER) == "LITTLE_ENDIAN":
+        cg.add(var.set_big_endian(False))
     if loop_config := config.get(CONF_LOOP):
         start = loop_config[CONF_START_FRAME]
         end = loop_config.get(CONF_END_FRAME, frame_count)
@@ -3,6 +3,7 @@ import base64
 from esphome import automation
 from esphome.automation import Condition
 import esphome.codegen as cg
+from esphome.components import logger
 from esphome.config_helpers import get_logger_level
 import esphome.config_validation as cv
 from esphome.const import (
@@ -13,6 +14,9 @@ from esphome.const import (
     CONF_EVENT,
     CONF_ID,
     CONF_KEY,
+    CONF_MAX_STATE_INTERVAL,
+    CONF_MIN_STATE_DELTA,
+    CONF_MIN_STATE_INTERVAL,
     CONF_ON_CLIENT_CONNECTED,
     CONF_ON_CLIENT_DISCONNECTED,
     CONF_PASSWORD,
@@ -20,6 +24,7 @@ from esphome.const import (
     CONF_REBOOT_TIMEOUT,
     CONF_SERVICE,
     CONF_SERVICES,
+    CONF_STATE,
     CONF_TAG,
     CONF_TRIGGER_ID,
     CONF_VARIABLES,
@@ -50,11 +55,21 @@ SERVICE_ARG_NATIVE_TYPES = {
     "float[]": cg.std_vector.template(float),
     "string[]": cg.std_vector.template(cg.std_string),
 }
+CONF_ADAPTIVE_BATCH_DELAY = "adaptive_batch_delay"
+CONF_COALESCE_FRAMES = "coalesce_frames"
 CONF_ENCRYPTION = "encryption"
 CONF_BATCH_DELAY = "batch_delay"
+CONF_BATCH_PRIORITIES = "batch_priorities"
+CONF_BULK = "bulk"
 CONF_CUSTOM_SERVICES = "custom_services"
 CONF_HOMEASSISTANT_SERVICES = "homeassistant_services"
 CONF_HOMEASSISTANT_STATES = "homeassistant_states"
+CONF_LIST_ENTITIES_CACHE = "list_entities_cache"
+CONF_MAX_DELAY = "max_delay"
+CONF_MIN_DELAY = "min_delay"
+CONF_PARTIAL_STATES = "partial_states"
+CONF_SHARED_STATE_ENCODING = "shared_state_encoding"
+CONF_TELEMETRY = "telemetry"
 
 
 def validate_encryption_key(value):
@@ -91,6 +106,7 @@ ACTIONS_SCHEMA = automation.validate_automation(
 ENCRYPTION_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_KEY): validate_encryption_key,
+        cv.Optional(CONF_COALESCE_FRAMES, default=False): cv.boolean,
     }
 )
 
@@ -101,6 +117,49 @@ def _encryption_schema(config):
     return ENCRYPTION_SCHEMA(config)
 
 
+validate_batch_delay = cv.All(
+    cv.positive_time_period_milliseconds,
+    cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+)
+
+BATCH_PRIORITIES_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_STATE, default="10ms"): validate_batch_delay,
+        cv.Optional(CONF_TELEMETRY, default="100ms"): validate_batch_delay,
+        cv.Optional(CONF_BULK, default="200ms"): validate_batch_delay,
+    }
+)
+
+
+def _batch_priorities_schema(config):
+    if config is None:
+        config = {}
+    return BATCH_PRIORITIES_SCHEMA(config)
+
+
+def _validate_adaptive_batch_delay(config):
+    if config[CONF_MIN_DELAY] > config[CONF_MAX_DELAY]:
+        raise cv.Invalid(f"{CONF_MIN_DELAY} must not be larger than {CONF_MAX_DELAY}")
+    return config
+
+
+ADAPTIVE_BATCH_DELAY_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_MIN_DELAY, default="0ms"): validate_batch_delay,
+            cv.Optional(CONF_MAX_DELAY, default="500ms"): validate_batch_delay,
+        }
+    ),
+    _validate_adaptive_batch_delay,
+)
+
+
+def _adaptive_batch_delay_schema(config):
+    if config is None:
+        config = {}
+    return ADAPTIVE_BATCH_DELAY_SCHEMA(config)
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -115,13 +174,18 @@ CONFIG_SCHEMA = cv.All(
             ): ACTIONS_SCHEMA,
             cv.Exclusive(CONF_ACTIONS, group_of_exclusion=CONF_ACTIONS): ACTIONS_SCHEMA,
             cv.Optional(CONF_ENCRYPTION): _encryption_schema,
-            cv.Optional(CONF_BATCH_DELAY, default="100ms"): cv.All(
-                cv.positive_time_period_milliseconds,
-                cv.Range(max=cv.TimePeriod(milliseconds=65535)),
-            ),
+            cv.Optional(CONF_BATCH_DELAY, default="100ms"): validate_batch_delay,
+            cv.Optional(CONF_ADAPTIVE_BATCH_DELAY): _adaptive_batch_delay_schema,
+            cv.Optional(CONF_BATCH_PRIORITIES): _batch_priorities_schema,
+            cv.Optional(CONF_MIN_STATE_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MIN_STATE_DELTA): cv.positive_float,
+            cv.Optional(CONF_MAX_STATE_INTERVAL): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_CUSTOM_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_STATES, default=False): cv.boolean,
+            cv.Optional(CONF_LIST_ENTITIES_CACHE, default=False): cv.boolean,
+            cv.Optional(CONF_PARTIAL_STATES, default=False): cv.boolean,
+            cv.Optional(CONF_SHARED_STATE_ENCODING, default=False): cv.boolean,
             cv.Optional(CONF_ON_CLIENT_CONNECTED): automation.validate_automation(
                 single=True
             ),
@@ -131,6 +195,9 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.rename_key(CONF_SERVICES, CONF_ACTIONS),
+    # Each lane has its own fixed delay, the adaptive delay would be ignored
+    cv.has_at_most_one_key(CONF_ADAPTIVE_BATCH_DELAY, CONF_BATCH_PRIORITIES),
+    logger.request_log_listener,
 )
 
 
@@ -145,6 +212,30 @@ async def to_code(config):
         cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    if CONF_MIN_STATE_INTERVAL in config:
+        cg.add(var.set_min_state_interval(config[CONF_MIN_STATE_INTERVAL]))
+    if CONF_MIN_STATE_DELTA in config:
+        cg.add(
+            var.set_min_state_delta(
+                config[CONF_MIN_STATE_DELTA], config.get(CONF_MAX_STATE_INTERVAL, 0)
+            )
+        )
+    if (adaptive_config := config.get(CONF_ADAPTIVE_BATCH_DELAY)) is not None:
+        cg.add_define("USE_API_ADAPTIVE_BATCH_DELAY")
+        cg.add(
+            var.set_adaptive_batch_delay(
+                adaptive_config[CONF_MIN_DELAY], adaptive_config[CONF_MAX_DELAY]
+            )
+        )
+    if (priorities_config := config.get(CONF_BATCH_PRIORITIES)) is not None:
+        cg.add_define("USE_API_BATCH_PRIORITIES")
+        cg.add(
+            var.set_batch_priority_delays(
+                priorities_config[CONF_STATE],
+                priorities_config[CONF_TELEMETRY],
+                priorities_config[CONF_BULK],
+            )
+        )
 
     # Set USE_API_SERVICES if any services are enabled
     if config.get(CONF_ACTIONS) or config[CONF_CUSTOM_SERVICES]:
@@ -156,6 +247,15 @@ async def to_code(config):
     if config[CONF_HOMEASSISTANT_STATES]:
         cg.add_define("USE_API_HOMEASSISTANT_STATES")
 
+    if config[CONF_LIST_ENTITIES_CACHE]:
+        cg.add_define("USE_API_LIST_ENTITIES_CACHE")
+
+    if config[CONF_PARTIAL_STATES]:
+        cg.add_define("USE_API_PARTIAL_STATES")
+
+    if config[CONF_SHARED_STATE_ENCODING]:
+        cg.add_define("USE_API_SHARED_STATE_ENCODING")
+
     if actions := config.get(CONF_ACTIONS, []):
         for conf in actions:
             template_args = []
@@ -201,6 +301,8 @@ async def to_code(config):
             # and plaintext disabled. Only a factory reset can remove it.
             cg.add_define("USE_API_PLAINTEXT")
         cg.add_define("USE_API_NOISE")
+        if encryption_config[CONF_COALESCE_FRAMES]:
+            cg.add_define("USE_API_NOISE_COALESCE_FRAMES")
         cg.add_library("esphome/noise-c", "0.1.10")
     else:
         cg.add_define("USE_API_PLAINTEXT")
@@ -0,0 +1,37 @@
+#include "adaptive_batch_delay.h"
+#ifdef USE_API
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+#include <algorithm>
+
+namespace esphome::api {
+
+void AdaptiveBatchDelay::init(uint16_t min_delay, uint16_t max_delay, uint16_t initial_delay) {
+  this->min_delay_ = min_delay;
+  this->max_delay_ = max_delay;
+  this->delay_ = std::clamp(initial_delay, min_delay, max_delay);
+}
+
+bool AdaptiveBatchDelay::update(uint32_t now, size_t tx_queued) {
+  this->window_start_ = now;
+
+  const bool congested = this->window_blocked_ || this->window_slow_rtt_ || tx_queued >= CONGESTED_TX_BYTES;
+  this->window_blocked_ = false;
+  this->window_slow_rtt_ = false;
+
+  uint32_t delay = this->delay_;
+  if (congested) {
+    delay = std::max<uint32_t>(delay * 2, MIN_STEP_MS);
+  } else {
+    // Round the step up so the delay can reach 0
+    delay -= (delay + 3) / 4;
+  }
+  delay = std::clamp<uint32_t>(delay, this->min_delay_, this->max_delay_);
+  if (delay == this->delay_)
+    return false;
+  this->delay_ = delay;
+  return true;
+}
+
+}  // namespace esphome::api
+#endif  // USE_API_ADAPTIVE_BATCH_DELAY
+#endif  // USE_API
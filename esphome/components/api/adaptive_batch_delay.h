@@ -0,0 +1,67 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::api {
+
+/** Per-connection batch delay that follows the congestion of the link.
+ *
+ * The connection reports writes that had to wait for TCP buffer space, messages it had to drop and the round
+ * trip time of its keepalive pings. Once per window the delay is doubled if the link looked congested (a
+ * blocked write, more than a packet still queued at the end of the window, or a slow ping), otherwise it
+ * decays by a quarter towards the configured minimum. A minimum of 0 lets a healthy link send state changes
+ * immediately, exactly like a static batch_delay of 0.
+ */
+class AdaptiveBatchDelay {
+ public:
+  void init(uint16_t min_delay, uint16_t max_delay, uint16_t initial_delay);
+
+  /// A write had to wait for TCP buffer space.
+  void record_blocked() {
+    this->blocked_count_++;
+    this->window_blocked_ = true;
+  }
+  /// A message was lost because it could not be sent.
+  void record_dropped() { this->dropped_count_++; }
+  /// A ping sent by us was answered after rtt milliseconds.
+  void record_rtt(uint32_t rtt) {
+    this->last_rtt_ = rtt;
+    this->window_slow_rtt_ |= rtt >= SLOW_RTT_MS;
+  }
+  /// True once per window, the caller then passes the current send queue size to update().
+  bool window_elapsed(uint32_t now) const { return now - this->window_start_ >= WINDOW_MS; }
+  /// Close the current window, returns true if the delay changed.
+  bool update(uint32_t now, size_t tx_queued);
+
+  uint16_t get_delay() const { return this->delay_; }
+  uint32_t get_blocked_count() const { return this->blocked_count_; }
+  uint32_t get_dropped_count() const { return this->dropped_count_; }
+  /// Round trip time of the last answered ping, 0 if none was answered yet.
+  uint32_t get_last_rtt() const { return this->last_rtt_; }
+
+ protected:
+  static constexpr uint32_t WINDOW_MS = 1000;
+  static constexpr uint32_t SLOW_RTT_MS = 250;
+  // Queued bytes at the end of a window that count as congestion, about one full batch packet
+  static constexpr size_t CONGESTED_TX_BYTES = 1390;
+  // First step up from a delay of 0
+  static constexpr uint16_t MIN_STEP_MS = 10;
+
+  uint32_t window_start_{0};
+  uint32_t blocked_count_{0};
+  uint32_t dropped_count_{0};
+  uint32_t last_rtt_{0};
+  uint16_t min_delay_{0};
+  uint16_t max_delay_{0};
+  uint16_t delay_{0};
+  bool window_blocked_{false};
+  bool window_slow_rtt_{false};
+};
+
+}  // namespace esphome::api
+#endif  // USE_API_ADAPTIVE_BATCH_DELAY
+#endif  // USE_API
@@ -33,6 +33,9 @@
 #ifdef USE_ZWAVE_PROXY
 #include "esphome/components/zwave_proxy/zwave_proxy.h"
 #endif
+#ifdef USE_BOOT_TIMELINE
+#include "esphome/components/boot_timeline/boot_timeline.h"
+#endif
 
 namespace esphome::api {
 
@@ -102,6 +105,10 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #else
 #error "No frame helper defined"
 #endif
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->batch_delay_controller_.init(parent->get_min_batch_delay(), parent->get_max_batch_delay(),
+                                     parent->get_batch_delay());
+#endif
 #ifdef USE_CAMERA
   if (camera::Camera::instance() != nullptr) {
     this->image_reader_ = std::unique_ptr<camera::CameraImageReader>{camera::Camera::instance()->create_image_reader()};
@@ -109,7 +116,14 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #endif
 }
 
-uint32_t APIConnection::get_batch_delay_ms_() const { return this->parent_->get_batch_delay(); }
+uint32_t APIConnection::get_batch_delay_ms_() const {
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  // The server lowers its batch delay to flush quickly on shutdown
+  if (!this->parent_->is_shutting_down())
+    return this->batch_delay_controller_.get_delay();
+#endif
+  return this->parent_->get_batch_delay();
+}
 
 void APIConnection::start() {
   this->last_traffic_ = App.get_loop_component_start_time();
@@ -125,6 +139,9 @@ void APIConnection::start() {
 }
 
 APIConnection::~APIConnection() {
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  this->parent_->get_list_entities_cache().abort(this);
+#endif
 #ifdef USE_BLUETOOTH_PROXY
   if (bluetooth_proxy::global_bluetooth_proxy->get_api_connection() == this) {
     bluetooth_proxy::global_bluetooth_proxy->unsubscribe_api_connection(this);
@@ -180,8 +197,22 @@ void APIConnection::loop() {
     }
   }
 
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  if (this->batch_delay_controller_.window_elapsed(now) &&
+      this->batch_delay_controller_.update(now, this->helper_->tx_queued_bytes())) {
+    ESP_LOGV(TAG, "%s: batch delay %u ms (blocked %" PRIu32 ", dropped %" PRIu32 ", rtt %" PRIu32 " ms)",
+             this->get_client_combined_info().c_str(), this->batch_delay_controller_.get_delay(),
+             this->batch_delay_controller_.get_blocked_count(), this->batch_delay_controller_.get_dropped_count(),
+             this->batch_delay_controller_.get_last_rtt());
+  }
+#endif
+
+  // Report log lines lost to backpressure once there is room again, even if no further line comes to carry it
+  if (this->log_lines_dropped_ > 0 && this->helper_->can_write_without_blocking())
+    this->send_log_lines_dropped_();
+
   // Process deferred batch if scheduled and timer has expired
-  if (this->flags_.batch_scheduled && now - this->deferred_batch_.batch_start_time >= this->get_batch_delay_ms_()) {
+  if (this->flags_.batch_scheduled && this->is_batch_due_(now)) {
     this->process_batch_();
   }
 
@@ -211,6 +242,9 @@ void APIConnection::loop() {
     // Only send ping if we're not disconnecting
     ESP_LOGVV(TAG, "Sending keepalive PING");
     PingRequest req;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    this->ping_sent_time_ = now;
+#endif
     this->flags_.sent_ping = this->send_message(req, PingRequest::MESSAGE_TYPE);
     if (!this->flags_.sent_ping) {
       // If we can't send the ping request directly (tx_buffer full),
@@ -223,24 +257,8 @@ void APIConnection::loop() {
   }
 
 #ifdef USE_CAMERA
-  if (this->image_reader_ && this->image_reader_->available() && this->helper_->can_write_without_blocking()) {
-    uint32_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
-    bool done = this->image_reader_->available() == to_send;
-
-    CameraImageResponse msg;
-    msg.key = camera::Camera::instance()->get_object_id_hash();
-    msg.set_data(this->image_reader_->peek_data_buffer(), to_send);
-    msg.done = done;
-#ifdef USE_DEVICES
-    msg.device_id = camera::Camera::instance()->get_device_id();
-#endif
-
-    if (this->send_message_(msg, CameraImageResponse::MESSAGE_TYPE)) {
-      this->image_reader_->consume_data(to_send);
-      if (done) {
-        this->image_reader_->return_image();
-      }
-    }
+  if (this->image_reader_ && this->image_reader_->available()) {
+    this->send_camera_image_();
   }
 #endif
 
@@ -282,26 +300,41 @@ uint16_t APIConnection::encode_message_to_buffer(ProtoMessage &msg, uint8_t mess
   msg.calculate_size(size_calc);
   uint32_t calculated_size = size_calc.get_size();
 
+  std::vector<uint8_t> *buf = conn->reserve_message_buffer_(calculated_size, remaining_size, is_single);
+  if (buf == nullptr)
+    return 0;  // Doesn't fit
+
+  // Encode directly into buffer
+  size_t size_before_encode = buf->size();
+  msg.encode({buf});
+
+  // Verify that calculate_size() returned the correct value
+  assert(calculated_size == buf->size() - size_before_encode);
+  return conn->message_total_size_(calculated_size);
+}
+
+std::vector<uint8_t> *APIConnection::reserve_message_buffer_(uint32_t payload_size, uint32_t remaining_size,
+                                                             bool is_single) {
   // Cache frame sizes to avoid repeated virtual calls
-  const uint8_t header_padding = conn->helper_->frame_header_padding();
-  const uint8_t footer_size = conn->helper_->frame_footer_size();
+  const uint8_t header_padding = this->helper_->frame_header_padding();
+  const uint8_t footer_size = this->helper_->frame_footer_size();
 
   // Calculate total size with padding for buffer allocation
-  size_t total_calculated_size = calculated_size + header_padding + footer_size;
+  size_t total_calculated_size = payload_size + header_padding + footer_size;
 
   // Check if it fits
   if (total_calculated_size > remaining_size) {
-    return 0;  // Doesn't fit
+    return nullptr;
   }
 
   // Get buffer size after allocation (which includes header padding)
-  std::vector<uint8_t> &shared_buf = conn->parent_->get_shared_buffer_ref();
+  std::vector<uint8_t> &shared_buf = this->parent_->get_shared_buffer_ref();
 
-  if (is_single || conn->flags_.batch_first_message) {
+  if (is_single || this->flags_.batch_first_message) {
     // Single message or first batch message
-    conn->prepare_first_message_buffer(shared_buf, header_padding, total_calculated_size);
-    if (conn->flags_.batch_first_message) {
-      conn->flags_.batch_first_message = false;
+    this->prepare_first_message_buffer(shared_buf, header_padding, total_calculated_size);
+    if (this->flags_.batch_first_message) {
+      this->flags_.batch_first_message = false;
     }
   } else {
     // Batch message second or later
@@ -310,21 +343,107 @@ uint16_t APIConnection::encode_message_to_buffer(ProtoMessage &msg, uint8_t mess
     shared_buf.reserve(current_size + total_calculated_size);
     shared_buf.resize(current_size + footer_size + header_padding);
   }
+  return &shared_buf;
+}
 
-  // Encode directly into buffer
-  size_t size_before_encode = shared_buf.size();
-  msg.encode({&shared_buf});
+#if defined(USE_API_LIST_ENTITIES_CACHE) || defined(USE_API_SHARED_STATE_ENCODING)
+uint16_t APIConnection::copy_payload_to_buffer_(const uint8_t *data, uint16_t len, uint32_t remaining_size,
+                                                bool is_single) {
+  std::vector<uint8_t> *buf = this->reserve_message_buffer_(len, remaining_size, is_single);
+  if (buf == nullptr)
+    return 0;  // Doesn't fit
+  buf->insert(buf->end(), data, data + len);
+  return this->message_total_size_(len);
+}
 
-  // Calculate actual encoded size (not including header that was already added)
-  size_t actual_payload_size = shared_buf.size() - size_before_encode;
+const uint8_t *APIConnection::last_encoded_payload_(uint16_t total_size, uint16_t &len) {
+  // The payload is the last thing in the shared buffer, the footer is only added by the next message or the send
+  len = total_size - this->helper_->frame_header_padding() - this->helper_->frame_footer_size();
+  const std::vector<uint8_t> &shared_buf = this->parent_->get_shared_buffer_ref();
+  return shared_buf.data() + shared_buf.size() - len;
+}
+#endif
 
-  // Return actual total size (header + actual payload + footer)
-  size_t actual_total_size = header_padding + actual_payload_size + footer_size;
+#ifdef USE_API_LIST_ENTITIES_CACHE
+void APIConnection::cache_entity_info_(EntityBase *entity, uint8_t message_type, uint16_t total_size) {
+  ListEntitiesCache &cache = this->parent_->get_list_entities_cache();
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  if (this->flags_.log_only_mode)
+    return;
+#endif
+  if (!cache.is_building(this))
+    return;
+  uint16_t len;
+  const uint8_t *data = this->last_encoded_payload_(total_size, len);
+  cache.add(this, entity, message_type, data, len);
+}
 
-  // Verify that calculate_size() returned the correct value
-  assert(calculated_size == actual_payload_size);
-  return static_cast<uint16_t>(actual_total_size);
+bool APIConnection::try_send_cached_info_(EntityBase *entity, uint8_t message_type, uint32_t remaining_size,
+                                          bool is_single, uint16_t &size) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  // Logging needs the decoded message
+  if (this->flags_.log_only_mode)
+    return false;
+#endif
+  uint16_t len;
+  const uint8_t *data = this->parent_->get_list_entities_cache().find(entity, message_type, &len);
+  if (data == nullptr)
+    return false;
+  size = this->copy_payload_to_buffer_(data, len, remaining_size, is_single);
+  return true;
+}
+#endif
+
+#ifdef USE_API_SHARED_STATE_ENCODING
+bool APIConnection::try_send_shared_state_(EntityBase *entity, uint8_t message_type, uint32_t remaining_size,
+                                           bool is_single, uint16_t &size) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  // Logging needs the decoded message
+  if (this->flags_.log_only_mode)
+    return false;
+#endif
+  uint16_t len;
+  const uint8_t *data = this->parent_->get_shared_state_cache().find(entity, message_type, &len);
+  if (data == nullptr)
+    return false;
+  size = this->copy_payload_to_buffer_(data, len, remaining_size, is_single);
+  return true;
+}
+
+void APIConnection::share_state_(EntityBase *entity, uint8_t message_type, uint16_t total_size) {
+  // Not worth a copy unless another client can use it
+  if (total_size == 0 || this->parent_->get_client_count() < 2)
+    return;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  if (this->flags_.log_only_mode)
+    return;
+#endif
+#ifdef USE_EVENT
+  // Queued events carry their own event type, the entity only holds the last one
+  if (message_type == EventResponse::MESSAGE_TYPE)
+    return;
+#endif
+  uint16_t len;
+  const uint8_t *data = this->last_encoded_payload_(total_size, len);
+  this->parent_->get_shared_state_cache().store(entity, message_type, data, len);
+}
+#endif
+
+#ifdef USE_API_PARTIAL_STATES
+uint16_t APIConnection::encode_partial_state_(StateResponseProtoMessage &msg, uint8_t message_type,
+                                              APIConnection *conn, uint32_t remaining_size, bool is_single) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  // Logging re-encodes already sent messages, it must not touch the baseline
+  if (conn->flags_.log_only_mode)
+    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+#endif
+  PartialStateMessage diff(conn->partial_states_, conn->partial_states_.prepare(msg, message_type));
+  uint16_t size = encode_message_to_buffer(diff, message_type, conn, remaining_size, is_single);
+  if (size == 0)
+    conn->partial_states_.cancel();
+  return size;
 }
+#endif
 
 #ifdef USE_BINARY_SENSOR
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor) {
@@ -338,8 +457,7 @@ uint16_t APIConnection::try_send_binary_sensor_state(EntityBase *entity, APIConn
   BinarySensorStateResponse resp;
   resp.state = binary_sensor->state;
   resp.missing_state = !binary_sensor->has_state();
-  return fill_and_encode_entity_state(binary_sensor, resp, BinarySensorStateResponse::MESSAGE_TYPE, conn,
-                                      remaining_size, is_single);
+  return fill_and_encode_inline_entity_state(binary_sensor, resp, conn, remaining_size, is_single);
 }
 
 uint16_t APIConnection::try_send_binary_sensor_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -539,7 +657,7 @@ uint16_t APIConnection::try_send_sensor_state(EntityBase *entity, APIConnection
   SensorStateResponse resp;
   resp.state = sensor->state;
   resp.missing_state = !sensor->has_state();
-  return fill_and_encode_entity_state(sensor, resp, SensorStateResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+  return fill_and_encode_inline_entity_state(sensor, resp, conn, remaining_size, is_single);
 }
 
 uint16_t APIConnection::try_send_sensor_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -567,8 +685,7 @@ uint16_t APIConnection::try_send_switch_state(EntityBase *entity, APIConnection
   auto *a_switch = static_cast<switch_::Switch *>(entity);
   SwitchStateResponse resp;
   resp.state = a_switch->state;
-  return fill_and_encode_entity_state(a_switch, resp, SwitchStateResponse::MESSAGE_TYPE, conn, remaining_size,
-                                      is_single);
+  return fill_and_encode_inline_entity_state(a_switch, resp, conn, remaining_size, is_single);
 }
 
 uint16_t APIConnection::try_send_switch_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -719,7 +836,7 @@ uint16_t APIConnection::try_send_number_state(EntityBase *entity, APIConnection
   NumberStateResponse resp;
   resp.state = number->state;
   resp.missing_state = !number->has_state();
-  return fill_and_encode_entity_state(number, resp, NumberStateResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+  return fill_and_encode_inline_entity_state(number, resp, conn, remaining_size, is_single);
 }
 
 uint16_t APIConnection::try_send_number_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -1058,6 +1175,85 @@ uint16_t APIConnection::try_send_camera_info(EntityBase *entity, APIConnection *
   return fill_and_encode_entity_info(camera, msg, ListEntitiesCameraResponse::MESSAGE_TYPE, conn, remaining_size,
                                      is_single);
 }
+void APIConnection::send_camera_image_() {
+#ifdef USE_API_PLAINTEXT
+  if (this->helper_->supports_streaming()) {
+    this->stream_camera_image_();
+    return;
+  }
+#endif
+  if (!this->helper_->can_write_without_blocking())
+    return;
+
+  uint32_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
+  bool done = this->image_reader_->available() == to_send;
+
+  CameraImageResponse msg;
+  msg.key = camera::Camera::instance()->get_object_id_hash();
+  msg.set_data(this->image_reader_->peek_data_buffer(), to_send);
+  msg.done = done;
+#ifdef USE_DEVICES
+  msg.device_id = camera::Camera::instance()->get_device_id();
+#endif
+
+  if (this->send_message_(msg, CameraImageResponse::MESSAGE_TYPE)) {
+    this->image_reader_->consume_data(to_send);
+    if (done) {
+      this->image_reader_->return_image();
+    }
+  }
+}
+
+#ifdef USE_API_PLAINTEXT
+void APIConnection::stream_camera_image_() {
+  // The whole image goes out as a single CameraImageResponse, written straight from the image buffer
+  APIError err;
+  if (!this->helper_->is_streaming()) {
+    if (!this->helper_->can_write_without_blocking())
+      return;
+    CameraImageResponse msg;
+    msg.key = camera::Camera::instance()->get_object_id_hash();
+    msg.done = true;
+#ifdef USE_DEVICES
+    msg.device_id = camera::Camera::instance()->get_device_id();
+#endif
+    // Encode every field except the image data, which follows as the last field on the wire
+    const size_t image_size = this->image_reader_->available();
+    ProtoSize size;
+    msg.calculate_size(size);
+    size.add_length(1, image_size);
+    std::vector<uint8_t> &shared_buf = this->parent_->get_shared_buffer_ref();
+    shared_buf.clear();
+    ProtoWriteBuffer buffer{&shared_buf};
+    msg.encode(buffer);
+    buffer.encode_bytes_header(2, image_size);
+
+    err = this->helper_->begin_stream(CameraImageResponse::MESSAGE_TYPE, size.get_size());
+    if (err == APIError::OK)
+      err = this->helper_->write_stream(shared_buf.data(), shared_buf.size());
+    if (err != APIError::OK) {
+      this->on_fatal_error();
+      this->log_warning_(LOG_STR("Camera stream failed"), err);
+      return;
+    }
+  }
+
+  while (this->image_reader_->available() && this->helper_->can_write_stream()) {
+    uint16_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
+    err = this->helper_->write_stream(this->image_reader_->peek_data_buffer(), to_send);
+    if (err != APIError::OK) {
+      this->on_fatal_error();
+      this->log_warning_(LOG_STR("Camera stream failed"), err);
+      return;
+    }
+    this->image_reader_->consume_data(to_send);
+  }
+  if (!this->image_reader_->available()) {
+    this->image_reader_->return_image();
+  }
+}
+#endif
+
 void APIConnection::camera_image(const CameraImageRequest &msg) {
   if (camera::Camera::instance() == nullptr)
     return;
@@ -1349,11 +1545,64 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 #endif
 
 bool APIConnection::try_send_log_message(int level, const char *tag, const char *line, size_t message_len) {
+  // While earlier data is still waiting for the socket, drop the line instead of flushing from inside the log call:
+  // a busy log subscription must not hold up the loop or the state messages queued behind it. The main loop flushes.
+  if (!this->helper_->can_write_without_blocking() ||
+      (this->log_lines_dropped_ > 0 && !this->send_log_lines_dropped_())) {
+    this->record_log_line_dropped_();
+    return false;
+  }
   SubscribeLogsResponse msg;
   msg.level = static_cast<enums::LogLevel>(level);
   msg.set_message(reinterpret_cast<const uint8_t *>(line), message_len);
-  return this->send_message_(msg, SubscribeLogsResponse::MESSAGE_TYPE);
+  if (!this->send_message_(msg, SubscribeLogsResponse::MESSAGE_TYPE)) {
+    this->record_log_line_dropped_();
+    return false;
+  }
+  return true;
+}
+
+void APIConnection::record_log_line_dropped_() {
+  if (this->log_lines_dropped_ < std::numeric_limits<uint16_t>::max())
+    this->log_lines_dropped_++;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->batch_delay_controller_.record_dropped();
+#endif
+}
+
+bool APIConnection::send_log_lines_dropped_() {
+  char buf[64];
+  int len = snprintf(buf, sizeof(buf), "[W][api]: %u log lines dropped, connection too slow",
+                     static_cast<unsigned>(this->log_lines_dropped_));
+  SubscribeLogsResponse msg;
+  msg.level = enums::LOG_LEVEL_WARN;
+  msg.set_message(reinterpret_cast<const uint8_t *>(buf), std::min<size_t>(len, sizeof(buf) - 1));
+  if (!this->send_message_(msg, SubscribeLogsResponse::MESSAGE_TYPE))
+    return false;
+  this->log_lines_dropped_ = 0;
+  return true;
+}
+
+#ifdef USE_LOGGER_BINARY
+bool APIConnection::try_send_binary_log_message(int level, const char *tag, int line, const void *format,
+                                                const uint8_t *args, size_t args_len) {
+  BinaryLogResponse msg;
+  msg.level = static_cast<enums::LogLevel>(level);
+  msg.tag = reinterpret_cast<uintptr_t>(tag);
+  msg.line = line;
+  msg.format = reinterpret_cast<uintptr_t>(format);
+  msg.set_args(args, args_len);
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  if (!this->send_message_(msg, BinaryLogResponse::MESSAGE_TYPE)) {
+    this->batch_delay_controller_.record_dropped();
+    return false;
+  }
+  return true;
+#else
+  return this->send_message_(msg, BinaryLogResponse::MESSAGE_TYPE);
+#endif
 }
+#endif
 
 void APIConnection::complete_authentication_() {
   // Early return if already authenticated
@@ -1363,6 +1612,10 @@ void APIConnection::complete_authentication_() {
 
   this->flags_.connection_state = static_cast<uint8_t>(ConnectionState::AUTHENTICATED);
   ESP_LOGD(TAG, "%s connected", this->get_client_combined_info().c_str());
+#ifdef USE_BOOT_TIMELINE
+  if (global_boot_timeline != nullptr)
+    global_boot_timeline->record_once(boot_timeline::BOOT_EVENT_API_CLIENT_CONNECTED);
+#endif
 #ifdef USE_API_CLIENT_CONNECTED_TRIGGER
   this->parent_->get_client_connected_trigger()->trigger(this->client_info_.name, this->client_info_.peername);
 #endif
@@ -1378,6 +1631,9 @@ bool APIConnection::send_hello_response(const HelloRequest &msg) {
   this->client_info_.peername = this->helper_->getpeername();
   this->client_api_version_major_ = msg.api_version_major;
   this->client_api_version_minor_ = msg.api_version_minor;
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  this->helper_->set_coalesce_frames(msg.noise_coalesce_frames);
+#endif
   ESP_LOGV(TAG, "Hello from client: '%s' | %s | API Version %" PRIu32 ".%" PRIu32, this->client_info_.name.c_str(),
            this->client_info_.peername.c_str(), this->client_api_version_major_, this->client_api_version_minor_);
 
@@ -1479,6 +1735,9 @@ bool APIConnection::send_device_info_response(const DeviceInfoRequest &msg) {
 #ifdef USE_API_NOISE
   resp.api_encryption_supported = true;
 #endif
+#ifdef USE_API_PARTIAL_STATES
+  resp.partial_states_supported = true;
+#endif
 #ifdef USE_DEVICES
   size_t device_index = 0;
   for (auto const &device : App.get_devices()) {
@@ -1506,11 +1765,7 @@ bool APIConnection::send_device_info_response(const DeviceInfoRequest &msg) {
 
 #ifdef USE_API_HOMEASSISTANT_STATES
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
-  for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
-    }
-  }
+  this->parent_->on_home_assistant_state(msg);
 }
 #endif
 #ifdef USE_API_SERVICES
@@ -1543,6 +1798,38 @@ bool APIConnection::send_noise_encryption_set_key_response(const NoiseEncryption
   return this->send_message(resp, NoiseEncryptionSetKeyResponse::MESSAGE_TYPE);
 }
 #endif
+#ifdef USE_BOOT_TIMELINE
+bool APIConnection::send_boot_timeline_response(const BootTimelineRequest &msg) {
+  BootTimelineResponse resp;
+  if (global_boot_timeline == nullptr)
+    return this->send_message(resp, BootTimelineResponse::MESSAGE_TYPE);
+
+  const size_t count = global_boot_timeline->get_event_count();
+  const boot_timeline::BootEvent *events = global_boot_timeline->get_events();
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  // Component sources live in flash, copy them to RAM for the encoder
+  std::vector<std::string> sources(count);
+#endif
+  resp.events.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    BootTimelineEvent &event = resp.events[i];
+    event.type = static_cast<enums::BootTimelineEventType>(events[i].type);
+    event.time_us = events[i].time_us;
+    if (events[i].component == nullptr)
+      continue;
+    const LogString *source = events[i].component->get_component_log_str();
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+    sources[i].resize(strlen_P(reinterpret_cast<PGM_P>(source)));
+    memcpy_P(&sources[i][0], reinterpret_cast<PGM_P>(source), sources[i].size());
+    event.set_source(StringRef(sources[i]));
+#else
+    event.set_source(StringRef(LOG_STR_ARG(source)));
+#endif
+  }
+  resp.dropped = global_boot_timeline->get_dropped();
+  return this->send_message(resp, BootTimelineResponse::MESSAGE_TYPE);
+}
+#endif
 #ifdef USE_API_HOMEASSISTANT_STATES
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
@@ -1562,13 +1849,21 @@ bool APIConnection::try_to_clear_buffer(bool log_out_of_space) {
   }
   if (this->helper_->can_write_without_blocking())
     return true;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->batch_delay_controller_.record_blocked();
+#endif
   if (log_out_of_space) {
     ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
   }
   return false;
 }
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint8_t message_type) {
-  if (!this->try_to_clear_buffer(message_type != SubscribeLogsResponse::MESSAGE_TYPE)) {  // SubscribeLogsResponse
+  // Logging from here would recurse into the log message that is being sent
+  bool log_out_of_space = message_type != SubscribeLogsResponse::MESSAGE_TYPE;
+#ifdef USE_LOGGER_BINARY
+  log_out_of_space = log_out_of_space && message_type != BinaryLogResponse::MESSAGE_TYPE;
+#endif
+  if (!this->try_to_clear_buffer(log_out_of_space)) {
     return false;
   }
 
@@ -1598,8 +1893,13 @@ void APIConnection::on_fatal_error() {
   this->flags_.remove = true;
 }
 
+#ifdef USE_API_BATCH_PRIORITIES
+void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type,
+                                            uint8_t estimated_size, BatchPriority priority) {
+#else
 void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type,
                                             uint8_t estimated_size) {
+#endif
   // Check if we already have a message of this type for this entity
   // This provides deduplication per entity/message_type combination
   // O(n) but optimized for RAM and not performance.
@@ -1614,9 +1914,27 @@ void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator c
   }
 
   // No existing item found, add new one
+#ifdef USE_API_BATCH_PRIORITIES
+  // Items of the same priority stay in the order they were added, the entity list relies on that
+  auto pos = items.end();
+  while (pos != items.begin() && (pos - 1)->priority > priority)
+    --pos;
+  pos = items.emplace(pos, entity, std::move(creator), message_type, estimated_size);
+  pos->priority = priority;
+#else
   items.emplace_back(entity, std::move(creator), message_type, estimated_size);
+#endif
 }
 
+#ifdef USE_API_BATCH_PRIORITIES
+void APIConnection::DeferredBatch::update_pending_priorities() {
+  uint8_t pending = 0;
+  for (const auto &item : items)
+    pending |= 1 << static_cast<uint8_t>(item.priority);
+  pending_priorities &= pending;
+}
+#endif
+
 void APIConnection::DeferredBatch::add_item_front(EntityBase *entity, MessageCreator creator, uint8_t message_type,
                                                   uint8_t estimated_size) {
   // Add high priority message and swap to front
@@ -1633,11 +1951,56 @@ void APIConnection::DeferredBatch::add_item_front(EntityBase *entity, MessageCre
 bool APIConnection::schedule_batch_() {
   if (!this->flags_.batch_scheduled) {
     this->flags_.batch_scheduled = true;
+#ifndef USE_API_BATCH_PRIORITIES
     this->deferred_batch_.batch_start_time = App.get_loop_component_start_time();
+#endif
   }
   return true;
 }
 
+#ifdef USE_API_BATCH_PRIORITIES
+bool APIConnection::schedule_batch_(BatchPriority priority) {
+  const uint8_t bit = 1 << static_cast<uint8_t>(priority);
+  if ((this->deferred_batch_.pending_priorities & bit) == 0) {
+    this->deferred_batch_.pending_priorities |= bit;
+    this->deferred_batch_.priority_start_time[static_cast<uint8_t>(priority)] = App.get_loop_component_start_time();
+  }
+  this->flags_.batch_scheduled = true;
+  return true;
+}
+
+BatchPriority APIConnection::batch_priority_(uint8_t message_type) const {
+  // Everything scheduled while the entity list is being sent belongs to it, including ListEntitiesDoneResponse
+  if (!this->list_entities_iterator_.completed())
+    return BatchPriority::BULK;
+#ifdef USE_SENSOR
+  if (message_type == SensorStateResponse::MESSAGE_TYPE)
+    return BatchPriority::TELEMETRY;
+#endif
+#ifdef USE_TEXT_SENSOR
+  if (message_type == TextSensorStateResponse::MESSAGE_TYPE)
+    return BatchPriority::TELEMETRY;
+#endif
+  return BatchPriority::STATE;
+}
+#endif
+
+bool APIConnection::is_batch_due_(uint32_t now) const {
+#ifdef USE_API_BATCH_PRIORITIES
+  const uint8_t pending = this->deferred_batch_.pending_priorities;
+  if (pending == 0)
+    return true;  // Nothing left, let process_batch_() clear the flag
+  for (uint8_t i = 0; i < BATCH_PRIORITY_COUNT; i++) {
+    if ((pending & (1 << i)) != 0 &&
+        now - this->deferred_batch_.priority_start_time[i] >= this->parent_->get_batch_priority_delay(i))
+      return true;
+  }
+  return false;
+#else
+  return now - this->deferred_batch_.batch_start_time >= this->get_batch_delay_ms_();
+#endif
+}
+
 void APIConnection::process_batch_() {
   // Ensure PacketInfo remains trivially destructible for our placement new approach
   static_assert(std::is_trivially_destructible<PacketInfo>::value,
@@ -1667,6 +2030,9 @@ void APIConnection::process_batch_() {
         item.creator(item.entity, this, std::numeric_limits<uint16_t>::max(), true, item.message_type);
 
     if (payload_size > 0 && this->send_buffer(ProtoWriteBuffer{&shared_buf}, item.message_type)) {
+#ifdef USE_API_PARTIAL_STATES
+      this->partial_states_.commit();
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
       // Log messages after send attempt for VV debugging
       // It's safe to use the buffer for logging at this point regardless of send result
@@ -1676,8 +2042,15 @@ void APIConnection::process_batch_() {
     } else if (payload_size == 0) {
       // Message too large
       ESP_LOGW(TAG, "Message too large to send: type=%u", item.message_type);
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+      this->batch_delay_controller_.record_dropped();
+#endif
       this->clear_batch_();
     }
+#ifdef USE_API_PARTIAL_STATES
+    // No-op after a successful send, otherwise the message is retried later or dropped
+    this->partial_states_.discard();
+#endif
     return;
   }
 
@@ -1766,6 +2139,10 @@ void APIConnection::process_batch_() {
     on_fatal_error();
     this->log_warning_(LOG_STR("Batch write failed"), err);
   }
+#ifdef USE_API_PARTIAL_STATES
+  // The processed items are not retried, so they are the new baseline
+  this->partial_states_.commit();
+#endif
 
 #ifdef HAS_PROTO_MESSAGE_DUMP
   // Log messages after send attempt for VV debugging
@@ -1780,6 +2157,10 @@ void APIConnection::process_batch_() {
   if (items_processed < this->deferred_batch_.size()) {
     // Remove processed items from the beginning with proper cleanup
     this->deferred_batch_.remove_front(items_processed);
+#ifdef USE_API_BATCH_PRIORITIES
+    // Remaining items keep the time they were scheduled at, priorities that were fully sent wait for new items
+    this->deferred_batch_.update_pending_priorities();
+#endif
     // Reschedule for remaining items
     this->schedule_batch_();
   } else {
@@ -1798,6 +2179,13 @@ uint16_t APIConnection::MessageCreator::operator()(EntityBase *entity, APIConnec
   }
 #endif
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  uint16_t cached_size;
+  if (conn->flags_.list_entities_from_cache &&
+      conn->try_send_cached_info_(entity, message_type, remaining_size, is_single, cached_size))
+    return cached_size;
+#endif
+
   // All other message types use function pointers
   return data_.function_ptr(entity, conn, remaining_size, is_single);
 }
@@ -1805,7 +2193,21 @@ uint16_t APIConnection::MessageCreator::operator()(EntityBase *entity, APIConnec
 uint16_t APIConnection::try_send_list_info_done(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                                 bool is_single) {
   ListEntitiesDoneResponse resp;
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  uint16_t size =
+      encode_message_to_buffer(resp, ListEntitiesDoneResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+  if (size != 0
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      && !conn->flags_.log_only_mode
+#endif
+  ) {
+    conn->parent_->get_list_entities_cache().finish(conn);
+    conn->flags_.list_entities_from_cache = false;
+  }
+  return size;
+#else
   return encode_message_to_buffer(resp, ListEntitiesDoneResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+#endif
 }
 
 uint16_t APIConnection::try_send_disconnect_request(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -2,14 +2,17 @@
 
 #include "esphome/core/defines.h"
 #ifdef USE_API
+#include "adaptive_batch_delay.h"
 #include "api_frame_helper.h"
 #include "api_pb2.h"
 #include "api_pb2_service.h"
 #include "api_server.h"
+#include "partial_state.h"
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 #include "esphome/core/entity_base.h"
 
+#include <type_traits>
 #include <vector>
 #include <functional>
 
@@ -43,6 +46,17 @@ static constexpr size_t MAX_PACKETS_PER_BATCH = 64;  // ESP32 has 8KB+ stack, HO
 #else
 static constexpr size_t MAX_PACKETS_PER_BATCH = 32;  // ESP8266/RP2040/etc have smaller stacks
 #endif
+#ifdef USE_API_BATCH_PRIORITIES
+// Priority classes of the deferred batch. Items are sent in this order and each class has its own batch delay,
+// items of a class that is not due yet only go out when they fit in a packet that is sent anyway.
+enum class BatchPriority : uint8_t {
+  CONTROL = 0,    // Ping and disconnect requests, never delayed
+  STATE = 1,      // User visible state changes
+  TELEMETRY = 2,  // Sensor readings
+  BULK = 3,       // Entity list
+};
+static constexpr uint8_t BATCH_PRIORITY_COUNT = 4;
+#endif
 
 class APIConnection final : public APIServerConnection {
  public:
@@ -131,6 +145,11 @@ class APIConnection final : public APIServerConnection {
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
   bool try_send_log_message(int level, const char *tag, const char *line, size_t message_len);
+#ifdef USE_LOGGER_BINARY
+  bool wants_binary_logs() const { return this->flags_.binary_logs; }
+  bool try_send_binary_log_message(int level, const char *tag, int line, const void *format, const uint8_t *args,
+                                   size_t args_len);
+#endif
 #ifdef USE_API_HOMEASSISTANT_SERVICES
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->flags_.service_call_subscription)
@@ -194,6 +213,9 @@ class APIConnection final : public APIServerConnection {
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
     this->flags_.sent_ping = false;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    this->batch_delay_controller_.record_rtt(App.get_loop_component_start_time() - this->ping_sent_time_);
+#endif
   }
 #ifdef USE_API_HOMEASSISTANT_STATES
   void on_home_assistant_state_response(const HomeAssistantStateResponse &msg) override;
@@ -208,13 +230,26 @@ class APIConnection final : public APIServerConnection {
   bool send_disconnect_response(const DisconnectRequest &msg) override;
   bool send_ping_response(const PingRequest &msg) override;
   bool send_device_info_response(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override {
+#ifdef USE_API_LIST_ENTITIES_CACHE
+    this->flags_.list_entities_from_cache = this->parent_->get_list_entities_cache().begin(this);
+#endif
+    this->list_entities_iterator_.begin();
+  }
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->flags_.state_subscription = true;
+#ifdef USE_API_PARTIAL_STATES
+    this->flags_.partial_states = msg.partial_states;
+    this->partial_states_.clear();
+#endif
     this->initial_state_iterator_.begin();
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->flags_.log_subscription = msg.level;
+#ifdef USE_LOGGER_BINARY
+    this->flags_.binary_logs = msg.binary;
+    this->parent_->update_binary_log_subscribers();
+#endif
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -232,6 +267,9 @@ class APIConnection final : public APIServerConnection {
 #ifdef USE_API_NOISE
   bool send_noise_encryption_set_key_response(const NoiseEncryptionSetKeyRequest &msg) override;
 #endif
+#ifdef USE_BOOT_TIMELINE
+  bool send_boot_timeline_response(const BootTimelineRequest &msg) override;
+#endif
 
   bool is_authenticated() override {
     return static_cast<ConnectionState>(this->flags_.connection_state) == ConnectionState::AUTHENTICATED;
@@ -279,11 +317,18 @@ class APIConnection final : public APIServerConnection {
   bool send_buffer(ProtoWriteBuffer buffer, uint8_t message_type) override;
 
   std::string get_client_combined_info() const { return this->client_info_.get_combined_info(); }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  /// Current batch delay and congestion counters of this connection
+  const AdaptiveBatchDelay &get_batch_delay_controller() const { return this->batch_delay_controller_; }
+#endif
 
  protected:
   // Helper function to handle authentication completion
   void complete_authentication_();
 
+  void record_log_line_dropped_();
+  bool send_log_lines_dropped_();
+
 #ifdef USE_API_HOMEASSISTANT_STATES
   void process_state_subscriptions_();
 #endif
@@ -292,6 +337,15 @@ class APIConnection final : public APIServerConnection {
   static uint16_t encode_message_to_buffer(ProtoMessage &msg, uint8_t message_type, APIConnection *conn,
                                            uint32_t remaining_size, bool is_single);
 
+  // Make room for a message of payload_size bytes (plus frame header/footer) in the shared buffer.
+  // Returns the buffer to encode into, or nullptr if the message does not fit in remaining_size.
+  std::vector<uint8_t> *reserve_message_buffer_(uint32_t payload_size, uint32_t remaining_size, bool is_single);
+  // Size of a framed message as returned by the try_send_* creators
+  uint16_t message_total_size_(uint32_t payload_size) const {
+    return static_cast<uint16_t>(payload_size + this->helper_->frame_header_padding() +
+                                 this->helper_->frame_footer_size());
+  }
+
   // Helper to fill entity state base and encode message
   static uint16_t fill_and_encode_entity_state(EntityBase *entity, StateResponseProtoMessage &msg, uint8_t message_type,
                                                APIConnection *conn, uint32_t remaining_size, bool is_single) {
@@ -299,9 +353,79 @@ class APIConnection final : public APIServerConnection {
 #ifdef USE_DEVICES
     msg.device_id = entity->get_device_id();
 #endif
+#ifdef USE_API_PARTIAL_STATES
+    if (conn->flags_.partial_states)
+      return encode_partial_state_(msg, message_type, conn, remaining_size, is_single);
+#endif
+#ifdef USE_API_SHARED_STATE_ENCODING
+    uint16_t total;
+    if (conn->try_send_shared_state_(entity, message_type, remaining_size, is_single, total))
+      return total;
+    total = encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+    conn->share_state_(entity, message_type, total);
+    return total;
+#else
     return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+#endif
+  }
+
+  // Same as fill_and_encode_entity_state() for messages generated with the inline_encode option.
+  // calculate_size() and encode() are called on the final type, so they are inlined here instead of
+  // going through the ProtoMessage vtable.
+  template<typename T>
+  static uint16_t fill_and_encode_inline_entity_state(EntityBase *entity, T &msg, APIConnection *conn,
+                                                      uint32_t remaining_size, bool is_single) {
+    static_assert(std::is_final_v<T>, "inline encoding requires a final message type");
+    msg.key = entity->get_object_id_hash();
+#ifdef USE_DEVICES
+    msg.device_id = entity->get_device_id();
+#endif
+#ifdef USE_API_PARTIAL_STATES
+    if (conn->flags_.partial_states)
+      return encode_partial_state_(msg, T::MESSAGE_TYPE, conn, remaining_size, is_single);
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    if (conn->flags_.log_only_mode)
+      return encode_message_to_buffer(msg, T::MESSAGE_TYPE, conn, remaining_size, is_single);
+#endif
+#ifdef USE_API_SHARED_STATE_ENCODING
+    uint16_t shared_size;
+    if (conn->try_send_shared_state_(entity, T::MESSAGE_TYPE, remaining_size, is_single, shared_size))
+      return shared_size;
+#endif
+    ProtoSize size;
+    msg.T::calculate_size(size);
+    std::vector<uint8_t> *buf = conn->reserve_message_buffer_(size.get_size(), remaining_size, is_single);
+    if (buf == nullptr)
+      return 0;
+    msg.T::encode({buf});
+#ifdef USE_API_SHARED_STATE_ENCODING
+    conn->share_state_(entity, T::MESSAGE_TYPE, conn->message_total_size_(size.get_size()));
+#endif
+    return conn->message_total_size_(size.get_size());
   }
 
+#ifdef USE_API_SHARED_STATE_ENCODING
+  // Copy the payload another connection encoded for the current state of entity into the batch. Returns false
+  // if there is none, size is set to what the try_send_* creator would have returned otherwise.
+  bool try_send_shared_state_(EntityBase *entity, uint8_t message_type, uint32_t remaining_size, bool is_single,
+                              uint16_t &size);
+  // Offer the state that was just encoded at the end of the shared buffer to the other connections
+  void share_state_(EntityBase *entity, uint8_t message_type, uint16_t total_size);
+#endif
+#if defined(USE_API_LIST_ENTITIES_CACHE) || defined(USE_API_SHARED_STATE_ENCODING)
+  // Append an already encoded payload to the batch, returns the same as encode_message_to_buffer()
+  uint16_t copy_payload_to_buffer_(const uint8_t *data, uint16_t len, uint32_t remaining_size, bool is_single);
+  // Start of the payload that was just encoded at the end of the shared buffer, total_size includes the frame
+  const uint8_t *last_encoded_payload_(uint16_t total_size, uint16_t &len);
+#endif
+
+#ifdef USE_API_PARTIAL_STATES
+  // Encode only the fields that changed since the last state of this entity sent on this connection
+  static uint16_t encode_partial_state_(StateResponseProtoMessage &msg, uint8_t message_type, APIConnection *conn,
+                                        uint32_t remaining_size, bool is_single);
+#endif
+
   // Helper to fill entity info base and encode message
   static uint16_t fill_and_encode_entity_info(EntityBase *entity, InfoResponseProtoMessage &msg, uint8_t message_type,
                                               APIConnection *conn, uint32_t remaining_size, bool is_single) {
@@ -332,9 +456,25 @@ class APIConnection final : public APIServerConnection {
 #ifdef USE_DEVICES
     msg.device_id = entity->get_device_id();
 #endif
+#ifdef USE_API_LIST_ENTITIES_CACHE
+    uint16_t total = encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+    if (total != 0)
+      conn->cache_entity_info_(entity, message_type, total);
+    return total;
+#else
     return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+#endif
   }
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  // Store the info message that was just encoded at the end of the shared buffer in the server's cache
+  void cache_entity_info_(EntityBase *entity, uint8_t message_type, uint16_t total_size);
+  // Copy the cached info message of entity into the batch. Returns false if it is not cached, size is set to
+  // what the try_send_* creator would have returned otherwise.
+  bool try_send_cached_info_(EntityBase *entity, uint8_t message_type, uint32_t remaining_size, bool is_single,
+                             uint16_t &size);
+#endif
+
 #ifdef USE_VOICE_ASSISTANT
   // Helper to check voice assistant validity and connection ownership
   inline bool check_voice_assistant_api_connection_() const;
@@ -467,6 +607,13 @@ class APIConnection final : public APIServerConnection {
 #ifdef USE_CAMERA
   static uint16_t try_send_camera_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                        bool is_single);
+#endif
+#ifdef USE_CAMERA
+  // Send the next part of the current camera image
+  void send_camera_image_();
+#ifdef USE_API_PLAINTEXT
+  void stream_camera_image_();
+#endif
 #endif
 
   // Method for ListEntitiesDone batching
@@ -491,6 +638,12 @@ class APIConnection final : public APIServerConnection {
   // These contain vectors/pointers internally, so putting them early ensures good alignment
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
+#ifdef USE_API_PARTIAL_STATES
+  PartialStateTracker partial_states_;
+#endif
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  AdaptiveBatchDelay batch_delay_controller_;
+#endif
 #ifdef USE_CAMERA
   std::unique_ptr<camera::CameraImageReader> image_reader_;
 #endif
@@ -500,6 +653,9 @@ class APIConnection final : public APIServerConnection {
 
   // Group 4: 4-byte types
   uint32_t last_traffic_;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  uint32_t ping_sent_time_{0};
+#endif
 #ifdef USE_API_HOMEASSISTANT_STATES
   int state_subs_at_ = -1;
 #endif
@@ -563,6 +719,9 @@ class APIConnection final : public APIServerConnection {
       MessageCreator creator;  // Function that creates the message when needed
       uint8_t message_type;    // Message type for overhead calculation (max 255)
       uint8_t estimated_size;  // Estimated message size (max 255 bytes)
+#ifdef USE_API_BATCH_PRIORITIES
+      BatchPriority priority{BatchPriority::STATE};  // Fits in the padding after estimated_size
+#endif
 
       // Constructor for creating BatchItem
       BatchItem(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size)
@@ -570,7 +729,13 @@ class APIConnection final : public APIServerConnection {
     };
 
     std::vector<BatchItem> items;
+#ifdef USE_API_BATCH_PRIORITIES
+    // When the oldest item of each priority was added, only valid if its bit is set in pending_priorities
+    uint32_t priority_start_time[BATCH_PRIORITY_COUNT]{};
+    uint8_t pending_priorities{0};
+#else
     uint32_t batch_start_time{0};
+#endif
 
    private:
     // Helper to cleanup items from the beginning
@@ -591,8 +756,16 @@ class APIConnection final : public APIServerConnection {
       clear();
     }
 
+#ifdef USE_API_BATCH_PRIORITIES
+    // Add item behind all items of the same or a higher priority
+    void add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size,
+                  BatchPriority priority);
+    // Drop the pending bit of priorities that have no items left
+    void update_pending_priorities();
+#else
     // Add item to the batch
     void add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
+#endif
     // Add item to the front of the batch (for high priority messages like ping)
     void add_item_front(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
 
@@ -600,7 +773,11 @@ class APIConnection final : public APIServerConnection {
     void clear() {
       cleanup_items_(items.size());
       items.clear();
+#ifdef USE_API_BATCH_PRIORITIES
+      pending_priorities = 0;
+#else
       batch_start_time = 0;
+#endif
     }
 
     // Remove processed items from the front with proper cleanup
@@ -641,15 +818,27 @@ class APIConnection final : public APIServerConnection {
     uint8_t batch_scheduled : 1;
     uint8_t batch_first_message : 1;          // For batch buffer allocation
     uint8_t should_try_send_immediately : 1;  // True after initial states are sent
+#ifdef USE_API_PARTIAL_STATES
+    uint8_t partial_states : 1;  // Client asked for changed fields only
+#endif
+#ifdef USE_API_LIST_ENTITIES_CACHE
+    uint8_t list_entities_from_cache : 1;  // Current entity list is replayed from the server's cache
+#endif
+#ifdef USE_LOGGER_BINARY
+    uint8_t binary_logs : 1;  // Client formats lines above the logger's text_level itself
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
     uint8_t log_only_mode : 1;
 #endif
-  } flags_{};  // 2 bytes total
+  } flags_{};  // 2 bytes, 3 once more than 16 bits are in use
+  static_assert(sizeof(APIFlags) <= 3, "APIFlags should fit in 3 bytes");
 
-  // 2-byte types immediately after flags_ (no padding between them)
+  // 2-byte types after flags_ (one byte of padding in between if flags_ takes 3 bytes)
   uint16_t client_api_version_major_{0};
   uint16_t client_api_version_minor_{0};
-  // Total: 2 (flags) + 2 + 2 = 6 bytes, then 2 bytes padding to next 4-byte boundary
+  // Log lines lost since the last one that was sent, reported to the client once there is room again
+  uint16_t log_lines_dropped_{0};
+  // Total: 2 (flags) + 2 + 2 + 2 = 8 bytes, or 3 + 1 (padding) + 2 + 2 + 2 = 10 bytes padded to 12
 
   uint32_t get_batch_delay_ms_() const;
   // Message will use 8 more bytes than the minimum size, and typical
@@ -666,6 +855,11 @@ class APIConnection final : public APIServerConnection {
   static constexpr size_t MAX_BATCH_PACKET_SIZE = 1390;  // MTU
 
   bool schedule_batch_();
+#ifdef USE_API_BATCH_PRIORITIES
+  bool schedule_batch_(BatchPriority priority);
+  BatchPriority batch_priority_(uint8_t message_type) const;
+#endif
+  bool is_batch_due_(uint32_t now) const;
   void process_batch_();
   void clear_batch_() {
     this->deferred_batch_.clear();
@@ -704,12 +898,18 @@ class APIConnection final : public APIServerConnection {
       // Now actually encode and send
       if (creator(entity, this, MAX_BATCH_PACKET_SIZE, true) &&
           this->send_buffer(ProtoWriteBuffer{&this->parent_->get_shared_buffer_ref()}, message_type)) {
+#ifdef USE_API_PARTIAL_STATES
+        this->partial_states_.commit();
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
         // Log the message in verbose mode
         this->log_proto_message_(entity, MessageCreator(creator), message_type);
 #endif
         return true;
       }
+#ifdef USE_API_PARTIAL_STATES
+      this->partial_states_.discard();
+#endif
 
       // If immediate send failed, fall through to batching
     }
@@ -720,8 +920,14 @@ class APIConnection final : public APIServerConnection {
 
   // Helper function to schedule a deferred message with known message type
   bool schedule_message_(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size) {
+#ifdef USE_API_BATCH_PRIORITIES
+    const BatchPriority priority = this->batch_priority_(message_type);
+    this->deferred_batch_.add_item(entity, std::move(creator), message_type, estimated_size, priority);
+    return this->schedule_batch_(priority);
+#else
     this->deferred_batch_.add_item(entity, std::move(creator), message_type, estimated_size);
     return this->schedule_batch_();
+#endif
   }
 
   // Overload for function pointers (for info messages and current state reads)
@@ -733,8 +939,15 @@ class APIConnection final : public APIServerConnection {
   // Helper function to schedule a high priority message at the front of the batch
   bool schedule_message_front_(EntityBase *entity, MessageCreatorPtr function_ptr, uint8_t message_type,
                                uint8_t estimated_size) {
+#ifdef USE_API_BATCH_PRIORITIES
+    // CONTROL sorts before everything else
+    this->deferred_batch_.add_item(entity, MessageCreator(function_ptr), message_type, estimated_size,
+                                   BatchPriority::CONTROL);
+    return this->schedule_batch_(BatchPriority::CONTROL);
+#else
     this->deferred_batch_.add_item_front(entity, MessageCreator(function_ptr), message_type, estimated_size);
     return this->schedule_batch_();
+#endif
   }
 
   // Helper function to log API errors with errno
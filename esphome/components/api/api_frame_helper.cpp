@@ -6,6 +6,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "proto.h"
+#include <algorithm>
 #include <cstring>
 #include <cinttypes>
 
@@ -78,9 +79,19 @@ const LogString *api_error_to_logstr(APIError err) {
   return LOG_STR("UNKNOWN");
 }
 
+APIFrameHelper::~APIFrameHelper() {
+  for (TxChunk *list : {this->tx_head_, this->tx_free_}) {
+    while (list != nullptr) {
+      TxChunk *next = list->next;
+      delete list;
+      list = next;
+    }
+  }
+}
+
 // Default implementation for loop - handles sending buffered data
 APIError APIFrameHelper::loop() {
-  if (!this->tx_buf_.empty()) {
+  if (this->tx_head_ != nullptr) {
     APIError err = try_send_tx_buf_();
     if (err != APIError::OK && err != APIError::WOULD_BLOCK) {
       return err;
@@ -99,30 +110,63 @@ APIError APIFrameHelper::handle_socket_write_error_() {
   return APIError::SOCKET_WRITE_FAILED;
 }
 
+APIFrameHelper::TxChunk *APIFrameHelper::take_tx_chunk_() {
+  TxChunk *chunk = this->tx_free_;
+  if (chunk == nullptr)
+    return new TxChunk();  // NOLINT(cppcoreguidelines-owning-memory)
+  this->tx_free_ = chunk->next;
+  this->tx_free_count_--;
+  chunk->next = nullptr;
+  chunk->start = 0;
+  chunk->end = 0;
+  return chunk;
+}
+
+void APIFrameHelper::release_tx_chunk_(TxChunk *chunk) {
+  if (this->tx_free_count_ >= TX_CHUNK_POOL_SIZE) {
+    delete chunk;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
+  }
+  chunk->next = this->tx_free_;
+  this->tx_free_ = chunk;
+  this->tx_free_count_++;
+}
+
+void APIFrameHelper::queue_tx_data_(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    if (this->tx_tail_ == nullptr || this->tx_tail_->end == TX_CHUNK_SIZE) {
+      TxChunk *chunk = this->take_tx_chunk_();
+      if (this->tx_tail_ == nullptr) {
+        this->tx_head_ = chunk;
+      } else {
+        this->tx_tail_->next = chunk;
+      }
+      this->tx_tail_ = chunk;
+    }
+    TxChunk *tail = this->tx_tail_;
+    const size_t n = std::min<size_t>(len, TX_CHUNK_SIZE - tail->end);
+    std::memcpy(tail->data + tail->end, data, n);
+    tail->end += n;
+    data += n;
+    len -= n;
+  }
+}
+
 // Helper method to buffer data from IOVs
 void APIFrameHelper::buffer_data_from_iov_(const struct iovec *iov, int iovcnt, uint16_t total_write_len,
                                            uint16_t offset) {
-  SendBuffer buffer;
-  buffer.size = total_write_len - offset;
-  buffer.data = std::make_unique<uint8_t[]>(buffer.size);
-
   uint16_t to_skip = offset;
-  uint16_t write_pos = 0;
-
   for (int i = 0; i < iovcnt; i++) {
     if (to_skip >= iov[i].iov_len) {
       // Skip this entire segment
       to_skip -= static_cast<uint16_t>(iov[i].iov_len);
     } else {
-      // Include this segment (partially or fully)
+      // Queue this segment (partially or fully)
       const uint8_t *src = reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_skip;
-      uint16_t len = static_cast<uint16_t>(iov[i].iov_len) - to_skip;
-      std::memcpy(buffer.data.get() + write_pos, src, len);
-      write_pos += len;
+      this->queue_tx_data_(src, iov[i].iov_len - to_skip);
       to_skip = 0;
     }
   }
-  this->tx_buf_.push_back(std::move(buffer));
 }
 
 // This method writes data to socket or buffers it
@@ -133,6 +177,22 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
   if (iovcnt == 0)
     return APIError::OK;  // Nothing to do, success
 
+#ifdef USE_API_PLAINTEXT
+  if (this->stream_remaining_ != 0 && !this->stream_writing_) {
+    // The streamed message has to be complete before anything else goes on the wire
+    if (this->stream_held_.size() + total_write_len > STREAM_HELD_MAX_SIZE) {
+      HELPER_LOG("Too much data held back during a streamed message");
+      this->state_ = State::FAILED;
+      return APIError::OUT_OF_MEMORY;
+    }
+    for (int i = 0; i < iovcnt; i++) {
+      const auto *data = reinterpret_cast<const uint8_t *>(iov[i].iov_base);
+      this->stream_held_.insert(this->stream_held_.end(), data, data + iov[i].iov_len);
+    }
+    return APIError::OK;
+  }
+#endif
+
 #ifdef HELPER_LOG_PACKETS
   for (int i = 0; i < iovcnt; i++) {
     LOG_PACKET_SENDING(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len);
@@ -140,7 +200,7 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
 #endif
 
   // Try to send any existing buffered data first if there is any
-  if (!this->tx_buf_.empty()) {
+  if (this->tx_head_ != nullptr) {
     APIError send_result = try_send_tx_buf_();
     // If real error occurred (not just WOULD_BLOCK), return it
     if (send_result != APIError::OK && send_result != APIError::WOULD_BLOCK) {
@@ -149,7 +209,7 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
 
     // If there is still data in the buffer, we can't send, buffer
     // the new data and return
-    if (!this->tx_buf_.empty()) {
+    if (this->tx_head_ != nullptr) {
       this->buffer_data_from_iov_(iov, iovcnt, total_write_len, 0);
       return APIError::OK;  // Success, data buffered
     }
@@ -177,33 +237,72 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
 }
 
 // Common implementation for trying to send buffered data
-// IMPORTANT: Caller MUST ensure tx_buf_ is not empty before calling this method
+// IMPORTANT: Caller MUST ensure the send queue is not empty before calling this method
+#ifdef USE_API_PLAINTEXT
+APIError APIFrameHelper::write_stream(const uint8_t *data, uint16_t len) {
+  if (len > this->stream_remaining_)
+    return APIError::BAD_ARG;
+  struct iovec iov;
+  iov.iov_base = const_cast<uint8_t *>(data);
+  iov.iov_len = len;
+  this->stream_writing_ = true;
+  APIError err = this->write_raw_(&iov, 1, len);
+  this->stream_writing_ = false;
+  if (err != APIError::OK)
+    return err;
+  this->stream_remaining_ -= len;
+  if (this->stream_remaining_ != 0 || this->stream_held_.empty())
+    return APIError::OK;
+  // Message complete, send what was written in the meantime
+  std::vector<uint8_t> held;
+  held.swap(this->stream_held_);
+  iov.iov_base = held.data();
+  iov.iov_len = held.size();
+  return this->write_raw_(&iov, 1, held.size());
+}
+#endif
+
 APIError APIFrameHelper::try_send_tx_buf_() {
-  // Try to send from tx_buf - we assume it's not empty as it's the caller's responsibility to check
-  bool tx_buf_empty = false;
-  while (!tx_buf_empty) {
-    // Get the first buffer in the queue
-    SendBuffer &front_buffer = this->tx_buf_.front();
+  while (this->tx_head_ != nullptr) {
+    // Hand as many queued chunks as possible to a single write
+    struct iovec iov[TX_MAX_IOVS];
+    int iovcnt = 0;
+    size_t queued = 0;
+    for (TxChunk *chunk = this->tx_head_; chunk != nullptr && iovcnt < TX_MAX_IOVS; chunk = chunk->next) {
+      iov[iovcnt].iov_base = chunk->data + chunk->start;
+      iov[iovcnt].iov_len = chunk->end - chunk->start;
+      queued += iov[iovcnt].iov_len;
+      iovcnt++;
+    }
 
-    // Try to send the remaining data in this buffer
-    ssize_t sent = this->socket_->write(front_buffer.current_data(), front_buffer.remaining());
+    ssize_t sent =
+        (iovcnt == 1) ? this->socket_->write(iov[0].iov_base, iov[0].iov_len) : this->socket_->writev(iov, iovcnt);
 
     if (sent == -1) {
       return this->handle_socket_write_error_();
     } else if (sent == 0) {
       // Nothing sent but not an error
       return APIError::WOULD_BLOCK;
-    } else if (static_cast<uint16_t>(sent) < front_buffer.remaining()) {
-      // Partially sent, update offset
-      // Cast to ensure no overflow issues with uint16_t
-      front_buffer.offset += static_cast<uint16_t>(sent);
-      return APIError::WOULD_BLOCK;  // Stop processing more buffers if we couldn't send a complete buffer
-    } else {
-      // Buffer completely sent, remove it from the queue
-      this->tx_buf_.pop_front();
-      // Update empty status for the loop condition
-      tx_buf_empty = this->tx_buf_.empty();
-      // Continue loop to try sending the next buffer
+    }
+
+    // Drop what was sent, fully sent chunks go back to the pool
+    size_t remaining = sent;
+    while (remaining > 0) {
+      TxChunk *head = this->tx_head_;
+      const size_t available = head->end - head->start;
+      if (remaining < available) {
+        head->start += remaining;
+        break;
+      }
+      remaining -= available;
+      this->tx_head_ = head->next;
+      if (this->tx_head_ == nullptr)
+        this->tx_tail_ = nullptr;
+      this->release_tx_chunk_(head);
+    }
+
+    if (static_cast<size_t>(sent) < queued) {
+      return APIError::WOULD_BLOCK;  // Stop if the socket did not take everything we offered
     }
   }
 
@@ -1,6 +1,5 @@
 #pragma once
 #include <cstdint>
-#include <deque>
 #include <limits>
 #include <span>
 #include <utility>
@@ -75,11 +74,26 @@ class APIFrameHelper {
       : socket_owned_(std::move(socket)), client_info_(client_info) {
     socket_ = socket_owned_.get();
   }
-  virtual ~APIFrameHelper() = default;
+  virtual ~APIFrameHelper();
   virtual APIError init() = 0;
   virtual APIError loop();
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
-  bool can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
+  bool can_write_without_blocking() {
+    return state_ == State::DATA && tx_head_ == nullptr
+#ifdef USE_API_PLAINTEXT
+           && stream_remaining_ == 0
+#endif
+        ;
+  }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  // Bytes waiting in the send queue
+  size_t tx_queued_bytes() const {
+    size_t queued = 0;
+    for (const TxChunk *chunk = this->tx_head_; chunk != nullptr; chunk = chunk->next)
+      queued += chunk->end - chunk->start;
+    return queued;
+  }
+#endif
   std::string getpeername() { return socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) { return socket_->getpeername(addr, addrlen); }
   APIError close() {
@@ -109,23 +123,54 @@ class APIFrameHelper {
   uint8_t frame_footer_size() const { return frame_footer_size_; }
   // Check if socket has data ready to read
   bool is_socket_ready() const { return socket_ != nullptr && socket_->ready(); }
+#ifdef USE_API_PLAINTEXT
+  // A single large message can be streamed instead of being encoded into one buffer. begin_stream() sends the
+  // frame header, then the payload_size bytes of the message follow in write_stream() calls (of up to UINT16_MAX
+  // bytes each) whenever can_write_stream() is true. Other packets written before the message is complete are held
+  // back and sent after it. Only supported by plaintext, noise has to encrypt the frame as a whole.
+  virtual bool supports_streaming() const { return false; }
+  virtual APIError begin_stream(uint16_t type, uint32_t payload_size) { return APIError::BAD_STATE; }
+  APIError write_stream(const uint8_t *data, uint16_t len);
+  bool is_streaming() const { return this->stream_remaining_ != 0; }
+  bool can_write_stream() const { return state_ == State::DATA && tx_head_ == nullptr; }
+#endif
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  // The client can split a noise frame that carries several messages (ignored by plaintext)
+  void set_coalesce_frames(bool coalesce) { this->coalesce_frames_ = coalesce; }
+#endif
 
  protected:
-  // Buffer containing data to be sent
-  struct SendBuffer {
-    std::unique_ptr<uint8_t[]> data;
-    uint16_t size{0};    // Total size of the buffer
-    uint16_t offset{0};  // Current offset within the buffer
-
-    // Using uint16_t reduces memory usage since ESPHome API messages are limited to UINT16_MAX (65535) bytes
-    uint16_t remaining() const { return size - offset; }
-    const uint8_t *current_data() const { return data.get() + offset; }
+  // Data that could not be written immediately is queued in a chain of fixed-size chunks.
+  // The chain is flushed with a single writev(), and sent chunks are kept in a small free list, so
+  // bursts such as the initial list_entities flood do not allocate (and reallocate) a buffer per message.
+  static constexpr uint16_t TX_CHUNK_SIZE = 512;
+  // Number of sent chunks kept for reuse, the rest is freed
+  static constexpr uint8_t TX_CHUNK_POOL_SIZE = 2;
+  // Maximum number of chunks handed to a single writev()
+  static constexpr uint8_t TX_MAX_IOVS = 8;
+#ifdef USE_API_PLAINTEXT
+  // Packets held back while a message is streamed, a client that falls further behind is disconnected
+  static constexpr uint16_t STREAM_HELD_MAX_SIZE = 4096;
+#endif
+
+  struct TxChunk {
+    TxChunk *next{nullptr};
+    uint16_t start{0};  // First byte not sent yet
+    uint16_t end{0};    // End of the queued data
+    uint8_t data[TX_CHUNK_SIZE];
   };
 
+  // Append data to the send queue
+  void queue_tx_data_(const uint8_t *data, size_t len);
+  // Get a chunk from the free list or allocate a new one
+  TxChunk *take_tx_chunk_();
+  // Return a sent chunk to the free list (or free it if the list is full)
+  void release_tx_chunk_(TxChunk *chunk);
+
   // Common implementation for writing raw data to socket
   APIError write_raw_(const struct iovec *iov, int iovcnt, uint16_t total_write_len);
 
-  // Try to send data from the tx buffer
+  // Try to send the queued data
   APIError try_send_tx_buf_();
 
   // Helper method to buffer data from IOVs
@@ -140,6 +185,10 @@ class APIFrameHelper {
   // Pointers first (4 bytes each)
   socket::Socket *socket_{nullptr};
   std::unique_ptr<socket::Socket> socket_owned_;
+  // Send queue (oldest data at the head) and free chunks
+  TxChunk *tx_head_{nullptr};
+  TxChunk *tx_tail_{nullptr};
+  TxChunk *tx_free_{nullptr};
 
   // Common state enum for all frame helpers
   // Note: Not all states are used by all implementations
@@ -161,9 +210,15 @@ class APIFrameHelper {
   };
 
   // Containers (size varies, but typically 12+ bytes on 32-bit)
-  std::deque<SendBuffer> tx_buf_;
   std::vector<struct iovec> reusable_iovs_;
   std::vector<uint8_t> rx_buf_;
+#ifdef USE_API_PLAINTEXT
+  // Packets written while a message is being streamed
+  std::vector<uint8_t> stream_held_;
+  // Payload bytes of the streamed message that have not been written yet
+  uint32_t stream_remaining_{0};
+  bool stream_writing_{false};
+#endif
 
   // Pointer to client info (4 bytes on 32-bit)
   // Note: The pointed-to ClientInfo object must outlive this APIFrameHelper instance.
@@ -174,7 +229,11 @@ class APIFrameHelper {
   State state_{State::INITIALIZE};
   uint8_t frame_header_padding_{0};
   uint8_t frame_footer_size_{0};
-  // 5 bytes total, 3 bytes padding
+  uint8_t tx_free_count_{0};
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  bool coalesce_frames_{false};
+#endif
+  // 6-7 bytes total, 1-2 bytes padding
 
   // Common initialization for both plaintext and noise protocols
   APIError init_common_();
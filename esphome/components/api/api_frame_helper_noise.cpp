@@ -116,8 +116,9 @@ APIError APINoiseFrameHelper::handle_noise_error_(int err, const LogString *func
 APIError APINoiseFrameHelper::loop() {
   // During handshake phase, process as many actions as possible until we can't progress
   // socket_->ready() stays true until next main loop, but state_action() will return
-  // WOULD_BLOCK when no more data is available to read
-  while (state_ != State::DATA && this->socket_->ready()) {
+  // WOULD_BLOCK when no more data is available to read. A deferred handshake write does not
+  // need new data, it is retried every loop until it gets a slot.
+  while (state_ != State::DATA && (this->socket_->ready() || this->handshake_write_deferred_)) {
     APIError err = state_action_();
     if (err == APIError::WOULD_BLOCK) {
       break;
@@ -315,6 +316,10 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
     } else if (action == NOISE_ACTION_WRITE_MESSAGE) {
+      // Generating the ephemeral key and the DH are the expensive part of the handshake
+      this->handshake_write_deferred_ = !this->ctx_->claim_handshake_slot(App.get_loop_count());
+      if (this->handshake_write_deferred_)
+        return APIError::WOULD_BLOCK;
       uint8_t buffer[65];
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
@@ -450,6 +455,11 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
   std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   uint8_t *buffer_data = raw_buffer->data();  // Cache buffer pointer
 
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  if (this->coalesce_frames_ && packets.size() > 1)
+    return this->write_coalesced_packets_(buffer_data, packets);
+#endif
+
   this->reusable_iovs_.clear();
   this->reusable_iovs_.reserve(packets.size());
   uint16_t total_write_len = 0;
@@ -500,6 +510,46 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
   return this->write_raw_(this->reusable_iovs_.data(), this->reusable_iovs_.size(), total_write_len);
 }
 
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+APIError APINoiseFrameHelper::write_coalesced_packets_(uint8_t *buffer_data, std::span<const PacketInfo> packets) {
+  // All messages are moved back to back into the frame of the first packet, closing the gaps that were left
+  // for the noise header and MAC of the others, so the whole batch is encrypted and authenticated once
+  uint8_t *buf_start = buffer_data + packets[0].offset;
+  uint8_t *msg_start = buf_start + 3;
+  uint8_t *out = msg_start;
+  for (const auto &packet : packets) {
+    const uint8_t *payload = buffer_data + packet.offset + frame_header_padding_;
+    // out never passes the payload, the header of a later packet only overwrites bytes that were already moved
+    out[0] = static_cast<uint8_t>(packet.message_type >> 8);
+    out[1] = static_cast<uint8_t>(packet.message_type);
+    out[2] = static_cast<uint8_t>(packet.payload_size >> 8);
+    out[3] = static_cast<uint8_t>(packet.payload_size);
+    if (out + 4 != payload)
+      memmove(out + 4, payload, packet.payload_size);
+    out += 4 + packet.payload_size;
+  }
+
+  // The buffer was sized for a MAC after every packet, there is room for one after the coalesced messages
+  const size_t msg_len = out - msg_start;
+  NoiseBuffer mbuf;
+  noise_buffer_init(mbuf);
+  noise_buffer_set_inout(mbuf, msg_start, msg_len, msg_len + frame_footer_size_);
+  int err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+  APIError aerr = handle_noise_error_(err, LOG_STR("noise_cipherstate_encrypt"), APIError::CIPHERSTATE_ENCRYPT_FAILED);
+  if (aerr != APIError::OK)
+    return aerr;
+
+  buf_start[0] = 0x01;  // indicator
+  buf_start[1] = static_cast<uint8_t>(mbuf.size >> 8);
+  buf_start[2] = static_cast<uint8_t>(mbuf.size);
+
+  struct iovec iov;
+  iov.iov_base = buf_start;
+  iov.iov_len = 3 + mbuf.size;
+  return this->write_raw_(&iov, 1, iov.iov_len);
+}
+#endif
+
 APIError APINoiseFrameHelper::write_frame_(const uint8_t *data, uint16_t len) {
   uint8_t header[3];
   header[0] = 0x01;  // indicator
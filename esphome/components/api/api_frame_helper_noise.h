@@ -30,6 +30,9 @@ class APINoiseFrameHelper final : public APIFrameHelper {
   APIError state_action_();
   APIError try_read_frame_(std::vector<uint8_t> *frame);
   APIError write_frame_(const uint8_t *data, uint16_t len);
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  APIError write_coalesced_packets_(uint8_t *buffer_data, std::span<const PacketInfo> packets);
+#endif
   APIError init_handshake_();
   APIError check_handshake_finished_();
   void send_explicit_handshake_reject_(const LogString *reason);
@@ -56,7 +59,9 @@ class APINoiseFrameHelper final : public APIFrameHelper {
   // Note: Maximum message size is UINT16_MAX (65535), with a limit of 128 bytes during handshake phase
   uint8_t rx_header_buf_[3];
   uint8_t rx_header_buf_len_ = 0;
-  // 4 bytes total, no padding
+  // The next handshake message is waiting for APINoiseContext::claim_handshake_slot()
+  bool handshake_write_deferred_ = false;
+  // 5 bytes total, 3 bytes padding
 };
 
 }  // namespace esphome::api
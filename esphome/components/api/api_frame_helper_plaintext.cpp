@@ -61,6 +61,23 @@ APIError APIPlaintextFrameHelper::try_read_frame_(std::vector<uint8_t> *frame) {
     return APIError::BAD_ARG;
   }
 
+  // When the socket exposes its receive buffer the header is usually complete in there and can be parsed in
+  // place, saving the byte by byte reads below
+  if (!rx_header_parsed_ && rx_header_buf_pos_ == 0) {
+    uint8_t *peeked;
+    ssize_t available = this->socket_->peek(&peeked);
+    // A bad indicator or an oversized header is left for the regular path to report
+    if (available > 0 && peeked[0] == 0x00) {
+      uint8_t header_len;
+      APIError err = this->parse_header_(peeked, std::min<size_t>(available, sizeof(rx_header_buf_) - 1), &header_len);
+      if (err != APIError::OK) {
+        return err;
+      }
+      if (header_len != 0)
+        this->socket_->consume(header_len);
+    }
+  }
+
   // read header
   while (!rx_header_parsed_) {
     // Now that we know when the socket is ready, we can read up to 3 bytes
@@ -100,52 +117,15 @@ APIError APIPlaintextFrameHelper::try_read_frame_(std::vector<uint8_t> *frame) {
       continue;
     }
 
-    // At this point, we have at least 3 bytes total:
-    //   - Validated indicator byte (0x00) stored at position 0
-    //   - At least 2 bytes in the buffer for the varints
-    // Buffer layout:
-    //   [0]: indicator byte (0x00)
-    //   [1-3]: Message size varint (variable length)
-    //     - 2 bytes would only allow up to 16383, which is less than noise's UINT16_MAX (65535)
-    //     - 3 bytes allows up to 2097151, ensuring we support at least as much as noise
-    //   [2-5]: Message type varint (variable length)
-    // We now attempt to parse both varints. If either is incomplete,
-    // we'll continue reading more bytes.
-
-    // Skip indicator byte at position 0
-    uint8_t varint_pos = 1;
-    uint32_t consumed = 0;
-
-    auto msg_size_varint = ProtoVarInt::parse(&rx_header_buf_[varint_pos], rx_header_buf_pos_ - varint_pos, &consumed);
-    if (!msg_size_varint.has_value()) {
-      // not enough data there yet
-      continue;
-    }
-
-    if (msg_size_varint->as_uint32() > std::numeric_limits<uint16_t>::max()) {
-      state_ = State::FAILED;
-      HELPER_LOG("Bad packet: message size %" PRIu32 " exceeds maximum %u", msg_size_varint->as_uint32(),
-                 std::numeric_limits<uint16_t>::max());
-      return APIError::BAD_DATA_PACKET;
+    uint8_t header_len;
+    err = this->parse_header_(rx_header_buf_, rx_header_buf_pos_, &header_len);
+    if (err != APIError::OK) {
+      return err;
     }
-    rx_header_parsed_len_ = msg_size_varint->as_uint16();
-
-    // Move to next varint position
-    varint_pos += consumed;
-
-    auto msg_type_varint = ProtoVarInt::parse(&rx_header_buf_[varint_pos], rx_header_buf_pos_ - varint_pos, &consumed);
-    if (!msg_type_varint.has_value()) {
+    if (header_len == 0) {
       // not enough data there yet
       continue;
     }
-    if (msg_type_varint->as_uint32() > std::numeric_limits<uint16_t>::max()) {
-      state_ = State::FAILED;
-      HELPER_LOG("Bad packet: message type %" PRIu32 " exceeds maximum %u", msg_type_varint->as_uint32(),
-                 std::numeric_limits<uint16_t>::max());
-      return APIError::BAD_DATA_PACKET;
-    }
-    rx_header_parsed_type_ = msg_type_varint->as_uint16();
-    rx_header_parsed_ = true;
   }
   // header reading done
 
@@ -178,6 +158,59 @@ APIError APIPlaintextFrameHelper::try_read_frame_(std::vector<uint8_t> *frame) {
   rx_header_parsed_ = false;
   return APIError::OK;
 }
+APIError APIPlaintextFrameHelper::parse_header_(const uint8_t *data, size_t len, uint8_t *header_len) {
+  *header_len = 0;
+  // At least 3 bytes are needed (indicator + 2 varint bytes) before trying to parse
+  if (len < 3) {
+    return APIError::OK;
+  }
+
+  // Buffer layout:
+  //   [0]: indicator byte (0x00)
+  //   [1-3]: Message size varint (variable length)
+  //     - 2 bytes would only allow up to 16383, which is less than noise's UINT16_MAX (65535)
+  //     - 3 bytes allows up to 2097151, ensuring we support at least as much as noise
+  //   [2-5]: Message type varint (variable length)
+  // If either varint is incomplete, more bytes have to be read first.
+
+  // Skip indicator byte at position 0
+  uint8_t varint_pos = 1;
+  uint32_t consumed = 0;
+
+  auto msg_size_varint = ProtoVarInt::parse(&data[varint_pos], len - varint_pos, &consumed);
+  if (!msg_size_varint.has_value()) {
+    // not enough data there yet
+    return APIError::OK;
+  }
+
+  if (msg_size_varint->as_uint32() > std::numeric_limits<uint16_t>::max()) {
+    state_ = State::FAILED;
+    HELPER_LOG("Bad packet: message size %" PRIu32 " exceeds maximum %u", msg_size_varint->as_uint32(),
+               std::numeric_limits<uint16_t>::max());
+    return APIError::BAD_DATA_PACKET;
+  }
+
+  // Move to next varint position
+  varint_pos += consumed;
+
+  auto msg_type_varint = ProtoVarInt::parse(&data[varint_pos], len - varint_pos, &consumed);
+  if (!msg_type_varint.has_value()) {
+    // not enough data there yet
+    return APIError::OK;
+  }
+  if (msg_type_varint->as_uint32() > std::numeric_limits<uint16_t>::max()) {
+    state_ = State::FAILED;
+    HELPER_LOG("Bad packet: message type %" PRIu32 " exceeds maximum %u", msg_type_varint->as_uint32(),
+               std::numeric_limits<uint16_t>::max());
+    return APIError::BAD_DATA_PACKET;
+  }
+  rx_header_parsed_len_ = msg_size_varint->as_uint16();
+  rx_header_parsed_type_ = msg_type_varint->as_uint16();
+  rx_header_parsed_ = true;
+  *header_len = varint_pos + consumed;
+  return APIError::OK;
+}
+
 APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   APIError aerr;
 
@@ -230,6 +263,31 @@ APIError APIPlaintextFrameHelper::write_protobuf_packet(uint8_t type, ProtoWrite
   return write_protobuf_packets(buffer, std::span<const PacketInfo>(&packet, 1));
 }
 
+APIError APIPlaintextFrameHelper::begin_stream(uint16_t type, uint32_t payload_size) {
+  if (state_ != State::DATA) {
+    return APIError::BAD_STATE;
+  }
+  if (this->is_streaming() || payload_size == 0) {
+    return APIError::BAD_ARG;
+  }
+  // indicator + payload size varint + message type varint
+  uint8_t header[1 + 5 + 3];
+  const uint8_t size_varint_len = api::ProtoSize::varint(payload_size);
+  const uint8_t type_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(type));
+  header[0] = 0x00;  // indicator
+  ProtoVarInt(payload_size).encode_to_buffer_unchecked(header + 1, size_varint_len);
+  ProtoVarInt(type).encode_to_buffer_unchecked(header + 1 + size_varint_len, type_varint_len);
+
+  struct iovec iov;
+  iov.iov_base = header;
+  iov.iov_len = 1 + size_varint_len + type_varint_len;
+  APIError err = write_raw_(&iov, 1, iov.iov_len);
+  if (err == APIError::OK) {
+    this->stream_remaining_ = payload_size;
+  }
+  return err;
+}
+
 APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
@@ -22,9 +22,13 @@ class APIPlaintextFrameHelper final : public APIFrameHelper {
   APIError read_packet(ReadPacketBuffer *buffer) override;
   APIError write_protobuf_packet(uint8_t type, ProtoWriteBuffer buffer) override;
   APIError write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) override;
+  bool supports_streaming() const override { return true; }
+  APIError begin_stream(uint16_t type, uint32_t payload_size) override;
 
  protected:
   APIError try_read_frame_(std::vector<uint8_t> *frame);
+  // Parse indicator, size and type at the start of data. *header_len is 0 if data does not hold the whole header yet
+  APIError parse_header_(const uint8_t *data, size_t len, uint8_t *header_len);
 
   // Group 2-byte aligned types
   uint16_t rx_header_parsed_type_ = 0;
@@ -21,9 +21,22 @@ class APINoiseContext {
   const psk_t &get_psk() const { return this->psk_; }
   bool has_psk() const { return this->has_psk_; }
 
+  /// Handshake steps that run Curve25519 are limited to one per main loop iteration (identified by
+  /// App.get_loop_count()) across all connections, so a burst of reconnecting clients is spread out instead of
+  /// blocking the loop. Returns false if a step already ran during this iteration.
+  bool claim_handshake_slot(uint32_t loop_count) {
+    if (this->handshake_slot_used_ && this->handshake_loop_count_ == loop_count)
+      return false;
+    this->handshake_loop_count_ = loop_count;
+    this->handshake_slot_used_ = true;
+    return true;
+  }
+
  protected:
   psk_t psk_{};
+  uint32_t handshake_loop_count_{0};
   bool has_psk_{false};
+  bool handshake_slot_used_{false};
 };
 #endif  // USE_API_NOISE
 
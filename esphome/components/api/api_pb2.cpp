@@ -15,6 +15,11 @@ bool HelloRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
     case 3:
       this->api_version_minor = value.as_uint32();
       break;
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+    case 4:
+      this->noise_coalesce_frames = value.as_bool();
+      break;
+#endif
     default:
       return false;
   }
@@ -135,6 +140,9 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
 #ifdef USE_ZWAVE_PROXY
   buffer.encode_uint32(24, this->zwave_home_id);
 #endif
+#ifdef USE_API_PARTIAL_STATES
+  buffer.encode_bool(25, this->partial_states_supported);
+#endif
 }
 void DeviceInfoResponse::calculate_size(ProtoSize &size) const {
 #ifdef USE_API_PASSWORD
@@ -193,6 +201,19 @@ void DeviceInfoResponse::calculate_size(ProtoSize &size) const {
 #ifdef USE_ZWAVE_PROXY
   size.add_uint32(2, this->zwave_home_id);
 #endif
+#ifdef USE_API_PARTIAL_STATES
+  size.add_bool(2, this->partial_states_supported);
+#endif
+}
+bool SubscribeStatesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1:
+      this->partial_states = value.as_bool();
+      break;
+    default:
+      return false;
+  }
+  return true;
 }
 #ifdef USE_BINARY_SENSOR
 void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
@@ -225,22 +246,6 @@ void ListEntitiesBinarySensorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-#ifdef USE_DEVICES
-  buffer.encode_uint32(4, this->device_id);
-#endif
-}
-void BinarySensorStateResponse::calculate_size(ProtoSize &size) const {
-  size.add_fixed32(1, this->key);
-  size.add_bool(1, this->state);
-  size.add_bool(1, this->missing_state);
-#ifdef USE_DEVICES
-  size.add_uint32(1, this->device_id);
-#endif
-}
 #endif
 #ifdef USE_COVER
 void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
@@ -688,22 +693,6 @@ void ListEntitiesSensorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-#ifdef USE_DEVICES
-  buffer.encode_uint32(4, this->device_id);
-#endif
-}
-void SensorStateResponse::calculate_size(ProtoSize &size) const {
-  size.add_fixed32(1, this->key);
-  size.add_float(1, this->state);
-  size.add_bool(1, this->missing_state);
-#ifdef USE_DEVICES
-  size.add_uint32(1, this->device_id);
-#endif
-}
 #endif
 #ifdef USE_SWITCH
 void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
@@ -736,20 +725,6 @@ void ListEntitiesSwitchResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-#ifdef USE_DEVICES
-  buffer.encode_uint32(3, this->device_id);
-#endif
-}
-void SwitchStateResponse::calculate_size(ProtoSize &size) const {
-  size.add_fixed32(1, this->key);
-  size.add_bool(1, this->state);
-#ifdef USE_DEVICES
-  size.add_uint32(1, this->device_id);
-#endif
-}
 bool SwitchCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2:
@@ -830,6 +805,11 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
     case 2:
       this->dump_config = value.as_bool();
       break;
+#ifdef USE_LOGGER_BINARY
+    case 3:
+      this->binary = value.as_bool();
+      break;
+#endif
     default:
       return false;
   }
@@ -1347,22 +1327,6 @@ void ListEntitiesNumberResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-#ifdef USE_DEVICES
-  buffer.encode_uint32(4, this->device_id);
-#endif
-}
-void NumberStateResponse::calculate_size(ProtoSize &size) const {
-  size.add_fixed32(1, this->key);
-  size.add_float(1, this->state);
-  size.add_bool(1, this->missing_state);
-#ifdef USE_DEVICES
-  size.add_uint32(1, this->device_id);
-#endif
-}
 bool NumberCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
 #ifdef USE_DEVICES
@@ -3055,5 +3019,43 @@ bool ZWaveProxyRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   return true;
 }
 #endif
+#ifdef USE_BOOT_TIMELINE
+void BootTimelineEvent::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, static_cast<uint32_t>(this->type));
+  buffer.encode_uint32(2, this->time_us);
+  buffer.encode_string(3, this->source_ref_);
+}
+void BootTimelineEvent::calculate_size(ProtoSize &size) const {
+  size.add_uint32(1, static_cast<uint32_t>(this->type));
+  size.add_uint32(1, this->time_us);
+  size.add_length(1, this->source_ref_.size());
+}
+void BootTimelineResponse::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->events) {
+    buffer.encode_message(1, it, true);
+  }
+  buffer.encode_uint32(2, this->dropped);
+}
+void BootTimelineResponse::calculate_size(ProtoSize &size) const {
+  size.add_repeated_message(1, this->events);
+  size.add_uint32(1, this->dropped);
+}
+#endif
+#ifdef USE_LOGGER_BINARY
+void BinaryLogResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, static_cast<uint32_t>(this->level));
+  buffer.encode_uint64(2, this->tag);
+  buffer.encode_uint32(3, this->line);
+  buffer.encode_uint64(4, this->format);
+  buffer.encode_bytes(5, this->args_ptr_, this->args_len_);
+}
+void BinaryLogResponse::calculate_size(ProtoSize &size) const {
+  size.add_uint32(1, static_cast<uint32_t>(this->level));
+  size.add_uint64(1, this->tag);
+  size.add_uint32(1, this->line);
+  size.add_uint64(1, this->format);
+  size.add_length(1, this->args_len_);
+}
+#endif
 
 }  // namespace esphome::api
@@ -282,6 +282,16 @@ enum ZWaveProxyRequestType : uint32_t {
   ZWAVE_PROXY_REQUEST_TYPE_UNSUBSCRIBE = 1,
 };
 #endif
+#ifdef USE_BOOT_TIMELINE
+enum BootTimelineEventType : uint32_t {
+  BOOT_TIMELINE_EVENT_SETUP_START = 0,
+  BOOT_TIMELINE_EVENT_SETUP_END = 1,
+  BOOT_TIMELINE_EVENT_SETUP_COMPLETE = 2,
+  BOOT_TIMELINE_EVENT_NETWORK_CONNECTED = 3,
+  BOOT_TIMELINE_EVENT_API_CLIENT_CONNECTED = 4,
+  BOOT_TIMELINE_EVENT_FIRST_STATE = 5,
+};
+#endif
 
 }  // namespace enums
 
@@ -330,13 +340,16 @@ class CommandProtoMessage : public ProtoDecodableMessage {
 class HelloRequest final : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 1;
-  static constexpr uint8_t ESTIMATED_SIZE = 17;
+  static constexpr uint8_t ESTIMATED_SIZE = 19;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "hello_request"; }
 #endif
   std::string client_info{};
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  bool noise_coalesce_frames{false};
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -498,7 +511,7 @@ class DeviceInfo final : public ProtoMessage {
 class DeviceInfoResponse final : public ProtoMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 10;
-  static constexpr uint16_t ESTIMATED_SIZE = 257;
+  static constexpr uint16_t ESTIMATED_SIZE = 260;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "device_info_response"; }
 #endif
@@ -564,6 +577,9 @@ class DeviceInfoResponse final : public ProtoMessage {
 #endif
 #ifdef USE_ZWAVE_PROXY
   uint32_t zwave_home_id{0};
+#endif
+#ifdef USE_API_PARTIAL_STATES
+  bool partial_states_supported{false};
 #endif
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(ProtoSize &size) const override;
@@ -599,18 +615,20 @@ class ListEntitiesDoneResponse final : public ProtoMessage {
 
  protected:
 };
-class SubscribeStatesRequest final : public ProtoMessage {
+class SubscribeStatesRequest final : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 20;
-  static constexpr uint8_t ESTIMATED_SIZE = 0;
+  static constexpr uint8_t ESTIMATED_SIZE = 2;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "subscribe_states_request"; }
 #endif
+  bool partial_states{false};
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
 #ifdef USE_BINARY_SENSOR
 class ListEntitiesBinarySensorResponse final : public InfoResponseProtoMessage {
@@ -640,8 +658,22 @@ class BinarySensorStateResponse final : public StateResponseProtoMessage {
 #endif
   bool state{false};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-  void calculate_size(ProtoSize &size) const override;
+  void encode(ProtoWriteBuffer buffer) const override {
+    buffer.encode_fixed32(1, this->key);
+    buffer.encode_bool(2, this->state);
+    buffer.encode_bool(3, this->missing_state);
+#ifdef USE_DEVICES
+    buffer.encode_uint32(4, this->device_id);
+#endif
+  }
+  void calculate_size(ProtoSize &size) const override {
+    size.add_fixed32(1, this->key);
+    size.add_bool(1, this->state);
+    size.add_bool(1, this->missing_state);
+#ifdef USE_DEVICES
+    size.add_uint32(1, this->device_id);
+#endif
+  }
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -902,8 +934,22 @@ class SensorStateResponse final : public StateResponseProtoMessage {
 #endif
   float state{0.0f};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-  void calculate_size(ProtoSize &size) const override;
+  void encode(ProtoWriteBuffer buffer) const override {
+    buffer.encode_fixed32(1, this->key);
+    buffer.encode_float(2, this->state);
+    buffer.encode_bool(3, this->missing_state);
+#ifdef USE_DEVICES
+    buffer.encode_uint32(4, this->device_id);
+#endif
+  }
+  void calculate_size(ProtoSize &size) const override {
+    size.add_fixed32(1, this->key);
+    size.add_float(1, this->state);
+    size.add_bool(1, this->missing_state);
+#ifdef USE_DEVICES
+    size.add_uint32(1, this->device_id);
+#endif
+  }
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -938,8 +984,20 @@ class SwitchStateResponse final : public StateResponseProtoMessage {
   const char *message_name() const override { return "switch_state_response"; }
 #endif
   bool state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-  void calculate_size(ProtoSize &size) const override;
+  void encode(ProtoWriteBuffer buffer) const override {
+    buffer.encode_fixed32(1, this->key);
+    buffer.encode_bool(2, this->state);
+#ifdef USE_DEVICES
+    buffer.encode_uint32(3, this->device_id);
+#endif
+  }
+  void calculate_size(ProtoSize &size) const override {
+    size.add_fixed32(1, this->key);
+    size.add_bool(1, this->state);
+#ifdef USE_DEVICES
+    size.add_uint32(1, this->device_id);
+#endif
+  }
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -1003,12 +1061,15 @@ class TextSensorStateResponse final : public StateResponseProtoMessage {
 class SubscribeLogsRequest final : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 28;
-  static constexpr uint8_t ESTIMATED_SIZE = 4;
+  static constexpr uint8_t ESTIMATED_SIZE = 6;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "subscribe_logs_request"; }
 #endif
   enums::LogLevel level{};
   bool dump_config{false};
+#ifdef USE_LOGGER_BINARY
+  bool binary{false};
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -1461,8 +1522,22 @@ class NumberStateResponse final : public StateResponseProtoMessage {
 #endif
   float state{0.0f};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-  void calculate_size(ProtoSize &size) const override;
+  void encode(ProtoWriteBuffer buffer) const override {
+    buffer.encode_fixed32(1, this->key);
+    buffer.encode_float(2, this->state);
+    buffer.encode_bool(3, this->missing_state);
+#ifdef USE_DEVICES
+    buffer.encode_uint32(4, this->device_id);
+#endif
+  }
+  void calculate_size(ProtoSize &size) const override {
+    size.add_fixed32(1, this->key);
+    size.add_float(1, this->state);
+    size.add_bool(1, this->missing_state);
+#ifdef USE_DEVICES
+    size.add_uint32(1, this->device_id);
+#endif
+  }
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -2960,5 +3035,78 @@ class ZWaveProxyRequest final : public ProtoDecodableMessage {
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
 #endif
+#ifdef USE_BOOT_TIMELINE
+class BootTimelineRequest final : public ProtoMessage {
+ public:
+  static constexpr uint8_t MESSAGE_TYPE = 130;
+  static constexpr uint8_t ESTIMATED_SIZE = 0;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  const char *message_name() const override { return "boot_timeline_request"; }
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+};
+class BootTimelineEvent final : public ProtoMessage {
+ public:
+  enums::BootTimelineEventType type{};
+  uint32_t time_us{0};
+  StringRef source_ref_{};
+  void set_source(const StringRef &ref) { this->source_ref_ = ref; }
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(ProtoSize &size) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+};
+class BootTimelineResponse final : public ProtoMessage {
+ public:
+  static constexpr uint8_t MESSAGE_TYPE = 131;
+  static constexpr uint8_t ESTIMATED_SIZE = 24;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  const char *message_name() const override { return "boot_timeline_response"; }
+#endif
+  std::vector<BootTimelineEvent> events{};
+  uint32_t dropped{0};
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(ProtoSize &size) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+};
+#endif
+#ifdef USE_LOGGER_BINARY
+class BinaryLogResponse final : public ProtoMessage {
+ public:
+  static constexpr uint8_t MESSAGE_TYPE = 132;
+  static constexpr uint8_t ESTIMATED_SIZE = 23;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  const char *message_name() const override { return "binary_log_response"; }
+#endif
+  enums::LogLevel level{};
+  uint64_t tag{0};
+  uint32_t line{0};
+  uint64_t format{0};
+  const uint8_t *args_ptr_{nullptr};
+  size_t args_len_{0};
+  void set_args(const uint8_t *data, size_t len) {
+    this->args_ptr_ = data;
+    this->args_len_ = len;
+  }
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(ProtoSize &size) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+};
+#endif
 
 }  // namespace esphome::api
@@ -667,12 +667,35 @@ template<> const char *proto_enum_to_string<enums::ZWaveProxyRequestType>(enums:
   }
 }
 #endif
+#ifdef USE_BOOT_TIMELINE
+template<> const char *proto_enum_to_string<enums::BootTimelineEventType>(enums::BootTimelineEventType value) {
+  switch (value) {
+    case enums::BOOT_TIMELINE_EVENT_SETUP_START:
+      return "BOOT_TIMELINE_EVENT_SETUP_START";
+    case enums::BOOT_TIMELINE_EVENT_SETUP_END:
+      return "BOOT_TIMELINE_EVENT_SETUP_END";
+    case enums::BOOT_TIMELINE_EVENT_SETUP_COMPLETE:
+      return "BOOT_TIMELINE_EVENT_SETUP_COMPLETE";
+    case enums::BOOT_TIMELINE_EVENT_NETWORK_CONNECTED:
+      return "BOOT_TIMELINE_EVENT_NETWORK_CONNECTED";
+    case enums::BOOT_TIMELINE_EVENT_API_CLIENT_CONNECTED:
+      return "BOOT_TIMELINE_EVENT_API_CLIENT_CONNECTED";
+    case enums::BOOT_TIMELINE_EVENT_FIRST_STATE:
+      return "BOOT_TIMELINE_EVENT_FIRST_STATE";
+    default:
+      return "UNKNOWN";
+  }
+}
+#endif
 
 void HelloRequest::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "HelloRequest");
   dump_field(out, "client_info", this->client_info);
   dump_field(out, "api_version_major", this->api_version_major);
   dump_field(out, "api_version_minor", this->api_version_minor);
+#ifdef USE_API_NOISE_COALESCE_FRAMES
+  dump_field(out, "noise_coalesce_frames", this->noise_coalesce_frames);
+#endif
 }
 void HelloResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "HelloResponse");
@@ -772,10 +795,16 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
 #ifdef USE_ZWAVE_PROXY
   dump_field(out, "zwave_home_id", this->zwave_home_id);
 #endif
+#ifdef USE_API_PARTIAL_STATES
+  dump_field(out, "partial_states_supported", this->partial_states_supported);
+#endif
 }
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
-void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
+void SubscribeStatesRequest::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "SubscribeStatesRequest");
+  dump_field(out, "partial_states", this->partial_states);
+}
 #ifdef USE_BINARY_SENSOR
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "ListEntitiesBinarySensorResponse");
@@ -1068,6 +1097,9 @@ void SubscribeLogsRequest::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "SubscribeLogsRequest");
   dump_field(out, "level", static_cast<enums::LogLevel>(this->level));
   dump_field(out, "dump_config", this->dump_config);
+#ifdef USE_LOGGER_BINARY
+  dump_field(out, "binary", this->binary);
+#endif
 }
 void SubscribeLogsResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "SubscribeLogsResponse");
@@ -2137,6 +2169,36 @@ void ZWaveProxyRequest::dump_to(std::string &out) const {
   dump_field(out, "type", static_cast<enums::ZWaveProxyRequestType>(this->type));
 }
 #endif
+#ifdef USE_BOOT_TIMELINE
+void BootTimelineRequest::dump_to(std::string &out) const { out.append("BootTimelineRequest {}"); }
+void BootTimelineEvent::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "BootTimelineEvent");
+  dump_field(out, "type", static_cast<enums::BootTimelineEventType>(this->type));
+  dump_field(out, "time_us", this->time_us);
+  dump_field(out, "source", this->source_ref_);
+}
+void BootTimelineResponse::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "BootTimelineResponse");
+  for (const auto &it : this->events) {
+    out.append("  events: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  dump_field(out, "dropped", this->dropped);
+}
+#endif
+#ifdef USE_LOGGER_BINARY
+void BinaryLogResponse::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "BinaryLogResponse");
+  dump_field(out, "level", static_cast<enums::LogLevel>(this->level));
+  dump_field(out, "tag", this->tag);
+  dump_field(out, "line", this->line);
+  dump_field(out, "format", this->format);
+  out.append("  args: ");
+  out.append(format_hex_pretty(this->args_ptr_, this->args_len_));
+  out.append("\n");
+}
+#endif
 
 }  // namespace esphome::api
 
@@ -91,7 +91,7 @@ void APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
     }
     case SubscribeStatesRequest::MESSAGE_TYPE: {
       SubscribeStatesRequest msg;
-      // Empty message: no decode needed
+      msg.decode(msg_data, msg_size);
 #ifdef HAS_PROTO_MESSAGE_DUMP
       ESP_LOGVV(TAG, "on_subscribe_states_request: %s", msg.dump().c_str());
 #endif
@@ -610,6 +610,17 @@ void APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       this->on_z_wave_proxy_request(msg);
       break;
     }
+#endif
+#ifdef USE_BOOT_TIMELINE
+    case BootTimelineRequest::MESSAGE_TYPE: {
+      BootTimelineRequest msg;
+      // Empty message: no decode needed
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_boot_timeline_request: %s", msg.dump().c_str());
+#endif
+      this->on_boot_timeline_request(msg);
+      break;
+    }
 #endif
     default:
       break;
@@ -935,5 +946,12 @@ void APIServerConnection::on_z_wave_proxy_request(const ZWaveProxyRequest &msg)
   }
 }
 #endif
+#ifdef USE_BOOT_TIMELINE
+void APIServerConnection::on_boot_timeline_request(const BootTimelineRequest &msg) {
+  if (this->check_authenticated_() && !this->send_boot_timeline_response(msg)) {
+    this->on_fatal_error();
+  }
+}
+#endif
 
 }  // namespace esphome::api
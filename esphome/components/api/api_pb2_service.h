@@ -213,6 +213,9 @@ class APIServerConnectionBase : public ProtoService {
 #endif
 #ifdef USE_ZWAVE_PROXY
   virtual void on_z_wave_proxy_request(const ZWaveProxyRequest &value){};
+#endif
+#ifdef USE_BOOT_TIMELINE
+  virtual void on_boot_timeline_request(const BootTimelineRequest &value){};
 #endif
  protected:
   void read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
@@ -347,6 +350,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #endif
 #ifdef USE_ZWAVE_PROXY
   virtual void zwave_proxy_request(const ZWaveProxyRequest &msg) = 0;
+#endif
+#ifdef USE_BOOT_TIMELINE
+  virtual bool send_boot_timeline_response(const BootTimelineRequest &msg) = 0;
 #endif
  protected:
   void on_hello_request(const HelloRequest &msg) override;
@@ -477,6 +483,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ZWAVE_PROXY
   void on_z_wave_proxy_request(const ZWaveProxyRequest &msg) override;
 #endif
+#ifdef USE_BOOT_TIMELINE
+  void on_boot_timeline_request(const BootTimelineRequest &msg) override;
+#endif
 };
 
 }  // namespace esphome::api
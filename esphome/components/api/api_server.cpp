@@ -1,5 +1,6 @@
 #include "api_server.h"
 #ifdef USE_API
+#include <algorithm>
 #include <cerrno>
 #include "api_connection.h"
 #include "esphome/components/network/util.h"
@@ -94,19 +95,40 @@ void APIServer::setup() {
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback(
-        [this](int level, const char *tag, const char *message, size_t message_len) {
-          if (this->shutting_down_) {
+    logger::global_logger->add_log_listener(
+        [](void *context, uint8_t level, const char *tag, const char *message, size_t message_len) {
+          auto *self = static_cast<APIServer *>(context);
+          if (self->shutting_down_) {
             // Don't try to send logs during shutdown
             // as it could result in a recursion and
             // we would be filling a buffer we are trying to clear
             return;
           }
-          for (auto &c : this->clients_) {
+#ifdef USE_LOGGER_BINARY
+          // Binary subscribers already received this line as a packed record
+          const bool sent_binary = logger::global_logger->is_line_sent_binary();
+#endif
+          for (auto &c : self->clients_) {
+#ifdef USE_LOGGER_BINARY
+            if (sent_binary && c->wants_binary_logs())
+              continue;
+#endif
             if (!c->flags_.remove && c->get_log_subscription_level() >= level)
               c->try_send_log_message(level, tag, message, message_len);
           }
+        },
+        this);
+#ifdef USE_LOGGER_BINARY
+    logger::global_logger->add_on_binary_log_callback(
+        [this](uint8_t level, const char *tag, int line, const void *format, const uint8_t *args, size_t args_len) {
+          if (this->shutting_down_)
+            return;
+          for (auto &c : this->clients_) {
+            if (!c->flags_.remove && c->wants_binary_logs() && c->get_log_subscription_level() >= level)
+              c->try_send_binary_log_message(level, tag, line, format, args, args_len);
+          }
         });
+#endif
   }
 #endif
 
@@ -186,12 +208,20 @@ void APIServer::loop() {
     this->client_disconnected_trigger_->trigger(client->client_info_.name, client->client_info_.peername);
 #endif
     ESP_LOGV(TAG, "Remove connection %s", client->client_info_.name.c_str());
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    ESP_LOGD(TAG, "%s: %" PRIu32 " blocked writes, %" PRIu32 " dropped messages, final batch delay %u ms",
+             client->client_info_.name.c_str(), client->batch_delay_controller_.get_blocked_count(),
+             client->batch_delay_controller_.get_dropped_count(), client->batch_delay_controller_.get_delay());
+#endif
 
     // Swap with the last element and pop (avoids expensive vector shifts)
     if (client_index < this->clients_.size() - 1) {
       std::swap(this->clients_[client_index], this->clients_.back());
     }
     this->clients_.pop_back();
+#ifdef USE_LOGGER_BINARY
+    this->update_binary_log_subscribers();
+#endif
 
     // Schedule reboot when last client disconnects
     if (this->clients_.empty() && this->reboot_timeout_ != 0) {
@@ -201,6 +231,25 @@ void APIServer::loop() {
   }
 }
 
+#ifdef USE_LOGGER_BINARY
+void APIServer::update_binary_log_subscribers() {
+  if (logger::global_logger == nullptr)
+    return;
+  bool active = false;
+  bool text_needed = false;
+  for (auto &c : this->clients_) {
+    if (c->flags_.remove || c->get_log_subscription_level() == 0)
+      continue;
+    if (c->wants_binary_logs()) {
+      active = true;
+    } else {
+      text_needed = true;
+    }
+  }
+  logger::global_logger->set_binary_log_active(active, text_needed);
+}
+#endif
+
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "Server:\n"
@@ -249,11 +298,19 @@ bool APIServer::check_password(const std::string &password) const {
 
 void APIServer::handle_disconnect(APIConnection *conn) {}
 
+#ifdef USE_API_SHARED_STATE_ENCODING
+// The encoding shared by the connections is stale once the entity has a new state
+#define API_INVALIDATE_SHARED_STATE(obj) this->shared_state_cache_.invalidate(obj)
+#else
+#define API_INVALIDATE_SHARED_STATE(obj)
+#endif
+
 // Macro for entities without extra parameters
 #define API_DISPATCH_UPDATE(entity_type, entity_name) \
   void APIServer::on_##entity_name##_update(entity_type *obj) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    API_INVALIDATE_SHARED_STATE(obj); \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -263,6 +320,7 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
   void APIServer::on_##entity_name##_update(entity_type *obj, __VA_ARGS__) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    API_INVALIDATE_SHARED_STATE(obj); \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -350,6 +408,7 @@ void APIServer::on_event(event::Event *obj, const std::string &event_type) {
 void APIServer::on_update(update::UpdateEntity *obj) {
   if (obj->is_internal())
     return;
+  API_INVALIDATE_SHARED_STATE(obj);
   for (auto &c : this->clients_)
     c->send_update_state(obj);
 }
@@ -368,6 +427,13 @@ void APIServer::set_password(const std::string &password) { this->password_ = pa
 #endif
 
 void APIServer::set_batch_delay(uint16_t batch_delay) { this->batch_delay_ = batch_delay; }
+#ifdef USE_API_BATCH_PRIORITIES
+void APIServer::set_batch_priority_delays(uint16_t state, uint16_t telemetry, uint16_t bulk) {
+  this->batch_priority_delays_[1] = state;
+  this->batch_priority_delays_[2] = telemetry;
+  this->batch_priority_delays_[3] = bulk;
+}
+#endif
 
 #ifdef USE_API_HOMEASSISTANT_SERVICES
 void APIServer::send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
@@ -401,6 +467,19 @@ void APIServer::get_home_assistant_state(std::string entity_id, optional<std::st
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
 }
+
+void APIServer::on_home_assistant_state(const HomeAssistantStateResponse &msg) {
+  // Home Assistant sends the whole state again when only an attribute changed, and on every reconnect
+  for (auto &it : this->state_subs_) {
+    if (it.entity_id != msg.entity_id || it.attribute.value() != msg.attribute)
+      continue;
+    if (it.has_state && it.last_state == msg.state)
+      continue;
+    it.has_state = true;
+    it.last_state = msg.state;
+    it.callback(msg.state);
+  }
+}
 #endif
 
 uint16_t APIServer::get_port() const { return this->port_; }
@@ -462,6 +541,10 @@ void APIServer::on_shutdown() {
 
   // Change batch delay to 5ms for quick flushing during shutdown
   this->batch_delay_ = 5;
+#ifdef USE_API_BATCH_PRIORITIES
+  for (auto &delay : this->batch_priority_delays_)
+    delay = std::min<uint16_t>(delay, 5);
+#endif
 
   // Send disconnect requests to all connected clients
   for (auto &c : this->clients_) {
@@ -11,6 +11,8 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/log.h"
 #include "list_entities.h"
+#include "list_entities_cache.h"
+#include "shared_state_cache.h"
 #include "subscribe_state.h"
 #ifdef USE_API_SERVICES
 #include "user_services.h"
@@ -44,10 +46,38 @@ class APIServer : public Component, public Controller {
   void set_reboot_timeout(uint32_t reboot_timeout);
   void set_batch_delay(uint16_t batch_delay);
   uint16_t get_batch_delay() const { return batch_delay_; }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  void set_adaptive_batch_delay(uint16_t min_delay, uint16_t max_delay) {
+    this->min_batch_delay_ = min_delay;
+    this->max_batch_delay_ = max_delay;
+  }
+  uint16_t get_min_batch_delay() const { return this->min_batch_delay_; }
+  uint16_t get_max_batch_delay() const { return this->max_batch_delay_; }
+  bool is_shutting_down() const { return this->shutting_down_; }
+#endif
+#ifdef USE_API_BATCH_PRIORITIES
+  void set_batch_priority_delays(uint16_t state, uint16_t telemetry, uint16_t bulk);
+  uint16_t get_batch_priority_delay(uint8_t priority) const { return this->batch_priority_delays_[priority]; }
+#endif
+
+#ifdef USE_LOGGER_BINARY
+  /// Tell the logger whether any client wants binary log records, lines are only packed while one does
+  void update_binary_log_subscribers();
+#endif
 
   // Get reference to shared buffer for API connections
   std::vector<uint8_t> &get_shared_buffer_ref() { return shared_write_buffer_; }
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  ListEntitiesCache &get_list_entities_cache() { return this->list_entities_cache_; }
+  /// Call when the info of an entity changed at runtime, the next ListEntities request encodes it again
+  void invalidate_list_entities_cache() { this->list_entities_cache_.invalidate(); }
+#endif
+#ifdef USE_API_SHARED_STATE_ENCODING
+  SharedStateCache &get_shared_state_cache() { return this->shared_state_cache_; }
+  size_t get_client_count() const { return this->clients_.size(); }
+#endif
+
 #ifdef USE_API_NOISE
   bool save_noise_psk(psk_t psk, bool make_active = true);
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -134,6 +164,8 @@ class APIServer : public Component, public Controller {
     optional<std::string> attribute;
     std::function<void(std::string)> callback;
     bool once;
+    bool has_state{false};   // last_state is valid
+    std::string last_state;  // last state passed to the callback
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
@@ -141,6 +173,8 @@ class APIServer : public Component, public Controller {
   void get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                 std::function<void(std::string)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
+  /// Passes a state received from Home Assistant to the matching subscriptions whose state changed.
+  void on_home_assistant_state(const HomeAssistantStateResponse &msg);
 #endif
 #ifdef USE_API_SERVICES
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
@@ -175,6 +209,12 @@ class APIServer : public Component, public Controller {
   std::string password_;
 #endif
   std::vector<uint8_t> shared_write_buffer_;  // Shared proto write buffer for all connections
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  ListEntitiesCache list_entities_cache_;
+#endif
+#ifdef USE_API_SHARED_STATE_ENCODING
+  SharedStateCache shared_state_cache_;
+#endif
 #ifdef USE_API_HOMEASSISTANT_STATES
   std::vector<HomeAssistantStateSubscription> state_subs_;
 #endif
@@ -187,6 +227,14 @@ class APIServer : public Component, public Controller {
   uint16_t batch_delay_{100};
   bool shutting_down_ = false;
   // 5 bytes used, 3 bytes padding
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  uint16_t min_batch_delay_{0};
+  uint16_t max_batch_delay_{500};
+#endif
+#ifdef USE_API_BATCH_PRIORITIES
+  // Indexed by BatchPriority, control messages are never delayed
+  uint16_t batch_priority_delays_[4]{0, 10, 100, 200};
+#endif
 
 #ifdef USE_API_NOISE
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
@@ -16,6 +16,7 @@ with warnings.catch_warnings():
 
 import contextlib
 
+from esphome import platformio_api
 from esphome.const import CONF_KEY, CONF_PASSWORD, CONF_PORT, __version__
 from esphome.core import CORE
 
@@ -56,9 +57,11 @@ async def async_run_logs(config: dict[str, Any], addresses: list[str]) -> None:
         addresses=addresses,  # Pass all addresses for automatic retry
     )
     dashboard = CORE.dashboard
+    backtrace_state = False
 
     def on_log(msg: SubscribeLogsResponse) -> None:
         """Handle a new log message."""
+        nonlocal backtrace_state
         time_ = datetime.now()
         message: bytes = msg.message
         text = message.decode("utf8", "backslashreplace")
@@ -68,6 +71,11 @@ async def async_run_logs(config: dict[str, Any], addresses: list[str]) -> None:
         )
         for parsed_msg in parse_log_message(text, timestamp):
             print(parsed_msg.replace("\033", "\\033") if dashboard else parsed_msg)
+        # Decode addresses (e.g. sampling_profiler reports) against the firmware ELF
+        for line in text.splitlines():
+            backtrace_state = platformio_api.process_stacktrace(
+                config, line, backtrace_state=backtrace_state
+            )
 
     stop = await async_run(cli, on_log, name=name)
     try:
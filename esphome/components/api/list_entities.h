@@ -89,7 +89,7 @@ class ListEntitiesIterator : public ComponentIterator {
   bool on_update(update::UpdateEntity *entity) override;
 #endif
   bool on_end() override;
-  bool completed() { return this->state_ == IteratorState::NONE; }
+  bool completed() const { return this->state_ == IteratorState::NONE; }
 
  protected:
   APIConnection *client_;
@@ -0,0 +1,80 @@
+#include "list_entities_cache.h"
+#ifdef USE_API
+#ifdef USE_API_LIST_ENTITIES_CACHE
+#include "esphome/core/log.h"
+
+namespace esphome::api {
+
+static const char *const TAG = "api.list_entities_cache";
+
+bool ListEntitiesCache::begin(APIConnection *conn) {
+  if (this->complete_) {
+    this->next_ = 0;
+    return true;
+  }
+  if (this->builder_ == nullptr || this->builder_ == conn) {
+    this->entries_.clear();
+    this->data_.clear();
+    this->builder_ = conn;
+  }
+  return false;
+}
+
+void ListEntitiesCache::add(APIConnection *conn, EntityBase *entity, uint8_t message_type, const uint8_t *data,
+                            uint16_t len) {
+  if (this->builder_ != conn)
+    return;
+  // A batch that did not fit is encoded again on the next attempt
+  if (!this->entries_.empty()) {
+    const Entry &last = this->entries_.back();
+    if (last.entity == entity && last.message_type == message_type)
+      return;
+  }
+  this->entries_.push_back({entity, static_cast<uint32_t>(this->data_.size()), len, message_type});
+  this->data_.insert(this->data_.end(), data, data + len);
+}
+
+void ListEntitiesCache::finish(APIConnection *conn) {
+  if (this->builder_ != conn)
+    return;
+  this->builder_ = nullptr;
+  this->complete_ = true;
+  this->next_ = 0;
+  ESP_LOGD(TAG, "Cached %u entities (%u bytes)", static_cast<unsigned>(this->entries_.size()),
+           static_cast<unsigned>(this->data_.size()));
+}
+
+void ListEntitiesCache::abort(APIConnection *conn) {
+  if (this->builder_ == conn)
+    this->invalidate();
+}
+
+const uint8_t *ListEntitiesCache::find(EntityBase *entity, uint8_t message_type, uint16_t *len) {
+  if (!this->complete_)
+    return nullptr;
+  const size_t count = this->entries_.size();
+  for (size_t i = 0; i < count; i++) {
+    size_t index = this->next_ + i;
+    if (index >= count)
+      index -= count;
+    const Entry &entry = this->entries_[index];
+    if (entry.entity == entity && entry.message_type == message_type) {
+      this->next_ = index + 1 < count ? index + 1 : 0;
+      *len = entry.size;
+      return this->data_.data() + entry.offset;
+    }
+  }
+  return nullptr;
+}
+
+void ListEntitiesCache::invalidate() {
+  std::vector<Entry>().swap(this->entries_);
+  std::vector<uint8_t>().swap(this->data_);
+  this->builder_ = nullptr;
+  this->next_ = 0;
+  this->complete_ = false;
+}
+
+}  // namespace esphome::api
+#endif  // USE_API_LIST_ENTITIES_CACHE
+#endif  // USE_API
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#ifdef USE_API_LIST_ENTITIES_CACHE
+#include <cstdint>
+#include <vector>
+
+#include "esphome/core/entity_base.h"
+
+namespace esphome::api {
+
+class APIConnection;
+
+/** Encoded ListEntities*Response payloads shared by all connections.
+ *
+ * The entity list is identical for every client, but building it means filling and encoding one info message
+ * per entity each time a client (re)connects. The first connection that lists entities while the cache is
+ * empty becomes the builder: every info payload it encodes is appended here. Once it has sent
+ * ListEntitiesDoneResponse the cache is complete and later requests copy the payloads straight into their
+ * batch instead of encoding them again. Frame headers are not cached as they depend on the protocol of each
+ * connection.
+ *
+ * Entities that change their info at runtime must call invalidate(), the next full list rebuilds the cache.
+ */
+class ListEntitiesCache {
+ public:
+  /// conn starts listing entities. Returns true if the cache is complete and can be replayed.
+  bool begin(APIConnection *conn);
+  /// Record an encoded info payload, ignored unless conn is building the cache.
+  void add(APIConnection *conn, EntityBase *entity, uint8_t message_type, const uint8_t *data, uint16_t len);
+  /// conn has sent ListEntitiesDoneResponse.
+  void finish(APIConnection *conn);
+  /// conn is going away, drop a partially built cache.
+  void abort(APIConnection *conn);
+  /// Cached payload of entity in *len bytes, or nullptr if it is not cached.
+  const uint8_t *find(EntityBase *entity, uint8_t message_type, uint16_t *len);
+  /// Forget all cached payloads.
+  void invalidate();
+
+  bool is_building(const APIConnection *conn) const { return this->builder_ == conn; }
+
+ protected:
+  struct Entry {
+    EntityBase *entity;
+    uint32_t offset;
+    uint16_t size;
+    uint8_t message_type;
+  };
+
+  std::vector<Entry> entries_;
+  // Payloads of all entries back to back
+  std::vector<uint8_t> data_;
+  APIConnection *builder_{nullptr};
+  // Entries are replayed in the order they were added, find() starts looking here
+  size_t next_{0};
+  bool complete_{false};
+};
+
+}  // namespace esphome::api
+#endif  // USE_API_LIST_ENTITIES_CACHE
+#endif  // USE_API
@@ -0,0 +1,231 @@
+#include "partial_state.h"
+#ifdef USE_API
+#ifdef USE_API_PARTIAL_STATES
+#include <algorithm>
+#include <cstring>
+
+namespace esphome::api {
+
+namespace {
+
+// One field of an encoded message, tag included
+struct WireField {
+  uint32_t field_id;
+  uint8_t wire_type;
+  uint8_t tag_len;
+  const uint8_t *start;
+  uint32_t len;
+};
+
+// Parse the field at pos and advance past it, returns false at the end of the message
+bool next_field(const uint8_t *&pos, const uint8_t *end, WireField &field) {
+  if (pos >= end)
+    return false;
+  uint32_t consumed = 0;
+  auto tag = ProtoVarInt::parse(pos, end - pos, &consumed);
+  if (!tag.has_value())
+    return false;
+  const uint8_t *value = pos + consumed;
+  const uint32_t available = end - value;
+  uint32_t value_len = 0;
+  switch (tag->as_uint32() & 0x7) {
+    case 0:  // varint
+      if (!ProtoVarInt::parse(value, available, &value_len).has_value())
+        return false;
+      break;
+    case 1:  // 64-bit
+      value_len = 8;
+      break;
+    case 2: {  // length-delimited
+      uint32_t prefix_len = 0;
+      auto len = ProtoVarInt::parse(value, available, &prefix_len);
+      if (!len.has_value())
+        return false;
+      value_len = prefix_len + len->as_uint32();
+      break;
+    }
+    case 5:  // 32-bit
+      value_len = 4;
+      break;
+    default:
+      return false;
+  }
+  if (value_len > available)
+    return false;
+  field.field_id = tag->as_uint32() >> 3;
+  field.wire_type = tag->as_uint32() & 0x7;
+  field.tag_len = consumed;
+  field.start = pos;
+  field.len = consumed + value_len;
+  pos = value + value_len;
+  return true;
+}
+
+bool find_field(const std::vector<uint8_t> &encoded, uint32_t field_id, WireField &field) {
+  const uint8_t *pos = encoded.data();
+  const uint8_t *end = pos + encoded.size();
+  while (next_field(pos, end, field)) {
+    if (field.field_id == field_id)
+      return true;
+  }
+  return false;
+}
+
+// Encoded size of the default value for a wire type: 0 for varints, zero length, or all-zero fixed values
+uint32_t default_value_size(uint8_t wire_type) {
+  switch (wire_type) {
+    case 1:
+      return 8;
+    case 5:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+const uint8_t ZEROS[8] = {};
+
+}  // namespace
+
+template<typename F> void PartialStateTracker::diff_(const Entry &entry, F &&emit) const {
+  WireField field{};
+  WireField old{};
+  // Changed or new fields, the key and device_id are always sent so the client can find the entity
+  const uint8_t *pos = entry.next.data();
+  const uint8_t *end = pos + entry.next.size();
+  while (next_field(pos, end, field)) {
+    bool identity = field.field_id == 1;
+#ifdef USE_DEVICES
+    identity = identity || field.field_id == entry.device_id_field;
+#endif
+    if (!identity && find_field(entry.sent, field.field_id, old) && old.len == field.len &&
+        memcmp(old.start, field.start, field.len) == 0)
+      continue;
+    emit(field.start, field.len);
+  }
+  // Fields that are no longer encoded went back to their default value
+  pos = entry.sent.data();
+  end = pos + entry.sent.size();
+  while (next_field(pos, end, old)) {
+    if (find_field(entry.next, old.field_id, field))
+      continue;
+    emit(old.start, old.tag_len);
+    emit(ZEROS, default_value_size(old.wire_type));
+  }
+}
+
+uint32_t PartialStateTracker::prepare(StateResponseProtoMessage &msg, uint8_t message_type) {
+  // entries_ is sorted by message type, key and device, so finding the entity is a binary search
+  auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), msg,
+                             [message_type](const Entry &entry, const StateResponseProtoMessage &value) {
+                               if (entry.message_type != message_type)
+                                 return entry.message_type < message_type;
+#ifdef USE_DEVICES
+                               if (entry.key != value.key)
+                                 return entry.key < value.key;
+                               return entry.device_id < value.device_id;
+#else
+                               return entry.key < value.key;
+#endif
+                             });
+  if (it == this->entries_.end() || it->message_type != message_type || it->key != msg.key
+#ifdef USE_DEVICES
+      || it->device_id != msg.device_id
+#endif
+  ) {
+    Entry entry{};
+    entry.key = msg.key;
+#ifdef USE_DEVICES
+    entry.device_id = msg.device_id;
+#endif
+    entry.message_type = message_type;
+    it = this->entries_.insert(it, std::move(entry));
+  }
+  const size_t index = it - this->entries_.begin();
+  Entry &entry = *it;
+
+  ProtoSize size;
+  msg.calculate_size(size);
+  entry.next.clear();
+  entry.next.reserve(size.get_size());
+  msg.encode({&entry.next});
+
+#ifdef USE_DEVICES
+  if (entry.device_id_field == 0 && msg.device_id != 0) {
+    // The field number of device_id differs per message type: encode once without it, the missing
+    // field is the device_id
+    std::vector<uint8_t> probe;
+    const uint32_t device_id = msg.device_id;
+    msg.device_id = 0;
+    msg.encode({&probe});
+    msg.device_id = device_id;
+    const uint8_t *pos = entry.next.data();
+    const uint8_t *end = pos + entry.next.size();
+    WireField field{};
+    WireField found{};
+    while (entry.device_id_field == 0 && next_field(pos, end, field)) {
+      if (!find_field(probe, field.field_id, found))
+        entry.device_id_field = field.field_id;
+    }
+  }
+#endif
+
+  if (!entry.pending) {
+    entry.pending = true;
+    this->pending_count_++;
+  }
+  this->prepared_ = index;
+
+  uint32_t diff_size = 0;
+  this->diff_(entry, [&diff_size](const uint8_t *data, uint32_t len) { diff_size += len; });
+  return diff_size;
+}
+
+void PartialStateTracker::encode(ProtoWriteBuffer buffer) const {
+  std::vector<uint8_t> *out = buffer.get_buffer();
+  this->diff_(this->entries_[this->prepared_],
+              [out](const uint8_t *data, uint32_t len) { out->insert(out->end(), data, data + len); });
+}
+
+void PartialStateTracker::cancel() {
+  if (this->prepared_ == SIZE_MAX)
+    return;
+  Entry &entry = this->entries_[this->prepared_];
+  if (entry.pending) {
+    entry.pending = false;
+    this->pending_count_--;
+  }
+  this->prepared_ = SIZE_MAX;
+}
+
+void PartialStateTracker::commit() {
+  if (this->pending_count_ != 0) {
+    for (auto &entry : this->entries_) {
+      if (entry.pending) {
+        entry.sent.swap(entry.next);
+        entry.pending = false;
+      }
+    }
+    this->pending_count_ = 0;
+  }
+  this->prepared_ = SIZE_MAX;
+}
+
+void PartialStateTracker::discard() {
+  if (this->pending_count_ != 0) {
+    for (auto &entry : this->entries_)
+      entry.pending = false;
+    this->pending_count_ = 0;
+  }
+  this->prepared_ = SIZE_MAX;
+}
+
+void PartialStateTracker::clear() {
+  std::vector<Entry>().swap(this->entries_);
+  this->prepared_ = SIZE_MAX;
+  this->pending_count_ = 0;
+}
+
+}  // namespace esphome::api
+#endif  // USE_API_PARTIAL_STATES
+#endif  // USE_API
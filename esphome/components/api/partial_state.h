@@ -0,0 +1,83 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#ifdef USE_API_PARTIAL_STATES
+#include <cstdint>
+#include <vector>
+
+#include "api_pb2.h"
+#include "proto.h"
+
+namespace esphome::api {
+
+/** Per-connection shadow of the entity state messages last sent to a client.
+ *
+ * When a client subscribes with partial_states, each state message is encoded in full as before and then
+ * compared field by field with the encoding that was last sent for the same entity. Only the key, the
+ * device_id and the fields that changed are put on the wire; fields that went back to their default value
+ * (and are therefore omitted by the regular encoder) are sent explicitly as zero. The client merges every
+ * message into the previous state of that entity.
+ *
+ * A new encoding only becomes the baseline once the message has actually been handed to the socket:
+ * prepare() stores it as pending, commit() or discard() is called after the send attempt. Until then
+ * re-encoding the same entity (e.g. when a batch is retried) still diffs against what the client has.
+ */
+class PartialStateTracker {
+ public:
+  /// Encode msg into the pending slot of its entity and return the size of the diff against the baseline.
+  uint32_t prepare(StateResponseProtoMessage &msg, uint8_t message_type);
+  /// Write the diff computed by the last prepare().
+  void encode(ProtoWriteBuffer buffer) const;
+  /// The last prepared message did not make it into the send buffer.
+  void cancel();
+  /// All prepared messages have been sent, they become the new baseline.
+  void commit();
+  /// None of the prepared messages have been sent.
+  void discard();
+  /// Forget everything that was sent, the next state of each entity is sent in full.
+  void clear();
+
+ protected:
+  struct Entry {
+    uint32_t key;
+#ifdef USE_DEVICES
+    uint32_t device_id;
+    // Field number of device_id in this message type, 0 if not known yet
+    uint8_t device_id_field;
+#endif
+    uint8_t message_type;
+    bool pending;
+    // Full encoding the client currently has, and the one waiting for commit()
+    std::vector<uint8_t> sent;
+    std::vector<uint8_t> next;
+  };
+
+  template<typename F> void diff_(const Entry &entry, F &&emit) const;
+
+  // Sorted by message type, key and device_id
+  std::vector<Entry> entries_;
+  // Index into entries_ of the last prepare(), SIZE_MAX if none
+  size_t prepared_{SIZE_MAX};
+  uint16_t pending_count_{0};
+};
+
+/// Adapter that lets the regular message encoding path write a prepared diff.
+class PartialStateMessage final : public ProtoMessage {
+ public:
+  PartialStateMessage(const PartialStateTracker &tracker, uint32_t size) : tracker_(tracker), size_(size) {}
+  void encode(ProtoWriteBuffer buffer) const override { this->tracker_.encode(buffer); }
+  void calculate_size(ProtoSize &size) const override { size.add_precalculated_size(this->size_); }
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override { out.append("PartialStateMessage {}"); }
+  const char *message_name() const override { return "partial_state_message"; }
+#endif
+
+ protected:
+  const PartialStateTracker &tracker_;
+  uint32_t size_;
+};
+
+}  // namespace esphome::api
+#endif  // USE_API_PARTIAL_STATES
+#endif  // USE_API
@@ -263,6 +263,11 @@ class ProtoWriteBuffer {
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
   }
+  /// Encode only the key and length of a bytes field, the len bytes of data are sent separately (streamed)
+  void encode_bytes_header(uint32_t field_id, size_t len) {
+    this->encode_field_raw(field_id, 2);  // type 2: Length-delimited
+    this->encode_varint_raw(len);
+  }
   void encode_uint32(uint32_t field_id, uint32_t value, bool force = false) {
     if (value == 0 && !force)
       return;
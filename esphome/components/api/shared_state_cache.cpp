@@ -0,0 +1,44 @@
+#include "shared_state_cache.h"
+#ifdef USE_API
+#ifdef USE_API_SHARED_STATE_ENCODING
+
+namespace esphome::api {
+
+const uint8_t *SharedStateCache::find(const EntityBase *entity, uint8_t message_type, uint16_t *len) const {
+  for (const auto &entry : this->entries_) {
+    if (entry.entity == entity && entry.message_type == message_type) {
+      if (!entry.valid)
+        return nullptr;
+      *len = static_cast<uint16_t>(entry.data.size());
+      return entry.data.data();
+    }
+  }
+  return nullptr;
+}
+
+void SharedStateCache::store(const EntityBase *entity, uint8_t message_type, const uint8_t *data, uint16_t len) {
+  Entry *slot = nullptr;
+  for (auto &entry : this->entries_) {
+    if (entry.entity == entity && entry.message_type == message_type) {
+      slot = &entry;
+      break;
+    }
+  }
+  if (slot == nullptr) {
+    this->entries_.push_back({entity, message_type, false, {}});
+    slot = &this->entries_.back();
+  }
+  slot->data.assign(data, data + len);
+  slot->valid = true;
+}
+
+void SharedStateCache::invalidate(const EntityBase *entity) {
+  for (auto &entry : this->entries_) {
+    if (entry.entity == entity)
+      entry.valid = false;
+  }
+}
+
+}  // namespace esphome::api
+#endif  // USE_API_SHARED_STATE_ENCODING
+#endif  // USE_API
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#ifdef USE_API_SHARED_STATE_ENCODING
+#include <cstdint>
+#include <vector>
+
+#include "esphome/core/entity_base.h"
+
+namespace esphome::api {
+
+/** Encoded state messages shared by all connections.
+ *
+ * A state message only depends on its entity, so when several clients are subscribed the first connection
+ * that encodes the current state of an entity stores the payload here and the others copy it into their
+ * batch. Frame headers, footers and noise encryption are still applied per connection. The server calls
+ * invalidate() whenever the entity publishes a new state, before the update is handed to the connections.
+ */
+class SharedStateCache {
+ public:
+  /// Payload of the current state of entity in *len bytes, or nullptr if no connection has encoded it yet.
+  const uint8_t *find(const EntityBase *entity, uint8_t message_type, uint16_t *len) const;
+  /// Store the payload that was encoded for the current state of entity.
+  void store(const EntityBase *entity, uint8_t message_type, const uint8_t *data, uint16_t len);
+  /// entity has a new state.
+  void invalidate(const EntityBase *entity);
+
+ protected:
+  struct Entry {
+    const EntityBase *entity;
+    uint8_t message_type;
+    bool valid;
+    // Kept when invalidated, the next state of the same entity usually has the same size
+    std::vector<uint8_t> data;
+  };
+
+  std::vector<Entry> entries_;
+};
+
+}  // namespace esphome::api
+#endif  // USE_API_SHARED_STATE_ENCODING
+#endif  // USE_API
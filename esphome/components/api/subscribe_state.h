@@ -82,7 +82,7 @@ class InitialStateIterator : public ComponentIterator {
 #ifdef USE_UPDATE
   bool on_update(update::UpdateEntity *entity) override;
 #endif
-  bool completed() { return this->state_ == IteratorState::NONE; }
+  bool completed() const { return this->state_ == IteratorState::NONE; }
 
  protected:
   APIConnection *client_;
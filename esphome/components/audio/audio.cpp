@@ -1,5 +1,7 @@
 #include "audio.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace audio {
 
@@ -57,11 +59,46 @@ const char *audio_file_type_to_string(AudioFileType file_type) {
 void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, int16_t scale_factor,
                          size_t samples_to_scale) {
   // Note the assembly dsps_mulc function has audio glitches if the input and output buffers are the same.
-  for (int i = 0; i < samples_to_scale; i++) {
+  // Unrolled so the loads and multiplications of neighbouring samples can overlap in the pipeline.
+  size_t i = 0;
+  for (; i + 4 <= samples_to_scale; i += 4) {
+    const int32_t acc0 = (int32_t) audio_samples[i] * (int32_t) scale_factor;
+    const int32_t acc1 = (int32_t) audio_samples[i + 1] * (int32_t) scale_factor;
+    const int32_t acc2 = (int32_t) audio_samples[i + 2] * (int32_t) scale_factor;
+    const int32_t acc3 = (int32_t) audio_samples[i + 3] * (int32_t) scale_factor;
+    output_buffer[i] = (int16_t) (acc0 >> 15);
+    output_buffer[i + 1] = (int16_t) (acc1 >> 15);
+    output_buffer[i + 2] = (int16_t) (acc2 >> 15);
+    output_buffer[i + 3] = (int16_t) (acc3 >> 15);
+  }
+  for (; i < samples_to_scale; i++) {
     int32_t acc = (int32_t) audio_samples[i] * (int32_t) scale_factor;
     output_buffer[i] = (int16_t) (acc >> 15);
   }
 }
 
+static inline int16_t saturating_add(int16_t first, int16_t second) {
+  const int32_t sum = (int32_t) first + (int32_t) second;
+  return (int16_t) std::max<int32_t>(INT16_MIN, std::min<int32_t>(sum, INT16_MAX));
+}
+
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples_to_add) {
+  size_t i = 0;
+  for (; i + 4 <= samples_to_add; i += 4) {
+    const int16_t sum0 = saturating_add(first_samples[i], second_samples[i]);
+    const int16_t sum1 = saturating_add(first_samples[i + 1], second_samples[i + 1]);
+    const int16_t sum2 = saturating_add(first_samples[i + 2], second_samples[i + 2]);
+    const int16_t sum3 = saturating_add(first_samples[i + 3], second_samples[i + 3]);
+    output_buffer[i] = sum0;
+    output_buffer[i + 1] = sum1;
+    output_buffer[i + 2] = sum2;
+    output_buffer[i + 3] = sum3;
+  }
+  for (; i < samples_to_add; i++) {
+    output_buffer[i] = saturating_add(first_samples[i], second_samples[i]);
+  }
+}
+
 }  // namespace audio
 }  // namespace esphome
@@ -4,6 +4,8 @@
 
 #include "esphome/core/hal.h"
 
+#include <esp_heap_caps.h>
+
 namespace esphome {
 namespace audio {
 
@@ -12,6 +14,8 @@ static const uint32_t READ_WRITE_TIMEOUT_MS = 20;  // Timeout for transferring a
 
 static const uint32_t MAX_POTENTIALLY_FAILED_COUNT = 10;
 
+static const uint8_t PSRAM_DECODE_BATCH_FRAMES = 4;  // Frames the output buffer holds if PSRAM is available
+
 AudioDecoder::AudioDecoder(size_t input_buffer_size, size_t output_buffer_size) {
   this->input_transfer_buffer_ = AudioSourceTransferBuffer::create(input_buffer_size);
   this->output_transfer_buffer_ = AudioSinkTransferBuffer::create(output_buffer_size);
@@ -61,6 +65,9 @@ esp_err_t AudioDecoder::start(AudioFileType audio_file_type) {
   this->potentially_failed_count_ = 0;
   this->end_of_file_ = false;
 
+  this->decode_cycles_ = 0;
+  this->decoded_frames_ = 0;
+
   switch (this->audio_file_type_) {
 #ifdef USE_AUDIO_FLAC_SUPPORT
     case AudioFileType::FLAC:
@@ -76,8 +83,8 @@ esp_err_t AudioDecoder::start(AudioFileType audio_file_type) {
       // MP3 always has 1152 samples per chunk
       this->free_buffer_required_ = 1152 * sizeof(int16_t) * 2;  // samples * size per sample * channels
 
-      // Always reallocate the output transfer buffer to the smallest necessary size
-      this->output_transfer_buffer_->reallocate(this->free_buffer_required_);
+      // Always reallocate the output transfer buffer to the smallest necessary size for the batch
+      this->output_transfer_buffer_->reallocate(this->free_buffer_required_ * decode_batch_frames_());
       break;
 #endif
     case AudioFileType::WAV:
@@ -185,6 +192,9 @@ AudioDecoderState AudioDecoder::decode(bool stop_gracefully) {
       // No data to decode, attempt to get more data next time
       state = FileDecoderState::IDLE;
     } else {
+      const size_t output_before_decoding = this->output_transfer_buffer_->available();
+      const uint32_t cycles_before_decoding = arch_get_cpu_cycle_count();
+
       switch (this->audio_file_type_) {
 #ifdef USE_AUDIO_FLAC_SUPPORT
         case AudioFileType::FLAC:
@@ -204,6 +214,12 @@ AudioDecoderState AudioDecoder::decode(bool stop_gracefully) {
           state = FileDecoderState::IDLE;
           break;
       }
+
+      if (this->output_transfer_buffer_->available() > output_before_decoding) {
+        // Only count calls that produced audio, so header parsing and resyncing don't skew the average
+        this->decode_cycles_ += arch_get_cpu_cycle_count() - cycles_before_decoding;
+        ++this->decoded_frames_;
+      }
     }
 
     first_loop_iteration = false;
@@ -241,9 +257,9 @@ FileDecoderState AudioDecoder::decode_flac_() {
     size_t bytes_consumed = this->flac_decoder_->get_bytes_index();
     this->input_transfer_buffer_->decrease_buffer_length(bytes_consumed);
 
-    // Reallocate the output transfer buffer to the smallest necessary size
+    // Reallocate the output transfer buffer to the smallest necessary size for the batch
     this->free_buffer_required_ = flac_decoder_->get_output_buffer_size_bytes();
-    if (!this->output_transfer_buffer_->reallocate(this->free_buffer_required_)) {
+    if (!this->output_transfer_buffer_->reallocate(this->free_buffer_required_ * decode_batch_frames_())) {
       // Couldn't reallocate output buffer
       return FileDecoderState::FAILED;
     }
@@ -339,6 +355,13 @@ FileDecoderState AudioDecoder::decode_mp3_() {
 }
 #endif
 
+uint8_t AudioDecoder::decode_batch_frames_() {
+  if (heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0) {
+    return PSRAM_DECODE_BATCH_FRAMES;
+  }
+  return 1;
+}
+
 FileDecoderState AudioDecoder::decode_wav_() {
   if (!this->audio_stream_info_.has_value()) {
     // Header hasn't been processed
@@ -99,7 +99,21 @@ class AudioDecoder {
   /// @param pause_state If true, audio data is not sent to the sink.
   void set_pause_output_state(bool pause_state) { this->pause_output_ = pause_state; }
 
+  /// @brief Returns the average CPU cycles the file decoder spent on each frame that produced audio. Measured on the
+  /// device, so buffer sizes and task placement can be chosen per format.
+  /// @return Average cycles per decoded frame, or 0 if no frame has been decoded yet
+  uint32_t get_decode_cycles_per_frame() const {
+    return this->decoded_frames_ > 0 ? this->decode_cycles_ / this->decoded_frames_ : 0;
+  }
+
+  /// @brief Returns the number of frames decoded so far. For WAV files, every copied chunk counts as a frame.
+  uint32_t get_decoded_frames() const { return this->decoded_frames_; }
+
  protected:
+  /// @brief Number of MP3 or FLAC frames the output buffer holds. One without PSRAM to keep the internal memory use
+  /// small, more with PSRAM so the decoder can work ahead while the sink is busy.
+  static uint8_t decode_batch_frames_();
+
   std::unique_ptr<esp_audio_libs::wav_decoder::WAVDecoder> wav_decoder_;
 #ifdef USE_AUDIO_FLAC_SUPPORT
   FileDecoderState decode_flac_();
@@ -128,6 +142,9 @@ class AudioDecoder {
 
   uint32_t accumulated_frames_written_{0};
   uint32_t playback_ms_{0};
+
+  uint64_t decode_cycles_{0};
+  uint32_t decoded_frames_{0};
 };
 }  // namespace audio
 }  // namespace esphome
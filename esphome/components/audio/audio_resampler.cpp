@@ -57,6 +57,21 @@ esp_err_t AudioResampler::start(AudioStreamInfo &input_stream_info, AudioStreamI
     return ESP_ERR_NOT_SUPPORTED;
   }
 
+  if ((this->filter_banks_ != nullptr) && (input_stream_info.get_bits_per_sample() == 16) &&
+      (output_stream_info.get_bits_per_sample() == 16)) {
+    for (const auto &filter_bank : *this->filter_banks_) {
+      if ((filter_bank.source_sample_rate == input_stream_info.get_sample_rate()) &&
+          (filter_bank.target_sample_rate == output_stream_info.get_sample_rate())) {
+        this->polyphase_resampler_ = make_unique<PolyphaseResampler>();
+        if (!this->polyphase_resampler_->initialize(&filter_bank, input_stream_info.get_channels(),
+                                                    input_stream_info.bytes_to_frames(this->input_buffer_size_))) {
+          return ESP_ERR_NO_MEM;
+        }
+        return ESP_OK;
+      }
+    }
+  }
+
   if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) ||
       (input_stream_info.get_bits_per_sample() != output_stream_info.get_bits_per_sample())) {
     this->resampler_ = make_unique<esp_audio_libs::resampler::Resampler>(
@@ -116,22 +131,34 @@ AudioResamplerState AudioResampler::resample(bool stop_gracefully, int32_t *ms_d
   const size_t bytes_available = this->input_transfer_buffer_->available();
   const uint32_t frames_available = this->input_stream_info_.bytes_to_frames(bytes_available);
 
-  if ((this->input_stream_info_.get_sample_rate() != this->output_stream_info_.get_sample_rate()) ||
+  if ((this->polyphase_resampler_ != nullptr) ||
+      (this->input_stream_info_.get_sample_rate() != this->output_stream_info_.get_sample_rate()) ||
       (this->input_stream_info_.get_bits_per_sample() != this->output_stream_info_.get_bits_per_sample())) {
-    // Adjust gain by -3 dB to avoid clipping due to the resampling process
-    esp_audio_libs::resampler::ResamplerResults results =
-        this->resampler_->resample(this->input_transfer_buffer_->get_buffer_start(),
-                                   this->output_transfer_buffer_->get_buffer_end(), frames_available, frames_free, -3);
+    uint32_t frames_used = 0;
+    uint32_t frames_generated = 0;
+    if (this->polyphase_resampler_ != nullptr) {
+      // The filter bank already includes the -3 dB gain adjustment
+      this->polyphase_resampler_->resample(
+          reinterpret_cast<const int16_t *>(this->input_transfer_buffer_->get_buffer_start()),
+          reinterpret_cast<int16_t *>(this->output_transfer_buffer_->get_buffer_end()), frames_available, frames_free,
+          &frames_used, &frames_generated);
+    } else {
+      // Adjust gain by -3 dB to avoid clipping due to the resampling process
+      esp_audio_libs::resampler::ResamplerResults results = this->resampler_->resample(
+          this->input_transfer_buffer_->get_buffer_start(), this->output_transfer_buffer_->get_buffer_end(),
+          frames_available, frames_free, -3);
+      frames_used = results.frames_used;
+      frames_generated = results.frames_generated;
+    }
 
-    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(results.frames_used));
-    this->output_transfer_buffer_->increase_buffer_length(
-        this->output_stream_info_.frames_to_bytes(results.frames_generated));
+    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(frames_used));
+    this->output_transfer_buffer_->increase_buffer_length(this->output_stream_info_.frames_to_bytes(frames_generated));
 
     // Resampling causes slight differences in the durations used versus generated. Computes the difference in
     // millisconds. The callback function passing the played audio duration uses the difference to convert from output
     // duration to input duration.
-    this->accumulated_frames_used_ += results.frames_used;
-    this->accumulated_frames_generated_ += results.frames_generated;
+    this->accumulated_frames_used_ += frames_used;
+    this->accumulated_frames_generated_ += frames_generated;
 
     const int32_t used_ms =
         this->input_stream_info_.frames_to_milliseconds_with_remainder(&this->accumulated_frames_used_);
@@ -4,6 +4,7 @@
 
 #include "audio.h"
 #include "audio_transfer_buffer.h"
+#include "polyphase_resampler.h"
 
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
@@ -17,6 +18,8 @@
 
 #include <resampler.h>  // esp-audio-libs
 
+#include <vector>
+
 namespace esphome {
 namespace audio {
 
@@ -31,6 +34,8 @@ class AudioResampler {
    * @brief Class that facilitates resampling audio.
    * The audio data is read from a ring buffer source, resampled, and sent to an audio sink (ring buffer or speaker
    * component). Also supports converting bits per sample.
+   * 16 bit streams use a fixed-point polyphase filter if a filter bank for their sample rates was generated at build
+   * time, everything else uses the floating point resampler.
    */
  public:
   /// @brief Allocates the input and output transfer buffers
@@ -55,6 +60,10 @@ class AudioResampler {
   esp_err_t add_sink(speaker::Speaker *speaker);
 #endif
 
+  /// @brief Sets the fixed-point filter banks to pick from when starting.
+  /// @param filter_banks Pointer to the filter banks, must outlive the resampler
+  void set_filter_banks(const std::vector<PolyphaseFilterBank> *filter_banks) { this->filter_banks_ = filter_banks; }
+
   /// @brief Sets up the class to resample.
   /// @param input_stream_info The incoming sample rate, bits per sample, and number of channels
   /// @param output_stream_info The desired outgoing sample rate, bits per sample, and number of channels
@@ -94,6 +103,9 @@ class AudioResampler {
   AudioStreamInfo output_stream_info_;
 
   std::unique_ptr<esp_audio_libs::resampler::Resampler> resampler_;
+
+  const std::vector<PolyphaseFilterBank> *filter_banks_{nullptr};
+  std::unique_ptr<PolyphaseResampler> polyphase_resampler_;
 };
 
 }  // namespace audio
@@ -123,7 +123,12 @@ size_t AudioSourceTransferBuffer::transfer_data_from_source(TickType_t ticks_to_
   size_t bytes_to_read = this->free();
   size_t bytes_read = 0;
   if (bytes_to_read > 0) {
-    if (this->ring_buffer_.use_count() > 0) {
+#ifdef USE_MICROPHONE
+    if (this->microphone_source_ != nullptr) {
+      bytes_read = this->microphone_source_->read(this->get_buffer_end(), bytes_to_read, ticks_to_wait);
+    } else
+#endif
+        if (this->ring_buffer_.use_count() > 0) {
       bytes_read = this->ring_buffer_->read((void *) this->get_buffer_end(), bytes_to_read, ticks_to_wait);
     }
 
@@ -157,6 +162,24 @@ size_t AudioSinkTransferBuffer::transfer_data_to_sink(TickType_t ticks_to_wait,
   return bytes_written;
 }
 
+#ifdef USE_MICROPHONE
+void AudioSourceTransferBuffer::clear_buffered_data() {
+  if (this->microphone_source_ != nullptr) {
+    this->buffer_length_ = 0;
+    this->microphone_source_->reset_reading();
+    return;
+  }
+  AudioTransferBuffer::clear_buffered_data();
+}
+
+bool AudioSourceTransferBuffer::has_buffered_data() const {
+  if (this->microphone_source_ != nullptr) {
+    return ((this->microphone_source_->available() > 0) || (this->available() > 0));
+  }
+  return AudioTransferBuffer::has_buffered_data();
+}
+#endif
+
 bool AudioSinkTransferBuffer::has_buffered_data() const {
 #ifdef USE_SPEAKER
   if (this->speaker_ != nullptr) {
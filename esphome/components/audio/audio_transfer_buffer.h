@@ -4,6 +4,10 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/ring_buffer.h"
 
+#ifdef USE_MICROPHONE
+#include "esphome/components/microphone/microphone_source.h"
+#endif
+
 #ifdef USE_SPEAKER
 #include "esphome/components/speaker/speaker.h"
 #endif
@@ -136,6 +140,19 @@ class AudioSourceTransferBuffer : public AudioTransferBuffer {
   /// @brief Adds a ring buffer as the transfer buffer's source.
   /// @param ring_buffer weak_ptr to the allocated ring buffer
   void set_source(const std::weak_ptr<RingBuffer> &ring_buffer) { this->ring_buffer_ = ring_buffer.lock(); };
+
+#ifdef USE_MICROPHONE
+  /// @brief Adds a microphone source as the transfer buffer's source.
+  /// @param microphone_source Pointer to a microphone source that already started reading
+  void set_source(microphone::MicrophoneSource *microphone_source) { this->microphone_source_ = microphone_source; }
+
+  void clear_buffered_data() override;
+
+  bool has_buffered_data() const override;
+
+ protected:
+  microphone::MicrophoneSource *microphone_source_{nullptr};
+#endif
 };
 
 }  // namespace audio
@@ -0,0 +1,90 @@
+#include "polyphase_resampler.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace audio {
+
+PolyphaseResampler::~PolyphaseResampler() {
+  if (this->samples_ != nullptr) {
+    RAMAllocator<int16_t> allocator;
+    allocator.deallocate(this->samples_, this->samples_size_);
+  }
+}
+
+bool PolyphaseResampler::initialize(const PolyphaseFilterBank *filter_bank, uint8_t channels,
+                                    uint32_t max_input_frames) {
+  this->filter_bank_ = filter_bank;
+  this->channels_ = channels;
+
+  const uint32_t history_frames = filter_bank->taps - 1;
+  this->samples_size_ = (history_frames + max_input_frames) * channels;
+
+  RAMAllocator<int16_t> allocator;
+  this->samples_ = allocator.allocate(this->samples_size_);
+  if (this->samples_ == nullptr) {
+    return false;
+  }
+
+  // Start from silence, so the first output frame lines up with the first input frame
+  std::memset(this->samples_, 0, history_frames * channels * sizeof(int16_t));
+  this->position_ = history_frames;
+  this->phase_ = 0;
+
+  return true;
+}
+
+void PolyphaseResampler::resample(const int16_t *input_buffer, int16_t *output_buffer, uint32_t input_frames,
+                                  uint32_t output_frames, uint32_t *frames_used, uint32_t *frames_generated) {
+  const uint16_t taps = this->filter_bank_->taps;
+  const uint16_t phases = this->filter_bank_->phases;
+  const uint16_t decimation = this->filter_bank_->decimation;
+  const uint8_t channels = this->channels_;
+  const uint32_t history_frames = taps - 1;
+
+  input_frames = std::min<uint32_t>(input_frames, this->samples_size_ / channels - history_frames);
+  std::memcpy(this->samples_ + history_frames * channels, input_buffer, input_frames * channels * sizeof(int16_t));
+
+  const uint32_t end = history_frames + input_frames;
+  uint32_t generated = 0;
+  while ((generated < output_frames) && (this->position_ < end)) {
+    const int16_t *coefficients = this->filter_bank_->coefficients + this->phase_ * taps;
+    const int16_t *newest = this->samples_ + this->position_ * channels;
+
+    for (uint8_t channel = 0; channel < channels; ++channel) {
+      const int16_t *sample = newest + channel;
+      int32_t acc = 0;
+      for (uint16_t tap = 0; tap < taps; ++tap) {
+        acc += (int32_t) coefficients[tap] * (int32_t) *sample;
+        sample -= channels;
+      }
+      output_buffer[generated * channels + channel] = (int16_t) clamp<int32_t>(acc >> 15, INT16_MIN, INT16_MAX);
+    }
+    ++generated;
+
+    // Step through the input by decimation / phases frames without dividing
+    this->phase_ += decimation;
+    while (this->phase_ >= phases) {
+      this->phase_ -= phases;
+      ++this->position_;
+    }
+  }
+
+  // Frames before the next position are done with, keep the ones the filter still reaches back to
+  const uint32_t used = std::min(this->position_ - history_frames, input_frames);
+  std::memmove(this->samples_, this->samples_ + used * channels, history_frames * channels * sizeof(int16_t));
+  this->position_ -= used;
+
+  *frames_used = used;
+  *frames_generated = generated;
+}
+
+}  // namespace audio
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace audio {
+
+/// Q15 filter bank that resamples by ``phases`` / ``decimation``, generated at build time for one pair of sample
+/// rates. ``coefficients`` holds ``taps`` coefficients for every phase, phase after phase, with the coefficient for
+/// the newest input sample first.
+struct PolyphaseFilterBank {
+  uint32_t source_sample_rate;
+  uint32_t target_sample_rate;
+  uint16_t phases;
+  uint16_t decimation;
+  uint16_t taps;
+  const int16_t *coefficients;
+};
+
+class PolyphaseResampler {
+  /*
+   * @brief Resamples 16 bit audio by a rational factor with a fixed-point polyphase filter.
+   * Every output sample only runs the filter phase it needs, with integer multiply-accumulates and no per sample
+   * divisions, so it is much cheaper than the floating point resampler on chips without a fast FPU.
+   */
+ public:
+  ~PolyphaseResampler();
+
+  /// @brief Allocates the history buffer.
+  /// @param filter_bank Filter bank for the stream's sample rates, must outlive the resampler
+  /// @param channels Number of interleaved channels
+  /// @param max_input_frames Largest number of frames passed to a single resample call
+  /// @return True if successful, false if the history buffer failed to allocate
+  bool initialize(const PolyphaseFilterBank *filter_bank, uint8_t channels, uint32_t max_input_frames);
+
+  /// @brief Resamples as much audio as fits in the output buffer.
+  /// @param input_buffer Interleaved 16 bit input samples
+  /// @param output_buffer Buffer for interleaved 16 bit output samples
+  /// @param input_frames Number of frames in the input buffer
+  /// @param output_frames Number of frames the output buffer has space for
+  /// @param frames_used Set to the number of input frames consumed, the rest must be passed again next time
+  /// @param frames_generated Set to the number of output frames written
+  void resample(const int16_t *input_buffer, int16_t *output_buffer, uint32_t input_frames, uint32_t output_frames,
+                uint32_t *frames_used, uint32_t *frames_generated);
+
+ protected:
+  const PolyphaseFilterBank *filter_bank_{nullptr};
+
+  /// Previous ``taps - 1`` input frames followed by the frames of the current call.
+  int16_t *samples_{nullptr};
+  size_t samples_size_{0};
+
+  /// Index of the newest input frame the next output frame is computed at, counted from the start of ``samples_``.
+  uint32_t position_{0};
+  uint16_t phase_{0};
+  uint8_t channels_{0};
+};
+
+}  // namespace audio
+}  // namespace esphome
+
+#endif
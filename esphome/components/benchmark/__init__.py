@@ -0,0 +1,51 @@
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import display, sensor
+import esphome.config_validation as cv
+from esphome.const import CONF_DISPLAY_ID, CONF_ID, CONF_SENSOR_ID
+
+CODEOWNERS = ["@esphome/core"]
+AUTO_LOAD = ["json", "remote_base"]
+
+CONF_BENCHMARK_ID = "benchmark_id"
+CONF_ITERATIONS = "iterations"
+CONF_RUN_ON_BOOT = "run_on_boot"
+CONF_SCHEDULER_ITEMS = "scheduler_items"
+
+benchmark_ns = cg.esphome_ns.namespace("benchmark")
+Benchmark = benchmark_ns.class_("Benchmark", cg.Component)
+RunAction = benchmark_ns.class_("RunAction", automation.Action)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(Benchmark),
+        cv.Optional(CONF_ITERATIONS, default=1000): cv.int_range(min=1),
+        cv.Optional(CONF_SCHEDULER_ITEMS, default=50): cv.int_range(min=1, max=1000),
+        cv.Optional(CONF_RUN_ON_BOOT, default=True): cv.boolean,
+        cv.Optional(CONF_SENSOR_ID): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_DISPLAY_ID): cv.use_id(display.Display),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_iterations(config[CONF_ITERATIONS]))
+    cg.add(var.set_scheduler_items(config[CONF_SCHEDULER_ITEMS]))
+    cg.add(var.set_run_on_boot(config[CONF_RUN_ON_BOOT]))
+    if sensor_id := config.get(CONF_SENSOR_ID):
+        cg.add(var.set_filter_sensor(await cg.get_variable(sensor_id)))
+    if display_id := config.get(CONF_DISPLAY_ID):
+        cg.add(var.set_display(await cg.get_variable(display_id)))
+
+
+@automation.register_action(
+    "benchmark.run",
+    RunAction,
+    automation.maybe_simple_id({cv.GenerateID(): cv.use_id(Benchmark)}),
+)
+async def benchmark_run_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
@@ -0,0 +1,263 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+
+#ifdef USE_API
+#include "esphome/components/api/api_pb2.h"
+#endif
+#ifdef USE_API_NOISE
+#include "noise/protocol.h"
+#endif
+#ifdef USE_JSON
+#include "esphome/components/json/json_util.h"
+#endif
+
+namespace esphome {
+namespace benchmark {
+
+static const char *const TAG = "benchmark";
+
+static const char *const KERNEL_NAMES[KERNEL_COUNT] = {
+    "scheduler_call",
+    "scheduler_churn",
+    "proto_encode",
+    "noise_encrypt",
+    "sensor_filters",
+    "json_build",
+    "remote_nec_decode",
+    "display_fill",
+    "display_draw_pixels",
+    "preference_save",
+    "preference_load",
+};
+
+/// Every save is written to flash, so only this many are timed.
+static const uint32_t MAX_PREFERENCE_SAVES = 10;
+
+// Keeps the compiler from dropping the measured work
+static volatile uint32_t sink = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void Benchmark::setup() {
+  if (this->run_on_boot_) {
+    this->run();
+  } else {
+    this->disable_loop();
+  }
+}
+
+void Benchmark::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Benchmark:\n"
+                "  Iterations: %" PRIu32 "\n"
+                "  Scheduler items: %" PRIu32 "\n"
+                "  Run on boot: %s",
+                this->iterations_, this->scheduler_items_, YESNO(this->run_on_boot_));
+}
+
+void Benchmark::run() {
+  this->next_kernel_ = 0;
+  this->enable_loop();
+}
+
+void Benchmark::loop() {
+  if (!this->is_running()) {
+    this->disable_loop();
+    return;
+  }
+  this->run_kernel_(static_cast<BenchmarkKernel>(this->next_kernel_++));
+  if (!this->is_running())
+    ESP_LOGI(TAG, "BENCHMARKS DONE");
+}
+
+template<typename F> void Benchmark::measure_(BenchmarkKernel kernel, uint32_t iterations, F &&f) {
+  iterations = std::max<uint32_t>(iterations, 1);
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++)
+    f(i);
+  const uint32_t elapsed = micros() - start;
+  const float ns_per_op = elapsed * 1000.0f / iterations;
+  ESP_LOGI(TAG, "BENCHMARK {\"name\":\"%s\",\"iterations\":%" PRIu32 ",\"ns_per_op\":%.1f}", KERNEL_NAMES[kernel],
+           iterations, ns_per_op);
+#ifdef USE_SENSOR
+  if (this->result_sensors_[kernel] != nullptr)
+    this->result_sensors_[kernel]->publish_state(ns_per_op);
+#endif
+}
+
+void Benchmark::run_kernel_(BenchmarkKernel kernel) {
+  switch (kernel) {
+    case KERNEL_SCHEDULER_CALL:
+      this->bench_scheduler_call_();
+      break;
+    case KERNEL_SCHEDULER_CHURN:
+      this->bench_scheduler_churn_();
+      break;
+    case KERNEL_PROTO_ENCODE:
+      this->bench_proto_encode_();
+      break;
+    case KERNEL_NOISE_ENCRYPT:
+      this->bench_noise_encrypt_();
+      break;
+    case KERNEL_SENSOR_FILTERS:
+      this->bench_sensor_filters_();
+      break;
+    case KERNEL_JSON_BUILD:
+      this->bench_json_build_();
+      break;
+    case KERNEL_REMOTE_NEC_DECODE:
+      this->bench_remote_nec_decode_();
+      break;
+    case KERNEL_DISPLAY_FILL:
+      this->bench_display_fill_();
+      break;
+    case KERNEL_DISPLAY_DRAW_PIXELS:
+      this->bench_display_draw_pixels_();
+      break;
+    case KERNEL_PREFERENCE_SAVE:
+      this->bench_preference_save_();
+      break;
+    case KERNEL_PREFERENCE_LOAD:
+      this->bench_preference_load_();
+      break;
+    default:
+      break;
+  }
+}
+
+void Benchmark::bench_scheduler_call_() {
+  // Items far in the future, so every call only has to find out that nothing is due
+  for (uint32_t i = 0; i < this->scheduler_items_; i++)
+    this->set_interval("bench_" + std::to_string(i), 3600000, []() {});
+  this->measure_(KERNEL_SCHEDULER_CALL, this->iterations_, [](uint32_t) { App.scheduler.call(millis()); });
+  for (uint32_t i = 0; i < this->scheduler_items_; i++)
+    this->cancel_interval("bench_" + std::to_string(i));
+}
+
+void Benchmark::bench_scheduler_churn_() {
+  // A timeout that keeps getting replaced before it fires, like a debounce
+  this->measure_(KERNEL_SCHEDULER_CHURN, this->iterations_,
+                 [this](uint32_t) { this->set_timeout("bench_churn", 3600000, []() {}); });
+  this->cancel_timeout("bench_churn");
+}
+
+void Benchmark::bench_proto_encode_() {
+#ifdef USE_API
+  std::vector<uint8_t> buffer;
+  buffer.reserve(64);
+  api::SensorStateResponse msg;
+  msg.key = 0x12345678;
+  this->measure_(KERNEL_PROTO_ENCODE, this->iterations_, [&](uint32_t i) {
+    buffer.clear();
+    msg.state = static_cast<float>(i);
+    msg.encode(api::ProtoWriteBuffer(&buffer));
+    sink = sink + buffer.size();
+  });
+#endif
+}
+
+void Benchmark::bench_noise_encrypt_() {
+#ifdef USE_API_NOISE
+  NoiseCipherState *cipher;
+  if (noise_cipherstate_new_by_id(&cipher, NOISE_CIPHER_CHACHAPOLY) != NOISE_ERROR_NONE)
+    return;
+  const uint8_t key[32] = {};
+  noise_cipherstate_init_key(cipher, key, sizeof(key));
+  // A typical state message with the frame header, plus room for the MAC
+  uint8_t frame[64 + 16] = {};
+  this->measure_(KERNEL_NOISE_ENCRYPT, this->iterations_, [&](uint32_t) {
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, frame, 64, sizeof(frame));
+    noise_cipherstate_encrypt(cipher, &mbuf);
+    sink = sink + mbuf.size;
+  });
+  noise_cipherstate_free(cipher);
+#endif
+}
+
+void Benchmark::bench_sensor_filters_() {
+#ifdef USE_SENSOR
+  if (this->filter_sensor_ == nullptr)
+    return;
+  this->measure_(KERNEL_SENSOR_FILTERS, this->iterations_,
+                 [this](uint32_t i) { this->filter_sensor_->publish_state(static_cast<float>(i % 100)); });
+#endif
+}
+
+void Benchmark::bench_json_build_() {
+#ifdef USE_JSON
+  this->measure_(KERNEL_JSON_BUILD, this->iterations_, [](uint32_t i) {
+    std::string json = json::build_json([i](JsonObject root) {
+      root["id"] = "sensor-temperature";
+      root["value"] = static_cast<float>(i);
+      root["state"] = "23.5 °C";
+    });
+    sink = sink + json.size();
+  });
+#endif
+}
+
+void Benchmark::bench_remote_nec_decode_() {
+  remote_base::NECProtocol protocol;
+  remote_base::RemoteTransmitData transmit;
+  protocol.encode(&transmit, remote_base::NECData{0x1234, 0x78A0, 1});
+  const remote_base::RawTimings &timings = transmit.get_data();
+  this->measure_(KERNEL_REMOTE_NEC_DECODE, this->iterations_, [&](uint32_t) {
+    auto data = protocol.decode(remote_base::RemoteReceiveData(timings, 25, remote_base::TOLERANCE_MODE_PERCENTAGE));
+    sink = sink + data.has_value();
+  });
+}
+
+void Benchmark::bench_display_fill_() {
+#ifdef USE_DISPLAY
+  if (this->display_ == nullptr)
+    return;
+  // Only draws into the buffer, the display is not updated
+  this->measure_(KERNEL_DISPLAY_FILL, std::max<uint32_t>(this->iterations_ / 100, 1), [this](uint32_t i) {
+    this->display_->fill(i % 2 == 0 ? display::COLOR_ON : display::COLOR_OFF);
+  });
+#endif
+}
+
+void Benchmark::bench_display_draw_pixels_() {
+#ifdef USE_DISPLAY
+  if (this->display_ == nullptr)
+    return;
+  // A 32x32 RGB565 image, like an icon
+  static const int SIZE = 32;
+  std::vector<uint8_t> pixels(SIZE * SIZE * 2, 0x5A);
+  this->measure_(KERNEL_DISPLAY_DRAW_PIXELS, std::max<uint32_t>(this->iterations_ / 10, 1), [&](uint32_t) {
+    this->display_->draw_pixels_at(0, 0, SIZE, SIZE, pixels.data(), display::COLOR_ORDER_RGB,
+                                   display::COLOR_BITNESS_565, true);
+  });
+#endif
+}
+
+void Benchmark::bench_preference_save_() {
+  ESPPreferenceObject pref = global_preferences->make_preference<uint32_t>(fnv1_hash("benchmark"), true);
+  this->measure_(KERNEL_PREFERENCE_SAVE, std::min(this->iterations_, MAX_PREFERENCE_SAVES), [&pref](uint32_t i) {
+    pref.save(&i);
+    global_preferences->sync();
+  });
+}
+
+void Benchmark::bench_preference_load_() {
+  ESPPreferenceObject pref = global_preferences->make_preference<uint32_t>(fnv1_hash("benchmark"), true);
+  this->measure_(KERNEL_PREFERENCE_LOAD, this->iterations_, [&pref](uint32_t) {
+    uint32_t value = 0;
+    pref.load(&value);
+    sink = sink + value;
+  });
+}
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_DISPLAY
+#include "esphome/components/display/display.h"
+#endif
+
+namespace esphome {
+namespace benchmark {
+
+enum BenchmarkKernel : uint8_t {
+  KERNEL_SCHEDULER_CALL = 0,
+  KERNEL_SCHEDULER_CHURN,
+  KERNEL_PROTO_ENCODE,
+  KERNEL_NOISE_ENCRYPT,
+  KERNEL_SENSOR_FILTERS,
+  KERNEL_JSON_BUILD,
+  KERNEL_REMOTE_NEC_DECODE,
+  KERNEL_DISPLAY_FILL,
+  KERNEL_DISPLAY_DRAW_PIXELS,
+  KERNEL_PREFERENCE_SAVE,
+  KERNEL_PREFERENCE_LOAD,
+  KERNEL_COUNT,
+};
+
+/** Runs a fixed set of workloads and reports the time each iteration takes, to compare boards running the same
+ * configuration.
+ *
+ * One kernel runs per loop() call, so the watchdog is fed in between. Every result is logged as a
+ * `BENCHMARK {"name": ..., "iterations": ..., "ns_per_op": ...}` line, which script/bench collects for the host
+ * build, and published to the sensor of its kernel. Kernels whose component is not part of the configuration are
+ * skipped.
+ */
+class Benchmark : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  /// Runs all kernels again, starting with the next loop.
+  void run();
+  bool is_running() const { return this->next_kernel_ < KERNEL_COUNT; }
+
+  void set_iterations(uint32_t iterations) { this->iterations_ = iterations; }
+  void set_scheduler_items(uint32_t scheduler_items) { this->scheduler_items_ = scheduler_items; }
+  void set_run_on_boot(bool run_on_boot) { this->run_on_boot_ = run_on_boot; }
+#ifdef USE_SENSOR
+  void set_filter_sensor(sensor::Sensor *filter_sensor) { this->filter_sensor_ = filter_sensor; }
+  void set_result_sensor(BenchmarkKernel kernel, sensor::Sensor *result_sensor) {
+    this->result_sensors_[kernel] = result_sensor;
+  }
+#endif
+#ifdef USE_DISPLAY
+  void set_display(display::Display *display) { this->display_ = display; }
+#endif
+
+ protected:
+  /// Runs \p f \p iterations times and reports the time per iteration for \p kernel.
+  template<typename F> void measure_(BenchmarkKernel kernel, uint32_t iterations, F &&f);
+  void run_kernel_(BenchmarkKernel kernel);
+
+  void bench_scheduler_call_();
+  void bench_scheduler_churn_();
+  void bench_proto_encode_();
+  void bench_noise_encrypt_();
+  void bench_sensor_filters_();
+  void bench_json_build_();
+  void bench_remote_nec_decode_();
+  void bench_display_fill_();
+  void bench_display_draw_pixels_();
+  void bench_preference_save_();
+  void bench_preference_load_();
+
+  uint32_t iterations_{1000};
+  uint32_t scheduler_items_{50};
+  uint8_t next_kernel_{KERNEL_COUNT};
+  bool run_on_boot_{true};
+#ifdef USE_SENSOR
+  sensor::Sensor *filter_sensor_{nullptr};
+  sensor::Sensor *result_sensors_[KERNEL_COUNT]{};
+#endif
+#ifdef USE_DISPLAY
+  display::Display *display_{nullptr};
+#endif
+};
+
+template<typename... Ts> class RunAction : public Action<Ts...>, public Parented<Benchmark> {
+ public:
+  void play(Ts... x) override { this->parent_->run(); }
+};
+
+}  // namespace benchmark
+}  // namespace esphome
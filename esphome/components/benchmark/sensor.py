@@ -0,0 +1,53 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+)
+
+from . import CONF_BENCHMARK_ID, Benchmark, benchmark_ns
+
+DEPENDENCIES = ["benchmark"]
+
+UNIT_NANOSECOND = "ns"
+
+BenchmarkKernel = benchmark_ns.enum("BenchmarkKernel")
+KERNELS = {
+    "scheduler_call": BenchmarkKernel.KERNEL_SCHEDULER_CALL,
+    "scheduler_churn": BenchmarkKernel.KERNEL_SCHEDULER_CHURN,
+    "proto_encode": BenchmarkKernel.KERNEL_PROTO_ENCODE,
+    "noise_encrypt": BenchmarkKernel.KERNEL_NOISE_ENCRYPT,
+    "sensor_filters": BenchmarkKernel.KERNEL_SENSOR_FILTERS,
+    "json_build": BenchmarkKernel.KERNEL_JSON_BUILD,
+    "remote_nec_decode": BenchmarkKernel.KERNEL_REMOTE_NEC_DECODE,
+    "display_fill": BenchmarkKernel.KERNEL_DISPLAY_FILL,
+    "display_draw_pixels": BenchmarkKernel.KERNEL_DISPLAY_DRAW_PIXELS,
+    "preference_save": BenchmarkKernel.KERNEL_PREFERENCE_SAVE,
+    "preference_load": BenchmarkKernel.KERNEL_PREFERENCE_LOAD,
+}
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_BENCHMARK_ID): cv.use_id(Benchmark),
+        **{
+            cv.Optional(kernel): sensor.sensor_schema(
+                unit_of_measurement=UNIT_NANOSECOND,
+                icon=ICON_TIMER,
+                accuracy_decimals=1,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            )
+            for kernel in KERNELS
+        },
+    }
+)
+
+
+async def to_code(config):
+    benchmark = await cg.get_variable(config[CONF_BENCHMARK_ID])
+    for kernel, value in KERNELS.items():
+        if kernel_config := config.get(kernel):
+            sens = await sensor.new_sensor(kernel_config)
+            cg.add(benchmark.set_result_sensor(value, sens))
@@ -60,7 +60,11 @@ from esphome.const import (
     DEVICE_CLASS_WINDOW,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
-from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
+from esphome.core.entity_helpers import (
+    entity_duplicate_validator,
+    entity_string,
+    setup_entity,
+)
 from esphome.cpp_generator import MockObjClass
 from esphome.util import Registry
 
@@ -545,7 +549,7 @@ async def setup_binary_sensor_core_(var, config):
     await setup_entity(var, config, "binary_sensor")
 
     if (device_class := config.get(CONF_DEVICE_CLASS)) is not None:
-        cg.add(var.set_device_class(device_class))
+        cg.add(var.set_device_class(entity_string(device_class)))
     trigger = config.get(CONF_TRIGGER_ON_INITIAL_STATE, False) or config.get(
         CONF_PUBLISH_INITIAL_STATE, False
     )
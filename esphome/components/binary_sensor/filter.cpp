@@ -1,6 +1,7 @@
 #include "filter.h"
 
 #include "binary_sensor.h"
+#include "esphome/core/hal.h"
 #include <utility>
 
 namespace esphome {
@@ -25,45 +26,75 @@ void Filter::input(bool value) {
   }
 }
 
+void DeadlineFilter::start_deadline_(uint32_t delay) {
+  this->deadline_ = millis() + delay;
+  this->deadline_pending_ = true;
+  if (!this->deadline_armed_ || static_cast<int32_t>(this->deadline_ - this->armed_deadline_) < 0)
+    this->arm_deadline_(delay);
+}
+
+void DeadlineFilter::arm_deadline_(uint32_t delay) {
+  this->deadline_armed_ = true;
+  this->armed_deadline_ = millis() + delay;
+  // Replaces a timeout that is still armed for a later deadline
+  this->set_timeout("deadline", delay, [this]() {
+    this->deadline_armed_ = false;
+    if (!this->deadline_pending_)
+      return;
+    const int32_t remaining = static_cast<int32_t>(this->deadline_ - millis());
+    if (remaining > 0) {
+      this->arm_deadline_(remaining);
+      return;
+    }
+    this->deadline_pending_ = false;
+    this->on_deadline_();
+  });
+}
+
 void TimeoutFilter::input(bool value) {
-  this->set_timeout("timeout", this->timeout_delay_.value(), [this]() { this->parent_->invalidate_state(); });
+  this->start_deadline_(this->timeout_delay_.value());
   // we do not de-dup here otherwise changes from invalid to valid state will not be output
   this->output(value);
 }
 
+void TimeoutFilter::on_deadline_() { this->parent_->invalidate_state(); }
+
 optional<bool> DelayedOnOffFilter::new_value(bool value) {
-  if (value) {
-    this->set_timeout("ON_OFF", this->on_delay_.value(), [this]() { this->output(true); });
-  } else {
-    this->set_timeout("ON_OFF", this->off_delay_.value(), [this]() { this->output(false); });
-  }
+  this->pending_value_ = value;
+  this->start_deadline_(value ? this->on_delay_.value() : this->off_delay_.value());
   return {};
 }
 
+void DelayedOnOffFilter::on_deadline_() { this->output(this->pending_value_); }
+
 float DelayedOnOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 optional<bool> DelayedOnFilter::new_value(bool value) {
   if (value) {
-    this->set_timeout("ON", this->delay_.value(), [this]() { this->output(true); });
+    this->start_deadline_(this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("ON");
+    this->cancel_deadline_();
     return false;
   }
 }
 
+void DelayedOnFilter::on_deadline_() { this->output(true); }
+
 float DelayedOnFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 optional<bool> DelayedOffFilter::new_value(bool value) {
   if (!value) {
-    this->set_timeout("OFF", this->delay_.value(), [this]() { this->output(false); });
+    this->start_deadline_(this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("OFF");
+    this->cancel_deadline_();
     return true;
   }
 }
 
+void DelayedOffFilter::on_deadline_() { this->output(false); }
+
 float DelayedOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 optional<bool> InvertFilter::new_value(bool value) { return !value; }
@@ -118,19 +149,25 @@ optional<bool> LambdaFilter::new_value(bool value) { return this->f_(value); }
 
 optional<bool> SettleFilter::new_value(bool value) {
   if (!this->steady_) {
-    this->set_timeout("SETTLE", this->delay_.value(), [this, value]() {
-      this->steady_ = true;
-      this->output(value);
-    });
+    this->pending_output_ = true;
+    this->pending_value_ = value;
+    this->start_deadline_(this->delay_.value());
     return {};
   } else {
     this->steady_ = false;
     this->output(value);
-    this->set_timeout("SETTLE", this->delay_.value(), [this]() { this->steady_ = true; });
+    this->pending_output_ = false;
+    this->start_deadline_(this->delay_.value());
     return value;
   }
 }
 
+void SettleFilter::on_deadline_() {
+  this->steady_ = true;
+  if (this->pending_output_)
+    this->output(this->pending_value_);
+}
+
 float SettleFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 }  // namespace binary_sensor
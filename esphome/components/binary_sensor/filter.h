@@ -28,17 +28,40 @@ class Filter {
   Deduplicator<bool> dedup_;
 };
 
-class TimeoutFilter : public Filter, public Component {
+/** A filter that acts a while after its last input, like a debounce.
+ *
+ * Moving the deadline only stores it, the scheduler timeout is set up when none is armed or the deadline moved
+ * before it. A timeout that fires before the deadline re-arms itself for the remaining time. This way a chattering
+ * contact costs no scheduler work per transition.
+ */
+class DeadlineFilter : public Filter, public Component {
+ protected:
+  /// Calls on_deadline_() after \p delay ms, unless the deadline is moved or cancelled before.
+  void start_deadline_(uint32_t delay);
+  void cancel_deadline_() { this->deadline_pending_ = false; }
+  virtual void on_deadline_() = 0;
+
+  void arm_deadline_(uint32_t delay);
+
+  uint32_t deadline_{0};
+  uint32_t armed_deadline_{0};  ///< When the armed scheduler timeout fires
+  bool deadline_pending_{false};
+  bool deadline_armed_{false};
+};
+
+class TimeoutFilter : public DeadlineFilter {
  public:
   optional<bool> new_value(bool value) override { return value; }
   void input(bool value) override;
   template<typename T> void set_timeout_value(T timeout) { this->timeout_delay_ = timeout; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> timeout_delay_{};
 };
 
-class DelayedOnOffFilter : public Filter, public Component {
+class DelayedOnOffFilter : public DeadlineFilter {
  public:
   optional<bool> new_value(bool value) override;
 
@@ -48,11 +71,14 @@ class DelayedOnOffFilter : public Filter, public Component {
   template<typename T> void set_off_delay(T delay) { this->off_delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> on_delay_{};
   TemplatableValue<uint32_t> off_delay_{};
+  bool pending_value_{false};
 };
 
-class DelayedOnFilter : public Filter, public Component {
+class DelayedOnFilter : public DeadlineFilter {
  public:
   optional<bool> new_value(bool value) override;
 
@@ -61,10 +87,12 @@ class DelayedOnFilter : public Filter, public Component {
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
-class DelayedOffFilter : public Filter, public Component {
+class DelayedOffFilter : public DeadlineFilter {
  public:
   optional<bool> new_value(bool value) override;
 
@@ -73,6 +101,8 @@ class DelayedOffFilter : public Filter, public Component {
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
@@ -118,7 +148,7 @@ class LambdaFilter : public Filter {
   std::function<optional<bool>(bool)> f_;
 };
 
-class SettleFilter : public Filter, public Component {
+class SettleFilter : public DeadlineFilter {
  public:
   optional<bool> new_value(bool value) override;
 
@@ -127,8 +157,12 @@ class SettleFilter : public Filter, public Component {
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
   bool steady_{true};
+  bool pending_output_{false};  ///< Whether pending_value_ is output once the input settled
+  bool pending_value_{false};
 };
 
 }  // namespace binary_sensor
@@ -17,6 +17,7 @@ class BLEPresenceDevice : public binary_sensor::BinarySensorInitiallyOff,
     this->match_by_ = MATCH_BY_MAC_ADDRESS;
     this->address_ = address;
   }
+  uint64_t get_address_filter() const override { return this->match_by_ == MATCH_BY_MAC_ADDRESS ? this->address_ : 0; }
   void set_irk(uint8_t *irk) {
     this->match_by_ = MATCH_BY_IRK;
     this->irk_ = irk;
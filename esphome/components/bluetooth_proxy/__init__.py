@@ -18,6 +18,7 @@ _LOGGER = logging.getLogger(__name__)
 CONF_CONNECTION_SLOTS = "connection_slots"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_MAX_PENDING_WRITES = "max_pending_writes"
 DEFAULT_CONNECTION_SLOTS = 3
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
@@ -95,6 +96,9 @@ CONFIG_SCHEMA = cv.All(
                     cv.ensure_list(CONNECTION_SCHEMA),
                     cv.Length(min=1, max=esp32_ble_tracker.max_connections()),
                 ),
+                cv.Optional(CONF_MAX_PENDING_WRITES, default=8): cv.int_range(
+                    min=0, max=32
+                ),
             }
         )
         .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -112,6 +116,7 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    cg.add(var.set_max_pending_writes(config[CONF_MAX_PENDING_WRITES]))
     await esp32_ble_tracker.register_raw_ble_device(var, config)
 
     # Define max connections for protobuf fixed array
@@ -132,5 +137,6 @@ async def to_code(config):
 
     if config.get(CONF_CACHE_SERVICES):
         add_idf_sdkconfig_option("CONFIG_BT_GATTC_CACHE_NVS_FLASH", True)
+        cg.add_define("USE_BLUETOOTH_PROXY_CACHE_SERVICES")
 
     cg.add_define("USE_BLUETOOTH_PROXY")
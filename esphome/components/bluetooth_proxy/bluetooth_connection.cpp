@@ -12,6 +12,10 @@ namespace esphome::bluetooth_proxy {
 
 static const char *const TAG = "bluetooth_proxy.connection";
 
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+static const uint16_t DATABASE_HASH_UUID = 0x2B2A;
+#endif
+
 // This function is allocation-free and directly packs UUIDs into the output array
 // using precalculated constants for the Bluetooth base UUID
 static void fill_128bit_uuid_array(std::array<uint64_t, 2> &out, esp_bt_uuid_t uuid_source) {
@@ -153,6 +157,11 @@ void BluetoothConnection::reset_connection_(esp_err_t reason) {
   // tell them about a partial list.
   this->set_address(0);
   this->send_service_ = INIT_SENDING_SERVICES;
+  this->pending_writes_.clear();
+  this->congested_ = false;
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  this->database_hash_state_ = DATABASE_HASH_UNCHECKED;
+#endif
   this->proxy_->send_connections_free();
 }
 
@@ -399,23 +408,44 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
         this->proxy_->send_connections_free();
       }
       this->seen_mtu_or_services_ = false;
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+      this->database_hash_state_ = DATABASE_HASH_UNCHECKED;
+#endif
+      break;
+    }
+    case ESP_GATTC_CFG_MTU_EVT: {
+      this->mtu_or_services_ready_();
       break;
     }
-    case ESP_GATTC_CFG_MTU_EVT:
     case ESP_GATTC_SEARCH_CMPL_EVT: {
-      if (!this->seen_mtu_or_services_) {
-        // We don't know if we will get the MTU or the services first, so
-        // only send the device connection true if we have already received
-        // the services.
-        this->seen_mtu_or_services_ = true;
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+      // The services only count once the cache they may come from is known to be current
+      if (this->start_database_hash_check_())
         break;
-      }
-      this->proxy_->send_device_connection(this->address_, true, this->mtu_);
-      this->proxy_->send_connections_free();
+#endif
+      this->mtu_or_services_ready_();
       break;
     }
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+    case ESP_GATTC_DIS_SRVC_CMPL_EVT: {
+      if (this->database_hash_state_ != DATABASE_HASH_REFRESHING)
+        break;
+      // The cache was rebuilt from a fresh discovery, search it again to count the services
+      this->database_hash_state_ = DATABASE_HASH_CHECKED;
+      this->service_count_ = 0;
+      esp_ble_gattc_search_service(this->gattc_if_, this->conn_id_, nullptr);
+      break;
+    }
+#endif
     case ESP_GATTC_READ_DESCR_EVT:
     case ESP_GATTC_READ_CHAR_EVT: {
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+      if (event == ESP_GATTC_READ_CHAR_EVT && this->database_hash_state_ == DATABASE_HASH_READING &&
+          param->read.handle == this->database_hash_handle_) {
+        this->handle_database_hash_(param);
+        break;
+      }
+#endif
       if (param->read.status != ESP_GATT_OK) {
         this->log_gatt_operation_error_("reading char/descriptor", param->read.handle, param->read.status);
         this->proxy_->send_gatt_error(this->address_, param->read.handle, param->read.status);
@@ -467,6 +497,14 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
       this->proxy_->get_api_connection()->send_message(resp, api::BluetoothGATTNotifyResponse::MESSAGE_TYPE);
       break;
     }
+    case ESP_GATTC_CONGEST_EVT: {
+      ESP_LOGV(TAG, "[%d] [%s] Congested: %s", this->connection_index_, this->address_str_.c_str(),
+               YESNO(param->congest.congested));
+      this->congested_ = param->congest.congested;
+      if (!this->congested_)
+        this->flush_pending_writes_();
+      break;
+    }
     case ESP_GATTC_NOTIFY_EVT: {
       ESP_LOGV(TAG, "[%d] [%s] ESP_GATTC_NOTIFY_EVT: handle=0x%2X", this->connection_index_, this->address_str_.c_str(),
                param->notify.handle);
@@ -483,6 +521,60 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
   return true;
 }
 
+void BluetoothConnection::mtu_or_services_ready_() {
+  if (!this->seen_mtu_or_services_) {
+    // We don't know if we will get the MTU or the services first, so
+    // only send the device connection true if we have already received
+    // the services.
+    this->seen_mtu_or_services_ = true;
+    return;
+  }
+  this->proxy_->send_device_connection(this->address_, true, this->mtu_);
+  this->proxy_->send_connections_free();
+}
+
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+bool BluetoothConnection::start_database_hash_check_() {
+  if (this->connection_type_ != espbt::ConnectionType::V3_WITHOUT_CACHE ||
+      this->database_hash_state_ != DATABASE_HASH_UNCHECKED)
+    return false;
+  this->database_hash_state_ = DATABASE_HASH_CHECKED;
+
+  esp_gattc_char_elem_t result;
+  uint16_t count = 1;
+  esp_gatt_status_t status =
+      esp_ble_gattc_get_char_by_uuid(this->gattc_if_, this->conn_id_, 0x0001, 0xFFFF,
+                                     espbt::ESPBTUUID::from_uint16(DATABASE_HASH_UUID).get_uuid(), &result, &count);
+  if (status != ESP_GATT_OK || count == 0)
+    return false;  // The peer does not support GATT caching, nothing to check against
+
+  esp_err_t err = esp_ble_gattc_read_char(this->gattc_if_, this->conn_id_, result.char_handle, ESP_GATT_AUTH_REQ_NONE);
+  if (err != ESP_OK) {
+    this->log_connection_warning_("esp_ble_gattc_read_char", err);
+    return false;
+  }
+  this->database_hash_handle_ = result.char_handle;
+  this->database_hash_state_ = DATABASE_HASH_READING;
+  return true;
+}
+
+void BluetoothConnection::handle_database_hash_(esp_ble_gattc_cb_param_t *param) {
+  this->database_hash_state_ = DATABASE_HASH_CHECKED;
+  if (param->read.status == ESP_GATT_OK && param->read.value_len == DATABASE_HASH_SIZE &&
+      !this->proxy_->check_database_hash(this->address_, param->read.value)) {
+    ESP_LOGI(TAG, "[%d] [%s] GATT database changed, refreshing cached services", this->connection_index_,
+             this->address_str_.c_str());
+    this->database_hash_state_ = DATABASE_HASH_REFRESHING;
+    esp_err_t err = esp_ble_gattc_cache_refresh(this->remote_bda_);
+    if (err == ESP_OK)
+      return;
+    this->log_connection_warning_("esp_ble_gattc_cache_refresh", err);
+    this->database_hash_state_ = DATABASE_HASH_CHECKED;
+  }
+  this->mtu_or_services_ready_();
+}
+#endif
+
 void BluetoothConnection::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   BLEClientBase::gap_event_handler(event, param);
 
@@ -519,6 +611,19 @@ esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const std::
     this->log_gatt_not_connected_("write", "characteristic");
     return ESP_GATT_NOT_CONNECTED;
   }
+  // Writes without response are not acknowledged, so the client streams them back to back. While the stack is
+  // congested they would be rejected; hold them (and anything written after them, to keep the order) until it clears.
+  if ((this->congested_ || !this->pending_writes_.empty()) &&
+      this->pending_writes_.size() < this->proxy_->get_max_pending_writes()) {
+    ESP_LOGV(TAG, "[%d] [%s] Queueing GATT characteristic write handle %d", this->connection_index_,
+             this->address_str_.c_str(), handle);
+    this->pending_writes_.push_back({handle, response, data});
+    return ESP_OK;
+  }
+  return this->send_write_(handle, data, response);
+}
+
+esp_err_t BluetoothConnection::send_write_(uint16_t handle, const std::string &data, bool response) {
   ESP_LOGV(TAG, "[%d] [%s] Writing GATT characteristic handle %d", this->connection_index_, this->address_str_.c_str(),
            handle);
 
@@ -528,6 +633,15 @@ esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const std::
   return this->check_and_log_error_("esp_ble_gattc_write_char", err);
 }
 
+void BluetoothConnection::flush_pending_writes_() {
+  while (!this->pending_writes_.empty() && !this->congested_) {
+    const auto &write = this->pending_writes_.front();
+    if (this->send_write_(write.handle, write.data, write.response) != ESP_OK)
+      this->proxy_->send_gatt_error(this->address_, write.handle, ESP_GATT_ERROR);
+    this->pending_writes_.pop_front();
+  }
+}
+
 esp_err_t BluetoothConnection::read_descriptor(uint16_t handle) {
   if (!this->connected()) {
     this->log_gatt_not_connected_("read", "descriptor");
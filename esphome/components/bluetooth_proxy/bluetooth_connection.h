@@ -4,10 +4,23 @@
 
 #include "esphome/components/esp32_ble_client/ble_client_base.h"
 
+#include <deque>
+#include <string>
+
 namespace esphome::bluetooth_proxy {
 
 class BluetoothProxy;
 
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+/// Progress of checking services loaded from the cache against the peer's Database Hash characteristic.
+enum DatabaseHashState : uint8_t {
+  DATABASE_HASH_UNCHECKED,
+  DATABASE_HASH_READING,
+  DATABASE_HASH_REFRESHING,
+  DATABASE_HASH_CHECKED,
+};
+#endif
+
 class BluetoothConnection final : public esp32_ble_client::BLEClientBase {
  public:
   void dump_config() override;
@@ -31,6 +44,12 @@ class BluetoothConnection final : public esp32_ble_client::BLEClientBase {
 
   bool supports_efficient_uuids_() const;
   void send_service_for_discovery_();
+  /// Report the connection once both the MTU and the services are known.
+  void mtu_or_services_ready_();
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  bool start_database_hash_check_();
+  void handle_database_hash_(esp_ble_gattc_cb_param_t *param);
+#endif
   void reset_connection_(esp_err_t reason);
   void update_allocated_slot_(uint64_t find_value, uint64_t set_value);
   void log_connection_error_(const char *operation, esp_gatt_status_t status);
@@ -38,17 +57,36 @@ class BluetoothConnection final : public esp32_ble_client::BLEClientBase {
   void log_gatt_not_connected_(const char *action, const char *type);
   void log_gatt_operation_error_(const char *operation, uint16_t handle, esp_gatt_status_t status);
   esp_err_t check_and_log_error_(const char *operation, esp_err_t err);
+  esp_err_t send_write_(uint16_t handle, const std::string &data, bool response);
+  /// Hand the writes held back during congestion to the stack, in order.
+  void flush_pending_writes_();
+
+  /// A characteristic write held back while the link is congested.
+  struct PendingWrite {
+    uint16_t handle;
+    bool response;
+    std::string data;
+  };
 
   // Memory optimized layout for 32-bit systems
   // Group 1: Pointers (4 bytes each, naturally aligned)
   BluetoothProxy *proxy_;
 
+  // Writes queued while the stack reports congestion, sent in order once it clears
+  std::deque<PendingWrite> pending_writes_;
+
   // Group 2: 2-byte types
   int16_t send_service_{-3};  // -3 = INIT_SENDING_SERVICES, -2 = DONE_SENDING_SERVICES, >=0 = service index
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  uint16_t database_hash_handle_{0};
+#endif
 
   // Group 3: 1-byte types
   bool seen_mtu_or_services_{false};
-  // 1 byte used, 1 byte padding
+  bool congested_{false};
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  DatabaseHashState database_hash_state_{DATABASE_HASH_UNCHECKED};
+#endif
 };
 
 }  // namespace esphome::bluetooth_proxy
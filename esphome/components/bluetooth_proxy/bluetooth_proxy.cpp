@@ -3,6 +3,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 #include "esphome/core/application.h"
+#include <algorithm>
 #include <cstring>
 
 #ifdef USE_ESP32
@@ -24,6 +25,13 @@ void BluetoothProxy::setup() {
   this->connections_free_response_.limit = BLUETOOTH_PROXY_MAX_CONNECTIONS;
   this->connections_free_response_.free = BLUETOOTH_PROXY_MAX_CONNECTIONS;
 
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  this->database_hash_pref_ =
+      global_preferences->make_preference<DatabaseHashes>(fnv1_hash("bluetooth_proxy_database_hashes"));
+  if (!this->database_hash_pref_.load(&this->database_hashes_))
+    this->database_hashes_ = {};
+#endif
+
   // Capture the configured scan mode from YAML before any API changes
   this->configured_scan_active_ = this->parent_->get_scan_active();
 
@@ -34,6 +42,27 @@ void BluetoothProxy::setup() {
   });
 }
 
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+bool BluetoothProxy::check_database_hash(uint64_t address, const uint8_t *hash) {
+  for (auto &entry : this->database_hashes_.entries) {
+    if (entry.address != address)
+      continue;
+    if (memcmp(entry.hash, hash, DATABASE_HASH_SIZE) == 0)
+      return true;
+    memcpy(entry.hash, hash, DATABASE_HASH_SIZE);
+    this->database_hash_pref_.save(&this->database_hashes_);
+    return false;
+  }
+  // A new device: its services were either just discovered or there is nothing to compare them against
+  auto &entry = this->database_hashes_.entries[this->database_hashes_.next];
+  entry.address = address;
+  memcpy(entry.hash, hash, DATABASE_HASH_SIZE);
+  this->database_hashes_.next = (this->database_hashes_.next + 1) % DATABASE_HASH_CACHE_SIZE;
+  this->database_hash_pref_.save(&this->database_hashes_);
+  return true;
+}
+#endif
+
 void BluetoothProxy::send_bluetooth_scanner_state_(esp32_ble_tracker::ScannerState state) {
   api::BluetoothScannerStateResponse resp;
   resp.state = static_cast<api::enums::BluetoothScannerState>(state);
@@ -73,33 +102,33 @@ bool BluetoothProxy::parse_device(const esp32_ble_tracker::ESPBTDevice &device)
 }
 #endif
 
-bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *scan_results, size_t count) {
+bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *const *scan_results, size_t count) {
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr)
     return false;
 
   auto &advertisements = this->response_.advertisements;
 
-  for (size_t i = 0; i < count; i++) {
-    auto &result = scan_results[i];
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
-
-    // Fill in the data directly at current position
-    auto &adv = advertisements[this->response_.advertisements_len];
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-    adv.data_len = length;
-    std::memcpy(adv.data, result.ble_adv, length);
-
-    this->response_.advertisements_len++;
-
-    ESP_LOGV(TAG, "Queuing raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
-             result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
-
-    // Flush if we have reached BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE
-    if (this->response_.advertisements_len >= BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE) {
-      this->flush_pending_advertisements();
+  size_t i = 0;
+  while (i < count) {
+    // Fill the response as far as there is room, then flush once BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE is reached
+    size_t end = std::min(count, i + (BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE - this->response_.advertisements_len));
+    for (; i < end; i++) {
+      auto &result = *scan_results[i];
+      uint8_t length = result.adv_data_len + result.scan_rsp_len;
+
+      // Fill in the data directly at current position
+      auto &adv = advertisements[this->response_.advertisements_len++];
+      adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
+      adv.rssi = result.rssi;
+      adv.address_type = result.ble_addr_type;
+      adv.data_len = length;
+      std::memcpy(adv.data, result.ble_adv, length);
+
+      ESP_LOGV(TAG, "Queuing raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
+               result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
     }
+    if (this->response_.advertisements_len >= BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE)
+      this->flush_pending_advertisements();
   }
 
   return true;
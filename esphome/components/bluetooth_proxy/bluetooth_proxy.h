@@ -13,6 +13,7 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/preferences.h"
 
 #include "bluetooth_connection.h"
 
@@ -24,6 +25,19 @@ namespace esphome::bluetooth_proxy {
 static const esp_err_t ESP_GATT_NOT_CONNECTED = -1;
 static const int DONE_SENDING_SERVICES = -2;
 static const int INIT_SENDING_SERVICES = -3;
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+static const uint8_t DATABASE_HASH_SIZE = 16;
+static const uint8_t DATABASE_HASH_CACHE_SIZE = 16;
+
+/// Database Hash last read from each device, to tell whether the services cached for it are still current.
+struct DatabaseHashes {
+  struct Entry {
+    uint64_t address;
+    uint8_t hash[DATABASE_HASH_SIZE];
+  } entries[DATABASE_HASH_CACHE_SIZE];
+  uint8_t next;  // entry replaced by the next new device, the oldest one
+};
+#endif
 
 using namespace esp32_ble_client;
 
@@ -57,7 +71,7 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
 #ifdef USE_ESP32_BLE_DEVICE
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 #endif
-  bool parse_devices(const esp32_ble::BLEScanResult *scan_results, size_t count) override;
+  bool parse_devices(const esp32_ble::BLEScanResult *const *scan_results, size_t count) override;
   void dump_config() override;
   void setup() override;
   void loop() override;
@@ -105,6 +119,15 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
 
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
+  /// Set how many characteristic writes each connection holds back while the link is congested.
+  void set_max_pending_writes(uint8_t max_pending_writes) { this->max_pending_writes_ = max_pending_writes; }
+  uint8_t get_max_pending_writes() const { return this->max_pending_writes_; }
+
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  /// Compare a device's Database Hash with the one read last time and remember it.
+  /// Returns false when the GATT database changed since, so the services cached for the device are stale.
+  bool check_database_hash(uint64_t address, const uint8_t *hash);
+#endif
 
   uint32_t get_legacy_version() const {
     if (this->active_) {
@@ -160,11 +183,17 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
   // Pre-allocated response message - always ready to send
   api::BluetoothConnectionsFreeResponse connections_free_response_;
 
+#ifdef USE_BLUETOOTH_PROXY_CACHE_SERVICES
+  DatabaseHashes database_hashes_{};
+  ESPPreferenceObject database_hash_pref_;
+#endif
+
   // Group 4: 1-byte types grouped together
   bool active_;
   uint8_t connection_count_{0};
   bool configured_scan_active_{false};  // Configured scan mode from YAML
-  // 3 bytes used, 1 byte padding
+  uint8_t max_pending_writes_{8};
+  // 4 bytes used, no padding
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,30 @@
+"""
+Boot timeline tracing for ESPHome.
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/core"]
+
+CONF_MAX_EVENTS = "max_events"
+
+boot_timeline_ns = cg.esphome_ns.namespace("boot_timeline")
+BootTimeline = boot_timeline_ns.class_("BootTimeline", cg.Component, cg.Controller)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(BootTimeline),
+        cv.Optional(CONF_MAX_EVENTS, default=128): cv.int_range(min=8, max=1024),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    cg.add_define("USE_BOOT_TIMELINE")
+    cg.add_define("BOOT_TIMELINE_MAX_EVENTS", config[CONF_MAX_EVENTS])
+
+    # The constructor sets global_boot_timeline
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
@@ -0,0 +1,79 @@
+#include "boot_timeline.h"
+
+#ifdef USE_BOOT_TIMELINE
+
+#include <cinttypes>
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace boot_timeline {
+
+static const char *const TAG = "boot_timeline";
+
+const LogString *boot_event_type_to_string(BootEventType type) {
+  switch (type) {
+    case BOOT_EVENT_SETUP_START:
+      return LOG_STR("setup start");
+    case BOOT_EVENT_SETUP_END:
+      return LOG_STR("setup end");
+    case BOOT_EVENT_SETUP_COMPLETE:
+      return LOG_STR("setup complete");
+    case BOOT_EVENT_NETWORK_CONNECTED:
+      return LOG_STR("network connected");
+    case BOOT_EVENT_API_CLIENT_CONNECTED:
+      return LOG_STR("API client connected");
+    case BOOT_EVENT_FIRST_STATE:
+      return LOG_STR("first state");
+    default:
+      return LOG_STR("unknown");
+  }
+}
+
+BootTimeline::BootTimeline() { global_boot_timeline = this; }
+
+void BootTimeline::setup() { this->setup_controller(true); }
+
+void BootTimeline::record(BootEventType type, const Component *component) {
+  if (this->count_ >= this->events_.size()) {
+    this->dropped_++;
+    return;
+  }
+  this->events_[this->count_++] = BootEvent{micros(), component, type};
+}
+
+void BootTimeline::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Boot Timeline:\n"
+                "  Events: %u (%" PRIu32 " dropped)",
+                this->count_, this->dropped_);
+  for (size_t i = 0; i < this->count_; i++) {
+    const BootEvent &event = this->events_[i];
+    if (event.type == BOOT_EVENT_SETUP_END)
+      continue;
+    if (event.type != BOOT_EVENT_SETUP_START) {
+      ESP_LOGCONFIG(TAG, "  %8.3fms %s", event.time_us / 1000.0f, LOG_STR_ARG(boot_event_type_to_string(event.type)));
+      continue;
+    }
+    const BootEvent *end = nullptr;
+    for (size_t j = i + 1; j < this->count_ && end == nullptr; j++) {
+      if (this->events_[j].type == BOOT_EVENT_SETUP_END && this->events_[j].component == event.component)
+        end = &this->events_[j];
+    }
+    const char *source = LOG_STR_ARG(event.component->get_component_log_str());
+    if (end != nullptr) {
+      ESP_LOGCONFIG(TAG, "  %8.3fms setup %s took %.3fms", event.time_us / 1000.0f, source,
+                    (end->time_us - event.time_us) / 1000.0f);
+    } else {
+      ESP_LOGCONFIG(TAG, "  %8.3fms setup %s", event.time_us / 1000.0f, source);
+    }
+  }
+}
+
+}  // namespace boot_timeline
+
+boot_timeline::BootTimeline *global_boot_timeline =
+    nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_BOOT_TIMELINE
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_BOOT_TIMELINE
+
+#include <array>
+#include <cstdint>
+#include "esphome/core/component.h"
+#include "esphome/core/controller.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace boot_timeline {
+
+enum BootEventType : uint8_t {
+  BOOT_EVENT_SETUP_START,
+  BOOT_EVENT_SETUP_END,
+  // Application::setup() returned, all components are set up
+  BOOT_EVENT_SETUP_COMPLETE,
+  // WiFi associated / Ethernet link up with an IP address
+  BOOT_EVENT_NETWORK_CONNECTED,
+  BOOT_EVENT_API_CLIENT_CONNECTED,
+  BOOT_EVENT_FIRST_STATE,
+};
+
+const LogString *boot_event_type_to_string(BootEventType type);
+
+struct BootEvent {
+  // micros() when the event happened
+  uint32_t time_us;
+  // Component for setup events, nullptr otherwise
+  const Component *component;
+  BootEventType type;
+};
+
+/** Records a timeline of the boot process in a static buffer.
+ *
+ * Component setup start/end times are recorded by Component::call(), the network, API and first state events
+ * only the first time they happen. Events past BOOT_TIMELINE_MAX_EVENTS are counted but not stored.
+ * The timeline is logged in dump_config() and can be retrieved with the BootTimelineRequest API message.
+ */
+class BootTimeline : public Component, public Controller {
+ public:
+  BootTimeline();
+
+  void setup() override;
+  void dump_config() override;
+  // Before everything else, so the state callbacks are in place before any entity publishes
+  float get_setup_priority() const override { return setup_priority::BUS + 1000.0f; }
+
+  void record(BootEventType type, const Component *component = nullptr);
+  /// Record an event that is only of interest the first time it happens (e.g. network connected).
+  void record_once(BootEventType type) {
+    if ((this->once_seen_ & (1u << type)) != 0)
+      return;
+    this->once_seen_ |= 1u << type;
+    this->record(type);
+  }
+
+  const BootEvent *get_events() const { return this->events_.data(); }
+  size_t get_event_count() const { return this->count_; }
+  /// Number of events that did not fit in the buffer
+  uint32_t get_dropped() const { return this->dropped_; }
+
+#ifdef USE_BINARY_SENSOR
+  void on_binary_sensor_update(binary_sensor::BinarySensor *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_FAN
+  void on_fan_update(fan::Fan *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_LIGHT
+  void on_light_update(light::LightState *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_SENSOR
+  void on_sensor_update(sensor::Sensor *obj, float state) override { this->on_state_(); }
+#endif
+#ifdef USE_SWITCH
+  void on_switch_update(switch_::Switch *obj, bool state) override { this->on_state_(); }
+#endif
+#ifdef USE_COVER
+  void on_cover_update(cover::Cover *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_TEXT_SENSOR
+  void on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) override { this->on_state_(); }
+#endif
+#ifdef USE_CLIMATE
+  void on_climate_update(climate::Climate *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_NUMBER
+  void on_number_update(number::Number *obj, float state) override { this->on_state_(); }
+#endif
+#ifdef USE_DATETIME_DATE
+  void on_date_update(datetime::DateEntity *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_DATETIME_TIME
+  void on_time_update(datetime::TimeEntity *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_DATETIME_DATETIME
+  void on_datetime_update(datetime::DateTimeEntity *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_TEXT
+  void on_text_update(text::Text *obj, const std::string &state) override { this->on_state_(); }
+#endif
+#ifdef USE_SELECT
+  void on_select_update(select::Select *obj, const std::string &state, size_t index) override { this->on_state_(); }
+#endif
+#ifdef USE_LOCK
+  void on_lock_update(lock::Lock *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_VALVE
+  void on_valve_update(valve::Valve *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_MEDIA_PLAYER
+  void on_media_player_update(media_player::MediaPlayer *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  void on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) override { this->on_state_(); }
+#endif
+#ifdef USE_EVENT
+  void on_event(event::Event *obj, const std::string &event_type) override { this->on_state_(); }
+#endif
+#ifdef USE_UPDATE
+  void on_update(update::UpdateEntity *obj) override { this->on_state_(); }
+#endif
+
+ protected:
+  void on_state_() { this->record_once(BOOT_EVENT_FIRST_STATE); }
+
+  std::array<BootEvent, BOOT_TIMELINE_MAX_EVENTS> events_{};
+  uint32_t dropped_{0};
+  uint16_t count_{0};
+  // Bit per BootEventType already recorded by record_once()
+  uint8_t once_seen_{0};
+};
+
+}  // namespace boot_timeline
+
+extern boot_timeline::BootTimeline *global_boot_timeline;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_BOOT_TIMELINE
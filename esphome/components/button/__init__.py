@@ -18,7 +18,11 @@ from esphome.const import (
     DEVICE_CLASS_UPDATE,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
-from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
+from esphome.core.entity_helpers import (
+    entity_duplicate_validator,
+    entity_string,
+    setup_entity,
+)
 from esphome.cpp_generator import MockObjClass
 
 CODEOWNERS = ["@esphome/core"]
@@ -97,7 +101,7 @@ async def setup_button_core_(var, config):
         await automation.build_automation(trigger, [], conf)
 
     if device_class := config.get(CONF_DEVICE_CLASS):
-        cg.add(var.set_device_class(device_class))
+        cg.add(var.set_device_class(entity_string(device_class)))
 
     if mqtt_id := config.get(CONF_MQTT_ID):
         mqtt_ = cg.new_Pvariable(mqtt_id, var)
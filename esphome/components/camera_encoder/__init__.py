@@ -1,5 +1,6 @@
 import esphome.codegen as cg
-from esphome.components.esp32 import add_idf_component
+from esphome.components.esp32 import add_idf_component, only_on_variant
+from esphome.components.esp32.const import VARIANT_ESP32P4
 import esphome.config_validation as cv
 from esphome.const import CONF_BUFFER_SIZE, CONF_ID, CONF_TYPE
 from esphome.core import CORE
@@ -14,6 +15,7 @@ CONF_ENCODER_BUFFER_ID = "encoder_buffer_id"
 CONF_QUALITY = "quality"
 
 ESP32_CAMERA_ENCODER = "esp32_camera"
+ESP32_HARDWARE_ENCODER = "esp32_hardware"
 
 camera_ns = cg.esphome_ns.namespace("camera")
 camera_encoder_ns = cg.esphome_ns.namespace("camera_encoder")
@@ -22,6 +24,7 @@ Encoder = camera_ns.class_("Encoder")
 EncoderBufferImpl = camera_encoder_ns.class_("EncoderBufferImpl")
 
 ESP32CameraJPEGEncoder = camera_encoder_ns.class_("ESP32CameraJPEGEncoder", Encoder)
+ESP32HardwareJPEGEncoder = camera_encoder_ns.class_("ESP32HardwareJPEGEncoder", Encoder)
 
 MAX_JPEG_BUFFER_SIZE_2MB = 2 * 1024 * 1024
 
@@ -39,9 +42,25 @@ ESP32_CAMERA_ENCODER_SCHEMA = cv.Schema(
     }
 )
 
+ESP32_HARDWARE_ENCODER_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ESP32HardwareJPEGEncoder),
+            cv.Optional(CONF_QUALITY, default=80): cv.int_range(1, 100),
+            cv.Optional(CONF_BUFFER_SIZE, default=4096): cv.int_range(
+                1024, MAX_JPEG_BUFFER_SIZE_2MB
+            ),
+            cv.GenerateID(CONF_ENCODER_BUFFER_ID): cv.declare_id(EncoderBufferImpl),
+        }
+    ),
+    only_on_variant(supported=[VARIANT_ESP32P4]),
+    cv.only_with_esp_idf,
+)
+
 CONFIG_SCHEMA = cv.typed_schema(
     {
         ESP32_CAMERA_ENCODER: ESP32_CAMERA_ENCODER_SCHEMA,
+        ESP32_HARDWARE_ENCODER: ESP32_HARDWARE_ENCODER_SCHEMA,
     },
     default_type=ESP32_CAMERA_ENCODER,
 )
@@ -60,3 +79,10 @@ async def to_code(config: ConfigType) -> None:
             buffer,
         )
         cg.add(var.set_buffer_expand_size(config[CONF_BUFFER_EXPAND_SIZE]))
+    elif config[CONF_TYPE] == ESP32_HARDWARE_ENCODER:
+        cg.add_build_flag("-DUSE_ESP32_HARDWARE_JPEG_ENCODER")
+        cg.new_Pvariable(
+            config[CONF_ID],
+            config[CONF_QUALITY],
+            buffer,
+        )
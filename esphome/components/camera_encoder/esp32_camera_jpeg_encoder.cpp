@@ -12,6 +12,15 @@ ESP32CameraJPEGEncoder::ESP32CameraJPEGEncoder(uint8_t quality, camera::EncoderB
 }
 
 camera::EncoderError ESP32CameraJPEGEncoder::encode_pixels(camera::CameraImageSpec *spec, camera::Buffer *pixels) {
+  // Growing the buffer up front is cheaper than running out of space and encoding the frame again
+  const size_t expected_size = this->estimator_.expected_size(spec, this->quality_);
+  if (this->output_->get_max_size() < expected_size) {
+    const size_t current_size = this->output_->get_max_size();
+    if (this->output_->set_buffer_size(expected_size)) {
+      ESP_LOGD(TAG, "Output buffer resized for the expected frame size (%zu -> %zu).", current_size, expected_size);
+    }
+  }
+
   this->bytes_written_ = 0;
   this->out_of_output_memory_ = false;
   bool success = fmt2jpg_cb(pixels->get_data_buffer(), pixels->get_data_length(), spec->width, spec->height,
@@ -36,6 +45,7 @@ camera::EncoderError ESP32CameraJPEGEncoder::encode_pixels(camera::CameraImageSp
     return camera::ENCODER_ERROR_RETRY_FRAME;
   }
 
+  this->estimator_.record(this->bytes_written_);
   this->output_->set_buffer_size(this->bytes_written_);
   return camera::ENCODER_ERROR_SUCCESS;
 }
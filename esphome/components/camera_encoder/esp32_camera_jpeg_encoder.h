@@ -6,6 +6,8 @@
 
 #include "esphome/components/camera/encoder.h"
 
+#include "jpeg_output_estimator.h"
+
 namespace esphome::camera_encoder {
 
 /// Encoder that uses the software-based JPEG implementation from Espressif's esp32-camera component.
@@ -27,6 +29,7 @@ class ESP32CameraJPEGEncoder : public camera::Encoder {
   static size_t callback_(void *arg, size_t index, const void *data, size_t len);
   pixformat_t to_internal_(camera::PixelFormat format);
 
+  JPEGOutputEstimator estimator_;
   camera::EncoderBuffer *output_{};
   size_t buffer_expand_size_{};
   size_t bytes_written_{};
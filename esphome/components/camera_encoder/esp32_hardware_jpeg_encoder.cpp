@@ -0,0 +1,130 @@
+#ifdef USE_ESP32_HARDWARE_JPEG_ENCODER
+
+#include "esp32_hardware_jpeg_encoder.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "esphome/core/log.h"
+
+namespace esphome::camera_encoder {
+
+static const char *const TAG = "camera_encoder";
+
+static const int ENCODE_TIMEOUT_MS = 100;
+/// DMA buffers have to start on a cache line, pixels that don't are copied to the encoder's input buffer first.
+static const uintptr_t DMA_ALIGNMENT = 128;
+
+ESP32HardwareJPEGEncoder::ESP32HardwareJPEGEncoder(uint8_t quality, camera::EncoderBuffer *output) {
+  this->quality_ = quality;
+  this->output_ = output;
+}
+
+ESP32HardwareJPEGEncoder::~ESP32HardwareJPEGEncoder() {
+  if (this->engine_ != nullptr)
+    jpeg_del_encoder_engine(this->engine_);
+  free(this->input_);  // NOLINT(cppcoreguidelines-no-malloc)
+  free(this->jpeg_);   // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+bool ESP32HardwareJPEGEncoder::reserve_dma_buffer_(uint8_t **buffer, size_t *capacity, size_t size,
+                                                   jpeg_enc_buffer_alloc_direction_t direction) {
+  if (*capacity >= size)
+    return true;
+
+  free(*buffer);  // NOLINT(cppcoreguidelines-no-malloc)
+  *capacity = 0;
+  jpeg_encode_memory_alloc_cfg_t mem_config = {};
+  mem_config.buffer_direction = direction;
+  *buffer = static_cast<uint8_t *>(jpeg_alloc_encoder_mem(size, &mem_config, capacity));
+  if (*buffer == nullptr) {
+    *capacity = 0;
+    return false;
+  }
+  return true;
+}
+
+camera::EncoderError ESP32HardwareJPEGEncoder::encode_pixels(camera::CameraImageSpec *spec, camera::Buffer *pixels) {
+  if (this->engine_ == nullptr) {
+    jpeg_encode_engine_cfg_t engine_config = {};
+    engine_config.timeout_ms = ENCODE_TIMEOUT_MS;
+    if (jpeg_new_encoder_engine(&engine_config, &this->engine_) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to create the JPEG encoder engine.");
+      this->engine_ = nullptr;
+      return camera::ENCODER_ERROR_CONFIGURATION;
+    }
+  }
+
+  jpeg_encode_cfg_t config = {};
+  config.width = spec->width;
+  config.height = spec->height;
+  config.image_quality = this->quality_;
+  switch (spec->format) {
+    case camera::PIXEL_FORMAT_GRAYSCALE:
+      config.src_type = JPEG_ENCODE_IN_FORMAT_GRAY;
+      config.sub_sample = JPEG_DOWN_SAMPLING_GRAY;
+      break;
+    case camera::PIXEL_FORMAT_RGB565:
+      config.src_type = JPEG_ENCODE_IN_FORMAT_RGB565;
+      config.sub_sample = JPEG_DOWN_SAMPLING_YUV420;
+      break;
+    // The peripheral reads RGB888 in the same B, G, R byte order
+    case camera::PIXEL_FORMAT_BGR888:
+      config.src_type = JPEG_ENCODE_IN_FORMAT_RGB888;
+      config.sub_sample = JPEG_DOWN_SAMPLING_YUV420;
+      break;
+  }
+
+  const uint8_t *input = pixels->get_data_buffer();
+  const size_t input_size = pixels->get_data_length();
+  if (reinterpret_cast<uintptr_t>(input) % DMA_ALIGNMENT != 0) {
+    if (!reserve_dma_buffer_(&this->input_, &this->input_capacity_, input_size, JPEG_ENC_ALLOC_INPUT_BUFFER)) {
+      ESP_LOGE(TAG, "Failed to allocate the input buffer.");
+      return camera::ENCODER_ERROR_SKIP_FRAME;
+    }
+    std::memcpy(this->input_, input, input_size);
+    input = this->input_;
+  }
+
+  if (!reserve_dma_buffer_(&this->jpeg_, &this->jpeg_capacity_, this->estimator_.expected_size(spec, this->quality_),
+                           JPEG_ENC_ALLOC_OUTPUT_BUFFER)) {
+    ESP_LOGE(TAG, "Failed to allocate the JPEG buffer.");
+    return camera::ENCODER_ERROR_SKIP_FRAME;
+  }
+
+  uint32_t jpeg_size = 0;
+  esp_err_t err = jpeg_encoder_process(this->engine_, &config, input, input_size, this->jpeg_, this->jpeg_capacity_,
+                                       &jpeg_size);
+  if (err == ESP_ERR_INVALID_SIZE) {
+    // The frame did not fit, grow the buffer by half and try again
+    const size_t new_size = this->jpeg_capacity_ + this->jpeg_capacity_ / 2;
+    ESP_LOGD(TAG, "JPEG buffer too small (%zu -> %zu).", this->jpeg_capacity_, new_size);
+    if (!reserve_dma_buffer_(&this->jpeg_, &this->jpeg_capacity_, new_size, JPEG_ENC_ALLOC_OUTPUT_BUFFER))
+      return camera::ENCODER_ERROR_SKIP_FRAME;
+    return camera::ENCODER_ERROR_RETRY_FRAME;
+  }
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Encoding failed: %s", esp_err_to_name(err));
+    return camera::ENCODER_ERROR_SKIP_FRAME;
+  }
+
+  this->estimator_.record(jpeg_size);
+  if (!this->output_->set_buffer_size(jpeg_size)) {
+    ESP_LOGE(TAG, "Failed to expand output buffer.");
+    return camera::ENCODER_ERROR_SKIP_FRAME;
+  }
+  std::memcpy(this->output_->get_data(), this->jpeg_, jpeg_size);
+  return camera::ENCODER_ERROR_SUCCESS;
+}
+
+void ESP32HardwareJPEGEncoder::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ESP32 Hardware JPEG Encoder:\n"
+                "  Size: %zu\n"
+                "  Quality: %d",
+                this->output_->get_max_size(), this->quality_);
+}
+
+}  // namespace esphome::camera_encoder
+
+#endif
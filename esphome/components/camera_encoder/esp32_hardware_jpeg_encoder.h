@@ -0,0 +1,46 @@
+#pragma once
+
+#ifdef USE_ESP32_HARDWARE_JPEG_ENCODER
+
+#include <driver/jpeg_encode.h>
+
+#include "esphome/components/camera/encoder.h"
+
+#include "jpeg_output_estimator.h"
+
+namespace esphome::camera_encoder {
+
+/// Encoder that uses the JPEG encoder peripheral of the ESP32-P4.
+///
+/// The peripheral reads and writes through DMA, so the encoder keeps its own DMA capable buffers sized from the
+/// expected frame size and copies the finished JPEG into the output buffer.
+class ESP32HardwareJPEGEncoder : public camera::Encoder {
+ public:
+  /// Constructs a ESP32HardwareJPEGEncoder instance.
+  /// @param quality Sets the quality of the encoded image (1-100).
+  /// @param output Pointer to preallocated output buffer.
+  ESP32HardwareJPEGEncoder(uint8_t quality, camera::EncoderBuffer *output);
+  ~ESP32HardwareJPEGEncoder() override;
+  // -------- Encoder --------
+  camera::EncoderError encode_pixels(camera::CameraImageSpec *spec, camera::Buffer *pixels) override;
+  camera::EncoderBuffer *get_output_buffer() override { return output_; }
+  void dump_config() override;
+  // -------------------------
+ protected:
+  /// Makes sure a DMA buffer holds at least ``size`` bytes, reallocating it if not.
+  static bool reserve_dma_buffer_(uint8_t **buffer, size_t *capacity, size_t size,
+                                  jpeg_enc_buffer_alloc_direction_t direction);
+
+  JPEGOutputEstimator estimator_;
+  camera::EncoderBuffer *output_{};
+  jpeg_encoder_handle_t engine_{};
+  uint8_t *input_{};
+  size_t input_capacity_{};
+  uint8_t *jpeg_{};
+  size_t jpeg_capacity_{};
+  uint8_t quality_{};
+};
+
+}  // namespace esphome::camera_encoder
+
+#endif
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+
+#include "esphome/components/camera/camera.h"
+
+namespace esphome::camera_encoder {
+
+/// Estimates how large the JPEG of the next frame gets, so the output buffer can be sized before encoding instead of
+/// growing it and encoding the frame again.
+///
+/// Without history the estimate comes from the resolution and quality. After that it follows the largest recent
+/// frame, which slowly decays so a single busy scene does not keep the buffer large forever.
+class JPEGOutputEstimator {
+ public:
+  /// Returns the output buffer size that likely fits the next frame, including some headroom.
+  size_t expected_size(camera::CameraImageSpec *spec, uint8_t quality) {
+    if ((spec->width != this->width_) || (spec->height != this->height_) || (spec->format != this->format_)) {
+      this->width_ = spec->width;
+      this->height_ = spec->height;
+      this->format_ = spec->format;
+      this->largest_size_ = 0;
+    }
+
+    size_t size = this->largest_size_;
+    if (size == 0) {
+      // Between 1 and 4 bits per pixel depending on quality, color images need about twice as much as grayscale
+      const size_t pixels = static_cast<size_t>(spec->width) * spec->height;
+      const size_t tenth_bits_per_pixel = 10 + 30 * quality * quality / 10000;
+      size = pixels * tenth_bits_per_pixel / 80;
+      if (spec->format == camera::PIXEL_FORMAT_GRAYSCALE)
+        size /= 2;
+      size += HEADER_SIZE;
+    }
+
+    return size + size * HEADROOM_PERCENT / 100;
+  }
+
+  /// Records the size of an encoded frame.
+  void record(size_t size) {
+    this->largest_size_ = std::max(size, this->largest_size_ - this->largest_size_ / DECAY_DIVISOR);
+  }
+
+ protected:
+  static constexpr size_t HEADER_SIZE = 1024;
+  static constexpr size_t HEADROOM_PERCENT = 25;
+  /// The largest size shrinks by 1/DECAY_DIVISOR with every smaller frame.
+  static constexpr size_t DECAY_DIVISOR = 32;
+
+  uint16_t width_{0};
+  uint16_t height_{0};
+  camera::PixelFormat format_{camera::PIXEL_FORMAT_GRAYSCALE};
+  size_t largest_size_{0};
+};
+
+}  // namespace esphome::camera_encoder
@@ -1,6 +1,8 @@
 #include "canbus.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace canbus {
 
@@ -21,11 +23,11 @@ void Canbus::dump_config() {
   }
 }
 
-void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request,
-                       const std::vector<uint8_t> &data) {
+void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request, const uint8_t *data,
+                       size_t len) {
   struct CanFrame can_message;
 
-  uint8_t size = static_cast<uint8_t>(data.size());
+  uint8_t size = static_cast<uint8_t>(len);
   if (use_extended_id) {
     ESP_LOGD(TAG, "send extended id=0x%08" PRIx32 " rtr=%s size=%d", can_id, TRUEFALSE(remote_transmission_request),
              size);
@@ -69,24 +71,36 @@ void Canbus::loop() {
   int message_counter = 0;
   while (this->read_message(&can_message) == canbus::ERROR_OK) {
     message_counter++;
+    // Busy buses deliver hundreds of frames per second, so these are not logged at debug level
     if (can_message.use_extended_id) {
-      ESP_LOGD(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
+      ESP_LOGV(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
                can_message.can_id, can_message.can_data_length_code);
     } else {
-      ESP_LOGD(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
+      ESP_LOGV(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
                can_message.can_data_length_code);
     }
 
-    std::vector<uint8_t> data;
-
+    const uint8_t size = std::min(can_message.can_data_length_code, CAN_MAX_DATA_LENGTH);
     // show data received
-    for (int i = 0; i < can_message.can_data_length_code; i++) {
-      ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
+    for (int i = 0; i < size; i++) {
+      ESP_LOGVV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
     }
 
-    this->callback_manager_(can_message.can_id, can_message.use_extended_id, can_message.remote_transmission_request,
-                            data);
+    // The payload is only copied for frames somebody listens to
+    std::vector<uint8_t> data;
+    bool has_data = false;
+    auto get_data = [&]() -> const std::vector<uint8_t> & {
+      if (!has_data) {
+        data.assign(can_message.data, can_message.data + size);
+        has_data = true;
+      }
+      return data;
+    };
+
+    if (this->callback_manager_.size() > 0) {
+      this->callback_manager_(can_message.can_id, can_message.use_extended_id, can_message.remote_transmission_request,
+                              get_data());
+    }
 
     // fire all triggers
     for (auto *trigger : this->triggers_) {
@@ -94,7 +108,7 @@ void Canbus::loop() {
           (trigger->use_extended_id_ == can_message.use_extended_id) &&
           (!trigger->remote_transmission_request_.has_value() ||
            trigger->remote_transmission_request_.value() == can_message.remote_transmission_request)) {
-        trigger->trigger(data, can_message.can_id, can_message.remote_transmission_request);
+        trigger->trigger(get_data(), can_message.can_id, can_message.remote_transmission_request);
       }
     }
   }
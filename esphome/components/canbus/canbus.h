@@ -70,8 +70,12 @@ class Canbus : public Component {
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
   void loop() override;
 
+  void send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request, const uint8_t *data,
+                 size_t len);
   void send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request,
-                 const std::vector<uint8_t> &data);
+                 const std::vector<uint8_t> &data) {
+    this->send_data(can_id, use_extended_id, remote_transmission_request, data.data(), data.size());
+  }
   void send_data(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data) {
     // for backwards compatibility only
     this->send_data(can_id, use_extended_id, false, data);
@@ -33,7 +33,11 @@ from esphome.const import (
     DEVICE_CLASS_WINDOW,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
-from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
+from esphome.core.entity_helpers import (
+    entity_duplicate_validator,
+    entity_string,
+    setup_entity,
+)
 from esphome.cpp_generator import MockObjClass
 
 IS_PLATFORM_COMPONENT = True
@@ -160,7 +164,7 @@ async def setup_cover_core_(var, config):
     await setup_entity(var, config, "cover")
 
     if (device_class := config.get(CONF_DEVICE_CLASS)) is not None:
-        cg.add(var.set_device_class(device_class))
+        cg.add(var.set_device_class(entity_string(device_class)))
 
     for conf in config.get(CONF_ON_OPEN, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -18,6 +18,21 @@ void CTClampSensor::dump_config() {
 void CTClampSensor::update() {
   // Update only starts the sampling phase, in loop() the actual sampling is happening.
 
+  if (this->source_->start_statistics()) {
+    // The source samples in the background by itself, only pick up the result in the end
+    this->set_timeout("read", this->sample_duration_, [this]() {
+      voltage_sampler::SampleStatistics stats;
+      if (!this->source_->stop_statistics(stats) || stats.count == 0) {
+        this->publish_state(NAN);
+        return;
+      }
+      ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %" PRIu32 " samples (%" PRIu32 " SPS)", this->name_.c_str(),
+               stats.ac_rms, stats.count, 1000 * stats.count / this->sample_duration_);
+      this->publish_state(stats.ac_rms);
+    });
+    return;
+  }
+
   // Request a high loop() execution interval during sampling phase.
   this->high_freq_.start();
 
@@ -1,17 +1,36 @@
 #include "dallas_temp.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace dallas_temp {
 
 static const char *const TAG = "dallas.temp.sensor";
 
 static const uint8_t DALLAS_MODEL_DS18S20 = 0x10;
+static const uint8_t DALLAS_MODEL_DS1822 = 0x22;
+static const uint8_t DALLAS_MODEL_DS18B20 = 0x28;
+static const uint8_t DALLAS_MODEL_DS1825 = 0x3B;
+static const uint8_t DALLAS_MODEL_DS28EA00 = 0x42;
 static const uint8_t DALLAS_COMMAND_START_CONVERSION = 0x44;
 static const uint8_t DALLAS_COMMAND_READ_SCRATCH_PAD = 0xBE;
 static const uint8_t DALLAS_COMMAND_WRITE_SCRATCH_PAD = 0x4E;
 static const uint8_t DALLAS_COMMAND_COPY_SCRATCH_PAD = 0x48;
 
+static bool is_temperature_sensor(uint64_t address) {
+  switch (address & 0xff) {
+    case DALLAS_MODEL_DS18S20:
+    case DALLAS_MODEL_DS1822:
+    case DALLAS_MODEL_DS18B20:
+    case DALLAS_MODEL_DS1825:
+    case DALLAS_MODEL_DS28EA00:
+      return true;
+    default:
+      return false;
+  }
+}
+
 uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion_() const {
   switch (this->resolution_) {
     case 9:
@@ -32,7 +51,10 @@ void DallasTemperatureSensor::dump_config() {
     return;
   }
   LOG_ONE_WIRE_DEVICE(this);
-  ESP_LOGCONFIG(TAG, "  Resolution: %u bits", this->resolution_);
+  ESP_LOGCONFIG(TAG,
+                "  Resolution: %u bits\n"
+                "  Shared conversion: %s",
+                this->resolution_, YESNO(this->broadcast_conversion_));
   LOG_UPDATE_INTERVAL(this);
 }
 
@@ -42,9 +64,17 @@ void DallasTemperatureSensor::update() {
 
   this->status_clear_warning();
 
-  this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  uint32_t wait = this->millis_to_wait_for_conversion_();
+  if (this->broadcast_conversion_) {
+    // Sensors updating while a conversion is running read its result instead of starting their own
+    int32_t remaining = this->bus_->broadcast(DALLAS_COMMAND_START_CONVERSION, wait);
+    if (remaining >= 0)
+      wait = remaining;
+  } else {
+    this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  }
 
-  this->set_timeout(this->get_address_name(), this->millis_to_wait_for_conversion_(), [this] {
+  this->set_timeout(this->get_address_name(), wait, [this] {
     if (!this->read_scratch_pad_() || !this->check_scratch_pad_()) {
       this->publish_state(NAN);
       return;
@@ -72,6 +102,11 @@ bool DallasTemperatureSensor::read_scratch_pad_() {
 void DallasTemperatureSensor::setup() {
   if (!this->check_address_())
     return;
+
+  // Other devices could take Convert T for one of their own commands, so only share conversions if there are none
+  const auto &devices = this->bus_->get_devices();
+  this->broadcast_conversion_ = !devices.empty() && std::all_of(devices.begin(), devices.end(), is_temperature_sensor);
+
   if (!this->read_scratch_pad_())
     return;
   if (!this->check_scratch_pad_())
@@ -19,6 +19,8 @@ class DallasTemperatureSensor : public PollingComponent, public sensor::Sensor,
  protected:
   uint8_t resolution_;
   uint8_t scratch_pad_[9] = {0};
+  /// Whether all devices on the bus are temperature sensors, so one conversion can be started for all of them.
+  bool broadcast_conversion_{false};
 
   /// Get the number of milliseconds we have to wait for the conversion phase.
   uint16_t millis_to_wait_for_conversion_() const;
@@ -1,4 +1,5 @@
 import esphome.codegen as cg
+from esphome.components.esp32 import add_idf_sdkconfig_option
 from esphome.components.zephyr import zephyr_add_prj_conf
 from esphome.config_helpers import filter_source_files_from_platform
 import esphome.config_validation as cv
@@ -16,6 +17,7 @@ from esphome.core import CORE
 CODEOWNERS = ["@esphome/core"]
 DEPENDENCIES = ["logger"]
 
+CONF_ALLOCATION_TRACING = "allocation_tracing"
 CONF_DEBUG_ID = "debug_id"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
@@ -40,12 +42,23 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOOP_TIME): cv.invalid(
                 "The 'loop_time' option has been moved to the 'debug' sensor component"
             ),
+            cv.Optional(CONF_ALLOCATION_TRACING): cv.All(
+                cv.only_on_esp32, cv.boolean
+            ),
         }
     ).extend(cv.polling_component_schema("60s")),
 )
 
 
+def enable_allocation_tracing():
+    """Count heap allocations through the ESP-IDF heap hooks."""
+    cg.add_define("USE_DEBUG_ALLOCATION_TRACING")
+    add_idf_sdkconfig_option("CONFIG_HEAP_USE_HOOKS", True)
+
+
 async def to_code(config):
+    if config.get(CONF_ALLOCATION_TRACING):
+        enable_allocation_tracing()
     if CORE.using_zephyr:
         zephyr_add_prj_conf("HWINFO", True)
         # gdb thread support
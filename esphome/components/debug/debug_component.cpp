@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include "esphome/core/application.h"
+#include "esphome/core/arena.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -9,6 +10,10 @@
 #include <cinttypes>
 #include <climits>
 
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+#include "esphome/components/logger/logger.h"
+#endif
+
 namespace esphome {
 namespace debug {
 
@@ -23,9 +28,13 @@ void DebugComponent::dump_config() {
   LOG_SENSOR("  ", "Free space on heap", this->free_sensor_);
   LOG_SENSOR("  ", "Largest free heap block", this->block_sensor_);
   LOG_SENSOR("  ", "CPU frequency", this->cpu_frequency_sensor_);
-#if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+  LOG_SENSOR("  ", "Dropped log messages", this->dropped_log_messages_sensor_);
+#if (defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)) || defined(USE_ESP32)
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
-#endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+#endif
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+  LOG_SENSOR("  ", "Allocation rate", this->allocation_rate_sensor_);
+#endif
 #endif  // USE_SENSOR
 
   std::string device_info;
@@ -35,6 +44,10 @@ void DebugComponent::dump_config() {
 
   this->free_heap_ = get_free_heap_();
   ESP_LOGD(TAG, "Free Heap Size: %" PRIu32 " bytes", this->free_heap_);
+#ifdef ESPHOME_SETUP_ARENA
+  ESP_LOGD(TAG, "Setup arena: %u objects, %zu of %zu bytes used", global_arena.get_allocations(),
+           global_arena.get_used(), global_arena.get_reserved());
+#endif
 
   get_device_info_(device_info);
 
@@ -87,6 +100,11 @@ void DebugComponent::update() {
   if (this->cpu_frequency_sensor_ != nullptr) {
     this->cpu_frequency_sensor_->publish_state(arch_get_cpu_freq_hz());
   }
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  if (this->dropped_log_messages_sensor_ != nullptr) {
+    this->dropped_log_messages_sensor_->publish_state(logger::global_logger->get_task_log_dropped_count());
+  }
+#endif
 
 #endif  // USE_SENSOR
   update_platform_();
@@ -29,8 +29,13 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
   void set_block_sensor(sensor::Sensor *block_sensor) { block_sensor_ = block_sensor; }
-#if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+#if (defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)) || defined(USE_ESP32)
   void set_fragmentation_sensor(sensor::Sensor *fragmentation_sensor) { fragmentation_sensor_ = fragmentation_sensor; }
+#endif
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+  void set_allocation_rate_sensor(sensor::Sensor *allocation_rate_sensor) {
+    this->allocation_rate_sensor_ = allocation_rate_sensor;
+  }
 #endif
   void set_loop_time_sensor(sensor::Sensor *loop_time_sensor) { loop_time_sensor_ = loop_time_sensor; }
 #ifdef USE_ESP32
@@ -39,6 +44,9 @@ class DebugComponent : public PollingComponent {
   void set_cpu_frequency_sensor(sensor::Sensor *cpu_frequency_sensor) {
     this->cpu_frequency_sensor_ = cpu_frequency_sensor;
   }
+  void set_dropped_log_messages_sensor(sensor::Sensor *dropped_log_messages_sensor) {
+    this->dropped_log_messages_sensor_ = dropped_log_messages_sensor;
+  }
 #endif  // USE_SENSOR
 #ifdef USE_ESP32
   void on_shutdown() override;
@@ -52,14 +60,18 @@ class DebugComponent : public PollingComponent {
 
   sensor::Sensor *free_sensor_{nullptr};
   sensor::Sensor *block_sensor_{nullptr};
-#if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+#if (defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)) || defined(USE_ESP32)
   sensor::Sensor *fragmentation_sensor_{nullptr};
+#endif
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+  sensor::Sensor *allocation_rate_sensor_{nullptr};
 #endif
   sensor::Sensor *loop_time_sensor_{nullptr};
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
   sensor::Sensor *cpu_frequency_sensor_{nullptr};
+  sensor::Sensor *dropped_log_messages_sensor_{nullptr};
 #endif  // USE_SENSOR
 
 #ifdef USE_ESP32
@@ -76,6 +88,14 @@ class DebugComponent : public PollingComponent {
   void log_partition_info_();
 #endif  // USE_ESP32
 
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+  /// Logs the heap allocations since the last update, and which components made them in the main loop.
+  void log_allocations_();
+
+  uint32_t last_allocations_{0};
+  uint32_t last_allocations_time_{0};
+#endif
+
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
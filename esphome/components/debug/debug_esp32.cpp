@@ -17,11 +17,100 @@
 #include <Esp.h>
 #endif
 
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <iterator>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace debug {
 
 static const char *const TAG = "debug";
 
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+/// Allocations made while a component ran in the main loop since the last update
+struct ComponentAllocations {
+  Component *component;
+  uint32_t count;
+  uint32_t bytes;
+};
+static const size_t MAX_TRACKED_COMPONENTS = 16;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+// Counted by the heap hooks, which run in any task and in interrupts
+static std::atomic<uint32_t> total_allocations{0};
+static std::atomic<uint32_t> total_frees{0};
+// Only used from the main loop task
+static TaskHandle_t loop_task_handle{nullptr};
+static ComponentAllocations component_allocations[MAX_TRACKED_COMPONENTS]{};
+static uint32_t untracked_allocations{0};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+static void IRAM_ATTR record_allocation(size_t size) {
+  total_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (loop_task_handle == nullptr || xPortInIsrContext() || xTaskGetCurrentTaskHandle() != loop_task_handle)
+    return;
+  Component *component = App.get_current_component();
+  if (component == nullptr)
+    return;
+  for (auto &entry : component_allocations) {
+    if (entry.component == nullptr)
+      entry.component = component;
+    if (entry.component == component) {
+      entry.count++;
+      entry.bytes += size;
+      return;
+    }
+  }
+  untracked_allocations++;
+}
+
+void DebugComponent::log_allocations_() {
+  uint32_t now = millis();
+  uint32_t allocations = total_allocations.load(std::memory_order_relaxed);
+  uint32_t frees = total_frees.load(std::memory_order_relaxed);
+  if (loop_task_handle == nullptr) {
+    // The first update only starts the attribution
+    loop_task_handle = xTaskGetCurrentTaskHandle();
+    this->last_allocations_ = allocations;
+    this->last_allocations_time_ = now;
+    return;
+  }
+
+  // Copied first, logging allocates as well
+  ComponentAllocations components[MAX_TRACKED_COMPONENTS];
+  std::copy(std::begin(component_allocations), std::end(component_allocations), std::begin(components));
+  std::fill(std::begin(component_allocations), std::end(component_allocations), ComponentAllocations{});
+  uint32_t untracked = untracked_allocations;
+  untracked_allocations = 0;
+
+  uint32_t elapsed = now - this->last_allocations_time_;
+  float rate = elapsed == 0 ? 0.0f : (allocations - this->last_allocations_) * 1000.0f / elapsed;
+  this->last_allocations_ = allocations;
+  this->last_allocations_time_ = now;
+
+  ESP_LOGD(TAG, "Heap allocations: %.1f/s, %" PRIu32 " live", rate, allocations - frees);
+  for (auto &entry : components) {
+    if (entry.component == nullptr)
+      break;
+    ESP_LOGD(TAG, "  %s: %" PRIu32 " allocations, %" PRIu32 " bytes",
+             LOG_STR_ARG(entry.component->get_component_log_str()), entry.count, entry.bytes);
+  }
+  if (untracked != 0)
+    ESP_LOGD(TAG, "  Other components: %" PRIu32 " allocations", untracked);
+
+#ifdef USE_SENSOR
+  if (this->allocation_rate_sensor_ != nullptr)
+    this->allocation_rate_sensor_->publish_state(rate);
+#endif
+}
+#endif  // USE_DEBUG_ALLOCATION_TRACING
+
 // index by values returned by esp_reset_reason
 
 static const char *const RESET_REASONS[] = {
@@ -228,9 +317,29 @@ void DebugComponent::update_platform_() {
   if (this->psram_sensor_ != nullptr) {
     this->psram_sensor_->publish_state(heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
   }
+  if (this->fragmentation_sensor_ != nullptr) {
+    // Share of the free memory outside the largest block, like ESP.getHeapFragmentation() on the ESP8266
+    size_t free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    this->fragmentation_sensor_->publish_state(free == 0 ? 0.0f : 100.0f - 100.0f * largest / free);
+  }
+#endif
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+  this->log_allocations_();
 #endif
 }
 
 }  // namespace debug
 }  // namespace esphome
+
+#ifdef USE_DEBUG_ALLOCATION_TRACING
+// Called by the ESP-IDF heap with CONFIG_HEAP_USE_HOOKS
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps) {
+  esphome::debug::record_allocation(size);
+}
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void *ptr) {
+  esphome::debug::total_frees.fetch_add(1, std::memory_order_relaxed);
+}
+#endif  // USE_DEBUG_ALLOCATION_TRACING
+
 #endif  // USE_ESP32
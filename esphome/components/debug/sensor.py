@@ -9,18 +9,23 @@ from esphome.const import (
     CONF_FREE,
     CONF_LOOP_TIME,
     ENTITY_CATEGORY_DIAGNOSTIC,
+    PLATFORM_ESP32,
+    PLATFORM_ESP8266,
     ICON_COUNTER,
     ICON_TIMER,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_BYTES,
     UNIT_HERTZ,
     UNIT_MILLISECOND,
     UNIT_PERCENT,
 )
 
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, DebugComponent, enable_allocation_tracing
 
 DEPENDENCIES = ["debug"]
 
+CONF_ALLOCATION_RATE = "allocation_rate"
+CONF_DROPPED_LOG_MESSAGES = "dropped_log_messages"
 CONF_PSRAM = "psram"
 
 CONFIG_SCHEMA = {
@@ -38,8 +43,12 @@ CONFIG_SCHEMA = {
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
     cv.Optional(CONF_FRAGMENTATION): cv.All(
-        cv.only_on_esp8266,
-        cv.require_framework_version(esp8266_arduino=cv.Version(2, 5, 2)),
+        cv.only_on([PLATFORM_ESP8266, PLATFORM_ESP32]),
+        cv.require_framework_version(
+            esp8266_arduino=cv.Version(2, 5, 2),
+            esp32_arduino=cv.Version(0, 0, 0),
+            esp_idf=cv.Version(0, 0, 0),
+        ),
         sensor.sensor_schema(
             unit_of_measurement=UNIT_PERCENT,
             icon=ICON_COUNTER,
@@ -63,6 +72,25 @@ CONFIG_SCHEMA = {
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
     ),
+    cv.Optional(CONF_ALLOCATION_RATE): cv.All(
+        cv.only_on_esp32,
+        sensor.sensor_schema(
+            unit_of_measurement="allocations/s",
+            icon=ICON_COUNTER,
+            accuracy_decimals=1,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    ),
+    # Only ESP32 buffers log messages of other tasks
+    cv.Optional(CONF_DROPPED_LOG_MESSAGES): cv.All(
+        cv.only_on_esp32,
+        sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    ),
     cv.Optional(CONF_CPU_FREQUENCY): cv.All(
         sensor.sensor_schema(
             unit_of_measurement=UNIT_HERTZ,
@@ -97,6 +125,15 @@ async def to_code(config):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
 
+    if allocation_rate_conf := config.get(CONF_ALLOCATION_RATE):
+        enable_allocation_tracing()
+        sens = await sensor.new_sensor(allocation_rate_conf)
+        cg.add(debug_component.set_allocation_rate_sensor(sens))
+
+    if dropped_conf := config.get(CONF_DROPPED_LOG_MESSAGES):
+        sens = await sensor.new_sensor(dropped_conf)
+        cg.add(debug_component.set_dropped_log_messages_sensor(sens))
+
     if cpu_freq_conf := config.get(CONF_CPU_FREQUENCY):
         sens = await sensor.new_sensor(cpu_freq_conf)
         cg.add(debug_component.set_cpu_frequency_sensor(sens))
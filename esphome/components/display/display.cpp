@@ -86,11 +86,11 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+void HOT Display::fill_span(int x, int y, int width, Color color) {
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -103,9 +103,8 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+    this->fill_span(x1, i, width, color);
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
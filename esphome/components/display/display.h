@@ -228,6 +228,12 @@ class Display : public PollingComponent {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Set the pixels from [x,y] to [x+width-1,y] to the given color.
+   * All filled shapes are drawn as spans. The naive implementation here draws the pixels one by one, displays
+   * with a buffer override it to clip the span and convert the color only once.
+   */
+  virtual void fill_span(int x, int y, int width, Color color);
+
   /** Given an array of pixels encoded in the nominated format, draw these into the display's buffer.
    * The naive implementation here will work in all cases, but can be overridden by sub-classes
    * in order to optimise the procedure.
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -68,5 +69,45 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  int x_end = std::min(x + width, this->get_width());
+  x = std::max(x, 0);
+  if (y < 0 || y >= this->get_height())
+    return;
+  auto clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    if (y < clipping.y || y >= clipping.y2())
+      return;
+    x = std::max(x, (int) clipping.x);
+    x_end = std::min(x_end, (int) clipping.x2());
+  }
+  if (x >= x_end)
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_absolute_span_internal(x, y, x_end - x, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      for (int i = x; i != x_end; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, i, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_absolute_span_internal(this->get_width_internal() - x_end, this->get_height_internal() - y - 1,
+                                        x_end - x, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = x; i != x_end; i++)
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_absolute_span_internal(int x, int y, int width, Color color) {
+  for (int i = x; i != x + width; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+
 }  // namespace display
 }  // namespace esphome
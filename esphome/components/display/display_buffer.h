@@ -22,8 +22,13 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  void fill_span(int x, int y, int width, Color color) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /// Set width pixels of a row in display coordinates, already clipped to the display. Drivers can override this to
+  /// convert the color once and write the whole span into their buffer.
+  virtual void fill_absolute_span_internal(int x, int y, int width, Color color);
 
   void init_internal_(uint32_t buffer_length);
 
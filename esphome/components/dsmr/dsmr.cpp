@@ -3,15 +3,18 @@
 #include "dsmr.h"
 #include "esphome/core/log.h"
 
-#include <AES.h>
 #include <Crypto.h>
-#include <GCM.h>
+
+#include <algorithm>
 
 namespace esphome {
 namespace dsmr {
 
 static const char *const TAG = "dsmr";
 
+static const size_t CRYPT_HEADER_LEN = 18;
+static const size_t CRYPT_TAG_LEN = 12;
+
 void Dsmr::setup() {
   this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
   if (this->request_pin_ != nullptr) {
@@ -189,11 +192,47 @@ void Dsmr::receive_telegram_() {
 
 void Dsmr::receive_encrypted_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
+    // Once the header is complete, the ciphertext is decrypted in place as it comes in,
+    // so the encrypted telegram never has to be stored as a whole.
+    if (this->crypt_bytes_read_ >= CRYPT_HEADER_LEN) {
+      const size_t ciphertext_end = this->crypt_telegram_len_ - CRYPT_TAG_LEN;
+      if (this->crypt_bytes_read_ < ciphertext_end) {
+        const size_t len = std::min<size_t>(this->available(), ciphertext_end - this->crypt_bytes_read_);
+        auto *data = reinterpret_cast<uint8_t *>(this->telegram_ + this->bytes_read_);
+        if (!this->read_array(data, len)) {
+          this->reset_telegram_();
+          return;
+        }
+        this->gcm_->decrypt(data, data, len);
+        this->bytes_read_ += len;
+        this->crypt_bytes_read_ += len;
+      } else {
+        // Skip the authentication tag.
+        this->read();
+        this->crypt_bytes_read_++;
+      }
+
+      // Check for the end of the encrypted telegram.
+      if (this->crypt_bytes_read_ != this->crypt_telegram_len_) {
+        continue;
+      }
+      ESP_LOGV(TAG, "End of encrypted telegram found");
+
+      this->bytes_read_ = strnlen(this->telegram_, this->bytes_read_);
+      ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
+      ESP_LOGVV(TAG, "Decrypted telegram: %.*s", this->bytes_read_, this->telegram_);
+
+      // Parse the decrypted telegram and publish sensor values.
+      this->parse_telegram();
+      this->reset_telegram_();
+      return;
+    }
+
+    const uint8_t c = this->read();
 
     // Find a new telegram start byte.
     if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
+      if (c != 0xDB) {
         continue;
       }
       ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
@@ -201,54 +240,31 @@ void Dsmr::receive_encrypted_telegram_() {
       this->header_found_ = true;
     }
 
+    // Store the byte in the header.
+    this->crypt_header_[this->crypt_bytes_read_] = c;
+    this->crypt_bytes_read_++;
+    if (this->crypt_bytes_read_ < CRYPT_HEADER_LEN) {
+      continue;
+    }
+
+    // Read the length of the incoming encrypted telegram: complete header + data bytes.
+    this->crypt_telegram_len_ = 13 + (this->crypt_header_[11] << 8 | this->crypt_header_[12]);
+    ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+
     // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
+    if (this->crypt_telegram_len_ < CRYPT_HEADER_LEN + CRYPT_TAG_LEN ||
+        this->crypt_telegram_len_ - CRYPT_HEADER_LEN - CRYPT_TAG_LEN > this->max_telegram_len_) {
       this->reset_telegram_();
       ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
       return;
     }
 
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
-    this->crypt_bytes_read_++;
-
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
-      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
-    }
-
-    // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
-      continue;
-    }
-    ESP_LOGV(TAG, "End of encrypted telegram found");
-
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
     // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
+    // system title is at byte 2 and frame counter at byte 14
     for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
+      this->crypt_header_[i] = this->crypt_header_[i + 4];
     constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
-    this->reset_telegram_();
-    return;
+    this->gcm_->setIV(&this->crypt_header_[2], iv_size);
   }
 }
 
@@ -301,9 +317,9 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
   if (decryption_key.empty()) {
     ESP_LOGI(TAG, "Disabling decryption");
     this->decryption_key_.clear();
-    if (this->crypt_telegram_ != nullptr) {
-      delete[] this->crypt_telegram_;
-      this->crypt_telegram_ = nullptr;
+    if (this->gcm_ != nullptr) {
+      delete this->gcm_;  // NOLINT(cppcoreguidelines-owning-memory)
+      this->gcm_ = nullptr;
     }
     return;
   }
@@ -324,9 +340,10 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
     this->decryption_key_.push_back(std::strtoul(temp, nullptr, 16));
   }
 
-  if (this->crypt_telegram_ == nullptr) {
-    this->crypt_telegram_ = new uint8_t[this->max_telegram_len_];  // NOLINT
+  if (this->gcm_ == nullptr) {
+    this->gcm_ = new GCM<AES128>();  // NOLINT(cppcoreguidelines-owning-memory)
   }
+  this->gcm_->setKey(this->decryption_key_.data(), this->gcm_->keySize());
 }
 
 }  // namespace dsmr
@@ -13,6 +13,9 @@
 #include <dsmr/parser.h>
 #include <dsmr/fields.h>
 
+#include <AES.h>
+#include <GCM.h>
+
 #include <vector>
 
 namespace esphome {
@@ -120,7 +123,8 @@ class Dsmr : public Component, public uart::UARTDevice {
   size_t max_telegram_len_;
   char *telegram_{nullptr};
   size_t bytes_read_{0};
-  uint8_t *crypt_telegram_{nullptr};
+  /// Header of the encrypted telegram: start byte, system title, length, security byte and frame counter.
+  uint8_t crypt_header_[18]{};
   size_t crypt_telegram_len_{0};
   size_t crypt_bytes_read_{0};
   uint32_t last_read_time_{0};
@@ -138,6 +142,7 @@ class Dsmr : public Component, public uart::UARTDevice {
   DSMR_TEXT_SENSOR_LIST(DSMR_DECLARE_TEXT_SENSOR, )
 
   std::vector<uint8_t> decryption_key_{};
+  GCM<AES128> *gcm_{nullptr};
   bool crc_check_;
 };
 }  // namespace dsmr
@@ -8,6 +8,9 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
+/// Packets handled per socket and loop, enough for a frame of many universes without stalling other components.
+static const int MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -15,63 +18,91 @@ E131Component::~E131Component() {
   if (this->socket_) {
     this->socket_->close();
   }
+  if (this->ddp_socket_) {
+    this->ddp_socket_->close();
+  }
 }
 
-void E131Component::setup() {
-  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+std::unique_ptr<socket::Socket> E131Component::open_socket_(uint16_t port) {
+  auto sock = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
 
   int enable = 1;
-  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  int err = sock->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
     // we can still continue
   }
-  err = this->socket_->setblocking(false);
+  err = sock->setblocking(false);
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
   struct sockaddr_storage server;
 
-  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), port);
   if (sl == 0) {
     ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
-  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  err = sock->bind((struct sockaddr *) &server, sizeof(server));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    return nullptr;
+  }
+  return sock;
+}
+
+void E131Component::setup() {
+  this->socket_ = this->open_socket_(PORT);
+  if (this->socket_ == nullptr) {
     this->mark_failed();
     return;
   }
+  if (this->ddp_) {
+    this->ddp_socket_ = this->open_socket_(DDP_PORT);
+    if (this->ddp_socket_ == nullptr) {
+      this->mark_failed();
+      return;
+    }
+  }
 
   join_igmp_groups_();
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
   uint8_t buf[1460];
-
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
+  ssize_t len;
+
+  // The packets are parsed where they were received, and all that arrived since the last loop are handled
+  for (int i = 0; i != MAX_PACKETS_PER_LOOP && (len = this->socket_->read(buf, sizeof(buf))) > 0; i++) {
+    if (!this->packet_(buf, len, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    if (!this->process_(universe, packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    }
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
+  if (this->ddp_socket_ == nullptr)
     return;
-  }
-
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  for (int i = 0; i != MAX_PACKETS_PER_LOOP && (len = this->ddp_socket_->read(buf, sizeof(buf))) > 0; i++) {
+    uint32_t offset;
+    const uint8_t *values;
+    size_t count;
+    if (!this->ddp_packet_(buf, len, offset, values, count)) {
+      ESP_LOGV(TAG, "Invalid DDP packet received of size %zd.", len);
+      continue;
+    }
+
+    if (!this->process_ddp_(offset, values, count)) {
+      ESP_LOGV(TAG, "Ignored DDP packet for channels %" PRIu32 "-%" PRIu32 ".", offset, offset + (uint32_t) count);
+    }
   }
 }
 
@@ -117,6 +148,18 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+bool E131Component::process_ddp_(uint32_t offset, const uint8_t *values, size_t count) {
+  bool handled = false;
+
+  ESP_LOGV(TAG, "Received DDP packet for offset %" PRIu32 ", with %zu bytes", offset, count);
+
+  for (auto *light_effect : light_effects_) {
+    handled = light_effect->process_ddp_(offset, values, count) || handled;
+  }
+
+  return handled;
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
@@ -21,7 +21,8 @@ const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  /// Points into the received datagram, valid until the next one is read.
+  const uint8_t *values;
 };
 
 class E131Component : public esphome::Component {
@@ -37,16 +38,22 @@ class E131Component : public esphome::Component {
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  std::unique_ptr<socket::Socket> open_socket_(uint16_t port);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
+  bool ddp_packet_(const uint8_t *data, size_t len, uint32_t &offset, const uint8_t *&values, size_t &count);
+  bool process_ddp_(uint32_t offset, const uint8_t *values, size_t count);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
   std::unique_ptr<socket::Socket> socket_;
+  bool ddp_{false};
+  std::unique_ptr<socket::Socket> ddp_socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
   std::map<int, E131Packet> universe_packets_;
@@ -7,7 +7,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = (E131_MAX_PROPERTY_VALUES_COUNT - 1);
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -25,6 +25,8 @@ int E131AddressableLightEffect::get_universe_count() const {
   return (get_addressable_()->size() + lights - 1) / lights;
 }
 
+uint32_t E131AddressableLightEffect::get_ddp_offset() const { return (first_universe_ - 1) * get_data_per_universe(); }
+
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
@@ -61,6 +63,38 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
            output_offset, output_end);
 
+  this->write_lights_(output_offset, output_end, input_data);
+  it->schedule_show();
+  return true;
+}
+
+bool E131AddressableLightEffect::process_ddp_(uint32_t offset, const uint8_t *values, size_t count) {
+  auto *it = get_addressable_();
+  const uint32_t start = get_ddp_offset();
+  const uint32_t end = start + it->size() * channels_;
+
+  // check if the packet covers any of our channels
+  if (offset + count <= start || offset >= end)
+    return false;
+
+  // only whole lights are set, the start of a light split over two packets is skipped
+  uint32_t first_channel = std::max(offset, start);
+  int32_t output_offset = (first_channel - start + channels_ - 1) / channels_;
+  int32_t output_end = (std::min<uint32_t>(offset + count, end) - start) / channels_;
+  if (output_offset >= output_end)
+    return false;
+
+  ESP_LOGV(TAG, "Applying DDP data for '%s', for %" PRId32 "-%" PRId32 ".", get_name().c_str(), output_offset,
+           output_end);
+
+  this->write_lights_(output_offset, output_end, values + (start + output_offset * channels_ - offset));
+  it->schedule_show();
+  return true;
+}
+
+void E131AddressableLightEffect::write_lights_(int32_t output_offset, int32_t output_end, const uint8_t *input_data) {
+  auto *it = get_addressable_();
+
   switch (channels_) {
     case E131_MONO:
       for (; output_offset < output_end; output_offset++, input_data++) {
@@ -84,9 +118,6 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
       }
       break;
   }
-
-  it->schedule_show();
-  return true;
 }
 
 }  // namespace e131
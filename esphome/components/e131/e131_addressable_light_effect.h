@@ -24,6 +24,8 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   int get_first_universe() const;
   int get_last_universe() const;
   int get_universe_count() const;
+  /// First channel of the light in the DDP channel space, where universes follow each other without gaps.
+  uint32_t get_ddp_offset() const;
 
   void set_first_universe(int universe) { this->first_universe_ = universe; }
   void set_channels(E131LightChannels channels) { this->channels_ = channels; }
@@ -31,6 +33,9 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  bool process_ddp_(uint32_t offset, const uint8_t *values, size_t count);
+  /// Set the lights from `output_offset` up to `output_end` from channel data.
+  void write_lights_(int32_t output_offset, int32_t output_end, const uint8_t *input_data);
 
   int first_universe_{0};
   int last_universe_{0};
@@ -21,6 +21,15 @@ static const uint32_t VECTOR_ROOT = 4;
 static const uint32_t VECTOR_FRAME = 2;
 static const uint8_t VECTOR_DMP = 2;
 
+// DDP header, optionally followed by a timecode
+static const size_t DDP_HEADER_SIZE = 10;
+static const size_t DDP_TIMECODE_SIZE = 4;
+static const uint8_t DDP_FLAGS_VERSION_MASK = 0xC0;
+static const uint8_t DDP_FLAGS_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAGS_TIMECODE = 0x10;
+static const uint8_t DDP_FLAGS_QUERY = 0x08;
+static const uint8_t DDP_ID_DISPLAY = 1;
+
 // E1.31 Packet Structure
 union E131RawPacket {
   struct {
@@ -116,11 +125,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -137,8 +146,31 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  if (len < E131_MIN_PACKET_SIZE - 1 + packet.count)
+    return false;
+
+  packet.values = sbuff->property_values;
+  return true;
+}
+
+bool E131Component::ddp_packet_(const uint8_t *data, size_t len, uint32_t &offset, const uint8_t *&values,
+                                size_t &count) {
+  if (len < DDP_HEADER_SIZE)
+    return false;
+
+  uint8_t flags = data[0];
+  if ((flags & DDP_FLAGS_VERSION_MASK) != DDP_FLAGS_VERSION_1)
+    return false;
+  if ((flags & DDP_FLAGS_QUERY) != 0 || data[3] != DDP_ID_DISPLAY)
+    return false;
+
+  size_t header = DDP_HEADER_SIZE + ((flags & DDP_FLAGS_TIMECODE) != 0 ? DDP_TIMECODE_SIZE : 0);
+  offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  count = encode_uint16(data[8], data[9]);
+  if (len < header + count)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  values = data + header;
   return true;
 }
 
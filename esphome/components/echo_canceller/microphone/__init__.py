@@ -0,0 +1,79 @@
+import esphome.codegen as cg
+from esphome.components import audio, microphone
+from esphome.components.mixer.speaker import MixerSpeaker
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_MICROPHONE, PLATFORM_ESP32
+
+AUTO_LOAD = ["audio"]
+DEPENDENCIES = ["microphone"]
+
+CONF_MIXER = "mixer"
+CONF_TAIL_LENGTH = "tail_length"
+
+echo_canceller_ns = cg.esphome_ns.namespace("echo_canceller")
+EchoCancellerMicrophone = echo_canceller_ns.class_(
+    "EchoCancellerMicrophone", microphone.Microphone, cg.Component
+)
+
+
+def _set_stream_limits(config):
+    audio.set_stream_limits(
+        min_bits_per_sample=16,
+        max_bits_per_sample=16,
+        min_channels=1,
+        max_channels=1,
+        min_sample_rate=16000,
+        max_sample_rate=16000,
+    )(config)
+
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    microphone.MICROPHONE_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(EchoCancellerMicrophone),
+            cv.Required(CONF_MICROPHONE): microphone.microphone_source_schema(
+                min_bits_per_sample=16,
+                max_bits_per_sample=16,
+                min_channels=1,
+                max_channels=1,
+            ),
+            cv.Required(CONF_MIXER): cv.use_id(MixerSpeaker),
+            # Echo arriving later than this after playback is not cancelled
+            cv.Optional(CONF_TAIL_LENGTH, default="64ms"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(
+                    min=cv.TimePeriod(milliseconds=10),
+                    max=cv.TimePeriod(milliseconds=128),
+                ),
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_on([PLATFORM_ESP32]),
+    _set_stream_limits,
+)
+
+FINAL_VALIDATE_SCHEMA = cv.Schema(
+    {
+        cv.Required(
+            CONF_MICROPHONE
+        ): microphone.final_validate_microphone_source_schema(
+            "echo_canceller", sample_rate=16000
+        ),
+    },
+    extra=cv.ALLOW_EXTRA,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await microphone.register_microphone(var, config)
+
+    mic_source = await microphone.microphone_source_to_code(config[CONF_MICROPHONE])
+    cg.add(var.set_microphone_source(mic_source))
+
+    mixer = await cg.get_variable(config[CONF_MIXER])
+    cg.add(var.set_mixer(mixer))
+    cg.add(var.set_tail_length(config[CONF_TAIL_LENGTH]))
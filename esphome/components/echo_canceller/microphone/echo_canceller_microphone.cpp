@@ -0,0 +1,342 @@
+#include "echo_canceller_microphone.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace esphome {
+namespace echo_canceller {
+
+static const UBaseType_t MAX_LISTENERS = 16;
+
+static const uint32_t SAMPLE_RATE = 16000;
+static const uint32_t FRAME_DURATION_MS = 10;
+
+// Amount of audio buffered between the source microphone and the task
+static const uint32_t SOURCE_BUFFER_DURATION_MS = 100;
+// Amount of played audio buffered by the mixer
+static const uint32_t REFERENCE_BUFFER_DURATION_MS = 500;
+// More reference audio waiting than this means playback and capture drifted apart, so the reference is dropped
+static const uint32_t MAX_REFERENCE_BACKLOG_MS = 120;
+
+static const float SAMPLE_SCALE = 1.0f / 32768.0f;
+// NLMS step size, larger converges faster but leaves more residual echo
+static const float STEP_SIZE = 0.5f;
+// Reference audio quieter than this mean square (-60 dBFS) is too quiet to learn from
+static const float MIN_REFERENCE_MEAN_SQUARE = 1e-6f;
+// Double talk if the microphone is louder than the loudest recent reference sample times this
+static const float DOUBLE_TALK_THRESHOLD = 2.0f;
+// Frames the filter stays frozen after double talk was last detected
+static const uint8_t DOUBLE_TALK_HANGOVER_FRAMES = 5;
+
+static const size_t TASK_STACK_SIZE = 4096;
+static const UBaseType_t TASK_PRIORITY = 22;
+
+static const char *const TAG = "echo_canceller.microphone";
+
+enum EchoCancellerEventGroupBits : uint32_t {
+  COMMAND_STOP = (1 << 0),  // stops the task, set and cleared by ``loop``
+
+  TASK_STARTING = (1 << 10),  // set by task, cleared by ``loop``
+  TASK_RUNNING = (1 << 11),   // set by task, cleared by ``loop``
+  TASK_STOPPED = (1 << 13),   // set by task, cleared by ``loop``
+
+  ERR_ESP_NO_MEM = (1 << 19),  // set by task, cleared by ``loop``
+
+  ALL_BITS = 0x00FFFFFF,  // All valid FreeRTOS event group bits
+};
+
+void EchoCancellerMicrophone::setup() {
+  this->audio_stream_info_ = audio::AudioStreamInfo(16, 1, SAMPLE_RATE);
+  this->taps_ = this->audio_stream_info_.ms_to_samples(this->tail_length_ms_);
+
+  this->active_listeners_semaphore_ = xSemaphoreCreateCounting(MAX_LISTENERS, MAX_LISTENERS);
+  if (this->active_listeners_semaphore_ == nullptr) {
+    ESP_LOGE(TAG, "Creating semaphore failed");
+    this->mark_failed();
+    return;
+  }
+
+  this->event_group_ = xEventGroupCreate();
+  if (this->event_group_ == nullptr) {
+    ESP_LOGE(TAG, "Creating event group failed");
+    this->mark_failed();
+    return;
+  }
+
+  this->reference_reader_ =
+      this->mixer_->create_reference_reader(this->audio_stream_info_.ms_to_bytes(REFERENCE_BUFFER_DURATION_MS));
+  if (this->reference_reader_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate the reference buffer");
+    this->mark_failed();
+    return;
+  }
+}
+
+void EchoCancellerMicrophone::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Echo Canceller Microphone:\n"
+                "  Tail length: %" PRIu32 " ms (%zu taps)",
+                this->tail_length_ms_, this->taps_);
+}
+
+void EchoCancellerMicrophone::start() {
+  if (this->is_failed())
+    return;
+
+  xSemaphoreTake(this->active_listeners_semaphore_, 0);
+}
+
+void EchoCancellerMicrophone::stop() {
+  if (this->state_ == microphone::STATE_STOPPED || this->is_failed())
+    return;
+
+  xSemaphoreGive(this->active_listeners_semaphore_);
+}
+
+bool EchoCancellerMicrophone::allocate_filter_() {
+  RAMAllocator<float> allocator(RAMAllocator<float>::ALLOC_INTERNAL);
+  this->weights_ = allocator.allocate(this->taps_);
+  this->history_ = allocator.allocate(2 * this->taps_);
+  if ((this->weights_ == nullptr) || (this->history_ == nullptr)) {
+    this->deallocate_filter_();
+    return false;
+  }
+
+  std::fill_n(this->weights_, this->taps_, 0.0f);
+  std::fill_n(this->history_, 2 * this->taps_, 0.0f);
+  this->history_position_ = 0;
+  this->history_power_ = 0.0f;
+  this->double_talk_hangover_frames_ = 0;
+  this->microphone_energy_ = 0.0f;
+  this->residual_energy_ = 0.0f;
+
+  return true;
+}
+
+void EchoCancellerMicrophone::deallocate_filter_() {
+  RAMAllocator<float> allocator(RAMAllocator<float>::ALLOC_INTERNAL);
+  if (this->weights_ != nullptr) {
+    allocator.deallocate(this->weights_, this->taps_);
+    this->weights_ = nullptr;
+  }
+  if (this->history_ != nullptr) {
+    allocator.deallocate(this->history_, 2 * this->taps_);
+    this->history_ = nullptr;
+  }
+}
+
+void EchoCancellerMicrophone::process_frame_(int16_t *samples, const int16_t *reference, size_t frame_samples) {
+  const size_t taps = this->taps_;
+  float *weights = this->weights_;
+
+  // Recomputing the power once per frame keeps rounding errors of the running sum from adding up
+  float max_reference = 0.0f;
+  float power = 0.0f;
+  const float *window = this->history_ + this->history_position_;
+  for (size_t i = 0; i < taps; ++i) {
+    max_reference = std::max(max_reference, fabsf(window[i]));
+    power += window[i] * window[i];
+  }
+  this->history_power_ = power;
+
+  int32_t max_microphone = 0;
+  for (size_t i = 0; i < frame_samples; ++i) {
+    max_reference = std::max(max_reference, std::abs(static_cast<int32_t>(reference[i])) * SAMPLE_SCALE);
+    max_microphone = std::max(max_microphone, std::abs(static_cast<int32_t>(samples[i])));
+  }
+
+  // Geigel double talk detection: the echo alone is never much louder than what was played
+  if (max_microphone * SAMPLE_SCALE > max_reference * DOUBLE_TALK_THRESHOLD) {
+    this->double_talk_hangover_frames_ = DOUBLE_TALK_HANGOVER_FRAMES;
+  } else if (this->double_talk_hangover_frames_ > 0) {
+    --this->double_talk_hangover_frames_;
+  }
+  const bool adapt = (this->double_talk_hangover_frames_ == 0);
+
+  const float min_power = taps * MIN_REFERENCE_MEAN_SQUARE;
+
+  for (size_t n = 0; n < frame_samples; ++n) {
+    // Move the window back by one sample, dropping the oldest sample and adding the new one
+    this->history_position_ = (this->history_position_ == 0 ? taps : this->history_position_) - 1;
+    const float x = reference[n] * SAMPLE_SCALE;
+    const float oldest = this->history_[this->history_position_];
+    this->history_power_ = std::max(this->history_power_ + x * x - oldest * oldest, 0.0f);
+    this->history_[this->history_position_] = x;
+    this->history_[this->history_position_ + taps] = x;
+    window = this->history_ + this->history_position_;
+
+    float echo = 0.0f;
+    for (size_t i = 0; i < taps; ++i) {
+      echo += weights[i] * window[i];
+    }
+
+    const float microphone = samples[n] * SAMPLE_SCALE;
+    const float error = microphone - echo;
+
+    if (this->history_power_ > min_power) {
+      if (adapt) {
+        const float step = STEP_SIZE * error / (this->history_power_ + min_power);
+        for (size_t i = 0; i < taps; ++i) {
+          weights[i] += step * window[i];
+        }
+      }
+      this->microphone_energy_ += microphone * microphone;
+      this->residual_energy_ += error * error;
+    }
+
+    samples[n] = static_cast<int16_t>(clamp<int32_t>(lroundf(error * 32768.0f), INT16_MIN, INT16_MAX));
+  }
+}
+
+void EchoCancellerMicrophone::echo_canceller_task(void *params) {
+  EchoCancellerMicrophone *this_canceller = (EchoCancellerMicrophone *) params;
+  xEventGroupSetBits(this_canceller->event_group_, EchoCancellerEventGroupBits::TASK_STARTING);
+
+  {  // Ensures the frame buffers are freed when the task stops
+    const size_t frame_samples = this_canceller->audio_stream_info_.ms_to_samples(FRAME_DURATION_MS);
+    const size_t frame_bytes = this_canceller->audio_stream_info_.samples_to_bytes(frame_samples);
+    const size_t max_reference_backlog = this_canceller->audio_stream_info_.ms_to_bytes(MAX_REFERENCE_BACKLOG_MS);
+
+    std::vector<uint8_t> samples(frame_bytes);
+    std::vector<int16_t> reference(frame_samples);
+
+    if (!this_canceller->allocate_filter_()) {
+      xEventGroupSetBits(this_canceller->event_group_, EchoCancellerEventGroupBits::ERR_ESP_NO_MEM);
+    } else {
+      // Only match the microphone with audio played from now on
+      this_canceller->reference_reader_->reset();
+
+      xEventGroupSetBits(this_canceller->event_group_, EchoCancellerEventGroupBits::TASK_RUNNING);
+
+      size_t frame_bytes_filled = 0;
+      while (!(xEventGroupGetBits(this_canceller->event_group_) & EchoCancellerEventGroupBits::COMMAND_STOP)) {
+        frame_bytes_filled += this_canceller->microphone_source_->read(samples.data() + frame_bytes_filled,
+                                                                       frame_bytes - frame_bytes_filled,
+                                                                       pdMS_TO_TICKS(2 * FRAME_DURATION_MS));
+        if (frame_bytes_filled < frame_bytes) {
+          continue;
+        }
+        frame_bytes_filled = 0;
+
+        if (this_canceller->reference_reader_->available() > max_reference_backlog) {
+          this_canceller->reference_reader_->reset();
+        }
+        // Nothing played means nothing to cancel, so missing reference audio is silence
+        const size_t reference_bytes = this_canceller->reference_reader_->read(reference.data(), frame_bytes);
+        memset(reinterpret_cast<uint8_t *>(reference.data()) + reference_bytes, 0, frame_bytes - reference_bytes);
+
+        this_canceller->process_frame_(reinterpret_cast<int16_t *>(samples.data()), reference.data(), frame_samples);
+        this_canceller->data_callbacks_.call(samples);
+      }
+
+      if ((this_canceller->microphone_energy_ > 0.0f) && (this_canceller->residual_energy_ > 0.0f)) {
+        this_canceller->echo_return_loss_enhancement_ =
+            10.0f * log10f(this_canceller->microphone_energy_ / this_canceller->residual_energy_);
+      }
+    }
+
+    this_canceller->deallocate_filter_();
+  }
+
+  xEventGroupSetBits(this_canceller->event_group_, EchoCancellerEventGroupBits::TASK_STOPPED);
+  while (true) {
+    // Continuously delay until the loop method deletes the task
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
+void EchoCancellerMicrophone::loop() {
+  uint32_t event_group_bits = xEventGroupGetBits(this->event_group_);
+
+  if (event_group_bits & EchoCancellerEventGroupBits::TASK_STARTING) {
+    ESP_LOGV(TAG, "Task started, attempting to allocate the filter");
+    xEventGroupClearBits(this->event_group_, EchoCancellerEventGroupBits::TASK_STARTING);
+  }
+
+  if (event_group_bits & EchoCancellerEventGroupBits::ERR_ESP_NO_MEM) {
+    ESP_LOGE(TAG, "Not enough memory for the filter; retrying in 1 second");
+    this->status_momentary_error("no_mem", 1000);
+    xEventGroupClearBits(this->event_group_, EchoCancellerEventGroupBits::ERR_ESP_NO_MEM);
+  }
+
+  if (event_group_bits & EchoCancellerEventGroupBits::TASK_RUNNING) {
+    ESP_LOGV(TAG, "Task is running and cancelling echo");
+    xEventGroupClearBits(this->event_group_, EchoCancellerEventGroupBits::TASK_RUNNING);
+    this->state_ = microphone::STATE_RUNNING;
+  }
+
+  if (event_group_bits & EchoCancellerEventGroupBits::TASK_STOPPED) {
+    ESP_LOGV(TAG, "Task finished, freeing resources");
+    vTaskDelete(this->task_handle_);
+    this->task_handle_ = nullptr;
+    this->microphone_source_->stop_reading();
+    this->microphone_source_->stop();
+    xEventGroupClearBits(this->event_group_, ALL_BITS);
+
+    if (this->state_ == microphone::STATE_STOPPING) {
+      ESP_LOGD(TAG, "Echo return loss enhancement: %.1f dB", this->echo_return_loss_enhancement_);
+    }
+    this->state_ = microphone::STATE_STOPPED;
+  }
+
+  // Start if any semaphores are taken
+  if ((uxSemaphoreGetCount(this->active_listeners_semaphore_) < MAX_LISTENERS) &&
+      (this->state_ == microphone::STATE_STOPPED)) {
+    this->state_ = microphone::STATE_STARTING;
+  }
+
+  // Stop if all semaphores are returned
+  if ((uxSemaphoreGetCount(this->active_listeners_semaphore_) == MAX_LISTENERS) &&
+      (this->state_ == microphone::STATE_RUNNING)) {
+    this->state_ = microphone::STATE_STOPPING;
+  }
+
+  switch (this->state_) {
+    case microphone::STATE_STARTING:
+      if (this->status_has_error() || (this->task_handle_ != nullptr)) {
+        break;
+      }
+
+      this->microphone_source_->start();
+      if (!this->microphone_source_->start_reading(SOURCE_BUFFER_DURATION_MS)) {
+        ESP_LOGE(TAG, "Failed to allocate the microphone buffer; retrying in 1 second");
+        this->status_momentary_error("source_fail", 1000);
+        this->microphone_source_->stop();
+        break;
+      }
+
+      {
+        // Run on the core the main loop is not on
+        BaseType_t core = portNUM_PROCESSORS > 1 && xPortGetCoreID() == 0 ? 1 : 0;
+        xTaskCreatePinnedToCore(EchoCancellerMicrophone::echo_canceller_task, "echo_canceller", TASK_STACK_SIZE,
+                                (void *) this, TASK_PRIORITY, &this->task_handle_, core);
+      }
+
+      if (this->task_handle_ == nullptr) {
+        ESP_LOGE(TAG, "Task failed to start, retrying in 1 second");
+        this->status_momentary_error("task_fail", 1000);
+        this->microphone_source_->stop_reading();
+        this->microphone_source_->stop();
+      }
+      break;
+    case microphone::STATE_RUNNING:
+      break;
+    case microphone::STATE_STOPPING:
+      xEventGroupSetBits(this->event_group_, EchoCancellerEventGroupBits::COMMAND_STOP);
+      break;
+    case microphone::STATE_STOPPED:
+      break;
+  }
+}
+
+}  // namespace echo_canceller
+}  // namespace esphome
+
+#endif  // USE_ESP32
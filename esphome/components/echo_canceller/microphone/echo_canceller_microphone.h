@@ -0,0 +1,91 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/components/microphone/microphone.h"
+#include "esphome/components/microphone/microphone_source.h"
+#include "esphome/components/mixer/speaker/mixer_speaker.h"
+
+#include "esphome/core/component.h"
+#include "esphome/core/ring_buffer.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/semphr.h>
+
+#include <memory>
+
+namespace esphome {
+namespace echo_canceller {
+
+/** Microphone that removes the sound of the device's own speaker from another microphone's audio.
+ *
+ * The mixer provides the audio its output speaker played as the reference. An NLMS adaptive filter learns how that
+ * audio reaches the microphone over the configured tail length and subtracts its estimate of the echo. When the
+ * microphone is much louder than the reference, someone is talking over the playback, so the filter stops adapting
+ * until they are done (Geigel double talk detection).
+ *
+ * The audio is processed in 10 ms frames of 16 kHz mono samples in a task pinned to the core the main loop is not on.
+ * Consumers use the processed audio through a MicrophoneSource like with any other microphone.
+ */
+class EchoCancellerMicrophone : public microphone::Microphone, public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  void loop() override;
+
+  void start() override;
+  void stop() override;
+
+  void set_microphone_source(microphone::MicrophoneSource *microphone_source) {
+    this->microphone_source_ = microphone_source;
+  }
+  void set_mixer(mixer_speaker::MixerSpeaker *mixer) { this->mixer_ = mixer; }
+  void set_tail_length(uint32_t tail_length_ms) { this->tail_length_ms_ = tail_length_ms; }
+
+  /// @brief Returns how much quieter the echo got in the last session while the speaker played, in dB.
+  float get_echo_return_loss_enhancement() const { return this->echo_return_loss_enhancement_; }
+
+ protected:
+  static void echo_canceller_task(void *params);
+
+  /// @brief Allocates the filter and clears its state.
+  /// @return True if successful, false if there wasn't enough memory
+  bool allocate_filter_();
+  void deallocate_filter_();
+
+  /// @brief Removes the estimated echo from a frame of microphone samples in place.
+  /// @param samples (int16_t *) microphone samples, replaced by the processed samples
+  /// @param reference (const int16_t *) reference samples played at the same time
+  /// @param frame_samples number of samples in each buffer
+  void process_frame_(int16_t *samples, const int16_t *reference, size_t frame_samples);
+
+  microphone::MicrophoneSource *microphone_source_{nullptr};
+  mixer_speaker::MixerSpeaker *mixer_{nullptr};
+  std::unique_ptr<SharedRingBuffer::Reader> reference_reader_;
+
+  uint32_t tail_length_ms_;
+  size_t taps_{0};
+
+  // Filter state, only used by the task
+  float *weights_{nullptr};
+  // Newest reference samples first, stored twice so ``history_ + history_position_`` is always a full window
+  float *history_{nullptr};
+  size_t history_position_{0};
+  float history_power_{0.0f};
+  uint8_t double_talk_hangover_frames_{0};
+
+  // Echo return loss enhancement bookkeeping
+  float microphone_energy_{0.0f};
+  float residual_energy_{0.0f};
+  float echo_return_loss_enhancement_{0.0f};
+
+  SemaphoreHandle_t active_listeners_semaphore_{nullptr};
+  EventGroupHandle_t event_group_{nullptr};
+  TaskHandle_t task_handle_{nullptr};
+};
+
+}  // namespace echo_canceller
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -4,6 +4,7 @@ import re
 from esphome import automation
 import esphome.codegen as cg
 from esphome.components.esp32 import add_idf_sdkconfig_option, const, get_esp32_variant
+from esphome.components.psram import DOMAIN as PSRAM_DOMAIN
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ENABLE_ON_BOOT,
@@ -126,6 +127,8 @@ CONF_ADVERTISING_CYCLE_TIME = "advertising_cycle_time"
 CONF_DISABLE_BT_LOGS = "disable_bt_logs"
 CONF_CONNECTION_TIMEOUT = "connection_timeout"
 CONF_MAX_NOTIFICATIONS = "max_notifications"
+CONF_MAX_QUEUE_SIZE = "max_queue_size"
+CONF_INTERNAL_QUEUE_SIZE = "internal_queue_size"
 
 NO_BLUETOOTH_VARIANTS = [const.VARIANT_ESP32S2]
 
@@ -187,6 +190,10 @@ CONFIG_SCHEMA = cv.Schema(
             cv.positive_int,
             cv.Range(min=1, max=64),
         ),
+        cv.Optional(CONF_MAX_QUEUE_SIZE): cv.int_range(min=16, max=255),
+        cv.Optional(CONF_INTERNAL_QUEUE_SIZE): cv.All(
+            cv.requires_component(PSRAM_DOMAIN), cv.int_range(min=1, max=255)
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -236,6 +243,12 @@ def validate_variant(_):
 
 def final_validation(config):
     validate_variant(config)
+    if (internal := config.get(CONF_INTERNAL_QUEUE_SIZE)) is not None:
+        # Without max_queue_size the queue holds 100 events when there is PSRAM
+        if internal >= config.get(CONF_MAX_QUEUE_SIZE, 100):
+            raise cv.Invalid(
+                f"'{CONF_INTERNAL_QUEUE_SIZE}' must be less than '{CONF_MAX_QUEUE_SIZE}'"
+            )
     if (name := config.get(CONF_NAME)) is not None:
         full_config = fv.full_config.get()
         max_length = 20
@@ -297,6 +310,10 @@ async def to_code(config):
         )
 
     cg.add_define("USE_ESP32_BLE")
+    if CONF_MAX_QUEUE_SIZE in config:
+        cg.add_define("USE_ESP32_BLE_MAX_QUEUE_SIZE", config[CONF_MAX_QUEUE_SIZE])
+    if CONF_INTERNAL_QUEUE_SIZE in config:
+        cg.add(var.set_internal_queue_size(config[CONF_INTERNAL_QUEUE_SIZE]))
 
     if config[CONF_ADVERTISING]:
         cg.add_define("USE_ESP32_BLE_ADVERTISING")
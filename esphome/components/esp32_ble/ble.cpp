@@ -300,6 +300,16 @@ void ESP32BLE::loop() {
       break;
   }
 
+  // The queue only grows between two loops, so its size now is the peak
+  const uint8_t queued = this->ble_events_.size();
+  if (queued > this->queue_high_water_)
+    this->queue_high_water_ = queued;
+  if (queued >= MAX_BLE_QUEUE_SIZE * 3 / 4)
+    this->queue_pressure_ = true;
+
+  // Scan results are held in their events until the handlers are done with them, so they can be batched without a copy
+  BLEEvent *scan_events[SCAN_RESULT_BATCH_SIZE];
+  uint8_t scan_events_len = 0;
   BLEEvent *ble_event = this->ble_events_.pop();
   while (ble_event != nullptr) {
     switch (ble_event->type_) {
@@ -384,6 +394,15 @@ void ESP32BLE::loop() {
             }
             break;
 
+          // Connection parameter update
+          case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+            ESP_LOGV(TAG, "gap_event_handler - %d", gap_event);
+            for (auto *gap_handler : this->gap_event_handlers_) {
+              gap_handler->gap_event_handler(
+                  gap_event, reinterpret_cast<esp_ble_gap_cb_param_t *>(&ble_event->event_.gap.update_conn_params));
+            }
+            break;
+
           default:
             // Unknown/unhandled event
             ESP_LOGW(TAG, "Unhandled GAP event type in loop: %d", gap_event);
@@ -394,10 +413,18 @@ void ESP32BLE::loop() {
       default:
         break;
     }
-    // Return the event to the pool
-    this->ble_event_pool_.release(ble_event);
+    // Return the event to the pool, scan results once the handlers are done with them
+    if (ble_event->type_ == BLEEvent::GAP && ble_event->event_.gap.gap_event == ESP_GAP_BLE_SCAN_RESULT_EVT) {
+      scan_events[scan_events_len++] = ble_event;
+      if (scan_events_len == SCAN_RESULT_BATCH_SIZE)
+        this->release_scan_events_(scan_events, scan_events_len);
+    } else {
+      this->ble_event_pool_.release(ble_event);
+    }
     ble_event = this->ble_events_.pop();
   }
+  if (scan_events_len != 0)
+    this->release_scan_events_(scan_events, scan_events_len);
 #ifdef USE_ESP32_BLE_ADVERTISING
   if (this->advertising_ != nullptr) {
     this->advertising_->loop();
@@ -407,10 +434,20 @@ void ESP32BLE::loop() {
   // Log dropped events periodically
   uint16_t dropped = this->ble_events_.get_and_reset_dropped_count();
   if (dropped > 0) {
+    this->dropped_events_ += dropped;
+    this->queue_pressure_ = true;
     ESP_LOGW(TAG, "Dropped %u BLE events due to buffer overflow", dropped);
   }
 }
 
+void ESP32BLE::release_scan_events_(BLEEvent **events, uint8_t &count) {
+  for (auto *scan_handler : this->gap_scan_event_handlers_)
+    scan_handler->gap_scan_events_done();
+  for (uint8_t i = 0; i < count; i++)
+    this->ble_event_pool_.release(events[i]);
+  count = 0;
+}
+
 // Helper function to load new event data based on type
 void load_ble_event(BLEEvent *event, esp_gap_ble_cb_event_t e, esp_ble_gap_cb_param_t *p) {
   event->load_gap_event(e, p);
@@ -468,11 +505,12 @@ void ESP32BLE::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_pa
     case ESP_GAP_BLE_PASSKEY_NOTIF_EVT:
     case ESP_GAP_BLE_PASSKEY_REQ_EVT:
     case ESP_GAP_BLE_NC_REQ_EVT:
+    // Connection parameter updates - used by esp32_ble_client
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
       enqueue_ble_event(event, param);
       return;
 
     // Ignore these GAP events as they are not relevant for our use case
-    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
     case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
     case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:       // BLE 5.0 PHY update complete
     case ESP_GAP_BLE_CHANNEL_SELECT_ALGORITHM_EVT:  // BLE 5.0 channel selection algorithm
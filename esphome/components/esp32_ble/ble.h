@@ -28,12 +28,17 @@ namespace esphome::esp32_ble {
 
 // Maximum size of the BLE event queue
 // Increased to absorb the ring buffer capacity from esp32_ble_tracker
-#ifdef USE_PSRAM
+#if defined(USE_ESP32_BLE_MAX_QUEUE_SIZE)
+static constexpr uint8_t MAX_BLE_QUEUE_SIZE = USE_ESP32_BLE_MAX_QUEUE_SIZE;
+#elif defined(USE_PSRAM)
 static constexpr uint8_t MAX_BLE_QUEUE_SIZE = 100;  // 64 + 36 (ring buffer size with PSRAM)
 #else
 static constexpr uint8_t MAX_BLE_QUEUE_SIZE = 88;  // 64 + 24 (ring buffer size without PSRAM)
 #endif
 
+/// Scan results are kept in their pooled events and handed back to the pool this many at a time.
+static constexpr uint8_t SCAN_RESULT_BATCH_SIZE = 16;
+
 uint64_t ble_addr_to_uint64(const esp_bd_addr_t address);
 
 // NOLINTNEXTLINE(modernize-use-using)
@@ -71,7 +76,10 @@ class GAPEventHandler {
 
 class GAPScanEventHandler {
  public:
+  /// The scan result stays valid until the following gap_scan_events_done() returns, so it can be kept without a copy.
   virtual void gap_scan_event_handler(const BLEScanResult &scan_result) = 0;
+  /// Called after at most SCAN_RESULT_BATCH_SIZE scan results, before their memory is reused.
+  virtual void gap_scan_events_done() {}
 };
 
 class GATTcEventHandler {
@@ -129,6 +137,19 @@ class ESP32BLE : public Component {
     this->ble_status_event_handlers_.push_back(handler);
   }
   void set_enable_on_boot(bool enable_on_boot) { this->enable_on_boot_ = enable_on_boot; }
+  /// Keep only the first events of the queue in internal RAM, the others are created in PSRAM.
+  void set_internal_queue_size(uint8_t size) { this->ble_event_pool_.set_internal_limit(size); }
+
+  /// Events dropped since boot because the queue was full.
+  uint32_t get_dropped_events() const { return this->dropped_events_; }
+  /// Most events that were waiting in the queue at once since boot.
+  uint8_t get_queue_high_water() const { return this->queue_high_water_; }
+  /// Whether the queue came close to full since the last call, so producers should slow down.
+  bool get_and_reset_queue_pressure() {
+    bool pressure = this->queue_pressure_;
+    this->queue_pressure_ = false;
+    return pressure;
+  }
 
  protected:
   static void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
@@ -138,6 +159,8 @@ class ESP32BLE : public Component {
   bool ble_setup_();
   bool ble_dismantle_();
   bool ble_pre_setup_();
+  /// Tell the scan handlers the held scan results are done with and return their events to the pool.
+  void release_scan_events_(BLEEvent **events, uint8_t &count);
 #ifdef USE_ESP32_BLE_ADVERTISING
   void advertising_init_();
 #endif
@@ -165,6 +188,7 @@ class ESP32BLE : public Component {
 #endif
   esp_ble_io_cap_t io_cap_{ESP_IO_CAP_NONE};  // 4 bytes (enum)
   uint32_t advertising_cycle_time_{};         // 4 bytes
+  uint32_t dropped_events_{0};                // 4 bytes
 
   // 2-byte aligned members
   uint16_t appearance_{0};  // 2 bytes
@@ -172,6 +196,8 @@ class ESP32BLE : public Component {
   // 1-byte aligned members (grouped together to minimize padding)
   BLEComponentState state_{BLE_COMPONENT_STATE_OFF};  // 1 byte (uint8_t enum)
   bool enable_on_boot_{};                             // 1 byte
+  uint8_t queue_high_water_{0};                       // 1 byte
+  bool queue_pressure_{false};                        // 1 byte
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -221,6 +221,9 @@ class BLEEvent {
         // Security events - we store the full security union
         // Used by: ble_client (automation), bluetooth_proxy, esp32_ble_client
         esp_ble_sec_t security;  // Variable size, but fits within scan_result size
+        // Connection parameter update, stored as ESP-IDF's structure
+        // Used by: esp32_ble_client
+        esp_ble_gap_cb_param_t::ble_update_conn_params_evt_param update_conn_params;  // 20 bytes
       };
     } gap;  // 80 bytes total
 
@@ -261,6 +264,9 @@ class BLEEvent {
   esp_bt_status_t adv_complete_status() const { return event_.gap.adv_complete.status; }
   const RSSICompleteData &read_rssi_complete() const { return event_.gap.read_rssi_complete; }
   const esp_ble_sec_t &security() const { return event_.gap.security; }
+  const esp_ble_gap_cb_param_t::ble_update_conn_params_evt_param &update_conn_params() const {
+    return event_.gap.update_conn_params;
+  }
 
  private:
   // Helper to copy data with inline storage optimization
@@ -355,6 +361,12 @@ class BLEEvent {
         memcpy(&this->event_.gap.security, &p->ble_security, sizeof(esp_ble_sec_t));
         break;
 
+      // Connection parameter update
+      // Used by: esp32_ble_client
+      case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+        this->event_.gap.update_conn_params = p->update_conn_params;
+        break;
+
       default:
         // We only store data for GAP events that components currently use
         // Unknown events still get queued and logged in ble.cpp:375 as
@@ -459,6 +471,8 @@ static_assert(sizeof(decltype(((BLEEvent *) nullptr)->event_.gatts)) <=
 
 // Verify esp_ble_sec_t fits within our union
 static_assert(sizeof(esp_ble_sec_t) <= 73, "esp_ble_sec_t is larger than BLEScanResult");
+static_assert(sizeof(esp_ble_gap_cb_param_t::ble_update_conn_params_evt_param) <= 73,
+              "update_conn_params is larger than BLEScanResult");
 
 // BLEEvent total size: 84 bytes (80 byte union + 1 byte type + 3 bytes padding)
 
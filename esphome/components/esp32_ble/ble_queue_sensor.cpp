@@ -0,0 +1,27 @@
+#include "ble_queue_sensor.h"
+
+#if defined(USE_ESP32) && defined(USE_SENSOR)
+
+#include "esphome/core/log.h"
+
+namespace esphome::esp32_ble {
+
+static const char *const TAG = "esp32_ble.sensor";
+
+void ESP32BLEQueueSensor::update() {
+  if (this->dropped_events_sensor_ != nullptr)
+    this->dropped_events_sensor_->publish_state(this->parent_->get_dropped_events());
+  if (this->queue_high_water_sensor_ != nullptr)
+    this->queue_high_water_sensor_->publish_state(this->parent_->get_queue_high_water());
+}
+
+void ESP32BLEQueueSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 BLE Queue Sensor:");
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Dropped Events", this->dropped_events_sensor_);
+  LOG_SENSOR("  ", "Queue High Water", this->queue_high_water_sensor_);
+}
+
+}  // namespace esphome::esp32_ble
+
+#endif
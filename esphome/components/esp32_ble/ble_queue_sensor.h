@@ -0,0 +1,32 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_ESP32) && defined(USE_SENSOR)
+
+#include "ble.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+namespace esphome::esp32_ble {
+
+/// Reports how full the BLE event queue got, to size it for bursts of events.
+class ESP32BLEQueueSensor : public PollingComponent {
+ public:
+  explicit ESP32BLEQueueSensor(ESP32BLE *parent) : parent_(parent) {}
+
+  void set_dropped_events_sensor(sensor::Sensor *sensor) { this->dropped_events_sensor_ = sensor; }
+  void set_queue_high_water_sensor(sensor::Sensor *sensor) { this->queue_high_water_sensor_ = sensor; }
+
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  ESP32BLE *parent_;
+  sensor::Sensor *dropped_events_sensor_{nullptr};
+  sensor::Sensor *queue_high_water_sensor_{nullptr};
+};
+
+}  // namespace esphome::esp32_ble
+
+#endif
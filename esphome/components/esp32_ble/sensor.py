@@ -0,0 +1,56 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+
+from . import CONF_BLE_ID, ESP32BLE, esp32_ble_ns
+
+DEPENDENCIES = ["esp32_ble"]
+
+CONF_DROPPED_EVENTS = "dropped_events"
+CONF_QUEUE_HIGH_WATER = "queue_high_water"
+
+ESP32BLEQueueSensor = esp32_ble_ns.class_(
+    "ESP32BLEQueueSensor", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ESP32BLEQueueSensor),
+            cv.GenerateID(CONF_BLE_ID): cv.use_id(ESP32BLE),
+            cv.Optional(CONF_DROPPED_EVENTS): sensor.sensor_schema(
+                icon=ICON_COUNTER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_QUEUE_HIGH_WATER): sensor.sensor_schema(
+                icon=ICON_COUNTER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.has_at_least_one_key(CONF_DROPPED_EVENTS, CONF_QUEUE_HIGH_WATER),
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_BLE_ID])
+    var = cg.new_Pvariable(config[CONF_ID], parent)
+    await cg.register_component(var, config)
+
+    if dropped_conf := config.get(CONF_DROPPED_EVENTS):
+        sens = await sensor.new_sensor(dropped_conf)
+        cg.add(var.set_dropped_events_sensor(sens))
+    if high_water_conf := config.get(CONF_QUEUE_HIGH_WATER):
+        sens = await sensor.new_sensor(high_water_conf)
+        cg.add(var.set_queue_high_water_sensor(sens))
@@ -27,6 +27,9 @@ static const uint16_t MEDIUM_CONN_TIMEOUT = 800;  // 800 * 10ms = 8s
 static const uint16_t FAST_MIN_CONN_INTERVAL = 0x06;  // 6 * 1.25ms = 7.5ms (BLE minimum)
 static const uint16_t FAST_MAX_CONN_INTERVAL = 0x06;  // 6 * 1.25ms = 7.5ms
 static const uint16_t FAST_CONN_TIMEOUT = 1000;       // 1000 * 10ms = 10s
+
+// Air time set aside for every established connection once their intervals are coordinated
+static const uint16_t CONN_INTERVAL_PER_CONNECTION = 0x04;  // 4 * 1.25ms = 5ms
 static const esp_bt_uuid_t NOTIFY_DESC_UUID = {
     .len = ESP_UUID_LEN_16,
     .uuid =
@@ -73,6 +76,10 @@ void BLEClientBase::dump_config() {
                 "  Auto-Connect: %s",
                 this->address_str().c_str(), TRUEFALSE(this->auto_connect_));
   ESP_LOGCONFIG(TAG, "  State: %s", espbt::client_state_to_string(this->state()));
+  if (this->conn_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Connection interval: %.2f ms, latency: %u, timeout: %u ms", this->conn_interval_ * 1.25f,
+                  this->conn_latency_, this->conn_timeout_ * 10u);
+  }
   if (this->status_ == ESP_GATT_NO_RESOURCES) {
     ESP_LOGE(TAG, "  Failed due to no resources. Try to reduce number of BLE clients in config.");
   } else if (this->status_ != ESP_GATT_OK) {
@@ -111,6 +118,8 @@ void BLEClientBase::connect() {
   ESP_LOGI(TAG, "[%d] [%s] 0x%02x Connecting", this->connection_index_, this->address_str_.c_str(),
            this->remote_addr_type_);
   this->paired_ = false;
+  this->conn_interval_ = 0;
+  this->requested_conn_interval_ = 0;
   // Enable loop for state processing
   this->enable_loop();
   // Immediately transition to CONNECTING to prevent duplicate connection attempts
@@ -208,6 +217,25 @@ void BLEClientBase::log_gattc_warning_(const char *operation, esp_err_t err) {
   ESP_LOGW(TAG, "[%d] [%s] %s error, status=%d", this->connection_index_, this->address_str_.c_str(), operation, err);
 }
 
+void BLEClientBase::on_connections_changed(uint8_t established) {
+  // Only the V3 connections manage their parameters, and only once service discovery no longer needs them fast
+  if (this->state_ != espbt::ClientState::ESTABLISHED)
+    return;
+  if (this->connection_type_ != espbt::ConnectionType::V3_WITH_CACHE &&
+      this->connection_type_ != espbt::ConnectionType::V3_WITHOUT_CACHE)
+    return;
+  // All connections share one interval long enough for each to get its own slot in it next to scanning, so the
+  // controller does not have to drop connection events when their anchors collide
+  uint16_t interval = established * CONN_INTERVAL_PER_CONNECTION;
+  if (interval <= MEDIUM_MAX_CONN_INTERVAL) {
+    if (this->requested_conn_interval_ != MEDIUM_MAX_CONN_INTERVAL)
+      this->update_conn_params_(MEDIUM_MIN_CONN_INTERVAL, MEDIUM_MAX_CONN_INTERVAL, 0, MEDIUM_CONN_TIMEOUT, "medium");
+    return;
+  }
+  if (this->requested_conn_interval_ != interval)
+    this->update_conn_params_(interval, interval, 0, MEDIUM_CONN_TIMEOUT, "shared");
+}
+
 void BLEClientBase::log_connection_params_(const char *param_type) {
   ESP_LOGD(TAG, "[%d] [%s] %s conn params", this->connection_index_, this->address_str_.c_str(), param_type);
 }
@@ -240,6 +268,7 @@ void BLEClientBase::update_conn_params_(uint16_t min_interval, uint16_t max_inte
   conn_params.latency = latency;
   conn_params.timeout = timeout;
   this->log_connection_params_(param_type);
+  this->requested_conn_interval_ = max_interval;
   esp_err_t err = esp_ble_gap_update_conn_params(&conn_params);
   if (err != ESP_OK) {
     this->log_gattc_warning_("esp_ble_gap_update_conn_params", err);
@@ -251,6 +280,7 @@ void BLEClientBase::set_conn_params_(uint16_t min_interval, uint16_t max_interva
   // Set preferred connection parameters before connecting
   // These will be used when establishing the connection
   this->log_connection_params_(param_type);
+  this->requested_conn_interval_ = max_interval;
   esp_err_t err = esp_ble_gap_set_prefer_conn_params(this->remote_bda_, min_interval, max_interval, latency, timeout);
   if (err != ESP_OK) {
     this->log_gattc_warning_("esp_ble_gap_set_prefer_conn_params", err);
@@ -540,6 +570,21 @@ void BLEClientBase::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_
       }
       break;
 
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+      if (!this->check_addr(param->update_conn_params.bda))
+        return;
+      if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS) {
+        this->log_error_("connection parameter update failed, status", param->update_conn_params.status);
+        break;
+      }
+      this->conn_interval_ = param->update_conn_params.conn_int;
+      this->conn_latency_ = param->update_conn_params.latency;
+      this->conn_timeout_ = param->update_conn_params.timeout;
+      ESP_LOGD(TAG, "[%d] [%s] Connection interval %.2f ms, latency %u, timeout %u ms", this->connection_index_,
+               this->address_str_.c_str(), this->conn_interval_ * 1.25f, this->conn_latency_,
+               this->conn_timeout_ * 10u);
+      break;
+
     // There are other events we'll want to implement at some point to support things like pass key
     // https://github.com/espressif/esp-idf/blob/cba69dd088344ed9d26739f04736ae7a37541b3a/examples/bluetooth/bluedroid/ble/gatt_security_client/tutorial/Gatt_Security_Client_Example_Walkthrough.md
     default:
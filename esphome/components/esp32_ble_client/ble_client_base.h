@@ -97,6 +97,14 @@ class BLEClientBase : public espbt::ESPBTClient, public Component {
 
   uint8_t get_connection_index() const { return this->connection_index_; }
 
+  /// Negotiated connection interval in 1.25 ms units, 0 until the controller reported it.
+  uint16_t get_conn_interval() const { return this->conn_interval_; }
+  uint16_t get_conn_latency() const { return this->conn_latency_; }
+  /// Negotiated supervision timeout in 10 ms units.
+  uint16_t get_conn_timeout() const { return this->conn_timeout_; }
+
+  void on_connections_changed(uint8_t established) override;
+
   virtual void set_connection_type(espbt::ConnectionType ct) { this->connection_type_ = ct; }
 
   bool check_addr(esp_bd_addr_t &addr) { return memcmp(addr, this->remote_bda_, sizeof(esp_bd_addr_t)) == 0; }
@@ -124,6 +132,11 @@ class BLEClientBase : public espbt::ESPBTClient, public Component {
   // Group 5: 2-byte types
   uint16_t conn_id_{UNSET_CONN_ID};
   uint16_t mtu_{23};
+  uint16_t conn_interval_{0};
+  uint16_t conn_latency_{0};
+  uint16_t conn_timeout_{0};
+  /// Maximum interval last requested, to skip requesting the same parameters again.
+  uint16_t requested_conn_interval_{0};
 
   // Group 6: 1-byte types and small enums
   esp_ble_addr_type_t remote_addr_type_{BLE_ADDR_TYPE_PUBLIC};
@@ -28,6 +28,7 @@ from esphome.const import (
     CONF_ON_BLE_MANUFACTURER_DATA_ADVERTISE,
     CONF_ON_BLE_SERVICE_DATA_ADVERTISE,
     CONF_SERVICE_UUID,
+    CONF_SIZE,
     CONF_TRIGGER_ID,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
@@ -45,8 +46,12 @@ CONF_MAX_CONNECTIONS = "max_connections"
 CONF_ESP32_BLE_ID = "esp32_ble_id"
 CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
+CONF_ADAPTIVE = "adaptive"
 CONF_ON_SCAN_END = "on_scan_end"
 CONF_SOFTWARE_COEXISTENCE = "software_coexistence"
+CONF_DUPLICATE_FILTER = "duplicate_filter"
+CONF_RAW_WINDOW = "raw_window"
+CONF_PARSED_WINDOW = "parsed_window"
 
 DEFAULT_MAX_CONNECTIONS = 3
 IDF_MAX_CONNECTIONS = 9
@@ -188,10 +193,22 @@ CONFIG_SCHEMA = cv.All(
                         ): cv.positive_time_period_milliseconds,
                         cv.Optional(CONF_ACTIVE, default=True): cv.boolean,
                         cv.Optional(CONF_CONTINUOUS, default=True): cv.boolean,
+                        cv.Optional(CONF_ADAPTIVE, default=False): cv.boolean,
                     }
                 ),
                 validate_scan_parameters,
             ),
+            cv.Optional(CONF_DUPLICATE_FILTER): cv.Schema(
+                {
+                    cv.Optional(CONF_SIZE, default=32): cv.int_range(min=1, max=255),
+                    cv.Optional(
+                        CONF_RAW_WINDOW, default="0s"
+                    ): cv.positive_time_period_milliseconds,
+                    cv.Optional(
+                        CONF_PARSED_WINDOW, default="0s"
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
             cv.Optional(CONF_ON_BLE_ADVERTISE): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -299,6 +316,13 @@ async def to_code(config):
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
+    cg.add(var.set_scan_adaptive(params[CONF_ADAPTIVE]))
+    if dup := config.get(CONF_DUPLICATE_FILTER):
+        cg.add(
+            var.set_duplicate_filter(
+                dup[CONF_SIZE], dup[CONF_RAW_WINDOW], dup[CONF_PARSED_WINDOW]
+            )
+        )
 
     # Register ESP_BT_DEVICE feature if any of the automation triggers are used
     if (
@@ -32,6 +32,7 @@ class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, publi
  public:
   explicit BLEServiceDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
   void set_address(uint64_t address) { this->address_ = address; }
+  uint64_t get_address_filter() const override { return this->address_; }
   void set_service_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
   void set_service_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_service_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
@@ -58,6 +59,7 @@ class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>,
  public:
   explicit BLEManufacturerDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
   void set_address(uint64_t address) { this->address_ = address; }
+  uint64_t get_address_filter() const override { return this->address_; }
   void set_manufacturer_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
   void set_manufacturer_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_manufacturer_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
@@ -15,6 +15,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -39,6 +40,14 @@ namespace esphome::esp32_ble_tracker {
 
 static const char *const TAG = "esp32_ble_tracker";
 
+/// Raw advertisements handed to the listeners at most in one call.
+/// The scan window is halved at most this many times while the BLE event queue is under pressure.
+static const uint8_t MAX_SCAN_WINDOW_SHIFT = 3;
+/// Smallest scan window allowed by the Bluetooth specification, in 0.625 ms units.
+static const uint32_t MIN_SCAN_WINDOW = 4;
+/// Below this many advertisements per second the adaptive mode scans the whole interval.
+static const uint32_t IDLE_ADVERTISEMENT_RATE = 20;
+
 ESP32BLETracker *global_esp32_ble_tracker = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 const char *client_state_to_string(ClientState state) {
@@ -72,6 +81,8 @@ void ESP32BLETracker::setup() {
   }
 
   global_esp32_ble_tracker = this;
+  // The listeners' addresses are configured after they are registered
+  this->recalculate_advertisement_parser_types();
 
 #ifdef USE_OTA
   ota::get_global_ota_callback()->add_on_state_callback(
@@ -131,9 +142,15 @@ void ESP32BLETracker::loop() {
 
   ClientStateCounts counts = this->count_client_states_();
   if (counts != this->client_state_counts_) {
+    const bool connections_changed = counts.established != this->client_state_counts_.established;
     this->client_state_counts_ = counts;
-    ESP_LOGD(TAG, "connecting: %d, discovered: %d, disconnecting: %d", this->client_state_counts_.connecting,
-             this->client_state_counts_.discovered, this->client_state_counts_.disconnecting);
+    ESP_LOGD(TAG, "connecting: %d, discovered: %d, disconnecting: %d, established: %d",
+             this->client_state_counts_.connecting, this->client_state_counts_.discovered,
+             this->client_state_counts_.disconnecting, this->client_state_counts_.established);
+    if (connections_changed) {
+      for (auto *client : this->clients_)
+        client->on_connections_changed(counts.established);
+    }
   }
 
   if (this->scanner_state_ == ScannerState::FAILED ||
@@ -220,7 +237,8 @@ void ESP32BLETracker::start_scan_(bool first) {
   this->scan_params_.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
   this->scan_params_.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
   this->scan_params_.scan_interval = this->scan_interval_;
-  this->scan_params_.scan_window = this->scan_window_;
+  this->scan_params_.scan_window = this->next_scan_window_();
+  this->scan_result_count_ = 0;
 
   // Start timeout monitoring in loop() instead of using scheduler
   // This prevents false reboots when the loop is blocked
@@ -239,6 +257,33 @@ void ESP32BLETracker::start_scan_(bool first) {
   }
 }
 
+uint32_t ESP32BLETracker::next_scan_window_() {
+  // Listen a smaller part of every interval while the BLE event queue came close to full during the last scan
+  const bool pressure = this->parent_->get_and_reset_queue_pressure();
+  if (pressure) {
+    if (this->scan_window_shift_ < MAX_SCAN_WINDOW_SHIFT) {
+      this->scan_window_shift_++;
+      ESP_LOGW(TAG, "BLE event queue is close to full, reducing scan window to 1/%u", 1u << this->scan_window_shift_);
+    }
+  } else if (this->scan_window_shift_ > 0) {
+    this->scan_window_shift_--;
+  }
+  const uint32_t window = std::max(this->scan_window_ >> this->scan_window_shift_, MIN_SCAN_WINDOW);
+  if (!this->scan_adaptive_ || this->scan_window_shift_ != 0)
+    return window;
+
+  // Connections need air time of their own, leave them the other half of the configured window
+  for (auto *client : this->clients_) {
+    if (client->state() >= ClientState::CONNECTING)
+      return std::max(this->scan_window_ / 2, MIN_SCAN_WINDOW);
+  }
+  // Few advertisements arrived during the last scan, so there is time to listen all the time
+  const uint32_t elapsed = App.get_loop_component_start_time() - this->scan_start_time_;
+  if (elapsed != 0 && uint64_t(this->scan_result_count_) * 1000 / elapsed < IDLE_ADVERTISEMENT_RATE)
+    return this->scan_interval_;
+  return window;
+}
+
 void ESP32BLETracker::register_client(ESPBTClient *client) {
   client->app_id = ++this->app_id_;
   this->clients_.push_back(client);
@@ -254,13 +299,26 @@ void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
+  this->raw_listeners_.clear();
+  this->address_listeners_.clear();
+  this->wildcard_listeners_.clear();
   for (auto *listener : this->listeners_) {
     if (listener->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
       this->parse_advertisements_ = true;
+      uint64_t address = listener->get_address_filter();
+      if (address != 0) {
+        this->address_listeners_.emplace_back(address, listener);
+      } else {
+        this->wildcard_listeners_.push_back(listener);
+      }
     } else {
       this->raw_advertisements_ = true;
+      this->raw_listeners_.push_back(listener);
     }
   }
+  std::sort(this->address_listeners_.begin(), this->address_listeners_.end(),
+            [](const std::pair<uint64_t, ESPBTDeviceListener *> &a,
+               const std::pair<uint64_t, ESPBTDeviceListener *> &b) { return a.first < b.first; });
   for (auto *client : this->clients_) {
     if (client->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
       this->parse_advertisements_ = true;
@@ -298,6 +356,7 @@ void ESP32BLETracker::gap_scan_event_handler(const BLEScanResult &scan_result) {
   ESP_LOGV(TAG, "gap_scan_result - event %d", scan_result.search_evt);
 
   if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
+    this->scan_result_count_++;
     // Process the scan result immediately
     this->process_scan_result_(scan_result);
   } else if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
@@ -306,6 +365,7 @@ void ESP32BLETracker::gap_scan_event_handler(const BLEScanResult &scan_result) {
       this->log_unexpected_state_("scan complete", ScannerState::RUNNING);
     }
     // Scan completed naturally, perform cleanup and transition to IDLE
+    this->flush_raw_batch_();
     this->cleanup_scan_state_(false);
   }
 }
@@ -620,12 +680,22 @@ void ESP32BLETracker::dump_config() {
                 "  Scan Interval: %.1f ms\n"
                 "  Scan Window: %.1f ms\n"
                 "  Scan Type: %s\n"
-                "  Continuous Scanning: %s",
+                "  Continuous Scanning: %s\n"
+                "  Adaptive Scan Window: %s",
                 this->scan_duration_, this->scan_interval_ * 0.625f, this->scan_window_ * 0.625f,
-                this->scan_active_ ? "ACTIVE" : "PASSIVE", YESNO(this->scan_continuous_));
+                this->scan_active_ ? "ACTIVE" : "PASSIVE", YESNO(this->scan_continuous_), YESNO(this->scan_adaptive_));
+  if (!this->duplicate_cache_.empty()) {
+    ESP_LOGCONFIG(TAG,
+                  "  Duplicate Filter: %u entries\n"
+                  "    Raw Window: %" PRIu32 " ms\n"
+                  "    Parsed Window: %" PRIu32 " ms",
+                  (unsigned) this->duplicate_cache_.size(), this->duplicate_raw_window_,
+                  this->duplicate_parsed_window_);
+  }
   ESP_LOGCONFIG(TAG, "  Scanner State: %s", this->scanner_state_to_string_(this->scanner_state_));
-  ESP_LOGCONFIG(TAG, "  Connecting: %d, discovered: %d, disconnecting: %d", this->client_state_counts_.connecting,
-                this->client_state_counts_.discovered, this->client_state_counts_.disconnecting);
+  ESP_LOGCONFIG(TAG, "  Connecting: %d, discovered: %d, disconnecting: %d, established: %d",
+                this->client_state_counts_.connecting, this->client_state_counts_.discovered,
+                this->client_state_counts_.disconnecting, this->client_state_counts_.established);
   if (this->scan_start_fail_count_) {
     ESP_LOGCONFIG(TAG, "  Scan Start Fail Count: %d", this->scan_start_fail_count_);
   }
@@ -706,24 +776,35 @@ bool ESPBTDevice::resolve_irk(const uint8_t *irk) const {
 #endif  // USE_ESP32_BLE_DEVICE
 
 void ESP32BLETracker::process_scan_result_(const BLEScanResult &scan_result) {
-  // Process raw advertisements
-  if (this->raw_advertisements_) {
-    for (auto *listener : this->listeners_) {
-      listener->parse_devices(&scan_result, 1);
-    }
-    for (auto *client : this->clients_) {
-      client->parse_devices(&scan_result, 1);
-    }
+  bool raw = this->raw_advertisements_;
+  bool parse = this->parse_advertisements_;
+  if (!this->duplicate_cache_.empty())
+    this->filter_duplicate_(scan_result, raw, parse);
+
+  // Collect raw advertisements, they are handed over together once the queue is drained
+  if (raw) {
+    this->raw_batch_[this->raw_batch_len_++] = &scan_result;
+    if (this->raw_batch_len_ == this->raw_batch_.size())
+      this->flush_raw_batch_();
   }
 
   // Process parsed advertisements
-  if (this->parse_advertisements_) {
+  if (parse) {
 #ifdef USE_ESP32_BLE_DEVICE
     ESPBTDevice device;
     device.parse_scan_rst(scan_result);
 
     bool found = false;
-    for (auto *listener : this->listeners_) {
+    // Only the listeners for this address, instead of every listener comparing it on its own
+    const uint64_t address = device.address_uint64();
+    auto it = std::lower_bound(
+        this->address_listeners_.begin(), this->address_listeners_.end(), address,
+        [](const std::pair<uint64_t, ESPBTDeviceListener *> &entry, uint64_t value) { return entry.first < value; });
+    for (; it != this->address_listeners_.end() && it->first == address; ++it) {
+      if (it->second->parse_device(device))
+        found = true;
+    }
+    for (auto *listener : this->wildcard_listeners_) {
       if (listener->parse_device(device))
         found = true;
     }
@@ -741,6 +822,49 @@ void ESP32BLETracker::process_scan_result_(const BLEScanResult &scan_result) {
   }
 }
 
+void ESP32BLETracker::filter_duplicate_(const BLEScanResult &scan_result, bool &raw, bool &parse) {
+  const uint64_t address = esp32_ble::ble_addr_to_uint64(scan_result.bda);
+  // FNV-1a over the payload
+  uint32_t hash = 2166136261UL;
+  const uint8_t len = scan_result.adv_data_len + scan_result.scan_rsp_len;
+  for (uint8_t i = 0; i < len; i++) {
+    hash ^= scan_result.ble_adv[i];
+    hash *= 16777619UL;
+  }
+
+  const uint32_t now = millis();
+  DuplicateEntry *oldest = &this->duplicate_cache_[0];
+  for (auto &entry : this->duplicate_cache_) {
+    if (entry.address == address && entry.hash == hash) {
+      entry.last_seen = now;
+      if (raw && this->duplicate_raw_window_ != 0 && now - entry.raw_sent < this->duplicate_raw_window_) {
+        raw = false;
+      } else {
+        entry.raw_sent = now;
+      }
+      if (parse && this->duplicate_parsed_window_ != 0 && now - entry.parsed_sent < this->duplicate_parsed_window_) {
+        parse = false;
+      } else {
+        entry.parsed_sent = now;
+      }
+      return;
+    }
+    if (now - entry.last_seen > now - oldest->last_seen)
+      oldest = &entry;
+  }
+  *oldest = DuplicateEntry{address, hash, now, now, now};
+}
+
+void ESP32BLETracker::flush_raw_batch_() {
+  if (this->raw_batch_len_ == 0)
+    return;
+  for (auto *listener : this->raw_listeners_)
+    listener->parse_devices(this->raw_batch_.data(), this->raw_batch_len_);
+  for (auto *client : this->clients_)
+    client->parse_devices(this->raw_batch_.data(), this->raw_batch_len_);
+  this->raw_batch_len_ = 0;
+}
+
 void ESP32BLETracker::cleanup_scan_state_(bool is_stop_complete) {
   ESP_LOGD(TAG, "Scan %scomplete, set scanner state to IDLE.", is_stop_complete ? "stop " : "");
 #ifdef USE_ESP32_BLE_DEVICE
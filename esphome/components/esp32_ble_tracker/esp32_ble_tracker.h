@@ -7,6 +7,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef USE_ESP32
@@ -128,10 +129,16 @@ class ESPBTDeviceListener {
 #ifdef USE_ESP32_BLE_DEVICE
   virtual bool parse_device(const ESPBTDevice &device) = 0;
 #endif
-  virtual bool parse_devices(const BLEScanResult *scan_results, size_t count) { return false; };
+  virtual bool parse_devices(const BLEScanResult *const *scan_results, size_t count) { return false; };
   virtual AdvertisementParserType get_advertisement_parser_type() {
     return AdvertisementParserType::PARSED_ADVERTISEMENTS;
   };
+  /** The address of the only device this listener parses, or 0 for listeners that look at every advertisement.
+   *
+   * The tracker hands listeners with an address only the advertisements of that device. It is read when the tracker
+   * is set up, after the address is configured.
+   */
+  virtual uint64_t get_address_filter() const { return 0; }
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
  protected:
@@ -142,9 +149,11 @@ struct ClientStateCounts {
   uint8_t connecting = 0;
   uint8_t discovered = 0;
   uint8_t disconnecting = 0;
+  uint8_t established = 0;
 
   bool operator==(const ClientStateCounts &other) const {
-    return connecting == other.connecting && discovered == other.discovered && disconnecting == other.disconnecting;
+    return connecting == other.connecting && discovered == other.discovered && disconnecting == other.disconnecting &&
+           established == other.established;
   }
 
   bool operator!=(const ClientStateCounts &other) const { return !(*this == other); }
@@ -202,6 +211,8 @@ class ESPBTClient : public ESPBTDeviceListener {
   virtual void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) = 0;
   virtual void connect() = 0;
   virtual void disconnect() = 0;
+  /// Called when the number of established connections changed, so the client can adapt its connection parameters.
+  virtual void on_connections_changed(uint8_t established) {}
   bool disconnect_pending() const { return this->want_disconnect_; }
   void cancel_pending_disconnect() { this->want_disconnect_ = false; }
   virtual void set_state(ClientState st) {
@@ -239,6 +250,21 @@ class ESP32BLETracker : public Component,
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   bool get_scan_active() const { return scan_active_; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+  /** Choose the scan window from the load at the start of every scan instead of always using the configured one.
+   *
+   * The whole interval is scanned while few advertisements arrive, half the window is left to active connections.
+   */
+  void set_scan_adaptive(bool scan_adaptive) { scan_adaptive_ = scan_adaptive; }
+  /** Drop advertisements with the same address and payload as one handed over within the window.
+   *
+   * The windows are separate for raw and parsed advertisements, 0 hands over all of them. The last size different
+   * advertisements are remembered.
+   */
+  void set_duplicate_filter(uint8_t size, uint32_t raw_window, uint32_t parsed_window) {
+    this->duplicate_cache_.resize(size);
+    this->duplicate_raw_window_ = raw_window;
+    this->duplicate_parsed_window_ = parsed_window;
+  }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -262,6 +288,7 @@ class ESP32BLETracker : public Component,
                            esp_ble_gattc_cb_param_t *param) override;
   void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) override;
   void gap_scan_event_handler(const BLEScanResult &scan_result) override;
+  void gap_scan_events_done() override { this->flush_raw_batch_(); }
   void ble_before_disabled_event_handler() override;
 
   void add_scanner_state_callback(std::function<void(ScannerState)> &&callback) {
@@ -285,10 +312,24 @@ class ESP32BLETracker : public Component,
   void set_scanner_state_(ScannerState state);
   /// Common cleanup logic when transitioning scanner to IDLE state
   void cleanup_scan_state_(bool is_stop_complete);
-  /// Process a single scan result immediately
+  /// Process a single scan result immediately, raw advertisements are collected into raw_batch_
   void process_scan_result_(const BLEScanResult &scan_result);
+  /// Hand the collected raw advertisements to the raw listeners and clients in one call.
+  void flush_raw_batch_();
+  /// Clear raw or parse if the scan result repeats one handed over within the duplicate window.
+  void filter_duplicate_(const BLEScanResult &scan_result, bool &raw, bool &parse);
+
+  struct DuplicateEntry {
+    uint64_t address;
+    uint32_t hash;  ///< of the advertisement and scan response data
+    uint32_t last_seen;
+    uint32_t raw_sent;
+    uint32_t parsed_sent;
+  };
   /// Handle scanner failure states
   void handle_scanner_failure_();
+  /// Scan window for the next scan, from the BLE event queue pressure and, in adaptive mode, the load.
+  uint32_t next_scan_window_();
   /// Try to promote discovered clients to ready to connect
   void try_promote_discovered_clients_();
   /// Convert scanner state enum to string for logging
@@ -313,6 +354,9 @@ class ESP32BLETracker : public Component,
         case ClientState::CONNECTING:
           counts.connecting++;
           break;
+        case ClientState::ESTABLISHED:
+          counts.established++;
+          break;
         default:
           break;
       }
@@ -322,8 +366,18 @@ class ESP32BLETracker : public Component,
 
   // Group 1: Large objects (12+ bytes) - vectors and callback manager
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Listeners that want raw advertisements.
+  std::vector<ESPBTDeviceListener *> raw_listeners_;
+  /// Listeners for parsed advertisements of one device, sorted by address for a binary search.
+  std::vector<std::pair<uint64_t, ESPBTDeviceListener *>> address_listeners_;
+  /// Listeners for all parsed advertisements.
+  std::vector<ESPBTDeviceListener *> wildcard_listeners_;
   std::vector<ESPBTClient *> clients_;
   CallbackManager<void(ScannerState)> scanner_state_callbacks_;
+  /// Raw advertisements not yet handed over. They point into the BLE event pool, see gap_scan_events_done().
+  std::array<const BLEScanResult *, esp32_ble::SCAN_RESULT_BATCH_SIZE> raw_batch_{};
+  /// Recently seen advertisements, the least recently seen is replaced.
+  std::vector<DuplicateEntry> duplicate_cache_;
 #ifdef USE_ESP32_BLE_DEVICE
   /// Vector of addresses that have already been printed in print_bt_device_info
   std::vector<uint64_t> already_discovered_;
@@ -341,13 +395,21 @@ class ESP32BLETracker : public Component,
   uint32_t scan_window_;
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
+  /// Advertisements received since the scan started.
+  uint32_t scan_result_count_{0};
+  uint32_t duplicate_raw_window_{0};
+  uint32_t duplicate_parsed_window_{0};
 
   // Group 4: 1-byte types (enums, uint8_t, bool)
   uint8_t app_id_{0};
+  uint8_t raw_batch_len_{0};
+  /// The scan window is divided by 2^scan_window_shift_ to relieve the BLE event queue.
+  uint8_t scan_window_shift_{0};
   uint8_t scan_start_fail_count_{0};
   ScannerState scanner_state_{ScannerState::IDLE};
   bool scan_continuous_;
   bool scan_active_;
+  bool scan_adaptive_{false};
   bool ble_was_disabled_{true};
   bool raw_advertisements_{false};
   bool parse_advertisements_{false};
@@ -37,7 +37,7 @@ void ESP32Camera::setup() {
 
   /* initialize RTOS */
   this->framebuffer_get_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
-  this->framebuffer_return_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
+  this->framebuffer_return_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
   xTaskCreatePinnedToCore(&ESP32Camera::framebuffer_task,
                           "framebuffer_task",  // name
                           1024,                // stack size
@@ -164,13 +164,7 @@ void ESP32Camera::dump_config() {
 }
 
 void ESP32Camera::loop() {
-  // check if we can return the image
-  if (this->can_return_image_()) {
-    // return image
-    auto *fb = this->current_image_->get_raw_buffer();
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
-    this->current_image_.reset();
-  }
+  this->return_unused_images_();
 
   // request idle image every idle_update_interval
   const uint32_t now = App.get_loop_component_start_time();
@@ -182,8 +176,8 @@ void ESP32Camera::loop() {
   // Check if we should fetch a new image
   if (!this->has_requested_image_())
     return;
-  if (this->current_image_.use_count() > 1) {
-    // image is still in use
+  if (this->images_.size() >= this->config_.fb_count) {
+    // every frame buffer is still in use
     return;
   }
   if (now - this->last_update_ <= this->max_update_interval_)
@@ -202,10 +196,13 @@ void ESP32Camera::loop() {
     xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
     return;
   }
-  this->current_image_ = std::make_shared<ESP32CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
+  auto image = std::make_shared<ESP32CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
+  this->images_.push_back(image);
 
   ESP_LOGD(TAG, "Got Image: len=%u", fb->len);
-  this->new_image_callback_.call(this->current_image_);
+  this->new_image_callback_.call(image);
+  // Readers that skipped the image already let go of it
+  this->return_unused_images_();
   this->last_update_ = now;
   this->single_requesters_ = 0;
 }
@@ -402,15 +399,34 @@ void ESP32Camera::update_camera_parameters() {
 
 /* ---------------- Internal methods ---------------- */
 bool ESP32Camera::has_requested_image_() const { return this->single_requesters_ || this->stream_requesters_; }
-bool ESP32Camera::can_return_image_() const { return this->current_image_.use_count() == 1; }
+void ESP32Camera::return_unused_images_() {
+  auto it = this->images_.begin();
+  while (it != this->images_.end()) {
+    if (it->use_count() == 1) {
+      auto *fb = (*it)->get_raw_buffer();
+      xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+      it = this->images_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
 void ESP32Camera::framebuffer_task(void *pv) {
   ESP32Camera *that = (ESP32Camera *) pv;
+  uint8_t frames_in_use = 0;
   while (true) {
-    camera_fb_t *framebuffer = esp_camera_fb_get();
+    camera_fb_t *framebuffer;
+    // Hand back the frames the loop is done with, waiting for one if the driver has no free frame buffer left
+    TickType_t ticks_to_wait = frames_in_use < that->config_.fb_count ? 0 : portMAX_DELAY;
+    while (xQueueReceive(that->framebuffer_return_queue_, &framebuffer, ticks_to_wait) == pdTRUE) {
+      // return is no-op for config with 1 fb
+      esp_camera_fb_return(framebuffer);
+      frames_in_use--;
+      ticks_to_wait = 0;
+    }
+    framebuffer = esp_camera_fb_get();
     xQueueSend(that->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
-    // return is no-op for config with 1 fb
-    xQueueReceive(that->framebuffer_return_queue_, &framebuffer, portMAX_DELAY);
-    esp_camera_fb_return(framebuffer);
+    frames_in_use++;
   }
 }
 
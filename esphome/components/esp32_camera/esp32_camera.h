@@ -5,6 +5,7 @@
 #include <esp_camera.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <vector>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/components/camera/camera.h"
@@ -173,7 +174,8 @@ class ESP32Camera : public camera::Camera {
  protected:
   /* internal methods */
   bool has_requested_image_() const;
-  bool can_return_image_() const;
+  /// Returns the frame buffers of images no reader uses anymore to the driver.
+  void return_unused_images_();
 
   static void framebuffer_task(void *pv);
 
@@ -205,7 +207,10 @@ class ESP32Camera : public camera::Camera {
   uint32_t idle_update_interval_{15000};
 
   esp_err_t init_error_{ESP_OK};
-  std::shared_ptr<ESP32CameraImage> current_image_;
+  /// Images handed out and not returned to the driver yet, oldest first. Readers share them, so every frame is only
+  /// captured once no matter how many readers there are, and with several frame buffers a reader still busy with an
+  /// older frame does not keep the others from getting new ones.
+  std::vector<std::shared_ptr<ESP32CameraImage>> images_;
   uint8_t single_requesters_{0};
   uint8_t stream_requesters_{0};
   QueueHandle_t framebuffer_get_queue_;
@@ -9,12 +9,16 @@
 
 #include <cstdlib>
 #include <esp_http_server.h>
+#include <sys/socket.h>
 #include <utility>
 
 namespace esphome {
 namespace esp32_camera_web_server {
 
 static const int IMAGE_REQUEST_TIMEOUT = 5000;
+/// Stream clients that could not take any data for this long are disconnected.
+static const uint32_t STREAM_STALL_TIMEOUT = 10000;
+static const uint8_t MAX_STREAM_CLIENTS = 3;
 static const char *const TAG = "esp32_camera_web_server";
 
 #define PART_BOUNDARY "123456789000000000000987654321"
@@ -50,7 +54,13 @@ void CameraWebServer::setup() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
   config.ctrl_port = this->port_;
-  config.max_open_sockets = 1;
+  if (this->mode_ == STREAM) {
+    // Every viewer keeps its socket open while it watches the stream
+    config.max_open_sockets = MAX_STREAM_CLIENTS;
+    this->new_clients_ = xQueueCreate(MAX_STREAM_CLIENTS, sizeof(StreamClient *));
+  } else {
+    config.max_open_sockets = 1;
+  }
   config.backlog_conn = 2;
   config.lru_purge_enable = true;
 
@@ -68,16 +78,39 @@ void CameraWebServer::setup() {
   httpd_register_uri_handler(this->httpd_, &uri);
 
   camera::Camera::instance()->add_image_callback([this](std::shared_ptr<camera::CameraImage> image) {
-    if (this->running_ && image->was_requested_by(camera::WEB_REQUESTER)) {
+    if (!image->was_requested_by(camera::WEB_REQUESTER)) {
+      return;
+    }
+    for (auto *client : this->clients_) {
+      if (client->closing) {
+        continue;
+      }
+      // Only the newest frame waits, a client still sending an older one skips the frame in between
+      if (client->next_image != nullptr) {
+        client->dropped_frames++;
+      }
+      client->next_image = image;
+    }
+    if (this->running_) {
       this->image_ = std::move(image);
       xSemaphoreGive(this->semaphore_);
     }
   });
 }
 
+void StreamClient::destroy(void *ptr) {
+  auto *client = static_cast<StreamClient *>(ptr);
+  // Only mark the client as closed, the main loop removes it
+  client->fd.store(0);
+}
+
 void CameraWebServer::on_shutdown() {
   this->running_ = false;
   this->image_ = nullptr;
+  for (auto *client : this->clients_) {
+    client->image = nullptr;
+    client->next_image = nullptr;
+  }
   httpd_stop(this->httpd_);
   this->httpd_ = nullptr;
   vSemaphoreDelete(this->semaphore_);
@@ -106,6 +139,101 @@ void CameraWebServer::loop() {
   if (!this->running_) {
     this->image_ = nullptr;
   }
+
+  if (this->new_clients_ == nullptr) {
+    return;
+  }
+
+  StreamClient *new_client;
+  while (xQueueReceive(this->new_clients_, &new_client, 0) == pdTRUE) {
+    if (this->clients_.empty()) {
+      camera::Camera::instance()->start_stream(camera::WEB_REQUESTER);
+    }
+    new_client->last_progress = millis();
+    this->clients_.push_back(new_client);
+  }
+
+  auto it = this->clients_.begin();
+  while (it != this->clients_.end()) {
+    StreamClient *client = *it;
+    if (client->fd.load() != 0) {
+      // A closing client stays until httpd closed the socket and no longer references it
+      if (!client->closing) {
+        this->send_to_client_(client);
+      }
+      ++it;
+      continue;
+    }
+
+    ESP_LOGI(TAG, "STREAM: closed. Frames: %" PRIu32 ", skipped: %" PRIu32, client->frames, client->dropped_frames);
+    it = this->clients_.erase(it);
+    delete client;  // NOLINT(cppcoreguidelines-owning-memory)
+    if (this->clients_.empty()) {
+      camera::Camera::instance()->stop_stream(camera::WEB_REQUESTER);
+    }
+  }
+}
+
+void CameraWebServer::close_client_(StreamClient *client) {
+  client->closing = true;
+  client->image = nullptr;
+  client->next_image = nullptr;
+  httpd_sess_trigger_close(client->httpd, client->fd.load());
+}
+
+void CameraWebServer::send_to_client_(StreamClient *client) {
+  while (true) {
+    if (client->image == nullptr) {
+      if (client->next_image == nullptr) {
+        break;
+      }
+      client->image = std::move(client->next_image);
+      client->part_header_length =
+          snprintf(client->part_header, sizeof(client->part_header), STREAM_PART, client->image->get_data_length());
+      client->sent = 0;
+    }
+
+    // The part is the header, the image and the boundary, sent back to back
+    const size_t image_length = client->image->get_data_length();
+    const size_t boundary_length = strlen(STREAM_BOUNDARY);
+    const char *data;
+    size_t remaining;
+    if (client->sent < client->part_header_length) {
+      data = client->part_header + client->sent;
+      remaining = client->part_header_length - client->sent;
+    } else if (client->sent < client->part_header_length + image_length) {
+      const size_t offset = client->sent - client->part_header_length;
+      data = (const char *) client->image->get_data_buffer() + offset;
+      remaining = image_length - offset;
+    } else {
+      const size_t offset = client->sent - client->part_header_length - image_length;
+      data = STREAM_BOUNDARY + offset;
+      remaining = boundary_length - offset;
+    }
+
+    int sent = httpd_socket_send(client->httpd, client->fd.load(), data, remaining, MSG_DONTWAIT);
+    if (sent == HTTPD_SOCK_ERR_TIMEOUT) {
+      // The socket buffer is full, continue in a later loop
+      break;
+    }
+    if (sent < 0) {
+      this->close_client_(client);
+      return;
+    }
+    client->sent += sent;
+    client->last_progress = millis();
+
+    if (client->sent == client->part_header_length + image_length + boundary_length) {
+      // Frame done, release it so the camera can reuse its buffer
+      client->frames++;
+      client->image = nullptr;
+    }
+  }
+
+  if ((client->image != nullptr) && (millis() - client->last_progress > STREAM_STALL_TIMEOUT)) {
+    ESP_LOGW(TAG, "STREAM: client stalled, closing");
+    this->close_client_(client);
+  }
 }
 
 std::shared_ptr<esphome::camera::CameraImage> CameraWebServer::wait_for_image_() {
@@ -158,7 +286,6 @@ static esp_err_t httpd_send_all(httpd_req_t *r, const char *buf, size_t buf_len)
 
 esp_err_t CameraWebServer::streaming_handler_(struct httpd_req *req) {
   esp_err_t res = ESP_OK;
-  char part_buf[64];
 
   // This manually constructs HTTP response to avoid chunked encoding
   // which is not supported by some clients
@@ -169,47 +296,23 @@ esp_err_t CameraWebServer::streaming_handler_(struct httpd_req *req) {
     return res;
   }
 
-  uint32_t last_frame = millis();
-  uint32_t frames = 0;
-
-  camera::Camera::instance()->start_stream(esphome::camera::WEB_REQUESTER);
-
-  while (res == ESP_OK && this->running_) {
-    auto image = this->wait_for_image_();
-
-    if (!image) {
-      ESP_LOGW(TAG, "STREAM: failed to acquire frame");
-      res = ESP_FAIL;
-    }
-    if (res == ESP_OK) {
-      size_t hlen = snprintf(part_buf, 64, STREAM_PART, image->get_data_length());
-      res = httpd_send_all(req, part_buf, hlen);
-    }
-    if (res == ESP_OK) {
-      res = httpd_send_all(req, (const char *) image->get_data_buffer(), image->get_data_length());
-    }
-    if (res == ESP_OK) {
-      res = httpd_send_all(req, STREAM_BOUNDARY, strlen(STREAM_BOUNDARY));
-    }
-    if (res == ESP_OK) {
-      frames++;
-      int64_t frame_time = millis() - last_frame;
-      last_frame = millis();
-
-      ESP_LOGD(TAG, "MJPG: %" PRIu32 "B %" PRIu32 "ms (%.1ffps)", (uint32_t) image->get_data_length(),
-               (uint32_t) frame_time, 1000.0 / (uint32_t) frame_time);
-    }
-  }
-
-  if (!frames) {
-    res = httpd_send_all(req, STREAM_ERROR, strlen(STREAM_ERROR));
+  // The main loop sends the frames from now on, the connection stays open until the client or httpd closes it
+  auto *client = new StreamClient();  // NOLINT(cppcoreguidelines-owning-memory)
+  client->httpd = req->handle;
+  client->fd.store(httpd_req_to_sockfd(req));
+  req->sess_ctx = client;
+  req->free_ctx = StreamClient::destroy;
+  if (xQueueSend(this->new_clients_, &client, 0) != pdTRUE) {
+    req->sess_ctx = nullptr;
+    req->free_ctx = nullptr;
+    delete client;  // NOLINT(cppcoreguidelines-owning-memory)
+    httpd_send_all(req, STREAM_ERROR, strlen(STREAM_ERROR));
+    return ESP_FAIL;
   }
 
-  camera::Camera::instance()->stop_stream(esphome::camera::WEB_REQUESTER);
+  ESP_LOGI(TAG, "STREAM: client connected");
 
-  ESP_LOGI(TAG, "STREAM: closed. Frames: %" PRIu32, frames);
-
-  return res;
+  return ESP_OK;
 }
 
 esp_err_t CameraWebServer::snapshot_handler_(struct httpd_req *req) {
@@ -2,9 +2,12 @@
 
 #ifdef USE_ESP32
 
+#include <atomic>
 #include <cinttypes>
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <freertos/semphr.h>
+#include <vector>
 
 #include "esphome/components/camera/camera.h"
 #include "esphome/core/component.h"
@@ -18,6 +21,32 @@ namespace esp32_camera_web_server {
 
 enum Mode { STREAM, SNAPSHOT };
 
+/** State of one client of the MJPEG stream.
+ *
+ * The connection stays open after the request handler returns and the main loop sends the frames without blocking.
+ * Every client shares the frames the camera captured and only holds on to the one it is sending and the newest one
+ * waiting, so a slow client skips frames instead of slowing down the camera for everyone else.
+ */
+struct StreamClient {
+  void *httpd;
+  /// Socket of the connection, set to 0 by httpd once it closed the connection.
+  std::atomic<int> fd;
+  /// Frame being sent and the newest frame waiting to be sent after it.
+  std::shared_ptr<camera::CameraImage> image;
+  std::shared_ptr<camera::CameraImage> next_image;
+  char part_header[64];
+  size_t part_header_length{0};
+  /// Bytes of the current part (header, image and boundary) already sent.
+  size_t sent{0};
+  uint32_t frames{0};
+  uint32_t dropped_frames{0};
+  uint32_t last_progress{0};
+  /// Set once the server asked httpd to close the connection.
+  bool closing{false};
+
+  static void destroy(void *ptr);
+};
+
 class CameraWebServer : public Component {
  public:
   CameraWebServer();
@@ -37,12 +66,21 @@ class CameraWebServer : public Component {
   esp_err_t streaming_handler_(struct httpd_req *req);
   esp_err_t snapshot_handler_(struct httpd_req *req);
 
+  /// @brief Sends as much of the client's frames as the socket takes without blocking. Closes the connection if it
+  /// failed or stalled.
+  void send_to_client_(StreamClient *client);
+  void close_client_(StreamClient *client);
+
   uint16_t port_{0};
   void *httpd_{nullptr};
   SemaphoreHandle_t semaphore_;
   std::shared_ptr<camera::CameraImage> image_;
   bool running_{false};
   Mode mode_{STREAM};
+
+  /// Clients that connected in the httpd task, picked up by the main loop.
+  QueueHandle_t new_clients_{nullptr};
+  std::vector<StreamClient *> clients_;
 };
 
 }  // namespace esp32_camera_web_server
@@ -3,7 +3,15 @@ import math
 from esphome import pins
 import esphome.codegen as cg
 from esphome.components import canbus
-from esphome.components.canbus import CONF_BIT_RATE, CanbusComponent, CanSpeed
+from esphome.components.canbus import (
+    CONF_BIT_RATE,
+    CONF_CAN_ID,
+    CONF_CAN_ID_MASK,
+    CONF_ON_FRAME,
+    CONF_USE_EXTENDED_ID,
+    CanbusComponent,
+    CanSpeed,
+)
 from esphome.components.esp32 import get_esp32_variant
 from esphome.components.esp32.const import (
     VARIANT_ESP32,
@@ -26,6 +34,7 @@ CODEOWNERS = ["@Sympatron"]
 DEPENDENCIES = ["esp32"]
 
 CONF_TX_ENQUEUE_TIMEOUT = "tx_enqueue_timeout"
+CONF_HARDWARE_FILTER = "hardware_filter"
 
 esp32_can_ns = cg.esphome_ns.namespace("esp32_can")
 esp32_can = esp32_can_ns.class_("ESP32Can", CanbusComponent)
@@ -89,10 +98,37 @@ CONFIG_SCHEMA = canbus.CANBUS_SCHEMA.extend(
         cv.Optional(CONF_RX_QUEUE_LEN): cv.uint32_t,
         cv.Optional(CONF_TX_QUEUE_LEN): cv.uint32_t,
         cv.Optional(CONF_TX_ENQUEUE_TIMEOUT): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_HARDWARE_FILTER, default=False): cv.boolean,
     }
 )
 
 
+def get_rx_filter(config):
+    """Return the TWAI acceptance code and mask that let through the frames of all
+    on_frame triggers, or None if the controller has to accept every frame."""
+    frames = config.get(CONF_ON_FRAME, [])
+    extended = {conf[CONF_USE_EXTENDED_ID] for conf in frames}
+    # A single filter can't match both standard and extended frames
+    if len(extended) != 1:
+        return None
+    # Compare only the bits that every trigger compares and all trigger IDs agree on
+    first_id = frames[0][CONF_CAN_ID]
+    care = 0x1FFFFFFF
+    for conf in frames:
+        care &= conf[CONF_CAN_ID_MASK] & ~(conf[CONF_CAN_ID] ^ first_id)
+    # The ID is left aligned, followed by the RTR bit and, for standard frames,
+    # the first two data bytes
+    if extended.pop():
+        shift = 3
+    else:
+        shift = 21
+        care &= 0x7FF
+    code = (first_id & care) << shift
+    # Set bits in the mask are ignored
+    mask = ~(care << shift) & 0xFFFFFFFF
+    return code, mask
+
+
 def get_default_tx_enqueue_timeout(bit_rate):
     bit_rate_numeric = canbus.get_rate(bit_rate)
     bits_per_packet = 140  # ~max CAN message length
@@ -119,3 +155,6 @@ async def to_code(config):
         tx_enqueue_timeout_ms = get_default_tx_enqueue_timeout(config[CONF_BIT_RATE])
 
     cg.add(var.set_tx_enqueue_timeout_ms(tx_enqueue_timeout_ms))
+
+    if config[CONF_HARDWARE_FILTER] and (rx_filter := get_rx_filter(config)):
+        cg.add(var.set_rx_filter(*rx_filter))
@@ -76,7 +76,11 @@ bool ESP32Can::setup_internal() {
     g_config.rx_queue_len = this->rx_queue_len_.value();
   }
 
-  twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+  twai_filter_config_t f_config = {
+      .acceptance_code = this->rx_filter_code_,
+      .acceptance_mask = this->rx_filter_mask_,
+      .single_filter = true,
+  };
   twai_timing_config_t t_config;
 
   if (!get_bitrate(this->bit_rate_, &t_config)) {
@@ -17,6 +17,11 @@ class ESP32Can : public canbus::Canbus {
   void set_tx_enqueue_timeout_ms(uint32_t tx_enqueue_timeout_ms) {
     this->tx_enqueue_timeout_ticks_ = pdMS_TO_TICKS(tx_enqueue_timeout_ms);
   }
+  /// Sets the single acceptance filter of the controller, in the layout of twai_filter_config_t.
+  void set_rx_filter(uint32_t acceptance_code, uint32_t acceptance_mask) {
+    this->rx_filter_code_ = acceptance_code;
+    this->rx_filter_mask_ = acceptance_mask;
+  }
   ESP32Can(){};
 
  protected:
@@ -29,6 +34,8 @@ class ESP32Can : public canbus::Canbus {
   TickType_t tx_enqueue_timeout_ticks_{};
   optional<uint32_t> tx_queue_len_{};
   optional<uint32_t> rx_queue_len_{};
+  uint32_t rx_filter_code_{0};
+  uint32_t rx_filter_mask_{0xFFFFFFFF};
 };
 
 }  // namespace esp32_can
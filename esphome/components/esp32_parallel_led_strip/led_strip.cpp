@@ -0,0 +1,294 @@
+#include "led_strip.h"
+#include <cinttypes>
+#include <cmath>
+
+#ifdef USE_ESP32
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+static const char *const TAG = "esp32_parallel_led_strip";
+
+static const uint8_t MIN_BIT_SLOTS = 3;
+static const uint8_t MAX_BIT_SLOTS = 10;
+/// A few slots more only pay off when they bring the timings this much closer, in ns.
+static const uint32_t SLOT_IMPROVEMENT = 50;
+/// Time the lines are held low after every frame at least, as the RMT driver waits between frames.
+static const uint32_t MIN_RESET_LOW = 50000;
+
+static bool IRAM_ATTR frame_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata,
+                                    void *arg) {
+  *static_cast<volatile bool *>(arg) = false;
+  return false;
+}
+
+void ESP32ParallelLEDStripLightOutput::setup() {
+  if (this->bit_slots_ == 0) {
+    ESP_LOGE(TAG, "LED timings cannot be made from bus clock slots");
+    this->mark_failed();
+    return;
+  }
+
+  size_t buffer_size = this->get_buffer_size_();
+
+  RAMAllocator<uint8_t> allocator;
+  this->buf_ = allocator.allocate(buffer_size);
+  if (this->buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate LED buffer!");
+    this->mark_failed();
+    return;
+  }
+  memset(this->buf_, 0, buffer_size);
+
+  this->effect_data_ = allocator.allocate(this->size());
+  if (this->effect_data_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate effect data!");
+    this->mark_failed();
+    return;
+  }
+
+  size_t frame_size = this->get_frame_words_() * (this->pins_.size() / 8);
+  this->frame_ = static_cast<uint8_t *>(heap_caps_malloc(frame_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+  if (this->frame_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate %zu bytes of DMA memory for the frame!", frame_size);
+    this->mark_failed();
+    return;
+  }
+  if (this->pins_.size() == 16) {
+    this->prepare_frame_(reinterpret_cast<uint16_t *>(this->frame_));
+  } else {
+    this->prepare_frame_(this->frame_);
+  }
+
+  esp_lcd_i80_bus_config_t bus_config;
+  memset(&bus_config, 0, sizeof(bus_config));
+  bus_config.dc_gpio_num = this->dc_pin_;
+  bus_config.wr_gpio_num = this->clock_pin_;
+  bus_config.clk_src = LCD_CLK_SRC_DEFAULT;
+  for (size_t i = 0; i != this->pins_.size(); i++)
+    bus_config.data_gpio_nums[i] = this->pins_[i];
+  bus_config.bus_width = this->pins_.size();
+  bus_config.max_transfer_bytes = frame_size;
+  if (esp_lcd_new_i80_bus(&bus_config, &this->bus_) != ESP_OK) {
+    ESP_LOGE(TAG, "Bus creation failed");
+    this->mark_failed();
+    return;
+  }
+
+  esp_lcd_panel_io_i80_config_t io_config;
+  memset(&io_config, 0, sizeof(io_config));
+  io_config.cs_gpio_num = -1;
+  io_config.pclk_hz = this->pclk_hz_;
+  io_config.trans_queue_depth = 1;
+  io_config.on_color_trans_done = frame_done_cb;
+  io_config.user_ctx = const_cast<bool *>(&this->transmitting_);
+  io_config.lcd_cmd_bits = 8;
+  io_config.lcd_param_bits = 8;
+  io_config.dc_levels.dc_data_level = 1;
+  if (esp_lcd_new_panel_io_i80(this->bus_, &io_config, &this->io_) != ESP_OK) {
+    ESP_LOGE(TAG, "Panel IO creation failed");
+    this->mark_failed();
+    return;
+  }
+}
+
+void ESP32ParallelLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
+                                                      uint32_t bit1_low, uint32_t reset_time_high,
+                                                      uint32_t reset_time_low) {
+  // All bits share one slot length, so use the average of both bit periods
+  const float period = (bit0_high + bit0_low + bit1_high + bit1_low) / 2.0f;
+  uint32_t best_error = UINT32_MAX;
+  this->bit_slots_ = 0;
+  for (uint8_t slots = MIN_BIT_SLOTS; slots <= MAX_BIT_SLOTS; slots++) {
+    const float slot = period / slots;
+    long bit0 = std::max(lroundf(bit0_high / slot), 1L);
+    long bit1 = lroundf(bit1_high / slot);
+    if (bit1 <= bit0 || bit1 >= slots)
+      continue;
+    auto error = (uint32_t) std::max(fabsf(bit0 * slot - bit0_high), fabsf(bit1 * slot - bit1_high));
+    if (error + SLOT_IMPROVEMENT < best_error) {
+      best_error = error;
+      this->bit_slots_ = slots;
+      this->bit0_slots_ = bit0;
+      this->bit1_slots_ = bit1;
+    }
+  }
+  if (this->bit_slots_ == 0)
+    return;
+  const float slot = period / this->bit_slots_;
+  this->pclk_hz_ = lroundf(1e9f / slot);
+  this->reset_high_slots_ = ceilf(reset_time_high / slot);
+  this->reset_low_slots_ = ceilf(std::max(reset_time_low, MIN_RESET_LOW) / slot);
+}
+
+template<typename T> void ESP32ParallelLEDStripLightOutput::prepare_frame_(T *frame) {
+  const size_t bits = this->num_leds_ * this->get_bytes_per_led_() * 8;
+  const T all_lanes = static_cast<T>(~0u);
+  T *out = frame;
+  for (size_t i = 0; i != bits; i++) {
+    for (uint8_t slot = 0; slot != this->bit_slots_; slot++)
+      *out++ = slot < this->bit0_slots_ ? all_lanes : 0;
+  }
+  for (uint32_t i = 0; i != this->reset_high_slots_; i++)
+    *out++ = all_lanes;
+  for (uint32_t i = 0; i != this->reset_low_slots_; i++)
+    *out++ = 0;
+}
+
+template<typename T> void HOT ESP32ParallelLEDStripLightOutput::encode_frame_(T *frame) {
+  const size_t lanes = this->pins_.size();
+  const size_t strip_bytes = this->num_leds_ * this->get_bytes_per_led_();
+  T *out = frame;
+  for (size_t pos = 0; pos != strip_bytes; pos++) {
+    // Turn the same byte of every strip into eight bus words, most significant bit first
+    T bits[8] = {};
+    for (size_t lane = 0; lane != lanes; lane++) {
+      uint8_t value = this->buf_[lane * strip_bytes + pos];
+      for (int i = 0; i != 8; i++) {
+        if (value & (0x80 >> i))
+          bits[i] |= T(1) << lane;
+      }
+    }
+    for (int i = 0; i != 8; i++, out += this->bit_slots_) {
+      for (uint8_t slot = this->bit0_slots_; slot != this->bit1_slots_; slot++)
+        out[slot] = bits[i];
+    }
+  }
+}
+
+void ESP32ParallelLEDStripLightOutput::write_state(light::LightState *state) {
+  // protect from refreshing too often
+  uint32_t now = micros();
+  if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_) {
+    // try again next loop iteration, so that this change won't get lost
+    this->schedule_show();
+    return;
+  }
+  if (this->transmitting_) {
+    // the frame buffer is still being sent, try again next loop iteration
+    this->schedule_show();
+    return;
+  }
+  this->last_refresh_ = now;
+  this->mark_shown_();
+
+  ESP_LOGVV(TAG, "Writing RGB values to bus");
+
+  size_t frame_size = this->get_frame_words_() * (this->pins_.size() / 8);
+  if (this->pins_.size() == 16) {
+    this->encode_frame_(reinterpret_cast<uint16_t *>(this->frame_));
+  } else {
+    this->encode_frame_(this->frame_);
+  }
+
+  this->transmitting_ = true;
+  esp_err_t error = esp_lcd_panel_io_tx_color(this->io_, -1, this->frame_, frame_size);
+  if (error != ESP_OK) {
+    this->transmitting_ = false;
+    ESP_LOGE(TAG, "Bus TX error: %s", esp_err_to_name(error));
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+}
+
+light::ESPColorView ESP32ParallelLEDStripLightOutput::get_view_internal(int32_t index) const {
+  int32_t r = 0, g = 0, b = 0;
+  switch (this->rgb_order_) {
+    case ORDER_RGB:
+      r = 0;
+      g = 1;
+      b = 2;
+      break;
+    case ORDER_RBG:
+      r = 0;
+      g = 2;
+      b = 1;
+      break;
+    case ORDER_GRB:
+      r = 1;
+      g = 0;
+      b = 2;
+      break;
+    case ORDER_GBR:
+      r = 2;
+      g = 0;
+      b = 1;
+      break;
+    case ORDER_BGR:
+      r = 2;
+      g = 1;
+      b = 0;
+      break;
+    case ORDER_BRG:
+      r = 1;
+      g = 2;
+      b = 0;
+      break;
+  }
+  // The strips follow each other in the buffer, so the index maps straight onto it
+  uint8_t multiplier = this->get_bytes_per_led_();
+  uint8_t white = this->is_wrgb_ ? 0 : 3;
+
+  return {this->buf_ + (index * multiplier) + r + this->is_wrgb_,
+          this->buf_ + (index * multiplier) + g + this->is_wrgb_,
+          this->buf_ + (index * multiplier) + b + this->is_wrgb_,
+          this->is_rgbw_ || this->is_wrgb_ ? this->buf_ + (index * multiplier) + white : nullptr,
+          &this->effect_data_[index],
+          &this->correction_};
+}
+
+void ESP32ParallelLEDStripLightOutput::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ESP32 Parallel LED Strip:\n"
+                "  Strips: %u\n"
+                "  LEDs per strip: %u\n"
+                "  Clock Pin: %u\n"
+                "  Bus clock: %" PRIu32 " Hz\n"
+                "  Slots per bit: %u (0: %u high, 1: %u high)",
+                (unsigned) this->pins_.size(), this->num_leds_, this->clock_pin_, this->pclk_hz_, this->bit_slots_,
+                this->bit0_slots_, this->bit1_slots_);
+  for (size_t i = 0; i != this->pins_.size(); i++)
+    ESP_LOGCONFIG(TAG, "  Strip %u Pin: %u", (unsigned) i, this->pins_[i]);
+  const char *rgb_order;
+  switch (this->rgb_order_) {
+    case ORDER_RGB:
+      rgb_order = "RGB";
+      break;
+    case ORDER_RBG:
+      rgb_order = "RBG";
+      break;
+    case ORDER_GRB:
+      rgb_order = "GRB";
+      break;
+    case ORDER_GBR:
+      rgb_order = "GBR";
+      break;
+    case ORDER_BGR:
+      rgb_order = "BGR";
+      break;
+    case ORDER_BRG:
+      rgb_order = "BRG";
+      break;
+    default:
+      rgb_order = "UNKNOWN";
+      break;
+  }
+  ESP_LOGCONFIG(TAG,
+                "  RGB Order: %s\n"
+                "  Max refresh rate: %" PRIu32,
+                rgb_order, *this->max_refresh_rate_);
+}
+
+float ESP32ParallelLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32
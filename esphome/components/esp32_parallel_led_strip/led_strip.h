@@ -0,0 +1,119 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/core/color.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <esp_lcd_panel_io.h>
+#include <vector>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+enum RGBOrder : uint8_t {
+  ORDER_RGB,
+  ORDER_RBG,
+  ORDER_GRB,
+  ORDER_GBR,
+  ORDER_BGR,
+  ORDER_BRG,
+};
+
+/** Drives 8 or 16 LED strips of equal length at once through the LCD peripheral.
+ *
+ * Every bit is sent as a few clock slots on the bus, one bus line per strip. The slots that are the same for all
+ * strips (the start of every bit, the end and the reset) are written once at setup, so writing a frame only fills in
+ * the data slots. The DMA then sends the whole frame without the CPU.
+ *
+ * The strips appear as one light, strip after strip; use the partition platform to split them up.
+ */
+class ESP32ParallelLEDStripLightOutput : public light::AddressableLight {
+ public:
+  void setup() override;
+  void write_state(light::LightState *state) override;
+  float get_setup_priority() const override;
+
+  int32_t size() const override { return this->num_leds_ * this->pins_.size(); }
+  light::LightTraits get_traits() override {
+    auto traits = light::LightTraits();
+    if (this->is_rgbw_ || this->is_wrgb_) {
+      traits.set_supported_color_modes({light::ColorMode::RGB_WHITE, light::ColorMode::WHITE});
+    } else {
+      traits.set_supported_color_modes({light::ColorMode::RGB});
+    }
+    return traits;
+  }
+
+  void set_pins(const std::vector<uint8_t> &pins) { this->pins_ = pins; }
+  void set_clock_pin(uint8_t clock_pin) { this->clock_pin_ = clock_pin; }
+  void set_dc_pin(uint8_t dc_pin) { this->dc_pin_ = dc_pin; }
+  /// Set the number of LEDs on each strip.
+  void set_num_leds(uint16_t num_leds) { this->num_leds_ = num_leds; }
+  void set_is_rgbw(bool is_rgbw) { this->is_rgbw_ = is_rgbw; }
+  void set_is_wrgb(bool is_wrgb) { this->is_wrgb_ = is_wrgb; }
+
+  /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
+  void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
+
+  void set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high, uint32_t bit1_low,
+                      uint32_t reset_time_high, uint32_t reset_time_low);
+
+  void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
+
+  void clear_effect_data() override {
+    for (int i = 0; i < this->size(); i++)
+      this->effect_data_[i] = 0;
+  }
+
+  void dump_config() override;
+
+ protected:
+  light::ESPColorView get_view_internal(int32_t index) const override;
+
+  uint8_t get_bytes_per_led_() const { return this->is_rgbw_ || this->is_wrgb_ ? 4 : 3; }
+  size_t get_buffer_size_() const { return this->size() * this->get_bytes_per_led_(); }
+  /// Number of bus words in a frame, including the reset.
+  size_t get_frame_words_() const {
+    return this->num_leds_ * this->get_bytes_per_led_() * 8 * this->bit_slots_ + this->reset_high_slots_ +
+           this->reset_low_slots_;
+  }
+  template<typename T> void prepare_frame_(T *frame);
+  template<typename T> void encode_frame_(T *frame);
+
+  uint8_t *buf_{nullptr};
+  uint8_t *effect_data_{nullptr};
+  /// DMA buffer holding the frame as it is sent on the bus, one word per clock slot.
+  uint8_t *frame_{nullptr};
+  esp_lcd_i80_bus_handle_t bus_{nullptr};
+  esp_lcd_panel_io_handle_t io_{nullptr};
+  volatile bool transmitting_{false};
+
+  std::vector<uint8_t> pins_;
+  uint8_t clock_pin_;
+  uint8_t dc_pin_;
+  uint16_t num_leds_;
+  bool is_rgbw_{false};
+  bool is_wrgb_{false};
+
+  // Bus timing, in clock slots
+  uint32_t pclk_hz_{0};
+  uint8_t bit_slots_{0};
+  uint8_t bit0_slots_{0};  // slots high for a 0 bit
+  uint8_t bit1_slots_{0};  // slots high for a 1 bit
+  uint32_t reset_high_slots_{0};
+  uint32_t reset_low_slots_{0};
+
+  RGBOrder rgb_order_{ORDER_RGB};
+
+  uint32_t last_refresh_{0};
+  optional<uint32_t> max_refresh_rate_{};
+};
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32
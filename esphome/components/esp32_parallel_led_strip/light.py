@@ -0,0 +1,158 @@
+from esphome import pins
+import esphome.codegen as cg
+from esphome.components import esp32, light
+from esphome.components.esp32_rmt_led_strip.light import (
+    CHIPSETS,
+    CONF_BIT0_HIGH,
+    CONF_BIT0_LOW,
+    CONF_BIT1_HIGH,
+    CONF_BIT1_LOW,
+    CONF_IS_WRGB,
+    CONF_RESET_HIGH,
+    CONF_RESET_LOW,
+)
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_CHIPSET,
+    CONF_CLOCK_PIN,
+    CONF_DC_PIN,
+    CONF_IS_RGBW,
+    CONF_MAX_REFRESH_RATE,
+    CONF_NUM_LEDS,
+    CONF_OUTPUT_ID,
+    CONF_PINS,
+    CONF_RGB_ORDER,
+)
+
+DEPENDENCIES = ["esp32"]
+
+esp32_parallel_led_strip_ns = cg.esphome_ns.namespace("esp32_parallel_led_strip")
+ESP32ParallelLEDStripLightOutput = esp32_parallel_led_strip_ns.class_(
+    "ESP32ParallelLEDStripLightOutput", light.AddressableLight
+)
+
+RGBOrder = esp32_parallel_led_strip_ns.enum("RGBOrder")
+
+RGB_ORDERS = {
+    "RGB": RGBOrder.ORDER_RGB,
+    "RBG": RGBOrder.ORDER_RBG,
+    "GRB": RGBOrder.ORDER_GRB,
+    "GBR": RGBOrder.ORDER_GBR,
+    "BGR": RGBOrder.ORDER_BGR,
+    "BRG": RGBOrder.ORDER_BRG,
+}
+
+
+def validate_pins(value):
+    value = cv.ensure_list(pins.internal_gpio_output_pin_number)(value)
+    if len(value) not in (8, 16):
+        raise cv.Invalid(
+            "The LCD bus is 8 or 16 bits wide, give exactly 8 or 16 pins. "
+            "Lanes without a strip still need a pin."
+        )
+    return value
+
+
+def validate_timings(config):
+    if CONF_CHIPSET in config:
+        chipset = CHIPSETS[config[CONF_CHIPSET]]
+        bit0_high, bit1_high = chipset.bit0_high, chipset.bit1_high
+    else:
+        bit0_high = config[CONF_BIT0_HIGH].total_nanoseconds
+        bit1_high = config[CONF_BIT1_HIGH].total_nanoseconds
+    if bit1_high <= bit0_high:
+        raise cv.Invalid(
+            f"'{CONF_BIT1_HIGH}' must be longer than '{CONF_BIT0_HIGH}', "
+            "the encoder sends the difference as the data slots"
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    light.ADDRESSABLE_LIGHT_SCHEMA.extend(
+        {
+            cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(
+                ESP32ParallelLEDStripLightOutput
+            ),
+            cv.Required(CONF_PINS): validate_pins,
+            # The bus always drives a write clock and a D/C line, the strips use neither
+            cv.Required(CONF_CLOCK_PIN): pins.internal_gpio_output_pin_number,
+            cv.Required(CONF_DC_PIN): pins.internal_gpio_output_pin_number,
+            cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+            cv.Required(CONF_RGB_ORDER): cv.enum(RGB_ORDERS, upper=True),
+            cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
+            cv.Optional(CONF_CHIPSET): cv.one_of(*CHIPSETS, upper=True),
+            cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
+            cv.Optional(CONF_IS_WRGB, default=False): cv.boolean,
+            cv.Inclusive(
+                CONF_BIT0_HIGH,
+                "custom",
+            ): cv.positive_time_period_nanoseconds,
+            cv.Inclusive(
+                CONF_BIT0_LOW,
+                "custom",
+            ): cv.positive_time_period_nanoseconds,
+            cv.Inclusive(
+                CONF_BIT1_HIGH,
+                "custom",
+            ): cv.positive_time_period_nanoseconds,
+            cv.Inclusive(
+                CONF_BIT1_LOW,
+                "custom",
+            ): cv.positive_time_period_nanoseconds,
+            cv.Optional(
+                CONF_RESET_HIGH,
+                default="0 us",
+            ): cv.positive_time_period_nanoseconds,
+            cv.Optional(
+                CONF_RESET_LOW,
+                default="0 us",
+            ): cv.positive_time_period_nanoseconds,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_exactly_one_key(CONF_CHIPSET, CONF_BIT0_HIGH),
+    esp32.only_on_variant(supported=[esp32.const.VARIANT_ESP32S3]),
+    validate_timings,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
+    await light.register_light(var, config)
+    await cg.register_component(var, config)
+
+    cg.add(var.set_pins(config[CONF_PINS]))
+    cg.add(var.set_clock_pin(config[CONF_CLOCK_PIN]))
+    cg.add(var.set_dc_pin(config[CONF_DC_PIN]))
+    cg.add(var.set_num_leds(config[CONF_NUM_LEDS]))
+
+    if CONF_MAX_REFRESH_RATE in config:
+        cg.add(var.set_max_refresh_rate(config[CONF_MAX_REFRESH_RATE]))
+
+    if CONF_CHIPSET in config:
+        chipset = CHIPSETS[config[CONF_CHIPSET]]
+        cg.add(
+            var.set_led_params(
+                chipset.bit0_high,
+                chipset.bit0_low,
+                chipset.bit1_high,
+                chipset.bit1_low,
+                chipset.reset_high,
+                chipset.reset_low,
+            )
+        )
+    else:
+        cg.add(
+            var.set_led_params(
+                config[CONF_BIT0_HIGH],
+                config[CONF_BIT0_LOW],
+                config[CONF_BIT1_HIGH],
+                config[CONF_BIT1_LOW],
+                config[CONF_RESET_HIGH],
+                config[CONF_RESET_LOW],
+            )
+        )
+
+    cg.add(var.set_rgb_order(config[CONF_RGB_ORDER]))
+    cg.add(var.set_is_rgbw(config[CONF_IS_RGBW]))
+    cg.add(var.set_is_wrgb(config[CONF_IS_WRGB]))
@@ -22,6 +22,7 @@ static const char *const TAG = "esphome.ota";
 static constexpr uint16_t OTA_BLOCK_SIZE = 8192;
 static constexpr uint32_t OTA_SOCKET_TIMEOUT_HANDSHAKE = 10000;  // milliseconds for initial handshake
 static constexpr uint32_t OTA_SOCKET_TIMEOUT_DATA = 90000;       // milliseconds for data transfer
+static constexpr uint32_t OTA_RESUME_TIMEOUT = 60000;            // milliseconds an interrupted update is kept
 
 void ESPHomeOTAComponent::setup() {
 #ifdef USE_OTA_STATE_CALLBACK
@@ -92,9 +93,21 @@ void ESPHomeOTAComponent::loop() {
   if (this->client_ != nullptr || this->server_->ready()) {
     this->handle_handshake_();
   }
+
+  if (this->resume_backend_ != nullptr && this->client_ == nullptr &&
+      App.get_loop_component_start_time() - this->resume_time_ > OTA_RESUME_TIMEOUT) {
+    ESP_LOGW(TAG, "Uploader did not resume, aborting update");
+    this->abort_resume_();
+    this->status_clear_warning();
+    this->status_momentary_error("onerror", 5000);
+#ifdef USE_OTA_STATE_CALLBACK
+    this->state_callback_.call(ota::OTA_ERROR, 0.0f, static_cast<uint8_t>(ota::OTA_RESPONSE_ERROR_UNKNOWN));
+#endif
+  }
 }
 
 static const uint8_t FEATURE_SUPPORTS_COMPRESSION = 0x01;
+static const uint8_t FEATURE_SUPPORTS_RESUME = 0x02;
 
 void ESPHomeOTAComponent::handle_handshake_() {
   /// Handle the initial OTA handshake.
@@ -194,6 +207,9 @@ void ESPHomeOTAComponent::handle_data_() {
   char *sbuf = reinterpret_cast<char *>(buf);
   size_t ota_size;
   uint8_t ota_features;
+  bool resume_supported = false;
+  bool resuming = false;
+  uint32_t last_data = 0;
   std::unique_ptr<ota::OTABackend> backend;
   (void) ota_features;
 #if USE_OTA_VERSION == 2
@@ -214,6 +230,8 @@ void ESPHomeOTAComponent::handle_data_() {
   }
   ota_features = buf[0];  // NOLINT
   ESP_LOGV(TAG, "Features: 0x%02X", ota_features);
+  // Resuming relies on the chunk acknowledgements to tell the uploader what arrived
+  resume_supported = USE_OTA_VERSION == 2 && (ota_features & FEATURE_SUPPORTS_RESUME) != 0;
 
   // Acknowledge header - 1 byte
   buf[0] = ota::OTA_RESPONSE_HEADER_OK;
@@ -308,10 +326,22 @@ void ESPHomeOTAComponent::handle_data_() {
   this->state_callback_.call(ota::OTA_STARTED, 0.0f, 0);
 #endif
 
-  // This will block for a few seconds as it locks flash
-  error_code = backend->begin(ota_size);
-  if (error_code != ota::OTA_RESPONSE_OK)
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  // An interrupted update of the same size may be continued, the MD5 below decides
+  if (this->resume_backend_ != nullptr) {
+    if (resume_supported && this->resume_size_ == ota_size) {
+      backend = std::move(this->resume_backend_);
+      resuming = true;
+    } else {
+      this->abort_resume_();
+    }
+  }
+
+  if (!resuming) {
+    // This will block for a few seconds as it locks flash
+    error_code = backend->begin(ota_size);
+    if (error_code != ota::OTA_RESPONSE_OK)
+      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  }
   update_started = true;
 
   // Acknowledge prepare OK - 1 byte
@@ -325,36 +355,90 @@ void ESPHomeOTAComponent::handle_data_() {
   }
   sbuf[32] = '\0';
   ESP_LOGV(TAG, "Update: Binary MD5 is %s", sbuf);
-  backend->set_update_md5(sbuf);
+  if (resuming && memcmp(this->resume_md5_, sbuf, 32) != 0) {
+    // Same size but a different image, start over
+    backend->abort();
+    backend = ota::make_ota_backend();
+    resuming = false;
+    update_started = false;
+    error_code = backend->begin(ota_size);
+    if (error_code != ota::OTA_RESPONSE_OK)
+      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+    update_started = true;
+  }
 
-  // Acknowledge MD5 OK - 1 byte
-  buf[0] = ota::OTA_RESPONSE_BIN_MD5_OK;
-  this->writeall_(buf, 1);
+  if (resuming) {
+    total = this->resume_offset_;
+#if USE_OTA_VERSION == 2
+    size_acknowledged = total;
+#endif
+    ESP_LOGI(TAG, "Resuming update at %u of %u bytes", total, ota_size);
+    // Acknowledge resume - 1 byte, followed by the offset to continue from, 4 bytes MSB first
+    buf[0] = ota::OTA_RESPONSE_RESUME_OK;
+    buf[1] = (total >> 24) & 0xFF;
+    buf[2] = (total >> 16) & 0xFF;
+    buf[3] = (total >> 8) & 0xFF;
+    buf[4] = total & 0xFF;
+    this->writeall_(buf, 5);
+  } else {
+    backend->set_update_md5(sbuf);
+    memcpy(this->resume_md5_, sbuf, sizeof(this->resume_md5_));
+
+    // Acknowledge MD5 OK - 1 byte
+    buf[0] = ota::OTA_RESPONSE_BIN_MD5_OK;
+    this->writeall_(buf, 1);
+  }
+
+  last_data = millis();
 
   while (total < ota_size) {
-    // TODO: timeout check
     size_t requested = std::min(sizeof(buf), ota_size - total);
-    ssize_t read = this->client_->read(buf, requested);
+    // Flash straight from the receive buffer of the socket if it has one, otherwise copy into buf first
+    uint8_t *data;
+    ssize_t read = this->client_->peek(&data);
+    bool peeked = read != -1 || errno != EOPNOTSUPP;
+    if (!peeked) {
+      data = buf;
+      read = this->client_->read(buf, requested);
+    } else if (read > 0 && static_cast<size_t>(read) > requested) {
+      read = requested;
+    }
     if (read == -1) {
       if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        // A new connection while this one has stalled means the uploader gave up on it
+        if (resume_supported && this->server_->ready()) {
+          ESP_LOGW(TAG, "Uploader reconnected");
+          goto suspend;  // NOLINT(cppcoreguidelines-avoid-goto)
+        }
+        if (millis() - last_data > OTA_SOCKET_TIMEOUT_DATA) {
+          ESP_LOGW(TAG, "Timeout receiving data");
+          goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+        }
         this->yield_and_feed_watchdog_();
         continue;
       }
       ESP_LOGW(TAG, "Read error, errno %d", errno);
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      if (resume_supported)
+        goto suspend;  // NOLINT(cppcoreguidelines-avoid-goto)
+      goto error;      // NOLINT(cppcoreguidelines-avoid-goto)
     } else if (read == 0) {
       // $ man recv
       // "When  a  stream socket peer has performed an orderly shutdown, the return value will
       // be 0 (the traditional "end-of-file" return)."
       ESP_LOGW(TAG, "Remote closed connection");
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      if (resume_supported)
+        goto suspend;  // NOLINT(cppcoreguidelines-avoid-goto)
+      goto error;      // NOLINT(cppcoreguidelines-avoid-goto)
     }
+    last_data = millis();
 
-    error_code = backend->write(buf, read);
+    error_code = backend->write(data, read);
     if (error_code != ota::OTA_RESPONSE_OK) {
       ESP_LOGW(TAG, "Flash write error, code: %d", error_code);
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
     }
+    if (peeked)
+      this->client_->consume(read);
     total += read;
 #if USE_OTA_VERSION == 2
     while (size_acknowledged + OTA_BLOCK_SIZE <= total || (total == ota_size && size_acknowledged < ota_size)) {
@@ -407,6 +491,16 @@ void ESPHomeOTAComponent::handle_data_() {
   delay(100);  // NOLINT
   App.safe_reboot();
 
+suspend:
+  // Keep the update open, the uploader can reconnect and continue from what was written so far
+  this->cleanup_connection_();
+  this->resume_backend_ = std::move(backend);
+  this->resume_size_ = ota_size;
+  this->resume_offset_ = total;
+  this->resume_time_ = millis();
+  ESP_LOGI(TAG, "Update interrupted at %u of %u bytes, waiting for the uploader to resume", total, ota_size);
+  return;
+
 error:
   buf[0] = static_cast<uint8_t>(error_code);
   this->writeall_(buf, 1);
@@ -494,6 +588,11 @@ void ESPHomeOTAComponent::cleanup_connection_() {
   this->magic_buf_pos_ = 0;
 }
 
+void ESPHomeOTAComponent::abort_resume_() {
+  this->resume_backend_->abort();
+  this->resume_backend_ = nullptr;
+}
+
 void ESPHomeOTAComponent::yield_and_feed_watchdog_() {
   App.feed_wdt();
   delay(1);
@@ -37,6 +37,7 @@ class ESPHomeOTAComponent : public ota::OTAComponent {
   void log_start_(const LogString *phase);
   void cleanup_connection_();
   void yield_and_feed_watchdog_();
+  void abort_resume_();
 
 #ifdef USE_OTA_PASSWORD
   std::string password_;
@@ -49,6 +50,13 @@ class ESPHomeOTAComponent : public ota::OTAComponent {
   uint16_t port_;
   uint8_t magic_buf_[5];
   uint8_t magic_buf_pos_{0};
+
+  /// Update interrupted by a lost connection, kept open until the uploader reconnects to continue it.
+  std::unique_ptr<ota::OTABackend> resume_backend_;
+  size_t resume_size_{0};
+  size_t resume_offset_{0};
+  uint32_t resume_time_{0};
+  char resume_md5_[33];
 };
 
 }  // namespace esphome
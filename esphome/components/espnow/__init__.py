@@ -55,6 +55,7 @@ OnBroadcastedTrigger = espnow_ns.class_(
 
 
 CONF_AUTO_ADD_PEER = "auto_add_peer"
+CONF_DATA_RATE = "data_rate"
 CONF_PEERS = "peers"
 CONF_ON_SENT = "on_sent"
 CONF_ON_UNKNOWN_PEER = "on_unknown_peer"
@@ -64,6 +65,26 @@ CONF_WAIT_FOR_SENT = "wait_for_sent"
 
 MAX_ESPNOW_PACKET_SIZE = 250  # Maximum size of the payload in bytes
 
+wifi_phy_rate_t = cg.global_ns.enum("wifi_phy_rate_t")
+DATA_RATES = {
+    "1MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_1M_L,
+    "2MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_2M,
+    "5.5MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_5M_L,
+    "11MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_11M_L,
+    "6MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_6M,
+    "9MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_9M,
+    "12MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_12M,
+    "18MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_18M,
+    "24MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_24M,
+    "36MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_36M,
+    "48MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_48M,
+    "54MBPS": wifi_phy_rate_t.WIFI_PHY_RATE_54M,
+    **{
+        f"MCS{i}": getattr(wifi_phy_rate_t, f"WIFI_PHY_RATE_MCS{i}_LGI")
+        for i in range(8)
+    },
+}
+
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -72,6 +93,7 @@ CONFIG_SCHEMA = cv.All(
             cv.OnlyWithout(CONF_CHANNEL, CONF_WIFI): wifi.validate_channel,
             cv.Optional(CONF_ENABLE_ON_BOOT, default=True): cv.boolean,
             cv.Optional(CONF_AUTO_ADD_PEER, default=False): cv.boolean,
+            cv.Optional(CONF_DATA_RATE): cv.enum(DATA_RATES, upper=True),
             cv.Optional(CONF_PEERS): cv.ensure_list(cv.mac_address),
             cv.Optional(CONF_ON_UNKNOWN_PEER): automation.validate_automation(
                 {
@@ -125,6 +147,8 @@ async def to_code(config):
         cg.add(var.set_wifi_channel(wifi_channel))
 
     cg.add(var.set_auto_add_peer(config[CONF_AUTO_ADD_PEER]))
+    if CONF_DATA_RATE in config:
+        cg.add(var.set_data_rate(config[CONF_DATA_RATE]))
 
     for peer in config.get(CONF_PEERS, []):
         cg.add(var.add_peer(peer.parts))
@@ -132,6 +132,8 @@ void ESPNowComponent::dump_config() {
                 "  Version: v%" PRIu32 "\n"
                 "  Wi-Fi channel: %d",
                 format_mac_address_pretty(this->own_address_).c_str(), version, this->wifi_channel_);
+  if (this->data_rate_.has_value())
+    ESP_LOGCONFIG(TAG, "  Data rate: 0x%02X", *this->data_rate_);
 #ifdef USE_WIFI
   ESP_LOGCONFIG(TAG, "  Wi-Fi enabled: %s", YESNO(this->is_wifi_enabled()));
 #endif
@@ -203,6 +205,15 @@ void ESPNowComponent::enable_() {
 
   esp_wifi_get_mac(WIFI_IF_STA, this->own_address_);
 
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 4, 0)
+  // older versions only have a rate for all peers
+  if (this->data_rate_.has_value()) {
+    err = esp_wifi_config_espnow_rate(WIFI_IF_STA, *this->data_rate_);
+    if (err != ESP_OK)
+      ESP_LOGW(TAG, "Setting data rate failed: %s", esp_err_to_name(err));
+  }
+#endif
+
 #ifdef USE_DEEP_SLEEP
   esp_now_set_wake_window(CONFIG_ESPNOW_WAKE_WINDOW);
   esp_wifi_connectionless_module_set_wake_interval(CONFIG_ESPNOW_WAKE_INTERVAL);
@@ -424,6 +435,7 @@ esp_err_t ESPNowComponent::add_peer(const uint8_t *peer) {
       this->status_momentary_warning("peer-add-failed");
       return err;
     }
+    this->apply_data_rate_(peer);
   }
   bool found = false;
   for (auto &it : this->peers_) {
@@ -441,6 +453,28 @@ esp_err_t ESPNowComponent::add_peer(const uint8_t *peer) {
   return ESP_OK;
 }
 
+void ESPNowComponent::apply_data_rate_(const uint8_t *peer) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 0)
+  if (!this->data_rate_.has_value())
+    return;
+  esp_now_rate_config_t config = {};
+  config.rate = *this->data_rate_;
+  // the rates are ordered as 802.11b, 802.11g and then the 802.11n MCS rates
+  if (config.rate < WIFI_PHY_RATE_48M) {
+    config.phymode = WIFI_PHY_MODE_11B;
+  } else if (config.rate < WIFI_PHY_RATE_MCS0_LGI) {
+    config.phymode = WIFI_PHY_MODE_11G;
+  } else {
+    config.phymode = WIFI_PHY_MODE_HT20;
+  }
+  esp_err_t err = esp_now_set_peer_rate_config(peer, &config);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Setting data rate for %s failed - %s", format_mac_address_pretty(peer).c_str(),
+             LOG_STR_ARG(espnow_error_to_str(err)));
+  }
+#endif
+}
+
 esp_err_t ESPNowComponent::del_peer(const uint8_t *peer) {
   if (this->state_ != ESPNOW_STATE_ENABLED || this->is_failed()) {
     return ESP_ERR_ESPNOW_NOT_INIT;
@@ -2,6 +2,7 @@
 
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
+#include "esphome/core/optional.h"
 
 #ifdef USE_ESP32
 
@@ -13,6 +14,7 @@
 
 #include <esp_mac.h>
 #include <esp_now.h>
+#include <esp_wifi_types.h>
 
 #include <array>
 #include <map>
@@ -113,6 +115,8 @@ class ESPNowComponent : public Component {
   uint8_t get_wifi_channel();
 
   void set_auto_add_peer(bool value) { this->auto_add_peer_ = value; }
+  /// Set the PHY rate used to send to peers, the default of 1 Mbps has the longest range.
+  void set_data_rate(wifi_phy_rate_t data_rate) { this->data_rate_ = data_rate; }
 
   void enable();
   void disable();
@@ -154,6 +158,7 @@ class ESPNowComponent : public Component {
 
   void enable_();
   void send_();
+  void apply_data_rate_(const uint8_t *peer);
 
   std::vector<ESPNowUnknownPeerHandler *> unknown_peer_handlers_;
   std::vector<ESPNowReceivedPacketHandler *> received_handlers_;
@@ -171,6 +176,7 @@ class ESPNowComponent : public Component {
 
   uint8_t wifi_channel_{0};
   ESPNowState state_{ESPNOW_STATE_OFF};
+  optional<wifi_phy_rate_t> data_rate_{};
 
   bool auto_add_peer_{false};
   bool enable_on_boot_{true};
@@ -60,6 +60,9 @@ CONF_CLK = "clk"
 CONF_CLK_MODE = "clk_mode"
 CONF_POWER_PIN = "power_pin"
 CONF_PHY_REGISTERS = "phy_registers"
+CONF_DMA_RX_BUFFERS = "dma_rx_buffers"
+CONF_DMA_TX_BUFFERS = "dma_tx_buffers"
+CONF_DMA_BUFFER_SIZE = "dma_buffer_size"
 
 CONF_CLOCK_SPEED = "clock_speed"
 
@@ -198,6 +201,12 @@ CLK_SCHEMA = cv.Schema(
         cv.Required(CONF_PIN): pins.internal_gpio_pin_number,
     }
 )
+def _validate_dma_buffer_size(value):
+    if value % 4 != 0:
+        raise cv.Invalid("DMA buffer size must be a multiple of 4")
+    return value
+
+
 RMII_SCHEMA = BASE_SCHEMA.extend(
     cv.Schema(
         {
@@ -210,6 +219,12 @@ RMII_SCHEMA = BASE_SCHEMA.extend(
             cv.Optional(CONF_PHY_ADDR, default=0): cv.int_range(min=0, max=31),
             cv.Optional(CONF_POWER_PIN): pins.internal_gpio_output_pin_number,
             cv.Optional(CONF_PHY_REGISTERS): cv.ensure_list(PHY_REGISTER_SCHEMA),
+            # DMA descriptors of the internal EMAC, the ESP-IDF defaults are 10 each
+            cv.Optional(CONF_DMA_RX_BUFFERS): cv.int_range(min=3, max=30),
+            cv.Optional(CONF_DMA_TX_BUFFERS): cv.int_range(min=3, max=30),
+            cv.Optional(CONF_DMA_BUFFER_SIZE): cv.All(
+                cv.int_range(min=256, max=1600), _validate_dma_buffer_size
+            ),
         }
     )
 )
@@ -338,6 +353,18 @@ async def to_code(config):
                 register_value.get(CONF_PAGE_ID),
             )
             cg.add(var.add_phy_register(reg))
+        if CONF_DMA_RX_BUFFERS in config:
+            add_idf_sdkconfig_option(
+                "CONFIG_ETH_DMA_RX_BUFFER_NUM", config[CONF_DMA_RX_BUFFERS]
+            )
+        if CONF_DMA_TX_BUFFERS in config:
+            add_idf_sdkconfig_option(
+                "CONFIG_ETH_DMA_TX_BUFFER_NUM", config[CONF_DMA_TX_BUFFERS]
+            )
+        if CONF_DMA_BUFFER_SIZE in config:
+            add_idf_sdkconfig_option(
+                "CONFIG_ETH_DMA_BUFFER_SIZE", config[CONF_DMA_BUFFER_SIZE]
+            )
 
     cg.add(var.set_type(ETHERNET_TYPES[config[CONF_TYPE]]))
     cg.add(var.set_use_address(config[CONF_USE_ADDRESS]))
@@ -2,6 +2,9 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
+#ifdef USE_BOOT_TIMELINE
+#include "esphome/components/boot_timeline/boot_timeline.h"
+#endif
 
 #ifdef USE_ESP32
 
@@ -285,6 +288,10 @@ void EthernetComponent::loop() {
         // connection established
         ESP_LOGI(TAG, "Connected");
         this->state_ = EthernetComponentState::CONNECTED;
+#ifdef USE_BOOT_TIMELINE
+        if (global_boot_timeline != nullptr)
+          global_boot_timeline->record_once(boot_timeline::BOOT_EVENT_NETWORK_CONNECTED);
+#endif
 
         this->dump_connect_params_();
         this->status_clear_warning();
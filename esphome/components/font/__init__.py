@@ -57,6 +57,13 @@ CONF_EXTRAS = "extras"
 CONF_FONTS = "fonts"
 CONF_GLYPHSETS = "glyphsets"
 CONF_IGNORE_MISSING_GLYPHS = "ignore_missing_glyphs"
+CONF_RUN_LENGTH_ENCODING = "run_length_encoding"
+
+# Run types of run length encoded glyphs, must match font.h
+RLE_TRANSPARENT = 0x00
+RLE_SOLID = 0x40
+RLE_LITERAL = 0x80
+RLE_MAX_LENGTH = 64
 
 
 # Cache loaded freetype fonts
@@ -454,6 +461,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Optional(CONF_IGNORE_MISSING_GLYPHS, default=False): cv.boolean,
         cv.Optional(CONF_SIZE): cv.int_range(min=1),
         cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8),
+        cv.Optional(CONF_RUN_LENGTH_ENCODING, default=False): cv.boolean,
         cv.Optional(CONF_EXTRAS, default=[]): cv.ensure_list(
             cv.Schema(
                 {
@@ -487,7 +495,58 @@ class GlyphInfo:
         self.height = height
 
 
-def glyph_to_glyphinfo(glyph, font, size, bpp):
+def pack_pixels(pixels, bpp):
+    data = [0] * ((len(pixels) * bpp + 7) // 8)
+    pos = 0
+    for pixel in pixels:
+        for bit_num in range(bpp):
+            if pixel & (1 << (bpp - bit_num - 1)):
+                data[pos // 8] |= 0x80 >> (pos % 8)
+            pos += 1
+    return data
+
+
+def run_length_encode(pixels, bpp):
+    """
+    Encode glyph pixels, in rows from the top, as a sequence of runs.
+    Each run starts with a byte holding the run type in the top two bits and the
+    length less one in the rest. Transparent and solid runs need no further data,
+    literal runs are followed by their pixels packed as in an unencoded glyph.
+    """
+    solid = (1 << bpp) - 1
+    data = []
+    literal = []
+
+    def flush_literal():
+        for start in range(0, len(literal), RLE_MAX_LENGTH):
+            chunk = literal[start : start + RLE_MAX_LENGTH]
+            data.append(RLE_LITERAL | (len(chunk) - 1))
+            data.extend(pack_pixels(chunk, bpp))
+        literal.clear()
+
+    pos = 0
+    while pos < len(pixels):
+        pixel = pixels[pos]
+        length = 1
+        while (
+            pos + length < len(pixels)
+            and pixels[pos + length] == pixel
+            and length < RLE_MAX_LENGTH
+        ):
+            length += 1
+        # a single transparent or solid pixel among blended ones is cheaper
+        # as part of a literal run
+        if pixel in (0, solid) and (length > 1 or bpp == 1):
+            flush_literal()
+            data.append((RLE_SOLID if pixel else RLE_TRANSPARENT) | (length - 1))
+        else:
+            literal.extend(pixels[pos : pos + length])
+        pos += length
+    flush_literal()
+    return data
+
+
+def glyph_to_glyphinfo(glyph, font, size, bpp, rle=False):
     scale = 256 // (1 << bpp)
     if not font.is_scalable:
         sizes = [pt_to_px(x.size) for x in font.available_sizes]
@@ -505,9 +564,8 @@ def glyph_to_glyphinfo(glyph, font, size, bpp):
     height = font.glyph.bitmap.rows
     buffer = font.glyph.bitmap.buffer
     pitch = font.glyph.bitmap.pitch
-    glyph_data = [0] * ((height * width * bpp + 7) // 8)
     src_mode = font.glyph.bitmap.pixel_mode
-    pos = 0
+    pixels = []
     for y in range(height):
         for x in range(width):
             if src_mode == ft_pixel_mode_mono:
@@ -518,10 +576,11 @@ def glyph_to_glyphinfo(glyph, font, size, bpp):
                 )
             else:
                 pixel = buffer[y * pitch + x] // scale
-            for bit_num in range(bpp):
-                if pixel & (1 << (bpp - bit_num - 1)):
-                    glyph_data[pos // 8] |= 0x80 >> (pos % 8)
-                pos += 1
+            pixels.append(pixel)
+    if rle:
+        glyph_data = run_length_encode(pixels, bpp)
+    else:
+        glyph_data = pack_pixels(pixels, bpp)
     ascender = pt_to_px(font.size.ascender)
     if ascender == 0:
         if not font.is_scalable:
@@ -575,8 +634,9 @@ async def to_code(config):
     bpp = config[CONF_BPP]
     size = config[CONF_SIZE]
     # create the data array for all glyphs
+    rle = config[CONF_RUN_LENGTH_ENCODING]
     glyph_args = [
-        glyph_to_glyphinfo(x, point_font_map[x], size, bpp) for x in codepoints
+        glyph_to_glyphinfo(x, point_font_map[x], size, bpp, rle) for x in codepoints
     ]
     rhs = [HexInt(x) for x in flatten([x.bitmap_data for x in glyph_args])]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
@@ -629,4 +689,5 @@ async def to_code(config):
         xheight,
         capheight,
         bpp,
+        rle,
     )
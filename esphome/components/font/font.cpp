@@ -46,14 +46,15 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
 }
 
 Font::Font(const GlyphData *data, int data_nr, int baseline, int height, int descender, int xheight, int capheight,
-           uint8_t bpp)
+           uint8_t bpp, bool rle)
     : baseline_(baseline),
       height_(height),
       descender_(descender),
       linegap_(height - baseline - descender),
       xheight_(xheight),
       capheight_(capheight),
-      bpp_(bpp) {
+      bpp_(bpp),
+      rle_(rle) {
   glyphs_.reserve(data_nr);
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(&data[i]);
@@ -111,6 +112,27 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
   int i = 0;
   int x_at = x_start;
   int scan_x1, scan_y1, scan_width, scan_height;
+  const uint8_t bpp_max = (1 << this->bpp_) - 1;
+  auto diff_r = (float) color.r - (float) background.r;
+  auto diff_g = (float) color.g - (float) background.g;
+  auto diff_b = (float) color.b - (float) background.b;
+  auto diff_w = (float) color.w - (float) background.w;
+  auto b_r = (float) background.r;
+  auto b_g = (float) background.g;
+  auto b_b = (float) background.b;
+  auto b_w = (float) background.w;
+  auto blend = [&](uint8_t pixel) {
+    auto on = (float) pixel / (float) bpp_max;
+    return Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b),
+                 (uint8_t) (diff_w * on + b_w));
+  };
+  // with up to 16 levels the blended colours are worked out once for the whole string
+  Color palette[16];
+  if (this->bpp_ <= 4) {
+    for (uint8_t level = 1; level < bpp_max; level++)
+      palette[level] = blend(level);
+  }
+  auto pixel_color = [&](uint8_t pixel) { return this->bpp_ <= 4 ? palette[pixel] : blend(pixel); };
   while (text[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
@@ -136,16 +158,59 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
 
     uint8_t bitmask = 0;
     uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
+    if (this->rle_) {
+      // runs are in rows from the top and may continue on the next row.
+      const int glyph_x1 = x_at + scan_x1;
+      const int glyph_y1 = y_start + scan_y1;
+      const int total = scan_width * scan_height;
+      int pos = 0;
+      while (pos < total) {
+        uint8_t header = progmem_read_byte(data++);
+        int length = (header & ~RLE_TYPE_MASK) + 1;
+        switch (header & RLE_TYPE_MASK) {
+          case RLE_SOLID:
+            while (length != 0) {
+              int x = pos % scan_width;
+              int span = std::min(length, scan_width - x);
+              display->fill_span(glyph_x1 + x, glyph_y1 + pos / scan_width, span, color);
+              pos += span;
+              length -= span;
+            }
+            break;
+          case RLE_LITERAL:
+            bitmask = 0;
+            for (; length != 0; length--, pos++) {
+              uint8_t pixel = 0;
+              for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
+                if (bitmask == 0) {
+                  pixel_data = progmem_read_byte(data++);
+                  bitmask = 0x80;
+                }
+                pixel <<= 1;
+                if ((pixel_data & bitmask) != 0)
+                  pixel |= 1;
+                bitmask >>= 1;
+              }
+              if (pixel == bpp_max) {
+                display->draw_pixel_at(glyph_x1 + pos % scan_width, glyph_y1 + pos / scan_width, color);
+              } else if (pixel != 0) {
+                display->draw_pixel_at(glyph_x1 + pos % scan_width, glyph_y1 + pos / scan_width,
+                                       pixel_color(pixel));
+              }
+            }
+            break;
+          default:
+            pos += length;
+            break;
+        }
+      }
+      x_at += glyph.glyph_data_->advance;
+      i += match_length;
+      continue;
+    }
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+      // fully set pixels are collected into runs and drawn as one span
+      int run_start = max_x;
       for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
@@ -159,14 +224,19 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
           bitmask >>= 1;
         }
         if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
+          if (run_start == max_x)
+            run_start = glyph_x;
+          continue;
+        }
+        if (run_start != max_x) {
+          display->fill_span(run_start, glyph_y, glyph_x - run_start, color);
+          run_start = max_x;
         }
+        if (pixel != 0)
+          display->draw_pixel_at(glyph_x, glyph_y, pixel_color(pixel));
       }
+      if (run_start != max_x)
+        display->fill_span(run_start, glyph_y, max_x - run_start, color);
     }
     x_at += glyph.glyph_data_->advance;
 
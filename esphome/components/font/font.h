@@ -12,6 +12,12 @@ namespace font {
 
 class Font;
 
+// Run types of run length encoded glyphs, stored in the top two bits of the byte that starts each run.
+static const uint8_t RLE_TYPE_MASK = 0xC0;
+static const uint8_t RLE_TRANSPARENT = 0x00;
+static const uint8_t RLE_SOLID = 0x40;
+static const uint8_t RLE_LITERAL = 0x80;
+
 struct GlyphData {
   const uint8_t *a_char;
   const uint8_t *data;
@@ -58,9 +64,10 @@ class Font
    * @param xheight The height of lowercase letters, usually measured at the "x" glyph.
    * @param capheight The height of capital letters, usually measured at the "X" glyph.
    * @param bpp The bits per pixel used for this font. Used to read data out of the glyph bitmaps.
+   * @param rle Whether the glyph bitmaps are run length encoded.
    */
   Font(const GlyphData *data, int data_nr, int baseline, int height, int descender, int xheight, int capheight,
-       uint8_t bpp = 1);
+       uint8_t bpp = 1, bool rle = false);
 
   int match_next_glyph(const uint8_t *str, int *match_length);
 
@@ -77,6 +84,7 @@ class Font
   inline int get_xheight() { return this->xheight_; }
   inline int get_capheight() { return this->capheight_; }
   inline int get_bpp() { return this->bpp_; }
+  inline bool is_rle() { return this->rle_; }
 
   const std::vector<Glyph, RAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
@@ -89,6 +97,7 @@ class Font
   int xheight_;
   int capheight_;
   uint8_t bpp_;  // bits per pixel
+  bool rle_;     // glyph bitmaps are run length encoded
 };
 
 }  // namespace font
@@ -1,11 +1,15 @@
 #include "gps.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace gps {
 
 static const char *const TAG = "gps";
 
+static const size_t GPS_READ_CHUNK_SIZE = 64;
+
 TinyGPSPlus &GPSListener::get_tiny_gps() { return this->parent_->get_tiny_gps(); }
 
 void GPS::dump_config() {
@@ -50,44 +54,54 @@ void GPS::update() {
 }
 
 void GPS::loop() {
-  while (this->available() > 0 && !this->has_time_) {
-    if (!this->tiny_gps_.encode(this->read())) {
-      continue;
-    }
-    if (this->tiny_gps_.location.isUpdated()) {
-      this->latitude_ = this->tiny_gps_.location.lat();
-      this->longitude_ = this->tiny_gps_.location.lng();
-      ESP_LOGV(TAG, "Latitude, Longitude: %.6f°, %.6f°", this->latitude_, this->longitude_);
+  // Read in chunks, at 10 Hz with all sentences enabled a module sends several kB per second
+  uint8_t chunk[GPS_READ_CHUNK_SIZE];
+  size_t avail;
+  while ((avail = this->available()) > 0 && !this->has_time_) {
+    const size_t len = std::min(avail, sizeof(chunk));
+    if (!this->read_array(chunk, len))
+      return;
+    for (size_t i = 0; i < len; i++) {
+      if (this->tiny_gps_.encode(chunk[i]))
+        this->handle_sentence_();
     }
+  }
+}
 
-    if (this->tiny_gps_.speed.isUpdated()) {
-      this->speed_ = this->tiny_gps_.speed.kmph();
-      ESP_LOGV(TAG, "Speed: %.3f km/h", this->speed_);
-    }
+void GPS::handle_sentence_() {
+  if (this->tiny_gps_.location.isUpdated()) {
+    this->latitude_ = this->tiny_gps_.location.lat();
+    this->longitude_ = this->tiny_gps_.location.lng();
+    ESP_LOGV(TAG, "Latitude, Longitude: %.6f°, %.6f°", this->latitude_, this->longitude_);
+  }
 
-    if (this->tiny_gps_.course.isUpdated()) {
-      this->course_ = this->tiny_gps_.course.deg();
-      ESP_LOGV(TAG, "Course: %.2f°", this->course_);
-    }
+  if (this->tiny_gps_.speed.isUpdated()) {
+    this->speed_ = this->tiny_gps_.speed.kmph();
+    ESP_LOGV(TAG, "Speed: %.3f km/h", this->speed_);
+  }
 
-    if (this->tiny_gps_.altitude.isUpdated()) {
-      this->altitude_ = this->tiny_gps_.altitude.meters();
-      ESP_LOGV(TAG, "Altitude: %.2f m", this->altitude_);
-    }
+  if (this->tiny_gps_.course.isUpdated()) {
+    this->course_ = this->tiny_gps_.course.deg();
+    ESP_LOGV(TAG, "Course: %.2f°", this->course_);
+  }
 
-    if (this->tiny_gps_.satellites.isUpdated()) {
-      this->satellites_ = this->tiny_gps_.satellites.value();
-      ESP_LOGV(TAG, "Satellites: %d", this->satellites_);
-    }
+  if (this->tiny_gps_.altitude.isUpdated()) {
+    this->altitude_ = this->tiny_gps_.altitude.meters();
+    ESP_LOGV(TAG, "Altitude: %.2f m", this->altitude_);
+  }
 
-    if (this->tiny_gps_.hdop.isUpdated()) {
-      this->hdop_ = this->tiny_gps_.hdop.hdop();
-      ESP_LOGV(TAG, "HDOP: %.3f", this->hdop_);
-    }
+  if (this->tiny_gps_.satellites.isUpdated()) {
+    this->satellites_ = this->tiny_gps_.satellites.value();
+    ESP_LOGV(TAG, "Satellites: %d", this->satellites_);
+  }
 
-    for (auto *listener : this->listeners_) {
-      listener->on_update(this->tiny_gps_);
-    }
+  if (this->tiny_gps_.hdop.isUpdated()) {
+    this->hdop_ = this->tiny_gps_.hdop.hdop();
+    ESP_LOGV(TAG, "HDOP: %.3f", this->hdop_);
+  }
+
+  for (auto *listener : this->listeners_) {
+    listener->on_update(this->tiny_gps_);
   }
 }
 
@@ -46,6 +46,9 @@ class GPS : public PollingComponent, public uart::UARTDevice {
   TinyGPSPlus &get_tiny_gps() { return this->tiny_gps_; }
 
  protected:
+  /// Takes over the values of a sentence that passed its checksum.
+  void handle_sentence_();
+
   float latitude_{NAN};
   float longitude_{NAN};
   float speed_{NAN};
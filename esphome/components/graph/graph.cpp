@@ -26,24 +26,46 @@ void HistoryData::take_sample(float data) {
   // Step data based on time
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
+    float old = this->samples_[this->count_];
     this->samples_[this->count_] = data;
     this->period_ -= this->update_time_;
     this->count_ = (this->count_ + 1) % this->length_;
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
+    // Only losing one of the extremes requires looking at all samples again
+    if (old == this->samples_min_ || old == this->samples_max_) {
+      this->range_stale_ = true;
+    } else if (!std::isnan(data)) {
+      if (std::isnan(this->samples_min_) || data < this->samples_min_)
+        this->samples_min_ = data;
+      if (std::isnan(this->samples_max_) || data > this->samples_max_)
+        this->samples_max_ = data;
+    }
   }
   if (!std::isnan(data)) {
+    if (this->range_stale_)
+      this->scan_range_();
     // Recalc recent max/min
     this->recent_min_ = data;
     this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
+    if (!std::isnan(this->samples_min_)) {
+      this->recent_min_ = std::min(this->recent_min_, this->samples_min_);
+      this->recent_max_ = std::max(this->recent_max_, this->samples_max_);
+    }
+  }
+}
+
+void HistoryData::scan_range_() {
+  this->samples_min_ = NAN;
+  this->samples_max_ = NAN;
+  for (float sample : this->samples_) {
+    if (!std::isnan(sample)) {
+      if (std::isnan(this->samples_max_) || this->samples_max_ < sample)
+        this->samples_max_ = sample;
+      if (std::isnan(this->samples_min_) || this->samples_min_ > sample)
+        this->samples_min_ = sample;
     }
   }
+  this->range_stale_ = false;
 }
 
 void GraphTrace::init(Graph *g) {
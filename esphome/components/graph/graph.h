@@ -5,6 +5,7 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/core/color.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 
@@ -102,7 +103,15 @@ class HistoryData {
   int count_{0};
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
+  /// Range of the stored samples, kept up to date as samples come in.
+  float samples_min_{NAN};
+  float samples_max_{NAN};
+  /// A sample holding the minimum or maximum was overwritten, so the range needs a full scan.
+  bool range_stale_{false};
+  /// One sample per pixel, which for long graphs is best kept in PSRAM when there is some.
+  std::vector<float, RAMAllocator<float>> samples_;
+
+  void scan_range_();
 };
 
 class GraphTrace {
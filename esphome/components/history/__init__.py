@@ -0,0 +1,32 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import CONF_ACCURACY, CONF_ID, CONF_SENSOR, CONF_SIZE
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["sensor"]
+MULTI_CONF = True
+
+history_ns = cg.esphome_ns.namespace("history")
+SensorHistory = history_ns.class_("SensorHistory", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(SensorHistory),
+        cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_SIZE, default=1024): cv.int_range(min=16, max=65535),
+        cv.Optional(CONF_ACCURACY): cv.positive_not_null_float,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    sens = await cg.get_variable(config[CONF_SENSOR])
+    cg.add(var.set_sensor(sens))
+    cg.add(var.set_size(config[CONF_SIZE]))
+    if CONF_ACCURACY in config:
+        cg.add(var.set_accuracy(config[CONF_ACCURACY]))
+    cg.add_define("USE_HISTORY")
@@ -0,0 +1,113 @@
+#include "history.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cmath>
+
+namespace esphome {
+namespace history {
+
+static const char *const TAG = "history";
+
+void SensorHistory::setup() {
+  if (std::isnan(this->accuracy_)) {
+    int8_t decimals = clamp<int8_t>(this->sensor_->get_accuracy_decimals(), 0, 4);
+    this->accuracy_ = powf(10.0f, -decimals);
+  }
+  this->entries_.resize(this->size_);
+  this->last_time_ = millis();
+  histories_().push_back(this);
+  this->sensor_->add_on_state_callback([this](float state) { this->add_sample_(state); });
+}
+
+void SensorHistory::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Sensor History '%s':\n"
+                "  Size: %u\n"
+                "  Accuracy: %g",
+                this->sensor_->get_name().c_str(), this->size_, this->accuracy_);
+}
+
+void SensorHistory::add_sample_(float value) {
+  LockGuard guard(this->lock_);
+  uint32_t delta = (millis() - this->last_time_) / DELTA_UNIT;
+  // Bridge gaps longer than one entry can tell with empty entries
+  while (delta > UINT16_MAX) {
+    this->push_(UINT16_MAX, NAN_VALUE);
+    delta -= UINT16_MAX;
+  }
+  int16_t quantised = NAN_VALUE;
+  if (std::isfinite(value)) {
+    if (std::isnan(this->base_))
+      this->base_ = value;
+    float steps = roundf((value - this->base_) / this->accuracy_);
+    quantised = static_cast<int16_t>(clamp(steps, float(INT16_MIN + 1), float(INT16_MAX)));
+  }
+  this->push_(delta, quantised);
+}
+
+void SensorHistory::push_(uint16_t delta, int16_t value) {
+  this->entries_[this->head_] = {delta, value};
+  this->head_ = (this->head_ + 1) % this->size_;
+  if (this->count_ < this->size_)
+    this->count_++;
+  this->last_time_ += delta * DELTA_UNIT;
+}
+
+void SensorHistory::for_each_bucket(uint32_t duration, uint32_t resolution,
+                                    const std::function<void(const HistoryBucket &)> &f) {
+  if (resolution == 0)
+    return;
+  const uint32_t buckets = (duration + resolution - 1) / resolution;
+  duration = buckets * resolution;
+
+  LockGuard guard(this->lock_);
+  // Walk back to the oldest entry in range, the entries only know their time relative to the next one
+  size_t oldest = 0;
+  uint32_t oldest_age = 0;
+  bool any = false;
+  uint32_t entry_age = millis() - this->last_time_;
+  for (size_t age = 0; age < this->count_ && entry_age < duration; age++) {
+    oldest = age;
+    oldest_age = entry_age;
+    any = true;
+    entry_age += this->at_(age).delta * DELTA_UNIT;
+  }
+
+  HistoryBucket bucket;
+  float sum = 0.0f;
+  uint32_t index = 0;
+  auto emit = [&]() {
+    if (bucket.count != 0)
+      bucket.avg = sum / bucket.count;
+    f(bucket);
+    bucket = HistoryBucket{};
+    sum = 0.0f;
+    index++;
+  };
+  if (any) {
+    uint32_t sample_age = oldest_age;
+    for (size_t age = oldest + 1; age-- > 0;) {
+      const Entry &entry = this->at_(age);
+      if (age != oldest)
+        sample_age -= entry.delta * DELTA_UNIT;
+      const uint32_t target = (duration - 1 - sample_age) / resolution;
+      while (index < target)
+        emit();
+      float value = this->decode_(entry.value);
+      if (std::isnan(value))
+        continue;
+      if (bucket.count == 0 || value < bucket.min)
+        bucket.min = value;
+      if (bucket.count == 0 || value > bucket.max)
+        bucket.max = value;
+      sum += value;
+      bucket.count++;
+    }
+  }
+  while (index < buckets)
+    emit();
+}
+
+}  // namespace history
+}  // namespace esphome
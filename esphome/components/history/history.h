@@ -0,0 +1,83 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace history {
+
+/// Summary of the samples that fell into one bucket of a history query.
+struct HistoryBucket {
+  float min{NAN};
+  float max{NAN};
+  float avg{NAN};
+  uint32_t count{0};
+};
+
+/** Keeps the recent states of a sensor in a ring buffer.
+ *
+ * Every state takes four bytes: the time since the previous state in tenths of a second and the value quantised to
+ * the accuracy, relative to the first value. The ring is best kept in PSRAM when there is some. Queries summarize a
+ * time range in buckets of equal length, so clients get a downsampled series without fetching every sample.
+ */
+class SensorHistory : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  /// Set the number of states kept.
+  void set_size(uint16_t size) { this->size_ = size; }
+  /// Set the step values are quantised to, defaults to the accuracy_decimals of the sensor.
+  void set_accuracy(float accuracy) { this->accuracy_ = accuracy; }
+
+  sensor::Sensor *get_sensor() const { return this->sensor_; }
+
+  /** Summarize the last duration ms in buckets of resolution ms, oldest first. The last bucket ends now.
+   *
+   * Buckets without samples are passed with a count of 0. The callback is called with the history locked, so it must
+   * not wait for the main loop.
+   */
+  void for_each_bucket(uint32_t duration, uint32_t resolution, const std::function<void(const HistoryBucket &)> &f);
+
+  /// All histories, to find the one of a sensor.
+  static const std::vector<SensorHistory *> &get_histories() { return histories_(); }
+
+ protected:
+  struct Entry {
+    uint16_t delta;  ///< in DELTA_UNIT ms since the previous entry
+    int16_t value;   ///< in accuracy_ steps from base_, NAN_VALUE for NaN
+  };
+  static const uint32_t DELTA_UNIT = 100;
+  static const int16_t NAN_VALUE = INT16_MIN;
+
+  static std::vector<SensorHistory *> &histories_() {
+    static std::vector<SensorHistory *> histories;
+    return histories;
+  }
+
+  void add_sample_(float value);
+  void push_(uint16_t delta, int16_t value);
+  float decode_(int16_t value) const { return value == NAN_VALUE ? NAN : this->base_ + value * this->accuracy_; }
+  const Entry &at_(size_t age) const { return this->entries_[(this->head_ + this->size_ - 1 - age) % this->size_]; }
+
+  sensor::Sensor *sensor_{nullptr};
+  uint16_t size_{1024};
+  float accuracy_{NAN};
+  float base_{NAN};
+  std::vector<Entry, RAMAllocator<Entry>> entries_;
+  /// Index the next entry is written to.
+  size_t head_{0};
+  size_t count_{0};
+  /// Time of the newest entry as the deltas tell it, which lags behind by less than DELTA_UNIT.
+  uint32_t last_time_{0};
+  Mutex lock_;
+};
+
+}  // namespace history
+}  // namespace esphome
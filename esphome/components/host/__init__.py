@@ -20,6 +20,9 @@ CODEOWNERS = ["@esphome/core", "@clydebarrow"]
 AUTO_LOAD = ["network", "preferences"]
 IS_TARGET_PLATFORM = True
 
+CONF_START = "start"
+CONF_VIRTUAL_TIME = "virtual_time"
+
 
 def set_core_data(config):
     CORE.data[KEY_HOST] = {}
@@ -33,6 +36,15 @@ CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.Optional(CONF_MAC_ADDRESS, default="98:35:69:ab:f6:79"): cv.mac_address,
+            # Run on a simulated clock that only moves when the loop would wait
+            cv.Optional(CONF_VIRTUAL_TIME): cv.Schema(
+                {
+                    # Value of the clock at boot, to test the millis() rollover
+                    cv.Optional(
+                        CONF_START, default="0s"
+                    ): cv.positive_time_period_microseconds,
+                }
+            ),
         }
     ),
     set_core_data,
@@ -45,6 +57,12 @@ async def to_code(config):
     cg.add_build_flag("-std=gnu++20")
     cg.add_define("ESPHOME_BOARD", "host")
     cg.add_define(ThreadModel.MULTI_ATOMICS)
+    if virtual_time := config.get(CONF_VIRTUAL_TIME):
+        cg.add_define("USE_HOST_VIRTUAL_TIME")
+        cg.add_define(
+            "USE_HOST_VIRTUAL_TIME_START_US",
+            cg.RawExpression(f"{virtual_time[CONF_START].total_microseconds}ULL"),
+        )
     cg.add_platformio_option("platform", "platformio/native")
     cg.add_platformio_option("lib_ldf_mode", "off")
     cg.add_platformio_option("lib_compat_mode", "strict")
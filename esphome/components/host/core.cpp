@@ -3,15 +3,35 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "preferences.h"
+#include "virtual_time.h"
 
 #include <sched.h>
 #include <time.h>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 
 namespace esphome {
 
 void IRAM_ATTR HOT yield() { ::sched_yield(); }
+
+#ifdef USE_HOST_VIRTUAL_TIME
+namespace host {
+
+static std::atomic<uint64_t> virtual_time{  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    USE_HOST_VIRTUAL_TIME_START_US};
+
+uint64_t virtual_time_us() { return virtual_time.load(std::memory_order_relaxed); }
+void advance_virtual_time(uint64_t us) { virtual_time.fetch_add(us, std::memory_order_relaxed); }
+
+}  // namespace host
+
+uint32_t IRAM_ATTR HOT millis() { return static_cast<uint32_t>(host::virtual_time_us() / 1000U); }
+uint32_t IRAM_ATTR HOT micros() { return static_cast<uint32_t>(host::virtual_time_us()); }
+void IRAM_ATTR HOT delay(uint32_t ms) { host::advance_virtual_time(ms * 1000ULL); }
+void IRAM_ATTR HOT delayMicroseconds(uint32_t us) { host::advance_virtual_time(us); }
+uint32_t arch_get_cpu_cycle_count() { return static_cast<uint32_t>(host::virtual_time_us() * 1000U); }
+#else
 uint32_t IRAM_ATTR HOT millis() {
   struct timespec spec;
   clock_gettime(CLOCK_MONOTONIC, &spec);
@@ -44,6 +64,14 @@ void IRAM_ATTR HOT delayMicroseconds(uint32_t us) {
     res = nanosleep(&ts, &ts);
   } while (res != 0 && errno == EINTR);
 }
+uint32_t arch_get_cpu_cycle_count() {
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time_t seconds = spec.tv_sec;
+  uint32_t us = spec.tv_nsec;
+  return ((uint32_t) seconds) * 1000000000U + us;
+}
+#endif  // USE_HOST_VIRTUAL_TIME
 void arch_restart() { exit(0); }
 void arch_init() {
   // pass
@@ -53,13 +81,6 @@ void IRAM_ATTR HOT arch_feed_wdt() {
 }
 
 uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
-uint32_t arch_get_cpu_cycle_count() {
-  struct timespec spec;
-  clock_gettime(CLOCK_MONOTONIC, &spec);
-  time_t seconds = spec.tv_sec;
-  uint32_t us = spec.tv_nsec;
-  return ((uint32_t) seconds) * 1000000000U + us;
-}
 uint32_t arch_get_cpu_freq_hz() { return 1000000000U; }
 
 }  // namespace esphome
@@ -4,6 +4,7 @@
 #include <fstream>
 #include "preferences.h"
 #include "esphome/core/application.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace host {
@@ -11,6 +12,17 @@ namespace fs = std::filesystem;
 
 static const char *const TAG = "host.preferences";
 
+// Size of the record header: key (uint32) and length (uint8)
+static constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t);
+// Never compact logs smaller than this, rewriting a tiny file just to save a few bytes is not worth it
+static constexpr size_t MIN_COMPACT_SIZE = 4096;
+
+static bool write_record(FILE *fp, uint32_t key, const std::vector<uint8_t> &value) {
+  uint8_t len = value.size();
+  return fwrite(&key, sizeof(key), 1, fp) == 1 && fwrite(&len, sizeof(len), 1, fp) == 1 &&
+         fwrite(value.data(), sizeof(uint8_t), len, fp) == len;
+}
+
 void HostPreferences::setup_() {
   if (this->setup_complete_)
     return;
@@ -23,41 +35,105 @@ void HostPreferences::setup_() {
   this->filename_.append(".prefs");
   FILE *fp = fopen(this->filename_.c_str(), "rb");
   if (fp != nullptr) {
-    while (!feof((fp))) {
+    // Replay the log, later records overwrite earlier ones
+    size_t valid_end = 0;
+    uint8_t data[255];
+    while (true) {
       uint32_t key;
       uint8_t len;
       if (fread(&key, sizeof(key), 1, fp) != 1)
         break;
       if (fread(&len, sizeof(len), 1, fp) != 1)
         break;
-      uint8_t data[len];
       if (fread(data, sizeof(uint8_t), len, fp) != len)
         break;
-      std::vector vec(data, data + len);
-      this->data[key] = vec;
+      this->data[key].assign(data, data + len);
+      valid_end += RECORD_HEADER_SIZE + len;
     }
+    fseek(fp, 0, SEEK_END);
+    const long file_size = ftell(fp);
     fclose(fp);
+    this->log_size_ = valid_end;
+    if (file_size > 0 && static_cast<size_t>(file_size) > valid_end) {
+      // A sync was interrupted half way through a record, drop the torn tail so appends stay aligned
+      ESP_LOGW(TAG, "Dropping %ld bytes of incomplete records", file_size - static_cast<long>(valid_end));
+      std::error_code ec;
+      fs::resize_file(this->filename_, valid_end, ec);
+      if (ec)
+        this->compact_pending_ = true;
+    }
   }
   this->setup_complete_ = true;
 }
 
+size_t HostPreferences::live_size_() const {
+  size_t size = 0;
+  for (const auto &it : this->data)
+    size += RECORD_HEADER_SIZE + it.second.size();
+  return size;
+}
+
+bool HostPreferences::compact_() {
+  // Write the live records to a temporary file and move it over the log, so an interruption never
+  // leaves a partially written file behind
+  const std::string tmp = this->filename_ + ".tmp";
+  FILE *fp = fopen(tmp.c_str(), "wb");
+  if (fp == nullptr)
+    return false;
+  bool ok = true;
+  for (const auto &it : this->data)
+    ok = ok && write_record(fp, it.first, it.second);
+  ok = (fclose(fp) == 0) && ok;
+  std::error_code ec;
+  if (ok)
+    fs::rename(tmp, this->filename_, ec);
+  if (!ok || ec) {
+    fs::remove(tmp, ec);
+    return false;
+  }
+  ESP_LOGV(TAG, "Compacted log from %zu to %zu bytes", this->log_size_, this->live_size_());
+  this->log_size_ = this->live_size_();
+  this->dirty_.clear();
+  this->compact_pending_ = false;
+  return true;
+}
+
 bool HostPreferences::sync() {
   this->setup_();
-  FILE *fp = fopen(this->filename_.c_str(), "wb");
-  std::map<uint32_t, std::vector<uint8_t>>::iterator it;
-
-  for (it = this->data.begin(); it != this->data.end(); ++it) {
-    fwrite(&it->first, sizeof(uint32_t), 1, fp);
-    uint8_t len = it->second.size();
-    fwrite(&len, sizeof(len), 1, fp);
-    fwrite(it->second.data(), sizeof(uint8_t), it->second.size(), fp);
+  if (this->compact_pending_)
+    return this->compact_();
+  if (this->dirty_.empty())
+    return true;
+
+  size_t append_size = 0;
+  for (uint32_t key : this->dirty_)
+    append_size += RECORD_HEADER_SIZE + this->data[key].size();
+  const size_t log_size = this->log_size_ + append_size;
+  // Compact once more than half of the log would be stale records
+  if (log_size > MIN_COMPACT_SIZE && log_size > 2 * this->live_size_())
+    return this->compact_();
+
+  FILE *fp = fopen(this->filename_.c_str(), "ab");
+  if (fp == nullptr)
+    return false;
+  bool ok = true;
+  for (uint32_t key : this->dirty_)
+    ok = ok && write_record(fp, key, this->data[key]);
+  ok = (fclose(fp) == 0) && ok;
+  if (!ok) {
+    // The tail of the file is in an unknown state now, rewrite it on the next attempt
+    this->compact_pending_ = true;
+    return false;
   }
-  fclose(fp);
+  this->log_size_ = log_size;
+  this->dirty_.clear();
   return true;
 }
 
 bool HostPreferences::reset() {
   host_preferences->data.clear();
+  host_preferences->dirty_.clear();
+  host_preferences->compact_pending_ = true;
   return true;
 }
 
@@ -3,7 +3,10 @@
 #ifdef USE_HOST
 
 #include "esphome/core/preferences.h"
+#include <cstring>
 #include <map>
+#include <set>
+#include <vector>
 
 namespace esphome {
 namespace host {
@@ -19,6 +22,12 @@ class HostPreferenceBackend : public ESPPreferenceBackend {
   uint32_t key_{};
 };
 
+/** Preferences stored in ~/.esphome/prefs/<name>.prefs.
+ *
+ * The file is an append-only log of `key (uint32), length (uint8), data` records; when a key appears more
+ * than once the last record wins. sync() only appends the values that changed since the previous sync, and
+ * the file is compacted (rewritten with one record per key) once the stale records outweigh the live ones.
+ */
 class HostPreferences : public ESPPreferences {
  public:
   bool sync() override;
@@ -33,8 +42,11 @@ class HostPreferences : public ESPPreferences {
     if (len > 255)
       return false;
     this->setup_();
-    std::vector vec(data, data + len);
-    this->data[key] = vec;
+    auto it = this->data.find(key);
+    if (it != this->data.end() && it->second.size() == len && memcmp(it->second.data(), data, len) == 0)
+      return true;
+    this->data[key].assign(data, data + len);
+    this->dirty_.insert(key);
     return true;
   }
 
@@ -54,9 +66,18 @@ class HostPreferences : public ESPPreferences {
 
  protected:
   void setup_();
+  bool compact_();
+  size_t live_size_() const;
+
   bool setup_complete_{};
+  // Rewrite the whole file on the next sync (set after reset())
+  bool compact_pending_{};
+  // Current size of the log file in bytes
+  size_t log_size_{};
   std::string filename_{};
   std::map<uint32_t, std::vector<uint8_t>> data{};
+  // Keys whose value changed since the last sync
+  std::set<uint32_t> dirty_{};
 };
 void setup_preferences();
 extern HostPreferences *host_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_HOST_VIRTUAL_TIME
+
+#include <cstdint>
+
+namespace esphome {
+namespace host {
+
+/** With `virtual_time:` enabled, millis(), micros() and the cycle counter run on a simulated clock instead of the
+ * real one. The clock only moves when delay() or delayMicroseconds() is called, when the main loop would sleep, or
+ * when it is moved explicitly, so a run is repeatable and days of runtime pass in seconds.
+ */
+
+/// Returns the virtual time in microseconds since boot. Unlike micros(), this does not wrap.
+uint64_t virtual_time_us();
+/// Moves the virtual clock forward by \p us microseconds. Everything due in between runs with the next loop.
+void advance_virtual_time(uint64_t us);
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST_VIRTUAL_TIME
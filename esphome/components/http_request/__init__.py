@@ -49,6 +49,8 @@ CONF_FOLLOW_REDIRECTS = "follow_redirects"
 CONF_REDIRECT_LIMIT = "redirect_limit"
 CONF_BUFFER_SIZE_RX = "buffer_size_rx"
 CONF_BUFFER_SIZE_TX = "buffer_size_tx"
+CONF_CONNECTION_POOL_SIZE = "connection_pool_size"
+CONF_CONNECTION_IDLE_TIMEOUT = "connection_idle_timeout"
 CONF_CA_CERTIFICATE_PATH = "ca_certificate_path"
 
 CONF_MAX_RESPONSE_BUFFER_SIZE = "max_response_buffer_size"
@@ -128,6 +130,14 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_BUFFER_SIZE_TX, esp32_idf=512): cv.All(
                 cv.uint16_t, cv.only_with_esp_idf
             ),
+            cv.SplitDefault(CONF_CONNECTION_POOL_SIZE, esp32_idf=0): cv.All(
+                cv.int_range(min=0, max=8), cv.only_with_esp_idf
+            ),
+            cv.SplitDefault(CONF_CONNECTION_IDLE_TIMEOUT, esp32_idf="15s"): cv.All(
+                cv.positive_not_null_time_period,
+                cv.positive_time_period_milliseconds,
+                cv.only_with_esp_idf,
+            ),
             cv.Optional(CONF_CA_CERTIFICATE_PATH): cv.All(
                 cv.file_,
                 cv.only_on(PLATFORM_HOST),
@@ -162,6 +172,16 @@ async def to_code(config):
         if CORE.using_esp_idf:
             cg.add(var.set_buffer_size_rx(config[CONF_BUFFER_SIZE_RX]))
             cg.add(var.set_buffer_size_tx(config[CONF_BUFFER_SIZE_TX]))
+            if pool_size := config[CONF_CONNECTION_POOL_SIZE]:
+                cg.add(var.set_connection_pool_size(pool_size))
+                cg.add(
+                    var.set_connection_idle_timeout(
+                        config[CONF_CONNECTION_IDLE_TIMEOUT]
+                    )
+                )
+                esp32.add_idf_sdkconfig_option(
+                    "CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS", True
+                )
 
             esp32.add_idf_sdkconfig_option(
                 "CONFIG_MBEDTLS_CERTIFICATE_BUNDLE",
@@ -14,6 +14,8 @@
 
 #include "esp_task_wdt.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace http_request {
 
@@ -24,12 +26,102 @@ struct UserData {
   std::map<std::string, std::list<std::string>> response_headers;
 };
 
+/// Scheme and authority of url, e.g. "https://example.com:8443", empty if url has none.
+static std::string get_origin(const std::string &url) {
+  size_t scheme_end = url.find("://");
+  if (scheme_end == std::string::npos)
+    return "";
+  size_t path_start = url.find_first_of("/?#", scheme_end + 3);
+  return str_lower_case(url.substr(0, path_start));
+}
+
+/// Open the connection and write the whole body, esp_http_client_write may accept only part of it per call.
+static esp_err_t send_request(esp_http_client_handle_t client, const std::string &body) {
+  const int body_len = body.length();
+
+  esp_err_t err = esp_http_client_open(client, body_len);
+  if (err != ESP_OK)
+    return err;
+
+  int write_left = body_len;
+  int write_index = 0;
+  const char *buf = body.c_str();
+  while (write_left > 0) {
+    int written = esp_http_client_write(client, buf + write_index, write_left);
+    if (written <= 0)
+      return ESP_FAIL;
+    write_left -= written;
+    write_index += written;
+  }
+  return ESP_OK;
+}
+
+void HttpRequestIDF::setup() {
+  if (this->connection_pool_size_ == 0)
+    return;
+  this->pool_.reserve(this->connection_pool_size_);
+  this->set_interval("pool", std::max<uint32_t>(this->connection_idle_timeout_ / 2, 1000),
+                     [this]() { this->prune_pool_(); });
+}
+
 void HttpRequestIDF::dump_config() {
   HttpRequestComponent::dump_config();
   ESP_LOGCONFIG(TAG,
                 "  Buffer Size RX: %u\n"
                 "  Buffer Size TX: %u",
                 this->buffer_size_rx_, this->buffer_size_tx_);
+  if (this->connection_pool_size_ > 0) {
+    ESP_LOGCONFIG(TAG,
+                  "  Connection Pool Size: %u\n"
+                  "  Connection Idle Timeout: %" PRIu32 "ms",
+                  this->connection_pool_size_, this->connection_idle_timeout_);
+  }
+}
+
+esp_http_client_handle_t HttpRequestIDF::acquire_client_(const std::string &origin) {
+  LockGuard guard{this->pool_lock_};
+  // Newest first, it is the least likely to have been closed by the server
+  for (auto it = this->pool_.rbegin(); it != this->pool_.rend(); ++it) {
+    if (it->origin == origin) {
+      esp_http_client_handle_t client = it->client;
+      this->pool_.erase(std::next(it).base());
+      return client;
+    }
+  }
+  return nullptr;
+}
+
+void HttpRequestIDF::release_client(esp_http_client_handle_t client, const std::string &origin, bool reusable) {
+  if (reusable) {
+    LockGuard guard{this->pool_lock_};
+    if (this->pool_.size() < this->connection_pool_size_) {
+      this->pool_.push_back(PooledClient{origin, client, millis()});
+      return;
+    }
+  }
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+}
+
+void HttpRequestIDF::prune_pool_() {
+  std::vector<esp_http_client_handle_t> expired;
+  {
+    LockGuard guard{this->pool_lock_};
+    const uint32_t now = millis();
+    // Released in order, so the expired clients are at the front
+    auto it = this->pool_.begin();
+    while (it != this->pool_.end() && now - it->released >= this->connection_idle_timeout_) {
+      expired.push_back(it->client);
+      ++it;
+    }
+    this->pool_.erase(this->pool_.begin(), it);
+  }
+  // Closing a TLS connection can block, do it without holding the lock
+  for (auto *client : expired) {
+    ESP_LOGV(TAG, "Closing idle connection");
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+  }
 }
 
 esp_err_t HttpRequestIDF::http_event_handler(esp_http_client_event_t *evt) {
@@ -52,6 +144,39 @@ esp_err_t HttpRequestIDF::http_event_handler(esp_http_client_event_t *evt) {
   return ESP_OK;
 }
 
+esp_http_client_handle_t HttpRequestIDF::init_client_(const std::string &url, esp_http_client_method_t method,
+                                                      bool secure, void *user_data) {
+  esp_http_client_config_t config = {};
+
+  config.url = url.c_str();
+  config.method = method;
+  config.timeout_ms = this->timeout_;
+  config.disable_auto_redirect = !this->follow_redirects_;
+  config.max_redirection_count = this->redirect_limit_;
+  config.auth_type = HTTP_AUTH_TYPE_BASIC;
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+  if (secure) {
+    config.crt_bundle_attach = esp_crt_bundle_attach;
+  }
+#endif
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+  // Lets a pooled client that has to reconnect resume its TLS session instead of a full handshake
+  config.save_client_session = this->connection_pool_size_ > 0;
+#endif
+
+  if (this->useragent_ != nullptr) {
+    config.user_agent = this->useragent_;
+  }
+
+  config.buffer_size = this->buffer_size_rx_;
+  config.buffer_size_tx = this->buffer_size_tx_;
+
+  config.event_handler = http_event_handler;
+  config.user_data = user_data;
+
+  return esp_http_client_init(&config);
+}
+
 std::shared_ptr<HttpContainer> HttpRequestIDF::perform(std::string url, std::string method, std::string body,
                                                        std::list<Header> request_headers,
                                                        std::set<std::string> collect_headers) {
@@ -80,67 +205,47 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(std::string url, std::str
 
   bool secure = url.find("https:") != std::string::npos;
 
-  esp_http_client_config_t config = {};
-
-  config.url = url.c_str();
-  config.method = method_idf;
-  config.timeout_ms = this->timeout_;
-  config.disable_auto_redirect = !this->follow_redirects_;
-  config.max_redirection_count = this->redirect_limit_;
-  config.auth_type = HTTP_AUTH_TYPE_BASIC;
-#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
-  if (secure) {
-    config.crt_bundle_attach = esp_crt_bundle_attach;
-  }
-#endif
-
-  if (this->useragent_ != nullptr) {
-    config.user_agent = this->useragent_;
-  }
-
-  config.buffer_size = this->buffer_size_rx_;
-  config.buffer_size_tx = this->buffer_size_tx_;
-
   const uint32_t start = millis();
   watchdog::WatchdogManager wdm(this->get_watchdog_timeout());
 
-  config.event_handler = http_event_handler;
   auto user_data = UserData{collect_headers, {}};
-  config.user_data = static_cast<void *>(&user_data);
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+  std::string origin = this->connection_pool_size_ > 0 ? get_origin(url) : "";
+  esp_http_client_handle_t client = origin.empty() ? nullptr : this->acquire_client_(origin);
+  const bool reused = client != nullptr;
+  if (reused) {
+    ESP_LOGV(TAG, "Reusing connection to %s", origin.c_str());
+    esp_http_client_set_url(client, url.c_str());
+    esp_http_client_set_method(client, method_idf);
+    esp_http_client_set_user_data(client, static_cast<void *>(&user_data));
+  } else {
+    client = this->init_client_(url, method_idf, secure, static_cast<void *>(&user_data));
+  }
 
   std::shared_ptr<HttpContainerIDF> container = std::make_shared<HttpContainerIDF>(client);
   container->set_parent(this);
 
   container->set_secure(secure);
+  container->set_request_headers(request_headers);
 
   for (const auto &header : request_headers) {
     esp_http_client_set_header(client, header.name.c_str(), header.value.c_str());
   }
 
-  const int body_len = body.length();
-
-  esp_err_t err = esp_http_client_open(client, body_len);
-  if (err != ESP_OK) {
-    this->status_momentary_error("failed", 1000);
-    ESP_LOGE(TAG, "HTTP Request failed: %s", esp_err_to_name(err));
-    esp_http_client_cleanup(client);
-    return nullptr;
+  esp_err_t err = send_request(client, body);
+  int64_t content_length = -1;
+  if (err == ESP_OK) {
+    container->feed_wdt();
+    content_length = esp_http_client_fetch_headers(client);
   }
-
-  if (body_len > 0) {
-    int write_left = body_len;
-    int write_index = 0;
-    const char *buf = body.c_str();
-    while (write_left > 0) {
-      int written = esp_http_client_write(client, buf + write_index, write_left);
-      if (written < 0) {
-        err = ESP_FAIL;
-        break;
-      }
-      write_left -= written;
-      write_index += written;
+  if (reused && (err != ESP_OK || content_length < 0)) {
+    // The server may have closed the idle connection in the meantime
+    ESP_LOGV(TAG, "Pooled connection failed, reconnecting");
+    esp_http_client_close(client);
+    err = send_request(client, body);
+    if (err == ESP_OK) {
+      container->feed_wdt();
+      content_length = esp_http_client_fetch_headers(client);
     }
   }
 
@@ -152,13 +257,13 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(std::string url, std::str
   }
 
   container->feed_wdt();
-  container->content_length = esp_http_client_fetch_headers(client);
-  container->feed_wdt();
+  container->content_length = content_length;
   container->status_code = esp_http_client_get_status_code(client);
   container->feed_wdt();
   container->set_response_headers(user_data.response_headers);
   container->duration_ms = millis() - start;
   if (is_success(container->status_code)) {
+    container->set_pool_origin(origin);
     return container;
   }
 
@@ -233,8 +338,14 @@ int HttpContainerIDF::read(uint8_t *buf, size_t max_len) {
 void HttpContainerIDF::end() {
   watchdog::WatchdogManager wdm(this->parent_->get_watchdog_timeout());
 
-  esp_http_client_close(this->client_);
-  esp_http_client_cleanup(this->client_);
+  // Only a fully read response leaves the connection ready for the next request
+  bool reusable = !this->pool_origin_.empty() && esp_http_client_is_complete_data_received(this->client_);
+  if (reusable) {
+    for (const auto &header : this->request_headers_) {
+      esp_http_client_delete_header(this->client_, header.name.c_str());
+    }
+  }
+  static_cast<HttpRequestIDF *>(this->parent_)->release_client(this->client_, this->pool_origin_, reusable);
 }
 
 void HttpContainerIDF::feed_wdt() {
@@ -9,6 +9,8 @@
 #include <esp_netif.h>
 #include <esp_tls.h>
 
+#include <vector>
+
 namespace esphome {
 namespace http_request {
 
@@ -25,16 +27,30 @@ class HttpContainerIDF : public HttpContainer {
     this->response_headers_ = std::move(response_headers);
   }
 
+  /// Origin the connection may be handed back to the pool for, empty if it must be closed.
+  void set_pool_origin(std::string origin) { this->pool_origin_ = std::move(origin); }
+  void set_request_headers(const std::list<Header> &request_headers) { this->request_headers_ = request_headers; }
+
  protected:
   esp_http_client_handle_t client_;
+  std::string pool_origin_{};
+  std::list<Header> request_headers_{};
 };
 
 class HttpRequestIDF : public HttpRequestComponent {
  public:
+  void setup() override;
   void dump_config() override;
 
   void set_buffer_size_rx(uint16_t buffer_size_rx) { this->buffer_size_rx_ = buffer_size_rx; }
   void set_buffer_size_tx(uint16_t buffer_size_tx) { this->buffer_size_tx_ = buffer_size_tx; }
+  void set_connection_pool_size(uint8_t connection_pool_size) { this->connection_pool_size_ = connection_pool_size; }
+  void set_connection_idle_timeout(uint32_t connection_idle_timeout) {
+    this->connection_idle_timeout_ = connection_idle_timeout;
+  }
+
+  /// Hand a finished client back, it is kept open for the next request to the same origin if the pool has room.
+  void release_client(esp_http_client_handle_t client, const std::string &origin, bool reusable);
 
  protected:
   std::shared_ptr<HttpContainer> perform(std::string url, std::string method, std::string body,
@@ -44,6 +60,24 @@ class HttpRequestIDF : public HttpRequestComponent {
   uint16_t buffer_size_rx_{};
   uint16_t buffer_size_tx_{};
 
+  struct PooledClient {
+    std::string origin;
+    esp_http_client_handle_t client;
+    uint32_t released;
+  };
+  esp_http_client_handle_t init_client_(const std::string &url, esp_http_client_method_t method, bool secure,
+                                        void *user_data);
+  /// Take an idle client for origin out of the pool, nullptr if there is none.
+  esp_http_client_handle_t acquire_client_(const std::string &origin);
+  /// Close the clients that have been idle for longer than connection_idle_timeout_.
+  void prune_pool_();
+  /// Idle clients with their connection (and TLS session) still open, oldest first.
+  std::vector<PooledClient> pool_;
+  /// The update component performs requests from its own task.
+  Mutex pool_lock_;
+  uint8_t connection_pool_size_{0};
+  uint32_t connection_idle_timeout_{15000};
+
   /// @brief Monitors the http client events to gather response headers
   static esp_err_t http_event_handler(esp_http_client_event_t *evt);
 };
@@ -80,12 +80,42 @@ void OtaHttpRequestComponent::cleanup_(std::unique_ptr<ota::OTABackend> backend,
     ESP_LOGV(TAG, "Aborting OTA backend");
     backend->abort();
   }
-  ESP_LOGV(TAG, "Aborting HTTP connection");
-  container->end();
+  if (container != nullptr) {
+    ESP_LOGV(TAG, "Aborting HTTP connection");
+    container->end();
+  }
 };
 
+std::shared_ptr<HttpContainer> OtaHttpRequestComponent::resume_(const std::string &url, size_t offset,
+                                                                size_t image_size) {
+  ESP_LOGI(TAG, "Resuming download at %u of %u bytes", offset, image_size);
+  std::list<Header> headers = {{.name = "Range", .value = "bytes=" + to_string(offset) + "-"}};
+  auto container = this->parent_->get(url, headers);
+  if (container == nullptr)
+    return nullptr;
+  // Anything but the requested rest of the image can't be appended to what was written already
+  if (container->status_code != HTTP_STATUS_PARTIAL_CONTENT || container->content_length != image_size - offset) {
+    ESP_LOGW(TAG, "Server did not send the requested range (status %d)", container->status_code);
+    container->end();
+    return nullptr;
+  }
+  return container;
+}
+
 uint8_t OtaHttpRequestComponent::do_ota_() {
-  uint8_t buf[OtaHttpRequestComponent::HTTP_RECV_BUFFER + 1];
+  // Large buffers go to PSRAM if there is any
+  RAMAllocator<uint8_t> allocator;
+  uint8_t *buf = allocator.allocate(this->buffer_size_);
+  if (buf == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate %u byte download buffer", this->buffer_size_);
+    return OTA_BUFFER_ERROR;
+  }
+  uint8_t result = this->download_(buf);
+  allocator.deallocate(buf, this->buffer_size_);
+  return result;
+}
+
+uint8_t OtaHttpRequestComponent::download_(uint8_t *buf) {
   uint32_t last_progress = 0;
   uint32_t update_start_time = millis();
   md5::MD5Digest md5_receive;
@@ -109,6 +139,10 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
   if (container == nullptr || container->status_code != HTTP_STATUS_OK) {
     return OTA_CONNECTION_ERROR;
   }
+  size_t image_size = container->content_length;
+  size_t total = 0;
+  uint8_t resume_attempts = 0;
+  uint32_t last_data = millis();
 
   // we will compute MD5 on the fly for verification -- Arduino OTA seems to ignore it
   md5_receive.init();
@@ -116,28 +150,41 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
 
   ESP_LOGV(TAG, "OTA backend begin");
   auto backend = ota::make_ota_backend();
-  auto error_code = backend->begin(container->content_length);
+  auto error_code = backend->begin(image_size);
   if (error_code != ota::OTA_RESPONSE_OK) {
     ESP_LOGW(TAG, "backend->begin error: %d", error_code);
     this->cleanup_(std::move(backend), container);
     return error_code;
   }
 
-  while (container->get_bytes_read() < container->content_length) {
+  while (total < image_size) {
     // read a maximum of chunk_size bytes into buf. (real read size returned)
-    int bufsize = container->read(buf, OtaHttpRequestComponent::HTTP_RECV_BUFFER);
-    ESP_LOGVV(TAG, "bytes_read_ = %u, body_length_ = %u, bufsize = %i", container->get_bytes_read(),
-              container->content_length, bufsize);
+    int bufsize = container->read(buf, this->buffer_size_);
+    ESP_LOGVV(TAG, "total = %u, image_size = %u, bufsize = %i", total, image_size, bufsize);
 
     // feed watchdog and give other tasks a chance to run
     App.feed_wdt();
     yield();
 
-    if (bufsize < 0) {
-      ESP_LOGE(TAG, "Stream closed");
-      this->cleanup_(std::move(backend), container);
-      return OTA_CONNECTION_ERROR;
-    } else if (bufsize > 0 && bufsize <= OtaHttpRequestComponent::HTTP_RECV_BUFFER) {
+    if (bufsize < 0 || (bufsize == 0 && millis() - last_data > STALL_TIMEOUT_MS)) {
+      ESP_LOGW(TAG, "Stream closed at %u of %u bytes", total, image_size);
+      container->end();
+      container = nullptr;
+      // The MD5 digest and the backend simply continue, so the image is still verified as a whole
+      while (container == nullptr && resume_attempts < this->resume_attempts_) {
+        resume_attempts++;
+        delay(500);  // NOLINT
+        container = this->resume_(url_with_auth, total, image_size);
+      }
+      if (container == nullptr) {
+        ESP_LOGE(TAG, "Stream closed");
+        this->cleanup_(std::move(backend), container);
+        return OTA_CONNECTION_ERROR;
+      }
+      last_data = millis();
+      continue;
+    } else if (bufsize > 0 && bufsize <= this->buffer_size_) {
+      last_data = millis();
       // add read bytes to MD5
       md5_receive.add(buf, bufsize);
 
@@ -147,17 +194,18 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
       if (error_code != ota::OTA_RESPONSE_OK) {
         // error code explanation available at
         // https://github.com/esphome/esphome/blob/dev/esphome/components/ota/ota_backend.h
-        ESP_LOGE(TAG, "Error code (%02X) writing binary data to flash at offset %d and size %d", error_code,
-                 container->get_bytes_read() - bufsize, container->content_length);
+        ESP_LOGE(TAG, "Error code (%02X) writing binary data to flash at offset %d and size %d", error_code, total,
+                 image_size);
         this->cleanup_(std::move(backend), container);
         return error_code;
       }
+      total += bufsize;
     }
 
     uint32_t now = millis();
-    if ((now - last_progress > 1000) or (container->get_bytes_read() == container->content_length)) {
+    if ((now - last_progress > 1000) or (total == image_size)) {
       last_progress = now;
-      float percentage = container->get_bytes_read() * 100.0f / container->content_length;
+      float percentage = total * 100.0f / image_size;
       ESP_LOGD(TAG, "Progress: %0.1f%%", percentage);
 #ifdef USE_OTA_STATE_CALLBACK
       this->state_callback_.call(ota::OTA_IN_PROGRESS, percentage, 0);
@@ -20,6 +20,7 @@ enum OtaHttpRequestError : uint8_t {
   OTA_MD5_INVALID = 0x10,
   OTA_BAD_URL = 0x11,
   OTA_CONNECTION_ERROR = 0x12,
+  OTA_BUFFER_ERROR = 0x13,
 };
 
 class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRequestComponent> {
@@ -33,6 +34,8 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
   void set_password(const std::string &password) { this->password_ = password; }
   void set_url(const std::string &url);
   void set_username(const std::string &username) { this->username_ = username; }
+  void set_buffer_size(uint16_t buffer_size) { this->buffer_size_ = buffer_size; }
+  void set_resume_attempts(uint8_t resume_attempts) { this->resume_attempts_ = resume_attempts; }
 
   std::string md5_computed() { return this->md5_computed_; }
   std::string md5_expected() { return this->md5_expected_; }
@@ -42,6 +45,9 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
  protected:
   void cleanup_(std::unique_ptr<ota::OTABackend> backend, const std::shared_ptr<HttpContainer> &container);
   uint8_t do_ota_();
+  uint8_t download_(uint8_t *buf);
+  /// Request the rest of the image from offset onwards, nullptr if the server can't continue the download.
+  std::shared_ptr<HttpContainer> resume_(const std::string &url, size_t offset, size_t image_size);
   std::string get_url_with_auth_(const std::string &url);
   bool http_get_md5_();
   bool validate_url_(const std::string &url);
@@ -54,7 +60,10 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
   std::string url_{};
   int status_ = -1;
   bool update_started_ = false;
-  static const uint16_t HTTP_RECV_BUFFER = 256;  // the firmware GET chunk size
+  uint16_t buffer_size_{256};  // the firmware GET chunk size
+  uint8_t resume_attempts_{3};
+  /// A download that makes no progress for this long is treated like a dropped connection.
+  static const uint32_t STALL_TIMEOUT_MS = 15000;
 };
 
 }  // namespace http_request
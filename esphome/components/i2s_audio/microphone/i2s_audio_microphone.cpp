@@ -420,6 +420,23 @@ void I2SAudioMicrophone::fix_dc_offset_(std::vector<uint8_t> &data) {
   const uint8_t dc_filter_shift = 10;
   const size_t bytes_per_sample = this->audio_stream_info_.samples_to_bytes(1);
   const uint32_t total_samples = this->audio_stream_info_.bytes_to_samples(data.size());
+  if (bytes_per_sample == sizeof(int16_t)) {
+    // Most microphones deliver 16 bit samples, which are read and written directly instead of being unpacked byte by
+    // byte. The filter state stays in Q31, so the result is the same.
+    int16_t *samples = reinterpret_cast<int16_t *>(data.data());
+    int32_t prev_input = this->dc_offset_prev_input_;
+    int32_t prev_output = this->dc_offset_prev_output_;
+    for (uint32_t sample_index = 0; sample_index < total_samples; ++sample_index) {
+      const int32_t input = static_cast<int32_t>(samples[sample_index]) * 65536;
+      const int32_t output = input - prev_input + (prev_output - (prev_output >> dc_filter_shift));
+      prev_input = input;
+      prev_output = output;
+      samples[sample_index] = static_cast<int16_t>(output >> 16);
+    }
+    this->dc_offset_prev_input_ = prev_input;
+    this->dc_offset_prev_output_ = prev_output;
+    return;
+  }
   for (uint32_t sample_index = 0; sample_index < total_samples; ++sample_index) {
     const uint32_t byte_index = sample_index * bytes_per_sample;
     int32_t input = audio::unpack_audio_sample_to_q31(&data[byte_index], bytes_per_sample);
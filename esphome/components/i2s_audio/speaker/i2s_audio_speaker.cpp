@@ -22,11 +22,16 @@ namespace i2s_audio {
 
 static const uint32_t DMA_BUFFER_DURATION_MS = 15;
 static const size_t DMA_BUFFERS_COUNT = 4;
+static const size_t MAX_DMA_BUFFERS_COUNT = 12;
+static const size_t MAX_DMA_BUFFER_BYTES = 4092;  // Limit of a single DMA descriptor
+// Every underrun while audio was waiting adds this much to the DMA buffers' total duration, up to the maximum
+static const uint32_t DMA_DURATION_STEP_MS = DMA_BUFFER_DURATION_MS;
+static const uint32_t MAX_DMA_BUFFERS_DURATION_MS = 120;
 
 static const size_t TASK_STACK_SIZE = 4096;
 static const ssize_t TASK_PRIORITY = 19;
 
-static const size_t I2S_EVENT_QUEUE_COUNT = DMA_BUFFERS_COUNT + 1;
+static const size_t I2S_EVENT_QUEUE_COUNT = MAX_DMA_BUFFERS_COUNT + 1;
 
 static const char *const TAG = "i2s_audio.speaker";
 
@@ -61,6 +66,8 @@ static const std::vector<int16_t> Q15_VOLUME_SCALING_FACTORS = {
     19508, 20665, 21891, 23189, 24565, 26022, 27566, 29201, 30933, 32767};
 
 void I2SAudioSpeaker::setup() {
+  this->dma_buffers_duration_ms_ = DMA_BUFFER_DURATION_MS * DMA_BUFFERS_COUNT;
+
   this->event_group_ = xEventGroupCreate();
 
   if (this->event_group_ == nullptr) {
@@ -74,8 +81,9 @@ void I2SAudioSpeaker::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "Speaker:\n"
                 "  Pin: %d\n"
-                "  Buffer duration: %" PRIu32,
-                static_cast<int8_t>(this->dout_pin_), this->buffer_duration_ms_);
+                "  Buffer duration: %" PRIu32 "\n"
+                "  DMA buffers duration: %" PRIu32 " ms",
+                static_cast<int8_t>(this->dout_pin_), this->buffer_duration_ms_, this->dma_buffers_duration_ms_);
   if (this->timeout_.has_value()) {
     ESP_LOGCONFIG(TAG, "  Timeout: %" PRIu32 " ms", this->timeout_.value());
   }
@@ -114,6 +122,8 @@ void I2SAudioSpeaker::loop() {
   }
   if (event_group_bits & SpeakerEventGroupBits::TASK_STOPPED) {
     ESP_LOGD(TAG, "Stopped");
+    ESP_LOGD(TAG, "%" PRIu32 " underruns, %u DMA buffers of %" PRIu32 " frames, max write latency %" PRIu32 " us",
+             this->underruns_, this->dma_buffers_count_, this->dma_buffer_frames_, this->max_write_latency_us_);
 
     vTaskDelete(this->speaker_task_handle_);
     this->speaker_task_handle_ = nullptr;
@@ -247,15 +257,17 @@ void I2SAudioSpeaker::speaker_task(void *params) {
 
   xEventGroupSetBits(this_speaker->event_group_, SpeakerEventGroupBits::TASK_STARTING);
 
-  const uint32_t dma_buffers_duration_ms = DMA_BUFFER_DURATION_MS * DMA_BUFFERS_COUNT;
+  const uint32_t frames_to_fill_single_dma_buffer = this_speaker->dma_buffer_frames_;
+  const uint32_t dma_buffers_duration_ms =
+      this_speaker->current_stream_info_.frames_to_microseconds(frames_to_fill_single_dma_buffer *
+                                                                 this_speaker->dma_buffers_count_) /
+      1000;
   // Ensure ring buffer duration is at least the duration of all DMA buffers
   const uint32_t ring_buffer_duration = std::max(dma_buffers_duration_ms, this_speaker->buffer_duration_ms_);
 
   // The DMA buffers may have more bits per sample, so calculate buffer sizes based in the input audio stream info
   const size_t ring_buffer_size = this_speaker->current_stream_info_.ms_to_bytes(ring_buffer_duration);
 
-  const uint32_t frames_to_fill_single_dma_buffer =
-      this_speaker->current_stream_info_.ms_to_frames(DMA_BUFFER_DURATION_MS);
   const size_t bytes_to_fill_single_dma_buffer =
       this_speaker->current_stream_info_.frames_to_bytes(frames_to_fill_single_dma_buffer);
 
@@ -281,6 +293,9 @@ void I2SAudioSpeaker::speaker_task(void *params) {
     uint32_t frames_written = 0;
     uint32_t last_data_received_time = millis();
 
+    this_speaker->underruns_ = 0;
+    this_speaker->max_write_latency_us_ = 0;
+
     xEventGroupSetBits(this_speaker->event_group_, SpeakerEventGroupBits::TASK_RUNNING);
 
     while (this_speaker->pause_state_ || !this_speaker->timeout_.has_value() ||
@@ -304,6 +319,9 @@ void I2SAudioSpeaker::speaker_task(void *params) {
       i2s_event_t i2s_event;
       while (xQueueReceive(this_speaker->i2s_event_queue_, &i2s_event, 0)) {
         if (i2s_event.type == I2S_EVENT_TX_Q_OVF) {
+          if (!tx_dma_underflow) {
+            this_speaker->record_underrun_(transfer_buffer->has_buffered_data());
+          }
           tx_dma_underflow = true;
         }
       }
@@ -314,6 +332,9 @@ void I2SAudioSpeaker::speaker_task(void *params) {
         // on the timing info via the audio_output_callback.
         uint32_t frames_sent = frames_to_fill_single_dma_buffer;
         if (frames_to_fill_single_dma_buffer > frames_written) {
+          if (!tx_dma_underflow) {
+            this_speaker->record_underrun_(transfer_buffer->has_buffered_data());
+          }
           tx_dma_underflow = true;
           frames_sent = frames_written;
           const uint32_t frames_zeroed = frames_to_fill_single_dma_buffer - frames_written;
@@ -326,6 +347,7 @@ void I2SAudioSpeaker::speaker_task(void *params) {
           this_speaker->audio_output_callback_(frames_sent, write_timestamp);
         }
       }
+      this_speaker->dma_fill_frames_ = frames_written;
 #endif
 
       if (this_speaker->pause_state_) {
@@ -393,6 +415,7 @@ void I2SAudioSpeaker::speaker_task(void *params) {
         vTaskDelay(pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS / 2));
       } else {
         size_t bytes_written = 0;
+        const uint32_t write_start = micros();
 #ifdef USE_I2S_LEGACY
         if (this_speaker->current_stream_info_.get_bits_per_sample() == (uint8_t) this_speaker->bits_per_sample_) {
           i2s_write(this_speaker->parent_->get_port(), transfer_buffer->get_buffer_start(),
@@ -421,6 +444,7 @@ void I2SAudioSpeaker::speaker_task(void *params) {
                             &bytes_written, DMA_BUFFER_DURATION_MS);
         }
 #endif
+        this_speaker->max_write_latency_us_ = std::max(this_speaker->max_write_latency_us_, micros() - write_start);
         if (bytes_written > 0) {
           last_data_received_time = millis();
           frames_written += this_speaker->current_stream_info_.bytes_to_frames(bytes_written);
@@ -522,7 +546,15 @@ esp_err_t I2SAudioSpeaker::start_i2s_driver_(audio::AudioStreamInfo &audio_strea
     return ESP_ERR_INVALID_STATE;
   }
 
-  uint32_t dma_buffer_length = audio_stream_info.ms_to_frames(DMA_BUFFER_DURATION_MS);
+  // Keep each DMA buffer within a single descriptor, which shortens them for high sample rates and wide slots
+  const size_t dma_frame_bytes = 2 * (static_cast<size_t>(this->bits_per_sample_) / 8);
+  this->dma_buffer_frames_ = std::min<uint32_t>(audio_stream_info.ms_to_frames(DMA_BUFFER_DURATION_MS),
+                                                MAX_DMA_BUFFER_BYTES / dma_frame_bytes);
+  // Use as many buffers as needed to hold the target duration
+  const uint32_t dma_buffer_us = audio_stream_info.frames_to_microseconds(this->dma_buffer_frames_);
+  const uint32_t dma_buffers_count = (this->dma_buffers_duration_ms_ * 1000 + dma_buffer_us - 1) / dma_buffer_us;
+  this->dma_buffers_count_ = clamp<uint32_t>(dma_buffers_count, DMA_BUFFERS_COUNT, MAX_DMA_BUFFERS_COUNT);
+  uint32_t dma_buffer_length = this->dma_buffer_frames_;
 
 #ifdef USE_I2S_LEGACY
   i2s_channel_fmt_t channel = this->channel_;
@@ -544,7 +576,7 @@ esp_err_t I2SAudioSpeaker::start_i2s_driver_(audio::AudioStreamInfo &audio_strea
     .channel_format = channel,
     .communication_format = this->i2s_comm_fmt_,
     .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-    .dma_buf_count = DMA_BUFFERS_COUNT,
+    .dma_buf_count = this->dma_buffers_count_,
     .dma_buf_len = (int) dma_buffer_length,
     .use_apll = this->use_apll_,
     .tx_desc_auto_clear = true,
@@ -598,7 +630,7 @@ esp_err_t I2SAudioSpeaker::start_i2s_driver_(audio::AudioStreamInfo &audio_strea
   i2s_chan_config_t chan_cfg = {
       .id = this->parent_->get_port(),
       .role = this->i2s_role_,
-      .dma_desc_num = DMA_BUFFERS_COUNT,
+      .dma_desc_num = this->dma_buffers_count_,
       .dma_frame_num = dma_buffer_length,
       .auto_clear = true,
       .intr_priority = 3,
@@ -711,6 +743,15 @@ bool IRAM_ATTR I2SAudioSpeaker::i2s_on_sent_cb(i2s_chan_handle_t handle, i2s_eve
 }
 #endif
 
+void I2SAudioSpeaker::record_underrun_(bool audio_waiting) {
+  ++this->underruns_;
+  if (audio_waiting) {
+    // The task fell behind while it had audio to write, so use more DMA buffers from the next start on
+    this->dma_buffers_duration_ms_ =
+        std::min(this->dma_buffers_duration_ms_ + DMA_DURATION_STEP_MS, MAX_DMA_BUFFERS_DURATION_MS);
+  }
+}
+
 void I2SAudioSpeaker::stop_i2s_driver_() {
 #ifdef USE_I2S_LEGACY
   i2s_driver_uninstall(this->parent_->get_port());
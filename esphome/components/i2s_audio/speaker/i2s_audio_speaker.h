@@ -70,6 +70,18 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
   /// @param mute_state true for muting, false for unmuting
   void set_mute_state(bool mute_state) override;
 
+  /// @brief Returns the number of times the DMA buffers ran empty while playing, since the speaker last started.
+  uint32_t get_underrun_count() const { return this->underruns_; }
+  /// @brief Returns the longest time a write to the I2S driver blocked, since the speaker last started.
+  uint32_t get_max_write_latency_us() const { return this->max_write_latency_us_; }
+  /// @brief Returns the total duration of the DMA buffers used from the next start on. It grows whenever the DMA
+  /// buffers ran empty while audio was waiting to be written.
+  uint32_t get_dma_buffers_duration_ms() const { return this->dma_buffers_duration_ms_; }
+#ifndef USE_I2S_LEGACY
+  /// @brief Returns the number of frames written to the DMA buffers that haven't been sent yet.
+  uint32_t get_dma_fill_frames() const { return this->dma_fill_frames_; }
+#endif
+
  protected:
   /// @brief Function for the FreeRTOS task handling audio output.
   /// Allocates space for the buffers, reads audio from the ring buffer and writes audio to the I2S port. Stops
@@ -107,6 +119,9 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
   /// @brief Stops the I2S driver and unlocks the I2S port
   void stop_i2s_driver_();
 
+  /// @brief Counts an underrun and, if audio was waiting to be written, grows the DMA buffers for the next start.
+  void record_underrun_(bool audio_waiting);
+
   TaskHandle_t speaker_task_handle_{nullptr};
   EventGroupHandle_t event_group_{nullptr};
 
@@ -124,6 +139,15 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
 
   audio::AudioStreamInfo current_stream_info_;  // The currently loaded driver's stream info
 
+  // DMA buffer layout of the currently loaded driver
+  uint32_t dma_buffer_frames_{0};
+  uint8_t dma_buffers_count_{0};
+  uint32_t dma_buffers_duration_ms_{0};
+
+  uint32_t underruns_{0};
+  uint32_t max_write_latency_us_{0};
+  uint32_t dma_fill_frames_{0};
+
 #ifdef USE_I2S_LEGACY
 #if SOC_I2S_SUPPORTS_DAC
   i2s_dac_mode_t internal_dac_mode_{I2S_DAC_CHANNEL_DISABLE};
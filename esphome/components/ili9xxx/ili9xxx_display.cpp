@@ -55,10 +55,26 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  this->dirty_bands_.resize((this->height_ + (1 << ILI9XXX_DIRTY_BAND_SHIFT) - 1) >> ILI9XXX_DIRTY_BAND_SHIFT);
+  // the display memory holds garbage after a reset, so the first update has to send everything
+  this->reset_dirty_(true);
+}
+
+void ILI9XXXDisplay::reset_dirty_(bool dirty) {
+  for (size_t i = 0; i != this->dirty_bands_.size(); i++) {
+    DirtyBand &band = this->dirty_bands_[i];
+    if (dirty) {
+      band.x_low = 0;
+      band.y_low = i << ILI9XXX_DIRTY_BAND_SHIFT;
+      band.x_high = this->width_ - 1;
+      band.y_high = std::min<int>(band.y_low + (1 << ILI9XXX_DIRTY_BAND_SHIFT), this->height_) - 1;
+    } else {
+      band.x_low = this->width_;
+      band.y_low = this->height_;
+      band.x_high = 0;
+      band.y_high = 0;
+    }
+  }
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -128,38 +144,61 @@ void ILI9XXXDisplay::dump_config() {
 
 float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWARE; }
 
-void ILI9XXXDisplay::fill(Color color) {
-  if (!this->check_buffer_())
-    return;
-  uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+size_t ILI9XXXDisplay::to_buffer_color_(Color color, uint8_t *bytes) {
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-      break;
+      bytes[0] = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      return 1;
     case BITS_16:
-      new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
-      return;
+      put16_be(bytes, display::ColorUtil::color_to_565(color));
+      return 2;
     default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-      break;
+      bytes[0] = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      return 1;
   }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+}
+
+void HOT ILI9XXXDisplay::fill_row_(int y, size_t x_start, size_t x_end, const uint8_t *bytes, size_t pixel_size) {
+  uint8_t *row = this->buffer_ + y * this->width_ * pixel_size;
+  auto same = [row, pixel_size, bytes](size_t x) {
+    return row[x * pixel_size] == bytes[0] && (pixel_size == 1 || row[x * pixel_size + 1] == bytes[1]);
+  };
+  // only the part of the row between the first and the last pixel that actually change is marked dirty
+  size_t first = x_start;
+  while (first != x_end && same(first))
+    first++;
+  if (first == x_end)
+    return;
+  size_t last = x_end - 1;
+  while (same(last))
+    last--;
+  if (pixel_size == 1 || bytes[0] == bytes[1]) {
+    memset(row + first * pixel_size, bytes[0], (last - first + 1) * pixel_size);
+  } else {
+    for (size_t x = first; x <= last; x++) {
+      row[x * 2] = bytes[0];
+      row[x * 2 + 1] = bytes[1];
+    }
+  }
+  this->mark_dirty_(first, y);
+  this->mark_dirty_(last, y);
+}
+
+void ILI9XXXDisplay::fill(Color color) {
+  if (!this->check_buffer_())
+    return;
+  uint8_t bytes[2];
+  size_t pixel_size = this->to_buffer_color_(color, bytes);
+  for (int y = 0; y != this->get_height_internal(); y++)
+    this->fill_row_(y, 0, this->get_width_internal(), bytes, pixel_size);
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_span_internal(int x, int y, int width, Color color) {
+  if (!this->check_buffer_())
+    return;
+  uint8_t bytes[2];
+  size_t pixel_size = this->to_buffer_color_(color, bytes);
+  this->fill_row_(y, x, x + width, bytes, pixel_size);
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -195,15 +234,8 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+    // low and high watermarks may speed up drawing from buffer
+    this->mark_dirty_(x, y);
   }
 }
 
@@ -222,14 +254,42 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    return;
+  // Write the changed area of each band. Adjacent bands are combined into one area as long as that doesn't add much
+  // unchanged data, which saves on address window setup.
+  DirtyBand area{};
+  size_t area_pixels = 0;
+  bool pending = false;
+  for (const auto &band : this->dirty_bands_) {
+    if (band.x_high < band.x_low) {
+      if (pending)
+        this->write_area_(area.x_low, area.y_low, area.x_high, area.y_high);
+      pending = false;
+      continue;
+    }
+    size_t band_pixels = (band.x_high - band.x_low + 1) * (band.y_high - band.y_low + 1);
+    if (pending) {
+      DirtyBand merged{std::min(area.x_low, band.x_low), area.y_low, std::max(area.x_high, band.x_high), band.y_high};
+      size_t merged_pixels = (merged.x_high - merged.x_low + 1) * (merged.y_high - merged.y_low + 1);
+      if (merged_pixels * 4 <= (area_pixels + band_pixels) * 5) {
+        area = merged;
+        area_pixels = merged_pixels;
+        continue;
+      }
+      this->write_area_(area.x_low, area.y_low, area.x_high, area.y_high);
+    }
+    area = band;
+    area_pixels = band_pixels;
+    pending = true;
   }
+  if (pending)
+    this->write_area_(area.x_low, area.y_low, area.x_high, area.y_high);
+  this->reset_dirty_(false);
+}
 
+void ILI9XXXDisplay::write_area_(uint16_t x_low, uint16_t y_low, uint16_t x_high, uint16_t y_high) {
   // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+  size_t const w = x_high - x_low + 1;
+  size_t const h = y_high - y_low + 1;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -239,22 +299,21 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(this->buffer_ + y_low * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -296,11 +355,6 @@ void ILI9XXXDisplay::display_() {
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -10,6 +10,7 @@ namespace ili9xxx {
 
 static const char *const TAG = "ili9xxx";
 const size_t ILI9XXX_TRANSFER_BUFFER_SIZE = 126;  // ensure this is divisible by 6
+const uint8_t ILI9XXX_DIRTY_BAND_SHIFT = 4;        // changes are tracked per band of 16 rows
 
 enum ILI9XXXColorMode {
   BITS_8 = 0x08,
@@ -106,10 +107,32 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int width, Color color) override;
+  /// Convert color to the buffer format, returns the number of bytes per pixel.
+  size_t to_buffer_color_(Color color, uint8_t *bytes);
+  /// Set the pixels [x_start, x_end) of row y to the converted color, marking only the ones that change as dirty.
+  void fill_row_(int y, size_t x_start, size_t x_end, const uint8_t *bytes, size_t pixel_size);
   void setup_pins_();
 
   virtual void set_madctl();
   void display_();
+  void write_area_(uint16_t x_low, uint16_t y_low, uint16_t x_high, uint16_t y_high);
+  /// Mark the whole display as changed, or nothing if dirty is false.
+  void reset_dirty_(bool dirty);
+  inline void mark_dirty_(uint16_t x, uint16_t y) {
+    size_t index = y >> ILI9XXX_DIRTY_BAND_SHIFT;
+    if (index >= this->dirty_bands_.size())
+      return;
+    DirtyBand &band = this->dirty_bands_[index];
+    if (x < band.x_low)
+      band.x_low = x;
+    if (y < band.y_low)
+      band.y_low = y;
+    if (x > band.x_high)
+      band.x_high = x;
+    if (y > band.y_high)
+      band.y_high = y;
+  }
   void init_lcd_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -120,10 +143,15 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  /// Bounding box of the changed pixels in one band of rows, empty while x_high < x_low.
+  struct DirtyBand {
+    uint16_t x_low;
+    uint16_t y_low;
+    uint16_t x_high;
+    uint16_t y_high;
+  };
+  /// Separate boxes per band keep changes far apart from each other from making the whole area between them dirty.
+  std::vector<DirtyBand> dirty_bands_;
   const uint8_t *palette_{};
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -740,6 +740,8 @@ async def to_code(config):
     # By now the config should be a simple list.
     for entry in config:
         prog_arr, width, height, image_type, trans_value, _ = await write_image(entry)
-        cg.new_Pvariable(
+        var = cg.new_Pvariable(
             entry[CONF_ID], prog_arr, width, height, image_type, trans_value
         )
+        if entry.get(CONF_BYTE_ORDER) == "LITTLE_ENDIAN":
+            cg.add(var.set_big_endian(False))
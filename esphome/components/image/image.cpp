@@ -26,13 +26,20 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
 
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      // runs of equal pixels are drawn as one span
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        int img_x = img_x0;
+        while (img_x < w) {
+          bool on = this->get_binary_pixel_(img_x, img_y);
+          int run_end = img_x + 1;
+          while (run_end < w && this->get_binary_pixel_(run_end, img_y) == on)
+            run_end++;
+          if (on) {
+            display->fill_span(x + img_x, y + img_y, run_end - img_x, color_on);
           } else if (!this->transparency_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->fill_span(x + img_x, y + img_y, run_end - img_x, color_off);
           }
+          img_x = run_end;
         }
       }
       break;
@@ -65,6 +72,12 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
+#ifndef USE_ESP8266
+      if (this->transparency_ == TRANSPARENCY_OPAQUE) {
+        this->draw_pixels_(x, y, img_x0, img_y0, w, h, display);
+        break;
+      }
+#endif
       for (int img_x = img_x0; img_x < w; img_x++) {
         for (int img_y = img_y0; img_y < h; img_y++) {
           auto color = this->get_rgb565_pixel_(img_x, img_y);
@@ -75,6 +88,12 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB:
+#ifndef USE_ESP8266
+      if (this->transparency_ == TRANSPARENCY_OPAQUE) {
+        this->draw_pixels_(x, y, img_x0, img_y0, w, h, display);
+        break;
+      }
+#endif
       for (int img_x = img_x0; img_x < w; img_x++) {
         for (int img_y = img_y0; img_y < h; img_y++) {
           auto color = this->get_rgb_pixel_(img_x, img_y);
@@ -165,6 +184,16 @@ lv_img_dsc_t *Image::get_lv_img_dsc() {
 }
 #endif  // USE_LVGL
 
+void Image::draw_pixels_(int x, int y, int img_x0, int img_y0, int w, int h, display::Display *display) {
+  if (w <= img_x0 || h <= img_y0)
+    return;
+  // Displays with a native RGB565 or RGB buffer copy the rows directly instead of converting every pixel
+  auto bitness = this->type_ == IMAGE_TYPE_RGB565 ? display::COLOR_BITNESS_565 : display::COLOR_BITNESS_888;
+  display->draw_pixels_at(x + img_x0, y + img_y0, w - img_x0, h - img_y0, this->data_start_, display::COLOR_ORDER_RGB,
+                          bitness, this->type_ == IMAGE_TYPE_RGB || this->big_endian_, img_x0, img_y0,
+                          this->width_ - w);
+}
+
 bool Image::get_binary_pixel_(int x, int y) const {
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x + y * width_8;
@@ -192,7 +221,8 @@ Color Image::get_rgb_pixel_(int x, int y) const {
 }
 Color Image::get_rgb565_pixel_(int x, int y) const {
   const uint8_t *pos = this->data_start_ + (x + y * this->width_) * this->bpp_ / 8;
-  uint16_t rgb565 = encode_uint16(progmem_read_byte(pos), progmem_read_byte(pos + 1));
+  uint16_t rgb565 = this->big_endian_ ? encode_uint16(progmem_read_byte(pos), progmem_read_byte(pos + 1))
+                                       : encode_uint16(progmem_read_byte(pos + 1), progmem_read_byte(pos));
   auto r = (rgb565 & 0xF800) >> 11;
   auto g = (rgb565 & 0x07E0) >> 5;
   auto b = rgb565 & 0x001F;
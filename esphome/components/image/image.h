@@ -40,11 +40,16 @@ class Image : public display::BaseImage {
 
   bool has_transparency() const { return this->transparency_ != TRANSPARENCY_OPAQUE; }
 
+  /// Byte order of RGB565 pixel data, big endian unless configured otherwise.
+  void set_big_endian(bool big_endian) { this->big_endian_ = big_endian; }
+
 #ifdef USE_LVGL
   lv_img_dsc_t *get_lv_img_dsc();
 #endif
  protected:
   bool get_binary_pixel_(int x, int y) const;
+  /// Hands the clipped area of an opaque RGB565 or RGB image to the display as whole rows.
+  void draw_pixels_(int x, int y, int img_x0, int img_y0, int w, int h, display::Display *display);
   Color get_rgb_pixel_(int x, int y) const;
   Color get_rgb565_pixel_(int x, int y) const;
   Color get_grayscale_pixel_(int x, int y) const;
@@ -54,6 +59,7 @@ class Image : public display::BaseImage {
   ImageType type_;
   const uint8_t *data_start_;
   Transparency transparency_;
+  bool big_endian_{true};
   size_t bpp_{};
   size_t stride_{};
 #ifdef USE_LVGL
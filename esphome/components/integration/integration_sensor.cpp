@@ -29,7 +29,7 @@ void IntegrationSensor::process_sensor_value_(float value) {
   const double old_value = this->last_value_;
   const double new_value = value;
   const uint32_t dt_ms = now - this->last_update_;
-  const double dt = dt_ms * this->get_time_factor_();
+  const double dt = dt_ms * this->time_factor_;
   double area = 0.0f;
   switch (this->method_) {
     case INTEGRATION_METHOD_TRAPEZOID:
@@ -44,7 +44,7 @@ void IntegrationSensor::process_sensor_value_(float value) {
   }
   this->last_value_ = new_value;
   this->last_update_ = now;
-  this->publish_and_save_(this->result_ + area);
+  this->add_area_(area);
 }
 
 }  // namespace integration
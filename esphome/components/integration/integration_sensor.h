@@ -28,35 +28,52 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void setup() override;
   void dump_config() override;
   void set_sensor(Sensor *sensor) { sensor_ = sensor; }
-  void set_time(IntegrationSensorTime time) { time_ = time; }
+  void set_time(IntegrationSensorTime time) {
+    time_ = time;
+    time_factor_ = this->get_time_factor_();
+  }
   void set_method(IntegrationMethod method) { method_ = method; }
   void set_restore(bool restore) { restore_ = restore; }
-  void reset() { this->publish_and_save_(0.0f); }
+  void reset() {
+    this->compensation_ = 0.0;
+    this->publish_and_save_(0.0f);
+  }
 
  protected:
   void process_sensor_value_(float value);
-  float get_time_factor_() {
+  double get_time_factor_() {
     switch (this->time_) {
       case INTEGRATION_SENSOR_TIME_MILLISECOND:
-        return 1.0f;
+        return 1.0;
       case INTEGRATION_SENSOR_TIME_SECOND:
-        return 1.0f / 1000.0f;
+        return 1.0 / 1000.0;
       case INTEGRATION_SENSOR_TIME_MINUTE:
-        return 1.0f / 60000.0f;
+        return 1.0 / 60000.0;
       case INTEGRATION_SENSOR_TIME_HOUR:
-        return 1.0f / 3600000.0f;
+        return 1.0 / 3600000.0;
       case INTEGRATION_SENSOR_TIME_DAY:
-        return 1.0f / 86400000.0f;
+        return 1.0 / 86400000.0;
       default:
-        return 0.0f;
+        return 0.0;
     }
   }
+  /// Add an area to the result with compensated (Kahan) summation, so small areas are not lost on a large total.
+  void add_area_(double area) {
+    const double y = area - this->compensation_;
+    const double t = this->result_ + y;
+    this->compensation_ = (t - this->result_) - y;
+    this->publish_and_save_(t);
+  }
   void publish_and_save_(double result) {
     this->result_ = result;
     this->publish_state(result);
     if (this->restore_) {
+      // Only hand the value to the preferences when the stored float actually changes
       float result_f = result;
-      this->pref_.save(&result_f);
+      if (result_f != this->saved_result_) {
+        this->saved_result_ = result_f;
+        this->pref_.save(&result_f);
+      }
     }
   }
 
@@ -67,7 +84,11 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   ESPPreferenceObject pref_;
 
   uint32_t last_update_;
+  double time_factor_{0.0};
   double result_{0.0f};
+  /// Low order part lost while adding to result_, subtracted again from the next area.
+  double compensation_{0.0};
+  float saved_result_{NAN};
   float last_value_{0.0f};
 };
 
@@ -0,0 +1,149 @@
+#include "json_writer.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace esphome {
+namespace json {
+
+void JsonWriter::key_(const char *key) {
+  if (!this->first_)
+    this->out_.push_back(',');
+  this->first_ = false;
+  if (key == nullptr)
+    return;
+  this->out_.push_back('"');
+  this->string_part(key, strlen(key));
+  this->out_.append("\":", 2);
+}
+
+void JsonWriter::begin_object(const char *key) {
+  this->key_(key);
+  this->out_.push_back('{');
+  this->first_ = true;
+}
+
+void JsonWriter::end_object() {
+  this->out_.push_back('}');
+  this->first_ = false;
+}
+
+void JsonWriter::begin_array(const char *key) {
+  this->key_(key);
+  this->out_.push_back('[');
+  this->first_ = true;
+}
+
+void JsonWriter::end_array() {
+  this->out_.push_back(']');
+  this->first_ = false;
+}
+
+void JsonWriter::add(const char *key, const char *value, size_t len) {
+  this->begin_string(key);
+  this->string_part(value, len);
+  this->end_string();
+}
+
+void JsonWriter::add(const char *key, bool value) {
+  this->key_(key);
+  if (value) {
+    this->out_.append("true", 4);
+  } else {
+    this->out_.append("false", 5);
+  }
+}
+
+void JsonWriter::add_int_(const char *key, int32_t value) {
+  if (value < 0) {
+    // Negate in unsigned arithmetic so INT32_MIN does not overflow
+    this->add_uint_(key, 0u - static_cast<uint32_t>(value), true);
+  } else {
+    this->add_uint_(key, static_cast<uint32_t>(value), false);
+  }
+}
+
+void JsonWriter::add_uint_(const char *key, uint32_t value, bool negative) {
+  this->key_(key);
+  char buf[11];
+  char *pos = buf + sizeof(buf);
+  do {
+    *--pos = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  if (negative)
+    this->out_.push_back('-');
+  this->out_.append(pos, buf + sizeof(buf) - pos);
+}
+
+void JsonWriter::add(const char *key, float value) {
+  if (!std::isfinite(value)) {
+    this->add_null(key);
+    return;
+  }
+  this->key_(key);
+  // 7 significant digits round trip a float
+  char buf[16];
+  int len = snprintf(buf, sizeof(buf), "%.7g", value);
+  this->out_.append(buf, len);
+}
+
+void JsonWriter::add_null(const char *key) {
+  this->key_(key);
+  this->out_.append("null", 4);
+}
+
+void JsonWriter::begin_string(const char *key) {
+  this->key_(key);
+  this->out_.push_back('"');
+}
+
+void JsonWriter::string_part(const char *value, size_t len) {
+  static const char *const HEX_DIGITS = "0123456789abcdef";
+  const char *end = value + len;
+  const char *run = value;
+  for (const char *pos = value; pos != end; pos++) {
+    const auto c = static_cast<uint8_t>(*pos);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy the unescaped run in one go
+    this->out_.append(run, pos - run);
+    run = pos + 1;
+    this->out_.push_back('\\');
+    switch (c) {
+      case '"':
+      case '\\':
+        this->out_.push_back(static_cast<char>(c));
+        break;
+      case '\b':
+        this->out_.push_back('b');
+        break;
+      case '\f':
+        this->out_.push_back('f');
+        break;
+      case '\n':
+        this->out_.push_back('n');
+        break;
+      case '\r':
+        this->out_.push_back('r');
+        break;
+      case '\t':
+        this->out_.push_back('t');
+        break;
+      default:
+        this->out_.append("u00", 3);
+        this->out_.push_back(HEX_DIGITS[c >> 4]);
+        this->out_.push_back(HEX_DIGITS[c & 0x0F]);
+        break;
+    }
+  }
+  this->out_.append(run, end - run);
+}
+
+void JsonWriter::add_raw(const char *key, const std::string &json) {
+  this->key_(key);
+  this->out_.append(json);
+}
+
+}  // namespace json
+}  // namespace esphome
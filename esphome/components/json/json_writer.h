@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace json {
+
+/** Streaming JSON writer that appends straight to an output buffer.
+ *
+ * Unlike JsonBuilder there is no document in between: every key and value is serialized as soon as it is added.
+ * When the caller reuses the output string (e.g. the send buffer of an event source) producing a message costs no
+ * allocation once that buffer has grown to its working size.
+ *
+ * The writer does not validate the structure, keys must only be added inside objects and every begin_*() needs its
+ * end_*().
+ */
+class JsonWriter {
+ public:
+  explicit JsonWriter(std::string &out) : out_(out) {}
+
+  void begin_object(const char *key = nullptr);
+  void end_object();
+  void begin_array(const char *key = nullptr);
+  void end_array();
+
+  void add(const char *key, const char *value) { this->add(key, value, strlen(value)); }
+  void add(const char *key, const char *value, size_t len);
+  void add(const char *key, const std::string &value) { this->add(key, value.data(), value.size()); }
+  void add(const char *key, const StringRef &value) { this->add(key, value.c_str(), value.size()); }
+  void add(const char *key, bool value);
+  template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                                   (sizeof(T) <= sizeof(uint32_t)),
+                                               int>::type = 0>
+  void add(const char *key, T value) {
+    if (std::is_signed<T>::value) {
+      this->add_int_(key, static_cast<int32_t>(value));
+    } else {
+      this->add_uint_(key, static_cast<uint32_t>(value), false);
+    }
+  }
+  /// NaN and infinity are written as null, like ArduinoJson does.
+  void add(const char *key, float value);
+  void add_null(const char *key);
+
+  /// Start a string value that is written in several parts, e.g. a prefix and a name.
+  void begin_string(const char *key);
+  void string_part(const char *value, size_t len);
+  void string_part(const char *value) { this->string_part(value, strlen(value)); }
+  void string_part(const std::string &value) { this->string_part(value.data(), value.size()); }
+  void end_string() { this->out_.push_back('"'); }
+
+  /// Append an already serialized JSON value, e.g. the output of JsonBuilder::serialize().
+  void add_raw(const char *key, const std::string &json);
+
+ protected:
+  /// Write the separator and key for the next value of the current object or array.
+  void key_(const char *key);
+  void add_int_(const char *key, int32_t value);
+  void add_uint_(const char *key, uint32_t value, bool negative);
+
+  std::string &out_;
+  /// No value has been written at the current nesting level yet.
+  bool first_{true};
+};
+
+}  // namespace json
+}  // namespace esphome
@@ -31,8 +31,12 @@ static const uint8_t LCD_DISPLAY_FUNCTION_5X10_DOTS = 0x04;
 
 void LCDDisplay::setup() {
   this->buffer_ = new uint8_t[this->rows_ * this->columns_];  // NOLINT
-  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
+  this->shown_ = new uint8_t[this->rows_ * this->columns_];   // NOLINT
+  // The display is cleared below, which fills it with spaces
+  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++) {
     this->buffer_[i] = ' ';
+    this->shown_[i] = ' ';
+  }
 
   uint8_t display_function = 0;
 
@@ -89,25 +93,22 @@ void LCDDisplay::setup() {
 
 float LCDDisplay::get_setup_priority() const { return setup_priority::PROCESSOR; }
 void HOT LCDDisplay::display() {
-  this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0);
-
-  for (uint8_t i = 0; i < this->columns_; i++)
-    this->send(this->buffer_[i], true);
-
-  if (this->rows_ >= 3) {
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ * 2 + i], true);
-  }
-
-  if (this->rows_ >= 1) {
-    this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0x40);
-
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ + i], true);
-
-    if (this->rows_ >= 4) {
-      for (uint8_t i = 0; i < this->columns_; i++)
-        this->send(this->buffer_[this->columns_ * 3 + i], true);
+  // Only characters that differ from what the display shows are sent, every one of them is a slow transfer on
+  // I2C backpacks. The address is only set when skipping over unchanged characters, as it auto-increments.
+  for (uint8_t row = 0; row < this->rows_; row++) {
+    // Rows 2 and 3 continue the DDRAM lines of rows 0 and 1
+    const uint8_t row_address = (row % 2 == 0 ? 0x00 : 0x40) + (row >= 2 ? this->columns_ : 0);
+    const uint16_t row_start = row * this->columns_;
+    int address = -1;
+    for (uint8_t column = 0; column < this->columns_; column++) {
+      const uint16_t pos = row_start + column;
+      if (this->buffer_[pos] == this->shown_[pos])
+        continue;
+      if (address != row_address + column)
+        this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | (row_address + column));
+      this->send(this->buffer_[pos], true);
+      this->shown_[pos] = this->buffer_[pos];
+      address = row_address + column + 1;
     }
   }
 }
@@ -59,6 +59,7 @@ class LCDDisplay : public PollingComponent {
   uint8_t columns_;
   uint8_t rows_;
   uint8_t *buffer_{nullptr};
+  uint8_t *shown_{nullptr};  ///< What the display currently shows
   std::map<uint8_t, std::vector<uint8_t> > user_defined_chars_;
 };
 
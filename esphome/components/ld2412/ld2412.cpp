@@ -310,9 +310,7 @@ void LD2412Component::restart_and_read_all_info() {
 }
 
 void LD2412Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
-  }
+  ld24xx::read_available(this, [this](uint8_t byte) { this->readline_(byte); });
 }
 
 void LD2412Component::send_command_(uint8_t command, const uint8_t *command_value, uint8_t command_value_len) {
@@ -276,9 +276,7 @@ void LD2450Component::dump_config() {
 }
 
 void LD2450Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
-  }
+  ld24xx::read_available(this, [this](uint8_t byte) { this->readline_(byte); });
 }
 
 // Count targets in zone
@@ -2,6 +2,8 @@
 
 #include "esphome/core/defines.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 
 #ifdef USE_SENSOR
@@ -39,6 +41,20 @@
 namespace esphome {
 namespace ld24xx {
 
+/// Read everything the UART has buffered and pass it to \p handle_byte one byte at a time. The radars send frames
+/// at 10 Hz and more, reading them in chunks takes one call into the UART driver per chunk instead of two per byte.
+template<typename Device, typename F> void read_available(Device *device, F &&handle_byte) {
+  uint8_t chunk[64];
+  size_t available;
+  while ((available = device->available()) > 0) {
+    const size_t len = std::min(available, sizeof(chunk));
+    if (!device->read_array(chunk, len))
+      return;
+    for (size_t i = 0; i < len; i++)
+      handle_byte(chunk[i]);
+  }
+}
+
 #ifdef USE_SENSOR
 // Helper class to store a sensor with a deduplicator & publish state only when the value changes
 template<typename T> class SensorWithDedup {
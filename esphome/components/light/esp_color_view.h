@@ -72,6 +72,18 @@ class ESPColorView : public ESPColorSettable {
   void lighten(uint8_t delta) override { this->set(this->get().lighten(delta)); }
   void darken(uint8_t delta) override { this->set(this->get().darken(delta)); }
   Color get() const { return Color(this->get_red(), this->get_green(), this->get_blue(), this->get_white()); }
+  /// Get the color as stored in the output buffer, with color correction applied.
+  Color get_raw() const {
+    return Color(this->get_red_raw(), this->get_green_raw(), this->get_blue_raw(), this->get_white_raw());
+  }
+  /// Store an already corrected color, as returned by get_raw() of a view with the same correction.
+  void set_raw(const Color &color) {
+    *this->red_ = color.red;
+    *this->green_ = color.green;
+    *this->blue_ = color.blue;
+    if (this->white_ != nullptr)
+      *this->white_ = color.white;
+  }
   uint8_t get_red() const { return this->color_correction_->color_uncorrect_red(*this->red_); }
   uint8_t get_red_raw() const { return *this->red_; }
   uint8_t get_green() const { return this->color_correction_->color_uncorrect_green(*this->green_); }
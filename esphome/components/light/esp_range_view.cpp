@@ -18,8 +18,14 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+  if (this->size() == 0)
+    return;
+  // Correct the color once, then copy the result to the other LEDs
+  ESPColorView first = (*this->parent_)[this->begin_];
+  first.set(color);
+  const Color raw = first.get_raw();
+  for (int32_t i = this->begin_ + 1; i < this->end_; i++) {
+    (*this->parent_)[i].set_raw(raw);
   }
 }
 
@@ -75,15 +81,16 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  // Within the same light the correction is the same, so the corrected values can be copied as they are
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
+      (*this)[i].set_raw(rhs[i].get_raw());
     }
   } else {
     // Copy from right
     for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
+      (*this)[i].set_raw(rhs[i].get_raw());
     }
   }
 
@@ -33,6 +33,8 @@ class LightTransitionTransformer : public LightTransformer {
       this->intermediate_values_ = this->start_values_;
       this->intermediate_values_.set_state(false);
     }
+
+    this->last_step_ = -1;
   }
 
   optional<LightColorValues> apply() override {
@@ -47,11 +49,19 @@ class LightTransitionTransformer : public LightTransformer {
 
     LightColorValues &start = this->changing_color_mode_ && p > 0.5f ? this->intermediate_values_ : this->start_values_;
     LightColorValues &end = this->changing_color_mode_ && p < 0.5f ? this->intermediate_values_ : this->end_values_;
+    const bool second_half = this->changing_color_mode_ && p > 0.5f;
     if (this->changing_color_mode_)
       p = p < 0.5f ? p * 2 : (p - 0.5) * 2;
 
     float v = LightTransitionTransformer::smoothed_progress(p);
-    return LightColorValues::lerp(start, end, v);
+
+    // Long transitions run through many loop iterations per visible step, only write the output when the
+    // transition moved on to the next one.
+    int32_t step = lroundf(v * TRANSITION_STEPS) + (second_half ? TRANSITION_STEPS + 1 : 0);
+    if (step == this->last_step_)
+      return {};
+    this->last_step_ = step;
+    return LightColorValues::lerp(start, end, (float) (step % (TRANSITION_STEPS + 1)) / TRANSITION_STEPS);
   }
 
  protected:
@@ -59,9 +69,13 @@ class LightTransitionTransformer : public LightTransformer {
   // transition from 0 to 1 on x = [0, 1]
   static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
 
+  /// Number of steps a transition is divided into, small enough not to be visible as steps.
+  static constexpr int32_t TRANSITION_STEPS = 1024;
+
   LightColorValues end_values_{};
   LightColorValues intermediate_values_{};
   bool changing_color_mode_{false};
+  int32_t last_step_{-1};
 };
 
 class LightFlashTransformer : public LightTransformer {
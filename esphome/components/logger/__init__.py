@@ -93,9 +93,13 @@ USB_SERIAL_JTAG = "USB_SERIAL_JTAG"
 USB_CDC = "USB_CDC"
 DEFAULT = "DEFAULT"
 
+CONF_BINARY_LOGGING = "binary_logging"
 CONF_INITIAL_LEVEL = "initial_level"
 CONF_LOGGER_ID = "logger_id"
 CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
+CONF_TEXT_LEVEL = "text_level"
+
+KEY_LOG_LISTENERS = "log_listeners"
 
 UART_SELECTION_ESP32 = {
     VARIANT_ESP32: [UART0, UART1, UART2],
@@ -182,6 +186,13 @@ def validate_local_no_higher_than_global(value):
     return value
 
 
+def request_log_listener(config):
+    """Reserve a slot for a component that registers with Logger::add_log_listener()."""
+    data = CORE.data.setdefault(CONF_LOGGER, {})
+    data[KEY_LOG_LISTENERS] = data.get(KEY_LOG_LISTENERS, 0) + 1
+    return config
+
+
 Logger = logger_ns.class_("Logger", cg.Component)
 LoggerMessageTrigger = logger_ns.class_(
     "LoggerMessageTrigger",
@@ -190,6 +201,21 @@ LoggerMessageTrigger = logger_ns.class_(
 
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+
+
+BINARY_LOGGING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_TEXT_LEVEL, default="DEBUG"): is_log_level,
+    }
+)
+
+
+def _binary_logging_schema(config):
+    if config is None:
+        config = {}
+    return BINARY_LOGGING_SCHEMA(config)
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -249,6 +275,7 @@ CONFIG_SCHEMA = cv.All(
                 }
             ),
             cv.Optional(CONF_INITIAL_LEVEL): is_log_level,
+            cv.Optional(CONF_BINARY_LOGGING): _binary_logging_schema,
             cv.Optional(CONF_ON_MESSAGE): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(LoggerMessageTrigger),
@@ -291,10 +318,18 @@ async def to_code(config):
         )
     cg.add(log.pre_setup())
 
-    for tag, log_level in config[CONF_LOGS].items():
+    # Sorted like the lookup table in Logger, each entry is then appended at the end
+    for tag, log_level in sorted(config[CONF_LOGS].items()):
         cg.add(log.set_log_level(tag, LOG_LEVELS[log_level]))
 
     cg.add_define("USE_LOGGER")
+    listeners = CORE.data[CONF_LOGGER].get(KEY_LOG_LISTENERS, 0)
+    cg.add_define(
+        "ESPHOME_LOG_LISTENERS", listeners + len(config.get(CONF_ON_MESSAGE, []))
+    )
+    if (binary_config := config.get(CONF_BINARY_LOGGING)) is not None:
+        cg.add_define("USE_LOGGER_BINARY")
+        cg.add(log.set_binary_text_level(LOG_LEVELS[binary_config[CONF_TEXT_LEVEL]]))
     this_severity = LOG_LEVEL_SEVERITY.index(level)
     cg.add_build_flag(f"-DESPHOME_LOG_LEVEL={LOG_LEVELS[level]}")
 
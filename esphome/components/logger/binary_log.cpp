@@ -0,0 +1,233 @@
+#include "binary_log.h"
+
+#ifdef USE_LOGGER_BINARY
+#include <cstring>
+
+namespace esphome::logger {
+
+namespace {
+
+enum class ArgLength : uint8_t { NONE, CHAR, SHORT, LONG, LONG_LONG, INTMAX, SIZE, PTRDIFF, LONG_DOUBLE };
+
+class ArgWriter {
+ public:
+  ArgWriter(uint8_t *buffer, size_t size) : pos_(buffer), end_(buffer + size) {}
+
+  bool write_varint(uint64_t value) {
+    do {
+      if (this->pos_ == this->end_)
+        return false;
+      uint8_t byte = value & 0x7F;
+      value >>= 7;
+      if (value != 0)
+        byte |= 0x80;
+      *this->pos_++ = byte;
+    } while (value != 0);
+    return true;
+  }
+  bool write_signed(int64_t value) { return this->write_varint(static_cast<uint64_t>(value)); }
+  bool write_double(double value) {
+    uint64_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    if (static_cast<size_t>(this->end_ - this->pos_) < sizeof(raw))
+      return false;
+    for (size_t i = 0; i < sizeof(raw); i++)
+      *this->pos_++ = static_cast<uint8_t>(raw >> (i * 8));
+    return true;
+  }
+  bool write_string(const char *value, size_t max_len) {
+    if (value == nullptr)
+      value = "(null)";
+    size_t len = strnlen(value, max_len);
+    if (!this->write_varint(len) || static_cast<size_t>(this->end_ - this->pos_) < len)
+      return false;
+    std::memcpy(this->pos_, value, len);
+    this->pos_ += len;
+    return true;
+  }
+
+  size_t written(const uint8_t *buffer) const { return this->pos_ - buffer; }
+
+ protected:
+  uint8_t *pos_;
+  uint8_t *end_;
+};
+
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+}  // namespace
+
+bool encode_binary_log_args(const char *format, va_list args, uint8_t *buffer, size_t buffer_size, size_t *len) {
+  ArgWriter writer(buffer, buffer_size);
+  const char *p = format;
+  while (*p != '\0') {
+    if (*p++ != '%')
+      continue;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+      p++;
+    if (*p == '*') {
+      p++;
+      if (!writer.write_signed(va_arg(args, int)))
+        return false;
+    } else {
+      while (is_digit(*p))
+        p++;
+    }
+    size_t precision = MAX_BINARY_LOG_STRING;
+    if (*p == '.') {
+      p++;
+      int value = 0;
+      if (*p == '*') {
+        p++;
+        value = va_arg(args, int);
+        if (!writer.write_signed(value))
+          return false;
+      } else {
+        while (is_digit(*p))
+          value = value * 10 + (*p++ - '0');
+      }
+      if (value >= 0 && static_cast<size_t>(value) < precision)
+        precision = value;
+    }
+
+    ArgLength length = ArgLength::NONE;
+    switch (*p) {
+      case 'h':
+        p++;
+        length = ArgLength::SHORT;
+        if (*p == 'h') {
+          p++;
+          length = ArgLength::CHAR;
+        }
+        break;
+      case 'l':
+        p++;
+        length = ArgLength::LONG;
+        if (*p == 'l') {
+          p++;
+          length = ArgLength::LONG_LONG;
+        }
+        break;
+      case 'j':
+        p++;
+        length = ArgLength::INTMAX;
+        break;
+      case 'z':
+        p++;
+        length = ArgLength::SIZE;
+        break;
+      case 't':
+        p++;
+        length = ArgLength::PTRDIFF;
+        break;
+      case 'L':
+        p++;
+        length = ArgLength::LONG_DOUBLE;
+        break;
+      default:
+        break;
+    }
+
+    bool ok;
+    switch (*p++) {
+      case 'd':
+      case 'i': {
+        int64_t value;
+        switch (length) {
+          case ArgLength::LONG:
+            value = va_arg(args, long);
+            break;
+          case ArgLength::LONG_LONG:
+            value = va_arg(args, long long);
+            break;
+          case ArgLength::INTMAX:
+            value = va_arg(args, intmax_t);
+            break;
+          case ArgLength::SIZE:
+            value = static_cast<int64_t>(va_arg(args, size_t));
+            break;
+          case ArgLength::PTRDIFF:
+            value = va_arg(args, ptrdiff_t);
+            break;
+          default:
+            // char and short are promoted to int, the receiver narrows them again
+            value = va_arg(args, int);
+            break;
+        }
+        ok = writer.write_signed(value);
+        break;
+      }
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X': {
+        uint64_t value;
+        switch (length) {
+          case ArgLength::LONG:
+            value = va_arg(args, unsigned long);
+            break;
+          case ArgLength::LONG_LONG:
+            value = va_arg(args, unsigned long long);
+            break;
+          case ArgLength::INTMAX:
+            value = va_arg(args, uintmax_t);
+            break;
+          case ArgLength::SIZE:
+            value = va_arg(args, size_t);
+            break;
+          case ArgLength::PTRDIFF:
+            value = static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+            break;
+          default:
+            value = va_arg(args, unsigned int);
+            break;
+        }
+        ok = writer.write_varint(value);
+        break;
+      }
+      case 'c':
+        if (length == ArgLength::LONG)
+          return false;  // Wide character
+        ok = writer.write_signed(va_arg(args, int));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        if (length == ArgLength::LONG_DOUBLE) {
+          ok = writer.write_double(static_cast<double>(va_arg(args, long double)));
+        } else {
+          ok = writer.write_double(va_arg(args, double));
+        }
+        break;
+      case 's':
+        if (length == ArgLength::LONG)
+          return false;  // Wide string
+        ok = writer.write_string(va_arg(args, const char *), precision);
+        break;
+      case 'p':
+        ok = writer.write_varint(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+        break;
+      default:
+        // %n, wide characters or a malformed format, let the caller format the line as text
+        return false;
+    }
+    if (!ok)
+      return false;
+  }
+  *len = writer.written(buffer);
+  return true;
+}
+
+}  // namespace esphome::logger
+
+#endif  // USE_LOGGER_BINARY
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_BINARY
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::logger {
+
+// Longest string argument that is packed, longer strings are truncated
+static constexpr size_t MAX_BINARY_LOG_STRING = 255;
+
+/** Pack the arguments of a printf style format string instead of formatting them.
+ *
+ * The receiver looks up the format string by its address in the firmware image and formats the line itself.
+ * Arguments are written in the order they are consumed by the format string, '*' widths and precisions
+ * included:
+ *  - integers, characters and pointers: varint of the value as a 64 bit unsigned integer, signed conversions
+ *    are sign extended first
+ *  - floating point: 8 byte little endian IEEE 754 double
+ *  - strings: varint length followed by the bytes, without terminator
+ *
+ * Returns false if the format uses a conversion that cannot be packed (%n) or the record does not fit in
+ * buffer_size; args has been consumed in either case.
+ */
+bool encode_binary_log_args(const char *format, va_list args, uint8_t *buffer, size_t buffer_size, size_t *len);
+
+}  // namespace esphome::logger
+
+#endif  // USE_LOGGER_BINARY
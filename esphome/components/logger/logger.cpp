@@ -1,5 +1,7 @@
 #include "logger.h"
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
 #include <memory>  // For unique_ptr
 #endif
@@ -132,6 +134,17 @@ void Logger::log_vprintf_(uint8_t level, const char *tag, int line, const __Flas
   // Save the offset before calling format_log_to_buffer_with_terminator_
   // since it will increment tx_buffer_at_ to the end of the formatted string
   uint32_t msg_start = this->tx_buffer_at_;
+#ifdef USE_LOGGER_BINARY
+  // The copied format string is parsed, the record carries the address of the original in flash. The text below
+  // is formatted over the record once the binary callbacks are done with it.
+  this->line_sent_binary_ = this->binary_log_active_ && level > this->binary_text_level_ &&
+                            this->log_binary_(level, tag, line, format, this->tx_buffer_, args, this->tx_buffer_at_);
+  if (!this->is_text_needed_()) {
+    this->line_sent_binary_ = false;
+    global_recursion_guard_ = false;
+    return;
+  }
+#endif
   this->format_log_to_buffer_with_terminator_(level, tag, line, this->tx_buffer_, args, this->tx_buffer_,
                                               &this->tx_buffer_at_, this->tx_buffer_size_);
 
@@ -141,16 +154,23 @@ void Logger::log_vprintf_(uint8_t level, const char *tag, int line, const __Flas
   }
   size_t msg_length =
       this->tx_buffer_at_ - msg_start;  // Don't subtract 1 - tx_buffer_at_ is already at the null terminator position
-  this->log_callback_.call(level, tag, this->tx_buffer_ + msg_start, msg_length);
+  this->call_log_callbacks_(level, tag, this->tx_buffer_ + msg_start, msg_length);
+#ifdef USE_LOGGER_BINARY
+  this->line_sent_binary_ = false;
+#endif
 
   global_recursion_guard_ = false;
 }
 #endif  // USE_STORE_LOG_STR_IN_FLASH
 
 inline uint8_t Logger::level_for(const char *tag) {
-  auto it = this->log_levels_.find(tag);
-  if (it != this->log_levels_.end())
-    return it->second;
+  // Most configurations have no per-tag levels, every message then only costs this check
+  if (this->tag_levels_.empty())
+    return this->current_level_;
+  auto it = std::lower_bound(this->tag_levels_.begin(), this->tag_levels_.end(), tag,
+                             [](const TagLevel &entry, const char *t) { return strcmp(entry.tag.c_str(), t) < 0; });
+  if (it != this->tag_levels_.end() && strcmp(it->tag.c_str(), tag) == 0)
+    return it->level;
   return this->current_level_;
 }
 
@@ -198,7 +218,7 @@ void Logger::process_messages_() {
       this->write_footer_to_buffer_(this->tx_buffer_, &this->tx_buffer_at_, this->tx_buffer_size_);
       this->tx_buffer_[this->tx_buffer_at_] = '\0';
       size_t msg_len = this->tx_buffer_at_;  // We already know the length from tx_buffer_at_
-      this->log_callback_.call(message->level, message->tag, this->tx_buffer_, msg_len);
+      this->call_log_callbacks_(message->level, message->tag, this->tx_buffer_, msg_len);
       // At this point all the data we need from message has been transferred to the tx_buffer
       // so we can release the message to allow other tasks to use it as soon as possible.
       this->log_buffer_->release_message_main_loop(received_token);
@@ -211,6 +231,12 @@ void Logger::process_messages_() {
         this->write_msg_(this->tx_buffer_);
       }
     }
+
+    const uint32_t dropped = this->log_buffer_->get_dropped_count();
+    if (dropped != this->task_log_dropped_reported_) {
+      ESP_LOGW(TAG, "Task log buffer full, %" PRIu32 " messages dropped", dropped - this->task_log_dropped_reported_);
+      this->task_log_dropped_reported_ = dropped;
+    }
   } else {
     // No messages to process, disable loop if appropriate
     // This reduces overhead when there's no async logging activity
@@ -220,15 +246,60 @@ void Logger::process_messages_() {
 }
 
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
-void Logger::set_log_level(const std::string &tag, uint8_t log_level) { this->log_levels_[tag] = log_level; }
+void Logger::set_log_level(const std::string &tag, uint8_t log_level) {
+  auto it = std::lower_bound(this->tag_levels_.begin(), this->tag_levels_.end(), tag,
+                             [](const TagLevel &entry, const std::string &t) { return entry.tag < t; });
+  if (it != this->tag_levels_.end() && it->tag == tag) {
+    it->level = log_level;
+    return;
+  }
+  this->tag_levels_.insert(it, TagLevel{tag, log_level});
+}
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY) || defined(USE_ZEPHYR)
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
 void Logger::add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback) {
+#ifdef USE_LOGGER_BINARY
+  this->text_consumers_++;
+#endif
   this->log_callback_.add(std::move(callback));
 }
+void Logger::add_log_listener(log_listener_t listener, void *context) {
+#ifdef USE_LOGGER_BINARY
+  this->text_consumers_++;
+#endif
+  if (this->log_listeners_.add(listener, context))
+    return;
+  // More listeners than reserved, e.g. from external components
+  this->log_callback_.add([listener, context](uint8_t level, const char *tag, const char *message, size_t len) {
+    listener(context, level, tag, message, len);
+  });
+}
+#ifdef USE_LOGGER_BINARY
+void Logger::add_on_binary_log_callback(
+    std::function<void(uint8_t, const char *, int, const void *, const uint8_t *, size_t)> &&callback) {
+  this->binary_log_callback_.add(std::move(callback));
+}
+
+bool Logger::log_binary_(uint8_t level, const char *tag, int line, const void *format_address, const char *format,
+                         va_list args, uint16_t offset) {
+  if (offset >= this->tx_buffer_size_)
+    return false;
+  auto *record = reinterpret_cast<uint8_t *>(this->tx_buffer_) + offset;
+  size_t record_len;
+  // The arguments are still needed if the line falls back to text
+  va_list args_copy;
+  va_copy(args_copy, args);
+  const bool packed = encode_binary_log_args(format, args_copy, record, this->tx_buffer_size_ - offset, &record_len);
+  va_end(args_copy);
+  if (!packed)
+    return false;
+  this->binary_log_callback_.call(level, tag, line, format_address, record, record_len);
+  return true;
+}
+#endif
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 
 #ifdef USE_STORE_LOG_STR_IN_FLASH
@@ -267,12 +338,17 @@ void Logger::dump_config() {
 #endif
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   if (this->log_buffer_) {
-    ESP_LOGCONFIG(TAG, "  Task Log Buffer Size: %u", this->log_buffer_->size());
+    ESP_LOGCONFIG(TAG,
+                  "  Task Log Buffer Size: %u\n"
+                  "  Task Log Buffer High Water Mark: %u\n"
+                  "  Task Log Messages Dropped: %" PRIu32,
+                  this->log_buffer_->size(), this->log_buffer_->get_high_water_mark(),
+                  this->log_buffer_->get_dropped_count());
   }
 #endif
 
-  for (auto &it : this->log_levels_) {
-    ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.first.c_str(), LOG_STR_ARG(LOG_LEVELS[it.second]));
+  for (auto &it : this->tag_levels_) {
+    ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_STR_ARG(LOG_LEVELS[it.level]));
   }
 }
 
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <cstdarg>
-#include <map>
+#include <string>
+#include <vector>
 #ifdef USE_ESP32
 #include <pthread.h>
 #endif
@@ -10,6 +11,9 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#ifdef USE_LOGGER_BINARY
+#include "binary_log.h"
+#endif
 
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
 #include "task_log_buffer.h"
@@ -109,6 +113,8 @@ class Logger : public Component {
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   void init_log_buffer(size_t total_buffer_size);
+  /// Messages from other tasks that were dropped since boot because the task log buffer was full.
+  uint32_t get_task_log_dropped_count() const { return this->log_buffer_->get_dropped_count(); }
 #endif
 #if defined(USE_ESPHOME_TASK_LOG_BUFFER) || (defined(USE_ZEPHYR) && defined(USE_LOGGER_USB_CDC))
   void loop() override;
@@ -145,6 +151,26 @@ class Logger : public Component {
 
   /// Register a callback that will be called for every log message sent
   void add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback);
+  using log_listener_t = void (*)(void *, uint8_t, const char *, const char *, size_t);
+  /// Register a function that will be called with \p context for every log message sent. Components that
+  /// reserve a slot with request_log_listener() in their config schema are stored without allocating.
+  void add_log_listener(log_listener_t listener, void *context);
+#ifdef USE_LOGGER_BINARY
+  /// Lines with a level above text_level are packed for the binary log callbacks instead of being formatted for them
+  void set_binary_text_level(uint8_t text_level) { this->binary_text_level_ = text_level; }
+  /// Lines are only packed while at least one binary log subscriber is connected. text_needed is false when the
+  /// text listener of that subscriber has no client left that wants the packed lines as text.
+  void set_binary_log_active(bool active, bool text_needed) {
+    this->binary_log_active_ = active;
+    this->binary_text_needed_ = text_needed;
+  }
+  /// True while the text callbacks run for a line that the binary log callbacks already received
+  bool is_line_sent_binary() const { return this->line_sent_binary_; }
+  /// Register a callback for lines that are not formatted, called with level, tag, line, the address of the format
+  /// string and the arguments packed by encode_binary_log_args()
+  void add_on_binary_log_callback(
+      std::function<void(uint8_t, const char *, int, const void *, const uint8_t *, size_t)> &&callback);
+#endif
 
   // add a listener for log level changes
   void add_listener(std::function<void(uint8_t)> &&callback) { this->level_callback_.add(std::move(callback)); }
@@ -183,9 +209,30 @@ class Logger : public Component {
     }
   }
 
+#ifdef USE_LOGGER_BINARY
+  // Pack the arguments into tx_buffer_ starting at offset and pass them to the binary log callbacks.
+  // Returns false if the line has to be formatted as text instead.
+  bool log_binary_(uint8_t level, const char *tag, int line, const void *format_address, const char *format,
+                   va_list args, uint16_t offset);
+  // A line that went out binary is only formatted if the console or some text consumer still wants it. The binary
+  // subscriber's own text listener is one of text_consumers_, so any further one needs every line.
+  inline bool HOT is_text_needed_() const {
+    return !this->line_sent_binary_ || this->baud_rate_ > 0 || this->binary_text_needed_ || this->text_consumers_ > 1;
+  }
+#endif
+
   // Helper to format and send a log message to both console and callbacks
   inline void HOT log_message_to_buffer_and_send_(uint8_t level, const char *tag, int line, const char *format,
                                                   va_list args) {
+#ifdef USE_LOGGER_BINARY
+    // Binary subscribers format the line themselves, the console and the text callbacks still get it as text
+    this->line_sent_binary_ = this->binary_log_active_ && level > this->binary_text_level_ &&
+                              this->log_binary_(level, tag, line, format, format, args, 0);
+    if (!this->is_text_needed_()) {
+      this->line_sent_binary_ = false;
+      return;
+    }
+#endif
     // Format to tx_buffer and prepare for output
     this->tx_buffer_at_ = 0;  // Initialize buffer position
     this->format_log_to_buffer_with_terminator_(level, tag, line, format, args, this->tx_buffer_, &this->tx_buffer_at_,
@@ -194,7 +241,15 @@ class Logger : public Component {
     if (this->baud_rate_ > 0) {
       this->write_msg_(this->tx_buffer_);  // If logging is enabled, write to console
     }
-    this->log_callback_.call(level, tag, this->tx_buffer_, this->tx_buffer_at_);
+    this->call_log_callbacks_(level, tag, this->tx_buffer_, this->tx_buffer_at_);
+#ifdef USE_LOGGER_BINARY
+    this->line_sent_binary_ = false;
+#endif
+  }
+
+  inline void HOT call_log_callbacks_(uint8_t level, const char *tag, const char *message, size_t message_len) {
+    this->log_listeners_.call(level, tag, message, message_len);
+    this->log_callback_.call(level, tag, message, message_len);
   }
 
   // Write the body of the log message to the buffer
@@ -248,17 +303,34 @@ class Logger : public Component {
 #endif
 
   // Large objects (internally aligned)
-  std::map<std::string, uint8_t> log_levels_{};
+  // Per-tag overrides sorted by tag, searched without building a std::string for every message
+  struct TagLevel {
+    std::string tag;
+    uint8_t level;
+  };
+  std::vector<TagLevel> tag_levels_{};
+  StaticCallbackManager<void(uint8_t, const char *, const char *, size_t), ESPHOME_LOG_LISTENERS> log_listeners_{};
   CallbackManager<void(uint8_t, const char *, const char *, size_t)> log_callback_{};
   CallbackManager<void(uint8_t)> level_callback_{};
+#ifdef USE_LOGGER_BINARY
+  CallbackManager<void(uint8_t, const char *, int, const void *, const uint8_t *, size_t)> binary_log_callback_{};
+#endif
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   std::unique_ptr<logger::TaskLogBuffer> log_buffer_;  // Will be initialized with init_log_buffer
+  uint32_t task_log_dropped_reported_{0};               // Dropped count the last warning was based on
 #endif
 
   // Group smaller types together at the end
   uint16_t tx_buffer_at_{0};
   uint16_t tx_buffer_size_{0};
   uint8_t current_level_{ESPHOME_LOG_LEVEL_VERY_VERBOSE};
+#ifdef USE_LOGGER_BINARY
+  uint8_t binary_text_level_{ESPHOME_LOG_LEVEL_VERY_VERBOSE};
+  bool binary_log_active_{false};
+  bool binary_text_needed_{true};
+  uint8_t text_consumers_{0};
+  bool line_sent_binary_{false};
+#endif
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_ZEPHYR)
   UARTSelection uart_{UART_SELECTION_UART0};
 #endif
@@ -386,11 +458,14 @@ class LoggerMessageTrigger : public Trigger<uint8_t, const char *, const char *>
  public:
   explicit LoggerMessageTrigger(Logger *parent, uint8_t level) {
     this->level_ = level;
-    parent->add_on_log_callback([this](uint8_t level, const char *tag, const char *message, size_t message_len) {
-      if (level <= this->level_) {
-        this->trigger(level, tag, message);
-      }
-    });
+    parent->add_log_listener(
+        [](void *context, uint8_t level, const char *tag, const char *message, size_t message_len) {
+          auto *self = static_cast<LoggerMessageTrigger *>(context);
+          if (level <= self->level_) {
+            self->trigger(level, tag, message);
+          }
+        },
+        this);
   }
 
  protected:
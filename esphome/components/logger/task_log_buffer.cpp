@@ -8,21 +8,20 @@
 namespace esphome::logger {
 
 TaskLogBuffer::TaskLogBuffer(size_t total_buffer_size) {
-  // Store the buffer size
-  this->size_ = total_buffer_size;
+  // Records are aligned, so is the end of the buffer
+  this->size_ = total_buffer_size - total_buffer_size % RECORD_ALIGN;
+  this->pos_limit_ = (UINT32_MAX / this->size_) * this->size_;
   // Allocate memory for the ring buffer using ESPHome's RAM allocator
   RAMAllocator<uint8_t> allocator;
   this->storage_ = allocator.allocate(this->size_);
-  // Create a static ring buffer with RINGBUF_TYPE_NOSPLIT for message integrity
-  this->ring_buffer_ = xRingbufferCreateStatic(this->size_, RINGBUF_TYPE_NOSPLIT, this->storage_, &this->structure_);
+  if (this->storage_ != nullptr) {
+    // Unused space must read as unpublished records
+    std::memset(this->storage_, 0, this->size_);
+  }
 }
 
 TaskLogBuffer::~TaskLogBuffer() {
-  if (this->ring_buffer_ != nullptr) {
-    // Delete the ring buffer
-    vRingbufferDelete(this->ring_buffer_);
-    this->ring_buffer_ = nullptr;
-
+  if (this->storage_ != nullptr) {
     // Free the allocated memory
     RAMAllocator<uint8_t> allocator;
     allocator.deallocate(this->storage_, this->size_);
@@ -30,36 +29,79 @@ TaskLogBuffer::~TaskLogBuffer() {
   }
 }
 
-bool TaskLogBuffer::borrow_message_main_loop(LogMessage **message, const char **text, void **received_token) {
-  if (message == nullptr || text == nullptr || received_token == nullptr) {
-    return false;
+TaskLogBuffer::Record *TaskLogBuffer::claim_(uint32_t total) {
+  uint32_t head = this->head_.load(std::memory_order_relaxed);
+  while (true) {
+    // The consumer clears released space before it moves the tail
+    const uint32_t tail = this->tail_.load(std::memory_order_acquire);
+    const uint32_t offset = head % this->size_;
+    // A record never wraps around, the rest of the buffer is skipped instead
+    const uint32_t skip = this->size_ - offset < total ? this->size_ - offset : 0;
+    const uint32_t used = this->used_(head, tail) + skip + total;
+    if (used > this->size_)
+      return nullptr;
+    if (!this->head_.compare_exchange_weak(head, this->advance_(head, skip + total), std::memory_order_relaxed))
+      continue;  // Another task claimed space first, head has been reloaded
+
+    uint32_t high_water_mark = this->high_water_mark_.load(std::memory_order_relaxed);
+    while (used > high_water_mark &&
+           !this->high_water_mark_.compare_exchange_weak(high_water_mark, used, std::memory_order_relaxed)) {
+    }
+    if (skip != 0) {
+      this->record_at_(head)->size.store(RECORD_SKIP | skip, std::memory_order_release);
+      head = this->advance_(head, skip);
+    }
+    return this->record_at_(head);
   }
+}
 
-  size_t item_size = 0;
-  void *received_item = xRingbufferReceive(ring_buffer_, &item_size, 0);
-  if (received_item == nullptr) {
+bool TaskLogBuffer::borrow_message_main_loop(LogMessage **message, const char **text, void **received_token) {
+  if (message == nullptr || text == nullptr || received_token == nullptr || this->storage_ == nullptr) {
     return false;
   }
 
-  LogMessage *msg = static_cast<LogMessage *>(received_item);
-  *message = msg;
-  *text = msg->text_data();
-  *received_token = received_item;
-
-  return true;
+  const uint32_t head = this->head_.load(std::memory_order_acquire);
+  uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+  while (tail != head) {
+    Record *record = this->record_at_(tail);
+    const uint32_t size = record->size.load(std::memory_order_acquire);
+    if (size == 0) {
+      return false;  // Still being written, later records have to wait for it
+    }
+    if ((size & RECORD_SKIP) != 0) {
+      const uint32_t len = size & ~RECORD_SKIP;
+      std::memset(static_cast<void *>(record), 0, len);
+      tail = this->advance_(tail, len);
+      this->tail_.store(tail, std::memory_order_release);
+      continue;
+    }
+    *message = &record->message;
+    *text = record->message.text_data();
+    *received_token = record;
+    return true;
+  }
+  return false;
 }
 
 void TaskLogBuffer::release_message_main_loop(void *token) {
   if (token == nullptr) {
     return;
   }
-  vRingbufferReturnItem(ring_buffer_, token);
+  // The borrowed record is always the one at the tail
+  auto *record = static_cast<Record *>(token);
+  const uint32_t len = record->size.load(std::memory_order_relaxed);
+  std::memset(static_cast<void *>(record), 0, len);
+  this->tail_.store(this->advance_(this->tail_.load(std::memory_order_relaxed), len), std::memory_order_release);
   // Update counter to mark all messages as processed
   last_processed_counter_ = message_counter_.load(std::memory_order_relaxed);
 }
 
 bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uint16_t line, TaskHandle_t task_handle,
                                              const char *format, va_list args) {
+  if (this->storage_ == nullptr) {
+    return false;
+  }
+
   // First, calculate the exact length needed using a null buffer (no actual writing)
   va_list args_copy;
   va_copy(args_copy, args);
@@ -74,19 +116,18 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
   static constexpr size_t MAX_TEXT_SIZE = 255;
   size_t text_length = (static_cast<size_t>(ret) > MAX_TEXT_SIZE) ? MAX_TEXT_SIZE : ret;
 
-  // Calculate total size needed (header + text length + null terminator)
-  size_t total_size = sizeof(LogMessage) + text_length + 1;
+  // Calculate total size needed (header + text length + null terminator), rounded up to the record alignment
+  size_t total_size = sizeof(Record) + text_length + 1;
+  total_size = (total_size + RECORD_ALIGN - 1) / RECORD_ALIGN * RECORD_ALIGN;
 
-  // Acquire memory directly from the ring buffer
-  void *acquired_memory = nullptr;
-  BaseType_t result = xRingbufferSendAcquire(ring_buffer_, &acquired_memory, total_size, 0);
-
-  if (result != pdTRUE || acquired_memory == nullptr) {
-    return false;  // Failed to acquire memory
+  Record *record = this->claim_(total_size);
+  if (record == nullptr) {
+    this->dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    return false;  // Buffer full
   }
 
-  // Set up the message header in the acquired memory
-  LogMessage *msg = static_cast<LogMessage *>(acquired_memory);
+  // Set up the message header in the claimed memory
+  LogMessage *msg = &record->message;
   msg->level = level;
   msg->tag = tag;
   msg->line = line;
@@ -102,14 +143,14 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
     msg->thread_name[0] = '\0';  // Empty string if no thread name
   }
 
-  // Format the message text directly into the acquired memory
+  // Format the message text directly into the claimed memory
   // We add 1 to text_length to ensure space for null terminator during formatting
   char *text_area = msg->text_data();
   ret = vsnprintf(text_area, text_length + 1, format, args);
 
-  // Handle unexpected formatting error
+  // Handle unexpected formatting error, the space is claimed so it has to be published anyway
   if (ret <= 0) {
-    vRingbufferReturnItem(ring_buffer_, acquired_memory);
+    record->size.store(RECORD_SKIP | total_size, std::memory_order_release);
     return false;
   }
 
@@ -119,12 +160,8 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
   }
 
   msg->text_length = text_length;
-  // Complete the send operation with the acquired memory
-  result = xRingbufferSendComplete(ring_buffer_, acquired_memory);
-
-  if (result != pdTRUE) {
-    return false;  // Failed to complete the message send
-  }
+  // Publish the record, the main loop may process it from now on
+  record->size.store(total_size, std::memory_order_release);
 
   // Message sent successfully, increment the counter
   message_counter_.fetch_add(1, std::memory_order_relaxed);
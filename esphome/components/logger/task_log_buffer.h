@@ -9,10 +9,18 @@
 #include <memory>
 #include <atomic>
 #include <freertos/FreeRTOS.h>
-#include <freertos/ringbuf.h>
+#include <freertos/task.h>
 
 namespace esphome::logger {
 
+/** Ring buffer that carries log messages from other tasks to the main loop.
+ *
+ * Any number of tasks can produce messages at the same time without taking a lock: a producer claims space by
+ * advancing the head with a compare-exchange, formats its message in place and then publishes it by storing
+ * the record size in the record's first word. Only the main loop consumes; it stops at the first record that
+ * is not published yet, so messages are processed in the order their space was claimed. The consumer clears
+ * every record it releases, which guarantees that a claimed but unpublished record always reads as pending.
+ */
 class TaskLogBuffer {
  public:
   // Structure for a log message header (text data follows immediately after)
@@ -50,12 +58,41 @@ class TaskLogBuffer {
 
   // Get the total buffer size in bytes
   inline size_t size() const { return size_; }
+  // Messages that were dropped because the buffer was full
+  uint32_t get_dropped_count() const { return this->dropped_count_.load(std::memory_order_relaxed); }
+  // Largest number of bytes that were in use at the same time
+  size_t get_high_water_mark() const { return this->high_water_mark_.load(std::memory_order_relaxed); }
 
  private:
-  RingbufHandle_t ring_buffer_{nullptr};  // FreeRTOS ring buffer handle
-  StaticRingbuffer_t structure_;          // Static structure for the ring buffer
-  uint8_t *storage_{nullptr};             // Pointer to allocated memory
-  size_t size_{0};                        // Size of allocated memory
+  // Every record starts with this header. size is 0 while the producer is still writing, then the size of the
+  // whole record including padding to the next record. Records flagged as skip carry no message.
+  struct Record {
+    std::atomic<uint32_t> size;
+    LogMessage message;
+  };
+  static constexpr uint32_t RECORD_SKIP = 0x80000000;
+  static constexpr size_t RECORD_ALIGN = alignof(Record);
+
+  // Claim total bytes, returns nullptr if they do not fit
+  Record *claim_(uint32_t total);
+  Record *record_at_(uint32_t pos) const { return reinterpret_cast<Record *>(this->storage_ + pos % this->size_); }
+  uint32_t advance_(uint32_t pos, uint32_t len) const {
+    // Positions wrap at a multiple of size_ so pos % size_ stays continuous
+    return pos >= this->pos_limit_ - len ? pos + len - this->pos_limit_ : pos + len;
+  }
+  uint32_t used_(uint32_t head, uint32_t tail) const {
+    return head >= tail ? head - tail : head + (this->pos_limit_ - tail);
+  }
+
+  uint8_t *storage_{nullptr};  // Pointer to allocated memory
+  size_t size_{0};             // Size of allocated memory
+  uint32_t pos_limit_{0};      // Positions range from 0 to pos_limit_ - 1
+
+  // Producers claim at head_, the main loop consumes at tail_
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_count_{0};
+  std::atomic<uint32_t> high_water_mark_{0};
 
   // Atomic counter for message tracking (only differences matter)
   std::atomic<uint16_t> message_counter_{0};    // Incremented when messages are committed
@@ -4,6 +4,7 @@ from esphome.automation import build_automation, register_action, validate_autom
 import esphome.codegen as cg
 from esphome.components.const import CONF_COLOR_DEPTH, CONF_DRAW_ROUNDING
 from esphome.components.display import Display
+from esphome.components.font import CONF_RUN_LENGTH_ENCODING
 from esphome.components.psram import DOMAIN as PSRAM_DOMAIN
 import esphome.config_validation as cv
 from esphome.const import (
@@ -230,6 +231,14 @@ def final_validation(configs):
                 raise cv.Invalid(
                     "Using RGBA or RGB24 in image config not compatible with LVGL", path
                 )
+        for font_id in helpers.esphome_fonts_used:
+            path = global_config.get_path_for_id(font_id)[:-1]
+            font_conf = global_config.get_config_for_path(path)
+            if font_conf.get(CONF_RUN_LENGTH_ENCODING):
+                raise cv.Invalid(
+                    "Using run_length_encoding in font config not compatible with LVGL",
+                    path,
+                )
         for w in focused_widgets:
             path = global_config.get_path_for_id(w)
             widget_conf = global_config.get_config_for_path(path[:-1])
@@ -336,6 +345,8 @@ async def to_code(configs):
             config[df.CONF_RESUME_ON_INPUT],
         )
         await cg.register_component(lv_component, config)
+        if config.get(df.CONF_FLUSH_TASK):
+            cg.add(lv_component.set_flush_task(True))
         Widget.create(config[CONF_ID], lv_component, LvScrActType(), config)
 
         lv_scr_act = get_scr_act(lv_component)
@@ -422,6 +433,7 @@ LVGL_SCHEMA = cv.All(
                     df.CONF_DEFAULT_FONT, default="montserrat_14"
                 ): lvalid.lv_font,
                 cv.Optional(df.CONF_FULL_REFRESH, default=False): cv.boolean,
+                cv.Optional(df.CONF_FLUSH_TASK): cv.All(cv.boolean, cv.only_on_esp32),
                 cv.Optional(CONF_DRAW_ROUNDING, default=2): cv.positive_int,
                 cv.Optional(CONF_BUFFER_SIZE, default=0): cv.percentage,
                 cv.Optional(CONF_LOG_LEVEL, default="WARN"): cv.one_of(
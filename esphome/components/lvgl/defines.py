@@ -435,6 +435,7 @@ CONF_FLEX_ALIGN_MAIN = "flex_align_main"
 CONF_FLEX_ALIGN_CROSS = "flex_align_cross"
 CONF_FLEX_ALIGN_TRACK = "flex_align_track"
 CONF_FLEX_GROW = "flex_grow"
+CONF_FLUSH_TASK = "flush_task"
 CONF_FREEZE = "freeze"
 CONF_FULL_REFRESH = "full_refresh"
 CONF_GRADIENTS = "gradients"
@@ -93,6 +93,9 @@ void LvglComponent::dump_config() {
                 "  Draw rounding: %d",
                 this->disp_drv_.hor_res, this->disp_drv_.ver_res, 100 / this->buffer_frac_, this->rotation,
                 (int) this->draw_rounding);
+#ifdef USE_ESP32
+  ESP_LOGCONFIG(TAG, "  Flush task: %s", YESNO(this->flush_task_));
+#endif  // USE_ESP32
 }
 void LvglComponent::set_paused(bool paused, bool show_snow) {
   this->paused_ = paused;
@@ -207,6 +210,14 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
 
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
+#ifdef USE_ESP32
+    if (this->flush_task_) {
+      // the task marks the flush ready, LVGL meanwhile renders the next area into the other buffer.
+      FlushRequest request{*area, color_p};
+      xQueueSend(this->flush_queue_, &request, portMAX_DELAY);
+      return;
+    }
+#endif  // USE_ESP32
     auto now = millis();
     this->draw_buffer_(area, color_p);
     ESP_LOGVV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
@@ -460,7 +471,12 @@ void LvglComponent::setup() {
     return;
   }
   this->buffer_frac_ = frac;
-  lv_disp_draw_buf_init(&this->draw_buf_, buffer, nullptr, buffer_pixels);
+  void *buffer2 = nullptr;
+#ifdef USE_ESP32
+  if (this->flush_task_)
+    buffer2 = this->start_flush_task_(buf_bytes);
+#endif  // USE_ESP32
+  lv_disp_draw_buf_init(&this->draw_buf_, buffer, buffer2, buffer_pixels);
   this->disp_drv_.hor_res = width;
   this->disp_drv_.ver_res = height;
   // this->setup_driver_(display->get_width(), display->get_height());
@@ -500,7 +516,8 @@ void LvglComponent::update() {
 }
 void LvglComponent::loop() {
   if (this->paused_) {
-    if (this->show_snow_)
+    // the snow is drawn from the main loop, so must not overlap a flush still running in the flush task.
+    if (this->show_snow_ && !this->draw_buf_.flushing)
       this->write_random_();
   }
   lv_timer_handler_run_in_period(5);
@@ -518,6 +535,49 @@ void lv_animimg_stop(lv_obj_t *obj) {
 void LvglComponent::static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_cb_(disp_drv, area, color_p);
 }
+
+#ifdef USE_ESP32
+void *LvglComponent::start_flush_task_(size_t buf_bytes) {
+  void *buffer = lv_custom_mem_alloc(buf_bytes);  // NOLINT
+  this->flush_queue_ = xQueueCreate(1, sizeof(FlushRequest));
+  this->flush_done_ = xSemaphoreCreateBinary();
+  // Run on the core the main loop is not on, at the same priority
+  BaseType_t core = portNUM_PROCESSORS > 1 && xPortGetCoreID() == 0 ? 1 : 0;
+  if (buffer == nullptr || this->flush_queue_ == nullptr || this->flush_done_ == nullptr ||
+      xTaskCreatePinnedToCore(flush_task, "lvgl_flush", 4096, this, uxTaskPriorityGet(nullptr), nullptr, core) !=
+          pdPASS) {
+    ESP_LOGW(TAG, "Could not start the flush task, flushing from the main loop");
+    lv_custom_mem_free(buffer);
+    if (this->flush_queue_ != nullptr)
+      vQueueDelete(this->flush_queue_);
+    if (this->flush_done_ != nullptr)
+      vSemaphoreDelete(this->flush_done_);
+    this->flush_queue_ = nullptr;
+    this->flush_done_ = nullptr;
+    this->flush_task_ = false;
+    return nullptr;
+  }
+  this->disp_drv_.wait_cb = static_wait_cb;
+  return buffer;
+}
+
+void LvglComponent::flush_task(void *arg) {
+  auto *lv_component = static_cast<LvglComponent *>(arg);
+  FlushRequest request;
+  while (true) {
+    if (xQueueReceive(lv_component->flush_queue_, &request, portMAX_DELAY) != pdTRUE)
+      continue;
+    lv_component->draw_buffer_(&request.area, request.color_p);
+    lv_disp_flush_ready(&lv_component->disp_drv_);
+    xSemaphoreGive(lv_component->flush_done_);
+  }
+}
+
+// Called by LVGL while it waits for a flush to complete, block instead of spinning in the main loop.
+void LvglComponent::static_wait_cb(lv_disp_drv_t *disp_drv) {
+  xSemaphoreTake(reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_done_, 1);
+}
+#endif  // USE_ESP32
 }  // namespace lvgl
 }  // namespace esphome
 
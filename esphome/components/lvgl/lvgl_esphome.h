@@ -25,6 +25,13 @@
 #include <utility>
 #include <vector>
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif  // USE_ESP32
+
 #ifdef USE_LVGL_FONT
 #include "esphome/components/font/font.h"
 #endif  // USE_LVGL_FONT
@@ -181,6 +188,10 @@ class LvglComponent : public PollingComponent {
   // @param show_snow If true, show the snow effect when paused.
   void set_paused(bool paused, bool show_snow);
   bool is_paused() const { return this->paused_; }
+#ifdef USE_ESP32
+  // Send rendered areas to the displays from a task on the other core, while LVGL renders into a second buffer.
+  void set_flush_task(bool flush_task) { this->flush_task_ = flush_task; }
+#endif  // USE_ESP32
   // If the display is paused and we have resume_on_input_ set to true, resume the display.
   void maybe_wakeup() {
     if (this->paused_ && this->resume_on_input_) {
@@ -218,6 +229,16 @@ class LvglComponent : public PollingComponent {
   void write_random_();
   void draw_buffer_(const lv_area_t *area, lv_color_t *ptr);
   void flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+#ifdef USE_ESP32
+  struct FlushRequest {
+    lv_area_t area;
+    lv_color_t *color_p;
+  };
+  static void flush_task(void *arg);
+  static void static_wait_cb(lv_disp_drv_t *disp_drv);
+  // Start the flush task and return the second draw buffer, or nullptr if the main loop has to flush.
+  void *start_flush_task_(size_t buf_bytes);
+#endif  // USE_ESP32
 
   std::vector<display::Display *> displays_{};
   size_t buffer_frac_{1};
@@ -237,6 +258,11 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   CallbackManager<void(bool)> pause_callbacks_{};
   lv_color_t *rotate_buf_{};
+#ifdef USE_ESP32
+  bool flush_task_{};
+  QueueHandle_t flush_queue_{};
+  SemaphoreHandle_t flush_done_{};
+#endif  // USE_ESP32
 };
 
 class IdleTrigger : public Trigger<> {
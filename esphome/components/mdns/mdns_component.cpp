@@ -227,8 +227,6 @@ void MDNSComponent::dump_config() {
 #endif
 }
 
-std::vector<MDNSService> MDNSComponent::get_services() { return this->services_; }
-
 }  // namespace mdns
 }  // namespace esphome
 #endif
@@ -39,7 +39,7 @@ class MDNSComponent : public Component {
   void add_extra_service(MDNSService service) { services_extra_.push_back(std::move(service)); }
 #endif
 
-  std::vector<MDNSService> get_services();
+  const std::vector<MDNSService> &get_services() const { return this->services_; }
 
   void on_shutdown() override;
 
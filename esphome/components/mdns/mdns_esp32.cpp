@@ -2,7 +2,6 @@
 #if defined(USE_ESP32) && defined(USE_MDNS)
 
 #include <mdns.h>
-#include <cstring>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "mdns_component.h"
@@ -26,24 +25,19 @@ void MDNSComponent::setup() {
   mdns_instance_name_set(this->hostname_.c_str());
 
   for (const auto &service : this->services_) {
+    // mdns_service_add() copies the records, so the values only need to live until it returns
+    std::vector<std::string> txt_values;
+    txt_values.reserve(service.txt_records.size());
     std::vector<mdns_txt_item_t> txt_records;
+    txt_records.reserve(service.txt_records.size());
     for (const auto &record : service.txt_records) {
-      mdns_txt_item_t it{};
-      // dup strings to ensure the pointer is valid even after the record loop
-      it.key = strdup(record.key.c_str());
-      it.value = strdup(const_cast<TemplatableValue<std::string> &>(record.value).value().c_str());
-      txt_records.push_back(it);
+      txt_values.push_back(const_cast<TemplatableValue<std::string> &>(record.value).value());
+      txt_records.push_back({record.key.c_str(), txt_values.back().c_str()});
     }
     uint16_t port = const_cast<TemplatableValue<uint16_t> &>(service.port).value();
     err = mdns_service_add(nullptr, service.service_type.c_str(), service.proto.c_str(), port, txt_records.data(),
                            txt_records.size());
 
-    // free records
-    for (const auto &it : txt_records) {
-      delete it.key;    // NOLINT(cppcoreguidelines-owning-memory)
-      delete it.value;  // NOLINT(cppcoreguidelines-owning-memory)
-    }
-
     if (err != ESP_OK) {
       ESP_LOGW(TAG, "Failed to register service %s: %s", service.service_type.c_str(), esp_err_to_name(err));
     }
@@ -36,6 +36,7 @@ DOMAIN = "micro_wake_word"
 
 
 CONF_FEATURE_STEP_SIZE = "feature_step_size"
+CONF_GATE_WAKE_WORDS = "gate_wake_words"
 CONF_MODELS = "models"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
 CONF_PROBABILITY_CUTOFF = "probability_cutoff"
@@ -310,6 +311,7 @@ MODEL_SCHEMA = cv.Schema(
         cv.Optional(CONF_MODEL): MODEL_SOURCE_SCHEMA,
         cv.Optional(CONF_PROBABILITY_CUTOFF): cv.percentage,
         cv.Optional(CONF_SLIDING_WINDOW_SIZE): cv.positive_int,
+        cv.Optional(CONF_TENSOR_ARENA_SIZE): cv.positive_not_null_int,
         cv.Optional(CONF_INTERNAL, default=False): cv.boolean,
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
@@ -323,6 +325,7 @@ VAD_MODEL_SCHEMA = MODEL_SCHEMA.extend(
                 CONF_MODEL,
                 default="vad",
             ): MODEL_SOURCE_SCHEMA,
+            cv.Optional(CONF_GATE_WAKE_WORDS, default=False): cv.boolean,
         }
     )
 )
@@ -459,6 +462,7 @@ async def to_code(config):
 
     if vad_model := config.get(CONF_VAD):
         cg.add_define("USE_MICRO_WAKE_WORD_VAD")
+        cg.add(var.set_gate_wake_words(vad_model[CONF_GATE_WAKE_WORDS]))
 
         # Use the general model loading code for the VAD codegen
         config[CONF_MODELS].append(vad_model)
@@ -481,13 +485,19 @@ async def to_code(config):
             manifest[KEY_MICRO][CONF_SLIDING_WINDOW_SIZE],
         )
 
+        # Manifests size the arena generously; it can be trimmed to the usage that is
+        # logged at the verbose level when the model loads
+        tensor_arena_size = model_parameters.get(
+            CONF_TENSOR_ARENA_SIZE, manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE]
+        )
+
         if manifest[KEY_WAKE_WORD] == "vad":
             cg.add(
                 var.add_vad_model(
                     prog_arr,
                     quantized_probability_cutoff,
                     sliding_window_size,
-                    manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE],
+                    tensor_arena_size,
                 )
             )
         else:
@@ -500,7 +510,7 @@ async def to_code(config):
                 quantized_probability_cutoff,
                 sliding_window_size,
                 manifest[KEY_WAKE_WORD],
-                manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE],
+                tensor_arena_size,
                 default_enabled,
                 model_parameters[CONF_INTERNAL],
             )
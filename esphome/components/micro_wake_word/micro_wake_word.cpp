@@ -23,6 +23,11 @@ static const size_t DATA_TIMEOUT_MS = 50;
 
 static const uint32_t RING_BUFFER_DURATION_MS = 120;
 
+// Features kept for gated wake word models, covers the time the VAD model needs to detect speech
+static const uint32_t FEATURE_HISTORY_DURATION_MS = 500;
+// Stored slices the gated wake word models process per new slice while catching up
+static const size_t MAX_CATCH_UP_SLICES = 3;
+
 static const uint32_t INFERENCE_TASK_STACK_SIZE = 3072;
 static const UBaseType_t INFERENCE_TASK_PRIORITY = 3;
 
@@ -102,22 +107,6 @@ void MicroWakeWord::setup() {
     return;
   }
 
-  this->microphone_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
-    if (this->state_ == State::STOPPED) {
-      return;
-    }
-    std::shared_ptr<RingBuffer> temp_ring_buffer = this->ring_buffer_.lock();
-    if (this->ring_buffer_.use_count() > 1) {
-      size_t bytes_free = temp_ring_buffer->free();
-
-      if (bytes_free < data.size()) {
-        xEventGroupSetBits(this->event_group_, EventGroupBits::WARNING_FULL_RING_BUFFER);
-        temp_ring_buffer->reset();
-      }
-      temp_ring_buffer->write((void *) data.data(), data.size());
-    }
-  });
-
 #ifdef USE_OTA
   ota::get_global_ota_callback()->add_on_state_callback(
       [this](ota::OTAState state, float progress, uint8_t error, ota::OTAComponent *comp) {
@@ -151,15 +140,26 @@ void MicroWakeWord::inference_task(void *params) {
       }
     }
 
+#ifdef USE_MICRO_WAKE_WORD_VAD
+    if (this_mww->gate_wake_words_ && !(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
+      RAMAllocator<int8_t> allocator;
+      this_mww->feature_history_slices_ = FEATURE_HISTORY_DURATION_MS / this_mww->features_step_size_;
+      this_mww->feature_history_start_ = 0;
+      this_mww->feature_history_count_ = 0;
+      this_mww->feature_history_ = allocator.allocate(this_mww->feature_history_slices_ * PREPROCESSOR_FEATURE_SIZE);
+
+      if (this_mww->feature_history_ == nullptr) {
+        xEventGroupSetBits(this_mww->event_group_, EventGroupBits::ERROR_MEMORY);
+      }
+    }
+#endif
+
     if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
-      // Allocate ring buffer
-      std::shared_ptr<RingBuffer> temp_ring_buffer = RingBuffer::create(
-          this_mww->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
-      if (temp_ring_buffer.use_count() == 0) {
+      // Read the microphone's shared buffer of raw audio
+      if (!this_mww->microphone_source_->start_reading(RING_BUFFER_DURATION_MS)) {
         xEventGroupSetBits(this_mww->event_group_, EventGroupBits::ERROR_MEMORY);
       }
-      audio_buffer->set_source(temp_ring_buffer);
-      this_mww->ring_buffer_ = temp_ring_buffer;
+      audio_buffer->set_source(this_mww->microphone_source_);
     }
 
     if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
@@ -168,6 +168,9 @@ void MicroWakeWord::inference_task(void *params) {
 
       while (!(xEventGroupGetBits(this_mww->event_group_) & COMMAND_STOP)) {
         audio_buffer->transfer_data_from_source(pdMS_TO_TICKS(DATA_TIMEOUT_MS));
+        if (this_mww->microphone_source_->get_and_reset_overruns() > 0) {
+          xEventGroupSetBits(this_mww->event_group_, EventGroupBits::WARNING_FULL_RING_BUFFER);
+        }
 
         if (audio_buffer->available() < new_bytes_to_process) {
           // Insufficient data to generate new spectrogram features, read more next iteration
@@ -194,6 +197,14 @@ void MicroWakeWord::inference_task(void *params) {
   xEventGroupSetBits(this_mww->event_group_, EventGroupBits::TASK_STOPPING);
 
   this_mww->unload_models_();
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  if (this_mww->feature_history_ != nullptr) {
+    RAMAllocator<int8_t> allocator;
+    allocator.deallocate(this_mww->feature_history_, this_mww->feature_history_slices_ * PREPROCESSOR_FEATURE_SIZE);
+    this_mww->feature_history_ = nullptr;
+  }
+#endif
+  this_mww->microphone_source_->stop_reading();
   this_mww->microphone_source_->stop();
   FrontendFreeStateContents(&this_mww->frontend_state_);
 
@@ -250,8 +261,8 @@ void MicroWakeWord::loop() {
 
   if (event_group_bits & EventGroupBits::WARNING_FULL_RING_BUFFER) {
     xEventGroupClearBits(this->event_group_, EventGroupBits::WARNING_FULL_RING_BUFFER);
-    ESP_LOGW(TAG, "Not enough free bytes in ring buffer to store incoming audio data. Resetting the ring buffer. Wake "
-                  "word detection accuracy will temporarily be reduced.");
+    ESP_LOGW(TAG, "Audio data was overwritten before it could be processed. Wake word detection accuracy will "
+                  "temporarily be reduced.");
   }
 
   if (event_group_bits & EventGroupBits::TASK_STARTING) {
@@ -450,17 +461,59 @@ void MicroWakeWord::unload_models_() {
 bool MicroWakeWord::update_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
   bool success = true;
 
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  success = success & this->vad_model_->perform_streaming_inference(audio_features);
+
+  if (this->feature_history_ != nullptr) {
+    this->push_feature_history_(audio_features);
+
+    if (!this->vad_model_->determine_detected().detected) {
+      // No speech, so the wake word models wait. A detection would be blocked by the VAD model anyway.
+      return success;
+    }
+
+    // Work through the stored features a few slices at a time, so a long backlog doesn't stall reading the audio
+    for (size_t i = 0; (i < MAX_CATCH_UP_SLICES) && (this->feature_history_count_ > 0); ++i) {
+      success = success & this->update_wake_word_probabilities_(
+                              &this->feature_history_[this->feature_history_start_ * PREPROCESSOR_FEATURE_SIZE]);
+      this->feature_history_start_ = (this->feature_history_start_ + 1) % this->feature_history_slices_;
+      --this->feature_history_count_;
+    }
+
+    return success;
+  }
+#endif
+
+  success = success & this->update_wake_word_probabilities_(audio_features);
+
+  return success;
+}
+
+bool MicroWakeWord::update_wake_word_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
+  bool success = true;
+
   for (auto &model : this->wake_word_models_) {
     // Perform inference
     success = success & model->perform_streaming_inference(audio_features);
   }
-#ifdef USE_MICRO_WAKE_WORD_VAD
-  success = success & this->vad_model_->perform_streaming_inference(audio_features);
-#endif
 
   return success;
 }
 
+#ifdef USE_MICRO_WAKE_WORD_VAD
+void MicroWakeWord::push_feature_history_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
+  const size_t end = (this->feature_history_start_ + this->feature_history_count_) % this->feature_history_slices_;
+  std::memcpy(&this->feature_history_[end * PREPROCESSOR_FEATURE_SIZE], audio_features, PREPROCESSOR_FEATURE_SIZE);
+
+  if (this->feature_history_count_ < this->feature_history_slices_) {
+    ++this->feature_history_count_;
+  } else {
+    // Full, so the oldest slice was overwritten
+    this->feature_history_start_ = (this->feature_history_start_ + 1) % this->feature_history_slices_;
+  }
+}
+#endif
+
 }  // namespace micro_wake_word
 }  // namespace esphome
 
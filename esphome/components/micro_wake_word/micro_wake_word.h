@@ -9,7 +9,6 @@
 
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
-#include "esphome/core/ring_buffer.h"
 
 #include <freertos/event_groups.h>
 
@@ -56,6 +55,10 @@ class MicroWakeWord : public Component {
 
   // Intended for the voice assistant component to fetch VAD status
   bool get_vad_state() { return this->vad_state_; }
+
+  /// @brief If enabled, the wake word models only run while the VAD model detects speech. The features generated
+  /// without speech are kept for a short while, so the wake word models catch up on the start of the speech.
+  void set_gate_wake_words(bool gate_wake_words) { this->gate_wake_words_ = gate_wake_words; }
 #endif
 
   // Intended for the voice assistant component to access which wake words are available
@@ -67,12 +70,18 @@ class MicroWakeWord : public Component {
   Trigger<std::string> *wake_word_detected_trigger_ = new Trigger<std::string>();
   State state_{State::STOPPED};
 
-  std::weak_ptr<RingBuffer> ring_buffer_;
   std::vector<WakeWordModel *> wake_word_models_;
 
 #ifdef USE_MICRO_WAKE_WORD_VAD
   std::unique_ptr<VADModel> vad_model_;
   bool vad_state_{false};
+  bool gate_wake_words_{false};
+
+  // Features waiting for the wake word models while they are gated, oldest at feature_history_start_
+  int8_t *feature_history_{nullptr};
+  size_t feature_history_slices_{0};
+  size_t feature_history_start_{0};
+  size_t feature_history_count_{0};
 #endif
 
   bool pending_start_{false};
@@ -121,6 +130,16 @@ class MicroWakeWord : public Component {
   /// @param audio_features (int8_t *) Buffer containing new spectrogram features
   /// @return True if successful, false if any errors were encountered
   bool update_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]);
+
+  /// @brief Runs an inference with each wake word model
+  /// @param audio_features (int8_t *) Buffer containing spectrogram features
+  /// @return True if successful, false if any errors were encountered
+  bool update_wake_word_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]);
+
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  /// @brief Stores features for the gated wake word models, dropping the oldest ones if the history is full
+  void push_feature_history_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]);
+#endif
 };
 
 }  // namespace micro_wake_word
@@ -26,23 +26,22 @@ void VADModel::log_model_config() {
                 this->probability_cutoff_ / 255.0f, this->sliding_window_size_);
 }
 
-bool StreamingModel::load_model_() {
-  RAMAllocator<uint8_t> arena_allocator;
+size_t StreamingModel::get_arena_block_size_() const {
+  // The variable arena follows the tensor arena, keep it aligned
+  return ((this->tensor_arena_size_ + STREAMING_MODEL_ARENA_ALIGNMENT - 1) & ~(STREAMING_MODEL_ARENA_ALIGNMENT - 1)) +
+         STREAMING_MODEL_VARIABLE_ARENA_SIZE;
+}
 
+bool StreamingModel::load_model_() {
   if (this->tensor_arena_ == nullptr) {
-    this->tensor_arena_ = arena_allocator.allocate(this->tensor_arena_size_);
+    // Allocate both arenas in one block, so enabling and disabling models doesn't fragment the heap
+    RAMAllocator<uint8_t> arena_allocator;
+    this->tensor_arena_ = arena_allocator.allocate(this->get_arena_block_size_());
     if (this->tensor_arena_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arena.");
-      return false;
-    }
-  }
-
-  if (this->var_arena_ == nullptr) {
-    this->var_arena_ = arena_allocator.allocate(STREAMING_MODEL_VARIABLE_ARENA_SIZE);
-    if (this->var_arena_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate the streaming model's variable tensor arena.");
+      ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arenas.");
       return false;
     }
+    this->var_arena_ = this->tensor_arena_ + this->get_arena_block_size_() - STREAMING_MODEL_VARIABLE_ARENA_SIZE;
     this->ma_ = tflite::MicroAllocator::Create(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
     this->mrv_ = tflite::MicroResourceVariables::Create(this->ma_, 20);
   }
@@ -61,6 +60,8 @@ bool StreamingModel::load_model_() {
       ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
       return false;
     }
+    ESP_LOGV(TAG, "Streaming model uses %zu of its %zu byte tensor arena", this->interpreter_->arena_used_bytes(),
+             this->tensor_arena_size_);
 
     // Verify input tensor matches expected values
     // Dimension 3 will represent the first layer stride, so skip it may vary
@@ -96,15 +97,10 @@ bool StreamingModel::load_model_() {
 void StreamingModel::unload_model() {
   this->interpreter_.reset();
 
-  RAMAllocator<uint8_t> arena_allocator;
-
   if (this->tensor_arena_ != nullptr) {
-    arena_allocator.deallocate(this->tensor_arena_, this->tensor_arena_size_);
+    RAMAllocator<uint8_t> arena_allocator;
+    arena_allocator.deallocate(this->tensor_arena_, this->get_arena_block_size_());
     this->tensor_arena_ = nullptr;
-  }
-
-  if (this->var_arena_ != nullptr) {
-    arena_allocator.deallocate(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
     this->var_arena_ = nullptr;
   }
 
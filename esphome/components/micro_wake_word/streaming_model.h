@@ -15,6 +15,7 @@ namespace micro_wake_word {
 
 static const uint8_t MIN_SLICES_BEFORE_DETECTION = 100;
 static const uint32_t STREAMING_MODEL_VARIABLE_ARENA_SIZE = 1024;
+static const size_t STREAMING_MODEL_ARENA_ALIGNMENT = 16;
 
 struct DetectionEvent {
   std::string *wake_word;
@@ -63,6 +64,8 @@ class StreamingModel {
   /// @brief Allocates tensor and variable arenas and sets up the model interpreter
   /// @return True if successful, false otherwise
   bool load_model_();
+  /// @brief Returns the size of the block holding the tensor arena followed by the variable arena
+  size_t get_arena_block_size_() const;
   /// @brief Returns true if successfully registered the streaming model's TensorFlow operations
   bool register_streaming_ops_(tflite::MicroMutableOpResolver<20> &op_resolver);
 
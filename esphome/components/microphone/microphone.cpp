@@ -15,5 +15,37 @@ void Microphone::add_data_callback(std::function<void(const std::vector<uint8_t>
   this->data_callbacks_.add(std::move(mute_handled_callback));
 }
 
+#ifdef USE_ESP32
+Microphone::Microphone() {
+  // Added up front as readers are created from other tasks while the microphone may be calling back
+  this->data_callbacks_.add([this](const std::vector<uint8_t> &data) {
+    // Readers own the buffer, so it is only written while someone reads it
+    std::shared_ptr<SharedRingBuffer> temp_buffer = this->shared_buffer_.lock();
+    if (temp_buffer == nullptr) {
+      return;
+    }
+    if (this->mute_state_) {
+      std::vector<uint8_t> silence(data.size(), 0);
+      temp_buffer->write(silence.data(), silence.size());
+    } else {
+      temp_buffer->write(data.data(), data.size());
+    }
+  });
+}
+
+std::unique_ptr<SharedRingBuffer::Reader> Microphone::create_shared_reader(size_t len) {
+  std::shared_ptr<SharedRingBuffer> buffer = this->shared_buffer_.lock();
+  if (buffer == nullptr) {
+    buffer = SharedRingBuffer::create(len);
+    if (buffer == nullptr) {
+      return nullptr;
+    }
+    this->shared_buffer_ = buffer;
+  }
+
+  return buffer->create_reader();
+}
+#endif
+
 }  // namespace microphone
 }  // namespace esphome
@@ -8,6 +8,10 @@
 #include <vector>
 #include "esphome/core/helpers.h"
 
+#ifdef USE_ESP32
+#include "esphome/core/ring_buffer.h"
+#endif
+
 namespace esphome {
 namespace microphone {
 
@@ -20,6 +24,10 @@ enum State : uint8_t {
 
 class Microphone {
  public:
+#ifdef USE_ESP32
+  Microphone();
+#endif
+
   virtual void start() = 0;
   virtual void stop() = 0;
   void add_data_callback(std::function<void(const std::vector<uint8_t> &)> &&data_callback);
@@ -32,6 +40,14 @@ class Microphone {
 
   audio::AudioStreamInfo get_audio_stream_info() { return this->audio_stream_info_; }
 
+#ifdef USE_ESP32
+  /// @brief Adds a reader of the raw audio that all readers share, instead of every reader receiving its own copy
+  /// through a callback. The shared buffer is allocated with the first reader and freed with the last one.
+  /// @param len Minimum size of the shared buffer in bytes if it has to be allocated
+  /// @return unique_ptr to the reader, nullptr if allocation failed
+  std::unique_ptr<SharedRingBuffer::Reader> create_shared_reader(size_t len);
+#endif
+
  protected:
   State state_{STATE_STOPPED};
   bool mute_state_{false};
@@ -39,6 +55,10 @@ class Microphone {
   audio::AudioStreamInfo audio_stream_info_;
 
   CallbackManager<void(const std::vector<uint8_t> &)> data_callbacks_{};
+
+#ifdef USE_ESP32
+  std::weak_ptr<SharedRingBuffer> shared_buffer_;
+#endif
 };
 
 }  // namespace microphone
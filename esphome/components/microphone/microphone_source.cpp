@@ -17,7 +17,9 @@ void MicrophoneSource::add_data_callback(std::function<void(const std::vector<ui
 
           // Take temporary ownership of samples vector to avoid deallaction before the callback finishes
           std::shared_ptr<std::vector<uint8_t>> output_samples = this->processed_samples_;
-          this->process_audio_(data, *output_samples);
+          const uint32_t total_frames = this->mic_->get_audio_stream_info().bytes_to_frames(data.size());
+          output_samples->resize(this->get_audio_stream_info().frames_to_bytes(total_frames));
+          this->process_audio_(data.data(), total_frames, output_samples->data());
           data_callback(*output_samples);
         }
       };
@@ -44,7 +46,55 @@ void MicrophoneSource::stop() {
   }
 }
 
-void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vector<uint8_t> &filtered_data) {
+#ifdef USE_ESP32
+bool MicrophoneSource::start_reading(uint32_t duration_ms) {
+  if (this->reader_ == nullptr) {
+    this->reader_ = this->mic_->create_shared_reader(this->mic_->get_audio_stream_info().ms_to_bytes(duration_ms));
+  }
+  return this->reader_ != nullptr;
+}
+
+size_t MicrophoneSource::read(uint8_t *data, size_t len, TickType_t ticks_to_wait) {
+  if (this->reader_ == nullptr) {
+    return 0;
+  }
+
+  const audio::AudioStreamInfo source_info = this->mic_->get_audio_stream_info();
+  const size_t raw_len = source_info.frames_to_bytes(this->get_audio_stream_info().bytes_to_frames(len));
+  if (this->raw_samples_.size() < raw_len) {
+    this->raw_samples_.resize(raw_len);
+  }
+
+  // The microphone writes and this reads whole frames, so what is read always ends on a frame boundary
+  const size_t bytes_read = this->reader_->read(this->raw_samples_.data(), raw_len, ticks_to_wait);
+  const uint32_t total_frames = source_info.bytes_to_frames(bytes_read);
+  this->process_audio_(this->raw_samples_.data(), total_frames, data);
+  return this->get_audio_stream_info().frames_to_bytes(total_frames);
+}
+
+size_t MicrophoneSource::available() const {
+  if (this->reader_ == nullptr) {
+    return 0;
+  }
+  const uint32_t frames = this->mic_->get_audio_stream_info().bytes_to_frames(this->reader_->available());
+  return frames * ((this->bits_per_sample_ + 7) / 8) * this->channels_.count();
+}
+
+void MicrophoneSource::reset_reading() {
+  if (this->reader_ != nullptr) {
+    this->reader_->reset();
+  }
+}
+
+uint32_t MicrophoneSource::get_and_reset_overruns() {
+  if (this->reader_ == nullptr) {
+    return 0;
+  }
+  return this->reader_->get_and_reset_overruns();
+}
+#endif
+
+void MicrophoneSource::process_audio_(const uint8_t *data, uint32_t total_frames, uint8_t *filtered_data) {
   // - Bit depth conversions are obtained by truncating bits or padding with zeros - no dithering is applied.
   // - In the comments, Qxx refers to a fixed point number with xx bits of precision for representing fractional values.
   //   For example, audio with a bit depth of 16 can store a sample in a int16, which can be considered a Q15 number.
@@ -58,13 +108,9 @@ void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vec
 
   const size_t source_bytes_per_frame = this->mic_->get_audio_stream_info().frames_to_bytes(1);
 
-  const uint32_t total_frames = this->mic_->get_audio_stream_info().bytes_to_frames(data.size());
   const size_t target_bytes_per_sample = (this->bits_per_sample_ + 7) / 8;
-  const size_t target_bytes_per_frame = target_bytes_per_sample * this->channels_.count();
-
-  filtered_data.resize(target_bytes_per_frame * total_frames);
 
-  uint8_t *current_data = filtered_data.data();
+  uint8_t *current_data = filtered_data;
 
   for (uint32_t frame_index = 0; frame_index < total_frames; ++frame_index) {
     for (uint32_t channel_index = 0; channel_index < source_channels; ++channel_index) {
@@ -8,8 +8,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#endif
+
 namespace esphome {
 namespace microphone {
 
@@ -32,6 +37,10 @@ class MicrophoneSource {
    *   - It tracks an internal enabled state, so it ignores raw microphone data when the component requesting
    *     microphone data is not actively requesting audio.
    *
+   * Instead of a callback, components can also read the audio when they need it with ``start_reading`` and ``read``.
+   * All readers of a microphone share a single buffer of raw audio and each one only converts what it reads, so adding
+   * a reader does not add another copy of the audio or more work in the microphone's task.
+   *
    * Note that this class cannot convert sample rates!
    */
  public:
@@ -63,11 +72,44 @@ class MicrophoneSource {
   bool is_running() const { return (this->mic_->is_running() && (this->enabled_ || this->passive_)); }
   bool is_stopped() const { return !this->is_running(); };
 
+#ifdef USE_ESP32
+  /// @brief Starts buffering the microphone's raw audio for ``read``.
+  /// @param duration_ms Amount of audio the shared buffer holds at least if it has to be allocated
+  /// @return True if the reader was added, false if allocation failed
+  bool start_reading(uint32_t duration_ms);
+
+  /// @brief Stops buffering audio for ``read``, the shared buffer is freed once no source reads it anymore.
+  void stop_reading() { this->reader_.reset(); }
+
+  /// @brief Reads and processes buffered audio, waiting up to a specified number of ticks if none is available.
+  /// @param data Pointer to copy processed audio into
+  /// @param len Maximum number of processed bytes to read, only whole frames are read
+  /// @param ticks_to_wait Maximum number of FreeRTOS ticks to wait (default: 0)
+  /// @return Number of processed bytes read
+  size_t read(uint8_t *data, size_t len, TickType_t ticks_to_wait = 0);
+
+  /// @brief Returns the number of processed bytes that can be read without waiting.
+  size_t available() const;
+
+  /// @brief Discards all buffered audio.
+  void reset_reading();
+
+  /// @brief Returns how often buffered audio was overwritten before it was read since the last call.
+  uint32_t get_and_reset_overruns();
+#endif
+
  protected:
-  void process_audio_(const std::vector<uint8_t> &data, std::vector<uint8_t> &filtered_data);
+  /// @brief Converts ``total_frames`` frames of raw microphone audio into ``filtered_data``, which must have space for
+  /// them in the requested format.
+  void process_audio_(const uint8_t *data, uint32_t total_frames, uint8_t *filtered_data);
 
   std::shared_ptr<std::vector<uint8_t>> processed_samples_;
 
+#ifdef USE_ESP32
+  std::unique_ptr<SharedRingBuffer::Reader> reader_;
+  std::vector<uint8_t> raw_samples_;
+#endif
+
   Microphone *mic_;
   uint8_t bits_per_sample_;
   std::bitset<8> channels_;
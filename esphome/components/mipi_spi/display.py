@@ -55,7 +55,7 @@ from esphome.core import CORE
 from esphome.cpp_generator import TemplateArguments
 from esphome.final_validate import full_config
 
-from . import CONF_BUS_MODE, CONF_SPI_16, DOMAIN, models
+from . import CONF_BUS_MODE, CONF_DOUBLE_BUFFER, CONF_SPI_16, DOMAIN, models
 
 DEPENDENCIES = ["spi"]
 
@@ -174,6 +174,8 @@ def model_schema(config):
     ]
     if bus_mode == TYPE_SINGLE:
         other_options.append(CONF_SPI_16)
+        # Band N+1 is drawn while band N is sent by queued DMA transfers
+        other_options.append(CONF_DOUBLE_BUFFER)
     schema = (
         display.FULL_DISPLAY_SCHEMA.extend(
             spi.spi_device_schema(
@@ -416,6 +418,8 @@ async def to_code(config):
             config[CONF_ROTATION] = 0
     cg.add(var.set_model(config[CONF_MODEL]))
     cg.add(var.set_draw_rounding(config[CONF_DRAW_ROUNDING]))
+    if config.get(CONF_DOUBLE_BUFFER) and requires_buffer(config):
+        cg.add(var.set_double_buffer(True))
     if enable_pin := config.get(CONF_ENABLE_PIN):
         enable = [await cg.gpio_pin_expression(pin) for pin in enable_pin]
         cg.add(var.set_enable_pins(enable))
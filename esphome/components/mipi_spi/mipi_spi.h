@@ -366,7 +366,7 @@ class MipiSpi : public display::Display,
     ptr += y_offset * (x_offset + w + x_pad) + x_offset;
     if constexpr (BUFFERPIXEL == DISPLAYPIXEL) {
       this->write_display_data_(reinterpret_cast<const uint8_t *>(ptr), w * sizeof(BUFFERTYPE), h,
-                                x_pad * sizeof(BUFFERTYPE));
+                                (x_offset + x_pad) * sizeof(BUFFERTYPE));
     } else {
       // type conversion required, do it in chunks
       uint8_t dbuffer[DISPLAYPIXEL * 48];
@@ -452,6 +452,8 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
  public:
   MipiSpiBuffer() { this->rotation_ = ROTATION; }
 
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+
   void dump_config() override {
     MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DISPLAYPIXEL, BUS_TYPE, WIDTH, HEIGHT, OFFSET_WIDTH,
             OFFSET_HEIGHT>::dump_config();
@@ -460,9 +462,10 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
                     "  Buffer pixels: %d bits\n"
                     "  Buffer fraction: 1/%d\n"
                     "  Buffer bytes: %zu\n"
+                    "  Double buffered: %s\n"
                     "  Draw rounding: %u",
                     this->rotation_, BUFFERPIXEL * 8, FRACTION, sizeof(BUFFERTYPE) * WIDTH * HEIGHT / FRACTION,
-                    this->draw_rounding_);
+                    YESNO(this->back_buffer_ != nullptr), this->draw_rounding_);
   }
 
   void setup() override {
@@ -472,6 +475,14 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     this->buffer_ = allocator.allocate(WIDTH * HEIGHT / FRACTION);
     if (this->buffer_ == nullptr) {
       this->mark_failed("Buffer allocation failed");
+      return;
+    }
+    if constexpr (CAN_QUEUE) {
+      if (this->double_buffer_) {
+        this->back_buffer_ = allocator.allocate(WIDTH * HEIGHT / FRACTION);
+        if (this->back_buffer_ == nullptr)
+          esph_log_w(TAG, "Back buffer allocation failed, drawing single buffered");
+      }
     }
   }
 
@@ -504,7 +515,7 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       lap = millis();
 #endif
       if (this->x_low_ > this->x_high_ || this->y_low_ > this->y_high_)
-        return;
+        continue;
       esph_log_v(TAG, "x_low %d, y_low %d, x_high %d, y_high %d", this->x_low_, this->y_low_, this->x_high_,
                  this->y_high_);
       // Some chips require that the drawing window be aligned on certain boundaries
@@ -515,8 +526,15 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       this->y_high_ = (this->y_high_ + dr) / dr * dr - 1;
       int w = this->x_high_ - this->x_low_ + 1;
       int h = this->y_high_ - this->y_low_ + 1;
-      this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_,
-                              this->y_low_ - this->start_line_, WIDTH - w);
+      if (this->back_buffer_ != nullptr) {
+        // wait for the previous band, then draw the next one into the buffer it used while this one is sent.
+        this->end_queued_write_();
+        this->queue_to_display_(w, h);
+        std::swap(this->buffer_, this->back_buffer_);
+      } else {
+        this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_,
+                                this->y_low_ - this->start_line_, WIDTH - w - this->x_low_);
+      }
       // invalidate watermarks
       this->x_low_ = WIDTH;
       this->y_low_ = HEIGHT;
@@ -527,6 +545,7 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       lap = millis();
 #endif
     }
+    this->end_queued_write_();
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
     esph_log_v(TAG, "Total update took %dms", millis() - now);
 #endif
@@ -592,6 +611,41 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     }
   }
 
+  // Queue the dirty window for writing. The transaction stays open until end_queued_write_() is called.
+  void queue_to_display_(int w, int h) {
+    this->set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    this->enable();
+    const BUFFERTYPE *ptr = this->buffer_ + (this->y_low_ - this->start_line_) * WIDTH + this->x_low_;
+    if (w == WIDTH) {
+      this->queue_display_data_(reinterpret_cast<const uint8_t *>(ptr), w * h * sizeof(BUFFERTYPE));
+    } else {
+      for (int y = 0; y != h; y++) {
+        this->queue_display_data_(reinterpret_cast<const uint8_t *>(ptr), w * sizeof(BUFFERTYPE));
+        ptr += WIDTH;
+      }
+    }
+    this->write_pending_ = true;
+  }
+
+  // Queue a run of pixel data using the bus width of the display.
+  void queue_display_data_(const uint8_t *ptr, size_t length) {
+    if constexpr (BUS_TYPE == BUS_TYPE_SINGLE || BUS_TYPE == BUS_TYPE_SINGLE_16) {
+      this->write_array_queued(ptr, length);
+    } else if constexpr (BUS_TYPE == BUS_TYPE_QUAD) {
+      this->write_cmd_addr_data_queued(8, 0x32, 24, WDATA << 8, ptr, length, 4);
+    } else if constexpr (BUS_TYPE == BUS_TYPE_OCTAL) {
+      this->write_cmd_addr_data_queued(0, 0, 0, 0, ptr, length, 8);
+    }
+  }
+
+  // Wait for the queued write to complete and release the bus.
+  void end_queued_write_() {
+    if (this->write_pending_) {
+      this->disable();
+      this->write_pending_ = false;
+    }
+  }
+
   // Convert a color to the buffer pixel format.
   BUFFERTYPE convert_color_(Color &color) const {
     if constexpr (BUFFERPIXEL == PIXEL_MODE_8) {
@@ -606,7 +660,14 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     return static_cast<BUFFERTYPE>(0);
   }
 
+  // Queued writes send the buffer as is, so are only used when no pixel conversion is needed.
+  static constexpr bool CAN_QUEUE = BUFFERPIXEL == DISPLAYPIXEL && FRACTION > 1;
+
   BUFFERTYPE *buffer_{};
+  // The buffer that was last queued for writing, only allocated when double buffered.
+  BUFFERTYPE *back_buffer_{};
+  bool double_buffer_{};
+  bool write_pending_{};
   uint16_t x_low_{WIDTH};
   uint16_t y_low_{HEIGHT};
   uint16_t x_high_{0};
@@ -19,6 +19,9 @@ static const uint32_t TASK_DELAY_MS = 25;
 
 static const size_t TASK_STACK_SIZE = 4096;
 
+static const uint32_t REFERENCE_SAMPLE_RATE = 16000;
+static const size_t REFERENCE_CHUNK_SAMPLES = 64;
+
 static const int16_t MAX_AUDIO_SAMPLE_VALUE = INT16_MAX;
 static const int16_t MIN_AUDIO_SAMPLE_VALUE = INT16_MIN;
 
@@ -307,6 +310,12 @@ void MixerSpeaker::setup() {
     this->mark_failed();
     return;
   }
+
+  this->output_speaker_->add_audio_output_callback([this](uint32_t new_frames, int64_t write_timestamp) {
+    if (this->reference_buffer_ != nullptr) {
+      this->forward_reference_(new_frames);
+    }
+  });
 }
 
 void MixerSpeaker::loop() {
@@ -419,6 +428,87 @@ esp_err_t MixerSpeaker::delete_task_() {
 
 void MixerSpeaker::stop() { xEventGroupSetBits(this->event_group_, MixerEventGroupBits::COMMAND_STOP); }
 
+std::unique_ptr<SharedRingBuffer::Reader> MixerSpeaker::create_reference_reader(size_t len) {
+  if (this->reference_buffer_ == nullptr) {
+    this->reference_pending_ = RingBuffer::create(len);
+    std::shared_ptr<SharedRingBuffer> reference_buffer = SharedRingBuffer::create(len);
+    if ((this->reference_pending_ == nullptr) || (reference_buffer == nullptr)) {
+      this->reference_pending_.reset();
+      return nullptr;
+    }
+    this->reference_buffer_ = reference_buffer;
+  }
+
+  return this->reference_buffer_->create_reader();
+}
+
+void MixerSpeaker::queue_reference_(const int16_t *samples, uint32_t frames) {
+  const audio::AudioStreamInfo stream_info = this->audio_stream_info_.value();
+  const uint32_t sample_rate = stream_info.get_sample_rate();
+  uint8_t decimation = 0;
+  if ((sample_rate % REFERENCE_SAMPLE_RATE) == 0) {
+    decimation = sample_rate / REFERENCE_SAMPLE_RATE;
+  }
+
+  if (decimation != this->reference_decimation_) {
+    // The output stream changed, don't carry a partial sample over
+    this->reference_decimation_ = decimation;
+    this->reference_sum_ = 0;
+    this->reference_frames_summed_ = 0;
+  }
+  if (decimation == 0) {
+    return;
+  }
+
+  const uint8_t channels = stream_info.get_channels();
+  const int32_t divisor = decimation * channels;
+
+  int16_t chunk[REFERENCE_CHUNK_SAMPLES];
+  size_t chunk_samples = 0;
+  for (uint32_t frame = 0; frame < frames; ++frame) {
+    for (uint8_t channel = 0; channel < channels; ++channel) {
+      this->reference_sum_ += *samples++;
+    }
+
+    // Averaging the frames is a crude low pass filter, but the echo that matters is in the speech band anyway
+    if (++this->reference_frames_summed_ == decimation) {
+      chunk[chunk_samples++] = static_cast<int16_t>(this->reference_sum_ / divisor);
+      this->reference_sum_ = 0;
+      this->reference_frames_summed_ = 0;
+
+      if (chunk_samples == REFERENCE_CHUNK_SAMPLES) {
+        this->reference_pending_->write(chunk, sizeof(chunk));
+        chunk_samples = 0;
+      }
+    }
+  }
+
+  if (chunk_samples > 0) {
+    this->reference_pending_->write(chunk, chunk_samples * sizeof(int16_t));
+  }
+}
+
+void MixerSpeaker::forward_reference_(uint32_t new_frames) {
+  const uint8_t decimation = this->reference_decimation_;
+  if (decimation == 0) {
+    return;
+  }
+
+  this->reference_played_frames_ += new_frames;
+  size_t bytes_to_forward = (this->reference_played_frames_ / decimation) * sizeof(int16_t);
+  this->reference_played_frames_ %= decimation;
+
+  int16_t chunk[REFERENCE_CHUNK_SAMPLES];
+  while (bytes_to_forward > 0) {
+    const size_t bytes_read = this->reference_pending_->read(chunk, std::min(bytes_to_forward, sizeof(chunk)));
+    if (bytes_read == 0) {
+      break;
+    }
+    this->reference_buffer_->write(chunk, bytes_read);
+    bytes_to_forward -= bytes_read;
+  }
+}
+
 void MixerSpeaker::copy_frames(const int16_t *input_buffer, audio::AudioStreamInfo input_stream_info,
                                int16_t *output_buffer, audio::AudioStreamInfo output_stream_info,
                                uint32_t frames_to_transfer) {
@@ -450,6 +540,12 @@ void MixerSpeaker::mix_audio_samples(const int16_t *primary_buffer, audio::Audio
   const uint8_t secondary_channels = secondary_stream_info.get_channels();
   const uint8_t output_channels = output_stream_info.get_channels();
 
+  if ((primary_channels == output_channels) && (secondary_channels == output_channels)) {
+    // Channels line up, so the frames can be mixed as one flat run of samples
+    audio::add_audio_samples(primary_buffer, secondary_buffer, output_buffer, frames_to_mix * output_channels);
+    return;
+  }
+
   const uint8_t max_primary_channel_index = primary_channels - 1;
   const uint8_t max_secondary_channel_index = secondary_channels - 1;
 
@@ -501,7 +597,11 @@ void MixerSpeaker::audio_mixer_task(void *params) {
     }
 
     // Never shift the data in the output transfer buffer to avoid unnecessary, slow data moves
-    output_transfer_buffer->transfer_data_to_sink(pdMS_TO_TICKS(TASK_DELAY_MS), false);
+    const int16_t *output_start = reinterpret_cast<const int16_t *>(output_transfer_buffer->get_buffer_start());
+    const size_t bytes_written = output_transfer_buffer->transfer_data_to_sink(pdMS_TO_TICKS(TASK_DELAY_MS), false);
+    if ((bytes_written > 0) && (this_mixer->reference_buffer_ != nullptr)) {
+      this_mixer->queue_reference_(output_start, this_mixer->audio_stream_info_.value().bytes_to_frames(bytes_written));
+    }
 
     const uint32_t output_frames_free =
         this_mixer->audio_stream_info_.value().bytes_to_frames(output_transfer_buffer->free());
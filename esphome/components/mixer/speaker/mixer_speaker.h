@@ -7,10 +7,14 @@
 #include "esphome/components/speaker/speaker.h"
 
 #include "esphome/core/component.h"
+#include "esphome/core/ring_buffer.h"
 
 #include <freertos/event_groups.h>
 #include <freertos/FreeRTOS.h>
 
+#include <atomic>
+#include <memory>
+
 namespace esphome {
 namespace mixer_speaker {
 
@@ -32,6 +36,11 @@ namespace mixer_speaker {
  *        sent to the output speaker.
  *      - In non-queue mode, MixerSpeaker adds all the audio data in each SourceSpeaker into one stream that is written
  *        to the output speaker.
+ *  - Reference Audio:
+ *      - Components like echo cancellers can read the played audio as 16 kHz mono samples through
+ *        ``create_reference_reader``.
+ *      - Audio handed to the output speaker is downmixed and decimated into a pending buffer. It only moves to the
+ *        readers once the output speaker reports it played, so the reference does not run ahead of the sound.
  */
 
 class MixerSpeaker;
@@ -143,6 +152,13 @@ class MixerSpeaker : public Component {
 
   speaker::Speaker *get_output_speaker() const { return this->output_speaker_; }
 
+  /// @brief Adds a reader of the audio the output speaker played, as 16 bit mono samples at 16 kHz. Reference audio is
+  /// only produced while the output sample rate is a multiple of 16 kHz. Must be called before the mixer task starts,
+  /// usually in the reading component's ``setup``.
+  /// @param len Size of the reference buffers in bytes, only used by the first call
+  /// @return unique_ptr to the reader, nullptr if allocation failed or there are too many readers
+  std::unique_ptr<SharedRingBuffer::Reader> create_reference_reader(size_t len);
+
  protected:
   /// @brief Copies audio frames from the input buffer to the output buffer taking into account the number of channels
   /// in each stream. If the output stream has more channels, the input samples are duplicated. If the output stream has
@@ -173,6 +189,15 @@ class MixerSpeaker : public Component {
 
   static void audio_mixer_task(void *params);
 
+  /// @brief Downmixes and decimates audio handed to the output speaker into the pending reference buffer.
+  /// @param samples (const int16_t *) buffer of the audio frames in the current output stream format
+  /// @param frames number of frames in ``samples``
+  void queue_reference_(const int16_t *samples, uint32_t frames);
+
+  /// @brief Moves the reference audio of frames the output speaker just played to the reference readers.
+  /// @param new_frames number of frames played in the output stream format
+  void forward_reference_(uint32_t new_frames);
+
   /// @brief Starts the mixer task after allocating memory for the task stack.
   /// @return ESP_ERR_NO_MEM if there isn't enough memory for the task's stack
   ///         ESP_ERR_INVALID_STATE if the task didn't start
@@ -199,6 +224,14 @@ class MixerSpeaker : public Component {
   StackType_t *task_stack_buffer_{nullptr};
 
   optional<audio::AudioStreamInfo> audio_stream_info_;
+
+  std::shared_ptr<SharedRingBuffer> reference_buffer_;
+  std::unique_ptr<RingBuffer> reference_pending_;
+  // Output frames per reference sample, 0 if the output sample rate is not a multiple of the reference rate
+  std::atomic<uint8_t> reference_decimation_{0};
+  int32_t reference_sum_{0};
+  uint8_t reference_frames_summed_{0};
+  uint32_t reference_played_frames_{0};
 };
 
 }  // namespace mixer_speaker
@@ -10,10 +10,9 @@ from esphome.const import CONF_ADDRESS, CONF_DISABLE_CRC, CONF_FLOW_CONTROL_PIN,
 from esphome.cpp_helpers import gpio_pin_expression
 import esphome.final_validate as fv
 
-DEPENDENCIES = ["uart"]
-
 modbus_ns = cg.esphome_ns.namespace("modbus")
-Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
+ModbusBus = modbus_ns.class_("ModbusBus", cg.Component)
+Modbus = modbus_ns.class_("Modbus", ModbusBus, uart.UARTDevice)
 ModbusDevice = modbus_ns.class_("ModbusDevice")
 MULTI_CONF = True
 
@@ -46,6 +45,7 @@ CONFIG_SCHEMA = (
 
 async def to_code(config):
     cg.add_global(modbus_ns.using)
+    cg.add_define("USE_MODBUS_RTU")
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
@@ -62,7 +62,7 @@ async def to_code(config):
 
 def modbus_device_schema(default_address):
     schema = {
-        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(Modbus),
+        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(ModbusBus),
     }
     if default_address is None:
         schema[cv.Required(CONF_ADDRESS)] = cv.hex_uint8_t
@@ -8,6 +8,78 @@ namespace modbus {
 
 static const char *const TAG = "modbus";
 
+bool ModbusBus::encode_frame_(std::vector<uint8_t> &frame, uint8_t address, uint8_t function_code,
+                              uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len,
+                              const uint8_t *payload) {
+  static const size_t MAX_VALUES = 128;
+
+  // Only check max number of registers for standard function codes
+  // Some devices use non standard codes like 0x43
+  if (number_of_entities > MAX_VALUES && function_code <= 0x10) {
+    ESP_LOGE(TAG, "send too many values %d max=%zu", number_of_entities, MAX_VALUES);
+    return false;
+  }
+
+  frame.push_back(address);
+  frame.push_back(function_code);
+  if (this->role == ModbusRole::CLIENT) {
+    frame.push_back(start_address >> 8);
+    frame.push_back(start_address >> 0);
+    if (function_code != 0x5 && function_code != 0x6) {
+      frame.push_back(number_of_entities >> 8);
+      frame.push_back(number_of_entities >> 0);
+    }
+  }
+
+  if (payload != nullptr) {
+    if (this->role == ModbusRole::SERVER || function_code == 0xF || function_code == 0x10) {  // Write multiple
+      frame.push_back(payload_len);  // Byte count is required for write
+    } else {
+      payload_len = 2;  // Write single register or coil
+    }
+    for (int i = 0; i < payload_len; i++) {
+      frame.push_back(payload[i]);
+    }
+  }
+  return true;
+}
+
+bool ModbusBus::dispatch_frame_(uint8_t address, uint8_t function_code, const std::vector<uint8_t> &data,
+                                bool expecting_response) {
+  bool found = false;
+  for (auto *device : this->devices_) {
+    if (device->address_ == address) {
+      found = true;
+      // Is it an error response?
+      if ((function_code & 0x80) == 0x80) {
+        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, data[0]);
+        if (expecting_response) {
+          device->on_modbus_error(function_code & 0x7F, data[0]);
+        } else {
+          // Ignore modbus exception not related to a pending command
+          ESP_LOGD(TAG, "Ignoring Modbus error - not expecting a response");
+        }
+        continue;
+      }
+      if (this->role == ModbusRole::SERVER) {
+        if (function_code == 0x3 || function_code == 0x4) {
+          device->on_modbus_read_registers(function_code, uint16_t(data[1]) | (uint16_t(data[0]) << 8),
+                                           uint16_t(data[3]) | (uint16_t(data[2]) << 8));
+          continue;
+        }
+        if (function_code == 0x6 || function_code == 0x10) {
+          device->on_modbus_write_registers(function_code, data);
+          continue;
+        }
+      }
+      // fallthrough for other function codes
+      device->on_modbus_data(data);
+    }
+  }
+  return found;
+}
+
+#ifdef USE_MODBUS_RTU
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
@@ -138,36 +210,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
     }
   }
   std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
-  bool found = false;
-  for (auto *device : this->devices_) {
-    if (device->address_ == address) {
-      found = true;
-      // Is it an error response?
-      if ((function_code & 0x80) == 0x80) {
-        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
-        if (waiting_for_response != 0) {
-          device->on_modbus_error(function_code & 0x7F, raw[2]);
-        } else {
-          // Ignore modbus exception not related to a pending command
-          ESP_LOGD(TAG, "Ignoring Modbus error - not expecting a response");
-        }
-        continue;
-      }
-      if (this->role == ModbusRole::SERVER) {
-        if (function_code == 0x3 || function_code == 0x4) {
-          device->on_modbus_read_registers(function_code, uint16_t(data[1]) | (uint16_t(data[0]) << 8),
-                                           uint16_t(data[3]) | (uint16_t(data[2]) << 8));
-          continue;
-        }
-        if (function_code == 0x6 || function_code == 0x10) {
-          device->on_modbus_write_registers(function_code, data);
-          continue;
-        }
-      }
-      // fallthrough for other function codes
-      device->on_modbus_data(data);
-    }
-  }
+  bool found = this->dispatch_frame_(address, function_code, data, waiting_for_response != 0);
   waiting_for_response = 0;
 
   if (!found) {
@@ -195,37 +238,9 @@ float Modbus::get_setup_priority() const {
 
 void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
                   uint8_t payload_len, const uint8_t *payload) {
-  static const size_t MAX_VALUES = 128;
-
-  // Only check max number of registers for standard function codes
-  // Some devices use non standard codes like 0x43
-  if (number_of_entities > MAX_VALUES && function_code <= 0x10) {
-    ESP_LOGE(TAG, "send too many values %d max=%zu", number_of_entities, MAX_VALUES);
-    return;
-  }
-
   std::vector<uint8_t> data;
-  data.push_back(address);
-  data.push_back(function_code);
-  if (this->role == ModbusRole::CLIENT) {
-    data.push_back(start_address >> 8);
-    data.push_back(start_address >> 0);
-    if (function_code != 0x5 && function_code != 0x6) {
-      data.push_back(number_of_entities >> 8);
-      data.push_back(number_of_entities >> 0);
-    }
-  }
-
-  if (payload != nullptr) {
-    if (this->role == ModbusRole::SERVER || function_code == 0xF || function_code == 0x10) {  // Write multiple
-      data.push_back(payload_len);  // Byte count is required for write
-    } else {
-      payload_len = 2;  // Write single register or coil
-    }
-    for (int i = 0; i < payload_len; i++) {
-      data.push_back(payload[i]);
-    }
-  }
+  if (!this->encode_frame_(data, address, function_code, start_address, number_of_entities, payload_len, payload))
+    return;
 
   auto crc = crc16(data.data(), data.size());
   data.push_back(crc >> 0);
@@ -265,6 +280,7 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
   ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
   last_send_ = millis();
 }
+#endif  // USE_MODBUS_RTU
 
 }  // namespace modbus
 }  // namespace esphome
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#ifdef USE_MODBUS_RTU
 #include "esphome/components/uart/uart.h"
+#endif
 
 #include <vector>
 
@@ -15,7 +18,38 @@ enum ModbusRole {
 
 class ModbusDevice;
 
-class Modbus : public uart::UARTDevice, public Component {
+/// Connection to one or more modbus devices, implemented by the serial (RTU) and the TCP transports.
+class ModbusBus : public Component {
+ public:
+  void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
+
+  virtual void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                    uint8_t payload_len = 0, const uint8_t *payload = nullptr) = 0;
+  /// Send raw command. Except checksum or header everything must be contained in payload, starting with the address.
+  virtual void send_raw(const std::vector<uint8_t> &payload) = 0;
+  /// Returns true if no request may be sent to the device with the address until a response was received.
+  virtual bool is_waiting_for_response(uint8_t address) const { return this->waiting_for_response != 0; }
+  void set_role(ModbusRole role) { this->role = role; }
+  uint8_t waiting_for_response{0};
+
+  ModbusRole role;
+
+ protected:
+  /// Appends address, function code and data of a request or response to frame.
+  /// @return false if the command can't be sent
+  bool encode_frame_(std::vector<uint8_t> &frame, uint8_t address, uint8_t function_code, uint16_t start_address,
+                     uint16_t number_of_entities, uint8_t payload_len, const uint8_t *payload);
+  /// Passes a received frame to the devices with the address.
+  /// @param expecting_response if a request was sent that this can be the response to, errors are ignored otherwise
+  /// @return false if no device has the address
+  bool dispatch_frame_(uint8_t address, uint8_t function_code, const std::vector<uint8_t> &data,
+                       bool expecting_response);
+
+  std::vector<ModbusDevice *> devices_;
+};
+
+#ifdef USE_MODBUS_RTU
+class Modbus : public uart::UARTDevice, public ModbusBus {
  public:
   Modbus() = default;
 
@@ -25,21 +59,15 @@ class Modbus : public uart::UARTDevice, public Component {
 
   void dump_config() override;
 
-  void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
-
   float get_setup_priority() const override;
 
   void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
-            uint8_t payload_len = 0, const uint8_t *payload = nullptr);
-  void send_raw(const std::vector<uint8_t> &payload);
-  void set_role(ModbusRole role) { this->role = role; }
+            uint8_t payload_len = 0, const uint8_t *payload = nullptr) override;
+  void send_raw(const std::vector<uint8_t> &payload) override;
   void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
-  uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
   void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
 
-  ModbusRole role;
-
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
@@ -49,12 +77,12 @@ class Modbus : public uart::UARTDevice, public Component {
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
-  std::vector<ModbusDevice *> devices_;
 };
+#endif  // USE_MODBUS_RTU
 
 class ModbusDevice {
  public:
-  void set_parent(Modbus *parent) { parent_ = parent; }
+  void set_parent(ModbusBus *parent) { parent_ = parent; }
   void set_address(uint8_t address) { address_ = address; }
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
   virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
@@ -74,12 +102,12 @@ class ModbusDevice {
     this->send_raw(error_response);
   }
   // If more than one device is connected block sending a new command before a response is received
-  bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  bool waiting_for_response() { return parent_->is_waiting_for_response(this->address_); }
 
  protected:
-  friend Modbus;
+  friend ModbusBus;
 
-  Modbus *parent_;
+  ModbusBus *parent_;
   uint8_t address_;
 };
 
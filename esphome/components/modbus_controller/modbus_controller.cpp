@@ -22,7 +22,14 @@ bool ModbusController::send_next_command_() {
     auto &command = this->command_queue_.front();
 
     // remove from queue if command was sent too often
-    if (!command->should_retry(this->max_cmd_retries_)) {
+    // An offline device gets a single attempt per command, retries would only keep the bus from other devices
+    if (!command->should_retry(this->module_offline_ ? 0 : this->max_cmd_retries_)) {
+      ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
+               this->address_, command->register_address);
+      auto function_code = command->function_code;
+      auto register_address = command->register_address;
+      this->command_queue_.pop_front();
+
       if (!this->module_offline_) {
         ESP_LOGW(TAG, "Modbus device=%d set offline", this->address_);
 
@@ -33,12 +40,13 @@ bool ModbusController::send_next_command_() {
           }
         }
 
+        // Drop the pending reads, each of them would time out as well. They are queued again with the next update.
+        this->command_queue_.remove_if(
+            [](const FixedBlockPool<ModbusCommandItem, 8>::Ptr &item) { return !item->is_write(); });
+
         this->module_offline_ = true;
-        this->offline_callback_.call((int) command->function_code, command->register_address);
+        this->offline_callback_.call((int) function_code, register_address);
       }
-      ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
-               this->address_, command->register_address);
-      this->command_queue_.pop_front();
     } else {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
@@ -272,7 +280,18 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
       }
     }
   }
-  this->command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  if (command.is_write()) {
+    // Writes go ahead of the pending reads, so a change is not delayed by a whole poll cycle. The command waiting for
+    // its response has to stay in front.
+    auto it = this->command_queue_.begin();
+    if (it != this->command_queue_.end() && (*it)->is_sent())
+      it++;
+    while (it != this->command_queue_.end() && (*it)->is_write())
+      it++;
+    this->command_queue_.insert(it, this->command_pool_.make(command));
+    return;
+  }
+  this->command_queue_.push_back(this->command_pool_.make(command));
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -319,6 +338,13 @@ void ModbusController::update() {
   }
 }
 
+// check if a range with register_count registers can be read with a single command
+static bool range_fits(ModbusRegisterType register_type, uint16_t register_count) {
+  if (register_type == ModbusRegisterType::COIL || register_type == ModbusRegisterType::DISCRETE_INPUT)
+    return register_count <= UINT8_MAX;
+  return register_count * 2 <= ModbusCommandItem::MAX_PAYLOAD_BYTES;
+}
+
 // walk through the sensors and determine the register ranges to read
 size_t ModbusController::create_register_ranges_() {
   this->register_ranges_.clear();
@@ -370,7 +396,8 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
+        } else if (curr->start_address == (r.start_address + r.register_count) &&
+                   range_fits(r.register_type, r.register_count + curr->register_count)) {
           // this register can extend the current range
 
           // remove this sensore because start_address is changed (sort-order)
@@ -387,6 +414,29 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (this->max_register_gap_ > 0 && curr->start_address > (r.start_address + r.register_count) &&
+                   curr->start_address - (r.start_address + r.register_count) <= this->max_register_gap_ &&
+                   (r.register_type == ModbusRegisterType::HOLDING || r.register_type == ModbusRegisterType::READ) &&
+                   curr->skip_updates == r.skip_updates && curr->response_bytes == 0 && prev->response_bytes == 0 &&
+                   range_fits(r.register_type, curr->start_address - r.start_address + curr->register_count)) {
+          // reading the unused registers in between is faster than a separate command for this register
+          uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+
+          // remove this sensore because start_address is changed (sort-order)
+          ix = this->sensorset_.erase(ix);
+
+          curr->start_address = r.start_address;
+          buffer_offset += gap * 2;
+          curr->offset += buffer_offset;
+          buffer_offset += curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+
+          this->sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Extend range over %u unused registers - change to register: 0x%X %d offset=%u", gap,
+                   curr->start_address, curr->register_count, curr->offset);
         }
       }
     }
@@ -431,8 +481,9 @@ void ModbusController::dump_config() {
                 "ModbusController:\n"
                 "  Address: 0x%02X\n"
                 "  Max Command Retries: %d\n"
-                "  Offline Skip Updates: %d",
-                this->address_, this->max_cmd_retries_, this->offline_skip_updates_);
+                "  Offline Skip Updates: %d\n"
+                "  Max Register Gap: %u",
+                this->address_, this->max_cmd_retries_, this->offline_skip_updates_, this->max_register_gap_);
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : this->sensorset_) {
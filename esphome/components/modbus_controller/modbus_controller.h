@@ -4,6 +4,7 @@
 
 #include "esphome/components/modbus/modbus.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/fixed_block_pool.h"
 
 #include <list>
 #include <queue>
@@ -375,6 +376,15 @@ class ModbusCommandItem {
   bool send();
   /// Check if the command should be retried based on the max_retries parameter
   bool should_retry(uint8_t max_retries) { return this->send_count_ <= max_retries; };
+  /// Check if the command was sent at least once and may be waiting for its response
+  bool is_sent() const { return this->send_count_ > 0; }
+  /// Check if the command changes coils or registers on the device
+  bool is_write() const {
+    return this->function_code == ModbusFunctionCode::WRITE_SINGLE_COIL ||
+           this->function_code == ModbusFunctionCode::WRITE_SINGLE_REGISTER ||
+           this->function_code == ModbusFunctionCode::WRITE_MULTIPLE_COILS ||
+           this->function_code == ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS;
+  }
 
   /// factory methods
   /** Create modbus read command
@@ -530,6 +540,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_max_cmd_retries(uint8_t max_cmd_retries) { this->max_cmd_retries_ = max_cmd_retries; }
   /// get how many times a command will be (re)sent if no response is received
   uint8_t get_max_cmd_retries() { return this->max_cmd_retries_; }
+  /// called by esphome generated code to set how many unused registers a range may span to avoid another command
+  void set_max_register_gap(uint8_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
 
  protected:
   /// parse sensormap_ and create range of sequential addresses
@@ -550,10 +562,12 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   std::vector<ServerRegister *> server_registers_{};
   /// Continuous range of modbus registers
   std::vector<RegisterRange> register_ranges_{};
+  /// Recycles the memory of queued commands, a poll cycle queues the same number of commands every time
+  FixedBlockPool<ModbusCommandItem, 8> command_pool_;
   /// Hold the pending requests to be sent
-  std::list<std::unique_ptr<ModbusCommandItem>> command_queue_;
+  std::list<FixedBlockPool<ModbusCommandItem, 8>::Ptr> command_queue_;
   /// modbus response data waiting to get processed
-  std::queue<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
+  std::queue<FixedBlockPool<ModbusCommandItem, 8>::Ptr> incoming_queue_;
   /// if duplicate commands can be sent
   bool allow_duplicate_commands_{false};
   /// when was the last send operation
@@ -566,6 +580,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint16_t offline_skip_updates_{0};
   /// How many times we will retry a command if we get no response
   uint8_t max_cmd_retries_{4};
+  /// How many unused registers are read to combine two ranges into one command
+  uint8_t max_register_gap_{0};
   /// Command sent callback
   CallbackManager<void(int, int)> command_sent_callback_{};
   /// Server online callback
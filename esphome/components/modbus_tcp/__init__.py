@@ -0,0 +1,69 @@
+import esphome.codegen as cg
+from esphome.components import modbus
+from esphome.components.modbus import CONF_ROLE
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ADDRESS,
+    CONF_ID,
+    CONF_PORT,
+    CONF_TIMEOUT,
+    PLATFORM_BK72XX,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
+    PLATFORM_LN882X,
+    PLATFORM_RTL87XX,
+)
+import esphome.final_validate as fv
+
+AUTO_LOAD = ["modbus", "socket"]
+DEPENDENCIES = ["network"]
+MULTI_CONF = True
+
+modbus_tcp_ns = cg.esphome_ns.namespace("modbus_tcp")
+ModbusTcp = modbus_tcp_ns.class_("ModbusTcp", modbus.ModbusBus)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ModbusTcp),
+            cv.Required(CONF_ADDRESS): cv.ipaddress,
+            cv.Optional(CONF_PORT, default=502): cv.port,
+            cv.Optional(
+                CONF_TIMEOUT, default="1s"
+            ): cv.positive_time_period_milliseconds,
+            # Only requests are sent, devices can't be served over TCP
+            cv.Optional(CONF_ROLE, default="client"): cv.one_of("client", lower=True),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_on(
+        [
+            PLATFORM_ESP32,
+            PLATFORM_HOST,
+            PLATFORM_BK72XX,
+            PLATFORM_LN882X,
+            PLATFORM_RTL87XX,
+        ]
+    ),
+)
+
+
+def _final_validate(config):
+    socket_config = fv.full_config.get().get("socket", {})
+    if socket_config.get("implementation") == "lwip_tcp":
+        raise cv.Invalid(
+            "Modbus TCP needs a socket implementation that can open connections"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_role(modbus.MODBUS_ROLES[config[CONF_ROLE]]))
+    cg.add(var.set_host(str(config[CONF_ADDRESS])))
+    cg.add(var.set_port(config[CONF_PORT]))
+    cg.add(var.set_timeout(config[CONF_TIMEOUT]))
@@ -0,0 +1,259 @@
+#include "modbus_tcp.h"
+
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+
+#include "esphome/components/network/util.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+
+namespace esphome {
+namespace modbus_tcp {
+
+static const char *const TAG = "modbus_tcp";
+
+// Transaction id, protocol id, length and unit id
+static const size_t MBAP_HEADER_SIZE = 7;
+// Unit id and the largest PDU
+static const uint16_t MAX_FRAME_LENGTH = 254;
+static const uint32_t RECONNECT_INTERVAL = 5000;
+// Limits how many requests to different unit ids are outstanding at the same time
+static const size_t MAX_TRANSACTIONS = 8;
+
+void ModbusTcp::setup() { this->last_connect_attempt_ = millis() - RECONNECT_INTERVAL; }
+
+void ModbusTcp::loop() {
+  const uint32_t now = App.get_loop_component_start_time();
+
+  // Requests without response free their unit id after the timeout, so the device can try again
+  this->transactions_.erase(std::remove_if(this->transactions_.begin(), this->transactions_.end(),
+                                           [this, now](const Transaction &transaction) {
+                                             if (now - transaction.sent <= this->timeout_)
+                                               return false;
+                                             ESP_LOGV(TAG, "No response to transaction %u from unit %u",
+                                                      transaction.id, transaction.unit);
+                                             return true;
+                                           }),
+                            this->transactions_.end());
+
+  if (this->socket_ == nullptr) {
+    if (now - this->last_connect_attempt_ >= RECONNECT_INTERVAL && network::is_connected())
+      this->connect_();
+    return;
+  }
+
+  if (!this->connected_) {
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error != 0) {
+      ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, error);
+      this->disconnect_();
+      return;
+    }
+    struct sockaddr_storage peer;
+    socklen_t peer_len = sizeof(peer);
+    if (this->socket_->getpeername((struct sockaddr *) &peer, &peer_len) != 0) {
+      if (now - this->connect_started_ > this->timeout_) {
+        ESP_LOGW(TAG, "Connecting to %s:%u timed out", this->host_.c_str(), this->port_);
+        this->disconnect_();
+      }
+      return;
+    }
+    ESP_LOGD(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+    this->connected_ = true;
+  }
+
+  this->read_();
+}
+
+void ModbusTcp::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Modbus TCP:\n"
+                "  Host: %s\n"
+                "  Port: %u\n"
+                "  Timeout: %" PRIu32 " ms\n"
+                "  Connected: %s",
+                this->host_.c_str(), this->port_, this->timeout_, YESNO(this->connected_));
+}
+
+void ModbusTcp::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                     uint8_t payload_len, const uint8_t *payload) {
+  std::vector<uint8_t> frame(MBAP_HEADER_SIZE - 1);
+  if (!this->encode_frame_(frame, address, function_code, start_address, number_of_entities, payload_len, payload))
+    return;
+  this->send_frame_(frame);
+}
+
+void ModbusTcp::send_raw(const std::vector<uint8_t> &payload) {
+  if (payload.empty()) {
+    return;
+  }
+  std::vector<uint8_t> frame(MBAP_HEADER_SIZE - 1);
+  frame.insert(frame.end(), payload.begin(), payload.end());
+  this->send_frame_(frame);
+}
+
+bool ModbusTcp::is_waiting_for_response(uint8_t address) const {
+  if (this->transactions_.size() >= MAX_TRANSACTIONS)
+    return true;
+  return std::any_of(this->transactions_.begin(), this->transactions_.end(),
+                     [address](const Transaction &transaction) { return transaction.unit == address; });
+}
+
+void ModbusTcp::connect_() {
+  this->last_connect_attempt_ = millis();
+
+  struct sockaddr_storage server;
+  socklen_t server_len = socket::set_sockaddr((struct sockaddr *) &server, sizeof(server), this->host_, this->port_);
+  if (server_len == 0) {
+    ESP_LOGW(TAG, "Invalid address %s: errno %d", this->host_.c_str(), errno);
+    return;
+  }
+
+  this->socket_ = socket::socket(server.ss_family, SOCK_STREAM, 0);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket: errno %d", errno);
+    return;
+  }
+  if (this->socket_->setblocking(false) != 0) {
+    ESP_LOGW(TAG, "Could not set non-blocking mode: errno %d", errno);
+    this->disconnect_();
+    return;
+  }
+  // Requests are small and the device waits for all of them
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+
+  if (this->socket_->connect((struct sockaddr *) &server, server_len) != 0 && errno != EINPROGRESS) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->disconnect_();
+    return;
+  }
+  this->connect_started_ = millis();
+}
+
+void ModbusTcp::disconnect_() {
+  if (this->socket_ != nullptr) {
+    this->socket_->close();
+    this->socket_ = nullptr;
+  }
+  this->connected_ = false;
+  this->rx_buffer_.clear();
+  // Pending transactions are kept, they time out so the devices can try again
+}
+
+void ModbusTcp::send_frame_(std::vector<uint8_t> &frame) {
+  const uint16_t transaction_id = this->next_transaction_id_++;
+  const uint16_t length = frame.size() - (MBAP_HEADER_SIZE - 1);
+  frame[0] = transaction_id >> 8;
+  frame[1] = transaction_id >> 0;
+  frame[2] = 0;  // protocol id
+  frame[3] = 0;
+  frame[4] = length >> 8;
+  frame[5] = length >> 0;
+
+  // Also tracked while disconnected, so the request times out and the device notices that it is offline
+  this->transactions_.push_back({transaction_id, frame[MBAP_HEADER_SIZE - 1], millis()});
+
+  if (!this->connected_) {
+    ESP_LOGV(TAG, "Not connected, dropping request to unit %u", frame[MBAP_HEADER_SIZE - 1]);
+    return;
+  }
+
+  ssize_t written = this->socket_->write(frame.data(), frame.size());
+  if (written != static_cast<ssize_t>(frame.size())) {
+    ESP_LOGW(TAG, "Sending request failed: errno %d", errno);
+    this->disconnect_();
+    return;
+  }
+  ESP_LOGV(TAG, "Modbus TCP write: %s", format_hex_pretty(frame).c_str());
+}
+
+void ModbusTcp::read_() {
+  uint8_t buffer[128];
+  while (true) {
+    ssize_t len = this->socket_->read(buffer, sizeof(buffer));
+    if (len > 0) {
+      this->rx_buffer_.insert(this->rx_buffer_.end(), buffer, buffer + len);
+      continue;
+    }
+    if (len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      break;
+    if (len == 0) {
+      ESP_LOGW(TAG, "Connection closed by %s", this->host_.c_str());
+    } else {
+      ESP_LOGW(TAG, "Reading failed: errno %d", errno);
+    }
+    this->disconnect_();
+    return;
+  }
+
+  size_t position = 0;
+  while (this->rx_buffer_.size() - position >= MBAP_HEADER_SIZE) {
+    const uint8_t *raw = &this->rx_buffer_[position];
+    const uint16_t length = encode_uint16(raw[4], raw[5]);
+    if (raw[2] != 0 || raw[3] != 0 || length < 2 || length > MAX_FRAME_LENGTH) {
+      ESP_LOGW(TAG, "Invalid frame header, reconnecting");
+      this->disconnect_();
+      return;
+    }
+    const size_t frame_size = MBAP_HEADER_SIZE - 1 + length;
+    if (this->rx_buffer_.size() - position < frame_size)
+      break;
+
+    this->handle_frame_(encode_uint16(raw[0], raw[1]), raw[MBAP_HEADER_SIZE - 1], raw + MBAP_HEADER_SIZE, length - 1);
+    if (this->socket_ == nullptr) {
+      // A device sent a request from its callback and the connection was lost
+      return;
+    }
+    position += frame_size;
+  }
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + position);
+}
+
+void ModbusTcp::handle_frame_(uint16_t transaction_id, uint8_t unit, const uint8_t *pdu, size_t pdu_len) {
+  auto transaction = std::find_if(this->transactions_.begin(), this->transactions_.end(),
+                                  [transaction_id](const Transaction &t) { return t.id == transaction_id; });
+  if (transaction == this->transactions_.end()) {
+    // Most likely a late response to a request that already timed out and was sent again
+    ESP_LOGD(TAG, "Ignoring response to unknown transaction %u from unit %u", transaction_id, unit);
+    return;
+  }
+  this->transactions_.erase(transaction);
+
+  // Pass the same data to the devices as the serial transport does
+  const uint8_t function_code = pdu[0];
+  size_t data_offset = 2;
+  size_t data_len = pdu_len > 1 ? pdu[1] : 0;
+  if ((function_code & 0x80) == 0x80) {
+    // Exception code
+    data_offset = 1;
+    data_len = 1;
+  } else if ((function_code >= 65 && function_code <= 72) || (function_code >= 100 && function_code <= 110)) {
+    // User-defined function, the whole PDU
+    data_offset = 0;
+    data_len = pdu_len;
+  } else if (function_code == 0x5 || function_code == 0x6 || function_code == 0xF || function_code == 0x10) {
+    // Write responses mirror address and value or count of the request
+    data_offset = 1;
+    data_len = 4;
+  }
+  if (data_offset + data_len > pdu_len) {
+    ESP_LOGW(TAG, "Response from unit %u is too short", unit);
+    return;
+  }
+
+  std::vector<uint8_t> data(pdu + data_offset, pdu + data_offset + data_len);
+  if (!this->dispatch_frame_(unit, function_code, data, true)) {
+    ESP_LOGW(TAG, "Got Modbus frame from unknown unit 0x%02X", unit);
+  }
+}
+
+}  // namespace modbus_tcp
+}  // namespace esphome
+
+#endif
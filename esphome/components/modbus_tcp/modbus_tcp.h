@@ -0,0 +1,73 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+
+#include "esphome/components/modbus/modbus.h"
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/component.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace modbus_tcp {
+
+/** Reaches modbus devices through a Modbus TCP server, like a gateway or a device with an ethernet port.
+ *
+ * The connection stays open between requests and is opened again when it is lost. Every request gets its own
+ * transaction id, so requests to different unit ids are outstanding at the same time and each response is matched to
+ * its request. Requests to the same unit id wait for the previous response like on a serial bus, which is what the
+ * devices on top of it expect.
+ */
+class ModbusTcp : public modbus::ModbusBus {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+            uint8_t payload_len = 0, const uint8_t *payload = nullptr) override;
+  void send_raw(const std::vector<uint8_t> &payload) override;
+  bool is_waiting_for_response(uint8_t address) const override;
+
+  void set_host(const std::string &host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+  void set_timeout(uint32_t timeout) { this->timeout_ = timeout; }
+
+ protected:
+  struct Transaction {
+    uint16_t id;
+    uint8_t unit;
+    uint32_t sent;
+  };
+
+  void connect_();
+  void disconnect_();
+  /// Completes the header of a frame that starts with MBAP_HEADER_SIZE - 1 reserved bytes and sends it.
+  void send_frame_(std::vector<uint8_t> &frame);
+  /// Reads from the connection and handles all complete frames.
+  void read_();
+  void handle_frame_(uint16_t transaction_id, uint8_t unit, const uint8_t *pdu, size_t pdu_len);
+
+  std::string host_;
+  uint16_t port_{502};
+  uint32_t timeout_{1000};
+
+  std::unique_ptr<socket::Socket> socket_;
+  bool connected_{false};
+  uint32_t connect_started_{0};
+  uint32_t last_connect_attempt_{0};
+
+  std::vector<uint8_t> rx_buffer_;
+  std::vector<Transaction> transactions_;
+  uint16_t next_transaction_id_{0};
+};
+
+}  // namespace modbus_tcp
+}  // namespace esphome
+
+#endif
@@ -28,6 +28,9 @@ from esphome.const import (
     CONF_KEEPALIVE,
     CONF_LEVEL,
     CONF_LOG_TOPIC,
+    CONF_MAX_STATE_INTERVAL,
+    CONF_MIN_STATE_DELTA,
+    CONF_MIN_STATE_INTERVAL,
     CONF_ON_CONNECT,
     CONF_ON_DISCONNECT,
     CONF_ON_JSON_MESSAGE,
@@ -69,6 +72,7 @@ def AUTO_LOAD():
 
 
 CONF_DISCOVER_IP = "discover_ip"
+CONF_DISCOVERY_CACHE = "discovery_cache"
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_WAIT_FOR_CONNECTION = "wait_for_connection"
 
@@ -241,6 +245,7 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_DISCOVERY_RETAIN, default=True): cv.boolean,
             cv.Optional(CONF_DISCOVER_IP, default=True): cv.boolean,
+            cv.Optional(CONF_DISCOVERY_CACHE, default=False): cv.boolean,
             cv.Optional(
                 CONF_DISCOVERY_PREFIX, default="homeassistant"
             ): cv.publish_topic,
@@ -271,6 +276,9 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MIN_STATE_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MIN_STATE_DELTA): cv.positive_float,
+            cv.Optional(CONF_MAX_STATE_INTERVAL): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_ON_CONNECT): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(MQTTConnectTrigger),
@@ -306,6 +314,7 @@ CONFIG_SCHEMA = cv.All(
     ),
     validate_config,
     cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_BK72XX]),
+    logger.request_log_listener,
 )
 
 
@@ -376,6 +385,9 @@ async def to_code(config):
             )
         )
 
+    if config[CONF_DISCOVERY_CACHE]:
+        cg.add_define("USE_MQTT_DISCOVERY_CACHE")
+
     cg.add(var.set_topic_prefix(config[CONF_TOPIC_PREFIX], CORE.name))
 
     if config[CONF_USE_ABBREVIATIONS]:
@@ -417,6 +429,14 @@ async def to_code(config):
     cg.add(var.set_keep_alive(config[CONF_KEEPALIVE]))
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    if CONF_MIN_STATE_INTERVAL in config:
+        cg.add(var.set_min_state_interval(config[CONF_MIN_STATE_INTERVAL]))
+    if CONF_MIN_STATE_DELTA in config:
+        cg.add(
+            var.set_min_state_delta(
+                config[CONF_MIN_STATE_DELTA], config.get(CONF_MAX_STATE_INTERVAL, 0)
+            )
+        )
 
     # esp-idf only
     if CONF_CERTIFICATE_AUTHORITY in config:
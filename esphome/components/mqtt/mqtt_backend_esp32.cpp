@@ -103,7 +103,8 @@ void MQTTBackendESP32::loop() {
   if ((now - this->last_dropped_log_time_) >= DROP_LOG_INTERVAL_MS) {
     uint16_t dropped = this->mqtt_queue_.get_and_reset_dropped_count();
     if (dropped > 0) {
-      ESP_LOGW(TAG, "Dropped %u messages (%us)", dropped, DROP_LOG_INTERVAL_MS / 1000);
+      ESP_LOGW(TAG, "Dropped %u messages (%us), backlog peak %u", dropped, DROP_LOG_INTERVAL_MS / 1000,
+               this->queue_backlog_peak_);
     }
     this->last_dropped_log_time_ = now;
   }
@@ -196,36 +197,39 @@ void MQTTBackendESP32::mqtt_event_handler(void *handler_args, esp_event_base_t b
 #if defined(USE_MQTT_IDF_ENQUEUE)
 void MQTTBackendESP32::esphome_mqtt_task(void *params) {
   MQTTBackendESP32 *this_mqtt = (MQTTBackendESP32 *) params;
+  struct QueueElement *batch[MQTT_QUEUE_LENGTH];
 
   while (true) {
     // Wait for notification indefinitely
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-    // Process all queued items
-    struct QueueElement *elem;
-    while ((elem = this_mqtt->mqtt_queue_.pop()) != nullptr) {
-      if (this_mqtt->is_connected_) {
-        switch (elem->type) {
-          case MQTT_QUEUE_TYPE_SUBSCRIBE:
-            esp_mqtt_client_subscribe(this_mqtt->handler_.get(), elem->topic, elem->qos);
-            break;
-
-          case MQTT_QUEUE_TYPE_UNSUBSCRIBE:
-            esp_mqtt_client_unsubscribe(this_mqtt->handler_.get(), elem->topic);
-            break;
-
-          case MQTT_QUEUE_TYPE_PUBLISH:
-            esp_mqtt_client_publish(this_mqtt->handler_.get(), elem->topic, elem->payload, elem->payload_len, elem->qos,
-                                    elem->retain);
-            break;
-
-          default:
-            ESP_LOGE(TAG, "Invalid operation type from MQTT queue");
-            break;
+    // Take everything that queued up since the last wake-up at once. The publishes then go out back to back, which
+    // lets the TCP stack combine the small writes into fewer segments, and retained state that is already outdated
+    // can be dropped before it is sent.
+    size_t count;
+    do {
+      count = 0;
+      struct QueueElement *elem;
+      while (count < MQTT_QUEUE_LENGTH && (elem = this_mqtt->mqtt_queue_.pop()) != nullptr)
+        batch[count++] = elem;
+      this_mqtt->drop_superseded_(batch, count);
+
+      uint8_t burst = 0;
+      for (size_t i = 0; i < count; i++) {
+        elem = batch[i];
+        if (elem == nullptr)
+          continue;
+        bool is_publish = elem->type == MQTT_QUEUE_TYPE_PUBLISH;
+        if (this_mqtt->is_connected_)
+          this_mqtt->send_element_(elem);
+        this_mqtt->mqtt_event_pool_.release(elem);
+        // Release before pausing so the main loop can queue new messages in the meantime
+        if (is_publish && ++burst == PUBLISH_BURST) {
+          burst = 0;
+          vTaskDelay(pdMS_TO_TICKS(PUBLISH_BURST_DELAY_MS));
         }
       }
-      this_mqtt->mqtt_event_pool_.release(elem);
-    }
+    } while (count != 0);
   }
 
   // Clean up any remaining items in the queue
@@ -239,6 +243,45 @@ void MQTTBackendESP32::esphome_mqtt_task(void *params) {
   vTaskDelete(nullptr);
 }
 
+void MQTTBackendESP32::drop_superseded_(QueueElement **batch, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    QueueElement *elem = batch[i];
+    if (elem->type != MQTT_QUEUE_TYPE_PUBLISH || !elem->retain)
+      continue;
+    for (size_t j = i + 1; j < count; j++) {
+      const QueueElement *later = batch[j];
+      if (later->type == MQTT_QUEUE_TYPE_PUBLISH && later->retain && strcmp(later->topic, elem->topic) == 0) {
+        this->mqtt_event_pool_.release(elem);
+        batch[i] = nullptr;
+        this->queue_superseded_count_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+    }
+  }
+}
+
+void MQTTBackendESP32::send_element_(const QueueElement *elem) {
+  switch (elem->type) {
+    case MQTT_QUEUE_TYPE_SUBSCRIBE:
+      esp_mqtt_client_subscribe(this->handler_.get(), elem->topic, elem->qos);
+      break;
+
+    case MQTT_QUEUE_TYPE_UNSUBSCRIBE:
+      esp_mqtt_client_unsubscribe(this->handler_.get(), elem->topic);
+      break;
+
+    case MQTT_QUEUE_TYPE_PUBLISH:
+      esp_mqtt_client_publish(this->handler_.get(), elem->topic, elem->payload, elem->payload_len, elem->qos,
+                              elem->retain);
+      this->queue_sent_count_.fetch_add(1, std::memory_order_relaxed);
+      break;
+
+    default:
+      ESP_LOGE(TAG, "Invalid operation type from MQTT queue");
+      break;
+  }
+}
+
 bool MQTTBackendESP32::enqueue_(MqttQueueTypeT type, const char *topic, int qos, bool retain, const char *payload,
                                 size_t len) {
   auto *elem = this->mqtt_event_pool_.allocate();
@@ -269,6 +312,9 @@ bool MQTTBackendESP32::enqueue_(MqttQueueTypeT type, const char *topic, int qos,
 
   // Push to queue - always succeeds since we allocated from the pool
   this->mqtt_queue_.push(elem);
+  uint8_t backlog = this->mqtt_queue_.size();
+  if (backlog > this->queue_backlog_peak_)
+    this->queue_backlog_peak_ = backlog;
   return true;
 }
 #endif  // USE_MQTT_IDF_ENQUEUE
@@ -4,6 +4,7 @@
 #ifdef USE_MQTT
 #ifdef USE_ESP32
 
+#include <atomic>
 #include <string>
 #include <queue>
 #include <cstring>
@@ -120,6 +121,9 @@ class MQTTBackendESP32 final : public MQTTBackend {
   static const size_t TASK_STACK_SIZE_TLS = 4096;  // Larger stack for TLS operations
   static const ssize_t TASK_PRIORITY = 5;
   static const uint8_t MQTT_QUEUE_LENGTH = 30;  // 30*12 bytes = 360
+  // The MQTT task pauses after this many publishes so a discovery burst doesn't monopolize the socket
+  static const uint8_t PUBLISH_BURST = 10;
+  static const uint32_t PUBLISH_BURST_DELAY_MS = 20;
 
   void set_keep_alive(uint16_t keep_alive) final { this->keep_alive_ = keep_alive; }
   void set_client_id(const char *client_id) final { this->client_id_ = client_id; }
@@ -212,6 +216,19 @@ class MQTTBackendESP32 final : public MQTTBackend {
   void set_cl_key(const std::string &key) { cl_key_ = key; }
   void set_skip_cert_cn_check(bool skip_check) { skip_cert_cn_check_ = skip_check; }
 
+#if defined(USE_MQTT_IDF_ENQUEUE)
+  /// Operations waiting for the MQTT task.
+  size_t get_queue_backlog() const { return this->mqtt_queue_.size(); }
+  /// Largest backlog seen since boot.
+  uint8_t get_queue_backlog_peak() const { return this->queue_backlog_peak_; }
+  /// Publishes handed to esp-mqtt by the MQTT task.
+  uint32_t get_queue_sent_count() const { return this->queue_sent_count_.load(std::memory_order_relaxed); }
+  /// Retained publishes skipped because a newer one for the same topic was queued behind them.
+  uint32_t get_queue_superseded_count() const {
+    return this->queue_superseded_count_.load(std::memory_order_relaxed);
+  }
+#endif
+
   // No destructor needed: ESPHome components live for the entire device runtime.
   // The MQTT task and queue will run until the device reboots or loses power,
   // at which point the entire process terminates and FreeRTOS cleans up all tasks.
@@ -256,6 +273,9 @@ class MQTTBackendESP32 final : public MQTTBackend {
   TaskHandle_t task_handle_{nullptr};
   bool enqueue_(MqttQueueTypeT type, const char *topic, int qos = 0, bool retain = false, const char *payload = NULL,
                 size_t len = 0);
+  /// Release retained publishes in the batch that a later retained publish to the same topic would overwrite.
+  void drop_superseded_(QueueElement **batch, size_t count);
+  void send_element_(const QueueElement *elem);
 #endif
 
   // callbacks
@@ -269,6 +289,11 @@ class MQTTBackendESP32 final : public MQTTBackend {
 
 #if defined(USE_MQTT_IDF_ENQUEUE)
   uint32_t last_dropped_log_time_{0};
+  // Written by the main loop only
+  uint8_t queue_backlog_peak_{0};
+  // Written by the MQTT task, read by the main loop
+  std::atomic<uint32_t> queue_sent_count_{0};
+  std::atomic<uint32_t> queue_superseded_count_{0};
   static constexpr uint32_t DROP_LOG_INTERVAL_MS = 10000;  // Log every 10 seconds
 #endif
 };
@@ -15,7 +15,10 @@ std::string MQTTBinarySensorComponent::component_type() const { return "binary_s
 const EntityBase *MQTTBinarySensorComponent::get_entity() const { return this->binary_sensor_; }
 
 void MQTTBinarySensorComponent::setup() {
-  this->binary_sensor_->add_on_state_callback([this](bool state) { this->publish_state(state); });
+  this->binary_sensor_->add_on_state_callback([this](bool state) {
+    if (this->should_publish_state_())
+      this->publish_state(state);
+  });
 }
 
 void MQTTBinarySensorComponent::dump_config() {
@@ -31,8 +34,8 @@ MQTTBinarySensorComponent::MQTTBinarySensorComponent(binary_sensor::BinarySensor
 
 void MQTTBinarySensorComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (!this->binary_sensor_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->binary_sensor_->get_device_class();
+  if (!this->binary_sensor_->get_device_class_ref().empty())
+    root[MQTT_DEVICE_CLASS] = this->binary_sensor_->get_device_class_ref().c_str();
   if (this->binary_sensor_->is_status_binary_sensor())
     root[MQTT_PAYLOAD_ON] = mqtt::global_mqtt_client->get_availability().payload_available;
   if (this->binary_sensor_->is_status_binary_sensor())
@@ -56,15 +56,17 @@ void MQTTClientComponent::setup() {
   });
 #ifdef USE_LOGGER
   if (this->is_log_message_enabled() && logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback(
-        [this](int level, const char *tag, const char *message, size_t message_len) {
-          if (level <= this->log_level_ && this->is_connected()) {
-            this->publish({.topic = this->log_message_.topic,
+    logger::global_logger->add_log_listener(
+        [](void *context, uint8_t level, const char *tag, const char *message, size_t message_len) {
+          auto *self = static_cast<MQTTClientComponent *>(context);
+          if (level <= self->log_level_ && self->is_connected()) {
+            self->publish({.topic = self->log_message_.topic,
                            .payload = std::string(message, message_len),
-                           .qos = this->log_message_.qos,
-                           .retain = this->log_message_.retain});
+                           .qos = self->log_message_.qos,
+                           .retain = self->log_message_.retain});
           }
-        });
+        },
+        this);
   }
 #endif
 
@@ -176,6 +178,13 @@ void MQTTClientComponent::dump_config() {
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+#if defined(USE_MQTT_IDF_ENQUEUE)
+  ESP_LOGCONFIG(TAG,
+                "  Send queue: %u pending, peak %u\n"
+                "  Sent: %" PRIu32 ", superseded: %" PRIu32,
+                (unsigned) this->mqtt_backend_.get_queue_backlog(), this->mqtt_backend_.get_queue_backlog_peak(),
+                this->mqtt_backend_.get_queue_sent_count(), this->mqtt_backend_.get_queue_superseded_count());
+#endif
 }
 bool MQTTClientComponent::can_proceed() {
   return network::is_disabled() || this->state_ == MQTT_CLIENT_DISABLED || this->is_connected() ||
@@ -443,6 +452,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->add_subscription_to_tree_(this->subscriptions_.size() - 1);
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -461,6 +471,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->add_subscription_to_tree_(this->subscriptions_.size() - 1);
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -482,6 +493,37 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
       ++it;
     }
   }
+
+  // Erasing shifted the indices, rebuild the tree
+  this->subscription_tree_ = MQTTTopicNode{};
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->add_subscription_to_tree_(i);
+}
+
+void MQTTClientComponent::add_subscription_to_tree_(uint16_t index) {
+  const std::string &filter = this->subscriptions_[index].topic;
+  MQTTTopicNode *node = &this->subscription_tree_;
+  size_t start = 0;
+  while (true) {
+    size_t end = filter.find('/', start);
+    std::string level = filter.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    MQTTTopicNode *child = nullptr;
+    for (auto &candidate : node->children) {
+      if (candidate.level == level) {
+        child = &candidate;
+        break;
+      }
+    }
+    if (child == nullptr) {
+      node->children.push_back(MQTTTopicNode{.level = std::move(level), .children = {}, .subscriptions = {}});
+      child = &node->children.back();
+    }
+    node = child;
+    if (end == std::string::npos)
+      break;
+    start = end + 1;
+  }
+  node->subscriptions.push_back(index);
 }
 
 // Publish
@@ -543,61 +585,36 @@ void MQTTClientComponent::disable() {
   this->on_shutdown();
 }
 
-/** Check if the message topic matches the given subscription topic
+/** Match the topic against the children of node, starting at the given topic level.
  *
  * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
  *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
+ * Wildcards are not applied to the first level of topics that begin with a "$". A '#' filter level matches
+ * whenever anything is left of the topic, '+' matches exactly one (possibly empty) level.
  */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
+void MQTTClientComponent::dispatch_message_(const MQTTTopicNode &node, const char *level, bool wildcards,
+                                            const std::string &topic, const std::string &payload) {
+  const char *end = strchr(level, '/');
+  size_t len = end == nullptr ? strlen(level) : end - level;
+  for (const auto &child : node.children) {
+    bool is_wildcard = wildcards && child.level.size() == 1;
+    if (is_wildcard && child.level[0] == '#') {
+      if (*level != '\0') {
+        for (uint16_t index : child.subscriptions)
+          this->subscriptions_[index].callback(topic, payload);
+      }
+      continue;
+    }
+    if (!(is_wildcard && child.level[0] == '+') &&
+        (child.level.size() != len || memcmp(child.level.data(), level, len) != 0))
+      continue;
+    if (end == nullptr) {
+      for (uint16_t index : child.subscriptions)
+        this->subscriptions_[index].callback(topic, payload);
+    } else {
+      this->dispatch_message_(child, end + 1, true, topic, payload);
     }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
   }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
 }
 
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
@@ -606,10 +623,8 @@ void MQTTClientComponent::on_message(const std::string &topic, const std::string
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
-    }
+    this->dispatch_message_(this->subscription_tree_, topic.c_str(), !topic.empty() && topic[0] != '$', topic,
+                            payload);
 #ifdef USE_ESP8266
   });
 #endif
@@ -45,6 +45,14 @@ struct MQTTSubscription {
   uint32_t resubscribe_timeout;
 };
 
+/// internal node of the subscription topic tree, one node per topic level.
+struct MQTTTopicNode {
+  std::string level;
+  std::vector<MQTTTopicNode> children;
+  /// Indices into the subscriptions of the filters that end at this level.
+  std::vector<uint16_t> subscriptions;
+};
+
 /// internal struct for MQTT credentials.
 struct MQTTCredentials {
   std::string address;  ///< The address of the server without port number
@@ -246,6 +254,17 @@ class MQTTClientComponent : public Component {
 
   void set_reboot_timeout(uint32_t reboot_timeout);
 
+  /// Publish sensor, binary sensor and text sensor states at most once per interval and entity, the latest wins.
+  void set_min_state_interval(uint32_t min_state_interval) { this->min_state_interval_ = min_state_interval; }
+  uint32_t get_min_state_interval() const { return this->min_state_interval_; }
+  /// Publish a sensor state only if it moved at least min_state_delta, or the last one is max_state_interval old.
+  void set_min_state_delta(float min_state_delta, uint32_t max_state_interval) {
+    this->min_state_delta_ = min_state_delta;
+    this->max_state_interval_ = max_state_interval;
+  }
+  float get_min_state_delta() const { return this->min_state_delta_; }
+  uint32_t get_max_state_interval() const { return this->max_state_interval_; }
+
   void register_mqtt_component(MQTTComponent *component);
 
   bool is_connected();
@@ -289,6 +308,10 @@ class MQTTClientComponent : public Component {
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  void add_subscription_to_tree_(uint16_t index);
+  /// Call the callbacks of all subscriptions below node that match the topic from level onwards.
+  void dispatch_message_(const MQTTTopicNode &node, const char *level, bool wildcards, const std::string &topic,
+                         const std::string &payload);
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -317,6 +340,8 @@ class MQTTClientComponent : public Component {
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// The subscription topic filters split at '/', so dispatch costs one step per topic level.
+  MQTTTopicNode subscription_tree_;
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -332,6 +357,9 @@ class MQTTClientComponent : public Component {
   bool enable_on_boot_{true};
   std::vector<MQTTComponent *> children_;
   uint32_t reboot_timeout_{300000};
+  uint32_t min_state_interval_{0};
+  uint32_t max_state_interval_{0};
+  float min_state_delta_{0.0f};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
   optional<MQTTClientDisconnectReason> disconnect_reason_{};
@@ -36,16 +36,26 @@ std::string MQTTComponent::get_default_topic_for_(const std::string &suffix) con
   return topic_prefix + "/" + this->component_type() + "/" + this->get_default_object_id_() + "/" + suffix;
 }
 
-std::string MQTTComponent::get_state_topic_() const {
-  if (this->has_custom_state_topic_)
-    return this->custom_state_topic_.str();
-  return this->get_default_topic_for_("state");
+const std::string &MQTTComponent::get_state_topic_() const {
+  if (this->state_topic_.empty()) {
+    if (this->has_custom_state_topic_) {
+      this->state_topic_ = this->custom_state_topic_.str();
+    } else {
+      this->state_topic_ = this->get_default_topic_for_("state");
+    }
+  }
+  return this->state_topic_;
 }
 
-std::string MQTTComponent::get_command_topic_() const {
-  if (this->has_custom_command_topic_)
-    return this->custom_command_topic_.str();
-  return this->get_default_topic_for_("command");
+const std::string &MQTTComponent::get_command_topic_() const {
+  if (this->command_topic_.empty()) {
+    if (this->has_custom_command_topic_) {
+      this->command_topic_ = this->custom_command_topic_.str();
+    } else {
+      this->command_topic_ = this->get_default_topic_for_("command");
+    }
+  }
+  return this->command_topic_;
 }
 
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
@@ -70,124 +80,137 @@ bool MQTTComponent::send_discovery_() {
 
   ESP_LOGV(TAG, "'%s': Sending discovery", this->friendly_name().c_str());
 
+#ifdef USE_MQTT_DISCOVERY_CACHE
+  if (this->discovery_payload_.empty()) {
+    this->discovery_topic_ = this->get_discovery_topic_(discovery_info);
+    // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+    this->discovery_payload_ = json::build_json([this](JsonObject root) { this->build_discovery_(root); });
+  }
+  return global_mqtt_client->publish(this->discovery_topic_, this->discovery_payload_, this->qos_,
+                                     discovery_info.retain);
+#else
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
   return global_mqtt_client->publish_json(
-      this->get_discovery_topic_(discovery_info),
-      [this](JsonObject root) {
-        SendDiscoveryConfig config;
-        config.state_topic = true;
-        config.command_topic = true;
-
-        this->send_discovery(root, config);
-        // Set subscription QoS (default is 0)
-        if (this->subscribe_qos_ != 0) {
-          root[MQTT_QOS] = this->subscribe_qos_;
-        }
-
-        // Fields from EntityBase
-        if (this->get_entity()->has_own_name()) {
-          root[MQTT_NAME] = this->friendly_name();
-        } else {
-          root[MQTT_NAME] = "";
-        }
-        if (this->is_disabled_by_default())
-          root[MQTT_ENABLED_BY_DEFAULT] = false;
-        if (!this->get_icon().empty())
-          root[MQTT_ICON] = this->get_icon();
-
-        switch (this->get_entity()->get_entity_category()) {
-          case ENTITY_CATEGORY_NONE:
-            break;
-          case ENTITY_CATEGORY_CONFIG:
-            root[MQTT_ENTITY_CATEGORY] = "config";
-            break;
-          case ENTITY_CATEGORY_DIAGNOSTIC:
-            root[MQTT_ENTITY_CATEGORY] = "diagnostic";
-            break;
-        }
-
-        if (config.state_topic)
-          root[MQTT_STATE_TOPIC] = this->get_state_topic_();
-        if (config.command_topic)
-          root[MQTT_COMMAND_TOPIC] = this->get_command_topic_();
-        if (this->command_retain_)
-          root[MQTT_COMMAND_RETAIN] = true;
-
-        if (this->availability_ == nullptr) {
-          if (!global_mqtt_client->get_availability().topic.empty()) {
-            root[MQTT_AVAILABILITY_TOPIC] = global_mqtt_client->get_availability().topic;
-            if (global_mqtt_client->get_availability().payload_available != "online")
-              root[MQTT_PAYLOAD_AVAILABLE] = global_mqtt_client->get_availability().payload_available;
-            if (global_mqtt_client->get_availability().payload_not_available != "offline")
-              root[MQTT_PAYLOAD_NOT_AVAILABLE] = global_mqtt_client->get_availability().payload_not_available;
-          }
-        } else if (!this->availability_->topic.empty()) {
-          root[MQTT_AVAILABILITY_TOPIC] = this->availability_->topic;
-          if (this->availability_->payload_available != "online")
-            root[MQTT_PAYLOAD_AVAILABLE] = this->availability_->payload_available;
-          if (this->availability_->payload_not_available != "offline")
-            root[MQTT_PAYLOAD_NOT_AVAILABLE] = this->availability_->payload_not_available;
-        }
-
-        const MQTTDiscoveryInfo &discovery_info = global_mqtt_client->get_discovery_info();
-        if (discovery_info.unique_id_generator == MQTT_MAC_ADDRESS_UNIQUE_ID_GENERATOR) {
-          char friendly_name_hash[9];
-          sprintf(friendly_name_hash, "%08" PRIx32, fnv1_hash(this->friendly_name()));
-          friendly_name_hash[8] = 0;  // ensure the hash-string ends with null
-          root[MQTT_UNIQUE_ID] = get_mac_address() + "-" + this->component_type() + "-" + friendly_name_hash;
-        } else {
-          // default to almost-unique ID. It's a hack but the only way to get that
-          // gorgeous device registry view.
-          root[MQTT_UNIQUE_ID] = "ESP" + this->component_type() + this->get_default_object_id_();
-        }
-
-        const std::string &node_name = App.get_name();
-        if (discovery_info.object_id_generator == MQTT_DEVICE_NAME_OBJECT_ID_GENERATOR)
-          root[MQTT_OBJECT_ID] = node_name + "_" + this->get_default_object_id_();
-
-        std::string node_friendly_name = App.get_friendly_name();
-        if (node_friendly_name.empty()) {
-          node_friendly_name = node_name;
-        }
-        std::string node_area = App.get_area();
-
-        JsonObject device_info = root[MQTT_DEVICE].to<JsonObject>();
-        const auto mac = get_mac_address();
-        device_info[MQTT_DEVICE_IDENTIFIERS] = mac;
-        device_info[MQTT_DEVICE_NAME] = node_friendly_name;
+      this->get_discovery_topic_(discovery_info), [this](JsonObject root) { this->build_discovery_(root); },
+      this->qos_, discovery_info.retain);
+  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
+#endif
+}
+
+void MQTTComponent::build_discovery_(JsonObject root) {
+  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+  SendDiscoveryConfig config;
+  config.state_topic = true;
+  config.command_topic = true;
+
+  this->send_discovery(root, config);
+  // Set subscription QoS (default is 0)
+  if (this->subscribe_qos_ != 0) {
+    root[MQTT_QOS] = this->subscribe_qos_;
+  }
+
+  // Fields from EntityBase
+  if (this->get_entity()->has_own_name()) {
+    root[MQTT_NAME] = this->friendly_name();
+  } else {
+    root[MQTT_NAME] = "";
+  }
+  if (this->is_disabled_by_default())
+    root[MQTT_ENABLED_BY_DEFAULT] = false;
+  if (!this->get_icon().empty())
+    root[MQTT_ICON] = this->get_icon();
+
+  switch (this->get_entity()->get_entity_category()) {
+    case ENTITY_CATEGORY_NONE:
+      break;
+    case ENTITY_CATEGORY_CONFIG:
+      root[MQTT_ENTITY_CATEGORY] = "config";
+      break;
+    case ENTITY_CATEGORY_DIAGNOSTIC:
+      root[MQTT_ENTITY_CATEGORY] = "diagnostic";
+      break;
+  }
+
+  if (config.state_topic)
+    root[MQTT_STATE_TOPIC] = this->get_state_topic_();
+  if (config.command_topic)
+    root[MQTT_COMMAND_TOPIC] = this->get_command_topic_();
+  if (this->command_retain_)
+    root[MQTT_COMMAND_RETAIN] = true;
+
+  if (this->availability_ == nullptr) {
+    if (!global_mqtt_client->get_availability().topic.empty()) {
+      root[MQTT_AVAILABILITY_TOPIC] = global_mqtt_client->get_availability().topic;
+      if (global_mqtt_client->get_availability().payload_available != "online")
+        root[MQTT_PAYLOAD_AVAILABLE] = global_mqtt_client->get_availability().payload_available;
+      if (global_mqtt_client->get_availability().payload_not_available != "offline")
+        root[MQTT_PAYLOAD_NOT_AVAILABLE] = global_mqtt_client->get_availability().payload_not_available;
+    }
+  } else if (!this->availability_->topic.empty()) {
+    root[MQTT_AVAILABILITY_TOPIC] = this->availability_->topic;
+    if (this->availability_->payload_available != "online")
+      root[MQTT_PAYLOAD_AVAILABLE] = this->availability_->payload_available;
+    if (this->availability_->payload_not_available != "offline")
+      root[MQTT_PAYLOAD_NOT_AVAILABLE] = this->availability_->payload_not_available;
+  }
+
+  const MQTTDiscoveryInfo &discovery_info = global_mqtt_client->get_discovery_info();
+  if (discovery_info.unique_id_generator == MQTT_MAC_ADDRESS_UNIQUE_ID_GENERATOR) {
+    char friendly_name_hash[9];
+    sprintf(friendly_name_hash, "%08" PRIx32, fnv1_hash(this->friendly_name()));
+    friendly_name_hash[8] = 0;  // ensure the hash-string ends with null
+    root[MQTT_UNIQUE_ID] = get_mac_address() + "-" + this->component_type() + "-" + friendly_name_hash;
+  } else {
+    // default to almost-unique ID. It's a hack but the only way to get that
+    // gorgeous device registry view.
+    root[MQTT_UNIQUE_ID] = "ESP" + this->component_type() + this->get_default_object_id_();
+  }
+
+  const std::string &node_name = App.get_name();
+  if (discovery_info.object_id_generator == MQTT_DEVICE_NAME_OBJECT_ID_GENERATOR)
+    root[MQTT_OBJECT_ID] = node_name + "_" + this->get_default_object_id_();
+
+  std::string node_friendly_name = App.get_friendly_name();
+  if (node_friendly_name.empty()) {
+    node_friendly_name = node_name;
+  }
+  std::string node_area = App.get_area();
+
+  JsonObject device_info = root[MQTT_DEVICE].to<JsonObject>();
+  const auto mac = get_mac_address();
+  device_info[MQTT_DEVICE_IDENTIFIERS] = mac;
+  device_info[MQTT_DEVICE_NAME] = node_friendly_name;
 #ifdef ESPHOME_PROJECT_NAME
-        device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_PROJECT_VERSION " (ESPHome " ESPHOME_VERSION ")";
-        const char *model = std::strchr(ESPHOME_PROJECT_NAME, '.');
-        if (model == nullptr) {  // must never happen but check anyway
-          device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
-          device_info[MQTT_DEVICE_MANUFACTURER] = ESPHOME_PROJECT_NAME;
-        } else {
-          device_info[MQTT_DEVICE_MODEL] = model + 1;
-          device_info[MQTT_DEVICE_MANUFACTURER] = std::string(ESPHOME_PROJECT_NAME, model - ESPHOME_PROJECT_NAME);
-        }
+  device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_PROJECT_VERSION " (ESPHome " ESPHOME_VERSION ")";
+  const char *model = std::strchr(ESPHOME_PROJECT_NAME, '.');
+  if (model == nullptr) {  // must never happen but check anyway
+    device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
+    device_info[MQTT_DEVICE_MANUFACTURER] = ESPHOME_PROJECT_NAME;
+  } else {
+    device_info[MQTT_DEVICE_MODEL] = model + 1;
+    device_info[MQTT_DEVICE_MANUFACTURER] = std::string(ESPHOME_PROJECT_NAME, model - ESPHOME_PROJECT_NAME);
+  }
 #else
-        device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_VERSION " (" + App.get_compilation_time() + ")";
-        device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
+  device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_VERSION " (" + App.get_compilation_time() + ")";
+  device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
 #if defined(USE_ESP8266) || defined(USE_ESP32)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Espressif";
+  device_info[MQTT_DEVICE_MANUFACTURER] = "Espressif";
 #elif defined(USE_RP2040)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Raspberry Pi";
+  device_info[MQTT_DEVICE_MANUFACTURER] = "Raspberry Pi";
 #elif defined(USE_BK72XX)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Beken";
+  device_info[MQTT_DEVICE_MANUFACTURER] = "Beken";
 #elif defined(USE_RTL87XX)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Realtek";
+  device_info[MQTT_DEVICE_MANUFACTURER] = "Realtek";
 #elif defined(USE_HOST)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Host";
+  device_info[MQTT_DEVICE_MANUFACTURER] = "Host";
 #endif
 #endif
-        if (!node_area.empty()) {
-          device_info[MQTT_DEVICE_SUGGESTED_AREA] = node_area;
-        }
+  if (!node_area.empty()) {
+    device_info[MQTT_DEVICE_SUGGESTED_AREA] = node_area;
+  }
 
-        device_info[MQTT_DEVICE_CONNECTIONS][0][0] = "mac";
-        device_info[MQTT_DEVICE_CONNECTIONS][0][1] = mac;
-      },
-      this->qos_, discovery_info.retain);
+  device_info[MQTT_DEVICE_CONNECTIONS][0][0] = "mac";
+  device_info[MQTT_DEVICE_CONNECTIONS][0][1] = mac;
   // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
@@ -227,6 +250,9 @@ void MQTTComponent::set_command_retain(bool command_retain) { this->command_reta
 
 void MQTTComponent::set_availability(std::string topic, std::string payload_available,
                                      std::string payload_not_available) {
+#ifdef USE_MQTT_DISCOVERY_CACHE
+  this->discovery_payload_.clear();
+#endif
   this->availability_ = make_unique<Availability>();
   this->availability_->topic = std::move(topic);
   this->availability_->payload_available = std::move(payload_available);
@@ -283,6 +309,24 @@ void MQTTComponent::call_dump_config() {
 void MQTTComponent::schedule_resend_state() { this->resend_state_ = true; }
 bool MQTTComponent::is_connected_() const { return global_mqtt_client->is_connected(); }
 
+bool MQTTComponent::should_publish_state_() {
+  const uint32_t interval = global_mqtt_client->get_min_state_interval();
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->last_state_publish_;
+  if (elapsed >= interval) {
+    if (interval != 0)
+      this->cancel_timeout("state");
+    this->last_state_publish_ = now;
+    return true;
+  }
+  // Replacing the timeout keeps its end, the state current at that time is published
+  this->set_timeout("state", interval - elapsed, [this]() {
+    this->last_state_publish_ = millis();
+    this->send_initial_state();
+  });
+  return false;
+}
+
 // Pull these properties from EntityBase if not overridden
 std::string MQTTComponent::friendly_name() const { return this->get_entity()->get_name(); }
 std::string MQTTComponent::get_icon() const { return this->get_entity()->get_icon(); }
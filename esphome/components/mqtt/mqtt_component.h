@@ -173,16 +173,25 @@ class MQTTComponent : public Component {
   /// Get whether the underlying Entity is disabled by default
   virtual bool is_disabled_by_default() const;
 
-  /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  /// Get the MQTT topic that new states will be shared to. Built on first use and kept for the component's lifetime.
+  const std::string &get_state_topic_() const;
 
-  /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  /// Get the MQTT topic for listening to commands. Built on first use and kept for the component's lifetime.
+  const std::string &get_command_topic_() const;
 
   bool is_connected_() const;
 
+  /** Whether a new state is to be published right away.
+   *
+   * Within the client's min_state_interval of the last publish the state is held back instead, and the latest state
+   * is published through send_initial_state() once the interval is over.
+   */
+  bool should_publish_state_();
+
   /// Internal method to start sending discovery info, this will call send_discovery().
   bool send_discovery_();
+  /// Fill in the discovery payload for this component.
+  void build_discovery_(JsonObject root);
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -191,6 +200,13 @@ class MQTTComponent : public Component {
 
   StringRef custom_state_topic_{};
   StringRef custom_command_topic_{};
+  mutable std::string state_topic_{};
+  mutable std::string command_topic_{};
+#ifdef USE_MQTT_DISCOVERY_CACHE
+  /// Discovery topic and payload from the first send, reused on every reconnect.
+  std::string discovery_topic_{};
+  std::string discovery_payload_{};
+#endif
 
   std::unique_ptr<Availability> availability_;
 
@@ -203,6 +219,7 @@ class MQTTComponent : public Component {
   uint8_t subscribe_qos_{0};
   bool discovery_enabled_{true};
   bool resend_state_{false};
+  uint32_t last_state_publish_{0};
 };
 
 }  // namespace mqtt
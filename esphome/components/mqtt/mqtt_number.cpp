@@ -44,8 +44,8 @@ void MQTTNumberComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryCon
   root[MQTT_MIN] = traits.get_min_value();
   root[MQTT_MAX] = traits.get_max_value();
   root[MQTT_STEP] = traits.get_step();
-  if (!this->number_->traits.get_unit_of_measurement().empty())
-    root[MQTT_UNIT_OF_MEASUREMENT] = this->number_->traits.get_unit_of_measurement();
+  if (!this->number_->traits.get_unit_of_measurement_ref().empty())
+    root[MQTT_UNIT_OF_MEASUREMENT] = this->number_->traits.get_unit_of_measurement_ref().c_str();
   switch (this->number_->traits.get_mode()) {
     case NUMBER_MODE_AUTO:
       break;
@@ -56,8 +56,8 @@ void MQTTNumberComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryCon
       root[MQTT_MODE] = "slider";
       break;
   }
-  if (!this->number_->traits.get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->number_->traits.get_device_class();
+  if (!this->number_->traits.get_device_class_ref().empty())
+    root[MQTT_DEVICE_CLASS] = this->number_->traits.get_device_class_ref().c_str();
 
   config.command_topic = true;
 }
@@ -1,4 +1,5 @@
 #include <cinttypes>
+#include <cmath>
 #include "mqtt_sensor.h"
 #include "esphome/core/log.h"
 
@@ -21,7 +22,10 @@ using namespace esphome::sensor;
 MQTTSensorComponent::MQTTSensorComponent(Sensor *sensor) : sensor_(sensor) {}
 
 void MQTTSensorComponent::setup() {
-  this->sensor_->add_on_state_callback([this](float state) { this->publish_state(state); });
+  this->sensor_->add_on_state_callback([this](float state) {
+    if (!this->within_deadband_(state) && this->should_publish_state_())
+      this->publish_state(state);
+  });
 }
 
 void MQTTSensorComponent::dump_config() {
@@ -45,12 +49,12 @@ void MQTTSensorComponent::disable_expire_after() { this->expire_after_ = 0; }
 
 void MQTTSensorComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (!this->sensor_->get_device_class().empty()) {
-    root[MQTT_DEVICE_CLASS] = this->sensor_->get_device_class();
+  if (!this->sensor_->get_device_class_ref().empty()) {
+    root[MQTT_DEVICE_CLASS] = this->sensor_->get_device_class_ref().c_str();
   }
 
-  if (!this->sensor_->get_unit_of_measurement().empty())
-    root[MQTT_UNIT_OF_MEASUREMENT] = this->sensor_->get_unit_of_measurement();
+  if (!this->sensor_->get_unit_of_measurement_ref().empty())
+    root[MQTT_UNIT_OF_MEASUREMENT] = this->sensor_->get_unit_of_measurement_ref().c_str();
 
   if (this->get_expire_after() > 0)
     root[MQTT_EXPIRE_AFTER] = this->get_expire_after() / 1000;
@@ -75,7 +79,20 @@ bool MQTTSensorComponent::send_initial_state() {
     return true;
   }
 }
+bool MQTTSensorComponent::within_deadband_(float state) const {
+  const float delta = global_mqtt_client->get_min_state_delta();
+  if (delta == 0.0f)
+    return false;
+  const uint32_t max_interval = global_mqtt_client->get_max_state_interval();
+  if (max_interval != 0 && millis() - this->last_state_publish_ >= max_interval)
+    return false;
+  if (std::isnan(state) || std::isnan(this->last_value_))
+    return std::isnan(state) && std::isnan(this->last_value_);
+  return std::fabs(state - this->last_value_) < delta;
+}
+
 bool MQTTSensorComponent::publish_state(float value) {
+  this->last_value_ = value;
   if (mqtt::global_mqtt_client->is_publish_nan_as_none() && std::isnan(value))
     return this->publish(this->get_state_topic_(), "None");
   int8_t accuracy = this->sensor_->get_accuracy_decimals();
@@ -46,8 +46,11 @@ class MQTTSensorComponent : public mqtt::MQTTComponent {
   /// Override for MQTTComponent, returns "sensor".
   std::string component_type() const override;
   const EntityBase *get_entity() const override;
+  /// Whether state is within the client's min_state_delta of the last published state and is to be dropped.
+  bool within_deadband_(float state) const;
 
   sensor::Sensor *sensor_;
+  float last_value_{NAN};
   optional<uint32_t> expire_after_;  // Override the expire after advertised to Home Assistant
 };
 
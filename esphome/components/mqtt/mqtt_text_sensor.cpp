@@ -16,13 +16,16 @@ using namespace esphome::text_sensor;
 MQTTTextSensor::MQTTTextSensor(TextSensor *sensor) : sensor_(sensor) {}
 void MQTTTextSensor::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (!this->sensor_->get_device_class().empty()) {
-    root[MQTT_DEVICE_CLASS] = this->sensor_->get_device_class();
+  if (!this->sensor_->get_device_class_ref().empty()) {
+    root[MQTT_DEVICE_CLASS] = this->sensor_->get_device_class_ref().c_str();
   }
   config.command_topic = false;
 }
 void MQTTTextSensor::setup() {
-  this->sensor_->add_on_state_callback([this](const std::string &state) { this->publish_state(state); });
+  this->sensor_->add_on_state_callback([this](const std::string &state) {
+    if (this->should_publish_state_())
+      this->publish_state(state);
+  });
 }
 
 void MQTTTextSensor::dump_config() {
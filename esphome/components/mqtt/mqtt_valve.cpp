@@ -50,8 +50,8 @@ void MQTTValveComponent::dump_config() {
 }
 void MQTTValveComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (!this->valve_->get_device_class().empty()) {
-    root[MQTT_DEVICE_CLASS] = this->valve_->get_device_class();
+  if (!this->valve_->get_device_class_ref().empty()) {
+    root[MQTT_DEVICE_CLASS] = this->valve_->get_device_class_ref().c_str();
   }
 
   auto traits = this->valve_->get_traits();
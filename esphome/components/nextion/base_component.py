@@ -10,6 +10,7 @@ from . import CONF_NEXTION_ID, Nextion
 CONF_AUTO_WAKE_ON_TOUCH = "auto_wake_on_touch"
 CONF_BACKGROUND_PRESSED_COLOR = "background_pressed_color"
 CONF_COMMAND_SPACING = "command_spacing"
+CONF_COMMAND_WINDOW = "command_window"
 CONF_COMPONENT_NAME = "component_name"
 CONF_DUMP_DEVICE_INFO = "dump_device_info"
 CONF_EXIT_REPARSE_ON_START = "exit_reparse_on_start"
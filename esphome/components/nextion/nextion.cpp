@@ -186,6 +186,10 @@ void Nextion::dump_config() {
   ESP_LOGCONFIG(TAG, "  Cmd spacing:      %u ms", this->command_pacer_.get_spacing());
 #endif  // USE_NEXTION_COMMAND_SPACING
 
+#ifdef USE_NEXTION_COMMAND_WINDOW
+  ESP_LOGCONFIG(TAG, "  Cmd window:       %u", this->command_window_);
+#endif  // USE_NEXTION_COMMAND_WINDOW
+
 #ifdef USE_NEXTION_MAX_QUEUE_SIZE
   ESP_LOGCONFIG(TAG, "  Max queue size:   %zu", this->max_queue_size_);
 #endif
@@ -339,14 +343,29 @@ void Nextion::loop() {
     }
   }
 
-#ifdef USE_NEXTION_COMMAND_SPACING
-  // Try to send any pending commands if spacing allows
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
+  // Try to send any pending commands if spacing and the command window allow
   this->process_pending_in_queue_();
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
 }
 
-#ifdef USE_NEXTION_COMMAND_SPACING
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
 void Nextion::process_pending_in_queue_() {
+#ifdef USE_NEXTION_COMMAND_WINDOW
+  uint8_t in_flight = 0;
+  for (auto *item : this->nextion_queue_) {
+    if (item->pending_command.empty()) {
+      in_flight++;
+      continue;
+    }
+    if (in_flight >= this->command_window_ || !this->send_command_(item->pending_command)) {
+      return;
+    }
+    item->pending_command.clear();
+    in_flight++;
+    ESP_LOGVV(TAG, "Pending command sent: %s", item->component->get_variable_name().c_str());
+  }
+#else
   if (this->nextion_queue_.empty() || !this->command_pacer_.can_send()) {
     return;
   }
@@ -360,8 +379,21 @@ void Nextion::process_pending_in_queue_() {
       ESP_LOGVV(TAG, "Pending command sent: %s", front_item->component->get_variable_name().c_str());
     }
   }
+#endif  // USE_NEXTION_COMMAND_WINDOW
 }
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
+
+#ifdef USE_NEXTION_COMMAND_WINDOW
+bool Nextion::command_window_open_() const {
+  uint8_t in_flight = 0;
+  for (auto *item : this->nextion_queue_) {
+    if (!item->pending_command.empty() || ++in_flight >= this->command_window_) {
+      return false;
+    }
+  }
+  return true;
+}
+#endif  // USE_NEXTION_COMMAND_WINDOW
 
 bool Nextion::remove_from_q_(bool report_empty) {
   if (this->nextion_queue_.empty()) {
@@ -1064,19 +1096,40 @@ void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_n
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || command.empty())
     return;
 
+#ifdef USE_NEXTION_COMMAND_WINDOW
+  // The setup commands are sent right away, like they ignore the command spacing
+  if (!this->connection_state_.ignore_is_setup_ && !this->command_window_open_()) {
+    this->add_no_result_to_queue_with_pending_command_(variable_name, command);
+    return;
+  }
+#endif  // USE_NEXTION_COMMAND_WINDOW
+
   if (this->send_command_(command)) {
     this->add_no_result_to_queue_(variable_name);
-#ifdef USE_NEXTION_COMMAND_SPACING
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
   } else {
     // Command blocked by spacing, add to queue WITH the command for retry
     this->add_no_result_to_queue_with_pending_command_(variable_name, command);
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
   }
 }
 
-#ifdef USE_NEXTION_COMMAND_SPACING
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
 void Nextion::add_no_result_to_queue_with_pending_command_(const std::string &variable_name,
                                                            const std::string &command) {
+  // Only the last value of an attribute matters, so a newer assignment replaces one that was not sent yet
+  const size_t assign_len = command.find('=') + 1;
+  if (assign_len != 0) {
+    for (auto *item : this->nextion_queue_) {
+      if (item->pending_command.compare(0, assign_len, command, 0, assign_len) == 0 &&
+          item->component->get_variable_name() == variable_name) {
+        item->pending_command = command;
+        ESP_LOGVV(TAG, "Pending command replaced: %s", variable_name.c_str());
+        return;
+      }
+    }
+  }
+
 #ifdef USE_NEXTION_MAX_QUEUE_SIZE
   if (this->max_queue_size_ > 0 && this->nextion_queue_.size() >= this->max_queue_size_) {
     ESP_LOGW(TAG, "Queue full (%zu), drop: %s", this->nextion_queue_.size(), variable_name.c_str());
@@ -1100,7 +1153,7 @@ void Nextion::add_no_result_to_queue_with_pending_command_(const std::string &va
   this->nextion_queue_.push_back(nextion_queue);
   ESP_LOGVV(TAG, "Queue with pending command: %s", variable_name.c_str());
 }
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
 
 bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format,
                                                                ...) {
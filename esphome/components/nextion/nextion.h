@@ -113,6 +113,14 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   void set_command_spacing(uint32_t spacing_ms) { this->command_pacer_.set_spacing(spacing_ms); }
 #endif  // USE_NEXTION_COMMAND_SPACING
 
+#ifdef USE_NEXTION_COMMAND_WINDOW
+  /**
+   * @brief Set how many queued commands are sent before their results come back
+   * @param window Number of commands in flight, together they have to fit the serial buffer of the display
+   */
+  void set_command_window(uint8_t window) { this->command_window_ = window; }
+#endif  // USE_NEXTION_COMMAND_WINDOW
+
   /**
    * Set the text of a component to a static string.
    * @param component The component name.
@@ -1306,19 +1314,32 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
 #ifdef USE_NEXTION_COMMAND_SPACING
   NextionCommandPacer command_pacer_{0};
+#endif  // USE_NEXTION_COMMAND_SPACING
+#ifdef USE_NEXTION_COMMAND_WINDOW
+  uint8_t command_window_{1};
+
+  /**
+   * @brief Whether a new command can be sent right away
+   *
+   * False while a previous command still waits to be sent, so the commands keep their order, or once
+   * command_window_ commands are waiting for their result.
+   */
+  bool command_window_open_() const;
+#endif  // USE_NEXTION_COMMAND_WINDOW
 
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
   /**
-   * @brief Process any commands in the queue that are pending due to command spacing
+   * @brief Process any commands in the queue that are pending due to command spacing or the command window
    *
-   * This method checks if the first item in the nextion_queue_ has a pending command
-   * that was previously blocked by command spacing. If spacing now allows and a
-   * pending command exists, it attempts to send the command. Once successfully sent,
-   * the pending command is cleared and the queue item continues normal processing.
+   * This method sends the pending commands in queue order for as long as spacing allows and, with a command window,
+   * fewer than command_window_ commands are waiting for their result. Without a window only the first item in the
+   * queue is sent. Once successfully sent, the pending command is cleared and the queue item continues normal
+   * processing.
    *
-   * Called from loop() to retry sending commands that were delayed by spacing.
+   * Called from loop() to retry sending commands that were delayed.
    */
   void process_pending_in_queue_();
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
 
   std::deque<NextionQueue *> nextion_queue_;
   std::deque<NextionQueue *> waveform_queue_;
@@ -1362,22 +1383,25 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
       __attribute__((format(printf, 3, 4)));
   void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command);
 
-#ifdef USE_NEXTION_COMMAND_SPACING
+#if defined(USE_NEXTION_COMMAND_SPACING) || defined(USE_NEXTION_COMMAND_WINDOW)
   /**
    * @brief Add a command to the Nextion queue with a pending command for retry
    *
-   * This method creates a queue entry for a command that was blocked by command spacing.
+   * This method creates a queue entry for a command that was blocked by command spacing or the command window.
    * The command string is stored in the queue item's pending_command field so it can
    * be retried later when spacing allows. This ensures commands are not lost when
    * sent too quickly.
    *
+   * An assignment like `t0.txt="..."` replaces a pending assignment to the same attribute from the same call instead,
+   * only the last value is sent.
+   *
    * If the max_queue_size limit is configured and reached, the command will be dropped.
    *
    * @param variable_name Name of the variable or component associated with the command
    * @param command The actual command string to be sent when spacing allows
    */
   void add_no_result_to_queue_with_pending_command_(const std::string &variable_name, const std::string &command);
-#endif  // USE_NEXTION_COMMAND_SPACING
+#endif  // USE_NEXTION_COMMAND_SPACING || USE_NEXTION_COMMAND_WINDOW
 
   bool add_no_result_to_queue_with_printf_(const std::string &variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
@@ -32,6 +32,22 @@ bool IRAM_ATTR OneWireBus::select(uint64_t address) {
   return true;
 }
 
+int32_t OneWireBus::broadcast(uint8_t cmd, uint32_t duration_ms) {
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->last_broadcast_time_;
+  if (this->broadcast_sent_ && this->last_broadcast_cmd_ == cmd && elapsed < duration_ms)
+    return duration_ms - elapsed;
+
+  if (!this->reset_())
+    return -1;
+  this->skip();
+  this->write8(cmd);
+  this->last_broadcast_cmd_ = cmd;
+  this->last_broadcast_time_ = now;
+  this->broadcast_sent_ = true;
+  return duration_ms;
+}
+
 void OneWireBus::search() {
   this->devices_.clear();
 
@@ -27,6 +27,16 @@ class OneWireBus {
   /// Select a specific address on the bus for the following command.
   bool select(uint64_t address);
 
+  /** Send a command to all devices at once, unless the same command was sent less than \p duration_ms ago.
+   *
+   * Devices that start the same operation, like a temperature conversion, share a single command this way instead of
+   * each addressing its own device.
+   *
+   * @return The milliseconds until an operation of \p duration_ms started by the command is done, -1 if the bus reset
+   * failed.
+   */
+  int32_t broadcast(uint8_t cmd, uint32_t duration_ms);
+
   /// Return the list of found devices.
   const std::vector<uint64_t> &get_devices();
 
@@ -38,6 +48,9 @@ class OneWireBus {
 
  protected:
   std::vector<uint64_t> devices_;
+  uint32_t last_broadcast_time_{0};
+  uint8_t last_broadcast_cmd_{0};
+  bool broadcast_sent_{false};
 
   /// log the found devices
   void dump_devices_(const char *tag);
@@ -25,6 +25,19 @@ void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   }
 }
 
+bool ImageDecoder::is_rgb565_unscaled(bool &big_endian) const {
+  big_endian = this->image_->is_big_endian_;
+  return this->image_->type_ == image::IMAGE_TYPE_RGB565 && !this->image_->has_transparency() &&
+         this->x_scale_ == 1.0 && this->y_scale_ == 1.0;
+}
+
+void ImageDecoder::draw_row(int x, int y, int w, const uint8_t *data) {
+  if (x < 0 || y < 0 || x >= this->image_->buffer_width_ || y >= this->image_->buffer_height_)
+    return;
+  w = std::min(w, this->image_->buffer_width_ - x);
+  memcpy(this->image_->buffer_ + this->image_->get_position_(x, y), data, w * this->image_->get_bpp() / 8);
+}
+
 DownloadBuffer::DownloadBuffer(size_t size) : size_(size) {
   this->buffer_ = this->allocator_.allocate(size);
   this->reset();
@@ -69,5 +82,15 @@ size_t DownloadBuffer::resize(size_t size) {
   }
 }
 
+size_t DownloadBuffer::shrink(size_t size) {
+  if (this->size_ <= size) {
+    return this->size_;
+  }
+  this->allocator_.deallocate(this->buffer_, this->size_);
+  this->buffer_ = nullptr;
+  this->size_ = 0;
+  return this->resize(size);
+}
+
 }  // namespace online_image
 }  // namespace esphome
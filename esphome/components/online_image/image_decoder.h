@@ -73,8 +73,33 @@ class ImageDecoder {
    */
   void draw(int x, int y, int w, int h, const Color &color);
 
+  /**
+   * @brief Check whether the image stores opaque RGB565 pixels at the size they are decoded in.
+   * Decoders that can produce this format themselves then hand over whole rows with {@see draw_row}.
+   *
+   * @param big_endian Set to the byte order the image stores the pixels in.
+   * @return true if rows can be copied into the image buffer unchanged.
+   */
+  bool is_rgb565_unscaled(bool &big_endian) const;
+
+  /**
+   * @brief Copy a row of pixels that are already in the image's storage format into the image buffer.
+   * Pixels beyond the right or bottom edge of the image are skipped.
+   *
+   * @param x The left-most coordinate of the row.
+   * @param y The coordinate of the row.
+   * @param w The number of pixels in the row.
+   * @param data The pixels to copy.
+   */
+  void draw_row(int x, int y, int w, const uint8_t *data);
+
   bool is_finished() const { return this->decoded_bytes_ == this->download_size_; }
 
+  /// Hash of the downloaded file, 0 if the decoder doesn't see the whole file at once.
+  uint32_t get_file_hash() const { return this->file_hash_; }
+  /// Whether decoding was skipped because the image already holds the downloaded file.
+  bool is_unchanged() const { return this->unchanged_; }
+
  protected:
   OnlineImage *image_;
   // Initializing to 1, to ensure it is distinguishable from initial "decoded_bytes_".
@@ -83,6 +108,8 @@ class ImageDecoder {
   size_t decoded_bytes_ = 0;
   double x_scale_ = 1.0;
   double y_scale_ = 1.0;
+  uint32_t file_hash_ = 0;
+  bool unchanged_ = false;
 };
 
 class DownloadBuffer {
@@ -108,6 +135,8 @@ class DownloadBuffer {
   void reset() { this->unread_ = 0; }
 
   size_t resize(size_t size);
+  /** Give back the memory above size, e.g. once a decoder that needed the whole image in memory is done. */
+  size_t shrink(size_t size);
 
  protected:
   RAMAllocator<uint8_t> allocator_{};
@@ -24,6 +24,14 @@ static int draw_callback(JPEGDRAW *jpeg) {
   // Some very big images take too long to decode, so feed the watchdog on each callback
   // to avoid crashing.
   App.feed_wdt();
+  if (jpeg->iBpp == 16) {
+    // The engine already produces the pixel format of the image buffer, see JpegDecoder::decode()
+    for (int y = 0; y < jpeg->iHeight; y++) {
+      decoder->draw_row(jpeg->x, jpeg->y + y, jpeg->iWidth,
+                        reinterpret_cast<const uint8_t *>(jpeg->pPixels + y * jpeg->iWidth));
+    }
+    return 1;
+  }
   size_t position = 0;
   for (size_t y = 0; y < jpeg->iHeight; y++) {
     for (size_t x = 0; x < jpeg->iWidth; x++) {
@@ -41,6 +49,16 @@ static int draw_callback(JPEGDRAW *jpeg) {
   return 1;
 }
 
+/// FNV-1a hash of a complete file, to recognize a download that is identical to the current image.
+static uint32_t file_hash(const uint8_t *data, size_t size) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
 int JpegDecoder::prepare(size_t download_size) {
   ImageDecoder::prepare(download_size);
   auto size = this->image_->resize_download_buffer(download_size);
@@ -57,6 +75,14 @@ int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
     return 0;
   }
 
+  this->file_hash_ = file_hash(buffer, size);
+  if (this->file_hash_ == this->image_->get_file_hash()) {
+    ESP_LOGD(TAG, "Image unchanged, skipping decoding");
+    this->unchanged_ = true;
+    this->decoded_bytes_ = size;
+    return size;
+  }
+
   if (!this->jpeg_.openRAM(buffer, size, draw_callback)) {
     ESP_LOGE(TAG, "Could not open image for decoding: %d", this->jpeg_.getLastError());
     return DECODE_ERROR_INVALID_TYPE;
@@ -72,10 +98,16 @@ int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
   ESP_LOGD(TAG, "Image size: %d x %d, bpp: %d", this->jpeg_.getWidth(), this->jpeg_.getHeight(), this->jpeg_.getBpp());
 
   this->jpeg_.setUserPointer(this);
-  this->jpeg_.setPixelType(RGB8888);
   if (!this->set_size(this->jpeg_.getWidth(), this->jpeg_.getHeight())) {
     return DECODE_ERROR_OUT_OF_MEMORY;
   }
+  // Let the engine convert straight to RGB565 when the rows can go into the image buffer as they are
+  bool big_endian;
+  if (this->is_rgb565_unscaled(big_endian)) {
+    this->jpeg_.setPixelType(big_endian ? RGB565_BIG_ENDIAN : RGB565_LITTLE_ENDIAN);
+  } else {
+    this->jpeg_.setPixelType(RGB8888);
+  }
   if (!this->jpeg_.decode(0, 0, 0)) {
     ESP_LOGE(TAG, "Error while decoding.");
     this->jpeg_.close();
@@ -67,6 +67,7 @@ void OnlineImage::release() {
     this->buffer_height_ = 0;
     this->last_modified_ = "";
     this->etag_ = "";
+    this->file_hash_ = 0;
     this->end_connection_();
   }
 }
@@ -228,7 +229,8 @@ void OnlineImage::loop() {
     ESP_LOGD(TAG, "Total time: %" PRIu32 "s", (uint32_t) (::time(nullptr) - this->start_time_));
     this->etag_ = this->downloader_->get_response_header(ETAG_HEADER_NAME);
     this->last_modified_ = this->downloader_->get_response_header(LAST_MODIFIED_HEADER_NAME);
-    this->download_finished_callback_.call(false);
+    this->file_hash_ = this->decoder_->get_file_hash();
+    this->download_finished_callback_.call(this->decoder_->is_unchanged());
     this->end_connection_();
     return;
   }
@@ -248,6 +250,10 @@ void OnlineImage::loop() {
       auto fed = this->decoder_->decode(this->download_buffer_.data(), this->download_buffer_.unread());
       if (fed < 0) {
         ESP_LOGE(TAG, "Error when decoding image.");
+        // The buffer may hold a partially decoded image now, so it must not be reported as unchanged next time
+        this->etag_ = "";
+        this->last_modified_ = "";
+        this->file_hash_ = 0;
         this->end_connection_();
         this->download_error_callback_.call();
         return;
@@ -347,6 +353,8 @@ void OnlineImage::end_connection_() {
   }
   this->decoder_.reset();
   this->download_buffer_.reset();
+  // Decoders that need the whole file in memory grow the buffer, don't keep that copy around between downloads
+  this->download_buffer_.shrink(this->download_buffer_initial_size_);
 }
 
 bool OnlineImage::validate_url_(const std::string &url) {
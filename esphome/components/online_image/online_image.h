@@ -93,6 +93,9 @@ class OnlineImage : public PollingComponent,
    */
   size_t resize_download_buffer(size_t size) { return this->download_buffer_.resize(size); }
 
+  /// Hash of the file the image was decoded from, 0 if unknown.
+  uint32_t get_file_hash() const { return this->file_hash_; }
+
   void add_on_finished_callback(std::function<void(bool)> &&callback);
   void add_on_error_callback(std::function<void()> &&callback);
 
@@ -195,11 +198,18 @@ class OnlineImage : public PollingComponent,
    * The value of the Last-Modified HTTP header provided in the last response.
    */
   std::string last_modified_ = "";
+  /**
+   * Hash of the file the current image was decoded from, if the decoder computed one. Lets decoders that need the
+   * whole file skip decoding it again when the server doesn't support conditional requests.
+   */
+  uint32_t file_hash_ = 0;
 
   time_t start_time_;
 
   friend bool ImageDecoder::set_size(int width, int height);
   friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
+  friend bool ImageDecoder::is_rgb565_unscaled(bool &big_endian) const;
+  friend void ImageDecoder::draw_row(int x, int y, int w, const uint8_t *data);
 };
 
 template<typename... Ts> class OnlineImageSetUrlAction : public Action<Ts...> {
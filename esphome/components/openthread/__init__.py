@@ -19,6 +19,7 @@ from .const import (
     CONF_NETWORK_KEY,
     CONF_NETWORK_NAME,
     CONF_PAN_ID,
+    CONF_POLL_PERIOD,
     CONF_PSKC,
     CONF_SRP_ID,
     CONF_TLV,
@@ -86,7 +87,10 @@ def set_sdkconfig_options(config):
     add_idf_sdkconfig_option("CONFIG_OPENTHREAD_SRP_CLIENT", True)
     add_idf_sdkconfig_option("CONFIG_OPENTHREAD_SRP_CLIENT_MAX_SERVICES", 5)
 
-    # TODO: Add suport for sleepy end devices
+    if (poll_period := config.get(CONF_POLL_PERIOD)) is not None:
+        # Sleepy end device: the radio stays off between polls of the parent
+        cg.add_define("USE_OPENTHREAD_POLL_PERIOD", poll_period.total_milliseconds)
+
     add_idf_sdkconfig_option(f"CONFIG_OPENTHREAD_{config.get(CONF_DEVICE_TYPE)}", True)
 
 
@@ -94,6 +98,15 @@ openthread_ns = cg.esphome_ns.namespace("openthread")
 OpenThreadComponent = openthread_ns.class_("OpenThreadComponent", cg.Component)
 OpenThreadSrpComponent = openthread_ns.class_("OpenThreadSrpComponent", cg.Component)
 
+def _validate_poll_period(config):
+    if CONF_POLL_PERIOD in config and config[CONF_DEVICE_TYPE] != "MTD":
+        raise cv.Invalid(
+            f"'{CONF_POLL_PERIOD}' requires '{CONF_DEVICE_TYPE}: MTD', "
+            "only minimal thread devices can be sleepy end devices"
+        )
+    return config
+
+
 _CONNECTION_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_PAN_ID): cv.hex_int,
@@ -117,9 +130,14 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_FORCE_DATASET): cv.boolean,
             cv.Optional(CONF_TLV): cv.string_strict,
+            cv.Optional(CONF_POLL_PERIOD): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=10)),
+            ),
         }
     ).extend(_CONNECTION_SCHEMA),
     cv.has_exactly_one_key(CONF_NETWORK_KEY, CONF_TLV),
+    _validate_poll_period,
     cv.only_with_esp_idf,
     only_on_variant(supported=[VARIANT_ESP32C6, VARIANT_ESP32H2]),
 )
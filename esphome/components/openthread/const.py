@@ -6,6 +6,7 @@ CONF_MESH_LOCAL_PREFIX = "mesh_local_prefix"
 CONF_NETWORK_NAME = "network_name"
 CONF_NETWORK_KEY = "network_key"
 CONF_PAN_ID = "pan_id"
+CONF_POLL_PERIOD = "poll_period"
 CONF_PSKC = "pskc"
 CONF_SRP_ID = "srp_id"
 CONF_TLV = "tlv"
@@ -1,6 +1,8 @@
 #include "esphome/core/defines.h"
 #if defined(USE_OPENTHREAD) && defined(USE_ESP_IDF)
+#include <openthread/link.h>
 #include <openthread/logging.h>
+#include <openthread/thread.h>
 #include "openthread.h"
 
 #include "esp_log.h"
@@ -137,6 +139,19 @@ void OpenThreadComponent::ot_main() {
   }
 #endif
 
+#ifdef USE_OPENTHREAD_POLL_PERIOD
+  // Run as a sleepy end device: the receiver is only turned on to poll the parent for queued frames, so the radio
+  // wakes up once per poll period instead of listening all the time
+  otLinkModeConfig link_mode = {};
+  link_mode.mRxOnWhenIdle = false;
+  link_mode.mDeviceType = false;
+  link_mode.mNetworkData = false;
+  if (otThreadSetLinkMode(esp_openthread_get_instance(), link_mode) != OT_ERROR_NONE ||
+      otLinkSetPollPeriod(esp_openthread_get_instance(), USE_OPENTHREAD_POLL_PERIOD) != OT_ERROR_NONE) {
+    ESP_LOGW(TAG, "Failed to configure sleepy end device mode");
+  }
+#endif
+
   // Pass the existing dataset, or NULL which will use the preprocessor definitions
   ESP_ERROR_CHECK(esp_openthread_auto_start(dataset.mLength > 0 ? &dataset : nullptr));
 
@@ -3,6 +3,8 @@
 
 #include "esphome/components/md5/md5.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
 
 #include <esp_ota_ops.h>
 #include <esp_task_wdt.h>
@@ -11,6 +13,8 @@
 namespace esphome {
 namespace ota {
 
+static const char *const TAG = "ota.idf";
+
 std::unique_ptr<ota::OTABackend> make_ota_backend() { return make_unique<ota::IDFOTABackend>(); }
 
 OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
@@ -53,6 +57,11 @@ OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
     return OTA_RESPONSE_ERROR_UNKNOWN;
   }
   this->md5_.init();
+#ifndef CONFIG_FREERTOS_UNICORE
+  if (!this->start_writer_()) {
+    ESP_LOGW(TAG, "Could not start writer task, writing synchronously");
+  }
+#endif
   return OTA_RESPONSE_OK;
 }
 
@@ -62,20 +71,52 @@ void IDFOTABackend::set_update_md5(const char *expected_md5) {
 }
 
 OTAResponseTypes IDFOTABackend::write(uint8_t *data, size_t len) {
-  esp_err_t err = esp_ota_write(this->update_handle_, data, len);
   this->md5_.add(data, len);
-  if (err != ESP_OK) {
-    if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
-      return OTA_RESPONSE_ERROR_MAGIC;
-    } else if (err == ESP_ERR_FLASH_OP_TIMEOUT || err == ESP_ERR_FLASH_OP_FAIL) {
-      return OTA_RESPONSE_ERROR_WRITING_FLASH;
+#ifndef CONFIG_FREERTOS_UNICORE
+  if (this->writer_task_ != nullptr) {
+    while (len > 0) {
+      // Errors of the writer task show up with a delay of up to two blocks
+      if (this->write_error_ != ESP_OK)
+        return this->write_error_code_(this->write_error_);
+      if (this->block_ == nullptr) {
+        xQueueReceive(this->free_queue_, &this->block_, portMAX_DELAY);
+        this->block_len_ = 0;
+      }
+      size_t chunk = std::min(len, WRITE_BLOCK_SIZE - this->block_len_);
+      memcpy(this->block_ + this->block_len_, data, chunk);
+      this->block_len_ += chunk;
+      data += chunk;
+      len -= chunk;
+      if (this->block_len_ == WRITE_BLOCK_SIZE)
+        this->submit_block_();
     }
-    return OTA_RESPONSE_ERROR_UNKNOWN;
+    return OTA_RESPONSE_OK;
   }
+#endif
+  esp_err_t err = esp_ota_write(this->update_handle_, data, len);
+  if (err != ESP_OK)
+    return this->write_error_code_(err);
   return OTA_RESPONSE_OK;
 }
 
+OTAResponseTypes IDFOTABackend::write_error_code_(esp_err_t err) {
+  if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
+    return OTA_RESPONSE_ERROR_MAGIC;
+  } else if (err == ESP_ERR_FLASH_OP_TIMEOUT || err == ESP_ERR_FLASH_OP_FAIL) {
+    return OTA_RESPONSE_ERROR_WRITING_FLASH;
+  }
+  return OTA_RESPONSE_ERROR_UNKNOWN;
+}
+
 OTAResponseTypes IDFOTABackend::end() {
+#ifndef CONFIG_FREERTOS_UNICORE
+  this->stop_writer_();
+  if (this->write_error_ != ESP_OK) {
+    OTAResponseTypes code = this->write_error_code_(this->write_error_);
+    this->abort();
+    return code;
+  }
+#endif
   if (this->md5_set_) {
     this->md5_.calculate();
     if (!this->md5_.equals_hex(this->expected_bin_md5_)) {
@@ -101,10 +142,116 @@ OTAResponseTypes IDFOTABackend::end() {
 }
 
 void IDFOTABackend::abort() {
+#ifndef CONFIG_FREERTOS_UNICORE
+  this->stop_writer_();
+#endif
   esp_ota_abort(this->update_handle_);
   this->update_handle_ = 0;
 }
 
+#ifndef CONFIG_FREERTOS_UNICORE
+IDFOTABackend::~IDFOTABackend() {
+  this->stop_writer_();
+  // Deleted only here, the writer task may still be returning from its last queue call when stop_writer_() returns
+  if (this->write_queue_ != nullptr)
+    vQueueDelete(this->write_queue_);
+  if (this->free_queue_ != nullptr)
+    vQueueDelete(this->free_queue_);
+}
+
+bool IDFOTABackend::start_writer_() {
+  if (this->write_queue_ == nullptr) {
+    // Two blocks and the stop marker
+    this->write_queue_ = xQueueCreate(3, sizeof(WriteBlock));
+    this->free_queue_ = xQueueCreate(3, sizeof(uint8_t *));
+    if (this->write_queue_ == nullptr || this->free_queue_ == nullptr)
+      return false;
+  }
+
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  for (auto &buffer : this->buffers_) {
+    buffer = allocator.allocate(WRITE_BLOCK_SIZE);
+    if (buffer == nullptr)
+      break;
+  }
+  if (this->buffers_[0] == nullptr || this->buffers_[1] == nullptr) {
+    for (auto &buffer : this->buffers_) {
+      if (buffer != nullptr)
+        allocator.deallocate(buffer, WRITE_BLOCK_SIZE);
+      buffer = nullptr;
+    }
+    return false;
+  }
+  for (auto *buffer : this->buffers_)
+    xQueueSend(this->free_queue_, &buffer, 0);
+  this->block_ = nullptr;
+  this->write_error_ = ESP_OK;
+
+  // Run on the core the receiving task is not on, at the same priority
+  BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+  if (xTaskCreatePinnedToCore(writer_task, "ota_write", 3072, this, uxTaskPriorityGet(nullptr), &this->writer_task_,
+                              core) != pdPASS) {
+    this->writer_task_ = nullptr;
+    xQueueReset(this->free_queue_);
+    for (auto &buffer : this->buffers_) {
+      allocator.deallocate(buffer, WRITE_BLOCK_SIZE);
+      buffer = nullptr;
+    }
+    return false;
+  }
+  return true;
+}
+
+void IDFOTABackend::writer_task(void *arg) {
+  auto *backend = static_cast<IDFOTABackend *>(arg);
+  WriteBlock block;
+  while (xQueueReceive(backend->write_queue_, &block, portMAX_DELAY) == pdTRUE && block.data != nullptr) {
+    if (backend->write_error_ == ESP_OK) {
+      esp_err_t err = esp_ota_write(backend->update_handle_, block.data, block.len);
+      if (err != ESP_OK)
+        backend->write_error_ = err;
+    }
+    xQueueSend(backend->free_queue_, &block.data, portMAX_DELAY);
+  }
+  // Every block has been returned, the null pointer tells stop_writer_() that the buffers can go
+  uint8_t *done = nullptr;
+  xQueueSend(backend->free_queue_, &done, portMAX_DELAY);
+  vTaskDelete(nullptr);
+}
+
+void IDFOTABackend::submit_block_() {
+  WriteBlock block{this->block_, this->block_len_};
+  xQueueSend(this->write_queue_, &block, portMAX_DELAY);
+  this->block_ = nullptr;
+}
+
+void IDFOTABackend::stop_writer_() {
+  if (this->writer_task_ == nullptr)
+    return;
+  if (this->block_ != nullptr) {
+    if (this->block_len_ > 0) {
+      this->submit_block_();
+    } else {
+      xQueueSend(this->free_queue_, &this->block_, 0);
+      this->block_ = nullptr;
+    }
+  }
+  WriteBlock stop{nullptr, 0};
+  xQueueSend(this->write_queue_, &stop, portMAX_DELAY);
+  uint8_t *returned;
+  do {
+    xQueueReceive(this->free_queue_, &returned, portMAX_DELAY);
+  } while (returned != nullptr);
+  this->writer_task_ = nullptr;
+
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  for (auto &buffer : this->buffers_) {
+    allocator.deallocate(buffer, WRITE_BLOCK_SIZE);
+    buffer = nullptr;
+  }
+}
+#endif
+
 }  // namespace ota
 }  // namespace esphome
 #endif
@@ -6,12 +6,18 @@
 #include "esphome/core/defines.h"
 
 #include <esp_ota_ops.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
 
 namespace esphome {
 namespace ota {
 
 class IDFOTABackend : public OTABackend {
  public:
+#ifndef CONFIG_FREERTOS_UNICORE
+  ~IDFOTABackend() override;
+#endif
   OTAResponseTypes begin(size_t image_size) override;
   void set_update_md5(const char *md5) override;
   OTAResponseTypes write(uint8_t *data, size_t len) override;
@@ -20,6 +26,34 @@ class IDFOTABackend : public OTABackend {
   bool supports_compression() override { return false; }
 
  private:
+#ifndef CONFIG_FREERTOS_UNICORE
+  /// Data is collected in blocks of a flash sector. Full blocks are written by a task on the other core, so the next
+  /// block can be received and hashed while the previous one is programmed.
+  static constexpr size_t WRITE_BLOCK_SIZE = 4096;
+  struct WriteBlock {
+    uint8_t *data;
+    size_t len;
+  };
+  static void writer_task(void *arg);
+  bool start_writer_();
+  /// Hand the current block to the writer task.
+  void submit_block_();
+  /// Wait until the writer task has finished all blocks and stop it.
+  void stop_writer_();
+
+  TaskHandle_t writer_task_{nullptr};
+  /// Full blocks for the writer task, a block with a null pointer stops it.
+  QueueHandle_t write_queue_{nullptr};
+  /// Buffers that are free to be filled.
+  QueueHandle_t free_queue_{nullptr};
+  uint8_t *buffers_[2]{};
+  uint8_t *block_{nullptr};
+  size_t block_len_{0};
+  /// First error returned by esp_ota_write() in the writer task.
+  volatile esp_err_t write_error_{ESP_OK};
+#endif
+  OTAResponseTypes write_error_code_(esp_err_t err);
+
   esp_ota_handle_t update_handle_{0};
   const esp_partition_t *partition_;
   md5::MD5Digest md5_{};
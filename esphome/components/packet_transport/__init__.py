@@ -19,6 +19,7 @@ from esphome.const import (
 )
 from esphome.core import CORE
 from esphome.cpp_generator import MockObjClass
+from esphome.helpers import fnv1_hash
 
 CODEOWNERS = ["@clydebarrow"]
 AUTO_LOAD = ["xxtea"]
@@ -31,6 +32,8 @@ IS_PLATFORM_COMPONENT = True
 DOMAIN = "packet_transport"
 CONF_BROADCAST = "broadcast"
 CONF_BROADCAST_ID = "broadcast_id"
+CONF_COALESCE_TIME = "coalesce_time"
+CONF_COMPACT_FORMAT = "compact_format"
 CONF_PROVIDER = "provider"
 CONF_PROVIDERS = "providers"
 CONF_REMOTE_ID = "remote_id"
@@ -83,7 +86,25 @@ PROVIDER_SCHEMA = cv.Schema(
 ).extend(ENCRYPTION_SCHEMA)
 
 
+def broadcast_id(sens_conf) -> str:
+    return sens_conf.get(CONF_BROADCAST_ID, sens_conf[CONF_ID].id)
+
+
+def validate_compact_ids(config):
+    # the compact format identifies sensors only by the hash of their broadcast id
+    for key in (CONF_SENSORS, CONF_BINARY_SENSORS):
+        hashes = {}
+        for name in {broadcast_id(x) for x in config.get(key, ())}:
+            if (other := hashes.setdefault(fnv1_hash(name), name)) != name:
+                raise cv.Invalid(
+                    f"Broadcast ids '{name}' and '{other}' have the same hash, "
+                    f"rename one of them or disable {CONF_COMPACT_FORMAT}"
+                )
+
+
 def validate_(config):
+    if config[CONF_COMPACT_FORMAT]:
+        validate_compact_ids(config)
     if CONF_ENCRYPTION in config:
         if CONF_SENSORS not in config and CONF_BINARY_SENSORS not in config:
             raise cv.Invalid("No sensors or binary sensors to encrypt")
@@ -102,6 +123,10 @@ TRANSPORT_SCHEMA = (
         {
             cv.Optional(CONF_ROLLING_CODE_ENABLE, default=False): cv.boolean,
             cv.Optional(CONF_PING_PONG_ENABLE, default=False): cv.boolean,
+            cv.Optional(CONF_COMPACT_FORMAT, default=False): cv.boolean,
+            cv.Optional(
+                CONF_COALESCE_TIME, default="0ms"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(
                 CONF_PING_PONG_RECYCLE_TIME, default="600s"
             ): cv.positive_time_period_seconds,
@@ -160,6 +185,9 @@ async def register_packet_transport(var, config):
     var = await cg.register_component(var, config)
     cg.add(var.set_rolling_code_enable(config[CONF_ROLLING_CODE_ENABLE]))
     cg.add(var.set_ping_pong_enable(config[CONF_PING_PONG_ENABLE]))
+    if config[CONF_COMPACT_FORMAT]:
+        cg.add(var.set_compact_format(True))
+    cg.add(var.set_coalesce_time(config[CONF_COALESCE_TIME]))
     cg.add(
         var.set_ping_pong_recycle_time(
             config[CONF_PING_PONG_RECYCLE_TIME].total_seconds
@@ -177,15 +205,11 @@ async def register_packet_transport(var, config):
             cg.add(var.set_provider_encryption(name, hash_encryption_key(encryption)))
 
     for sens_conf in config.get(CONF_SENSORS, ()):
-        sens_id = sens_conf[CONF_ID]
-        sensor = await cg.get_variable(sens_id)
-        bcst_id = sens_conf.get(CONF_BROADCAST_ID, sens_id.id)
-        cg.add(var.add_sensor(bcst_id, sensor))
+        sensor = await cg.get_variable(sens_conf[CONF_ID])
+        cg.add(var.add_sensor(broadcast_id(sens_conf), sensor))
     for sens_conf in config.get(CONF_BINARY_SENSORS, ()):
-        sens_id = sens_conf[CONF_ID]
-        sensor = await cg.get_variable(sens_id)
-        bcst_id = sens_conf.get(CONF_BROADCAST_ID, sens_id.id)
-        cg.add(var.add_binary_sensor(bcst_id, sensor))
+        sensor = await cg.get_variable(sens_conf[CONF_ID])
+        cg.add(var.add_binary_sensor(broadcast_id(sens_conf), sensor))
 
     if encryption := config.get(CONF_ENCRYPTION):
         cg.add(var.set_encryption_key(hash_encryption_key(encryption)))
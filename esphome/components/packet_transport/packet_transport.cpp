@@ -4,6 +4,8 @@
 
 #include "esphome/components/xxtea/xxtea.h"
 
+#include <cmath>
+
 namespace esphome {
 namespace packet_transport {
 /**
@@ -35,6 +37,19 @@ namespace packet_transport {
  *      name length: 1 byte
  *      name
  *
+ * With the compact format, sensors are identified by the FNV-1 hash of their name instead:
+ *      SENSOR_HASH_KEY: 1 byte
+ *      name hash: 4 bytes
+ *      float value: 4 bytes
+ * or, for whole numbers that fit into 16 bits:
+ *      SENSOR_HASH_INT16_KEY: 1 byte
+ *      name hash: 4 bytes
+ *      int16 value: 2 bytes
+ * and for binary sensors:
+ *      BINARY_SENSOR_HASH_KEY: 1 byte
+ *      name hash: 4 bytes
+ *      bool value: 1 byte
+ *
  * Padded to a 4 byte boundary with nulls
  *
  * Structure of a ping request packet:
@@ -64,6 +79,9 @@ enum DataKey {
   BINARY_SENSOR_KEY,
   PING_KEY,
   ROLLING_CODE_KEY,
+  SENSOR_HASH_KEY,
+  SENSOR_HASH_INT16_KEY,
+  BINARY_SENSOR_HASH_KEY,
 };
 
 enum DecodeResult {
@@ -192,6 +210,32 @@ static void add(std::vector<uint8_t> &vec, const char *str) {
   }
 }
 
+// Call func for each entry of a sorted remote sensor table with the given id hash.
+template<typename T, typename F> static void for_each_remote(std::vector<T> &table, uint32_t id_hash, F &&func) {
+  auto it = std::lower_bound(table.begin(), table.end(), id_hash,
+                             [](const T &entry, uint32_t hash) { return entry.id_hash < hash; });
+  for (; it != table.end() && it->id_hash == id_hash; it++)
+    func(*it);
+}
+
+// Publish a received value. Packets in the compact format carry no name, so all sensors with the hash match.
+#ifdef USE_SENSOR
+static void publish_remote_sensor(Provider &provider, uint32_t id_hash, const char *name, float value) {
+  for_each_remote(provider.sensors, id_hash, [name, value](RemoteSensor &remote) {
+    if (name == nullptr || strcmp(remote.id, name) == 0)
+      remote.sensor->publish_state(value);
+  });
+}
+#endif
+#ifdef USE_BINARY_SENSOR
+static void publish_remote_binary_sensor(Provider &provider, uint32_t id_hash, const char *name, bool value) {
+  for_each_remote(provider.binary_sensors, id_hash, [name, value](RemoteBinarySensor &remote) {
+    if (name == nullptr || strcmp(remote.id, name) == 0)
+      remote.sensor->publish_state(value);
+  });
+}
+#endif
+
 void PacketTransport::setup() {
   this->name_ = App.get_name().c_str();
   if (strlen(this->name_) > 255) {
@@ -291,6 +335,38 @@ void PacketTransport::add_data_(uint8_t key, const char *id, uint32_t data) {
   add(this->data_, data);
   add(this->data_, id);
 }
+
+void PacketTransport::add_compact_data_(uint32_t id_hash, float data) {
+  // whole numbers are sent as 16 bit integers when they fit, without losing anything
+  bool is_int16 = data >= INT16_MIN && data <= INT16_MAX && data == std::trunc(data);
+  auto len = 1 + 4 + (is_int16 ? 2 : 4);
+  if (len + this->header_.size() + this->data_.size() > this->get_max_packet_size()) {
+    this->flush_();
+    this->init_data_();
+  }
+  if (is_int16) {
+    add(this->data_, SENSOR_HASH_INT16_KEY);
+    add(this->data_, id_hash);
+    add(this->data_, (uint16_t) (int16_t) data);
+  } else {
+    FuData udata{.f32 = data};
+    add(this->data_, SENSOR_HASH_KEY);
+    add(this->data_, id_hash);
+    add(this->data_, udata.u32);
+  }
+}
+
+void PacketTransport::add_compact_binary_data_(uint32_t id_hash, bool data) {
+  auto len = 1 + 4 + 1;
+  if (len + this->header_.size() + this->data_.size() > this->get_max_packet_size()) {
+    this->flush_();
+    this->init_data_();
+  }
+  add(this->data_, BINARY_SENSOR_HASH_KEY);
+  add(this->data_, id_hash);
+  add(this->data_, (uint8_t) data);
+}
+
 void PacketTransport::send_data_(bool all) {
   if (!this->should_send())
     return;
@@ -299,7 +375,11 @@ void PacketTransport::send_data_(bool all) {
   for (auto &sensor : this->sensors_) {
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_data_(SENSOR_KEY, sensor.id, sensor.sensor->get_state());
+      if (this->compact_format_) {
+        this->add_compact_data_(sensor.id_hash, sensor.sensor->get_state());
+      } else {
+        this->add_data_(SENSOR_KEY, sensor.id, sensor.sensor->get_state());
+      }
     }
   }
 #endif
@@ -307,12 +387,18 @@ void PacketTransport::send_data_(bool all) {
   for (auto &sensor : this->binary_sensors_) {
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      if (this->compact_format_) {
+        this->add_compact_binary_data_(sensor.id_hash, sensor.sensor->state);
+      } else {
+        this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      }
     }
   }
 #endif
   this->flush_();
   this->updated_ = false;
+  // until the next update only changed sensors are sent
+  this->resend_data_ = false;
 }
 
 void PacketTransport::update() {
@@ -335,13 +421,13 @@ void PacketTransport::update() {
       }
 #endif
 #ifdef USE_SENSOR
-      for (auto &sensor : this->remote_sensors_[provider.first]) {
-        sensor.second->publish_state(NAN);
+      for (const auto &sensor : provider.second.sensors) {
+        sensor.sensor->publish_state(NAN);
       }
 #endif
 #ifdef USE_BINARY_SENSOR
-      for (auto &sensor : this->remote_binary_sensors_[provider.first]) {
-        sensor.second->invalidate_state();
+      for (const auto &sensor : provider.second.binary_sensors) {
+        sensor.sensor->invalidate_state();
       }
 #endif
     } else {
@@ -428,13 +514,6 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
   }
   ESP_LOGV(TAG, "Found hostname %s", namebuf);
 
-#ifdef USE_SENSOR
-  auto &sensors = this->remote_sensors_[namebuf];
-#endif
-#ifdef USE_BINARY_SENSOR
-  auto &binary_sensors = this->remote_binary_sensors_[namebuf];
-#endif
-
   if (!decoder.bump_to(4)) {
     ESP_LOGW(TAG, "Bad packet length %zu", data.size());
   }
@@ -465,6 +544,8 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     return;
   }
   uint32_t key;
+  uint32_t id_hash;
+  uint16_t int_value;
   while (decoder.get_remaining_size() != 0) {
     if (decoder.decode(ZERO_FILL_KEY) == DECODE_OK)
       continue;
@@ -486,16 +567,41 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     if (decoder.decode(BINARY_SENSOR_KEY, namebuf, sizeof(namebuf), byte) == DECODE_OK) {
       ESP_LOGV(TAG, "Got binary sensor %s %d", namebuf, byte);
 #ifdef USE_BINARY_SENSOR
-      if (binary_sensors.count(namebuf) != 0)
-        binary_sensors[namebuf]->publish_state(byte != 0);
+      publish_remote_binary_sensor(provider, fnv1_hash(namebuf), namebuf, byte != 0);
 #endif
       continue;
     }
     if (decoder.decode(SENSOR_KEY, namebuf, sizeof(namebuf), rdata.u32) == DECODE_OK) {
       ESP_LOGV(TAG, "Got sensor %s %f", namebuf, rdata.f32);
 #ifdef USE_SENSOR
-      if (sensors.count(namebuf) != 0)
-        sensors[namebuf]->publish_state(rdata.f32);
+      publish_remote_sensor(provider, fnv1_hash(namebuf), namebuf, rdata.f32);
+#endif
+      continue;
+    }
+    if (decoder.decode(BINARY_SENSOR_HASH_KEY, id_hash) == DECODE_OK) {
+      if (decoder.get(byte) != DECODE_OK)
+        break;
+      ESP_LOGV(TAG, "Got binary sensor %08X %d", (unsigned) id_hash, byte);
+#ifdef USE_BINARY_SENSOR
+      publish_remote_binary_sensor(provider, id_hash, nullptr, byte != 0);
+#endif
+      continue;
+    }
+    if (decoder.decode(SENSOR_HASH_KEY, id_hash) == DECODE_OK) {
+      if (decoder.get(rdata.u32) != DECODE_OK)
+        break;
+      ESP_LOGV(TAG, "Got sensor %08X %f", (unsigned) id_hash, rdata.f32);
+#ifdef USE_SENSOR
+      publish_remote_sensor(provider, id_hash, nullptr, rdata.f32);
+#endif
+      continue;
+    }
+    if (decoder.decode(SENSOR_HASH_INT16_KEY, id_hash) == DECODE_OK) {
+      if (decoder.get(int_value) != DECODE_OK)
+        break;
+      ESP_LOGV(TAG, "Got sensor %08X %d", (unsigned) id_hash, (int16_t) int_value);
+#ifdef USE_SENSOR
+      publish_remote_sensor(provider, id_hash, nullptr, (int16_t) int_value);
 #endif
       continue;
     }
@@ -513,8 +619,11 @@ void PacketTransport::dump_config() {
                 "Packet Transport:\n"
                 "  Platform: %s\n"
                 "  Encrypted: %s\n"
-                "  Ping-pong: %s",
-                this->platform_name_, YESNO(this->is_encrypted_()), YESNO(this->ping_pong_enable_));
+                "  Ping-pong: %s\n"
+                "  Compact format: %s\n"
+                "  Coalesce time: %" PRIu32 " ms",
+                this->platform_name_, YESNO(this->is_encrypted_()), YESNO(this->ping_pong_enable_),
+                YESNO(this->compact_format_), this->coalesce_time_);
 #ifdef USE_SENSOR
   for (auto sensor : this->sensors_)
     ESP_LOGCONFIG(TAG, "  Sensor: %s", sensor.id);
@@ -527,12 +636,12 @@ void PacketTransport::dump_config() {
     ESP_LOGCONFIG(TAG, "  Remote host: %s", host.first.c_str());
     ESP_LOGCONFIG(TAG, "    Encrypted: %s", YESNO(!host.second.encryption_key.empty()));
 #ifdef USE_SENSOR
-    for (const auto &sensor : this->remote_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.sensors)
+      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.id);
 #endif
 #ifdef USE_BINARY_SENSOR
-    for (const auto &sensor : this->remote_binary_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.binary_sensors)
+      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.id);
 #endif
   }
 }
@@ -551,7 +660,16 @@ void PacketTransport::loop() {
   if (this->resend_ping_key_)
     this->send_ping_pong_request_();
   if (this->updated_) {
-    this->send_data_(this->resend_data_);
+    // changes arriving within the coalesce time share a packet
+    auto now = millis();
+    if (!this->send_pending_) {
+      this->send_pending_ = true;
+      this->first_update_time_ = now;
+    }
+    if (now - this->first_update_time_ >= this->coalesce_time_) {
+      this->send_pending_ = false;
+      this->send_data_(this->resend_data_);
+    }
   }
 }
 
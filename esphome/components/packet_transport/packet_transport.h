@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
 #ifdef USE_SENSOR
 #include "esphome/components/sensor/sensor.h"
@@ -9,6 +10,7 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 
+#include <algorithm>
 #include <vector>
 #include <map>
 
@@ -23,31 +25,57 @@
 namespace esphome {
 namespace packet_transport {
 
-struct Provider {
-  std::vector<uint8_t> encryption_key;
-  const char *name;
-  uint32_t last_code[2];
-  uint32_t last_key_response_time;
-#ifdef USE_STATUS_SENSOR
-  binary_sensor::BinarySensor *status_sensor{nullptr};
-#endif
-};
-
 #ifdef USE_SENSOR
 struct Sensor {
   sensor::Sensor *sensor;
   const char *id;
+  uint32_t id_hash;
   bool updated;
 };
+struct RemoteSensor {
+  uint32_t id_hash;
+  const char *id;
+  sensor::Sensor *sensor;
+};
 #endif
 #ifdef USE_BINARY_SENSOR
 struct BinarySensor {
   binary_sensor::BinarySensor *sensor;
   const char *id;
+  uint32_t id_hash;
   bool updated;
 };
+struct RemoteBinarySensor {
+  uint32_t id_hash;
+  const char *id;
+  binary_sensor::BinarySensor *sensor;
+};
 #endif
 
+struct Provider {
+  std::vector<uint8_t> encryption_key;
+  const char *name;
+  uint32_t last_code[2];
+  uint32_t last_key_response_time;
+#ifdef USE_STATUS_SENSOR
+  binary_sensor::BinarySensor *status_sensor{nullptr};
+#endif
+  // Remote sensors of this provider, sorted by the hash of their id.
+#ifdef USE_SENSOR
+  std::vector<RemoteSensor> sensors;
+#endif
+#ifdef USE_BINARY_SENSOR
+  std::vector<RemoteBinarySensor> binary_sensors;
+#endif
+};
+
+// Insert into a table of remote sensors, keeping it sorted by id hash.
+template<typename T> void insert_sorted(std::vector<T> &table, const T &entry) {
+  auto it = std::upper_bound(table.begin(), table.end(), entry.id_hash,
+                             [](uint32_t id_hash, const T &other) { return id_hash < other.id_hash; });
+  table.insert(it, entry);
+}
+
 class PacketTransport : public PollingComponent {
  public:
   void setup() override;
@@ -57,23 +85,24 @@ class PacketTransport : public PollingComponent {
 
 #ifdef USE_SENSOR
   void add_sensor(const char *id, sensor::Sensor *sensor) {
-    Sensor st{sensor, id, true};
+    Sensor st{sensor, id, fnv1_hash(id), true};
     this->sensors_.push_back(st);
   }
   void add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor) {
     this->add_provider(hostname);
-    this->remote_sensors_[hostname][remote_id] = sensor;
+    insert_sorted(this->providers_[hostname].sensors, RemoteSensor{fnv1_hash(remote_id), remote_id, sensor});
   }
 #endif
 #ifdef USE_BINARY_SENSOR
   void add_binary_sensor(const char *id, binary_sensor::BinarySensor *sensor) {
-    BinarySensor st{sensor, id, true};
+    BinarySensor st{sensor, id, fnv1_hash(id), true};
     this->binary_sensors_.push_back(st);
   }
 
   void add_remote_binary_sensor(const char *hostname, const char *remote_id, binary_sensor::BinarySensor *sensor) {
     this->add_provider(hostname);
-    this->remote_binary_sensors_[hostname][remote_id] = sensor;
+    insert_sorted(this->providers_[hostname].binary_sensors,
+                  RemoteBinarySensor{fnv1_hash(remote_id), remote_id, sensor});
   }
 #endif
 
@@ -82,18 +111,16 @@ class PacketTransport : public PollingComponent {
       Provider provider{};
       provider.name = hostname;
       this->providers_[hostname] = provider;
-#ifdef USE_SENSOR
-      this->remote_sensors_[hostname] = std::map<std::string, sensor::Sensor *>();
-#endif
-#ifdef USE_BINARY_SENSOR
-      this->remote_binary_sensors_[hostname] = std::map<std::string, binary_sensor::BinarySensor *>();
-#endif
     }
   }
 
   void set_encryption_key(std::vector<uint8_t> key) { this->encryption_key_ = std::move(key); }
   void set_rolling_code_enable(bool enable) { this->rolling_code_enable_ = enable; }
   void set_ping_pong_enable(bool enable) { this->ping_pong_enable_ = enable; }
+  /// Send sensors by the hash of their id instead of the id itself. Requires receivers that understand it.
+  void set_compact_format(bool compact_format) { this->compact_format_ = compact_format; }
+  /// Wait this long after a sensor changes before sending, so other changes can go in the same packet.
+  void set_coalesce_time(uint32_t coalesce_time) { this->coalesce_time_ = coalesce_time; }
   void set_ping_pong_recycle_time(uint32_t recycle_time) { this->ping_pong_recyle_time_ = recycle_time; }
   void set_provider_encryption(const char *name, std::vector<uint8_t> key) {
     this->providers_[name].encryption_key = std::move(key);
@@ -119,6 +146,8 @@ class PacketTransport : public PollingComponent {
   void add_data_(uint8_t key, const char *id, uint32_t data);
   void increment_code_();
   void add_binary_data_(uint8_t key, const char *id, bool data);
+  void add_compact_data_(uint32_t id_hash, float data);
+  void add_compact_binary_data_(uint32_t id_hash, bool data);
   void init_data_();
 
   bool updated_{};
@@ -126,10 +155,15 @@ class PacketTransport : public PollingComponent {
   uint32_t rolling_code_[2]{};
   bool rolling_code_enable_{};
   bool ping_pong_enable_{};
+  bool compact_format_{};
   uint32_t ping_pong_recyle_time_{};
   uint32_t last_key_time_{};
   bool resend_ping_key_{};
+  // send all sensors with the next packet instead of only the changed ones, set on each update
   bool resend_data_{};
+  bool send_pending_{};
+  uint32_t first_update_time_{};
+  uint32_t coalesce_time_{};
   const char *name_{};
   ESPPreferenceObject pref_{};
 
@@ -137,11 +171,9 @@ class PacketTransport : public PollingComponent {
 
 #ifdef USE_SENSOR
   std::vector<Sensor> sensors_{};
-  std::map<std::string, std::map<std::string, sensor::Sensor *>> remote_sensors_{};
 #endif
 #ifdef USE_BINARY_SENSOR
   std::vector<BinarySensor> binary_sensors_{};
-  std::map<std::string, std::map<std::string, binary_sensor::BinarySensor *>> remote_binary_sensors_{};
 #endif
 
   std::map<std::string, Provider> providers_{};
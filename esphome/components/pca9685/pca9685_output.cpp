@@ -99,12 +99,30 @@ void PCA9685Output::dump_config() {
 }
 
 void PCA9685Output::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  if (this->min_channel_ == 0xFF || this->dirty_ == 0)
     return;
 
   const uint16_t num_channels = this->max_channel_ - this->min_channel_ + 1;
   const uint16_t phase_delta_begin = 4096 / num_channels;
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
+  // Changed channels next to each other are written in one transfer, the register address increments by itself
+  uint8_t data[4 * 16];
+  uint8_t run_start = 0;
+  size_t run_bytes = 0;
+  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_ + 1; channel++) {
+    if (channel > this->max_channel_ || (this->dirty_ & (1 << channel)) == 0) {
+      if (run_bytes != 0) {
+        uint8_t reg = PCA9685_REGISTER_LED0 + 4 * run_start;
+        if (!this->write_bytes(reg, data, run_bytes)) {
+          this->status_set_warning();
+          return;
+        }
+        run_bytes = 0;
+      }
+      continue;
+    }
+    if (run_bytes == 0)
+      run_start = channel;
+
     uint16_t phase_begin = (channel - this->min_channel_) * phase_delta_begin;
     uint16_t phase_end;
     uint16_t amount = this->pwm_amounts_[channel];
@@ -122,21 +140,14 @@ void PCA9685Output::loop() {
     ESP_LOGVV(TAG, "Channel %02u: amount=%04u phase_begin=%04u phase_end=%04u", channel, amount, phase_begin,
               phase_end);
 
-    uint8_t data[4];
-    data[0] = phase_begin & 0xFF;
-    data[1] = (phase_begin >> 8) & 0xFF;
-    data[2] = phase_end & 0xFF;
-    data[3] = (phase_end >> 8) & 0xFF;
-
-    uint8_t reg = PCA9685_REGISTER_LED0 + 4 * channel;
-    if (!this->write_bytes(reg, data, 4)) {
-      this->status_set_warning();
-      return;
-    }
+    data[run_bytes++] = phase_begin & 0xFF;
+    data[run_bytes++] = (phase_begin >> 8) & 0xFF;
+    data[run_bytes++] = phase_end & 0xFF;
+    data[run_bytes++] = (phase_end >> 8) & 0xFF;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->dirty_ = 0;
 }
 
 void PCA9685Output::register_channel(PCA9685Channel *channel) {
@@ -53,7 +53,7 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
 
   void set_channel_value_(uint8_t channel, uint16_t value) {
     if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
+      this->dirty_ |= 1 << channel;
     this->pwm_amounts_[channel] = value;
   }
 
@@ -66,7 +66,8 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
   uint16_t pwm_amounts_[16] = {
       0,
   };
-  bool update_{true};
+  /// Channels whose value changed since they were last written, all of them before the first write.
+  uint16_t dirty_{0xFFFF};
 };
 
 }  // namespace pca9685
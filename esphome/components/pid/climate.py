@@ -30,6 +30,7 @@ CONF_MIN_INTEGRAL = "min_integral"
 CONF_MAX_INTEGRAL = "max_integral"
 CONF_OUTPUT_AVERAGING_SAMPLES = "output_averaging_samples"
 CONF_DERIVATIVE_AVERAGING_SAMPLES = "derivative_averaging_samples"
+CONF_CONTROL_INTERVAL = "control_interval"
 
 # Deadband parameters
 CONF_DEADBAND_PARAMETERS = "deadband_parameters"
@@ -48,6 +49,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_DEFAULT_TARGET_TEMPERATURE): cv.temperature,
             cv.Optional(CONF_COOL_OUTPUT): cv.use_id(output.FloatOutput),
             cv.Optional(CONF_HEAT_OUTPUT): cv.use_id(output.FloatOutput),
+            cv.Optional(CONF_CONTROL_INTERVAL): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=1)),
+            ),
             cv.Optional(CONF_DEADBAND_PARAMETERS): cv.Schema(
                 {
                     cv.Required(CONF_THRESHOLD_HIGH): cv.temperature,
@@ -95,6 +100,8 @@ async def to_code(config):
     if CONF_HEAT_OUTPUT in config:
         out = await cg.get_variable(config[CONF_HEAT_OUTPUT])
         cg.add(var.set_heat_output(out))
+    if CONF_CONTROL_INTERVAL in config:
+        cg.add(var.set_control_interval(config[CONF_CONTROL_INTERVAL]))
     params = config[CONF_CONTROL_PARAMETERS]
     cg.add(var.set_kp(params[CONF_KP]))
     cg.add(var.set_ki(params[CONF_KI]))
@@ -1,6 +1,8 @@
 #include "pid_climate.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace pid {
 
@@ -9,12 +11,24 @@ static const char *const TAG = "pid.climate";
 void PIDClimate::setup() {
   this->sensor_->add_on_state_callback([this](float state) {
     // only publish if state/current temperature has changed in two digits of precision
-    this->do_publish_ = roundf(state * 100) != roundf(this->current_temperature * 100);
+    bool changed = roundf(state * 100) != roundf(this->current_temperature * 100);
     this->current_temperature = state;
+    if (this->control_interval_ != 0) {
+      // Picked up by the next control tick, which also publishes the change
+      this->do_publish_ |= changed;
+      return;
+    }
+    this->do_publish_ = changed;
     this->update_pid_();
   });
   this->current_temperature = this->sensor_->state;
 
+  if (this->control_interval_ != 0) {
+    // Every step covers exactly one period, so loop jitter does not end up in the integral and derivative terms
+    this->controller_.fixed_dt_ = this->control_interval_ / 1000.0f;
+    this->set_interval("control", this->control_interval_, [this]() { this->update_pid_(); });
+  }
+
   // register for humidity values and get initial state
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
@@ -77,6 +91,9 @@ void PIDClimate::dump_config() {
                 "  Control Parameters:\n"
                 "    kp: %.5f, ki: %.5f, kd: %.5f, output samples: %d",
                 controller_.kp_, controller_.ki_, controller_.kd_, controller_.output_samples_);
+  if (this->control_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Control Interval: %" PRIu32 " ms", this->control_interval_);
+  }
 
   if (controller_.threshold_low_ == 0 && controller_.threshold_high_ == 0) {
     ESP_LOGCONFIG(TAG, "  Deadband disabled.");
@@ -156,8 +173,10 @@ void PIDClimate::update_pid_() {
     this->write_output_(value);
   }
 
-  if (this->do_publish_)
+  if (this->do_publish_) {
     this->publish_state();
+    this->do_publish_ = false;
+  }
 }
 void PIDClimate::start_autotune(std::unique_ptr<PIDAutotuner> &&autotune) {
   this->autotuner_ = std::move(autotune);
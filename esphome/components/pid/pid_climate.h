@@ -22,6 +22,8 @@ class PIDClimate : public climate::Climate, public Component {
   void set_humidity_sensor(sensor::Sensor *sensor) { humidity_sensor_ = sensor; }
   void set_cool_output(output::FloatOutput *cool_output) { cool_output_ = cool_output; }
   void set_heat_output(output::FloatOutput *heat_output) { heat_output_ = heat_output; }
+  /// Evaluate the controller every \p control_interval ms with the latest reading instead of on each reading.
+  void set_control_interval(uint32_t control_interval) { control_interval_ = control_interval; }
   void set_kp(float kp) { controller_.kp_ = kp; }
   void set_ki(float ki) { controller_.ki_ = ki; }
   void set_kd(float kd) { controller_.kd_ = kd; }
@@ -98,6 +100,8 @@ class PIDClimate : public climate::Climate, public Component {
   CallbackManager<void()> pid_computed_callback_;
   float default_target_temperature_;
   std::unique_ptr<PIDAutotuner> autotuner_;
+  /// Fixed control period in ms, 0 to run the controller on each sensor reading
+  uint32_t control_interval_{0};
   bool do_publish_ = false;
 };
 
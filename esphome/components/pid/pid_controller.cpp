@@ -122,6 +122,8 @@ float PIDController::calculate_relative_time_() {
     return 0.0f;
   }
   last_time_ = now;
+  if (fixed_dt_ != 0.0f)
+    return fixed_dt_;
   return dt / 1000.0f;
 }
 
@@ -40,6 +40,9 @@ struct PIDController {
   float min_integral_ = NAN;
   float max_integral_ = NAN;
 
+  /// Time step in seconds used instead of the measured one when running at a fixed rate, 0 to measure
+  float fixed_dt_ = 0.0f;
+
   // Store computed values in struct so that values can be monitored through sensors
   float error_;
   float dt_;
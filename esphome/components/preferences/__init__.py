@@ -7,11 +7,14 @@ CODEOWNERS = ["@esphome/core"]
 preferences_ns = cg.esphome_ns.namespace("preferences")
 IntervalSyncer = preferences_ns.class_("IntervalSyncer", cg.Component)
 
+CONF_FLASH_WRITE_BUDGET = "flash_write_budget"
 CONF_FLASH_WRITE_INTERVAL = "flash_write_interval"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(IntervalSyncer),
         cv.Optional(CONF_FLASH_WRITE_INTERVAL, default="60s"): cv.update_interval,
+        # Bytes of preference data per minute, enables write-behind batching
+        cv.Optional(CONF_FLASH_WRITE_BUDGET): cv.int_range(min=1),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -19,4 +22,6 @@ CONFIG_SCHEMA = cv.Schema(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_write_interval(config[CONF_FLASH_WRITE_INTERVAL]))
+    if CONF_FLASH_WRITE_BUDGET in config:
+        cg.add(var.set_write_budget(config[CONF_FLASH_WRITE_BUDGET]))
     await cg.register_component(var, config)
@@ -2,6 +2,8 @@
 
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "write_behind.h"
 
 namespace esphome {
 namespace preferences {
@@ -9,22 +11,37 @@ namespace preferences {
 class IntervalSyncer : public Component {
  public:
   void set_write_interval(uint32_t write_interval) { this->write_interval_ = write_interval; }
+  /// Put a WriteBehindPreferences layer with the given flash write budget in front of the platform preferences.
+  /// Must be called before any preference is created.
+  void set_write_budget(uint32_t bytes_per_minute) {
+    this->write_behind_ = new WriteBehindPreferences(global_preferences, bytes_per_minute);  // NOLINT
+    global_preferences = this->write_behind_;
+  }
   void setup() override {
     if (this->write_interval_ != 0) {
-      set_interval(this->write_interval_, []() { global_preferences->sync(); });
+      set_interval(this->write_interval_, [this]() { this->sync_(); });
       // When using interval-based syncing, we don't need the loop
       this->disable_loop();
     }
   }
   void loop() override {
     if (this->write_interval_ == 0) {
-      global_preferences->sync();
+      this->sync_();
     }
   }
   void on_shutdown() override { global_preferences->sync(); }
   float get_setup_priority() const override { return setup_priority::BUS; }
 
  protected:
+  void sync_() {
+    if (this->write_behind_ != nullptr) {
+      this->write_behind_->flush(millis());
+    } else {
+      global_preferences->sync();
+    }
+  }
+
+  WriteBehindPreferences *write_behind_{nullptr};
   uint32_t write_interval_{60000};
 };
 
@@ -0,0 +1,129 @@
+#include "write_behind.h"
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace preferences {
+
+static const char *const TAG = "preferences.write_behind";
+
+// FNV-1a over the preference payload
+static uint32_t payload_hash(const uint8_t *data, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+bool WriteBehindBackend::save(const uint8_t *data, size_t len) {
+  if (this->data_ == nullptr || this->len_ != len) {
+    this->data_ = std::make_unique<uint8_t[]>(len);
+    this->len_ = len;
+  }
+  memcpy(this->data_.get(), data, len);
+  this->dirty_ = !this->persisted_known_ || payload_hash(data, len) != this->persisted_hash_;
+  return true;
+}
+
+bool WriteBehindBackend::load(uint8_t *data, size_t len) {
+  if (this->data_ != nullptr) {
+    if (this->len_ != len)
+      return false;
+    memcpy(data, this->data_.get(), len);
+    return true;
+  }
+  if (!this->inner_->load(data, len))
+    return false;
+  // Remember what is stored, saving the same value back is a no-op
+  this->persisted_hash_ = payload_hash(data, len);
+  this->persisted_known_ = true;
+  return true;
+}
+
+ESPPreferenceObject WriteBehindPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  ESPPreferenceObject inner = this->inner_->make_preference(length, type, in_flash);
+  ESPPreferenceBackend *inner_backend = inner.get_backend();
+#ifdef USE_ESP8266
+  // RTC memory does not wear out, keep writing it directly
+  if (!in_flash)
+    return inner;
+#endif
+  if (inner_backend == nullptr)
+    return inner;
+  auto *pref = new WriteBehindBackend(inner_backend);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->backends_.push_back(pref);
+  return ESPPreferenceObject(pref);
+}
+
+ESPPreferenceObject WriteBehindPreferences::make_preference(size_t length, uint32_t type) {
+#if defined(USE_ESP8266) && !defined(USE_ESP8266_PREFERENCES_FLASH)
+  return this->make_preference(length, type, false);
+#else
+  return this->make_preference(length, type, true);
+#endif
+}
+
+bool WriteBehindPreferences::write_dirty_(bool budgeted) {
+  size_t written = 0, bytes = 0, deferred = 0;
+  bool ok = true;
+  for (auto *pref : this->backends_) {
+    if (!pref->dirty_)
+      continue;
+    if (budgeted && this->tokens_ <= 0) {
+      deferred++;
+      continue;
+    }
+    if (!pref->inner_->save(pref->data_.get(), pref->len_)) {
+      ok = false;
+      continue;
+    }
+    pref->persisted_hash_ = payload_hash(pref->data_.get(), pref->len_);
+    pref->persisted_known_ = true;
+    pref->dirty_ = false;
+    written++;
+    bytes += pref->len_;
+    if (budgeted)
+      this->tokens_ -= static_cast<int32_t>(pref->len_);
+  }
+  if (written != 0 || deferred != 0) {
+    ESP_LOGD(TAG, "Writing %zu preferences (%zu bytes), %zu deferred by the write budget", written, bytes, deferred);
+  }
+  // One commit for the whole batch. A direct sync() always commits, like the wrapped backend would.
+  if (written == 0 && budgeted && !this->commit_failed_)
+    return ok;
+  this->commit_failed_ = !this->inner_->sync();
+  return !this->commit_failed_ && ok;
+}
+
+bool WriteBehindPreferences::flush(uint32_t now) {
+  // Refill the budget for the time since the last flush, up to one minute worth of bytes
+  const uint32_t elapsed = now - this->last_refill_;
+  const uint64_t refill = static_cast<uint64_t>(elapsed) * this->bytes_per_minute_ / 60000;
+  if (refill != 0) {
+    const int64_t tokens = this->tokens_ + static_cast<int64_t>(refill);
+    this->tokens_ = static_cast<int32_t>(std::min<int64_t>(tokens, this->bytes_per_minute_));
+    // Only advance by the time that was converted to bytes, to not lose fractions on frequent flushes
+    this->last_refill_ += static_cast<uint32_t>(refill * 60000 / this->bytes_per_minute_);
+  }
+  return this->write_dirty_(true);
+}
+
+bool WriteBehindPreferences::sync() { return this->write_dirty_(false); }
+
+bool WriteBehindPreferences::reset() {
+  for (auto *pref : this->backends_) {
+    pref->data_.reset();
+    pref->len_ = 0;
+    pref->persisted_known_ = false;
+    pref->dirty_ = false;
+  }
+  return this->inner_->reset();
+}
+
+}  // namespace preferences
+}  // namespace esphome
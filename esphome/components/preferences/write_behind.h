@@ -0,0 +1,70 @@
+#pragma once
+
+#include "esphome/core/preferences.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace preferences {
+
+class WriteBehindPreferences;
+
+/// RAM copy of one preference, written to the wrapped backend when WriteBehindPreferences flushes.
+class WriteBehindBackend : public ESPPreferenceBackend {
+ public:
+  explicit WriteBehindBackend(ESPPreferenceBackend *inner) : inner_(inner) {}
+
+  bool save(const uint8_t *data, size_t len) override;
+  bool load(uint8_t *data, size_t len) override;
+
+ protected:
+  friend class WriteBehindPreferences;
+
+  ESPPreferenceBackend *inner_;
+  std::unique_ptr<uint8_t[]> data_;
+  size_t len_{0};
+  // Hash of the value the wrapped backend holds
+  uint32_t persisted_hash_{0};
+  bool persisted_known_{false};
+  bool dirty_{false};
+};
+
+/** Write-behind layer on top of the platform preferences.
+ *
+ * Saves only update a RAM copy of the preference. Repeated saves of the same key coalesce, and saving the
+ * value that was last persisted (compared by hash) clears the pending write instead of adding one.
+ * flush() writes dirty preferences to the platform backend in registration order and commits them with a
+ * single sync(), spending at most `bytes_per_minute` of payload on average. Anything over the budget
+ * stays dirty for the next flush. A direct sync() (used before reboots, by factory reset, etc.) still
+ * writes everything at once.
+ */
+class WriteBehindPreferences : public ESPPreferences {
+ public:
+  WriteBehindPreferences(ESPPreferences *inner, uint32_t bytes_per_minute)
+      : inner_(inner), bytes_per_minute_(bytes_per_minute), tokens_(bytes_per_minute) {}
+
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override;
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
+  bool sync() override;
+  bool reset() override;
+
+  /// Write dirty preferences within the budget. Call periodically, `now` is millis().
+  bool flush(uint32_t now);
+
+ protected:
+  bool write_dirty_(bool budgeted);
+
+  ESPPreferences *inner_;
+  std::vector<WriteBehindBackend *> backends_;
+  uint32_t bytes_per_minute_;
+  // Byte budget available now, may go negative when a single preference is larger than what is left
+  int32_t tokens_;
+  uint32_t last_refill_{0};
+  // Retry the commit on the next flush even if nothing new was written
+  bool commit_failed_{false};
+};
+
+}  // namespace preferences
+}  // namespace esphome
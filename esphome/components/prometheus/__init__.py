@@ -7,6 +7,9 @@ from esphome.cpp_types import EntityBase
 
 AUTO_LOAD = ["web_server_base"]
 
+CONF_CACHE_MAX_AGE = "cache_max_age"
+CONF_GZIP = "gzip"
+
 prometheus_ns = cg.esphome_ns.namespace("prometheus")
 PrometheusHandler = prometheus_ns.class_("PrometheusHandler", cg.Component)
 
@@ -25,6 +28,8 @@ CONFIG_SCHEMA = cv.Schema(
             web_server_base.WebServerBase
         ),
         cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+        cv.Optional(CONF_CACHE_MAX_AGE): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_GZIP, default=False): cv.boolean,
         cv.Optional(CONF_RELABEL, default={}): cv.Schema(
             {
                 cv.use_id(EntityBase): CUSTOMIZED_ENTITY,
@@ -43,6 +48,10 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if CONF_CACHE_MAX_AGE in config:
+        cg.add(var.set_cache_max_age(config[CONF_CACHE_MAX_AGE]))
+    if config[CONF_GZIP]:
+        cg.add_define("USE_PROMETHEUS_GZIP")
 
     for key, value in config[CONF_RELABEL].items():
         entity = await cg.get_variable(key)
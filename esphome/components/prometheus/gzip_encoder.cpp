@@ -0,0 +1,170 @@
+#include "gzip_encoder.h"
+#include "esphome/core/defines.h"
+#ifdef USE_PROMETHEUS_GZIP
+
+#include <algorithm>
+
+namespace esphome {
+namespace prometheus {
+
+// Deflate length codes 257..285 (RFC 1951 3.2.5)
+static const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                         31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+// Deflate distance codes 0..29
+static const uint16_t DISTANCE_BASE[30] = {1,   2,   3,   4,   5,   7,    9,    13,   17,   25,
+                                           33,  49,  65,  97,  129, 193,  257,  385,  513,  769,
+                                           1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                           6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+static const uint8_t GZIP_HEADER[10] = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF};
+
+// CRC-32 (IEEE 802.3) one nibble at a time, a 16 entry table instead of 1 kB
+static const uint32_t CRC32_NIBBLE[16] = {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+                                          0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                          0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+GzipEncoder::GzipEncoder(sink_t sink, void *arg) : sink_(sink), arg_(arg) {
+  for (uint8_t byte : GZIP_HEADER)
+    this->put_byte_(byte);
+  // One open fixed Huffman block (BFINAL = 0, BTYPE = 01) that runs until finish()
+  this->put_bits_(0b010, 3);
+}
+
+void GzipEncoder::write(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    size_t piece = std::min(len, MAX_PIECE);
+    this->compress_piece_(data, piece);
+    data += piece;
+    len -= piece;
+  }
+}
+
+void GzipEncoder::finish() {
+  // End of the open block, then an empty final block
+  this->put_code_(0, 7);
+  this->put_bits_(0b011, 3);
+  this->put_code_(0, 7);
+  if (this->bit_count_ > 0)
+    this->put_bits_(0, 8 - this->bit_count_);
+
+  uint32_t crc = ~this->crc_;
+  for (uint8_t i = 0; i < 4; i++)
+    this->put_byte_(crc >> (i * 8));
+  for (uint8_t i = 0; i < 4; i++)
+    this->put_byte_(this->pos_ >> (i * 8));
+  this->flush_out_();
+}
+
+uint32_t GzipEncoder::hash_(uint32_t pos) const {
+  uint32_t v = this->window_[pos & WINDOW_MASK] | (this->window_[(pos + 1) & WINDOW_MASK] << 8) |
+               (this->window_[(pos + 2) & WINDOW_MASK] << 16);
+  return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void GzipEncoder::compress_piece_(const uint8_t *data, size_t len) {
+  // The piece is copied into the window first, it only overwrites bytes older than MAX_DISTANCE
+  for (size_t i = 0; i < len; i++) {
+    uint8_t byte = data[i];
+    this->window_[(this->pos_ + i) & WINDOW_MASK] = byte;
+    this->crc_ ^= byte;
+    this->crc_ = (this->crc_ >> 4) ^ CRC32_NIBBLE[this->crc_ & 0x0F];
+    this->crc_ = (this->crc_ >> 4) ^ CRC32_NIBBLE[this->crc_ & 0x0F];
+  }
+
+  const uint32_t end = this->pos_ + len;
+  uint32_t pos = this->pos_;
+  while (pos < end) {
+    uint32_t match_len = 0;
+    uint32_t distance = 0;
+    if (end - pos >= MIN_MATCH) {
+      uint32_t hash = this->hash_(pos);
+      distance = static_cast<uint16_t>(pos - this->head_[hash]);
+      this->head_[hash] = static_cast<uint16_t>(pos);
+      if (distance != 0 && distance <= MAX_DISTANCE && distance <= pos) {
+        const uint32_t max_len = std::min<uint32_t>(end - pos, MAX_MATCH);
+        const uint32_t from = pos - distance;
+        while (match_len < max_len &&
+               this->window_[(from + match_len) & WINDOW_MASK] == this->window_[(pos + match_len) & WINDOW_MASK])
+          match_len++;
+      }
+    }
+
+    if (match_len >= MIN_MATCH) {
+      this->put_match_(match_len, distance);
+      // Remember the positions inside the match as well, that is where the next line repeats the labels
+      for (uint32_t i = 1; i < match_len && pos + i + MIN_MATCH <= end; i++)
+        this->head_[this->hash_(pos + i)] = static_cast<uint16_t>(pos + i);
+      pos += match_len;
+    } else {
+      this->put_literal_(this->window_[pos & WINDOW_MASK]);
+      pos++;
+    }
+  }
+  this->pos_ = end;
+}
+
+void GzipEncoder::put_bits_(uint32_t value, uint8_t count) {
+  this->bit_buffer_ |= value << this->bit_count_;
+  this->bit_count_ += count;
+  while (this->bit_count_ >= 8) {
+    this->put_byte_(this->bit_buffer_ & 0xFF);
+    this->bit_buffer_ >>= 8;
+    this->bit_count_ -= 8;
+  }
+}
+
+void GzipEncoder::put_code_(uint32_t code, uint8_t count) {
+  uint32_t reversed = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    reversed = (reversed << 1) | (code & 1);
+    code >>= 1;
+  }
+  this->put_bits_(reversed, count);
+}
+
+void GzipEncoder::put_literal_(uint8_t literal) {
+  if (literal < 144) {
+    this->put_code_(0x30 + literal, 8);
+  } else {
+    this->put_code_(0x190 + literal - 144, 9);
+  }
+}
+
+void GzipEncoder::put_match_(uint32_t length, uint32_t distance) {
+  uint8_t code = 28;
+  while (LENGTH_BASE[code] > length)
+    code--;
+  uint32_t symbol = 257 + code;
+  if (symbol < 280) {
+    this->put_code_(symbol - 256, 7);
+  } else {
+    this->put_code_(0xC0 + symbol - 280, 8);
+  }
+  this->put_bits_(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+  code = 29;
+  while (DISTANCE_BASE[code] > distance)
+    code--;
+  this->put_code_(code, 5);
+  this->put_bits_(distance - DISTANCE_BASE[code], DISTANCE_EXTRA[code]);
+}
+
+void GzipEncoder::put_byte_(uint8_t byte) {
+  this->out_[this->out_len_++] = byte;
+  if (this->out_len_ == OUT_SIZE)
+    this->flush_out_();
+}
+
+void GzipEncoder::flush_out_() {
+  if (this->out_len_ == 0)
+    return;
+  this->sink_(this->arg_, this->out_, this->out_len_);
+  this->out_len_ = 0;
+}
+
+}  // namespace prometheus
+}  // namespace esphome
+#endif  // USE_PROMETHEUS_GZIP
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace prometheus {
+
+/** Incremental gzip (RFC 1952) encoder with a bounded memory footprint.
+ *
+ * Deflate uses the fixed Huffman codes and a small LZ77 window. That gives up some ratio against zlib, but the metrics
+ * text repeats the same labels on every line, so most of it is still replaced by short back references. The encoder
+ * needs about 6 kB no matter how large the body is and hands its output to the sink in small pieces.
+ */
+class GzipEncoder {
+ public:
+  using sink_t = void (*)(void *arg, const uint8_t *data, size_t len);
+
+  GzipEncoder(sink_t sink, void *arg);
+
+  /// Compress the next part of the input.
+  void write(const uint8_t *data, size_t len);
+  /// Terminate the deflate stream and write the gzip trailer.
+  void finish();
+
+ protected:
+  static constexpr size_t WINDOW_SIZE = 4096;
+  static constexpr uint32_t WINDOW_MASK = WINDOW_SIZE - 1;
+  /// Input is compressed in pieces of at most this size, back references only reach as far as the rest of the window.
+  static constexpr size_t MAX_PIECE = 512;
+  static constexpr uint32_t MAX_DISTANCE = WINDOW_SIZE - MAX_PIECE;
+  static constexpr size_t HASH_BITS = 10;
+  static constexpr size_t MIN_MATCH = 3;
+  static constexpr size_t MAX_MATCH = 258;
+  static constexpr size_t OUT_SIZE = 128;
+
+  void compress_piece_(const uint8_t *data, size_t len);
+  uint32_t hash_(uint32_t pos) const;
+  void put_bits_(uint32_t value, uint8_t count);
+  /// Write a fixed Huffman code, which deflate stores most significant bit first.
+  void put_code_(uint32_t code, uint8_t count);
+  void put_literal_(uint8_t literal);
+  void put_match_(uint32_t length, uint32_t distance);
+  void put_byte_(uint8_t byte);
+  void flush_out_();
+
+  sink_t sink_;
+  void *arg_;
+  uint32_t crc_{0xFFFFFFFF};
+  /// Number of input bytes so far, also the position of the next byte in window_.
+  uint32_t pos_{0};
+  uint32_t bit_buffer_{0};
+  uint8_t bit_count_{0};
+  size_t out_len_{0};
+  uint8_t out_[OUT_SIZE];
+  /// Last position of every 3 byte hash, truncated to 16 bits. Candidates are verified against the window.
+  uint16_t head_[1 << HASH_BITS]{};
+  uint8_t window_[WINDOW_SIZE];
+};
+
+}  // namespace prometheus
+}  // namespace esphome
@@ -2,100 +2,301 @@
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace prometheus {
 
+static const char *const CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+
+void MetricsStream::write(const char *data, size_t len) {
+  while (len > 0) {
+    size_t n = std::min(len, CHUNK_SIZE - this->len_);
+    memcpy(this->chunk_ + this->len_, data, n);
+    this->len_ += n;
+    data += n;
+    len -= n;
+    if (this->len_ == CHUNK_SIZE)
+      this->flush();
+  }
+}
+
+#ifdef USE_ARDUINO
+void MetricsStream::print(const __FlashStringHelper *str) {
+#ifdef USE_ESP8266
+  // Flash strings have to be copied out with the _P functions
+  PGM_P p = reinterpret_cast<PGM_P>(str);
+  size_t len = strlen_P(p);
+  while (len > 0) {
+    size_t n = std::min(len, CHUNK_SIZE - this->len_);
+    memcpy_P(this->chunk_ + this->len_, p, n);
+    this->len_ += n;
+    p += n;
+    len -= n;
+    if (this->len_ == CHUNK_SIZE)
+      this->flush();
+  }
+#else
+  this->print(reinterpret_cast<const char *>(str));
+#endif
+}
+#endif
+
+void MetricsStream::print(float value) {
+  char buf[32];
+#ifdef USE_ARDUINO
+  // Same as Arduino's Print::print(double)
+  int len = snprintf(buf, sizeof(buf), "%.2f", value);
+#else
+  int len = snprintf(buf, sizeof(buf), "%f", value);
+#endif
+  if (len > 0)
+    this->write(buf, std::min(static_cast<size_t>(len), sizeof(buf) - 1));
+}
+
+void MetricsStream::print(int value) {
+  char buf[12];
+  int len = snprintf(buf, sizeof(buf), "%d", value);
+  if (len > 0)
+    this->write(buf, len);
+}
+
+MetricsStream::~MetricsStream() {
+  this->flush();
+#ifdef USE_PROMETHEUS_GZIP
+  if (this->gzip_ != nullptr)
+    this->gzip_->finish();
+#endif
+}
+
+#ifdef USE_PROMETHEUS_GZIP
+bool MetricsStream::enable_gzip() {
+  this->flush();
+  // The encoder needs about 6 kB, the metrics are sent uncompressed if that is not available right now
+  this->gzip_.reset(new (std::nothrow) GzipEncoder(  // NOLINT(cppcoreguidelines-owning-memory)
+      [](void *arg, const uint8_t *data, size_t len) { static_cast<MetricsStream *>(arg)->emit_(data, len); }, this));
+  return this->gzip_ != nullptr;
+}
+#endif
+
+void MetricsStream::flush() {
+  if (this->len_ == 0)
+    return;
+#ifdef USE_PROMETHEUS_GZIP
+  if (this->gzip_ != nullptr) {
+    this->gzip_->write(reinterpret_cast<const uint8_t *>(this->chunk_), this->len_);
+    this->len_ = 0;
+    return;
+  }
+#endif
+  this->emit_(reinterpret_cast<const uint8_t *>(this->chunk_), this->len_);
+  this->len_ = 0;
+}
+
+void MetricsStream::emit_(const uint8_t *data, size_t len) {
+  if (this->response_ != nullptr) {
+    this->response_->write(data, len);
+  } else {
+    this->body_->append(reinterpret_cast<const char *>(data), len);
+  }
+}
+
+void PrometheusHandler::setup() {
+  // The labels only depend on the configuration, build them once instead of on every scrape
+#ifdef USE_SENSOR
+  for (auto *obj : App.get_sensors())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_BINARY_SENSOR
+  for (auto *obj : App.get_binary_sensors())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_FAN
+  for (auto *obj : App.get_fans())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_LIGHT
+  for (auto *obj : App.get_lights())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_COVER
+  for (auto *obj : App.get_covers())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_SWITCH
+  for (auto *obj : App.get_switches())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_LOCK
+  for (auto *obj : App.get_locks())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_TEXT_SENSOR
+  for (auto *obj : App.get_text_sensors())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_NUMBER
+  for (auto *obj : App.get_numbers())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_SELECT
+  for (auto *obj : App.get_selects())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  for (auto *obj : App.get_media_players())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_UPDATE
+  for (auto *obj : App.get_updates())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_VALVE
+  for (auto *obj : App.get_valves())
+    this->cache_labels_(obj);
+#endif
+#ifdef USE_CLIMATE
+  for (auto *obj : App.get_climates())
+    this->cache_labels_(obj);
+#endif
+  // Only needed to build the labels
+  this->relabel_map_id_.clear();
+  this->relabel_map_name_.clear();
+
+  // State callbacks are only needed to invalidate the cached body
+  if (this->cache_max_age_ > 0)
+    this->setup_controller(this->include_internal_);
+
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+#ifdef USE_PROMETHEUS_GZIP
+static bool accepts_gzip(AsyncWebServerRequest *req) {
+#ifdef USE_ESP_IDF
+  auto accept_encoding = req->get_header("Accept-Encoding");
+  return accept_encoding.has_value() && accept_encoding->find("gzip") != std::string::npos;
+#else
+  AsyncWebHeader *accept_encoding = req->getHeader("Accept-Encoding");
+  return accept_encoding != nullptr && accept_encoding->value().indexOf("gzip") >= 0;
+#endif
+}
+#endif
+
 void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
-  std::string area = App.get_area();
-  std::string node = App.get_name();
-  std::string friendly_name = App.get_friendly_name();
+  AsyncResponseStream *response = req->beginResponseStream(CONTENT_TYPE);
+
+  {
+    MetricsStream stream(response);
+#ifdef USE_PROMETHEUS_GZIP
+    if (accepts_gzip(req) && stream.enable_gzip())
+      response->addHeader("Content-Encoding", "gzip");
+#endif
 
+    if (this->cache_max_age_ == 0) {
+      this->write_metrics_(&stream);
+    } else {
+      const uint32_t now = millis();
+      if (this->state_changed_ || now - this->cached_body_time_ >= this->cache_max_age_) {
+        this->state_changed_ = false;
+        this->cached_body_time_ = now;
+        // clear() keeps the capacity of the previous scrape
+        this->cached_body_.clear();
+        MetricsStream body(&this->cached_body_);
+        this->write_metrics_(&body);
+      }
+      // Copied into the response, an async send of the last scrape never sees the body change
+      stream.write(this->cached_body_.data(), this->cached_body_.size());
+    }
+  }
+  req->send(response);
+}
+
+void PrometheusHandler::write_metrics_(MetricsStream *stream) {
 #ifdef USE_SENSOR
   this->sensor_type_(stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj, area, node, friendly_name);
+    this->sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj, area, node, friendly_name);
+    this->binary_sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_FAN
   this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj, area, node, friendly_name);
+    this->fan_row_(stream, obj);
 #endif
 
 #ifdef USE_LIGHT
   this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj, area, node, friendly_name);
+    this->light_row_(stream, obj);
 #endif
 
 #ifdef USE_COVER
   this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj, area, node, friendly_name);
+    this->cover_row_(stream, obj);
 #endif
 
 #ifdef USE_SWITCH
   this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj, area, node, friendly_name);
+    this->switch_row_(stream, obj);
 #endif
 
 #ifdef USE_LOCK
   this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj, area, node, friendly_name);
+    this->lock_row_(stream, obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   this->text_sensor_type_(stream);
   for (auto *obj : App.get_text_sensors())
-    this->text_sensor_row_(stream, obj, area, node, friendly_name);
+    this->text_sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_NUMBER
   this->number_type_(stream);
   for (auto *obj : App.get_numbers())
-    this->number_row_(stream, obj, area, node, friendly_name);
+    this->number_row_(stream, obj);
 #endif
 
 #ifdef USE_SELECT
   this->select_type_(stream);
   for (auto *obj : App.get_selects())
-    this->select_row_(stream, obj, area, node, friendly_name);
+    this->select_row_(stream, obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   this->media_player_type_(stream);
   for (auto *obj : App.get_media_players())
-    this->media_player_row_(stream, obj, area, node, friendly_name);
+    this->media_player_row_(stream, obj);
 #endif
 
 #ifdef USE_UPDATE
   this->update_entity_type_(stream);
   for (auto *obj : App.get_updates())
-    this->update_entity_row_(stream, obj, area, node, friendly_name);
+    this->update_entity_row_(stream, obj);
 #endif
 
 #ifdef USE_VALVE
   this->valve_type_(stream);
   for (auto *obj : App.get_valves())
-    this->valve_row_(stream, obj, area, node, friendly_name);
+    this->valve_row_(stream, obj);
 #endif
 
 #ifdef USE_CLIMATE
   this->climate_type_(stream);
   for (auto *obj : App.get_climates())
-    this->climate_row_(stream, obj, area, node, friendly_name);
+    this->climate_row_(stream, obj);
 #endif
 
-  req->send(stream);
 }
 
 std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
@@ -108,69 +309,59 @@ std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
   return item == relabel_map_name_.end() ? obj->get_name() : item->second;
 }
 
-void PrometheusHandler::add_area_label_(AsyncResponseStream *stream, std::string &area) {
-  if (!area.empty()) {
-    stream->print(F("\",area=\""));
-    stream->print(area.c_str());
-  }
-}
-
-void PrometheusHandler::add_node_label_(AsyncResponseStream *stream, std::string &node) {
-  if (!node.empty()) {
-    stream->print(F("\",node=\""));
-    stream->print(node.c_str());
+void PrometheusHandler::cache_labels_(EntityBase *obj) {
+  if (obj->is_internal() && !this->include_internal_)
+    return;
+  std::string labels = this->relabel_id_(obj);
+  const char *area = App.get_area();
+  if (area[0] != '\0') {
+    labels += "\",area=\"";
+    labels += area;
   }
+  const std::string &node = App.get_name();
+  if (!node.empty())
+    labels += "\",node=\"" + node;
+  const std::string &friendly_name = App.get_friendly_name();
+  if (!friendly_name.empty())
+    labels += "\",friendly_name=\"" + friendly_name;
+  labels += "\",name=\"" + this->relabel_name_(obj);
+  this->labels_[obj] = std::move(labels);
 }
 
-void PrometheusHandler::add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name) {
-  if (!friendly_name.empty()) {
-    stream->print(F("\",friendly_name=\""));
-    stream->print(friendly_name.c_str());
-  }
+void PrometheusHandler::print_labels_(MetricsStream *stream, EntityBase *obj) {
+  auto item = this->labels_.find(obj);
+  if (item != this->labels_.end())
+    stream->print(item->second);
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::sensor_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::sensor_row_(MetricsStream *stream, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
     stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
+    StringRef unit = obj->get_unit_of_measurement_ref();
+    stream->write(unit.c_str(), unit.size());
     stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
+    char value[32];
+    stream->write(value, value_accuracy_to_buf(value, sizeof(value), obj->state, obj->get_accuracy_decimals()));
     stream->print(F("\n"));
   } else {
     // Invalid state
     stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
@@ -178,88 +369,56 @@ void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::binary_sensor_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj,
-                                           std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::binary_sensor_row_(MetricsStream *stream, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->state);
     stream->print(F("\n"));
   } else {
     // Invalid state
     stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::fan_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_fan_value gauge\n"));
   stream->print(F("#TYPE esphome_fan_failed gauge\n"));
   stream->print(F("#TYPE esphome_fan_speed gauge\n"));
   stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                                 std::string &friendly_name) {
+void PrometheusHandler::fan_row_(MetricsStream *stream, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} 0\n"));
   // Data itself
   stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
   // Speed if available
   if (obj->get_traits().supports_speed()) {
     stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->speed);
     stream->print(F("\n"));
@@ -267,12 +426,7 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
     stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->oscillating);
     stream->print(F("\n"));
@@ -281,23 +435,17 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::light_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_light_state gauge\n"));
   stream->print(F("#TYPE esphome_light_color gauge\n"));
   stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area,
-                                   std::string &node, std::string &friendly_name) {
+void PrometheusHandler::light_row_(MetricsStream *stream, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // State
   stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   stream->print(obj->remote_values.is_on());
   stream->print(F("\n"));
@@ -307,52 +455,27 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
   stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",channel=\"brightness\"} "));
   stream->print(brightness);
   stream->print(F("\n"));
   stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",channel=\"r\"} "));
   stream->print(r);
   stream->print(F("\n"));
   stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",channel=\"g\"} "));
   stream->print(g);
   stream->print(F("\n"));
   stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",channel=\"b\"} "));
   stream->print(b);
   stream->print(F("\n"));
   stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",channel=\"w\"} "));
   stream->print(w);
   stream->print(F("\n"));
@@ -360,21 +483,11 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
     stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",effect=\"None\"} 0\n"));
   } else {
     stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",effect=\""));
     stream->print(effect.c_str());
     stream->print(F("\"} 1\n"));
@@ -383,43 +496,27 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::cover_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_cover_value gauge\n"));
   stream->print(F("#TYPE esphome_cover_failed gauge\n"));
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::cover_row_(MetricsStream *stream, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
     stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->position);
     stream->print(F("\n"));
     if (obj->get_traits().get_supports_tilt()) {
       stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      add_area_label_(stream, area);
-      add_node_label_(stream, node);
-      add_friendly_name_label_(stream, friendly_name);
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
+      this->print_labels_(stream, obj);
       stream->print(F("\"} "));
       stream->print(obj->tilt);
       stream->print(F("\n"));
@@ -427,42 +524,26 @@ void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *ob
   } else {
     // Invalid state
     stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::switch_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_switch_value gauge\n"));
   stream->print(F("#TYPE esphome_switch_failed gauge\n"));
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::switch_row_(MetricsStream *stream, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} 0\n"));
   // Data itself
   stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
@@ -470,30 +551,19 @@ void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::lock_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_lock_value gauge\n"));
   stream->print(F("#TYPE esphome_lock_failed gauge\n"));
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                                  std::string &friendly_name) {
+void PrometheusHandler::lock_row_(MetricsStream *stream, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} 0\n"));
   // Data itself
   stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
@@ -502,32 +572,21 @@ void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj,
 
 // Type-specific implementation
 #ifdef USE_TEXT_SENSOR
-void PrometheusHandler::text_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::text_sensor_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_text_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_text_sensor_failed gauge\n"));
 }
-void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area,
-                                         std::string &node, std::string &friendly_name) {
+void PrometheusHandler::text_sensor_row_(MetricsStream *stream, text_sensor::TextSensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_text_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(F("\"} "));
@@ -536,12 +595,7 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
   } else {
     // Invalid state
     stream->print(F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
@@ -549,76 +603,49 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
 
 // Type-specific implementation
 #ifdef USE_NUMBER
-void PrometheusHandler::number_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::number_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_number_value gauge\n"));
   stream->print(F("#TYPE esphome_number_failed gauge\n"));
 }
-void PrometheusHandler::number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::number_row_(MetricsStream *stream, number::Number *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
     stream->print(F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_number_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->state);
     stream->print(F("\n"));
   } else {
     // Invalid state
     stream->print(F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SELECT
-void PrometheusHandler::select_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::select_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_select_value gauge\n"));
   stream->print(F("#TYPE esphome_select_failed gauge\n"));
 }
-void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::select_row_(MetricsStream *stream, select::Select *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // Data itself
     stream->print(F("esphome_select_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(F("\"} "));
@@ -627,66 +654,40 @@ void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select
   } else {
     // Invalid state
     stream->print(F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-void PrometheusHandler::media_player_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::media_player_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_media_player_state_value gauge\n"));
   stream->print(F("#TYPE esphome_media_player_volume gauge\n"));
   stream->print(F("#TYPE esphome_media_player_is_muted gauge\n"));
   stream->print(F("#TYPE esphome_media_player_failed gauge\n"));
 }
-void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj,
-                                          std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::media_player_row_(MetricsStream *stream, media_player::MediaPlayer *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(F("esphome_media_player_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} 0\n"));
   // Data itself
   stream->print(F("esphome_media_player_state_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",value=\""));
   stream->print(media_player::media_player_state_to_string(obj->state));
   stream->print(F("\"} "));
   stream->print(F("1.0"));
   stream->print(F("\n"));
   stream->print(F("esphome_media_player_volume{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   stream->print(obj->volume);
   stream->print(F("\n"));
   stream->print(F("esphome_media_player_is_muted{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} "));
   if (obj->is_muted()) {
     stream->print(F("1.0"));
@@ -698,13 +699,13 @@ void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_pla
 #endif
 
 #ifdef USE_UPDATE
-void PrometheusHandler::update_entity_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::update_entity_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_update_entity_state gauge\n"));
   stream->print(F("#TYPE esphome_update_entity_info gauge\n"));
   stream->print(F("#TYPE esphome_update_entity_failed gauge\n"));
 }
 
-void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update::UpdateState state) {
+void PrometheusHandler::handle_update_state_(MetricsStream *stream, update::UpdateState state) {
   switch (state) {
     case update::UpdateState::UPDATE_STATE_UNKNOWN:
       stream->print("unknown");
@@ -724,28 +725,17 @@ void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update
   }
 }
 
-void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name) {
+void PrometheusHandler::update_entity_row_(MetricsStream *stream, update::UpdateEntity *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 0\n"));
     // First update state
     stream->print(F("esphome_update_entity_state{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",value=\""));
     handle_update_state_(stream, obj->state);
     stream->print(F("\"} "));
@@ -753,12 +743,7 @@ void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::
     stream->print(F("\n"));
     // Next update info
     stream->print(F("esphome_update_entity_info{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\",current_version=\""));
     stream->print(obj->update_info.current_version.c_str());
     stream->print(F("\",latest_version=\""));
@@ -771,44 +756,28 @@ void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::
   } else {
     // Invalid state
     stream->print(F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_VALVE
-void PrometheusHandler::valve_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::valve_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_valve_operation gauge\n"));
   stream->print(F("#TYPE esphome_valve_failed gauge\n"));
   stream->print(F("#TYPE esphome_valve_position gauge\n"));
 }
 
-void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::valve_row_(MetricsStream *stream, valve::Valve *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(F("esphome_valve_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\"} 0\n"));
   // Data itself
   stream->print(F("esphome_valve_operation{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",operation=\""));
   stream->print(valve::valve_operation_to_str(obj->current_operation));
   stream->print(F("\"} "));
@@ -817,12 +786,7 @@ void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *ob
   // Now see if position is supported
   if (obj->get_traits().get_supports_position()) {
     stream->print(F("esphome_valve_position{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_labels_(stream, obj);
     stream->print(F("\"} "));
     stream->print(obj->position);
     stream->print(F("\n"));
@@ -831,22 +795,16 @@ void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *ob
 #endif
 
 #ifdef USE_CLIMATE
-void PrometheusHandler::climate_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::climate_type_(MetricsStream *stream) {
   stream->print(F("#TYPE esphome_climate_setting gauge\n"));
   stream->print(F("#TYPE esphome_climate_value gauge\n"));
   stream->print(F("#TYPE esphome_climate_failed gauge\n"));
 }
 
-void PrometheusHandler::climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                             std::string &node, std::string &friendly_name, std::string &setting,
+void PrometheusHandler::climate_setting_row_(MetricsStream *stream, climate::Climate *obj, std::string &setting,
                                              const LogString *setting_value) {
   stream->print(F("esphome_climate_setting{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",category=\""));
   stream->print(setting.c_str());
   stream->print(F("\",setting_value=\""));
@@ -856,16 +814,10 @@ void PrometheusHandler::climate_setting_row_(AsyncResponseStream *stream, climat
   stream->print(F("\n"));
 }
 
-void PrometheusHandler::climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name, std::string &category,
+void PrometheusHandler::climate_value_row_(MetricsStream *stream, climate::Climate *obj, std::string &category,
                                            std::string &climate_value) {
   stream->print(F("esphome_climate_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",category=\""));
   stream->print(category.c_str());
   stream->print(F("\"} "));
@@ -873,16 +825,10 @@ void PrometheusHandler::climate_value_row_(AsyncResponseStream *stream, climate:
   stream->print(F("\n"));
 }
 
-void PrometheusHandler::climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                            std::string &node, std::string &friendly_name, std::string &category,
+void PrometheusHandler::climate_failed_row_(MetricsStream *stream, climate::Climate *obj, std::string &category,
                                             bool is_failed_value) {
   stream->print(F("esphome_climate_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_labels_(stream, obj);
   stream->print(F("\",category=\""));
   stream->print(category.c_str());
   stream->print(F("\"} "));
@@ -894,15 +840,14 @@ void PrometheusHandler::climate_failed_row_(AsyncResponseStream *stream, climate
   stream->print(F("\n"));
 }
 
-void PrometheusHandler::climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                     std::string &node, std::string &friendly_name) {
+void PrometheusHandler::climate_row_(MetricsStream *stream, climate::Climate *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // Data itself
   bool any_failures = false;
   std::string climate_mode_category = "mode";
   const auto *climate_mode_value = climate::climate_mode_to_string(obj->mode);
-  climate_setting_row_(stream, obj, area, node, friendly_name, climate_mode_category, climate_mode_value);
+  climate_setting_row_(stream, obj, climate_mode_category, climate_mode_value);
   const auto traits = obj->get_traits();
   // Now see if traits is supported
   int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
@@ -910,70 +855,70 @@ void PrometheusHandler::climate_row_(AsyncResponseStream *stream, climate::Clima
   // max temp
   std::string max_temp = "maximum_temperature";
   auto max_temp_value = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, max_temp, max_temp_value);
+  climate_value_row_(stream, obj, max_temp, max_temp_value);
   // max temp
   std::string min_temp = "mininum_temperature";
   auto min_temp_value = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, min_temp, min_temp_value);
+  climate_value_row_(stream, obj, min_temp, min_temp_value);
   // now check optional traits
   if (traits.get_supports_current_temperature()) {
     std::string current_temp = "current_temperature";
     if (std::isnan(obj->current_temperature)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, true);
+      climate_failed_row_(stream, obj, current_temp, true);
       any_failures = true;
     } else {
       auto current_temp_value = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_temp, current_temp_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, false);
+      climate_value_row_(stream, obj, current_temp, current_temp_value);
+      climate_failed_row_(stream, obj, current_temp, false);
     }
   }
   if (traits.get_supports_current_humidity()) {
     std::string current_humidity = "current_humidity";
     if (std::isnan(obj->current_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, true);
+      climate_failed_row_(stream, obj, current_humidity, true);
       any_failures = true;
     } else {
       auto current_humidity_value = value_accuracy_to_string(obj->current_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_humidity, current_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, false);
+      climate_value_row_(stream, obj, current_humidity, current_humidity_value);
+      climate_failed_row_(stream, obj, current_humidity, false);
     }
   }
   if (traits.get_supports_target_humidity()) {
     std::string target_humidity = "target_humidity";
     if (std::isnan(obj->target_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, true);
+      climate_failed_row_(stream, obj, target_humidity, true);
       any_failures = true;
     } else {
       auto target_humidity_value = value_accuracy_to_string(obj->target_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, target_humidity, target_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, false);
+      climate_value_row_(stream, obj, target_humidity, target_humidity_value);
+      climate_failed_row_(stream, obj, target_humidity, false);
     }
   }
   if (traits.get_supports_two_point_target_temperature()) {
     std::string target_temp_low = "target_temperature_low";
     auto target_temp_low_value = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_low, target_temp_low_value);
+    climate_value_row_(stream, obj, target_temp_low, target_temp_low_value);
     std::string target_temp_high = "target_temperature_high";
     auto target_temp_high_value = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_high, target_temp_high_value);
+    climate_value_row_(stream, obj, target_temp_high, target_temp_high_value);
   } else {
     std::string target_temp = "target_temperature";
     auto target_temp_value = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp, target_temp_value);
+    climate_value_row_(stream, obj, target_temp, target_temp_value);
   }
   if (traits.get_supports_action()) {
     std::string climate_trait_category = "action";
     const auto *climate_trait_value = climate::climate_action_to_string(obj->action);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
+    climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
   }
   if (traits.get_supports_fan_modes()) {
     std::string climate_trait_category = "fan_mode";
     if (obj->fan_mode.has_value()) {
       const auto *climate_trait_value = climate::climate_fan_mode_to_string(obj->fan_mode.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
+      climate_failed_row_(stream, obj, climate_trait_category, false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, obj, climate_trait_category, true);
       any_failures = true;
     }
   }
@@ -981,20 +926,20 @@ void PrometheusHandler::climate_row_(AsyncResponseStream *stream, climate::Clima
     std::string climate_trait_category = "preset";
     if (obj->preset.has_value()) {
       const auto *climate_trait_value = climate::climate_preset_to_string(obj->preset.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
+      climate_failed_row_(stream, obj, climate_trait_category, false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, obj, climate_trait_category, true);
       any_failures = true;
     }
   }
   if (traits.get_supports_swing_modes()) {
     std::string climate_trait_category = "swing_mode";
     const auto *climate_trait_value = climate::climate_swing_mode_to_string(obj->swing_mode);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
+    climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
   }
   std::string all_climate_category = "all";
-  climate_failed_row_(stream, obj, area, node, friendly_name, all_climate_category, any_failures);
+  climate_failed_row_(stream, obj, all_climate_category, any_failures);
 }
 #endif
 
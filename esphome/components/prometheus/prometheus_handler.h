@@ -1,13 +1,19 @@
 #pragma once
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
+#include <cstring>
 #include <map>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#ifdef USE_PROMETHEUS_GZIP
+#include "gzip_encoder.h"
+#endif
 #ifdef USE_CLIMATE
 #include "esphome/core/log.h"
 #endif
@@ -15,7 +21,45 @@
 namespace esphome {
 namespace prometheus {
 
-class PrometheusHandler : public AsyncWebHandler, public Component {
+/// Collects the metrics in a fixed size chunk and hands full chunks to the response or to the cached body.
+class MetricsStream {
+ public:
+  explicit MetricsStream(AsyncResponseStream *response) : response_(response) {}
+  explicit MetricsStream(std::string *body) : body_(body) {}
+  ~MetricsStream();
+
+#ifdef USE_PROMETHEUS_GZIP
+  /// Compress everything written from now on, false if there is not enough memory for the encoder.
+  bool enable_gzip();
+#endif
+
+  void write(const char *data, size_t len);
+  void print(const char *str) { this->write(str, strlen(str)); }
+  void print(const std::string &str) { this->write(str.data(), str.size()); }
+#ifdef USE_ARDUINO
+  void print(const __FlashStringHelper *str);
+#endif
+  void print(float value);
+  void print(int value);
+  void print(bool value) { this->print(value ? "1" : "0"); }
+  void flush();
+
+ protected:
+  static constexpr size_t CHUNK_SIZE = 512;
+
+  /// Hand finished output to the response or the body.
+  void emit_(const uint8_t *data, size_t len);
+
+  AsyncResponseStream *response_{nullptr};
+  std::string *body_{nullptr};
+  size_t len_{0};
+  char chunk_[CHUNK_SIZE];
+#ifdef USE_PROMETHEUS_GZIP
+  std::unique_ptr<GzipEncoder> gzip_;
+#endif
+};
+
+class PrometheusHandler : public AsyncWebHandler, public Component, public Controller {
  public:
   PrometheusHandler(web_server_base::WebServerBase *base) : base_(base) {}
 
@@ -40,6 +84,13 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
    */
   void add_label_name(EntityBase *obj, const std::string &value) { relabel_map_name_.insert({obj, value}); }
 
+  /** Serve the last scrape again as long as no entity changed its state and it is younger than max_age.
+   * Defaults to 0, which renders every scrape.
+   *
+   * @param max_age The maximum age of the cached response in milliseconds.
+   */
+  void set_cache_max_age(uint32_t max_age) { cache_max_age_ = max_age; }
+
   bool canHandle(AsyncWebServerRequest *request) const override {
     if (request->method() == HTTP_GET) {
       if (request->url() == "/metrics")
@@ -51,145 +102,184 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
+#ifdef USE_SENSOR
+  void on_sensor_update(sensor::Sensor *obj, float state) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_BINARY_SENSOR
+  void on_binary_sensor_update(binary_sensor::BinarySensor *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_FAN
+  void on_fan_update(fan::Fan *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_LIGHT
+  void on_light_update(light::LightState *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_COVER
+  void on_cover_update(cover::Cover *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_SWITCH
+  void on_switch_update(switch_::Switch *obj, bool state) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_LOCK
+  void on_lock_update(lock::Lock *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_TEXT_SENSOR
+  void on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) override {
+    this->state_changed_ = true;
+  }
+#endif
+#ifdef USE_NUMBER
+  void on_number_update(number::Number *obj, float state) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_SELECT
+  void on_select_update(select::Select *obj, const std::string &state, size_t index) override {
+    this->state_changed_ = true;
+  }
+#endif
+#ifdef USE_MEDIA_PLAYER
+  void on_media_player_update(media_player::MediaPlayer *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_UPDATE
+  void on_update(update::UpdateEntity *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_VALVE
+  void on_valve_update(valve::Valve *obj) override { this->state_changed_ = true; }
+#endif
+#ifdef USE_CLIMATE
+  void on_climate_update(climate::Climate *obj) override { this->state_changed_ = true; }
+#endif
+
  protected:
   std::string relabel_id_(EntityBase *obj);
   std::string relabel_name_(EntityBase *obj);
-  void add_area_label_(AsyncResponseStream *stream, std::string &area);
-  void add_node_label_(AsyncResponseStream *stream, std::string &node);
-  void add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name);
+  /// Build the labels of an entity once, they do not change at runtime.
+  void cache_labels_(EntityBase *obj);
+  /// Print the cached labels of an entity, from the id value up to the open name value.
+  void print_labels_(MetricsStream *stream, EntityBase *obj);
+  /// Write all metrics of a scrape.
+  void write_metrics_(MetricsStream *stream);
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(MetricsStream *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void sensor_row_(MetricsStream *stream, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(MetricsStream *stream);
   /// Return the binary sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj, std::string &area,
-                          std::string &node, std::string &friendly_name);
+  void binary_sensor_row_(MetricsStream *stream, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(MetricsStream *stream);
   /// Return the fan state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                std::string &friendly_name);
+  void fan_row_(MetricsStream *stream, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(MetricsStream *stream);
   /// Return the light values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void light_row_(MetricsStream *stream, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(MetricsStream *stream);
   /// Return the cover values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void cover_row_(MetricsStream *stream, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(MetricsStream *stream);
   /// Return the switch values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void switch_row_(MetricsStream *stream, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(MetricsStream *stream);
   /// Return the lock values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                 std::string &friendly_name);
+  void lock_row_(MetricsStream *stream, lock::Lock *obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   /// Return the type for prometheus
-  void text_sensor_type_(AsyncResponseStream *stream);
+  void text_sensor_type_(MetricsStream *stream);
   /// Return the text sensor values state as prometheus data point
-  void text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area, std::string &node,
-                        std::string &friendly_name);
+  void text_sensor_row_(MetricsStream *stream, text_sensor::TextSensor *obj);
 #endif
 
 #ifdef USE_NUMBER
   /// Return the type for prometheus
-  void number_type_(AsyncResponseStream *stream);
+  void number_type_(MetricsStream *stream);
   /// Return the number state as prometheus data point
-  void number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void number_row_(MetricsStream *stream, number::Number *obj);
 #endif
 
 #ifdef USE_SELECT
   /// Return the type for prometheus
-  void select_type_(AsyncResponseStream *stream);
+  void select_type_(MetricsStream *stream);
   /// Return the select state as prometheus data point
-  void select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void select_row_(MetricsStream *stream, select::Select *obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   /// Return the type for prometheus
-  void media_player_type_(AsyncResponseStream *stream);
+  void media_player_type_(MetricsStream *stream);
   /// Return the media player state as prometheus data point
-  void media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj, std::string &area,
-                         std::string &node, std::string &friendly_name);
+  void media_player_row_(MetricsStream *stream, media_player::MediaPlayer *obj);
 #endif
 
 #ifdef USE_UPDATE
   /// Return the type for prometheus
-  void update_entity_type_(AsyncResponseStream *stream);
+  void update_entity_type_(MetricsStream *stream);
   /// Return the update state and info as prometheus data point
-  void update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area, std::string &node,
-                          std::string &friendly_name);
-  void handle_update_state_(AsyncResponseStream *stream, update::UpdateState state);
+  void update_entity_row_(MetricsStream *stream, update::UpdateEntity *obj);
+  void handle_update_state_(MetricsStream *stream, update::UpdateState state);
 #endif
 
 #ifdef USE_VALVE
   /// Return the type for prometheus
-  void valve_type_(AsyncResponseStream *stream);
+  void valve_type_(MetricsStream *stream);
   /// Return the valve state as prometheus data point
-  void valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void valve_row_(MetricsStream *stream, valve::Valve *obj);
 #endif
 
 #ifdef USE_CLIMATE
   /// Return the type for prometheus
-  void climate_type_(AsyncResponseStream *stream);
+  void climate_type_(MetricsStream *stream);
   /// Return the climate state as prometheus data point
-  void climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                    std::string &friendly_name);
-  void climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                           std::string &friendly_name, std::string &category, bool is_failed_value);
-  void climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                            std::string &friendly_name, std::string &setting, const LogString *setting_value);
-  void climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                          std::string &friendly_name, std::string &category, std::string &climate_value);
+  void climate_row_(MetricsStream *stream, climate::Climate *obj);
+  void climate_failed_row_(MetricsStream *stream, climate::Climate *obj, std::string &category, bool is_failed_value);
+  void climate_setting_row_(MetricsStream *stream, climate::Climate *obj, std::string &setting,
+                            const LogString *setting_value);
+  void climate_value_row_(MetricsStream *stream, climate::Climate *obj, std::string &category,
+                          std::string &climate_value);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  // '<id>",area="...",node="...",friendly_name="...",name="<name>' of every exported entity
+  std::map<EntityBase *, std::string> labels_;
+  uint32_t cache_max_age_{0};
+  // Rendered body of the last scrape, only kept when caching is enabled
+  std::string cached_body_;
+  uint32_t cached_body_time_{0};
+  bool state_changed_{true};
 };
 
 }  // namespace prometheus
@@ -1,4 +1,5 @@
 #include "pulse_meter_sensor.h"
+#include <algorithm>
 #include <utility>
 #include "esphome/core/log.h"
 
@@ -24,7 +25,14 @@ void PulseMeterSensor::setup() {
   // Set the last processed edge to now for the first timeout
   this->last_processed_edge_us_ = micros();
 
-  if (this->filter_mode_ == FILTER_EDGE) {
+  if (this->use_pcnt_) {
+#ifdef HAS_PCNT
+    if (!this->setup_pcnt_()) {
+      this->mark_failed();
+      return;
+    }
+#endif
+  } else if (this->filter_mode_ == FILTER_EDGE) {
     this->pin_->attach_interrupt(PulseMeterSensor::edge_intr, this, gpio::INTERRUPT_RISING_EDGE);
   } else if (this->filter_mode_ == FILTER_PULSE) {
     // Set the pin value to the current value to avoid a false edge
@@ -38,46 +46,18 @@ void PulseMeterSensor::setup() {
 }
 
 void PulseMeterSensor::loop() {
-  // Reset the count in get before we pass it back to the ISR as set
-  this->get_->count_ = 0;
-
-  {
-    // Lock the interrupt so the interrupt code doesn't interfere with itself
-    InterruptLock lock;
-
-    // Sometimes ESP devices miss interrupts if the edge rises or falls too slowly.
-    // See https://github.com/espressif/arduino-esp32/issues/4172
-    // If the edges are rising too slowly it also implies that the pulse rate is slow.
-    // Therefore the update rate of the loop is likely fast enough to detect the edges.
-    // When the main loop detects an edge that the ISR didn't it will run the ISR functions directly.
-    bool current = this->pin_->digital_read();
-    if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
-      PulseMeterSensor::edge_intr(this);
-    } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
-      PulseMeterSensor::pulse_intr(this);
-    }
-    this->last_pin_val_ = current;
-
-    // Swap out set and get to get the latest state from the ISR
-    std::swap(this->set_, this->get_);
+#ifdef HAS_PCNT
+  if (this->use_pcnt_) {
+    this->read_pcnt_();
+  } else {
+    this->read_isr_();
   }
+#else
+  this->read_isr_();
+#endif
 
   const uint32_t now = micros();
 
-  // If an edge was peeked, repay the debt
-  if (this->peeked_edge_ && this->get_->count_ > 0) {
-    this->peeked_edge_ = false;
-    this->get_->count_--;  // NOLINT(clang-diagnostic-deprecated-volatile)
-  }
-
-  // If there is an unprocessed edge, and filter_us_ has passed since, count this edge early
-  if (this->get_->last_rising_edge_us_ != this->get_->last_detected_edge_us_ &&
-      now - this->get_->last_rising_edge_us_ >= this->filter_us_) {
-    this->peeked_edge_ = true;
-    this->get_->last_detected_edge_us_ = this->get_->last_rising_edge_us_;
-    this->get_->count_++;  // NOLINT(clang-diagnostic-deprecated-volatile)
-  }
-
   // Check if we detected a pulse this loop
   if (this->get_->count_ > 0) {
     // Keep a running total of pulses if a total sensor is configured
@@ -125,12 +105,126 @@ void PulseMeterSensor::loop() {
   }
 }
 
+void PulseMeterSensor::read_isr_() {
+  // Reset the count in get before we pass it back to the ISR as set
+  this->get_->count_ = 0;
+
+  {
+    // Lock the interrupt so the interrupt code doesn't interfere with itself
+    InterruptLock lock;
+
+    // Sometimes ESP devices miss interrupts if the edge rises or falls too slowly.
+    // See https://github.com/espressif/arduino-esp32/issues/4172
+    // If the edges are rising too slowly it also implies that the pulse rate is slow.
+    // Therefore the update rate of the loop is likely fast enough to detect the edges.
+    // When the main loop detects an edge that the ISR didn't it will run the ISR functions directly.
+    bool current = this->pin_->digital_read();
+    if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
+      PulseMeterSensor::edge_intr(this);
+    } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
+      PulseMeterSensor::pulse_intr(this);
+    }
+    this->last_pin_val_ = current;
+
+    // Swap out set and get to get the latest state from the ISR
+    std::swap(this->set_, this->get_);
+  }
+
+  const uint32_t now = micros();
+
+  // If an edge was peeked, repay the debt
+  if (this->peeked_edge_ && this->get_->count_ > 0) {
+    this->peeked_edge_ = false;
+    this->get_->count_--;  // NOLINT(clang-diagnostic-deprecated-volatile)
+  }
+
+  // If there is an unprocessed edge, and filter_us_ has passed since, count this edge early
+  if (this->get_->last_rising_edge_us_ != this->get_->last_detected_edge_us_ &&
+      now - this->get_->last_rising_edge_us_ >= this->filter_us_) {
+    this->peeked_edge_ = true;
+    this->get_->last_detected_edge_us_ = this->get_->last_rising_edge_us_;
+    this->get_->count_++;  // NOLINT(clang-diagnostic-deprecated-volatile)
+  }
+}
+
+#ifdef HAS_PCNT
+bool PulseMeterSensor::setup_pcnt_() {
+  // pulse_counter hands out units from the first one up, so take them from the last one down
+  static int next_pcnt_unit = PCNT_UNIT_MAX - 1;
+  if (next_pcnt_unit < 0) {
+    ESP_LOGE(TAG, "No PCNT unit left");
+    return false;
+  }
+  this->pcnt_unit_ = pcnt_unit_t(next_pcnt_unit--);
+
+  pcnt_config_t pcnt_config = {
+      .pulse_gpio_num = this->pin_->get_pin(),
+      .ctrl_gpio_num = PCNT_PIN_NOT_USED,
+      .lctrl_mode = PCNT_MODE_KEEP,
+      .hctrl_mode = PCNT_MODE_KEEP,
+      .pos_mode = PCNT_COUNT_INC,
+      .neg_mode = PCNT_COUNT_DIS,
+      .counter_h_lim = 0,
+      .counter_l_lim = 0,
+      .unit = this->pcnt_unit_,
+      .channel = PCNT_CHANNEL_0,
+  };
+  esp_err_t error = pcnt_unit_config(&pcnt_config);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+
+  // The glitch filter counts APB clock cycles (80 MHz) and ignores pulses shorter than that
+  if (this->filter_us_ != 0) {
+    uint16_t filter_val = std::min(static_cast<unsigned int>(this->filter_us_ * 80u), 1023u);
+    error = pcnt_set_filter_value(this->pcnt_unit_, filter_val);
+    if (error == ESP_OK)
+      error = pcnt_filter_enable(this->pcnt_unit_);
+    if (error != ESP_OK) {
+      ESP_LOGE(TAG, "Setting PCNT filter failed: %s", esp_err_to_name(error));
+      return false;
+    }
+  }
+
+  error = pcnt_counter_clear(this->pcnt_unit_);
+  if (error == ESP_OK)
+    error = pcnt_counter_resume(this->pcnt_unit_);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Starting PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  return true;
+}
+
+void PulseMeterSensor::read_pcnt_() {
+  int16_t value;
+  pcnt_get_counter_value(this->pcnt_unit_, &value);
+  // The counter wraps around, the difference in 16 bits still is the number of new pulses
+  const int16_t count = value - this->last_pcnt_value_;
+  this->last_pcnt_value_ = value;
+
+  // The counter has no timestamps, so the pulses are dated to this read. At high rates the last one is at most one
+  // pulse period earlier, at low rates the error is up to one loop() interval, which the next read makes up for.
+  this->get_->count_ = count > 0 ? count : 0;
+  if (count > 0)
+    this->get_->last_detected_edge_us_ = micros();
+}
+#endif  // HAS_PCNT
+
 float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA; }
 
 void PulseMeterSensor::dump_config() {
   LOG_SENSOR("", "Pulse Meter", this);
   LOG_PIN("  Pin: ", this->pin_);
-  if (this->filter_mode_ == FILTER_EDGE) {
+  if (this->use_pcnt_) {
+#ifdef HAS_PCNT
+    ESP_LOGCONFIG(TAG,
+                  "  PCNT Unit Number: %u\n"
+                  "  Filtering pulses shorter than %" PRIu32 " µs",
+                  this->pcnt_unit_, this->filter_us_);
+#endif
+  } else if (this->filter_mode_ == FILTER_EDGE) {
     ESP_LOGCONFIG(TAG, "  Filtering rising edges less than %" PRIu32 " µs apart", this->filter_us_);
   } else {
     ESP_LOGCONFIG(TAG, "  Filtering pulses shorter than %" PRIu32 " µs", this->filter_us_);
@@ -7,6 +7,11 @@
 
 #include <cinttypes>
 
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include <driver/pcnt.h>
+#define HAS_PCNT
+#endif  // defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+
 namespace esphome {
 namespace pulse_meter {
 
@@ -22,6 +27,8 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
   void set_filter_mode(InternalFilterMode mode) { this->filter_mode_ = mode; }
+  /// Count the pulses with the PCNT peripheral instead of an interrupt per edge.
+  void set_use_pcnt(bool use_pcnt) { this->use_pcnt_ = use_pcnt; }
 
   void set_total_pulses(uint32_t pulses);
 
@@ -34,6 +41,18 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   static void edge_intr(PulseMeterSensor *sensor);
   static void pulse_intr(PulseMeterSensor *sensor);
 
+  /// Take the edges the interrupts saw since the last call into get_.
+  void read_isr_();
+  bool use_pcnt_{false};
+#ifdef HAS_PCNT
+  bool setup_pcnt_();
+  /// Take the pulses the PCNT unit counted since the last call into get_.
+  void read_pcnt_();
+
+  pcnt_unit_t pcnt_unit_;
+  int16_t last_pcnt_value_{0};
+#endif
+
   InternalGPIOPin *pin_{nullptr};
   uint32_t filter_us_ = 0;
   uint32_t timeout_us_ = 1000000UL * 60UL * 5UL;
@@ -1,6 +1,8 @@
 from esphome import automation, pins
 import esphome.codegen as cg
 from esphome.components import sensor
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32C3
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ID,
@@ -36,6 +38,8 @@ FILTER_MODES = {
 
 SetTotalPulsesAction = pulse_meter_ns.class_("SetTotalPulsesAction", automation.Action)
 
+CONF_USE_PCNT = "use_pcnt"
+
 
 def validate_internal_filter(value):
     return cv.positive_time_period_microseconds(value)
@@ -57,6 +61,19 @@ def validate_pulse_meter_pin(value):
     return value
 
 
+def validate_pcnt(config):
+    if not config.get(CONF_USE_PCNT):
+        return config
+    if CORE.is_esp32 and get_esp32_variant() == VARIANT_ESP32C3:
+        raise cv.Invalid("The ESP32-C3 has no PCNT peripheral", [CONF_USE_PCNT])
+    if config[CONF_INTERNAL_FILTER].total_microseconds > 13:
+        raise cv.Invalid(
+            "Maximum internal filter value when using ESP32 hardware PCNT is 13us",
+            [CONF_INTERNAL_FILTER],
+        )
+    return config
+
+
 CONFIG_SCHEMA = sensor.sensor_schema(
     PulseMeterSensor,
     unit_of_measurement=UNIT_PULSES_PER_MINUTE,
@@ -77,8 +94,9 @@ CONFIG_SCHEMA = sensor.sensor_schema(
         cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
             FILTER_MODES, upper=True
         ),
+        cv.Optional(CONF_USE_PCNT): cv.All(cv.only_on_esp32, cv.boolean),
     }
-)
+).add_extra(validate_pcnt)
 
 
 async def to_code(config):
@@ -90,6 +108,8 @@ async def to_code(config):
     cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT]))
     cg.add(var.set_filter_mode(config[CONF_INTERNAL_FILTER_MODE]))
+    if config.get(CONF_USE_PCNT):
+        cg.add(var.set_use_pcnt(True))
 
     if CONF_TOTAL in config:
         sens = await sensor.new_sensor(config[CONF_TOTAL])
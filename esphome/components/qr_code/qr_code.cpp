@@ -16,11 +16,16 @@ void QrCode::dump_config() {
 }
 
 void QrCode::set_value(const std::string &value) {
+  // Lambdas often set the same value on every display update
+  if (this->value_ == value)
+    return;
   this->value_ = value;
   this->needs_update_ = true;
 }
 
 void QrCode::set_ecc(qrcodegen_Ecc ecc) {
+  if (this->ecc_ == ecc)
+    return;
   this->ecc_ = ecc;
   this->needs_update_ = true;
 }
@@ -45,11 +50,19 @@ void QrCode::draw(display::Display *buff, uint16_t x_offset, uint16_t y_offset,
 
   uint8_t qrcode_width = qrcodegen_getSize(this->qr_);
 
-  for (int y = 0; y < qrcode_width * scale; y++) {
-    for (int x = 0; x < qrcode_width * scale; x++) {
-      if (qrcodegen_getModule(this->qr_, x / scale, y / scale)) {
-        buff->draw_pixel_at(x_offset + x, y_offset + y, color);
+  // Runs of dark modules in a row are drawn as one scaled rectangle
+  for (int y = 0; y < qrcode_width; y++) {
+    int x = 0;
+    while (x < qrcode_width) {
+      if (!qrcodegen_getModule(this->qr_, x, y)) {
+        x++;
+        continue;
       }
+      int run_end = x + 1;
+      while (run_end < qrcode_width && qrcodegen_getModule(this->qr_, run_end, y))
+        run_end++;
+      buff->filled_rectangle(x_offset + x * scale, y_offset + y * scale, (run_end - x) * scale, scale, color);
+      x = run_end;
     }
   }
 }
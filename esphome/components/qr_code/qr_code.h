@@ -28,7 +28,7 @@ class QrCode : public Component {
 
  protected:
   std::string value_;
-  qrcodegen_Ecc ecc_;
+  qrcodegen_Ecc ecc_{qrcodegen_Ecc_LOW};
   bool needs_update_ = true;
   uint8_t qr_[qrcodegen_BUFFER_LEN_MAX];
 };
@@ -887,6 +887,11 @@ async def pioneer_action(var, config, args):
 
 
 # Pronto
+CONF_CODE_STORAGE_ID = "code_storage_id"
+PRONTO_REFERENCE_FREQUENCY = 4145146
+PRONTO_NUMBERS_IN_PREAMBLE = 4
+PRONTO_MICROSECONDS_T_MAX = 0xFFFF
+
 (
     ProntoData,
     ProntoBinarySensor,
@@ -925,9 +930,63 @@ def pronto_dumper(var, config):
     pass
 
 
-@register_action("pronto", ProntoAction, PRONTO_SCHEMA)
+def pronto_to_raw(pronto):
+    """Converts Pronto hex to raw timings like ProntoProtocol::encode on the device.
+
+    Returns a tuple of the timings and the carrier frequency, None if the data can't be
+    sent as is.
+    """
+    data = []
+    for token in pronto.split():
+        try:
+            value = int(token, 16) & 0xFFFF
+        except ValueError:
+            return None
+        if value == 0 and len(data) >= PRONTO_NUMBERS_IN_PREAMBLE:
+            break
+        data.append(value)
+
+    if len(data) < PRONTO_NUMBERS_IN_PREAMBLE or data[1] == 0:
+        return None
+    if data[0] == 0x0000:
+        khz = ((PRONTO_REFERENCE_FREQUENCY // data[1]) + 500) // 1000
+        carrier_frequency = khz * 1000
+    elif data[0] == 0x0100:
+        carrier_frequency = 0
+    else:
+        return None
+    if PRONTO_NUMBERS_IN_PREAMBLE + 2 * (data[2] + data[3]) != len(data):
+        return None
+
+    timebase = (1000000 * data[1] + PRONTO_REFERENCE_FREQUENCY // 2) // (
+        PRONTO_REFERENCE_FREQUENCY
+    )
+    timebase &= 0xFFFF
+    code = []
+    for i, value in enumerate(data[PRONTO_NUMBERS_IN_PREAMBLE:]):
+        duration = min(value * timebase, PRONTO_MICROSECONDS_T_MAX)
+        code.append(duration if i % 2 == 0 else -duration)
+    return code, carrier_frequency
+
+
+@register_action(
+    "pronto",
+    ProntoAction,
+    PRONTO_SCHEMA.extend(
+        {
+            cv.GenerateID(CONF_CODE_STORAGE_ID): cv.declare_id(cg.int32),
+        }
+    ),
+)
 async def pronto_action(var, config, args):
-    template_ = await cg.templatable(config[CONF_DATA], args, cg.std_string)
+    data = config[CONF_DATA]
+    if not cg.is_template(data) and (raw := pronto_to_raw(data)) is not None:
+        # Parsed once here, so sending is copying timings from flash
+        code, carrier_frequency = raw
+        arr = cg.progmem_array(config[CONF_CODE_STORAGE_ID], code)
+        cg.add(var.set_code_static(arr, len(code), carrier_frequency))
+        return
+    template_ = await cg.templatable(data, args, cg.std_string)
     cg.add(var.set_data(template_))
 
 
@@ -1072,7 +1131,6 @@ def validate_raw_alternating(value):
 
 
 RawData, RawBinarySensor, RawTrigger, RawAction, RawDumper = declare_protocol("Raw")
-CONF_CODE_STORAGE_ID = "code_storage_id"
 RAW_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_CODE): cv.All(
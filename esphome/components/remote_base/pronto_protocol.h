@@ -43,12 +43,51 @@ template<typename... Ts> class ProntoAction : public RemoteTransmitterActionBase
   TEMPLATABLE_VALUE(std::string, data)
   TEMPLATABLE_VALUE(int, delta)
 
+  /// Sets timings that were converted from Pronto hex at compile time
+  void set_code_static(const int32_t *code, size_t len, uint32_t carrier_frequency) {
+    this->code_static_ = code;
+    this->code_static_len_ = len;
+    this->carrier_frequency_static_ = carrier_frequency;
+  }
+
   void encode(RemoteTransmitData *dst, Ts... x) override {
-    ProntoData data{};
-    data.data = this->data_.value(x...);
-    data.delta = this->delta_.value(x...);
-    ProntoProtocol().encode(dst, data);
+    if (this->code_static_ != nullptr) {
+      dst->reserve(this->code_static_len_);
+      for (size_t i = 0; i < this->code_static_len_; i++) {
+        auto val = this->code_static_[i];
+        if (val < 0) {
+          dst->space(static_cast<uint32_t>(-val));
+        } else {
+          dst->mark(static_cast<uint32_t>(val));
+        }
+      }
+      dst->set_carrier_frequency(this->carrier_frequency_static_);
+      return;
+    }
+
+    // Templated data is usually the same code sent again, so keep the last conversion around
+    std::string data = this->data_.value(x...);
+    if (data != this->cached_data_) {
+      ProntoData pronto{};
+      pronto.data = data;
+      ProntoProtocol().encode(dst, pronto);
+      this->cached_data_ = std::move(data);
+      this->cached_code_ = dst->get_data();
+      this->cached_carrier_frequency_ = dst->get_carrier_frequency();
+      return;
+    }
+    dst->set_data(this->cached_code_);
+    dst->set_carrier_frequency(this->cached_carrier_frequency_);
   }
+
+ protected:
+  const int32_t *code_static_{nullptr};
+  size_t code_static_len_{0};
+  uint32_t carrier_frequency_static_{0};
+
+  std::string cached_data_;
+  RawTimings cached_code_;
+  uint32_t cached_carrier_frequency_{0};
 };
 
 }  // namespace remote_base
@@ -109,20 +109,28 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   }
 }
 
+uint32_t RemoteReceiverBase::last_frame = 0;
+
+void RemoteReceiverBase::next_frame_() {
+  if (++RemoteReceiverBase::last_frame == 0)
+    ++RemoteReceiverBase::last_frame;
+  this->frame_ = RemoteReceiverBase::last_frame;
+}
+
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_));
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_)))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_));
   }
 }
 
@@ -43,11 +43,14 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_(frame) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
+  /// Identifies the received pulse train, the same for all listeners and dumpers it is passed to. 0 if unknown.
+  uint32_t get_frame() const { return this->frame_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
   bool is_valid(uint32_t offset = 0) const { return this->index_ + offset < this->data_.size(); }
@@ -98,6 +101,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_;
 };
 
 class RemoteComponentBase {
@@ -193,9 +197,12 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    this->next_frame_();
     this->call_listeners_();
     this->call_dumpers_();
   }
+  /// Starts a new pulse train, so decoders shared by several listeners and dumpers run again.
+  void next_frame_();
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
@@ -203,6 +210,9 @@ class RemoteReceiverBase : public RemoteComponentBase {
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t frame_{0};
+  /// Shared by all receivers so frames from different receivers never match
+  static uint32_t last_frame;
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -225,14 +235,28 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/** Decodes a pulse train with protocol T, only once for all listeners and dumpers of the same receiver.
+ *
+ * Every binary sensor, trigger and dumper of a protocol would otherwise run the same decoder on every pulse train,
+ * which adds up in busy environments with many configured codes. The result of the last frame is kept per protocol.
+ */
+template<typename T> optional<typename T::ProtocolData> decode_protocol(RemoteReceiveData src) {
+  static uint32_t decoded_frame = 0;
+  static optional<typename T::ProtocolData> decoded;
+  if (src.get_frame() != 0 && src.get_frame() == decoded_frame)
+    return decoded;
+  decoded = T().decode(src);
+  decoded_frame = src.get_frame();
+  return decoded;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_protocol<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -247,8 +271,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_protocol<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -289,11 +312,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_protocol<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
@@ -1,3 +1,5 @@
+import math
+
 import esphome.codegen as cg
 from esphome.components import audio, esp32, speaker
 import esphome.config_validation as cv
@@ -12,6 +14,7 @@ from esphome.const import (
     CONF_TASK_STACK_IN_PSRAM,
     PLATFORM_ESP32,
 )
+from esphome.core import ID
 from esphome.core.entity_helpers import inherit_property_from
 
 AUTO_LOAD = ["audio"]
@@ -22,8 +25,19 @@ ResamplerSpeaker = resampler_ns.class_(
     "ResamplerSpeaker", cg.Component, speaker.Speaker
 )
 
+CONF_ENGINE = "engine"
 CONF_TAPS = "taps"
 
+ENGINE_FLOAT = "float"
+ENGINE_FIXED_POINT = "fixed_point"
+
+# Source sample rates that get a fixed-point filter bank for the target sample rate
+FIXED_POINT_SOURCE_SAMPLE_RATES = [16000, 22050, 32000, 44100, 48000]
+# Keeps the coefficient tables small, ratios that need more phases use the float engine
+MAX_FIXED_POINT_PHASES = 160
+# Same gain adjustment the float engine applies to avoid clipping
+FIXED_POINT_GAIN_DB = -3
+
 
 def _set_stream_limits(config):
     audio.set_stream_limits(
@@ -48,6 +62,45 @@ def _validate_audio_compatability(config):
     )(config)
 
 
+def _polyphase_filter_bank(source_rate, target_rate, taps):
+    """Return (phases, decimation, coefficients) of a windowed sinc low pass filter
+    that resamples from source_rate to target_rate, or None if it needs too many
+    phases. The coefficients are Q15, ordered phase by phase with the newest input
+    sample's coefficient first."""
+    divisor = math.gcd(source_rate, target_rate)
+    phases = target_rate // divisor
+    decimation = source_rate // divisor
+    if phases > MAX_FIXED_POINT_PHASES:
+        return None
+
+    # The prototype filter runs at phases times the source rate
+    length = phases * taps
+    cutoff = 0.5 * min(source_rate, target_rate) / (source_rate * phases)
+    gain = phases * 10 ** (FIXED_POINT_GAIN_DB / 20)
+    center = (length - 1) / 2
+    prototype = []
+    for n in range(length):
+        x = n - center
+        if x == 0:
+            sinc = 2 * cutoff
+        else:
+            sinc = math.sin(2 * math.pi * cutoff * x) / (math.pi * x)
+        # Blackman window
+        window = (
+            0.42
+            - 0.5 * math.cos(2 * math.pi * n / (length - 1))
+            + 0.08 * math.cos(4 * math.pi * n / (length - 1))
+        )
+        prototype.append(sinc * window * gain)
+
+    coefficients = []
+    for phase in range(phases):
+        for tap in range(taps):
+            value = round(prototype[tap * phases + phase] * (1 << 15))
+            coefficients.append(max(-32768, min(32767, value)))
+    return phases, decimation, coefficients
+
+
 def _validate_taps(taps):
     value = cv.int_range(min=16, max=128)(taps)
     if value % 4 != 0:
@@ -68,6 +121,9 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_FILTERS, default=16): cv.int_range(min=2, max=1024),
             cv.Optional(CONF_TAPS, default=16): _validate_taps,
+            cv.Optional(CONF_ENGINE, default=ENGINE_FLOAT): cv.one_of(
+                ENGINE_FLOAT, ENGINE_FIXED_POINT, lower=True
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on([PLATFORM_ESP32]),
@@ -100,3 +156,26 @@ async def to_code(config):
 
     cg.add(var.set_filters(config[CONF_FILTERS]))
     cg.add(var.set_taps(config[CONF_TAPS]))
+
+    if config[CONF_ENGINE] == ENGINE_FIXED_POINT and config[CONF_BITS_PER_SAMPLE] == 16:
+        target_rate = config[CONF_SAMPLE_RATE]
+        for source_rate in FIXED_POINT_SOURCE_SAMPLE_RATES:
+            if source_rate == target_rate:
+                continue
+            filter_bank = _polyphase_filter_bank(
+                source_rate, target_rate, config[CONF_TAPS]
+            )
+            if filter_bank is None:
+                continue
+            phases, decimation, coefficients = filter_bank
+            coefficients_id = ID(
+                f"{config[CONF_ID].id}_filter_bank_{source_rate}",
+                is_declaration=True,
+                type=cg.int16,
+            )
+            coefficients_arr = cg.progmem_array(coefficients_id, coefficients)
+            cg.add(
+                var.add_filter_bank(
+                    source_rate, phases, decimation, config[CONF_TAPS], coefficients_arr
+                )
+            )
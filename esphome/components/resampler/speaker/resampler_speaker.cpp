@@ -262,6 +262,7 @@ void ResamplerSpeaker::resample_task(void *params) {
       make_unique<audio::AudioResampler>(this_resampler->audio_stream_info_.ms_to_bytes(TRANSFER_BUFFER_DURATION_MS),
                                          this_resampler->target_stream_info_.ms_to_bytes(TRANSFER_BUFFER_DURATION_MS));
 
+  resampler->set_filter_banks(&this_resampler->filter_banks_);
   esp_err_t err = resampler->start(this_resampler->audio_stream_info_, this_resampler->target_stream_info_,
                                    this_resampler->taps_, this_resampler->filters_);
 
@@ -4,6 +4,7 @@
 
 #include "esphome/components/audio/audio.h"
 #include "esphome/components/audio/audio_transfer_buffer.h"
+#include "esphome/components/audio/polyphase_resampler.h"
 #include "esphome/components/speaker/speaker.h"
 
 #include "esphome/core/component.h"
@@ -11,6 +12,8 @@
 #include <freertos/event_groups.h>
 #include <freertos/FreeRTOS.h>
 
+#include <vector>
+
 namespace esphome {
 namespace resampler {
 
@@ -51,6 +54,13 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
   void set_filters(uint16_t filters) { this->filters_ = filters; }
   void set_taps(uint16_t taps) { this->taps_ = taps; }
 
+  /// @brief Adds a fixed-point filter bank that resamples 16 bit audio from ``source_sample_rate`` to the target rate.
+  void add_filter_bank(uint32_t source_sample_rate, uint16_t phases, uint16_t decimation, uint16_t taps,
+                       const int16_t *coefficients) {
+    this->filter_banks_.push_back(
+        {source_sample_rate, this->target_sample_rate_, phases, decimation, taps, coefficients});
+  }
+
   void set_buffer_duration(uint32_t buffer_duration_ms) { this->buffer_duration_ms_ = buffer_duration_ms; }
 
  protected:
@@ -92,6 +102,8 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
 
   audio::AudioStreamInfo target_stream_info_;
 
+  std::vector<audio::PolyphaseFilterBank> filter_banks_;
+
   uint16_t taps_;
   uint16_t filters_;
 
@@ -7,7 +7,10 @@
 
 #include "preferences.h"
 
+#include <algorithm>
 #include <cstring>
+#include <map>
+#include <set>
 #include <vector>
 
 #include "esphome/core/helpers.h"
@@ -19,11 +22,21 @@ namespace rp2040 {
 
 static const char *const TAG = "rp2040.preferences";
 
-static bool s_prevent_write = false;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-static uint8_t *s_flash_storage = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-static bool s_flash_dirty = false;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-
-static const uint32_t RP2040_FLASH_STORAGE_SIZE = 512;
+static bool s_prevent_write = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// The EEPROM sector is used as an append-only log:
+//   [magic (uint32)] [record] [record] ... [erased (0xFF)]
+// with every record being
+//   [key (uint32)] [length (uint8)] [crc8 of key, length and data] [data]
+// When a key appears more than once the last record wins. A sync only appends the changed values
+// (programming the pages they touch), the sector is only erased when the log is full and gets compacted.
+static const uint32_t RP2040_FLASH_STORAGE_SIZE = FLASH_SECTOR_SIZE;
+static const uint32_t LOG_MAGIC = 0x314C5045;  // "EPL1"
+static const size_t LOG_HEADER_SIZE = sizeof(uint32_t);
+static const size_t RECORD_HEADER_SIZE = sizeof(uint32_t) + 2;
+static const size_t MAX_RECORD_DATA = 254;
+// Size of the fixed-offset layout used before the log, values are migrated from it when loaded
+static const uint32_t RP2040_LEGACY_STORAGE_SIZE = 512;
 
 extern "C" uint8_t _EEPROM_start;
 
@@ -36,117 +49,241 @@ template<class It> uint8_t calculate_crc(It first, It last, uint32_t type) {
   return crc;
 }
 
-class RP2040PreferenceBackend : public ESPPreferenceBackend {
+static uint8_t record_crc(uint32_t key, const uint8_t *data, uint8_t len) {
+  uint8_t header[5];
+  memcpy(header, &key, sizeof(key));
+  header[4] = len;
+  return crc8(data, len, crc8(header, sizeof(header)));
+}
+
+class RP2040Preferences : public ESPPreferences {
  public:
-  size_t offset = 0;
-  uint32_t type = 0;
+  uint32_t current_flash_offset = 0;
 
-  bool save(const uint8_t *data, size_t len) override {
-    std::vector<uint8_t> buffer;
-    buffer.resize(len + 1);
-    memcpy(buffer.data(), data, len);
-    buffer[buffer.size() - 1] = calculate_crc(buffer.begin(), buffer.end() - 1, type);
-
-    for (uint32_t i = 0; i < len + 1; i++) {
-      uint32_t j = offset + i;
-      if (j >= RP2040_FLASH_STORAGE_SIZE)
-        return false;
-      uint8_t v = buffer[i];
-      uint8_t *ptr = &s_flash_storage[j];
-      if (*ptr != v)
-        s_flash_dirty = true;
-      *ptr = v;
-    }
-    return true;
+  RP2040Preferences() : eeprom_sector_(&_EEPROM_start) {}
+  void setup();
+
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
+    return make_preference(length, type);
   }
-  bool load(uint8_t *data, size_t len) override {
-    std::vector<uint8_t> buffer;
-    buffer.resize(len + 1);
-
-    for (size_t i = 0; i < len + 1; i++) {
-      uint32_t j = offset + i;
-      if (j >= RP2040_FLASH_STORAGE_SIZE)
-        return false;
-      buffer[i] = s_flash_storage[j];
-    }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
 
-    uint8_t crc = calculate_crc(buffer.begin(), buffer.end() - 1, type);
-    if (buffer[buffer.size() - 1] != crc) {
+  bool save(uint32_t key, const uint8_t *data, size_t len) {
+    if (len > MAX_RECORD_DATA)
       return false;
-    }
-
-    memcpy(data, buffer.data(), len);
+    auto it = this->values_.find(key);
+    if (it != this->values_.end() && it->second.size() == len && memcmp(it->second.data(), data, len) == 0)
+      return true;
+    this->values_[key].assign(data, data + len);
+    this->dirty_.insert(key);
+    return true;
+  }
+  bool load(uint32_t key, uint8_t *data, size_t len) {
+    auto it = this->values_.find(key);
+    if (it == this->values_.end() || it->second.size() != len)
+      return false;
+    memcpy(data, it->second.data(), len);
+    return true;
+  }
+  bool load_legacy(uint32_t offset, uint32_t type, uint8_t *data, size_t len) {
+    if (this->legacy_storage_ == nullptr || offset + len + 1 > RP2040_LEGACY_STORAGE_SIZE)
+      return false;
+    const uint8_t *start = this->legacy_storage_ + offset;
+    if (start[len] != calculate_crc(start, start + len, type))
+      return false;
+    memcpy(data, start, len);
     return true;
   }
+
+  bool sync() override;
+  bool reset() override;
+
+ protected:
+  // Append a record to the RAM copy of the sector, returns false if it does not fit
+  bool append_record_(uint32_t key, const std::vector<uint8_t> &value);
+  bool compact_();
+  void program_(uint32_t offset, uint32_t length, bool erase);
+
+  uint8_t *eeprom_sector_;
+  // RAM copy of the flash sector
+  uint8_t *storage_{nullptr};
+  // Contents of the pre-log layout, only kept when the sector has not been converted yet
+  uint8_t *legacy_storage_{nullptr};
+  // Offset of the first erased byte of the log
+  uint32_t log_end_{0};
+  // The log is missing or damaged, it is rewritten on the next sync
+  bool needs_compact_{false};
+  std::map<uint32_t, std::vector<uint8_t>> values_;
+  // Keys whose value changed since the last sync
+  std::set<uint32_t> dirty_;
 };
 
-class RP2040Preferences : public ESPPreferences {
+static RP2040Preferences *s_preferences = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+class RP2040PreferenceBackend : public ESPPreferenceBackend {
  public:
-  uint32_t current_flash_offset = 0;
+  // Location of the value in the legacy layout
+  size_t offset = 0;
+  uint32_t type = 0;
 
-  RP2040Preferences() : eeprom_sector_(&_EEPROM_start) {}
-  void setup() {
-    s_flash_storage = new uint8_t[RP2040_FLASH_STORAGE_SIZE];  // NOLINT
-    ESP_LOGVV(TAG, "Loading preferences from flash");
-    memcpy(s_flash_storage, this->eeprom_sector_, RP2040_FLASH_STORAGE_SIZE);
+  bool save(const uint8_t *data, size_t len) override { return s_preferences->save(this->type, data, len); }
+  bool load(uint8_t *data, size_t len) override {
+    if (s_preferences->load(this->type, data, len))
+      return true;
+    if (!s_preferences->load_legacy(this->offset, this->type, data, len))
+      return false;
+    // Carry the value over, it is written to the log on the next sync
+    s_preferences->save(this->type, data, len);
+    return true;
   }
+};
 
-  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
-    return make_preference(length, type);
+void RP2040Preferences::setup() {
+  this->storage_ = new uint8_t[RP2040_FLASH_STORAGE_SIZE];  // NOLINT
+  ESP_LOGVV(TAG, "Loading preferences from flash");
+  memcpy(this->storage_, this->eeprom_sector_, RP2040_FLASH_STORAGE_SIZE);
+
+  uint32_t magic;
+  memcpy(&magic, this->storage_, sizeof(magic));
+  if (magic != LOG_MAGIC) {
+    const uint8_t *begin = this->storage_;
+    const uint8_t *end = begin + RP2040_LEGACY_STORAGE_SIZE;
+    if (std::any_of(begin, end, [](uint8_t b) { return b != 0xFF; })) {
+      ESP_LOGD(TAG, "Migrating preferences to log storage");
+      this->legacy_storage_ = new uint8_t[RP2040_LEGACY_STORAGE_SIZE];  // NOLINT
+      memcpy(this->legacy_storage_, this->storage_, RP2040_LEGACY_STORAGE_SIZE);
+    }
+    this->needs_compact_ = true;
+    return;
   }
 
-  ESPPreferenceObject make_preference(size_t length, uint32_t type) override {
-    uint32_t start = this->current_flash_offset;
-    uint32_t end = start + length + 1;
-    if (end > RP2040_FLASH_STORAGE_SIZE) {
-      return {};
+  // Replay the log up to the first erased or damaged record
+  uint32_t pos = LOG_HEADER_SIZE;
+  while (pos + RECORD_HEADER_SIZE <= RP2040_FLASH_STORAGE_SIZE) {
+    const uint8_t *record = this->storage_ + pos;
+    if (std::all_of(record, record + RECORD_HEADER_SIZE, [](uint8_t b) { return b == 0xFF; }))
+      break;
+    uint32_t key;
+    memcpy(&key, record, sizeof(key));
+    const uint8_t len = record[4];
+    const uint8_t *data = record + RECORD_HEADER_SIZE;
+    if (len > MAX_RECORD_DATA || pos + RECORD_HEADER_SIZE + len > RP2040_FLASH_STORAGE_SIZE ||
+        record[5] != record_crc(key, data, len)) {
+      // Interrupted write, the bytes after this point can not be appended to
+      ESP_LOGW(TAG, "Damaged record at offset %" PRIu32, pos);
+      this->needs_compact_ = true;
+      break;
     }
-    auto *pref = new RP2040PreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
-    pref->offset = start;
-    pref->type = type;
-    current_flash_offset = end;
-    return {pref};
+    this->values_[key].assign(data, data + len);
+    pos += RECORD_HEADER_SIZE + len;
   }
+  this->log_end_ = pos;
+}
 
-  bool sync() override {
-    if (!s_flash_dirty)
-      return true;
-    if (s_prevent_write)
-      return false;
+ESPPreferenceObject RP2040Preferences::make_preference(size_t length, uint32_t type) {
+  if (length > MAX_RECORD_DATA)
+    return {};
+  auto *pref = new RP2040PreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
+  pref->offset = this->current_flash_offset;
+  pref->type = type;
+  this->current_flash_offset += length + 1;
+  return {pref};
+}
 
-    ESP_LOGD(TAG, "Saving");
+bool RP2040Preferences::append_record_(uint32_t key, const std::vector<uint8_t> &value) {
+  const uint8_t len = value.size();
+  if (this->log_end_ + RECORD_HEADER_SIZE + len > RP2040_FLASH_STORAGE_SIZE)
+    return false;
+  uint8_t *record = this->storage_ + this->log_end_;
+  memcpy(record, &key, sizeof(key));
+  record[4] = len;
+  record[5] = record_crc(key, value.data(), len);
+  memcpy(record + RECORD_HEADER_SIZE, value.data(), len);
+  this->log_end_ += RECORD_HEADER_SIZE + len;
+  return true;
+}
 
-    {
-      InterruptLock lock;
-      ::rp2040.idleOtherCore();
-      flash_range_erase((intptr_t) eeprom_sector_ - (intptr_t) XIP_BASE, 4096);
-      flash_range_program((intptr_t) eeprom_sector_ - (intptr_t) XIP_BASE, s_flash_storage, RP2040_FLASH_STORAGE_SIZE);
-      ::rp2040.resumeOtherCore();
-    }
+void RP2040Preferences::program_(uint32_t offset, uint32_t length, bool erase) {
+  // Flash can only be programmed in whole pages. Bytes that are programmed again with their current
+  // value stay unchanged, so the pages shared with earlier records can simply be written again.
+  const uint32_t start = offset & ~(FLASH_PAGE_SIZE - 1);
+  const uint32_t end = (offset + length + FLASH_PAGE_SIZE - 1) & ~(FLASH_PAGE_SIZE - 1);
+  const intptr_t base = (intptr_t) this->eeprom_sector_ - (intptr_t) XIP_BASE;
+  InterruptLock lock;
+  ::rp2040.idleOtherCore();
+  if (erase)
+    flash_range_erase(base, RP2040_FLASH_STORAGE_SIZE);
+  flash_range_program(base + start, this->storage_ + start, end - start);
+  ::rp2040.resumeOtherCore();
+}
 
-    s_flash_dirty = false;
-    return true;
+bool RP2040Preferences::compact_() {
+  memset(this->storage_, 0xFF, RP2040_FLASH_STORAGE_SIZE);
+  memcpy(this->storage_, &LOG_MAGIC, sizeof(LOG_MAGIC));
+  this->log_end_ = LOG_HEADER_SIZE;
+  bool ok = true;
+  for (const auto &it : this->values_) {
+    if (!this->append_record_(it.first, it.second)) {
+      ESP_LOGE(TAG, "Preferences do not fit in %" PRIu32 " bytes", RP2040_FLASH_STORAGE_SIZE);
+      ok = false;
+      break;
+    }
   }
+  ESP_LOGD(TAG, "Compacting (%" PRIu32 " bytes used)", this->log_end_);
+  this->program_(0, this->log_end_, true);
+  this->needs_compact_ = false;
+  return ok;
+}
 
-  bool reset() override {
-    ESP_LOGD(TAG, "Erasing storage");
-    {
-      InterruptLock lock;
-      ::rp2040.idleOtherCore();
-      flash_range_erase((intptr_t) eeprom_sector_ - (intptr_t) XIP_BASE, 4096);
-      ::rp2040.resumeOtherCore();
-    }
-    s_prevent_write = true;
+bool RP2040Preferences::sync() {
+  if (this->dirty_.empty() && !this->needs_compact_)
     return true;
+  if (s_prevent_write)
+    return false;
+
+  if (!this->needs_compact_) {
+    const uint32_t start = this->log_end_;
+    bool fits = true;
+    for (uint32_t key : this->dirty_) {
+      if (!this->append_record_(key, this->values_[key])) {
+        fits = false;
+        break;
+      }
+    }
+    if (fits) {
+      ESP_LOGD(TAG, "Saving");
+      this->program_(start, this->log_end_ - start, false);
+    } else {
+      // Undo the partial append, the compacted log holds the new values as well
+      memset(this->storage_ + start, 0xFF, RP2040_FLASH_STORAGE_SIZE - start);
+      this->log_end_ = start;
+      this->needs_compact_ = true;
+    }
   }
+  bool ok = true;
+  if (this->needs_compact_)
+    ok = this->compact_();
 
- protected:
-  uint8_t *eeprom_sector_;
-};
+  this->dirty_.clear();
+  return ok;
+}
+
+bool RP2040Preferences::reset() {
+  ESP_LOGD(TAG, "Erasing storage");
+  {
+    InterruptLock lock;
+    ::rp2040.idleOtherCore();
+    flash_range_erase((intptr_t) eeprom_sector_ - (intptr_t) XIP_BASE, RP2040_FLASH_STORAGE_SIZE);
+    ::rp2040.resumeOtherCore();
+  }
+  s_prevent_write = true;
+  return true;
+}
 
 void setup_preferences() {
   auto *prefs = new RP2040Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
   prefs->setup();
+  s_preferences = prefs;
   global_preferences = prefs;
 }
 void preferences_prevent_write(bool prevent) { s_prevent_write = prevent; }
@@ -17,8 +17,7 @@ void RuntimeStatsCollector::record_component_time(Component *component, uint32_t
   if (component == nullptr)
     return;
 
-  // Record stats using component pointer as key
-  this->component_stats_[component].record_time(duration_ms);
+  this->get_entry_(component)->runtime.record_time(duration_ms);
 
   if (this->next_log_time_ == 0) {
     this->next_log_time_ = current_time + this->log_interval_;
@@ -26,6 +25,25 @@ void RuntimeStatsCollector::record_component_time(Component *component, uint32_t
   }
 }
 
+ComponentStatsEntry *RuntimeStatsCollector::get_entry_(Component *component) {
+  if (component->runtime_stats_ == nullptr)
+    component->runtime_stats_ = &this->component_stats_[component];
+  return component->runtime_stats_;
+}
+
+const LogString *runtime_stats_source_to_string(RuntimeStatsSource source) {
+  switch (source) {
+    case SOURCE_LOOP:
+      return LOG_STR("loop");
+    case SOURCE_UPDATE:
+      return LOG_STR("update");
+    case SOURCE_SCHEDULER:
+      return LOG_STR("scheduler");
+    default:
+      return LOG_STR("unknown");
+  }
+}
+
 void RuntimeStatsCollector::log_stats_() {
   ESP_LOGI(TAG, "Component Runtime Statistics");
   ESP_LOGI(TAG, "Period stats (last %" PRIu32 "ms):", this->log_interval_);
@@ -35,7 +53,7 @@ void RuntimeStatsCollector::log_stats_() {
 
   for (const auto &it : this->component_stats_) {
     Component *component = it.first;
-    const ComponentRuntimeStats &stats = it.second;
+    const ComponentRuntimeStats &stats = it.second.runtime;
     if (stats.get_period_count() > 0) {
       ComponentStatPair pair = {component, &stats};
       stats_to_display.push_back(pair);
@@ -52,6 +70,22 @@ void RuntimeStatsCollector::log_stats_() {
              it.stats->get_period_avg_time_ms(), it.stats->get_period_max_time_ms(), it.stats->get_period_time_ms());
   }
 
+  // Log latency percentiles of the period, in component order
+  ESP_LOGI(TAG, "Latency percentiles (last %" PRIu32 "ms):", this->log_interval_);
+  for (const auto &it : this->component_stats_) {
+    for (uint8_t source = 0; source < SOURCE_COUNT; source++) {
+      const LatencyHistogram *histogram = it.second.histograms[source].get();
+      if (histogram == nullptr || histogram->get_count() == 0)
+        continue;
+      ESP_LOGI(TAG, "  %s [%s]: n=%" PRIu32 ", p50=%.2fms, p99=%.2fms, p999=%.2fms, max=%.2fms",
+               LOG_STR_ARG(it.first->get_component_log_str()),
+               LOG_STR_ARG(runtime_stats_source_to_string(static_cast<RuntimeStatsSource>(source))),
+               histogram->get_count(), histogram->get_percentile_us(50.0f) / 1000.0f,
+               histogram->get_percentile_us(99.0f) / 1000.0f, histogram->get_percentile_us(99.9f) / 1000.0f,
+               histogram->get_max_us() / 1000.0f);
+    }
+  }
+
   // Log total stats since boot
   ESP_LOGI(TAG, "Total stats (since boot):");
 
@@ -74,11 +108,29 @@ void RuntimeStatsCollector::process_pending_stats(uint32_t current_time) {
 
   if (current_time >= this->next_log_time_) {
     this->log_stats_();
+#ifdef USE_SENSOR
+    this->publish_sensors_();
+#endif
     this->reset_stats_();
     this->next_log_time_ = current_time + this->log_interval_;
   }
 }
 
+#ifdef USE_SENSOR
+void RuntimeStatsCollector::publish_sensors_() {
+  for (auto *sensor : this->sensors_) {
+    auto it = this->component_stats_.find(sensor->get_component());
+    if (it == this->component_stats_.end())
+      continue;
+    const LatencyHistogram *histogram = it->second.histograms[sensor->get_source()].get();
+    // Keep the previous state if the component did not run for this source during the period
+    if (histogram == nullptr || histogram->get_count() == 0)
+      continue;
+    sensor->publish_state(histogram->get_percentile_us(sensor->get_percentile()) / 1000.0f);
+  }
+}
+#endif
+
 }  // namespace runtime_stats
 
 runtime_stats::RuntimeStatsCollector *global_runtime_stats =
@@ -4,13 +4,19 @@
 
 #ifdef USE_RUNTIME_STATS
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <vector>
 #include <cstdint>
 #include <cstring>
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
 namespace esphome {
 
 class Component;  // Forward declaration
@@ -77,6 +83,91 @@ class ComponentRuntimeStats {
   uint32_t total_max_time_ms_;
 };
 
+/// What a latency sample was measured for
+enum RuntimeStatsSource : uint8_t {
+  SOURCE_LOOP = 0,       ///< Component::loop() from the main loop
+  SOURCE_UPDATE = 1,     ///< PollingComponent::update() (the "update" interval)
+  SOURCE_SCHEDULER = 2,  ///< Any other timeout, interval or defer callback
+  SOURCE_COUNT = 3,
+};
+
+const LogString *runtime_stats_source_to_string(RuntimeStatsSource source);
+
+/** Fixed-memory latency histogram with logarithmic buckets.
+ *
+ * Samples are in microseconds. Every power of two is split into two buckets and 48 buckets cover everything
+ * up to ~16.7s (longer samples land in the last bucket). Percentiles are reported as the upper edge of their
+ * bucket, so they err on the high side by less than 50%. Memory use is constant no matter how many samples
+ * are recorded.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr uint8_t BUCKETS = 48;
+
+  void record(uint32_t duration_us) {
+    this->counts_[bucket_for(duration_us)]++;
+    this->count_++;
+    if (duration_us > this->max_us_)
+      this->max_us_ = duration_us;
+  }
+
+  void reset() {
+    memset(this->counts_, 0, sizeof(this->counts_));
+    this->count_ = 0;
+    this->max_us_ = 0;
+  }
+
+  uint32_t get_count() const { return this->count_; }
+  uint32_t get_max_us() const { return this->max_us_; }
+
+  /// Upper bound of the bucket holding the given percentile (0-100), never more than the largest sample.
+  uint32_t get_percentile_us(float percentile) const {
+    if (this->count_ == 0)
+      return 0;
+    // Rank of the sample we are looking for, 1-based
+    uint32_t rank = static_cast<uint32_t>(this->count_ * (percentile / 100.0f) + 0.5f);
+    if (rank == 0)
+      rank = 1;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+      seen += this->counts_[i];
+      if (seen >= rank)
+        return std::min(bucket_upper_bound(i), this->max_us_);
+    }
+    return this->max_us_;
+  }
+
+  static uint8_t bucket_for(uint32_t duration_us) {
+    if (duration_us < 2)
+      return duration_us;
+    // Two buckets per power of two: the exponent and the bit below the leading one
+    const uint8_t exponent = 31 - __builtin_clz(duration_us);
+    const uint8_t bucket = exponent * 2 + ((duration_us >> (exponent - 1)) & 1);
+    return bucket < BUCKETS ? bucket : BUCKETS - 1;
+  }
+
+  static uint32_t bucket_upper_bound(uint8_t bucket) {
+    if (bucket < 2)
+      return bucket;
+    const uint8_t exponent = bucket / 2;
+    const uint32_t lower = (2u + (bucket & 1)) << (exponent - 1);
+    return lower + (1u << (exponent - 1)) - 1;
+  }
+
+ protected:
+  uint32_t counts_[BUCKETS]{};
+  uint32_t count_{0};
+  uint32_t max_us_{0};
+};
+
+/// Everything recorded for one component. The component caches a pointer to its entry, so the map is only searched
+/// on its first sample.
+struct ComponentStatsEntry {
+  ComponentRuntimeStats runtime;
+  /// Latency histograms of the current period, created on the first sample of each source
+  std::unique_ptr<LatencyHistogram> histograms[SOURCE_COUNT];
+};
+
 // For sorting components by run time
 struct ComponentStatPair {
   Component *component;
@@ -88,6 +179,24 @@ struct ComponentStatPair {
   }
 };
 
+#ifdef USE_SENSOR
+/// Publishes a latency percentile of one component at the end of every log interval
+class RuntimeStatsSensor : public sensor::Sensor {
+ public:
+  void set_component(Component *component) { this->component_ = component; }
+  Component *get_component() const { return this->component_; }
+  void set_source(RuntimeStatsSource source) { this->source_ = source; }
+  RuntimeStatsSource get_source() const { return this->source_; }
+  void set_percentile(float percentile) { this->percentile_ = percentile; }
+  float get_percentile() const { return this->percentile_; }
+
+ protected:
+  Component *component_{nullptr};
+  float percentile_{99.0f};
+  RuntimeStatsSource source_{SOURCE_LOOP};
+};
+#endif
+
 class RuntimeStatsCollector {
  public:
   RuntimeStatsCollector();
@@ -97,21 +206,47 @@ class RuntimeStatsCollector {
 
   void record_component_time(Component *component, uint32_t duration_ms, uint32_t current_time);
 
+  /// Record a latency sample (in microseconds) into the histogram of the given component and source
+  void record_latency(Component *component, RuntimeStatsSource source, uint32_t duration_us) {
+    if (component == nullptr)
+      return;
+    std::unique_ptr<LatencyHistogram> &histogram = this->get_entry_(component)->histograms[source];
+    if (histogram == nullptr)
+      histogram = make_unique<LatencyHistogram>();
+    histogram->record(duration_us);
+  }
+
+#ifdef USE_SENSOR
+  void register_sensor(RuntimeStatsSensor *sensor) { this->sensors_.push_back(sensor); }
+#endif
+
   // Process any pending stats printing (should be called after component loop)
   void process_pending_stats(uint32_t current_time);
 
  protected:
   void log_stats_();
+#ifdef USE_SENSOR
+  void publish_sensors_();
+#endif
+  /// Entry of the component, created on its first sample and cached in the component afterwards
+  ComponentStatsEntry *get_entry_(Component *component);
 
   void reset_stats_() {
     for (auto &it : this->component_stats_) {
-      it.second.reset_period_stats();
+      it.second.runtime.reset_period_stats();
+      for (auto &histogram : it.second.histograms) {
+        if (histogram != nullptr)
+          histogram->reset();
+      }
     }
   }
 
   // Map from component to its stats
-  // We use Component* as the key since each component is unique
-  std::map<Component *, ComponentRuntimeStats> component_stats_;
+  // We use Component* as the key since each component is unique, map nodes never move so the cached pointers stay valid
+  std::map<Component *, ComponentStatsEntry> component_stats_;
+#ifdef USE_SENSOR
+  std::vector<RuntimeStatsSensor *> sensors_;
+#endif
   uint32_t log_interval_;
   uint32_t next_log_time_;
 };
@@ -0,0 +1,53 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_COMPONENT_ID,
+    CONF_SOURCE,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
+)
+
+from . import RuntimeStatsCollector, runtime_stats_ns
+
+DEPENDENCIES = ["runtime_stats"]
+
+CONF_PERCENTILE = "percentile"
+CONF_RUNTIME_STATS_ID = "runtime_stats_id"
+
+RuntimeStatsSensor = runtime_stats_ns.class_("RuntimeStatsSensor", sensor.Sensor)
+
+RuntimeStatsSource = runtime_stats_ns.enum("RuntimeStatsSource")
+SOURCES = {
+    "loop": RuntimeStatsSource.SOURCE_LOOP,
+    "update": RuntimeStatsSource.SOURCE_UPDATE,
+    "scheduler": RuntimeStatsSource.SOURCE_SCHEDULER,
+}
+
+CONFIG_SCHEMA = sensor.sensor_schema(
+    RuntimeStatsSensor,
+    unit_of_measurement=UNIT_MILLISECOND,
+    icon=ICON_TIMER,
+    accuracy_decimals=2,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+).extend(
+    {
+        cv.GenerateID(CONF_RUNTIME_STATS_ID): cv.use_id(RuntimeStatsCollector),
+        cv.Required(CONF_COMPONENT_ID): cv.use_id(cg.Component),
+        cv.Optional(CONF_SOURCE, default="loop"): cv.enum(SOURCES, lower=True),
+        cv.Optional(CONF_PERCENTILE, default=99.0): cv.float_range(min=0, max=100),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_RUNTIME_STATS_ID])
+    component = await cg.get_variable(config[CONF_COMPONENT_ID])
+    var = await sensor.new_sensor(config)
+    cg.add(var.set_component(component))
+    cg.add(var.set_source(config[CONF_SOURCE]))
+    cg.add(var.set_percentile(config[CONF_PERCENTILE]))
+    cg.add(parent.register_sensor(var))
@@ -0,0 +1,36 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["logger"]
+
+CONF_SAMPLE_INTERVAL = "sample_interval"
+CONF_TOP = "top"
+
+sampling_profiler_ns = cg.esphome_ns.namespace("sampling_profiler")
+SamplingProfiler = sampling_profiler_ns.class_(
+    "SamplingProfiler", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(SamplingProfiler),
+            # The FreeRTOS tick (1ms) is the sampling clock
+            cv.Optional(CONF_SAMPLE_INTERVAL, default="10ms"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=1)),
+            ),
+            cv.Optional(CONF_TOP, default=10): cv.int_range(min=1, max=50),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.only_on_esp32,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_sample_interval(config[CONF_SAMPLE_INTERVAL]))
+    cg.add(var.set_top(config[CONF_TOP]))
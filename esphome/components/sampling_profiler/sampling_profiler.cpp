@@ -0,0 +1,153 @@
+#include "sampling_profiler.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <esp_freertos_hooks.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+#if defined(__XTENSA__)
+#if __has_include(<xtensa_context.h>)
+#include <xtensa_context.h>
+#else
+#include <freertos/xtensa_context.h>
+#endif
+#elif defined(__riscv)
+#include <riscv/rvruntime-frames.h>
+#endif
+
+namespace esphome {
+namespace sampling_profiler {
+
+static const char *const TAG = "sampling_profiler";
+
+// Tick hooks take no argument
+static SamplingProfiler *global_profiler = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void SamplingProfiler::setup() {
+  // setup() runs in the loop task
+  this->task_ = xTaskGetCurrentTaskHandle();
+  this->sample_divider_ = std::max<uint32_t>(1, this->sample_interval_ms_ * configTICK_RATE_HZ / 1000);
+  this->period_start_ = millis();
+  global_profiler = this;
+  // The loop task is not pinned, so watch every core
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    if (esp_register_freertos_tick_hook_for_cpu(SamplingProfiler::tick_hook_, core) != ESP_OK) {
+      ESP_LOGE(TAG, "Could not register tick hook on core %d", core);
+      this->mark_failed();
+      return;
+    }
+  }
+}
+
+void SamplingProfiler::on_shutdown() {
+  for (int core = 0; core < portNUM_PROCESSORS; core++)
+    esp_deregister_freertos_tick_hook_for_cpu(SamplingProfiler::tick_hook_, core);
+  global_profiler = nullptr;
+}
+
+void IRAM_ATTR SamplingProfiler::tick_hook_() {
+  SamplingProfiler *self = global_profiler;
+  if (self == nullptr)
+    return;
+  const int core = xPortGetCoreID();
+  if (++self->ticks_[core] < self->sample_divider_)
+    return;
+  self->ticks_[core] = 0;
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  if (task != self->task_)
+    return;
+
+  // On interrupt entry the port saves the interrupted context on the task stack and stores the stack
+  // pointer in the first member of the TCB (pxTopOfStack), so the frame holds the PC the task was at.
+  const void *frame = *reinterpret_cast<void *const *>(task);
+#if defined(__XTENSA__)
+  const uint32_t pc = static_cast<const XtExcFrame *>(frame)->pc;
+#elif defined(__riscv)
+  const uint32_t pc = static_cast<const RvExcFrame *>(frame)->mepc;
+#else
+  const uint32_t pc = 0;
+#endif
+
+  // Single producer: only the core currently running the loop task gets here
+  const uint16_t head = self->ring_head_.load(std::memory_order_relaxed);
+  if (static_cast<uint16_t>(head - self->ring_tail_.load(std::memory_order_acquire)) >= RING_SIZE) {
+    self->dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  self->ring_[head & (RING_SIZE - 1)] = pc;
+  self->ring_head_.store(head + 1, std::memory_order_release);
+}
+
+void SamplingProfiler::loop() { this->drain_(); }
+
+void SamplingProfiler::drain_() {
+  const uint16_t head = this->ring_head_.load(std::memory_order_acquire);
+  uint16_t tail = this->ring_tail_.load(std::memory_order_relaxed);
+  while (tail != head) {
+    this->record_(this->ring_[tail & (RING_SIZE - 1)]);
+    tail++;
+  }
+  this->ring_tail_.store(tail, std::memory_order_release);
+}
+
+void SamplingProfiler::record_(uint32_t pc) {
+  this->samples_++;
+  // Open addressing on the PC, instructions are at least 2-byte aligned
+  uint16_t i = (pc >> 1) % TABLE_SIZE;
+  for (uint16_t probe = 0; probe < TABLE_SIZE; probe++, i = (i + 1) % TABLE_SIZE) {
+    Entry &entry = this->table_[i];
+    if (entry.count == 0) {
+      entry.pc = pc;
+      entry.count = 1;
+      return;
+    }
+    if (entry.pc == pc) {
+      entry.count++;
+      return;
+    }
+  }
+  this->other_++;
+}
+
+void SamplingProfiler::update() {
+  this->drain_();
+  const uint32_t now = millis();
+  const uint32_t dropped = this->dropped_.exchange(0, std::memory_order_relaxed);
+
+  ESP_LOGI(TAG, "%" PRIu32 " samples in %" PRIu32 "ms (%" PRIu32 " dropped, %" PRIu32 " untracked):", this->samples_,
+           now - this->period_start_, dropped, this->other_);
+  if (this->samples_ != 0) {
+    // Only the top entries are needed, move them to the front
+    const uint8_t top = std::min<uint16_t>(this->top_, TABLE_SIZE);
+    std::partial_sort(this->table_, this->table_ + top, this->table_ + TABLE_SIZE,
+                      [](const Entry &a, const Entry &b) { return a.count > b.count; });
+    for (uint8_t i = 0; i < top && this->table_[i].count != 0; i++) {
+      ESP_LOGI(TAG, "  PC: 0x%08" PRIX32 " %" PRIu32 " samples (%.1f%%)", this->table_[i].pc, this->table_[i].count,
+               this->table_[i].count * 100.0f / this->samples_);
+    }
+  }
+
+  std::fill(std::begin(this->table_), std::end(this->table_), Entry{0, 0});
+  this->samples_ = 0;
+  this->other_ = 0;
+  this->period_start_ = now;
+}
+
+void SamplingProfiler::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Sampling Profiler:\n"
+                "  Sample Interval: %" PRIu32 "ms\n"
+                "  Report Top: %u",
+                this->sample_interval_ms_, this->top_);
+  LOG_UPDATE_INTERVAL(this);
+}
+
+}  // namespace sampling_profiler
+}  // namespace esphome
+
+#endif  // USE_ESP32
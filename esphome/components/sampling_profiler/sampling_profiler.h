@@ -0,0 +1,71 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/core/component.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace sampling_profiler {
+
+/** Statistical profiler for the main loop task.
+ *
+ * A FreeRTOS tick hook (which runs in the tick ISR on every core) records the program counter the loop
+ * task was interrupted at into a lock-free ring buffer. loop() folds the buffer into a fixed-size table of
+ * PC -> sample count, and update() logs the hottest addresses of the report period. The log lines use the
+ * same `PC: 0x...` form as crash dumps, so `esphome logs` (serial or API) decodes them with addr2line
+ * against the firmware ELF of the build.
+ */
+class SamplingProfiler : public PollingComponent {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  void on_shutdown() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_sample_interval(uint32_t sample_interval_ms) { this->sample_interval_ms_ = sample_interval_ms; }
+  void set_top(uint8_t top) { this->top_ = top; }
+
+ protected:
+  // Power of two, written from the tick ISR and drained by loop()
+  static constexpr uint16_t RING_SIZE = 256;
+  // Distinct PCs tracked per report period, further PCs are only counted as "other"
+  static constexpr uint16_t TABLE_SIZE = 128;
+
+  struct Entry {
+    uint32_t pc;
+    uint32_t count;
+  };
+
+  static void tick_hook_();
+  void record_(uint32_t pc);
+  void drain_();
+
+  TaskHandle_t task_{nullptr};
+  uint32_t sample_interval_ms_{10};
+  uint32_t sample_divider_{1};
+  uint32_t ticks_[portNUM_PROCESSORS]{};
+
+  uint32_t ring_[RING_SIZE]{};
+  std::atomic<uint16_t> ring_head_{0};  // written by the ISR
+  std::atomic<uint16_t> ring_tail_{0};  // written by loop()
+  std::atomic<uint32_t> dropped_{0};
+
+  Entry table_[TABLE_SIZE]{};
+  uint32_t samples_{0};
+  uint32_t other_{0};
+  uint32_t period_start_{0};
+  uint8_t top_{10};
+};
+
+}  // namespace sampling_profiler
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -4,7 +4,9 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 
-#include <queue>
+#include <algorithm>
+#include <tuple>
+#include <vector>
 namespace esphome {
 namespace script {
 
@@ -95,7 +97,8 @@ template<typename... Ts> class RestartScript : public Script<Ts...> {
 
 /** A script type that queues new instances that are created.
  *
- * Only one instance of the script can be active at a time.
+ * Only one instance of the script can be active at a time. The arguments of queued instances are kept in a ring
+ * buffer, which is allocated once for max_runs and only grows when the number of runs is unlimited.
  */
 template<typename... Ts> class QueueingScript : public Script<Ts...>, public Component {
  public:
@@ -111,8 +114,10 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
 
       this->esp_logd_(__LINE__, ESPHOME_LOG_FORMAT("Script '%s' queueing new instance (mode: queued)"),
                       this->name_.c_str());
+      if (this->num_runs_ == static_cast<int>(this->var_queue_.size()))
+        this->grow_queue_();
+      this->var_queue_[(this->queue_front_ + this->num_runs_) % this->var_queue_.size()] = std::make_tuple(x...);
       this->num_runs_++;
-      this->var_queue_.push(std::make_tuple(x...));
       return;
     }
 
@@ -129,22 +134,35 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
   void loop() override {
     if (this->num_runs_ != 0 && !this->is_action_running()) {
       this->num_runs_--;
-      auto &vars = this->var_queue_.front();
-      this->var_queue_.pop();
+      auto vars = std::move(this->var_queue_[this->queue_front_]);
+      this->queue_front_ = (this->queue_front_ + 1) % this->var_queue_.size();
       this->trigger_tuple_(vars, typename gens<sizeof...(Ts)>::type());
     }
   }
 
-  void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  void set_max_runs(int max_runs) {
+    max_runs_ = max_runs;
+    // The running instance is not queued
+    if (max_runs > 1)
+      this->var_queue_.resize(max_runs - 1);
+  }
 
  protected:
   template<int... S> void trigger_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->trigger(std::get<S>(tuple)...);
   }
 
+  /// Adds a slot to the full ring, only needed when the number of runs is unlimited.
+  void grow_queue_() {
+    std::rotate(this->var_queue_.begin(), this->var_queue_.begin() + this->queue_front_, this->var_queue_.end());
+    this->queue_front_ = 0;
+    this->var_queue_.emplace_back();
+  }
+
   int num_runs_ = 0;
   int max_runs_ = 0;
-  std::queue<std::tuple<Ts...>> var_queue_;
+  size_t queue_front_ = 0;
+  std::vector<std::tuple<Ts...>> var_queue_;
 };
 
 /** A script type that executes new instances in parallel.
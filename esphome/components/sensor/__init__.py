@@ -103,7 +103,11 @@ from esphome.const import (
     ENTITY_CATEGORY_CONFIG,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
-from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
+from esphome.core.entity_helpers import (
+    entity_duplicate_validator,
+    entity_string,
+    setup_entity,
+)
 from esphome.cpp_generator import MockObjClass
 from esphome.util import Registry
 
@@ -827,11 +831,11 @@ async def setup_sensor_core_(var, config):
     await setup_entity(var, config, "sensor")
 
     if (device_class := config.get(CONF_DEVICE_CLASS)) is not None:
-        cg.add(var.set_device_class(device_class))
+        cg.add(var.set_device_class(entity_string(device_class)))
     if (state_class := config.get(CONF_STATE_CLASS)) is not None:
         cg.add(var.set_state_class(state_class))
     if (unit_of_measurement := config.get(CONF_UNIT_OF_MEASUREMENT)) is not None:
-        cg.add(var.set_unit_of_measurement(unit_of_measurement))
+        cg.add(var.set_unit_of_measurement(entity_string(unit_of_measurement)))
     if (accuracy_decimals := config.get(CONF_ACCURACY_DECIMALS)) is not None:
         cg.add(var.set_accuracy_decimals(accuracy_decimals))
     cg.add(var.set_force_update(config[CONF_FORCE_UPDATE]))
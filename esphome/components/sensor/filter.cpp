@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
@@ -9,6 +10,8 @@ namespace esphome {
 namespace sensor {
 
 static const char *const TAG = "sensor.filter";
+/// Values collected on the stack before they are passed on to the next filter.
+static const size_t BATCH_SIZE = 32;
 
 // Filter
 void Filter::input(float value) {
@@ -17,6 +20,31 @@ void Filter::input(float value) {
   if (out.has_value())
     this->output(*out);
 }
+void Filter::input_batch(const float *values, size_t count) {
+  ESP_LOGVV(TAG, "Filter(%p)::input_batch(%zu values)", this, count);
+  float out[BATCH_SIZE];
+  size_t out_count = 0;
+  for (size_t i = 0; i != count; i++) {
+    optional<float> value = this->new_value(values[i]);
+    if (!value.has_value())
+      continue;
+    out[out_count++] = *value;
+    if (out_count == BATCH_SIZE) {
+      this->output_batch(out, out_count);
+      out_count = 0;
+    }
+  }
+  if (out_count != 0)
+    this->output_batch(out, out_count);
+}
+void Filter::output_batch(const float *values, size_t count) {
+  if (this->next_ == nullptr) {
+    for (size_t i = 0; i != count; i++)
+      this->parent_->internal_send_state_to_frontend(values[i]);
+  } else {
+    this->next_->input_batch(values, count);
+  }
+}
 void Filter::output(float value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%f) -> SENSOR", this, value);
@@ -32,41 +60,45 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// Keep a sorted copy of a window up to date as values enter and leave it, NaN values are left out
+static void sorted_insert(std::vector<float> &sorted, float value) {
+  if (!std::isnan(value))
+    sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), value), value);
+}
+static void sorted_erase(std::vector<float> &sorted, float value) {
+  if (!std::isnan(value))
+    sorted.erase(std::lower_bound(sorted.begin(), sorted.end(), value));
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {
+  this->queue_.reserve(window_size);
+}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.reserve(window_size);
+}
 optional<float> MedianFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    sorted_erase(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  sorted_insert(this->sorted_, value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      median_queue.reserve(this->queue_.size());
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = this->sorted_[queue_size / 2];
+      } else {
+        median = (this->sorted_[queue_size / 2] + this->sorted_[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -91,38 +123,33 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {
+  this->queue_.reserve(window_size);
+}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.reserve(window_size);
+}
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    sorted_erase(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  sorted_insert(this->sorted_, value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
+      result = this->sorted_[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -133,25 +160,35 @@ optional<float> QuantileFilter::new_value(float value) {
 
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {
+  this->queue_.reserve(window_size);
+  this->extremes_.reserve(window_size);
+}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.reserve(window_size);
+  this->extremes_.reserve(window_size);
+}
 optional<float> MinFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    if (!this->extremes_.empty() && this->extremes_.front() == this->queue_.front())
+      this->extremes_.pop_front();
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  if (!std::isnan(value)) {
+    // Larger older values can never be the minimum again
+    while (!this->extremes_.empty() && this->extremes_.back() > value)
+      this->extremes_.pop_back();
+    this->extremes_.push_back(value);
+  }
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
+    float min = this->extremes_.empty() ? NAN : this->extremes_.front();
 
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
@@ -161,25 +198,35 @@ optional<float> MinFilter::new_value(float value) {
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {
+  this->queue_.reserve(window_size);
+  this->extremes_.reserve(window_size);
+}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.reserve(window_size);
+  this->extremes_.reserve(window_size);
+}
 optional<float> MaxFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    if (!this->extremes_.empty() && this->extremes_.front() == this->queue_.front())
+      this->extremes_.pop_front();
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  if (!std::isnan(value)) {
+    // Smaller older values can never be the maximum again
+    while (!this->extremes_.empty() && this->extremes_.back() < value)
+      this->extremes_.pop_back();
+    this->extremes_.push_back(value);
+  }
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
+    float max = this->extremes_.empty() ? NAN : this->extremes_.front();
 
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
@@ -190,31 +237,46 @@ optional<float> MaxFilter::new_value(float value) {
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {
+  this->queue_.reserve(window_size);
+}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.reserve(window_size);
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    float old = this->queue_.front();
+    if (!std::isnan(old)) {
+      this->sum_ -= old;
+      this->valid_count_--;
+    }
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  if (++this->since_sum_ >= this->window_size_) {
+    this->since_sum_ = 0;
+    this->sum_ = 0;
+    this->valid_count_ = 0;
+    for (size_t i = 0; i != this->queue_.size(); i++) {
+      if (!std::isnan(this->queue_[i])) {
+        this->sum_ += this->queue_[i];
+        this->valid_count_++;
+      }
+    }
+  } else if (!std::isnan(value)) {
+    this->sum_ += value;
+    this->valid_count_++;
+  }
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float sum = 0;
-    size_t valid_count = 0;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        sum += v;
-        valid_count++;
-      }
-    }
-
     float average = NAN;
-    if (valid_count) {
-      average = sum / valid_count;
+    if (this->valid_count_) {
+      average = this->sum_ / this->valid_count_;
     }
 
     ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f) SENDING %f", this, value, average);
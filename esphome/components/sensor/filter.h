@@ -35,11 +35,20 @@ class Filter {
 
   void input(float value);
 
+  /** Pass a block of values through this filter.
+   *
+   * The values that come out are collected and passed on down the chain as blocks too, so every filter is entered
+   * once per block rather than once per value.
+   */
+  virtual void input_batch(const float *values, size_t count);
+
   void output(float value);
 
  protected:
   friend Sensor;
 
+  void output_batch(const float *values, size_t count);
+
   Filter *next_{nullptr};
   Sensor *parent_{nullptr};
 };
@@ -68,10 +77,12 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  FixedRingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
+  /// The non-NaN values of the window in ascending order.
+  std::vector<float> sorted_;
   float quantile_;
 };
 
@@ -97,10 +108,12 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FixedRingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
+  /// The non-NaN values of the window in ascending order.
+  std::vector<float> sorted_;
 };
 
 /** Simple skip filter.
@@ -143,10 +156,12 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FixedRingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
+  /// Increasing candidates for the minimum, each newer than the one before; the front is the minimum.
+  FixedRingBuffer<float> extremes_;
 };
 
 /** Simple max filter.
@@ -171,10 +186,12 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FixedRingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
+  /// Decreasing candidates for the maximum, each newer than the one before; the front is the maximum.
+  FixedRingBuffer<float> extremes_;
 };
 
 /** Simple sliding window moving average filter.
@@ -200,10 +217,15 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FixedRingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
+  /// Sum and count of the non-NaN values in the window.
+  float sum_{0.0f};
+  size_t valid_count_{0};
+  /// Values added since the sum was last calculated from scratch, to keep rounding errors from adding up.
+  size_t since_sum_{0};
 };
 
 /** Simple exponential moving average filter.
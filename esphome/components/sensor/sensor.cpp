@@ -85,6 +85,25 @@ void Sensor::publish_state(float state) {
   }
 }
 
+void Sensor::publish_batch(const float *states, size_t count) {
+  if (count == 0)
+    return;
+  this->raw_state = states[count - 1];
+  if (this->raw_callback_) {
+    for (size_t i = 0; i != count; i++)
+      this->raw_callback_->call(states[i]);
+  }
+
+  ESP_LOGV(TAG, "'%s': Received %zu new states", this->name_.c_str(), count);
+
+  if (this->filter_list_ == nullptr) {
+    for (size_t i = 0; i != count; i++)
+      this->internal_send_state_to_frontend(states[i]);
+  } else {
+    this->filter_list_->input_batch(states, count);
+  }
+}
+
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   if (!this->raw_callback_) {
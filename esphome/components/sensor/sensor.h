@@ -99,6 +99,16 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a block of states, as from a sensor sampling much faster than it publishes.
+   *
+   * Same as calling publish_state() for each of them, but the filters see the states as one block. Usually a filter
+   * in the chain (like a sliding window average) reduces them to a few values that reach the front-end.
+   *
+   * @param states The states, oldest first.
+   * @param count The number of states.
+   */
+  void publish_batch(const float *states, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
@@ -1,6 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.core import CORE
+from esphome.helpers import IS_LINUX
 
 CODEOWNERS = ["@esphome/core"]
 
@@ -41,6 +42,9 @@ async def to_code(config):
     elif impl == IMPLEMENTATION_BSD_SOCKETS:
         cg.add_define("USE_SOCKET_IMPL_BSD_SOCKETS")
         cg.add_define("USE_SOCKET_SELECT_SUPPORT")
+        if CORE.is_host and IS_LINUX:
+            # select() is capped at FD_SETSIZE and scans every descriptor on each loop
+            cg.add_define("USE_SOCKET_SELECT_EPOLL")
 
 
 def FILTER_SOURCE_FILES() -> list[str]:
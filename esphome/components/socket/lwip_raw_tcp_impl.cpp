@@ -331,26 +331,7 @@ class LWIPRawImpl : public Socket {
         break;
       size_t copysize = std::min(len, pb_left);
       memcpy(buf8, reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_, copysize);
-
-      if (pb_left == copysize) {
-        // full pb copied, free it
-        if (rx_buf_->next == nullptr) {
-          // last buffer in chain
-          pbuf_free(rx_buf_);
-          rx_buf_ = nullptr;
-          rx_buf_offset_ = 0;
-        } else {
-          auto *old_buf = rx_buf_;
-          rx_buf_ = rx_buf_->next;
-          pbuf_ref(rx_buf_);
-          pbuf_free(old_buf);
-          rx_buf_offset_ = 0;
-        }
-      } else {
-        rx_buf_offset_ += copysize;
-      }
-      LWIP_LOG("tcp_recved(%p %u)", pcb_, copysize);
-      tcp_recved(pcb_, copysize);
+      this->consume(copysize);
 
       buf8 += copysize;
       len -= copysize;
@@ -380,6 +361,48 @@ class LWIPRawImpl : public Socket {
     }
     return ret;
   }
+  ssize_t peek(uint8_t **data) override {
+    if (pcb_ == nullptr) {
+      errno = ECONNRESET;
+      return -1;
+    }
+    if (rx_buf_ == nullptr) {
+      if (rx_closed_)
+        return 0;
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    size_t pb_left = rx_buf_->len - rx_buf_offset_;
+    if (pb_left == 0) {
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    *data = reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_;
+    return pb_left;
+  }
+  void consume(size_t len) override {
+    if (pcb_ == nullptr || rx_buf_ == nullptr || len == 0)
+      return;
+    if (rx_buf_->len - rx_buf_offset_ == len) {
+      // full pb consumed, free it
+      if (rx_buf_->next == nullptr) {
+        // last buffer in chain
+        pbuf_free(rx_buf_);
+        rx_buf_ = nullptr;
+        rx_buf_offset_ = 0;
+      } else {
+        auto *old_buf = rx_buf_;
+        rx_buf_ = rx_buf_->next;
+        pbuf_ref(rx_buf_);
+        pbuf_free(old_buf);
+        rx_buf_offset_ = 0;
+      }
+    } else {
+      rx_buf_offset_ += len;
+    }
+    LWIP_LOG("tcp_recved(%p %u)", pcb_, len);
+    tcp_recved(pcb_, len);
+  }
   ssize_t internal_write(const void *buf, size_t len) {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
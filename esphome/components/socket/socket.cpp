@@ -11,6 +11,11 @@ namespace socket {
 
 Socket::~Socket() {}
 
+ssize_t Socket::peek(uint8_t **data) {
+  errno = EOPNOTSUPP;
+  return -1;
+}
+
 bool Socket::ready() const {
 #ifdef USE_SOCKET_SELECT_SUPPORT
   if (!loop_monitored_) {
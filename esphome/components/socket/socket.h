@@ -43,6 +43,13 @@ class Socket {
   virtual ssize_t recvfrom(void *buf, size_t len, sockaddr *addr, socklen_t *addr_len) = 0;
 #endif
   virtual ssize_t readv(const struct iovec *iov, int iovcnt) = 0;
+  /// Zero-copy receive: point *data at the next received bytes instead of copying them out.
+  /// Returns how many contiguous bytes are available there (more may follow after consume()), 0 at end of stream
+  /// or -1 with errno set. errno is EOPNOTSUPP if the implementation keeps no receive buffer, use read() then.
+  /// The bytes may be modified in place and stay valid until consume() or the next read.
+  virtual ssize_t peek(uint8_t **data);
+  /// Release the first len bytes returned by peek(), len must not exceed its return value.
+  virtual void consume(size_t len) {}
   virtual ssize_t write(const void *buf, size_t len) = 0;
   virtual ssize_t writev(const struct iovec *iov, int iovcnt) = 0;
   virtual ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) = 0;
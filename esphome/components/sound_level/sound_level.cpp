@@ -29,14 +29,6 @@ void SoundLevelComponent::dump_config() {
 }
 
 void SoundLevelComponent::setup() {
-  this->microphone_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
-    std::shared_ptr<RingBuffer> temp_ring_buffer = this->ring_buffer_.lock();
-    if (this->ring_buffer_.use_count() == 2) {
-      // ``audio_buffer_`` and ``temp_ring_buffer`` share ownership of a ring buffer, so its safe/useful to write
-      temp_ring_buffer->write((void *) data.data(), data.size());
-    }
-  });
-
   if (!this->microphone_source_->is_passive()) {
     // Automatically start the microphone if not in passive mode
     this->microphone_source_->start();
@@ -171,24 +163,22 @@ bool SoundLevelComponent::start_() {
     return false;
   }
 
-  // Allocates a new ring buffer, adds it as a source for the transfer buffer, and points ring_buffer_ to it
-  this->ring_buffer_.reset();  // Reset pointer to any previous ring buffer allocation
-  std::shared_ptr<RingBuffer> temp_ring_buffer =
-      RingBuffer::create(this->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
-  if (temp_ring_buffer.use_count() == 0) {
+  // Reads the microphone's shared buffer of raw audio through the transfer buffer
+  if (!this->microphone_source_->start_reading(RING_BUFFER_DURATION_MS)) {
     this->status_momentary_error("Failed to allocate ring buffer", 15000);
     this->stop_();
     return false;
-  } else {
-    this->ring_buffer_ = temp_ring_buffer;
-    this->audio_buffer_->set_source(temp_ring_buffer);
   }
+  this->audio_buffer_->set_source(this->microphone_source_);
 
   this->status_clear_error();
   return true;
 }
 
-void SoundLevelComponent::stop_() { this->audio_buffer_.reset(); }
+void SoundLevelComponent::stop_() {
+  this->audio_buffer_.reset();
+  this->microphone_source_->stop_reading();
+}
 
 }  // namespace sound_level
 }  // namespace esphome
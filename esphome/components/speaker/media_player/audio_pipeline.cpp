@@ -37,12 +37,23 @@ enum EventGroupBits : uint32_t {
   // Error reading the file; cleared by process_state()
   READER_MESSAGE_ERROR = (1 << 8),
 
+  // Read the queued url/file into the other ring buffer; cleared by reader task and set by queue_url/queue_file
+  READER_COMMAND_PREFETCH_HTTP = (1 << 9),
+  READER_COMMAND_PREFETCH_FILE = (1 << 10),
+  // Queued file type is read after checking it is supported; cleared by decoder task
+  READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE = (1 << 11),
+
   // Decoder is done (either through a faiilure or the end of the stream); cleared by decoder task
   DECODER_MESSAGE_FINISHED = (1 << 12),
   // Error decoding the file; cleared by process_state() by decoder task
   DECODER_MESSAGE_ERROR = (1 << 13),
+  // Decoder moved on to the queued file without stopping; cleared by process_state()
+  DECODER_MESSAGE_ADVANCED = (1 << 14),
 };
 
+static const EventBits_t PREFETCH_COMMAND_BITS =
+    EventGroupBits::READER_COMMAND_PREFETCH_HTTP | EventGroupBits::READER_COMMAND_PREFETCH_FILE;
+
 AudioPipeline::AudioPipeline(speaker::Speaker *speaker, size_t buffer_size, bool task_stack_in_psram,
                              std::string base_name, UBaseType_t priority)
     : base_name_(std::move(base_name)),
@@ -55,6 +66,7 @@ AudioPipeline::AudioPipeline(speaker::Speaker *speaker, size_t buffer_size, bool
 }
 
 void AudioPipeline::start_url(const std::string &uri) {
+  xEventGroupClearBits(this->event_group_, PREFETCH_COMMAND_BITS);
   if (this->is_playing_) {
     xEventGroupSetBits(this->event_group_, PIPELINE_COMMAND_STOP);
   }
@@ -63,6 +75,7 @@ void AudioPipeline::start_url(const std::string &uri) {
 }
 
 void AudioPipeline::start_file(audio::AudioFile *audio_file) {
+  xEventGroupClearBits(this->event_group_, PREFETCH_COMMAND_BITS);
   if (this->is_playing_) {
     xEventGroupSetBits(this->event_group_, PIPELINE_COMMAND_STOP);
   }
@@ -70,7 +83,18 @@ void AudioPipeline::start_file(audio::AudioFile *audio_file) {
   this->pending_file_ = true;
 }
 
+void AudioPipeline::queue_url(const std::string &uri) {
+  this->next_uri_ = uri;
+  xEventGroupSetBits(this->event_group_, EventGroupBits::READER_COMMAND_PREFETCH_HTTP);
+}
+
+void AudioPipeline::queue_file(audio::AudioFile *audio_file) {
+  this->next_audio_file_ = audio_file;
+  xEventGroupSetBits(this->event_group_, EventGroupBits::READER_COMMAND_PREFETCH_FILE);
+}
+
 esp_err_t AudioPipeline::stop() {
+  xEventGroupClearBits(this->event_group_, PREFETCH_COMMAND_BITS);
   xEventGroupSetBits(this->event_group_, EventGroupBits::PIPELINE_COMMAND_STOP);
 
   return ESP_OK;
@@ -126,6 +150,11 @@ AudioPipelineState AudioPipeline::process_state() {
                      event.audio_stream_info.value().get_bits_per_sample());
           }
 
+          if (event.decode_cycles_per_frame.has_value()) {
+            ESP_LOGD(TAG, "Decoding took %" PRIu32 " CPU cycles per frame on average",
+                     event.decode_cycles_per_frame.value());
+          }
+
           if (event.decoding_err.has_value()) {
             switch (event.decoding_err.value()) {
               case DecodingError::FAILED_HEADER:
@@ -150,6 +179,12 @@ AudioPipelineState AudioPipeline::process_state() {
 
   EventBits_t event_bits = xEventGroupGetBits(this->event_group_);
 
+  if (event_bits & EventGroupBits::DECODER_MESSAGE_ADVANCED) {
+    xEventGroupClearBits(this->event_group_, EventGroupBits::DECODER_MESSAGE_ADVANCED);
+    this->playback_ms_ = 0;
+    this->advanced_to_queued_ = true;
+  }
+
   if (this->pending_url_ || this->pending_file_) {
     // Init command pending
     if (!(event_bits & EventGroupBits::PIPELINE_COMMAND_STOP)) {
@@ -185,7 +220,8 @@ AudioPipelineState AudioPipeline::process_state() {
   }
 
   if ((event_bits & EventGroupBits::READER_MESSAGE_FINISHED) &&
-      (!(event_bits & EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE) &&
+      (!(event_bits & (EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE |
+                       EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE | PREFETCH_COMMAND_BITS)) &&
        (event_bits & EventGroupBits::DECODER_MESSAGE_FINISHED))) {
     // Tasks are finished and there's no media in between the reader and decoder
 
@@ -343,6 +379,9 @@ void AudioPipeline::delete_tasks_() {
       this->decode_task_handle_ = nullptr;
     }
   }
+
+  this->raw_file_ring_buffers_[0].reset();
+  this->raw_file_ring_buffers_[1].reset();
 }
 
 void AudioPipeline::read_task(void *params) {
@@ -352,44 +391,60 @@ void AudioPipeline::read_task(void *params) {
     xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::READER_MESSAGE_FINISHED);
 
     // Wait until the pipeline notifies us the source of the media file
-    EventBits_t event_bits = xEventGroupWaitBits(
-        this_pipeline->event_group_,
-        EventGroupBits::READER_COMMAND_INIT_FILE | EventGroupBits::READER_COMMAND_INIT_HTTP,  // Bit message to read
-        pdFALSE,                                                                              // Clear the bit on exit
-        pdFALSE,                                                                              // Wait for all the bits,
-        portMAX_DELAY);  // Block indefinitely until bit is set
+    EventBits_t event_bits =
+        xEventGroupWaitBits(this_pipeline->event_group_,
+                            EventGroupBits::READER_COMMAND_INIT_FILE | EventGroupBits::READER_COMMAND_INIT_HTTP |
+                                PREFETCH_COMMAND_BITS,  // Bit message to read
+                            pdFALSE,                    // Clear the bit on exit
+                            pdFALSE,                    // Wait for all the bits,
+                            portMAX_DELAY);             // Block indefinitely until bit is set
 
-    if (!(event_bits & EventGroupBits::PIPELINE_COMMAND_STOP)) {
-      xEventGroupClearBits(this_pipeline->event_group_, EventGroupBits::READER_MESSAGE_FINISHED |
-                                                            EventGroupBits::READER_COMMAND_INIT_FILE |
-                                                            EventGroupBits::READER_COMMAND_INIT_HTTP);
+    if (event_bits & EventGroupBits::PIPELINE_COMMAND_STOP) {
+      // Drop a queued file, the stop command also ends the current one
+      xEventGroupClearBits(this_pipeline->event_group_, PREFETCH_COMMAND_BITS);
+    } else {
+      xEventGroupClearBits(this_pipeline->event_group_,
+                           EventGroupBits::READER_MESSAGE_FINISHED | EventGroupBits::READER_COMMAND_INIT_FILE |
+                               EventGroupBits::READER_COMMAND_INIT_HTTP | PREFETCH_COMMAND_BITS);
       InfoErrorEvent event;
       event.source = InfoErrorSource::READER;
       esp_err_t err = ESP_OK;
 
+      // A queued file is read while the decoder still works on the current one, so it goes into the other buffer
+      const bool prefetch =
+          !(event_bits & (EventGroupBits::READER_COMMAND_INIT_FILE | EventGroupBits::READER_COMMAND_INIT_HTTP));
+      const uint8_t buffer_index = this_pipeline->reader_buffer_index_ ^ (prefetch ? 1 : 0);
+      audio::AudioFileType &file_type =
+          prefetch ? this_pipeline->next_audio_file_type_ : this_pipeline->current_audio_file_type_;
+
       std::unique_ptr<audio::AudioReader> reader =
           make_unique<audio::AudioReader>(this_pipeline->transfer_buffer_size_);
 
       if (event_bits & EventGroupBits::READER_COMMAND_INIT_FILE) {
-        err = reader->start(this_pipeline->current_audio_file_, this_pipeline->current_audio_file_type_);
+        err = reader->start(this_pipeline->current_audio_file_, file_type);
+      } else if (event_bits & EventGroupBits::READER_COMMAND_INIT_HTTP) {
+        err = reader->start(this_pipeline->current_uri_, file_type);
+      } else if (event_bits & EventGroupBits::READER_COMMAND_PREFETCH_FILE) {
+        err = reader->start(this_pipeline->next_audio_file_, file_type);
       } else {
-        err = reader->start(this_pipeline->current_uri_, this_pipeline->current_audio_file_type_);
+        err = reader->start(this_pipeline->next_uri_, file_type);
       }
 
       if (err == ESP_OK) {
-        size_t file_ring_buffer_size = this_pipeline->buffer_size_;
-
-        std::shared_ptr<RingBuffer> temp_ring_buffer;
-
-        if (!this_pipeline->raw_file_ring_buffer_.use_count()) {
-          temp_ring_buffer = RingBuffer::create(file_ring_buffer_size);
-          this_pipeline->raw_file_ring_buffer_ = temp_ring_buffer;
+        std::shared_ptr<RingBuffer> &ring_buffer = this_pipeline->raw_file_ring_buffers_[buffer_index];
+        if (ring_buffer == nullptr) {
+          ring_buffer = RingBuffer::create(this_pipeline->buffer_size_);
+        } else {
+          // Reuse the allocation, but drop anything left from a stopped file
+          ring_buffer->reset();
         }
 
-        if (!this_pipeline->raw_file_ring_buffer_.use_count()) {
+        if (ring_buffer == nullptr) {
           err = ESP_ERR_NO_MEM;
         } else {
-          reader->add_sink(this_pipeline->raw_file_ring_buffer_);
+          std::weak_ptr<RingBuffer> sink = ring_buffer;
+          reader->add_sink(sink);
+          this_pipeline->reader_buffer_index_ = buffer_index;
         }
       }
 
@@ -398,14 +453,21 @@ void AudioPipeline::read_task(void *params) {
         event.err = err;
         xQueueSend(this_pipeline->info_error_queue_, &event, portMAX_DELAY);
 
+        if (prefetch) {
+          // Let the current file finish, the pipeline stops afterwards as nothing is queued
+          continue;
+        }
+
         // Setting up the reader failed, stop the pipeline
         xEventGroupSetBits(this_pipeline->event_group_,
                            EventGroupBits::READER_MESSAGE_ERROR | EventGroupBits::PIPELINE_COMMAND_STOP);
       } else {
         // Send the file type to the pipeline
-        event.file_type = this_pipeline->current_audio_file_type_;
+        event.file_type = file_type;
         xQueueSend(this_pipeline->info_error_queue_, &event, portMAX_DELAY);
-        xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE);
+        xEventGroupSetBits(this_pipeline->event_group_, prefetch
+                                                            ? EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE
+                                                            : EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE);
       }
 
       while (true) {
@@ -425,12 +487,6 @@ void AudioPipeline::read_task(void *params) {
           break;
         }
       }
-      event_bits = xEventGroupGetBits(this_pipeline->event_group_);
-      if ((event_bits & EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE) ||
-          (this_pipeline->raw_file_ring_buffer_.use_count() == 1)) {
-        // Decoder task hasn't started yet, so delay a bit before releasing ownership of the ring buffer
-        delay(10);
-      }
     }
   }
 }
@@ -438,29 +494,53 @@ void AudioPipeline::read_task(void *params) {
 void AudioPipeline::decode_task(void *params) {
   AudioPipeline *this_pipeline = (AudioPipeline *) params;
 
+  // Set when the queued file was loaded by the time the current one finished decoding
+  bool continue_with_queued = false;
+
   while (true) {
-    xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::DECODER_MESSAGE_FINISHED);
+    EventBits_t event_bits;
+    if (continue_with_queued) {
+      event_bits = xEventGroupGetBits(this_pipeline->event_group_);
+    } else {
+      xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::DECODER_MESSAGE_FINISHED);
+
+      // Wait until the reader notifies us that the media type is available
+      event_bits = xEventGroupWaitBits(
+          this_pipeline->event_group_,
+          EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE |
+              EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE,  // Bit message to read
+          pdFALSE,                                                    // Clear the bit on exit
+          pdFALSE,                                                    // Wait for all the bits,
+          portMAX_DELAY);                                             // Block indefinitely until bit is set
+    }
 
-    // Wait until the reader notifies us that the media type is available
-    EventBits_t event_bits =
-        xEventGroupWaitBits(this_pipeline->event_group_,
-                            EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE,  // Bit message to read
-                            pdFALSE,                                           // Clear the bit on exit
-                            pdFALSE,                                           // Wait for all the bits,
-                            portMAX_DELAY);                                    // Block indefinitely until bit is set
+    xEventGroupClearBits(this_pipeline->event_group_, EventGroupBits::DECODER_MESSAGE_FINISHED |
+                                                          EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE |
+                                                          EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE);
 
-    xEventGroupClearBits(this_pipeline->event_group_,
-                         EventGroupBits::DECODER_MESSAGE_FINISHED | EventGroupBits::READER_MESSAGE_LOADED_MEDIA_TYPE);
+    // Keep the speaker fed when moving on to the queued file, there is no need to buffer again
+    bool started_playback = continue_with_queued;
+    continue_with_queued = false;
 
     if (!(event_bits & EventGroupBits::PIPELINE_COMMAND_STOP)) {
       InfoErrorEvent event;
       event.source = InfoErrorSource::DECODER;
 
+      if (event_bits & EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE) {
+        this_pipeline->current_audio_file_type_ = this_pipeline->next_audio_file_type_;
+        xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::DECODER_MESSAGE_ADVANCED);
+      }
+
+      // The reader only moves on to the other buffer once it finished this one
+      const uint8_t buffer_index = this_pipeline->reader_buffer_index_;
+      std::shared_ptr<RingBuffer> ring_buffer = this_pipeline->raw_file_ring_buffers_[buffer_index];
+      std::weak_ptr<RingBuffer> source = ring_buffer;
+
       std::unique_ptr<audio::AudioDecoder> decoder =
           make_unique<audio::AudioDecoder>(this_pipeline->transfer_buffer_size_, this_pipeline->transfer_buffer_size_);
 
       esp_err_t err = decoder->start(this_pipeline->current_audio_file_type_);
-      decoder->add_source(this_pipeline->raw_file_ring_buffer_);
+      decoder->add_source(source);
 
       if (err != ESP_OK) {
         // Send specific error message
@@ -473,7 +553,6 @@ void AudioPipeline::decode_task(void *params) {
       }
 
       bool has_stream_info = false;
-      bool started_playback = false;
 
       size_t initial_bytes_to_buffer = 0;
 
@@ -484,9 +563,13 @@ void AudioPipeline::decode_task(void *params) {
           break;
         }
 
+        // The reader is done with this file if it finished or already moved on to the queued file
+        const bool reader_finished = (event_bits & EventGroupBits::READER_MESSAGE_FINISHED) ||
+                                     (this_pipeline->reader_buffer_index_ != buffer_index);
+
         // Update pause state
         if (!started_playback) {
-          if (!(event_bits & EventGroupBits::READER_MESSAGE_FINISHED)) {
+          if (!reader_finished) {
             decoder->set_pause_output_state(true);
           } else {
             started_playback = true;
@@ -496,7 +579,7 @@ void AudioPipeline::decode_task(void *params) {
         }
 
         // Stop gracefully if the reader has finished
-        audio::AudioDecoderState decoder_state = decoder->decode(event_bits & EventGroupBits::READER_MESSAGE_FINISHED);
+        audio::AudioDecoderState decoder_state = decoder->decode(reader_finished);
 
         if ((decoder_state == audio::AudioDecoderState::DECODING) ||
             (decoder_state == audio::AudioDecoderState::FINISHED)) {
@@ -504,6 +587,16 @@ void AudioPipeline::decode_task(void *params) {
         }
 
         if (decoder_state == audio::AudioDecoderState::FINISHED) {
+          if (decoder->get_decoded_frames() > 0) {
+            InfoErrorEvent stats_event;
+            stats_event.source = InfoErrorSource::DECODER;
+            stats_event.decode_cycles_per_frame = decoder->get_decode_cycles_per_frame();
+            xQueueSend(this_pipeline->info_error_queue_, &stats_event, portMAX_DELAY);
+          }
+
+          // Continue with the queued file at this frame boundary if it is already loaded
+          continue_with_queued = xEventGroupGetBits(this_pipeline->event_group_) &
+                                 EventGroupBits::READER_MESSAGE_LOADED_NEXT_MEDIA_TYPE;
           break;
         } else if (decoder_state == audio::AudioDecoderState::FAILED) {
           if (!has_stream_info) {
@@ -534,6 +627,15 @@ void AudioPipeline::decode_task(void *params) {
             xEventGroupSetBits(this_pipeline->event_group_,
                                EventGroupBits::DECODER_MESSAGE_ERROR | EventGroupBits::PIPELINE_COMMAND_STOP);
           } else {
+            if (started_playback &&
+                (this_pipeline->speaker_->get_audio_stream_info() != this_pipeline->current_audio_stream_info_)) {
+              // The queued file has a different format, so let the speaker play out the previous file first
+              this_pipeline->speaker_->finish();
+              while (!this_pipeline->speaker_->is_stopped() &&
+                     !(xEventGroupGetBits(this_pipeline->event_group_) & EventGroupBits::PIPELINE_COMMAND_STOP)) {
+                delay(10);
+              }
+            }
             // Send audio directly to the speaker
             this_pipeline->speaker_->set_audio_stream_info(this_pipeline->current_audio_stream_info_);
             decoder->add_sink(this_pipeline->speaker_);
@@ -561,8 +663,7 @@ void AudioPipeline::decode_task(void *params) {
 
         if (!started_playback && has_stream_info) {
           // Verify enough data is available before starting playback
-          std::shared_ptr<RingBuffer> temp_ring_buffer = this_pipeline->raw_file_ring_buffer_.lock();
-          if (temp_ring_buffer->available() >= initial_bytes_to_buffer) {
+          if (ring_buffer->available() >= initial_bytes_to_buffer) {
             started_playback = true;
           }
         }
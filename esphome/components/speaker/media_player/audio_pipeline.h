@@ -55,6 +55,7 @@ struct InfoErrorEvent {
   optional<audio::AudioFileType> file_type;
   optional<audio::AudioStreamInfo> audio_stream_info;
   optional<DecodingError> decoding_err;
+  optional<uint32_t> decode_cycles_per_frame;
 };
 
 class AudioPipeline {
@@ -77,6 +78,23 @@ class AudioPipeline {
   /// @return ESP_OK if successful or an appropriate error if not
   void start_file(audio::AudioFile *audio_file);
 
+  /// @brief Queues a media url to read while the current stream plays. Once the current stream is decoded, the pipeline
+  /// continues with the queued one without stopping the speaker. Only one stream can be queued at a time, queue the
+  /// following one after ``take_advanced_to_queued`` returned true.
+  /// @param uri media file url
+  void queue_url(const std::string &uri);
+
+  /// @brief Queues an AudioFile to read while the current stream plays, see ``queue_url``.
+  /// @param audio_file pointer to an AudioFile object
+  void queue_file(audio::AudioFile *audio_file);
+
+  /// @brief Returns true once after the pipeline moved on to the queued stream.
+  bool take_advanced_to_queued() {
+    bool advanced = this->advanced_to_queued_;
+    this->advanced_to_queued_ = false;
+    return advanced;
+  }
+
   /// @brief Stops the pipeline. Sends a stop signal to each task (if running) and clears the ring buffers.
   /// @return ESP_OK if successful or ESP_ERR_TIMEOUT if the tasks did not indicate they stopped
   esp_err_t stop();
@@ -104,7 +122,7 @@ class AudioPipeline {
   /// @return ESP_OK if successful or an appropriate error if not
   esp_err_t start_tasks_();
 
-  /// @brief Resets the task related pointers and deallocates their stacks.
+  /// @brief Resets the task related pointers and deallocates their stacks and the ring buffers.
   void delete_tasks_();
 
   std::string base_name_;
@@ -117,6 +135,7 @@ class AudioPipeline {
   bool is_finishing_{false};
   bool pause_state_{false};
   bool task_stack_in_psram_;
+  bool advanced_to_queued_{false};
 
   // Pending file start state used to ensure the pipeline fully stops before attempting to start the next file
   bool pending_url_{false};
@@ -130,10 +149,18 @@ class AudioPipeline {
   audio::AudioFileType current_audio_file_type_;
   audio::AudioStreamInfo current_audio_stream_info_;
 
+  std::string next_uri_{};
+  audio::AudioFile *next_audio_file_{nullptr};
+  audio::AudioFileType next_audio_file_type_;
+
   size_t buffer_size_;           // Ring buffer between reader and decoder
   size_t transfer_buffer_size_;  // Internal source/sink buffers for the audio reader and decoder
 
-  std::weak_ptr<RingBuffer> raw_file_ring_buffer_;
+  // The reader fills one ring buffer with the queued stream while the decoder still reads the current stream from the
+  // other. Both stay allocated as long as the tasks exist, so moving on to the next stream doesn't reallocate them.
+  std::shared_ptr<RingBuffer> raw_file_ring_buffers_[2];
+  // Index of the ring buffer the reader writes to; only changed by the reader task
+  volatile uint8_t reader_buffer_index_{0};
 
   // Handles basic control/state of the three tasks
   EventGroupHandle_t event_group_{nullptr};
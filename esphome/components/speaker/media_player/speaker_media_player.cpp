@@ -158,6 +158,7 @@ void SpeakerMediaPlayer::watch_media_commands_() {
           // Ensure the loaded next item doesn't start playing, clear the queue, start the file, and unpause
           this->cancel_timeout("next_media");
           this->media_playlist_.clear();
+          this->media_next_queued_ = false;
           if (this->is_paused_) {
             // If paused, stop the media pipeline and unpause it after confirming its stopped. This avoids playing a
             // short segment of the paused file before starting the new one.
@@ -226,6 +227,7 @@ void SpeakerMediaPlayer::watch_media_commands_() {
             if (this->media_pipeline_ != nullptr) {
               this->cancel_timeout("next_media");
               this->media_playlist_.clear();
+              this->media_next_queued_ = false;
               this->media_pipeline_->stop();
               this->set_retry("unpause_med", 50, 3, [this](const uint8_t remaining_attempts) {
                 if (this->media_pipeline_state_ == AudioPipelineState::STOPPED) {
@@ -365,6 +367,7 @@ void SpeakerMediaPlayer::loop() {
         this->state = media_player::MEDIA_PLAYER_STATE_PAUSED;
       } else if (this->media_pipeline_state_ == AudioPipelineState::PLAYING) {
         this->state = media_player::MEDIA_PLAYER_STATE_PLAYING;
+        this->queue_next_media_();
       } else if (this->media_pipeline_state_ == AudioPipelineState::STOPPED) {
         if (!media_playlist_.empty()) {
           uint32_t timeout_ms = 0;
@@ -401,12 +404,50 @@ void SpeakerMediaPlayer::loop() {
     }
   }
 
+  if (this->media_pipeline_state_ != AudioPipelineState::PLAYING) {
+    // Anything queued in the pipeline was dropped when it stopped
+    this->media_next_queued_ = false;
+  }
+
   if (this->state != old_state) {
     this->publish_state();
     ESP_LOGD(TAG, "State changed to %s", media_player::media_player_state_to_string(this->state));
   }
 }
 
+void SpeakerMediaPlayer::queue_next_media_() {
+  if (this->media_pipeline_->take_advanced_to_queued()) {
+    // The pipeline moved on to the queued item without stopping, so the current item is done
+    if (!this->media_repeat_one_ && !this->media_playlist_.empty()) {
+      this->media_playlist_.pop_front();
+    }
+    this->media_next_queued_ = false;
+  }
+
+  if (this->media_next_queued_ || (this->media_playlist_delay_ms_ > 0)) {
+    // Items with a delay between them are started once the pipeline stopped
+    return;
+  }
+
+  // Queue the next item, so the pipeline reads it while the current one plays and continues without a gap
+  const PlaylistItem *next_item = nullptr;
+  if (this->media_repeat_one_ && !this->media_playlist_.empty()) {
+    next_item = &this->media_playlist_.front();
+  } else if (this->media_playlist_.size() > 1) {
+    next_item = &this->media_playlist_[1];
+  }
+  if (next_item == nullptr) {
+    return;
+  }
+
+  if (next_item->url.has_value()) {
+    this->media_pipeline_->queue_url(next_item->url.value());
+  } else if (next_item->file.has_value()) {
+    this->media_pipeline_->queue_file(next_item->file.value());
+  }
+  this->media_next_queued_ = true;
+}
+
 void SpeakerMediaPlayer::play_file(audio::AudioFile *media_file, bool announcement, bool enqueue) {
   if (!this->is_ready()) {
     // Ignore any commands sent before the media player is setup
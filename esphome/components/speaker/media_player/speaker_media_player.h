@@ -101,6 +101,9 @@ class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
   // Processes commands from media_control_command_queue_.
   void watch_media_commands_();
 
+  // Queues the next media playlist item in the media pipeline for gapless playback.
+  void queue_next_media_();
+
   std::unique_ptr<AudioPipeline> announcement_pipeline_;
   std::unique_ptr<AudioPipeline> media_pipeline_;
   Speaker *media_speaker_{nullptr};
@@ -109,6 +112,7 @@ class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
   optional<media_player::MediaPlayerSupportedFormat> media_format_;
   AudioPipelineState media_pipeline_state_{AudioPipelineState::STOPPED};
   bool media_repeat_one_{false};
+  bool media_next_queued_{false};
   uint32_t media_playlist_delay_ms_{0};
 
   optional<media_player::MediaPlayerSupportedFormat> announcement_format_;
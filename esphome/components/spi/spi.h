@@ -242,6 +242,25 @@ class SPIDelegate {
       this->transfer(ptr[i]);
   }
 
+  /**
+   * Start writing a buffer without waiting for the transfer to complete. The buffer must stay unchanged until
+   * wait_queued() has returned, which happens at the latest when the transaction ends. Delegates that cannot queue
+   * transfers write the data synchronously.
+   */
+  virtual void write_array_queued(const uint8_t *ptr, size_t length) { this->write_array(ptr, length); }
+
+  /**
+   * Queued version of write_cmd_addr_data(), with the same lifetime rules for the data as write_array_queued().
+   * Delegates that cannot queue transfers write the data synchronously.
+   */
+  virtual void write_cmd_addr_data_queued(size_t cmd_bits, uint32_t cmd, size_t addr_bits, uint32_t address,
+                                          const uint8_t *data, size_t length, uint8_t bus_width) {
+    this->write_cmd_addr_data(cmd_bits, cmd, addr_bits, address, data, length, bus_width);
+  }
+
+  // wait for all queued writes to complete.
+  virtual void wait_queued() {}
+
   // read into a buffer, write nulls
   virtual void read_array(uint8_t *ptr, size_t length) {
     for (size_t i = 0; i != length; i++)
@@ -502,6 +521,15 @@ class SPIDevice : public SPIClient {
 
   void write_array(const uint8_t *data, size_t length) { this->delegate_->write_array(data, length); }
 
+  void write_array_queued(const uint8_t *data, size_t length) { this->delegate_->write_array_queued(data, length); }
+
+  void write_cmd_addr_data_queued(size_t cmd_bits, uint32_t cmd, size_t addr_bits, uint32_t address,
+                                  const uint8_t *data, size_t length, uint8_t bus_width = 1) {
+    this->delegate_->write_cmd_addr_data_queued(cmd_bits, cmd, addr_bits, address, data, length, bus_width);
+  }
+
+  void wait_queued() { this->delegate_->wait_queued(); }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
@@ -7,6 +7,7 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+static const size_t QUEUE_DEPTH = 16;          // maximum number of queued transfers per device.
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -36,6 +37,7 @@ class SPIDelegateHw : public SPIDelegate {
 
   void end_transaction() override {
     if (this->is_ready()) {
+      this->wait_queued();
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
       if (this->release_device_) {
@@ -46,6 +48,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   ~SPIDelegateHw() override {
+    this->wait_queued();
     esp_err_t const err = spi_bus_remove_device(this->handle_);
     if (err != ESP_OK)
       ESP_LOGE(TAG, "Remove device failed - err %X", err);
@@ -53,13 +56,13 @@ class SPIDelegateHw : public SPIDelegate {
 
   // do a transfer. either txbuf or rxbuf (but not both) may be null.
   // transfers above the maximum size will be split.
-  // TODO - make use of the queue for interrupt transfers to provide a (short) pipeline of blocks
-  // when splitting is required.
   void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
     if (rxbuf != nullptr && this->write_only_) {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    // polling transfers can't be started while queued transfers are pending.
+    this->wait_queued();
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -86,6 +89,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   void write(uint16_t data, size_t num_bits) override {
+    this->wait_queued();
     spi_transaction_ext_t desc = {};
     desc.command_bits = num_bits;
     desc.base.flags = SPI_TRANS_VARIABLE_CMD;
@@ -117,6 +121,7 @@ class SPIDelegateHw : public SPIDelegate {
       esph_log_w(TAG, "Nothing to transfer");
       return;
     }
+    this->wait_queued();
     desc.base.flags = SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_DUMMY;
     if (bus_width == 4) {
       desc.base.flags |= SPI_TRANS_MODE_QIO;
@@ -184,14 +189,73 @@ class SPIDelegateHw : public SPIDelegate {
 
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
+  // queue interrupt transfers, so the data is sent by DMA while the caller gets on with other work.
+  void write_array_queued(const uint8_t *ptr, size_t length) override {
+    this->write_cmd_addr_data_queued(0, 0, 0, 0, ptr, length, 1);
+  }
+
+  void write_cmd_addr_data_queued(size_t cmd_bits, uint32_t cmd, size_t addr_bits, uint32_t address,
+                                  const uint8_t *data, size_t length, uint8_t bus_width) override {
+    if (length == 0)
+      return;
+    if (this->queue_.empty())
+      this->queue_.resize(QUEUE_DEPTH);
+    uint32_t flags = SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_DUMMY;
+    if (bus_width == 4) {
+      flags |= SPI_TRANS_MODE_QIO;
+    } else if (bus_width == 8) {
+      flags |= SPI_TRANS_MODE_OCT;
+    }
+    while (length != 0) {
+      // the descriptors are returned in order, so when all are in use the next one is the oldest.
+      if (this->queued_ == QUEUE_DEPTH)
+        this->get_queued_result_();
+      spi_transaction_ext_t &desc = this->queue_[this->queue_next_];
+      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+      desc = {};
+      desc.base.flags = flags;
+      desc.base.cmd = cmd;
+      desc.base.addr = address;
+      desc.command_bits = cmd_bits;
+      desc.address_bits = addr_bits;
+      desc.base.length = partial * 8;
+      desc.base.tx_buffer = data;
+      esp_err_t const err = spi_device_queue_trans(this->handle_, &desc.base, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Queue transfer failed - err %X", err);
+        return;
+      }
+      this->queued_++;
+      this->queue_next_ = (this->queue_next_ + 1) % QUEUE_DEPTH;
+      length -= partial;
+      data += partial;
+      // further chunks continue the data phase, so skip the command and address phases.
+      cmd_bits = 0;
+      addr_bits = 0;
+    }
+  }
+
+  void wait_queued() override {
+    while (this->queued_ != 0)
+      this->get_queued_result_();
+  }
+
  protected:
+  void get_queued_result_() {
+    spi_transaction_t *desc;
+    esp_err_t const err = spi_device_get_trans_result(this->handle_, &desc, portMAX_DELAY);
+    if (err != ESP_OK)
+      ESP_LOGE(TAG, "Queued transfer failed - err %X", err);
+    this->queued_--;
+  }
+
   bool add_device_() {
     spi_device_interface_config_t config = {};
     config.mode = static_cast<uint8_t>(this->mode_);
     config.clock_speed_hz = static_cast<int>(this->data_rate_);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = QUEUE_DEPTH;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (this->bit_order_ == BIT_ORDER_LSB_FIRST)
@@ -210,6 +274,10 @@ class SPIDelegateHw : public SPIDelegate {
   spi_device_handle_t handle_{};
   bool release_device_{false};
   bool write_only_{false};
+  // descriptors for queued transfers, allocated on first use.
+  std::vector<spi_transaction_ext_t> queue_{};
+  size_t queue_next_{0};
+  size_t queued_{0};
 };
 
 class SPIBusHw : public SPIBus {
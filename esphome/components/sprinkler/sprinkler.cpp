@@ -392,11 +392,10 @@ SprinklerValveRunRequestOrigin SprinklerValveRunRequest::request_is_from() { ret
 
 Sprinkler::Sprinkler() {}
 Sprinkler::Sprinkler(const std::string &name) {
-  // The `name` is needed to set timers up, hence non-default constructor
-  // replaces `set_name()` method previously existed
+  // non-default constructor replaces `set_name()` method previously existed
   this->name_ = name;
-  this->timer_.push_back({this->name_ + "sm", false, 0, 0, std::bind(&Sprinkler::sm_timer_callback_, this)});
-  this->timer_.push_back({this->name_ + "vs", false, 0, 0, std::bind(&Sprinkler::valve_selection_callback_, this)});
+  this->timer_.push_back({"sm", false, 0, 0, std::bind(&Sprinkler::sm_timer_callback_, this)});
+  this->timer_.push_back({"vs", false, 0, 0, std::bind(&Sprinkler::valve_selection_callback_, this)});
 }
 
 void Sprinkler::setup() { this->all_valves_off_(true); }
@@ -1645,8 +1644,9 @@ std::string Sprinkler::state_as_str_(SprinklerState state) {
 
 void Sprinkler::start_timer_(const SprinklerTimerIndex timer_index) {
   if (this->timer_duration_(timer_index) > 0) {
+    // the callback is looked up when the timer fires, so scheduling it copies neither a string nor a std::function
     this->set_timeout(this->timer_[timer_index].name, this->timer_duration_(timer_index),
-                      this->timer_cbf_(timer_index));
+                      [this, timer_index]() { this->timer_[timer_index].func(); });
     this->timer_[timer_index].start_time = millis();
     this->timer_[timer_index].active = true;
   }
@@ -78,7 +78,7 @@ struct SprinklerQueueItem {
 };
 
 struct SprinklerTimer {
-  const std::string name;
+  const char *name;  // timeout names are scoped to the component, so a literal is enough
   bool active;
   uint32_t time;
   uint32_t start_time;
@@ -56,10 +56,16 @@ async def to_code(config):
         )
     )
 
+    # the prefix is added to the metric names here, so they are sent as is
+    prefix = config[CONF_PREFIX]
+
+    def metric_name(sensor_cfg):
+        return f"{prefix}.{sensor_cfg[CONF_NAME]}" if prefix else sensor_cfg[CONF_NAME]
+
     for sensor_cfg in config.get(CONF_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
-        cg.add(var.register_sensor(sensor_cfg[CONF_NAME], s))
+        cg.add(var.register_sensor(metric_name(sensor_cfg), s))
 
     for sensor_cfg in config.get(CONF_BINARY_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
-        cg.add(var.register_binary_sensor(sensor_cfg[CONF_NAME], s))
+        cg.add(var.register_binary_sensor(metric_name(sensor_cfg), s))
@@ -6,7 +6,7 @@
 namespace esphome {
 namespace statsd {
 
-// send UDP packet if we reach 1Kb packed size
+// metrics are packed into UDP packets of up to 1Kb
 // this is needed since statsD does not support fragmented UDP packets
 static const uint16_t SEND_THRESHOLD = 1024;
 
@@ -43,7 +43,7 @@ void StatsdComponent::dump_config() {
                 "  host: %s\n"
                 "  port: %d",
                 this->host_, this->port_);
-  if (this->prefix_) {
+  if (this->prefix_ != nullptr && *this->prefix_ != 0) {
     ESP_LOGCONFIG(TAG, "  prefix: %s", this->prefix_);
   }
 
@@ -79,10 +79,11 @@ void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_s
 #endif
 
 void StatsdComponent::update() {
-  std::string out;
+  std::string &out = this->out_;
+  out.clear();
   out.reserve(SEND_THRESHOLD);
 
-  for (sensors_t s : this->sensors_) {
+  for (const sensors_t &s : this->sensors_) {
     double val = 0;
     switch (s.type) {
 #ifdef USE_SENSOR
@@ -109,24 +110,29 @@ void StatsdComponent::update() {
         continue;
     }
 
+    char value[32];
+    int value_len = snprintf(value, sizeof(value), ":%f|g\n", val);
+    if (value_len < 0 || (size_t) value_len >= sizeof(value))
+      continue;
+    size_t name_len = strlen(s.name);
+    size_t len = name_len + value_len;
+    if (val < 0)
+      len += name_len + sizeof(":0|g\n") - 1;
+    // start a new packet instead of going over the threshold
+    if (!out.empty() && out.length() + len > SEND_THRESHOLD) {
+      this->send_(&out);
+      out.clear();
+    }
+
     // statsD gauge:
     // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
     // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
     if (val < 0) {
-      if (this->prefix_) {
-        out.append(str_sprintf("%s.", this->prefix_));
-      }
-      out.append(str_sprintf("%s:0|g\n", s.name));
-    }
-    if (this->prefix_) {
-      out.append(str_sprintf("%s.", this->prefix_));
-    }
-    out.append(str_sprintf("%s:%f|g\n", s.name, val));
-
-    if (out.length() > SEND_THRESHOLD) {
-      this->send_(&out);
-      out.clear();
+      out.append(s.name, name_len);
+      out.append(":0|g\n");
     }
+    out.append(s.name, name_len);
+    out.append(value, value_len);
   }
 
   this->send_(&out);
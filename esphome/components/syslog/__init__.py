@@ -1,6 +1,10 @@
 import esphome.codegen as cg
 from esphome.components import udp
-from esphome.components.logger import LOG_LEVELS, is_log_level
+from esphome.components.logger import (
+    LOG_LEVELS,
+    is_log_level,
+    request_log_listener,
+)
 from esphome.components.time import RealTimeClock
 from esphome.components.udp import CONF_UDP_ID
 import esphome.config_validation as cv
@@ -16,15 +20,22 @@ Syslog = syslog_ns.class_("Syslog", Component, Parented.template(udp.UDPComponen
 
 CONF_STRIP = "strip"
 CONF_FACILITY = "facility"
-CONFIG_SCHEMA = udp.UDP_SCHEMA.extend(
-    {
-        cv.GenerateID(): cv.declare_id(Syslog),
-        cv.GenerateID(CONF_TIME_ID): cv.use_id(RealTimeClock),
-        cv.Optional(CONF_PORT, default=514): cv.port,
-        cv.Optional(CONF_LEVEL, default="DEBUG"): is_log_level,
-        cv.Optional(CONF_STRIP, default=True): cv.boolean,
-        cv.Optional(CONF_FACILITY, default=16): cv.int_range(0, 23),
-    }
+CONF_BATCH_INTERVAL = "batch_interval"
+CONFIG_SCHEMA = cv.All(
+    udp.UDP_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(Syslog),
+            cv.GenerateID(CONF_TIME_ID): cv.use_id(RealTimeClock),
+            cv.Optional(CONF_PORT, default=514): cv.port,
+            cv.Optional(CONF_LEVEL, default="DEBUG"): is_log_level,
+            cv.Optional(CONF_STRIP, default=True): cv.boolean,
+            cv.Optional(CONF_FACILITY, default=16): cv.int_range(0, 23),
+            cv.Optional(
+                CONF_BATCH_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+        }
+    ),
+    request_log_listener,
 )
 
 
@@ -39,3 +50,5 @@ async def to_code(config):
     await cg.register_parented(var, parent)
     cg.add(var.set_strip(config[CONF_STRIP]))
     cg.add(var.set_facility(config[CONF_FACILITY]))
+    if config[CONF_BATCH_INTERVAL].total_milliseconds != 0:
+        cg.add(var.set_batch_interval(config[CONF_BATCH_INTERVAL]))
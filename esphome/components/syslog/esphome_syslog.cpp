@@ -19,16 +19,48 @@ constexpr int LOG_LEVEL_TO_SYSLOG_SEVERITY[] = {
     7   // VERY_VERBOSE
 };
 
+static const char *const TAG = "syslog";
+
 void Syslog::setup() {
-  logger::global_logger->add_on_log_callback(
-      [this](int level, const char *tag, const char *message, size_t message_len) {
-        this->log_(level, tag, message, message_len);
-      });
+  if (this->batch_interval_ != 0) {
+    this->batch_ = std::make_unique<char[]>(udp::MAX_PACKET_SIZE);
+  }
+  // the loop only runs while a batch is waiting
+  this->disable_loop();
+  logger::global_logger->add_log_listener(
+      [](void *context, uint8_t level, const char *tag, const char *message, size_t message_len) {
+        static_cast<Syslog *>(context)->log_(level, tag, message, message_len);
+      },
+      this);
+}
+
+void Syslog::loop() {
+  if (millis() - this->batch_started_ >= this->batch_interval_)
+    this->flush_();
+}
+
+void Syslog::flush_() {
+  this->disable_loop();
+  if (this->batch_len_ == 0)
+    return;
+  this->flushing_ = true;
+  // the last newline is not sent
+  this->parent_->send_packet((const uint8_t *) this->batch_.get(), this->batch_len_ - 1);
+  this->batch_len_ = 0;
+  this->flushing_ = false;
+  if (this->dropped_ != 0) {
+    ESP_LOGW(TAG, "%" PRIu32 " messages dropped", this->dropped_);
+    this->dropped_ = 0;
+  }
 }
 
-void Syslog::log_(const int level, const char *tag, const char *message, size_t message_len) const {
+void Syslog::log_(const int level, const char *tag, const char *message, size_t message_len) {
   if (level > this->log_level_)
     return;
+  if (this->flushing_) {
+    this->dropped_++;
+    return;
+  }
   // Syslog PRI calculation: facility * 8 + severity
   int severity = 7;
   if ((unsigned) level <= 7) {
@@ -43,6 +75,33 @@ void Syslog::log_(const int level, const char *tag, const char *message, size_t
     len -= 11;
   }
 
+  if (this->batch_ != nullptr) {
+    // format into the free part of the batch, sending the batch first if the message does not fit
+    for (;;) {
+      size_t space = udp::MAX_PACKET_SIZE - this->batch_len_;
+      int ret = snprintf(this->batch_.get() + this->batch_len_, space, "<%d>%s %s %s: %.*s", pri, timestamp.c_str(),
+                         App.get_name().c_str(), tag, (int) len, message);
+      if (ret < 0)
+        return;
+      if ((size_t) ret < space) {
+        if (this->batch_len_ == 0) {
+          this->batch_started_ = millis();
+          this->enable_loop();
+        }
+        this->batch_len_ += ret;
+        this->batch_[this->batch_len_++] = '\n';
+        return;
+      }
+      if (this->batch_len_ == 0) {
+        // a message longer than a packet is sent truncated
+        this->batch_len_ = udp::MAX_PACKET_SIZE;
+        this->flush_();
+        return;
+      }
+      this->flush_();
+    }
+  }
+
   auto data = str_sprintf("<%d>%s %s %s: %.*s", pri, timestamp.c_str(), App.get_name().c_str(), tag, len, message);
   this->parent_->send_packet((const uint8_t *) data.data(), data.size());
 }
@@ -5,6 +5,8 @@
 #include "esphome/components/udp/udp_component.h"
 #include "esphome/components/time/real_time_clock.h"
 
+#include <memory>
+
 #ifdef USE_NETWORK
 namespace esphome {
 namespace syslog {
@@ -12,15 +14,27 @@ class Syslog : public Component, public Parented<udp::UDPComponent> {
  public:
   Syslog(int level, time::RealTimeClock *time) : log_level_(level), time_(time) {}
   void setup() override;
+  void loop() override;
   void set_strip(bool strip) { this->strip_ = strip; }
   void set_facility(int facility) { this->facility_ = facility; }
+  /// Collect messages for up to this long and send them together, one per line, in as few packets as possible.
+  void set_batch_interval(uint32_t batch_interval) { this->batch_interval_ = batch_interval; }
 
  protected:
   int log_level_;
-  void log_(int level, const char *tag, const char *message, size_t message_len) const;
+  void log_(int level, const char *tag, const char *message, size_t message_len);
+  void flush_();
   time::RealTimeClock *time_;
   bool strip_{true};
   int facility_{16};
+  uint32_t batch_interval_{0};
+  // Messages waiting to be sent, separated by newlines
+  std::unique_ptr<char[]> batch_{};
+  size_t batch_len_{0};
+  uint32_t batch_started_{0};
+  // Messages logged while a batch is sent are dropped, as sending may log itself
+  bool flushing_{false};
+  uint32_t dropped_{0};
 };
 }  // namespace syslog
 }  // namespace esphome
@@ -12,7 +12,8 @@ i2c::ErrorCode TCA9548AChannel::write_readv(uint8_t address, const uint8_t *writ
   if (err != i2c::ERROR_OK)
     return err;
   err = this->parent_->bus_->write_readv(address, write_buffer, write_count, read_buffer, read_count);
-  this->parent_->disable_all_channels();
+  if (!this->parent_->keep_channel_open_)
+    this->parent_->disable_all_channels();
   return err;
 }
 void TCA9548AComponent::setup() {
@@ -23,22 +24,37 @@ void TCA9548AComponent::setup() {
     return;
   }
   ESP_LOGD(TAG, "Channels currently open: %d", status);
+  this->channels_ = status;
+  this->channels_known_ = true;
 }
 void TCA9548AComponent::dump_config() {
-  ESP_LOGCONFIG(TAG, "TCA9548A:");
+  ESP_LOGCONFIG(TAG,
+                "TCA9548A:\n"
+                "  Keep Channel Open: %s",
+                YESNO(this->keep_channel_open_));
   LOG_I2C_DEVICE(this);
 }
 
+i2c::ErrorCode TCA9548AComponent::write_channels_(uint8_t channels) {
+  if (this->channels_known_ && this->channels_ == channels)
+    return i2c::ERROR_OK;
+
+  auto err = this->write(&channels, 1);
+  // After a failed write the register may or may not have been changed
+  this->channels_known_ = err == i2c::ERROR_OK;
+  this->channels_ = channels;
+  return err;
+}
+
 i2c::ErrorCode TCA9548AComponent::switch_to_channel(uint8_t channel) {
   if (this->is_failed())
     return i2c::ERROR_NOT_INITIALIZED;
 
-  uint8_t channel_val = 1 << channel;
-  return this->write(&channel_val, 1);
+  return this->write_channels_(1 << channel);
 }
 
 void TCA9548AComponent::disable_all_channels() {
-  if (this->write(&TCA9548A_DISABLE_CHANNELS_COMMAND, 1) != i2c::ERROR_OK) {
+  if (this->write_channels_(TCA9548A_DISABLE_CHANNELS_COMMAND) != i2c::ERROR_OK) {
     ESP_LOGE(TAG, "Failed to disable all channels.");
     this->status_set_error();  // couldn't disable channels, set error status
   }
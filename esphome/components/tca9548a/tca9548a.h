@@ -32,8 +32,19 @@ class TCA9548AComponent : public Component, public i2c::I2CDevice {
   i2c::ErrorCode switch_to_channel(uint8_t channel);
   void disable_all_channels();
 
+  /// Leave the last used channel enabled after an access, so consecutive accesses to the same channel don't switch
+  /// again. Only safe if no device on the upstream bus shares an address with a device behind this multiplexer.
+  void set_keep_channel_open(bool keep_channel_open) { this->keep_channel_open_ = keep_channel_open; }
+
  protected:
   friend class TCA9548AChannel;
+
+  /// Writes the channel register unless it already has this value.
+  i2c::ErrorCode write_channels_(uint8_t channels);
+
+  bool keep_channel_open_{false};
+  bool channels_known_{false};
+  uint8_t channels_{TCA9548A_DISABLE_CHANNELS_COMMAND};
 };
 }  // namespace tca9548a
 }  // namespace esphome
@@ -19,6 +19,9 @@ void ThermostatClimate::setup() {
   }
   // add a callback so that whenever the sensor state changes we can take action
   this->sensor_->add_on_state_callback([this](float state) {
+    // the action only depends on the temperature here, timers re-evaluate it on their own
+    if (state == this->current_temperature || (std::isnan(state) && std::isnan(this->current_temperature)))
+      return;
     this->current_temperature = state;
     // required action may have changed, recompute, refresh, we'll publish_state() later
     this->switch_to_action_(this->compute_action_(), false);
@@ -31,6 +34,8 @@ void ThermostatClimate::setup() {
   // register for humidity values and get initial state
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
+      if (state == this->current_humidity || (std::isnan(state) && std::isnan(this->current_humidity)))
+        return;
       this->current_humidity = state;
       this->publish_state();
     });
@@ -71,6 +76,12 @@ void ThermostatClimate::loop() {
       timer.func();
     }
   }
+  // the callbacks may have started other timers; with none left there is nothing to do until one is started
+  for (auto &timer : this->timer_) {
+    if (timer.active)
+      return;
+  }
+  this->disable_loop();
 }
 
 float ThermostatClimate::cool_deadband() { return this->cooling_deadband_; }
@@ -803,6 +814,7 @@ void ThermostatClimate::start_timer_(const ThermostatClimateTimerIndex timer_ind
   if (this->timer_duration_(timer_index) > 0) {
     this->timer_[timer_index].started = millis();
     this->timer_[timer_index].active = true;
+    this->enable_loop();
   }
 }
 
@@ -5,6 +5,7 @@ namespace esphome {
 namespace total_daily_energy {
 
 static const char *const TAG = "total_daily_energy";
+static const double MS_TO_HOURS = 1.0 / 3600000.0;
 
 void TotalDailyEnergy::setup() {
   float initial_value = 0;
@@ -34,17 +35,23 @@ void TotalDailyEnergy::loop() {
 
   if (t.day_of_year != this->last_day_of_year_) {
     this->last_day_of_year_ = t.day_of_year;
-    this->total_energy_ = 0;
     this->publish_state_and_save(0);
   }
 }
 
 void TotalDailyEnergy::publish_state_and_save(float state) {
   this->total_energy_ = state;
+  this->compensation_ = 0.0;
   this->publish_state(state);
-  if (this->restore_) {
-    this->pref_.save(&state);
-  }
+  this->save_(state);
+}
+
+void TotalDailyEnergy::save_(float state) {
+  // Only hand the value to the preferences when the stored float actually changes
+  if (!this->restore_ || state == this->saved_energy_)
+    return;
+  this->saved_energy_ = state;
+  this->pref_.save(&state);
 }
 
 void TotalDailyEnergy::process_new_state_(float state) {
@@ -53,8 +60,8 @@ void TotalDailyEnergy::process_new_state_(float state) {
   const uint32_t now = millis();
   const float old_state = this->last_power_state_;
   const float new_state = state;
-  float delta_hours = (now - this->last_update_) / 1000.0f / 60.0f / 60.0f;
-  float delta_energy = 0.0f;
+  const double delta_hours = (now - this->last_update_) * MS_TO_HOURS;
+  double delta_energy = 0.0;
   switch (this->method_) {
     case TOTAL_DAILY_ENERGY_METHOD_TRAPEZOID:
       delta_energy = delta_hours * (old_state + new_state) / 2.0;
@@ -68,7 +75,13 @@ void TotalDailyEnergy::process_new_state_(float state) {
   }
   this->last_power_state_ = new_state;
   this->last_update_ = now;
-  this->publish_state_and_save(this->total_energy_ + delta_energy);
+  // Compensated (Kahan) summation
+  const double y = delta_energy - this->compensation_;
+  const double t = this->total_energy_ + y;
+  this->compensation_ = (t - this->total_energy_) - y;
+  this->total_energy_ = t;
+  this->publish_state(t);
+  this->save_(t);
 }
 
 }  // namespace total_daily_energy
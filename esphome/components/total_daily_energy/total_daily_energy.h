@@ -29,6 +29,7 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
 
  protected:
   void process_new_state_(float state);
+  void save_(float state);
 
   ESPPreferenceObject pref_;
   time::RealTimeClock *time_;
@@ -37,7 +38,10 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
   uint16_t last_day_of_year_{};
   uint32_t last_update_{0};
   bool restore_;
-  float total_energy_{0.0f};
+  /// Kept in double precision with a compensation term, so small deltas are not lost on a large total.
+  double total_energy_{0.0};
+  double compensation_{0.0};
+  float saved_energy_{NAN};
   float last_power_state_{0.0f};
 };
 
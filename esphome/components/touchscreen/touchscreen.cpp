@@ -7,9 +7,13 @@ namespace touchscreen {
 
 static const char *const TAG = "touchscreen";
 
-void TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) { store->touched = true; }
+void IRAM_ATTR TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) {
+  store->touched = true;
+  store->component->enable_loop_soon_any_context();
+}
 
 void Touchscreen::attach_interrupt_(InternalGPIOPin *irq_pin, esphome::gpio::InterruptType type) {
+  this->store_.component = this;
   irq_pin->attach_interrupt(TouchscreenInterrupt::gpio_intr, &this->store_, type);
   this->store_.init = true;
   this->store_.touched = false;
@@ -27,6 +31,7 @@ void Touchscreen::call_setup() {
 void Touchscreen::update() {
   if (!this->store_.init) {
     this->store_.touched = true;
+    this->enable_loop();
   } else {
     // no need to poll if we have interrupts.
     ESP_LOGW(TAG, "Touch Polling Stopped. You can safely remove the 'update_interval:' variable from the YAML file.");
@@ -35,7 +40,12 @@ void Touchscreen::update() {
 }
 
 void Touchscreen::loop() {
-  if (this->store_.touched) {
+  if (!this->store_.touched) {
+    // Nothing to read until the next interrupt, poll or release timeout, which enable the loop again
+    this->disable_loop();
+    return;
+  }
+  {
     ESP_LOGVV(TAG, "<< Do Touch loop >>");
     this->first_touch_ = this->touches_.empty();
     this->need_update_ = false;
@@ -64,7 +74,10 @@ void Touchscreen::loop() {
         // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
         // This is to detect touch release.
         if (this->is_touched_) {
-          this->set_timeout(TAG, this->touch_timeout_, [this]() { this->store_.touched = true; });
+          this->set_timeout(TAG, this->touch_timeout_, [this]() {
+            this->store_.touched = true;
+            this->enable_loop();
+          });
         } else {
           this->cancel_timeout(TAG);
         }
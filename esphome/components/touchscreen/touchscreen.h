@@ -32,6 +32,7 @@ using TouchPoints_t = std::vector<TouchPoint>;
 struct TouchscreenInterrupt {
   volatile bool touched{true};
   bool init{false};
+  Component *component{nullptr};  // its loop is woken up by the interrupt
   static void gpio_intr(TouchscreenInterrupt *store);
 };
 
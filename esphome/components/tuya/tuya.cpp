@@ -652,7 +652,8 @@ void Tuya::set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType
   } else if (datapoint->type != datapoint_type) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
     return;
-  } else if (!forced && datapoint->value_uint == value) {
+  } else if (!forced && datapoint->value_uint == value &&
+             this->get_pending_datapoint_command_(datapoint_id) == nullptr) {
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
@@ -682,7 +683,8 @@ void Tuya::set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint
   } else if (datapoint->type != TuyaDatapointType::RAW) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
     return;
-  } else if (!forced && datapoint->value_raw == value) {
+  } else if (!forced && datapoint->value_raw == value &&
+             this->get_pending_datapoint_command_(datapoint_id) == nullptr) {
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
@@ -697,7 +699,8 @@ void Tuya::set_string_datapoint_value_(uint8_t datapoint_id, const std::string &
   } else if (datapoint->type != TuyaDatapointType::STRING) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
     return;
-  } else if (!forced && datapoint->value_string == value) {
+  } else if (!forced && datapoint->value_string == value &&
+             this->get_pending_datapoint_command_(datapoint_id) == nullptr) {
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
@@ -716,9 +719,29 @@ void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datap
   buffer.push_back(data.size() >> 0);
   buffer.insert(buffer.end(), data.begin(), data.end());
 
+  // A transition or a climate change can set the same datapoint many times while the MCU is still busy, only the
+  // last value has to be sent
+  TuyaCommand *pending = this->get_pending_datapoint_command_(datapoint_id);
+  if (pending != nullptr) {
+    ESP_LOGV(TAG, "Replacing queued value of datapoint %u", datapoint_id);
+    pending->payload = std::move(buffer);
+    return;
+  }
   this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = buffer});
 }
 
+TuyaCommand *Tuya::get_pending_datapoint_command_(uint8_t datapoint_id) {
+  // The first command is still waiting for its response when one is expected, it has already been sent
+  auto it = this->command_queue_.begin();
+  if (it != this->command_queue_.end() && this->expected_response_.has_value())
+    it++;
+  for (; it != this->command_queue_.end(); it++) {
+    if (it->cmd == TuyaCommandType::DATAPOINT_DELIVER && !it->payload.empty() && it->payload[0] == datapoint_id)
+      return &*it;
+  }
+  return nullptr;
+}
+
 void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(TuyaDatapoint)> &func) {
   auto listener = TuyaDatapointListener{
       .datapoint_id = datapoint_id,
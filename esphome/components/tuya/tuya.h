@@ -132,6 +132,8 @@ class Tuya : public Component, public uart::UARTDevice {
   void set_string_datapoint_value_(uint8_t datapoint_id, const std::string &value, bool forced);
   void set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint8_t> &value, bool forced);
   void send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, std::vector<uint8_t> data);
+  /// Returns the queued, not yet sent command that sets \p datapoint_id, or nullptr.
+  TuyaCommand *get_pending_datapoint_command_(uint8_t datapoint_id);
   void set_status_pin_();
   void send_wifi_status_();
   uint8_t get_wifi_status_code_();
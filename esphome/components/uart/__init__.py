@@ -21,6 +21,7 @@ from esphome.const import (
     CONF_DIRECTION,
     CONF_DUMMY_RECEIVER,
     CONF_DUMMY_RECEIVER_ID,
+    CONF_FILE,
     CONF_ID,
     CONF_INVERT,
     CONF_LAMBDA,
@@ -29,6 +30,7 @@ from esphome.const import (
     CONF_RX_BUFFER_SIZE,
     CONF_RX_PIN,
     CONF_SEQUENCE,
+    CONF_SPEED,
     CONF_TIMEOUT,
     CONF_TRIGGER_ID,
     CONF_TX_PIN,
@@ -60,6 +62,8 @@ NATIVE_UART_CLASSES = (
     str(LibreTinyUARTComponent),
 )
 
+CONF_REPLAY = "replay"
+
 HOST_BAUD_RATES = [
     50,
     75,
@@ -239,6 +243,16 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_TX_PIN): pins.internal_gpio_output_pin_schema,
             cv.Optional(CONF_RX_PIN): validate_rx_pin,
             cv.Optional(CONF_PORT): cv.All(validate_port, cv.only_on(PLATFORM_HOST)),
+            # Replay the data logged by UARTDebug::log_capture() instead of a port
+            cv.Optional(CONF_REPLAY): cv.All(
+                cv.Schema(
+                    {
+                        cv.Required(CONF_FILE): cv.file_,
+                        cv.Optional(CONF_SPEED, default=1.0): cv.positive_float,
+                    }
+                ),
+                cv.only_on(PLATFORM_HOST),
+            ),
             cv.Optional(CONF_RX_BUFFER_SIZE, default=256): cv.validate_bytes,
             cv.Optional(CONF_STOP_BITS, default=1): cv.one_of(1, 2, int=True),
             cv.Optional(CONF_DATA_BITS, default=8): cv.int_range(min=5, max=8),
@@ -252,7 +266,8 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_HALF_DUPLEX, default=False): cv.boolean,
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN, CONF_PORT),
+    cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN, CONF_PORT, CONF_REPLAY),
+    cv.has_at_most_one_key(CONF_PORT, CONF_REPLAY),
     validate_esp32,
     validate_host_config,
 )
@@ -298,6 +313,9 @@ async def to_code(config):
         cg.add(var.set_rx_pin(rx_pin))
     if CONF_PORT in config:
         cg.add(var.set_name(config[CONF_PORT]))
+    if replay := config.get(CONF_REPLAY):
+        cg.add(var.set_replay_file(str(replay[CONF_FILE].resolve())))
+        cg.add(var.set_replay_speed(replay[CONF_SPEED]))
     cg.add(var.set_rx_buffer_size(config[CONF_RX_BUFFER_SIZE]))
     cg.add(var.set_stop_bits(config[CONF_STOP_BITS]))
     cg.add(var.set_data_bits(config[CONF_DATA_BITS]))
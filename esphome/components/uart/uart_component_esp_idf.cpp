@@ -1,7 +1,9 @@
 #ifdef USE_ESP32
 
 #include "uart_component_esp_idf.h"
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 #include "esphome/core/application.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
@@ -214,38 +216,53 @@ void IDFUARTComponent::write_array(const uint8_t *data, size_t len) {
 #endif
 }
 
+void IDFUARTComponent::fill_rx_cache_(TickType_t ticks_to_wait) {
+  size_t buffered = 0;
+  uart_get_buffered_data_len(this->uart_num_, &buffered);
+  size_t to_read = std::min<size_t>(std::max<size_t>(buffered, 1), RX_CACHE_SIZE);
+  int len = uart_read_bytes(this->uart_num_, this->rx_cache_, to_read, buffered > 0 ? 0 : ticks_to_wait);
+  this->rx_cache_pos_ = 0;
+  this->rx_cache_len_ = len > 0 ? len : 0;
+}
+
 bool IDFUARTComponent::peek_byte(uint8_t *data) {
   if (!this->check_read_timeout_())
     return false;
   xSemaphoreTake(this->lock_, portMAX_DELAY);
-  if (this->has_peek_) {
-    *data = this->peek_byte_;
+  if (this->rx_cache_pos_ == this->rx_cache_len_)
+    this->fill_rx_cache_(20 / portTICK_PERIOD_MS);
+  if (this->rx_cache_pos_ == this->rx_cache_len_) {
+    *data = 0;
   } else {
-    int len = uart_read_bytes(this->uart_num_, data, 1, 20 / portTICK_PERIOD_MS);
-    if (len == 0) {
-      *data = 0;
-    } else {
-      this->has_peek_ = true;
-      this->peek_byte_ = *data;
-    }
+    *data = this->rx_cache_[this->rx_cache_pos_];
   }
   xSemaphoreGive(this->lock_);
   return true;
 }
 
 bool IDFUARTComponent::read_array(uint8_t *data, size_t len) {
-  size_t length_to_read = len;
   if (!this->check_read_timeout_(len))
     return false;
   xSemaphoreTake(this->lock_, portMAX_DELAY);
-  if (this->has_peek_) {
-    length_to_read--;
-    *data = this->peek_byte_;
-    data++;
-    this->has_peek_ = false;
+  uint8_t *dst = data;
+  size_t remaining = len;
+  while (remaining > 0) {
+    if (this->rx_cache_pos_ == this->rx_cache_len_) {
+      if (remaining >= RX_CACHE_SIZE) {
+        // Large reads go directly into the destination
+        uart_read_bytes(this->uart_num_, dst, remaining, 20 / portTICK_PERIOD_MS);
+        break;
+      }
+      this->fill_rx_cache_(20 / portTICK_PERIOD_MS);
+      if (this->rx_cache_pos_ == this->rx_cache_len_)
+        break;
+    }
+    size_t chunk = std::min<size_t>(remaining, this->rx_cache_len_ - this->rx_cache_pos_);
+    memcpy(dst, this->rx_cache_ + this->rx_cache_pos_, chunk);
+    this->rx_cache_pos_ += chunk;
+    dst += chunk;
+    remaining -= chunk;
   }
-  if (length_to_read > 0)
-    uart_read_bytes(this->uart_num_, data, length_to_read, 20 / portTICK_PERIOD_MS);
   xSemaphoreGive(this->lock_);
 #ifdef USE_UART_DEBUGGER
   for (size_t i = 0; i < len; i++) {
@@ -260,8 +277,7 @@ int IDFUARTComponent::available() {
 
   xSemaphoreTake(this->lock_, portMAX_DELAY);
   uart_get_buffered_data_len(this->uart_num_, &available);
-  if (this->has_peek_)
-    available++;
+  available += this->rx_cache_len_ - this->rx_cache_pos_;
   xSemaphoreGive(this->lock_);
 
   return available;
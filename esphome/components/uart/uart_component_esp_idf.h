@@ -54,8 +54,15 @@ class IDFUARTComponent : public UARTComponent, public Component {
   int8_t idle_pin_;
   uint32_t invert_;
 
-  bool has_peek_{false};
-  uint8_t peek_byte_;
+  /// Moves buffered bytes from the driver into rx_cache_, must be called with lock_ taken and an empty cache.
+  /// @param ticks_to_wait how long to wait for a byte if the driver has none buffered
+  void fill_rx_cache_(TickType_t ticks_to_wait);
+
+  // Drivers mostly read byte by byte, so bytes are taken from the driver in batches and served from here
+  static constexpr size_t RX_CACHE_SIZE = 64;
+  uint8_t rx_cache_[RX_CACHE_SIZE];
+  uint8_t rx_cache_pos_{0};
+  uint8_t rx_cache_len_{0};
 };
 
 }  // namespace uart
@@ -11,6 +11,9 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -109,6 +112,10 @@ HostUartComponent::~HostUartComponent() {
 }
 
 void HostUartComponent::setup() {
+  if (this->is_replaying_()) {
+    this->setup_replay_();
+    return;
+  }
   ESP_LOGCONFIG(TAG, "Opening UART port");
   speed_t baud = get_baud(this->baud_rate_);
   if (baud == B0) {
@@ -178,8 +185,58 @@ void HostUartComponent::setup() {
   tcsetattr(this->file_descriptor_, TCSANOW, &options);
 }
 
+void HostUartComponent::setup_replay_() {
+  std::ifstream file(this->replay_file_);
+  if (!file) {
+    this->update_error_(strerror(errno));
+    this->mark_failed();
+    return;
+  }
+  // Lines look like "... capture <millis> <<< 0102AB", anything before the marker is the log prefix
+  std::string line;
+  uint32_t first_time = 0;
+  while (std::getline(file, line)) {
+    size_t pos = line.find("capture ");
+    if (pos == std::string::npos)
+      continue;
+    uint32_t time;
+    char direction[4];
+    char hex[1024];
+    if (sscanf(line.c_str() + pos, "capture %" SCNu32 " %3s %1023s", &time, direction, hex) != 3 ||
+        strcmp(direction, "<<<") != 0)
+      continue;
+    ReplayChunk chunk;
+    if (!parse_hex(hex, chunk.data, strlen(hex) / 2))
+      continue;
+    if (this->replay_chunks_.empty())
+      first_time = time;
+    chunk.time = time - first_time;
+    this->replay_chunks_.push_back(std::move(chunk));
+  }
+  this->replay_start_ = millis();
+}
+
+void HostUartComponent::advance_replay_() {
+  const uint32_t elapsed = millis() - this->replay_start_;
+  while (this->replay_next_ < this->replay_chunks_.size()) {
+    const ReplayChunk &chunk = this->replay_chunks_[this->replay_next_];
+    if (this->replay_speed_ > 0.0f && chunk.time / this->replay_speed_ > elapsed)
+      break;
+    this->replay_rx_.insert(this->replay_rx_.end(), chunk.data.begin(), chunk.data.end());
+    this->replay_next_++;
+  }
+}
+
 void HostUartComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "UART:");
+  if (this->is_replaying_()) {
+    ESP_LOGCONFIG(TAG,
+                  "  Replay file: %s\n"
+                  "  Replay speed: %.1fx\n"
+                  "  Chunks: %zu",
+                  this->replay_file_.c_str(), this->replay_speed_, this->replay_chunks_.size());
+    return;
+  }
   ESP_LOGCONFIG(TAG, "  Port: %s", this->port_name_.c_str());
   if (this->file_descriptor_ == -1) {
     ESP_LOGCONFIG(TAG, "  Port status: Not opened");
@@ -203,6 +260,15 @@ void HostUartComponent::dump_config() {
 }
 
 void HostUartComponent::write_array(const uint8_t *data, size_t len) {
+  if (this->is_replaying_()) {
+    // The replayed device does not react, sent data only goes to the debugger
+#ifdef USE_UART_DEBUGGER
+    for (size_t i = 0; i < len; i++) {
+      this->debug_callback_.call(UART_DIRECTION_TX, data[i]);
+    }
+#endif
+    return;
+  }
   if (this->file_descriptor_ == -1) {
     return;
   }
@@ -220,6 +286,13 @@ void HostUartComponent::write_array(const uint8_t *data, size_t len) {
 }
 
 bool HostUartComponent::peek_byte(uint8_t *data) {
+  if (this->is_replaying_()) {
+    this->advance_replay_();
+    if (this->replay_rx_.empty())
+      return false;
+    *data = this->replay_rx_.front();
+    return true;
+  }
   if (this->file_descriptor_ == -1) {
     return false;
   }
@@ -238,6 +311,18 @@ bool HostUartComponent::peek_byte(uint8_t *data) {
 }
 
 bool HostUartComponent::read_array(uint8_t *data, size_t len) {
+  if (this->is_replaying_() && len > 0) {
+    if (!this->check_read_timeout_(len))
+      return false;
+    std::copy_n(this->replay_rx_.begin(), len, data);
+    this->replay_rx_.erase(this->replay_rx_.begin(), this->replay_rx_.begin() + len);
+#ifdef USE_UART_DEBUGGER
+    for (size_t i = 0; i < len; i++) {
+      this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+    }
+#endif
+    return true;
+  }
   if ((this->file_descriptor_ == -1) || (len == 0)) {
     return false;
   }
@@ -267,6 +352,10 @@ bool HostUartComponent::read_array(uint8_t *data, size_t len) {
 }
 
 int HostUartComponent::available() {
+  if (this->is_replaying_()) {
+    this->advance_replay_();
+    return this->replay_rx_.size();
+  }
   if (this->file_descriptor_ == -1) {
     return 0;
   }
@@ -282,6 +371,9 @@ int HostUartComponent::available() {
 };
 
 void HostUartComponent::flush() {
+  if (this->is_replaying_()) {
+    return;
+  }
   if (this->file_descriptor_ == -1) {
     return;
   }
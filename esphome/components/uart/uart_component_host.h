@@ -2,6 +2,9 @@
 
 #ifdef USE_HOST
 
+#include <deque>
+#include <string>
+#include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include "uart_component.h"
@@ -21,8 +24,21 @@ class HostUartComponent : public UARTComponent, public Component {
   int available() override;
   void flush() override;
   void set_name(std::string port_name) { port_name_ = port_name; };
+  /// Feed the received data of a capture file instead of opening a port, see UARTDebug::log_capture().
+  void set_replay_file(std::string replay_file) { this->replay_file_ = std::move(replay_file); }
+  /// How much faster than recorded to replay, 0 makes all data available at once.
+  void set_replay_speed(float replay_speed) { this->replay_speed_ = replay_speed; }
 
  protected:
+  struct ReplayChunk {
+    uint32_t time;
+    std::vector<uint8_t> data;
+  };
+
+  bool is_replaying_() const { return !this->replay_file_.empty(); }
+  void setup_replay_();
+  /// Moves the chunks that are due into the receive buffer.
+  void advance_replay_();
   void update_error_(const std::string &error);
   void check_logger_conflict() override {}
   std::string port_name_;
@@ -30,6 +46,12 @@ class HostUartComponent : public UARTComponent, public Component {
   int file_descriptor_ = -1;
   bool has_peek_{false};
   uint8_t peek_byte_;
+  std::string replay_file_;
+  float replay_speed_{1.0f};
+  std::vector<ReplayChunk> replay_chunks_;
+  size_t replay_next_{0};
+  uint32_t replay_start_{0};
+  std::deque<uint8_t> replay_rx_;
 };
 
 }  // namespace uart
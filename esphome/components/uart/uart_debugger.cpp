@@ -1,6 +1,7 @@
 #include "esphome/core/defines.h"
 #ifdef USE_UART_DEBUGGER
 
+#include <cinttypes>
 #include <vector>
 #include "uart_debugger.h"
 #include "esphome/core/helpers.h"
@@ -197,6 +198,12 @@ void UARTDebug::log_binary(UARTDirection direction, std::vector<uint8_t> bytes,
   delay(10);
 }
 
+void UARTDebug::log_capture(UARTDirection direction, std::vector<uint8_t> bytes) {
+  // No delay() here, it would shift the timestamps of the data that follows
+  ESP_LOGD(TAG, "capture %" PRIu32 " %s %s", millis(), direction == UART_DIRECTION_RX ? "<<<" : ">>>",
+           format_hex(bytes).c_str());
+}
+
 }  // namespace uart
 }  // namespace esphome
 #endif
@@ -94,6 +94,10 @@ class UARTDebug {
   /// Log the bytes as '<binary> (<hex>)' values, separated by the provided
   /// separator.
   static void log_binary(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator);
+
+  /// Log the bytes with a timestamp in the capture format, which a host UART
+  /// can replay. A saved log of these lines is a capture file.
+  static void log_capture(UARTDirection direction, std::vector<uint8_t> bytes);
 };
 
 }  // namespace uart
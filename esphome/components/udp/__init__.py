@@ -30,6 +30,7 @@ CONF_LISTEN_ADDRESS = "listen_address"
 CONF_UDP_ID = "udp_id"
 CONF_LISTEN_PORT = "listen_port"
 CONF_BROADCAST_PORT = "broadcast_port"
+CONF_RELAY = "relay"
 
 UDP_SCHEMA = cv.Schema(
     {
@@ -77,6 +78,7 @@ CONFIG_SCHEMA = cv.COMPONENT_SCHEMA.extend(
         cv.Optional(CONF_ADDRESSES, default=["255.255.255.255"]): cv.ensure_list(
             cv.ipv4address,
         ),
+        cv.Optional(CONF_RELAY, default=False): cv.boolean,
         cv.Optional(CONF_ON_RECEIVE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -110,6 +112,10 @@ async def to_code(config):
         cg.add(var.set_listen_address(listen_address))
     for address in config[CONF_ADDRESSES]:
         cg.add(var.add_address(str(address)))
+    if config[CONF_RELAY]:
+        cg.add(var.set_relay(True))
+        cg.add(var.set_should_listen())
+        cg.add(var.set_should_broadcast())
     if on_receive := config.get(CONF_ON_RECEIVE):
         on_receive = on_receive[0]
         trigger = cg.new_Pvariable(on_receive[CONF_TRIGGER_ID])
@@ -116,11 +116,37 @@ void UDPComponent::loop() {
         break;
       buf.resize(len);
       ESP_LOGV(TAG, "Received packet of length %zu", len);
+      if (this->relay_) {
+        // a relayed packet may come back through another relay or multicast loopback
+        if (this->relay_seen_(buf)) {
+          ESP_LOGV(TAG, "Dropped duplicate packet");
+          buf.resize(MAX_PACKET_SIZE);
+          continue;
+        }
+        this->send_packet(buf);
+      }
       this->packet_listeners_.call(buf);
+      buf.resize(MAX_PACKET_SIZE);
     }
   }
 }
 
+bool UDPComponent::relay_seen_(const std::vector<uint8_t> &buf) {
+  // FNV-1a over the whole packet. Rolling codes and ping keys make packets unique, so equal hashes are duplicates.
+  uint32_t hash = 2166136261UL;
+  for (auto byte : buf) {
+    hash ^= byte;
+    hash *= 16777619UL;
+  }
+  for (auto seen : this->relay_history_) {
+    if (seen == hash)
+      return true;
+  }
+  this->relay_history_[this->relay_history_pos_] = hash;
+  this->relay_history_pos_ = (this->relay_history_pos_ + 1) % RELAY_HISTORY_SIZE;
+  return false;
+}
+
 void UDPComponent::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "UDP:\n"
@@ -134,8 +160,9 @@ void UDPComponent::dump_config() {
   }
   ESP_LOGCONFIG(TAG,
                 "  Broadcasting: %s\n"
-                "  Listening: %s",
-                YESNO(this->should_broadcast_), YESNO(this->should_listen_));
+                "  Listening: %s\n"
+                "  Relay: %s",
+                YESNO(this->should_broadcast_), YESNO(this->should_listen_), YESNO(this->relay_));
 }
 
 void UDPComponent::send_packet(const uint8_t *data, size_t size) {
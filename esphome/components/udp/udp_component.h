@@ -9,12 +9,15 @@
 #ifdef USE_SOCKET_IMPL_LWIP_TCP
 #include <WiFiUdp.h>
 #endif
+#include <array>
 #include <vector>
 
 namespace esphome {
 namespace udp {
 
 static const size_t MAX_PACKET_SIZE = 508;
+// number of recently seen packets remembered by a relay to drop duplicates
+static const size_t RELAY_HISTORY_SIZE = 16;
 class UDPComponent : public Component {
  public:
   void add_address(const char *addr) { this->addresses_.emplace_back(addr); }
@@ -23,6 +26,8 @@ class UDPComponent : public Component {
   void set_broadcast_port(uint16_t port) { this->broadcast_port_ = port; }
   void set_should_broadcast() { this->should_broadcast_ = true; }
   void set_should_listen() { this->should_listen_ = true; }
+  /// Forward received packets to the configured addresses, e.g. from one multicast group or network to another.
+  void set_relay(bool relay) { this->relay_ = relay; }
   void add_listener(std::function<void(std::vector<uint8_t> &)> &&listener) {
     this->packet_listeners_.add(std::move(listener));
   }
@@ -38,6 +43,7 @@ class UDPComponent : public Component {
   uint16_t broadcast_port_{};
   bool should_broadcast_{};
   bool should_listen_{};
+  bool relay_{};
   CallbackManager<void(std::vector<uint8_t> &)> packet_listeners_{};
 
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
@@ -52,6 +58,11 @@ class UDPComponent : public Component {
   std::vector<std::string> addresses_{};
 
   optional<network::IPAddress> listen_address_{};
+
+  // hashes of the packets recently relayed
+  bool relay_seen_(const std::vector<uint8_t> &buf);
+  std::array<uint32_t, RELAY_HISTORY_SIZE> relay_history_{};
+  size_t relay_history_pos_{};
 };
 
 }  // namespace udp
@@ -4,7 +4,9 @@
 #include "esphome/core/log.h"
 #include "esphome/components/uart/uart_debugger.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 namespace esphome {
 namespace usb_uart {
@@ -110,10 +112,11 @@ void RingBuffer::push(uint8_t item) {
   this->insert_pos_ = (this->insert_pos_ + 1) % this->buffer_size_;
 }
 void RingBuffer::push(const uint8_t *data, size_t len) {
-  for (size_t i = 0; i != len; i++) {
-    this->buffer_[this->insert_pos_] = *data++;
-    this->insert_pos_ = (this->insert_pos_ + 1) % this->buffer_size_;
-  }
+  // Copy up to the end of the buffer, then the rest to its start
+  size_t first = std::min<size_t>(len, this->buffer_size_ - this->insert_pos_);
+  memcpy(this->buffer_ + this->insert_pos_, data, first);
+  memcpy(this->buffer_, data + first, len - first);
+  this->insert_pos_ = (this->insert_pos_ + len) % this->buffer_size_;
 }
 
 uint8_t RingBuffer::pop() {
@@ -123,10 +126,10 @@ uint8_t RingBuffer::pop() {
 }
 size_t RingBuffer::pop(uint8_t *data, size_t len) {
   len = std::min(len, this->get_available());
-  for (size_t i = 0; i != len; i++) {
-    *data++ = this->buffer_[this->read_pos_];
-    this->read_pos_ = (this->read_pos_ + 1) % this->buffer_size_;
-  }
+  size_t first = std::min<size_t>(len, this->buffer_size_ - this->read_pos_);
+  memcpy(data, this->buffer_ + this->read_pos_, first);
+  memcpy(data + first, this->buffer_, len - first);
+  this->read_pos_ = (this->read_pos_ + len) % this->buffer_size_;
   return len;
 }
 void USBUartChannel::write_array(const uint8_t *data, size_t len) {
@@ -134,12 +137,10 @@ void USBUartChannel::write_array(const uint8_t *data, size_t len) {
     ESP_LOGV(TAG, "Channel not initialised - write ignored");
     return;
   }
-  while (this->output_buffer_.get_free_space() != 0 && len-- != 0) {
-    this->output_buffer_.push(*data++);
-  }
-  len++;
-  if (len > 0) {
-    ESP_LOGE(TAG, "Buffer full - failed to write %d bytes", len);
+  size_t count = std::min(len, this->output_buffer_.get_free_space());
+  this->output_buffer_.push(data, count);
+  if (count != len) {
+    ESP_LOGE(TAG, "Buffer full - failed to write %zu bytes", len - count);
   }
   this->parent_->start_output(this);
 }
@@ -163,9 +164,7 @@ bool USBUartChannel::read_array(uint8_t *data, size_t len) {
     len = available;
     status = false;
   }
-  for (size_t i = 0; i != len; i++) {
-    *data++ = this->input_buffer_.pop();
-  }
+  this->input_buffer_.pop(data, len);
   this->parent_->start_input(this);
   return status;
 }
@@ -187,12 +186,12 @@ void USBUartComponent::dump_config() {
   }
 }
 void USBUartComponent::start_input(USBUartChannel *channel) {
-  if (!channel->initialised_ || channel->input_started_ ||
-      channel->input_buffer_.get_free_space() < channel->cdc_dev_.in_ep->wMaxPacketSize)
+  if (!channel->initialised_ || !channel->enabled_)
     return;
   const auto *ep = channel->cdc_dev_.in_ep;
   auto callback = [this, channel](const usb_host::TransferStatus &status) {
     ESP_LOGV(TAG, "Transfer result: length: %u; status %X", status.data_len, status.error_code);
+    channel->input_pending_--;
     if (!status.success) {
       ESP_LOGE(TAG, "Control transfer failed, status=%s", esp_err_to_name(status.error_code));
       return;
@@ -203,42 +202,42 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
                                std::vector<uint8_t>(status.data, status.data + status.data_len), ',');  // NOLINT()
     }
 #endif
-    channel->input_started_ = false;
     if (!channel->dummy_receiver_) {
-      for (size_t i = 0; i != status.data_len; i++) {
-        channel->input_buffer_.push(status.data[i]);
-      }
-    }
-    if (channel->input_buffer_.get_free_space() >= channel->cdc_dev_.in_ep->wMaxPacketSize) {
-      this->defer([this, channel] { this->start_input(channel); });
+      channel->input_buffer_.push(status.data, std::min(status.data_len, channel->input_buffer_.get_free_space()));
     }
+    this->defer([this, channel] { this->start_input(channel); });
   };
-  channel->input_started_ = true;
-  this->transfer_in(ep->bEndpointAddress, callback, ep->wMaxPacketSize);
+  // Keep several transfers queued as long as the buffer can take the data of all of them
+  while (channel->input_pending_ < USB_UART_TRANSFERS &&
+         channel->input_buffer_.get_free_space() >= (channel->input_pending_ + 1u) * ep->wMaxPacketSize) {
+    if (!this->transfer_in(ep->bEndpointAddress, callback, ep->wMaxPacketSize))
+      return;
+    channel->input_pending_++;
+  }
 }
 
 void USBUartComponent::start_output(USBUartChannel *channel) {
-  if (channel->output_started_)
+  if (!channel->enabled_)
     return;
-  if (channel->output_buffer_.is_empty()) {
-    return;
-  }
   const auto *ep = channel->cdc_dev_.out_ep;
   auto callback = [this, channel](const usb_host::TransferStatus &status) {
     ESP_LOGV(TAG, "Output Transfer result: length: %u; status %X", status.data_len, status.error_code);
-    channel->output_started_ = false;
+    channel->output_pending_--;
     this->defer([this, channel] { this->start_output(channel); });
   };
-  channel->output_started_ = true;
   uint8_t data[ep->wMaxPacketSize];
-  auto len = channel->output_buffer_.pop(data, ep->wMaxPacketSize);
-  this->transfer_out(ep->bEndpointAddress, callback, data, len);
+  while (channel->output_pending_ < USB_UART_TRANSFERS && !channel->output_buffer_.is_empty()) {
+    auto len = channel->output_buffer_.pop(data, ep->wMaxPacketSize);
+    if (!this->transfer_out(ep->bEndpointAddress, callback, data, len))
+      return;
+    channel->output_pending_++;
 #ifdef USE_UART_DEBUGGER
-  if (channel->debug_) {
-    uart::UARTDebug::log_hex(uart::UART_DIRECTION_TX, std::vector<uint8_t>(data, data + len), ',');  // NOLINT()
-  }
+    if (channel->debug_) {
+      uart::UARTDebug::log_hex(uart::UART_DIRECTION_TX, std::vector<uint8_t>(data, data + len), ',');  // NOLINT()
+    }
 #endif
-  ESP_LOGV(TAG, "Output %d bytes started", len);
+    ESP_LOGV(TAG, "Output %d bytes started", len);
+  }
 }
 
 /**
@@ -302,8 +301,9 @@ void USBUartTypeCdcAcm::on_disconnected() {
     }
     usb_host_interface_release(this->handle_, this->device_handle_, channel->cdc_dev_.bulk_interface_number);
     channel->initialised_ = false;
-    channel->input_started_ = false;
-    channel->output_started_ = false;
+    channel->enabled_ = false;
+    channel->input_pending_ = 0;
+    channel->output_pending_ = 0;
     channel->input_buffer_.clear();
     channel->output_buffer_.clear();
   }
@@ -314,8 +314,9 @@ void USBUartTypeCdcAcm::enable_channels() {
   for (auto *channel : this->channels_) {
     if (!channel->initialised_)
       continue;
-    channel->input_started_ = false;
-    channel->output_started_ = false;
+    channel->enabled_ = true;
+    channel->input_pending_ = 0;
+    channel->output_pending_ = 0;
     this->start_input(channel);
   }
 }
@@ -43,6 +43,9 @@ enum UARTStopBitsOptions {
   UART_CONFIG_STOP_BITS_2,
 };
 
+/// Number of bulk transfers kept queued per direction, so the bus is not idle while a completed one is handled.
+static constexpr uint8_t USB_UART_TRANSFERS = 2;
+
 static const char *const PARITY_NAMES[] = {"NONE", "ODD", "EVEN", "MARK", "SPACE"};
 static const char *const STOP_BITS_NAMES[] = {"1", "1.5", "2"};
 
@@ -94,8 +97,9 @@ class USBUartChannel : public uart::UARTComponent, public Parented<USBUartCompon
   RingBuffer input_buffer_;
   RingBuffer output_buffer_;
   UARTParityOptions parity_{UART_CONFIG_PARITY_NONE};
-  bool input_started_{true};
-  bool output_started_{true};
+  bool enabled_{false};
+  uint8_t input_pending_{0};
+  uint8_t output_pending_{0};
   CdcEps cdc_dev_{};
   bool debug_{};
   bool dummy_receiver_{};
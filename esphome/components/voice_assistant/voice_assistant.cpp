@@ -25,8 +25,16 @@ static const size_t SEND_BUFFER_SAMPLES = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms *
 static const size_t SEND_BUFFER_SIZE = SEND_BUFFER_SAMPLES * sizeof(int16_t);
 static const size_t RECEIVE_SIZE = 1024;
 static const size_t SPEAKER_BUFFER_SIZE = 16 * RECEIVE_SIZE;
+// The response audio buffered before playing grows after every underrun and shrinks after responses without one
+static const size_t MIN_JITTER_BUFFER_SIZE = 4 * RECEIVE_SIZE;
+static const size_t MAX_JITTER_BUFFER_SIZE = SPEAKER_BUFFER_SIZE / 2;
 
-VoiceAssistant::VoiceAssistant() { global_voice_assistant = this; }
+VoiceAssistant::VoiceAssistant() {
+  global_voice_assistant = this;
+#ifdef USE_SPEAKER
+  this->jitter_buffer_target_ = MIN_JITTER_BUFFER_SIZE;
+#endif
+}
 
 void VoiceAssistant::setup() {
   this->mic_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
@@ -151,6 +159,8 @@ void VoiceAssistant::clear_buffers_() {
     this->speaker_buffer_size_ = 0;
     this->speaker_buffer_index_ = 0;
     this->speaker_bytes_received_ = 0;
+    this->jitter_buffering_ = true;
+    this->response_underruns_ = 0;
   }
 #endif
 }
@@ -314,20 +324,35 @@ void VoiceAssistant::loop() {
       if (this->speaker_ != nullptr) {
         ssize_t received_len = 0;
         if (this->audio_mode_ == AUDIO_MODE_UDP) {
-          if (this->speaker_buffer_index_ + RECEIVE_SIZE < SPEAKER_BUFFER_SIZE) {
+          if (this->speaker_buffer_index_ + RECEIVE_SIZE >= SPEAKER_BUFFER_SIZE) {
+            ESP_LOGD(TAG, "Receive buffer full");
+          }
+          // Drain every waiting datagram, so a burst after a stall doesn't overflow the socket's receive buffer
+          while (this->speaker_buffer_index_ + RECEIVE_SIZE < SPEAKER_BUFFER_SIZE) {
             received_len = this->socket_->read(this->speaker_buffer_ + this->speaker_buffer_index_, RECEIVE_SIZE);
-            if (received_len > 0) {
-              this->speaker_buffer_index_ += received_len;
-              this->speaker_buffer_size_ += received_len;
-              this->speaker_bytes_received_ += received_len;
+            if (received_len <= 0) {
+              break;
             }
-          } else {
-            ESP_LOGD(TAG, "Receive buffer full");
+            this->speaker_buffer_index_ += received_len;
+            this->speaker_buffer_size_ += received_len;
+            this->speaker_bytes_received_ += received_len;
           }
         }
-        // Build a small buffer of audio before sending to the speaker
         bool end_of_stream = this->stream_ended_ && (this->audio_mode_ == AUDIO_MODE_API || received_len < 0);
-        if (this->speaker_bytes_received_ > RECEIVE_SIZE * 4 || end_of_stream)
+        if (this->jitter_buffering_) {
+          // Build a buffer of audio before sending to the speaker
+          if ((this->speaker_buffer_size_ >= this->jitter_buffer_target_) || end_of_stream) {
+            this->jitter_buffering_ = false;
+          }
+        } else if ((this->speaker_buffer_size_ == 0) && !this->stream_ended_ &&
+                   !this->speaker_->has_buffered_data()) {
+          // The audio ran dry before the stream ended, so buffer more before resuming
+          ++this->response_underruns_;
+          this->jitter_buffer_target_ = std::min(2 * this->jitter_buffer_target_, MAX_JITTER_BUFFER_SIZE);
+          this->jitter_buffering_ = true;
+          ESP_LOGD(TAG, "Response audio ran dry, buffering %zu bytes before resuming", this->jitter_buffer_target_);
+        }
+        if (!this->jitter_buffering_)
           this->write_speaker_();
         if (this->wait_for_stream_end_) {
           this->cancel_timeout("playing");
@@ -374,6 +399,11 @@ void VoiceAssistant::loop() {
           break;
         }
         ESP_LOGD(TAG, "Speaker has finished outputting all audio");
+        ESP_LOGD(TAG, "Response stream: %zu bytes received, %" PRIu32 " underruns, %zu byte jitter buffer",
+                 this->speaker_bytes_received_, this->response_underruns_, this->jitter_buffer_target_);
+        if (this->response_underruns_ == 0) {
+          this->jitter_buffer_target_ = std::max(this->jitter_buffer_target_ - RECEIVE_SIZE, MIN_JITTER_BUFFER_SIZE);
+        }
         this->speaker_->stop();
         this->cancel_timeout("speaker-timeout");
         this->cancel_timeout("playing");
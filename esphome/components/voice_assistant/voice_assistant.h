@@ -119,6 +119,13 @@ class VoiceAssistant : public Component {
     this->speaker_ = speaker;
     this->local_output_ = true;
   }
+
+  /// Number of times the response audio ran dry while streaming, since the last response started.
+  uint32_t get_response_underruns() const { return this->response_underruns_; }
+  /// Bytes of response audio waiting to be sent to the speaker.
+  size_t get_jitter_buffer_depth() const { return this->speaker_buffer_size_; }
+  /// Bytes of response audio buffered before playback starts or resumes after an underrun.
+  size_t get_jitter_buffer_target() const { return this->jitter_buffer_target_; }
 #endif
 #ifdef USE_MEDIA_PLAYER
   void set_media_player(media_player::MediaPlayer *media_player) {
@@ -274,6 +281,9 @@ class VoiceAssistant : public Component {
   size_t speaker_buffer_index_{0};
   size_t speaker_buffer_size_{0};
   size_t speaker_bytes_received_{0};
+  size_t jitter_buffer_target_;
+  bool jitter_buffering_{true};
+  uint32_t response_underruns_{0};
   bool wait_for_stream_end_{false};
   bool stream_ended_{false};
 #endif
@@ -2,14 +2,35 @@
 
 #include "esphome/core/component.h"
 
+#include <cmath>
+
 namespace esphome {
 namespace voltage_sampler {
 
+/// Summary of all samples a VoltageSampler took over a period, in V.
+struct SampleStatistics {
+  uint32_t count{0};
+  /// Average of the samples, the DC part of the signal.
+  float mean{NAN};
+  /// RMS of the samples with the mean removed, the AC part of the signal.
+  float ac_rms{NAN};
+  float min{NAN};
+  float max{NAN};
+};
+
 /// Abstract interface for components to request voltage (usually ADC readings)
 class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Start collecting statistics over every sample the sampler takes in the background.
+   *
+   * @return false if the sampler cannot do that, the caller has to call sample() itself then.
+   */
+  virtual bool start_statistics() { return false; }
+  /// Stop collecting and get the statistics since start_statistics().
+  virtual bool stop_statistics(SampleStatistics &stats) { return false; }
 };
 
 }  // namespace voltage_sampler
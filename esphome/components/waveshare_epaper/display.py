@@ -14,6 +14,8 @@ from esphome.const import (
     CONF_RESET_PIN,
 )
 
+CONF_SKIP_UNCHANGED = "skip_unchanged"
+
 DEPENDENCIES = ["spi"]
 
 waveshare_epaper_ns = cg.esphome_ns.namespace("waveshare_epaper")
@@ -213,6 +215,7 @@ CONFIG_SCHEMA = cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(max=core.TimePeriod(milliseconds=500)),
             ),
+            cv.Optional(CONF_SKIP_UNCHANGED, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("1s"))
@@ -259,3 +262,5 @@ async def to_code(config):
         cg.add(var.set_full_update_every(config[CONF_FULL_UPDATE_EVERY]))
     if CONF_RESET_DURATION in config:
         cg.add(var.set_reset_duration(config[CONF_RESET_DURATION]))
+    if config[CONF_SKIP_UNCHANGED]:
+        cg.add(var.set_skip_unchanged(True))
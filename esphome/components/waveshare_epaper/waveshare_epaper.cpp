@@ -169,8 +169,48 @@ bool WaveshareEPaperBase::wait_until_idle_() {
 }
 void WaveshareEPaperBase::update() {
   this->do_update_();
+  if (this->display_pending_)
+    return;  // the poll below sends the new frame once the panel is ready
+  if (!this->is_panel_busy_()) {
+    this->display_if_changed_();
+    return;
+  }
+  this->display_pending_ = true;
+  this->busy_since_ = millis();
+  this->set_interval("busy", 10, [this]() {
+    if (this->is_panel_busy_()) {
+      if (millis() - this->busy_since_ <= this->idle_timeout_())
+        return;
+      ESP_LOGE(TAG, "Timeout while displaying image!");
+      this->status_set_warning();
+    }
+    this->cancel_interval("busy");
+    this->display_pending_ = false;
+    this->display_if_changed_();
+  });
+}
+void WaveshareEPaperBase::display_if_changed_() {
+  if (this->skip_unchanged_ && this->buffer_ != nullptr) {
+    uint32_t hash = this->hash_buffer_();
+    if (this->has_displayed_ && hash == this->displayed_hash_) {
+      ESP_LOGV(TAG, "Frame unchanged, skipping refresh");
+      return;
+    }
+    this->displayed_hash_ = hash;
+    this->has_displayed_ = true;
+  }
   this->display();
 }
+// FNV-1a over the whole frame, cheap next to sending it and much cheaper than a refresh.
+uint32_t WaveshareEPaperBase::hash_buffer_() {
+  uint32_t hash = 2166136261UL;
+  const uint32_t length = this->get_buffer_length_();
+  for (uint32_t i = 0; i != length; i++) {
+    hash ^= this->buffer_[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
 void WaveshareEPaper::fill(Color color) {
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
@@ -16,6 +16,7 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
   void set_busy_pin(GPIOPin *busy) { this->busy_pin_ = busy; }
   void set_reset_duration(uint32_t reset_duration) { this->reset_duration_ = reset_duration; }
+  void set_skip_unchanged(bool skip_unchanged) { this->skip_unchanged_ = skip_unchanged; }
 
   void command(uint8_t value);
   void data(uint8_t value);
@@ -33,6 +34,12 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
 
  protected:
   bool wait_until_idle_();
+  /// Whether the panel is still busy with the previous refresh and cannot take a new frame yet. Models that return
+  /// from display() while the refresh is running override this, so update() can wait for it without blocking.
+  virtual bool is_panel_busy_() { return false; }
+  /// Send the buffer to the panel, unless it is unchanged and skip_unchanged is set.
+  void display_if_changed_();
+  uint32_t hash_buffer_();
 
   void setup_pins_();
 
@@ -59,6 +66,13 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
   virtual uint32_t idle_timeout_() { return 1000u; }  // NOLINT(readability-identifier-naming)
+
+  bool skip_unchanged_{false};
+  bool has_displayed_{false};
+  uint32_t displayed_hash_{0};
+  /// A frame is waiting in the buffer for the panel to finish its previous refresh.
+  bool display_pending_{false};
+  uint32_t busy_since_{0};
 };
 
 class WaveshareEPaper : public WaveshareEPaperBase {
@@ -167,6 +181,10 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
   uint32_t at_update_{0};
   WaveshareEPaperTypeAModel model_;
   uint32_t idle_timeout_() override;
+  bool is_panel_busy_() override {
+    // The panel is reset before every update when it sleeps in between, so there is nothing to wait for.
+    return !this->deep_sleep_between_updates_ && this->busy_pin_ != nullptr && this->busy_pin_->digital_read();
+  }
 
   bool deep_sleep_between_updates_{false};
 };
@@ -1064,6 +1082,9 @@ class WaveshareEPaper2P13InV3 : public WaveshareEPaper {
   int get_width_internal() override;
   int get_height_internal() override;
   uint32_t idle_timeout_() override;
+  bool is_panel_busy_() override {
+    return this->is_busy_ || (this->busy_pin_ != nullptr && this->busy_pin_->digital_read());
+  }
 
   void write_buffer_(uint8_t cmd, int top, int bottom);
   void set_window_(int t, int b);
@@ -1,9 +1,12 @@
 from __future__ import annotations
 
 import gzip
+import hashlib
+from pathlib import Path
 
 import esphome.codegen as cg
-from esphome.components import web_server_base
+from esphome.components import logger, web_server_base
+from esphome.components.esp32 import add_idf_sdkconfig_option
 from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
 import esphome.config_validation as cv
 from esphome.const import (
@@ -17,6 +20,9 @@ from esphome.const import (
     CONF_JS_URL,
     CONF_LOCAL,
     CONF_LOG,
+    CONF_MAX_STATE_INTERVAL,
+    CONF_MIN_STATE_DELTA,
+    CONF_MIN_STATE_INTERVAL,
     CONF_NAME,
     CONF_OTA,
     CONF_PASSWORD,
@@ -37,9 +43,12 @@ from esphome.types import ConfigType
 
 AUTO_LOAD = ["json", "web_server_base"]
 
+CONF_MAX_CONNECTIONS = "max_connections"
+CONF_PURGE_IDLE_CONNECTIONS = "purge_idle_connections"
 CONF_SORTING_GROUP_ID = "sorting_group_id"
 CONF_SORTING_GROUPS = "sorting_groups"
 CONF_SORTING_WEIGHT = "sorting_weight"
+CONF_WEBSOCKET = "websocket"
 
 
 web_server_ns = cg.esphome_ns.namespace("web_server")
@@ -189,7 +198,17 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_OTA): cv.boolean,
             cv.Optional(CONF_LOG, default=True): cv.boolean,
             cv.Optional(CONF_LOCAL): cv.boolean,
+            cv.Optional(CONF_MIN_STATE_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MIN_STATE_DELTA): cv.positive_float,
+            cv.Optional(CONF_MAX_STATE_INTERVAL): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_SORTING_GROUPS): cv.ensure_list(sorting_group),
+            cv.Optional(CONF_MAX_CONNECTIONS): cv.All(
+                cv.only_with_esp_idf, cv.int_range(min=1, max=32)
+            ),
+            cv.Optional(CONF_PURGE_IDLE_CONNECTIONS): cv.All(
+                cv.only_with_esp_idf, cv.boolean
+            ),
+            cv.Optional(CONF_WEBSOCKET): cv.All(cv.only_with_esp_idf, cv.boolean),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on(
@@ -205,6 +224,7 @@ CONFIG_SCHEMA = cv.All(
     validate_local,
     validate_sorting_groups,
     validate_ota,
+    logger.request_log_listener,
 )
 
 
@@ -252,6 +272,16 @@ def build_index_html(config) -> str:
     return html
 
 
+def add_resource_etag(resource_name: str, content: bytes) -> None:
+    """Add a strong ETag for a resource, derived from its content."""
+    etag = hashlib.sha256(content).hexdigest()[:16]
+    cg.add_global(
+        cg.RawExpression(
+            f'const char ESPHOME_WEBSERVER_{resource_name}_ETAG[] = "\\"{etag}\\""'
+        )
+    )
+
+
 def add_resource_as_progmem(
     resource_name: str, content: str, compress: bool = True
 ) -> None:
@@ -267,6 +297,7 @@ def add_resource_as_progmem(
     )
     cg.add_global(cg.RawExpression(uint8_t))
     cg.add_global(cg.RawExpression(size_t))
+    add_resource_etag(resource_name, content_encoded)
 
 
 @coroutine_with_priority(CoroPriority.WEB)
@@ -312,8 +343,27 @@ async def to_code(config):
         with open(file=path, encoding="utf-8") as js_file:
             add_resource_as_progmem("JS_INCLUDE", js_file.read())
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if (max_connections := config.get(CONF_MAX_CONNECTIONS)) is not None:
+        cg.add_define("USE_WEBSERVER_MAX_CONNECTIONS", max_connections)
+        # esp_http_server keeps three sockets for itself, leave room for API and OTA
+        add_idf_sdkconfig_option("CONFIG_LWIP_MAX_SOCKETS", max_connections + 9)
+    if config.get(CONF_PURGE_IDLE_CONNECTIONS):
+        cg.add_define("USE_WEBSERVER_LRU_PURGE")
+    if config.get(CONF_WEBSOCKET):
+        cg.add_define("USE_WEBSERVER_WEBSOCKET")
+        add_idf_sdkconfig_option("CONFIG_HTTPD_WS_SUPPORT", True)
+    if CONF_MIN_STATE_INTERVAL in config:
+        cg.add(var.set_min_state_interval(config[CONF_MIN_STATE_INTERVAL]))
+    if CONF_MIN_STATE_DELTA in config:
+        cg.add(
+            var.set_min_state_delta(
+                config[CONF_MIN_STATE_DELTA], config.get(CONF_MAX_STATE_INTERVAL, 0)
+            )
+        )
     if CONF_LOCAL in config and config[CONF_LOCAL]:
         cg.add_define("USE_WEBSERVER_LOCAL")
+        index = Path(__file__).parent / f"server_index_v{version}.h"
+        add_resource_etag("INDEX_GZ", index.read_bytes())
 
     if (sorting_group_config := config.get(CONF_SORTING_GROUPS)) is not None:
         cg.add_define("USE_WEBSERVER_SORTING")
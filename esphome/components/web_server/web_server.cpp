@@ -26,6 +26,10 @@
 #include "esphome/components/climate/climate.h"
 #endif
 
+#ifdef USE_HISTORY
+#include "esphome/components/history/history.h"
+#endif
+
 #ifdef USE_WEBSERVER_LOCAL
 #if USE_WEBSERVER_VERSION == 2
 #include "server_index_v2.h"
@@ -44,6 +48,10 @@ static const char *const HEADER_PNA_NAME = "Private-Network-Access-Name";
 static const char *const HEADER_PNA_ID = "Private-Network-Access-ID";
 static const char *const HEADER_CORS_REQ_PNA = "Access-Control-Request-Private-Network";
 static const char *const HEADER_CORS_ALLOW_PNA = "Access-Control-Allow-Private-Network";
+#ifdef USE_HISTORY
+/// Limit of buckets in one history response, which is built in memory.
+static const uint32_t MAX_HISTORY_BUCKETS = 500;
+#endif
 #endif
 
 // Parse URL and return match info
@@ -87,12 +95,14 @@ static UrlMatch match_url(const char *url_ptr, size_t url_len, bool only_domain)
     // No more slashes, entire remaining string is ID
     match.id = id_start;
     match.id_len = end - id_start;
+    match.id_hash = fnv1_hash(match.id, match.id_len);
     return match;
   }
 
   // Set ID
   match.id = id_start;
   match.id_len = id_end - id_start;
+  match.id_hash = fnv1_hash(match.id, match.id_len);
 
   // Parse method if present
   if (id_end + 1 < end) {
@@ -105,24 +115,41 @@ static UrlMatch match_url(const char *url_ptr, size_t url_len, bool only_domain)
 
 #ifdef USE_ARDUINO
 // helper for allowing only unique entries in the queue
-void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator) {
-  DeferredEvent item(source, message_generator);
+void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator,
+                                                          std::shared_ptr<const std::string> message) {
+  DeferredEvent item(source, message_generator, std::move(message));
+  size_t message_bytes = item.message_ ? item.message_->size() : 0;
 
   auto iter = std::find_if(this->deferred_queue_.begin(), this->deferred_queue_.end(),
                            [&item](const DeferredEvent &test) -> bool { return test == item; });
 
   if (iter != this->deferred_queue_.end()) {
-    (*iter) = item;
+    this->deferred_queue_bytes_ -= iter->message_ ? iter->message_->size() : 0;
+    (*iter) = std::move(item);
   } else {
-    this->deferred_queue_.push_back(item);
+    this->deferred_queue_.push_back(std::move(item));
+  }
+  this->deferred_queue_bytes_ += message_bytes;
+
+  if (this->deferred_queue_bytes_ > MAX_DEFERRED_QUEUE_BYTES) {
+    this->drop_();
   }
 }
 
+void DeferredUpdateEventSource::drop_() {
+  ESP_LOGW(TAG, "Closing EventSource connection that fell behind (%zu bytes queued)", this->deferred_queue_bytes_);
+  this->close();
+  this->deferred_queue_.clear();
+  this->deferred_queue_bytes_ = 0;
+}
+
 void DeferredUpdateEventSource::process_deferred_queue_() {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
-    if (this->send(message.c_str(), "state") != DISCARDED) {
+    const char *message =
+        de.message_ ? de.message_->c_str() : this->generate_message_(de.source_, de.message_generator_);
+    if (this->send(message, "state") != DISCARDED) {
+      this->deferred_queue_bytes_ -= de.message_ ? de.message_->size() : 0;
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
       this->consecutive_send_failures_ = 0;  // Reset failure count on successful send
@@ -134,25 +161,34 @@ void DeferredUpdateEventSource::process_deferred_queue_() {
                  this->consecutive_send_failures_);
         this->close();
         this->deferred_queue_.clear();
+        this->deferred_queue_bytes_ = 0;
       }
       break;
     }
   }
 }
 
+const char *DeferredUpdateEventSource::generate_message_(void *source, message_generator_t *message_generator) {
+  this->message_buffer_.clear();
+  json::JsonWriter writer(this->message_buffer_);
+  message_generator(this->web_server_, source, writer);
+  return this->message_buffer_.c_str();
+}
+
 void DeferredUpdateEventSource::loop() {
   process_deferred_queue_();
   if (!this->entities_iterator_.completed())
     this->entities_iterator_.advance();
 }
 
-void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
-                                                      message_generator_t *message_generator) {
+bool DeferredUpdateEventSource::accepts_state_(const char *event_type) const {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
-  if (!entities_iterator_.completed() && 0 != strcmp(event_type, "state_detail_all"))
-    return;
+  return this->entities_iterator_.completed() || 0 == strcmp(event_type, "state_detail_all");
+}
 
+void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
+                                                      message_generator_t *message_generator) {
   if (source == nullptr)
     return;
   if (event_type == nullptr)
@@ -160,19 +196,27 @@ void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *
   if (message_generator == nullptr)
     return;
 
+  if (!this->accepts_state_(event_type))
+    return;
+
   if (0 != strcmp(event_type, "state_detail_all") && 0 != strcmp(event_type, "state")) {
     ESP_LOGE(TAG, "Can't defer non-state event");
   }
 
+  this->send_or_defer_state_(source, message_generator, nullptr);
+}
+
+void DeferredUpdateEventSource::send_or_defer_state_(void *source, message_generator_t *message_generator,
+                                                     const std::shared_ptr<const std::string> &message) {
   if (!deferred_queue_.empty())
     process_deferred_queue_();
   if (!deferred_queue_.empty()) {
     // deferred queue still not empty which means downstream event queue full, no point trying to send first
-    deq_push_back_with_dedup_(source, message_generator);
+    deq_push_back_with_dedup_(source, message_generator, message);
   } else {
-    std::string message = message_generator(web_server_, source);
-    if (this->send(message.c_str(), "state") == DISCARDED) {
-      deq_push_back_with_dedup_(source, message_generator);
+    const char *data = message ? message->c_str() : this->generate_message_(source, message_generator);
+    if (this->send(data, "state") == DISCARDED) {
+      deq_push_back_with_dedup_(source, message_generator, message);
     } else {
       this->consecutive_send_failures_ = 0;  // Reset failure count on successful send
     }
@@ -193,11 +237,40 @@ void DeferredUpdateEventSourceList::loop() {
 
 void DeferredUpdateEventSourceList::deferrable_send_state(void *source, const char *event_type,
                                                           message_generator_t *message_generator) {
+  // A single event source writes the event into its own buffer. The "state_detail_all" events of the initial entity
+  // listing are generated per event source too, so only live state updates are held in the deferred queues.
+  if (this->size() == 1 || event_type == nullptr || 0 != strcmp(event_type, "state")) {
+    for (DeferredUpdateEventSource *dues : *this) {
+      dues->deferrable_send_state(source, event_type, message_generator);
+    }
+    return;
+  }
+
+  if (source == nullptr || message_generator == nullptr)
+    return;
+
+  // Encode the event once on first use and hand the same message to every event source
+  std::shared_ptr<const std::string> message;
   for (DeferredUpdateEventSource *dues : *this) {
-    dues->deferrable_send_state(source, event_type, message_generator);
+    if (!dues->accepts_state_(event_type))
+      continue;
+    if (!message)
+      message = this->encode_shared_message_(dues->web_server_, source, message_generator);
+    dues->send_or_defer_state_(source, message_generator, message);
   }
 }
 
+const std::shared_ptr<std::string> &DeferredUpdateEventSourceList::encode_shared_message_(
+    WebServer *ws, void *source, message_generator_t *message_generator) {
+  // Event sources that could not send the last message still reference it, otherwise the buffer keeps its capacity
+  if (this->shared_message_.use_count() != 1)
+    this->shared_message_ = std::make_shared<std::string>();
+  this->shared_message_->clear();
+  json::JsonWriter writer(*this->shared_message_);
+  message_generator(ws, source, writer);
+  return this->shared_message_;
+}
+
 void DeferredUpdateEventSourceList::try_send_nodefer(const char *message, const char *event, uint32_t id,
                                                      uint32_t reconnect) {
   for (DeferredUpdateEventSource *dues : *this) {
@@ -284,24 +357,25 @@ std::string WebServer::get_config_json() {
 
 void WebServer::setup() {
   this->setup_controller(this->include_internal_);
+  // Added before the server starts, so it registers the websocket URL of the event source with the others
+#ifdef USE_ESP_IDF
+  this->base_->add_handler(&this->events_);
+#endif
+  this->base_->add_handler(this);
   this->base_->init();
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr && this->expose_log_) {
-    logger::global_logger->add_on_log_callback(
+    logger::global_logger->add_log_listener(
         // logs are not deferred, the memory overhead would be too large
-        [this](int level, const char *tag, const char *message, size_t message_len) {
+        [](void *context, uint8_t level, const char *tag, const char *message, size_t message_len) {
           (void) message_len;
-          this->events_.try_send_nodefer(message, "log", millis());
-        });
+          static_cast<WebServer *>(context)->events_.try_send_nodefer(message, "log", millis());
+        },
+        this);
   }
 #endif
 
-#ifdef USE_ESP_IDF
-  this->base_->add_handler(&this->events_);
-#endif
-  this->base_->add_handler(this);
-
   // OTA is now handled by the web_server OTA platform
 
   // doesn't need defer functionality - if the queue is full, the client JS knows it's alive because it's clearly
@@ -317,18 +391,49 @@ void WebServer::dump_config() {
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
+#if defined(USE_WEBSERVER_LOCAL) || USE_WEBSERVER_VERSION >= 2 || defined(USE_WEBSERVER_CSS_INCLUDE) || \
+    defined(USE_WEBSERVER_JS_INCLUDE)
+/// Answers with 304 when the client already has this build of a static file, so reloading the UI costs one round
+/// trip instead of the whole file.
+static bool send_not_modified(AsyncWebServerRequest *request, const char *etag) {
+#ifdef USE_ESP_IDF
+  auto if_none_match = request->get_header("If-None-Match");
+  if (!if_none_match.has_value() || *if_none_match != etag)
+    return false;
+#else
+  if (!request->hasHeader("If-None-Match") || request->getHeader("If-None-Match")->value() != etag)
+    return false;
+#endif
+  AsyncWebServerResponse *response = request->beginResponse(304, "");
+  response->addHeader("ETag", etag);
+  request->send(response);
+  return true;
+}
+
+static void add_cache_headers(AsyncWebServerResponse *response, const char *etag) {
+  response->addHeader("ETag", etag);
+  // The files keep their URL across firmware updates, so browsers have to revalidate instead of caching forever
+  response->addHeader("Cache-Control", "no-cache");
+}
+#endif
+
 #ifdef USE_WEBSERVER_LOCAL
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  if (send_not_modified(request, ESPHOME_WEBSERVER_INDEX_GZ_ETAG))
+    return;
 #ifndef USE_ESP8266
   AsyncWebServerResponse *response = request->beginResponse(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
 #else
   AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
 #endif
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, ESPHOME_WEBSERVER_INDEX_GZ_ETAG);
   request->send(response);
 }
 #elif USE_WEBSERVER_VERSION >= 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  if (send_not_modified(request, ESPHOME_WEBSERVER_INDEX_HTML_ETAG))
+    return;
 #ifndef USE_ESP8266
   AsyncWebServerResponse *response =
       request->beginResponse(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
@@ -337,6 +442,7 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
       request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
 #endif
   // No gzip header here because the HTML file is so small
+  add_cache_headers(response, ESPHOME_WEBSERVER_INDEX_HTML_ETAG);
   request->send(response);
 }
 #endif
@@ -354,6 +460,8 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
+  if (send_not_modified(request, ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG))
+    return;
 #ifndef USE_ESP8266
   AsyncWebServerResponse *response =
       request->beginResponse(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
@@ -362,12 +470,15 @@ void WebServer::handle_css_request(AsyncWebServerRequest *request) {
       request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
 #endif
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG);
   request->send(response);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
+  if (send_not_modified(request, ESPHOME_WEBSERVER_JS_INCLUDE_ETAG))
+    return;
 #ifndef USE_ESP8266
   AsyncWebServerResponse *response =
       request->beginResponse(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
@@ -376,6 +487,7 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
       request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
 #endif
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, ESPHOME_WEBSERVER_JS_INCLUDE_ETAG);
   request->send(response);
 }
 #endif
@@ -413,6 +525,38 @@ static JsonDetail get_request_detail(AsyncWebServerRequest *request) {
   return (param && param->value() == "all") ? DETAIL_ALL : DETAIL_STATE;
 }
 
+// Streaming counterparts of the helpers above, used by the state event generators
+void WebServer::write_json_id_(json::JsonWriter &writer, EntityBase *obj, const char *prefix) {
+  writer.begin_string("id");
+  writer.string_part(prefix);
+  StringRef object_id = obj->get_object_id_ref();
+  writer.string_part(object_id.c_str(), object_id.size());
+  writer.end_string();
+}
+
+#if defined(USE_SENSOR) || defined(USE_NUMBER)
+// "<value with accuracy_decimals>[ <uom>]" as a string
+static void write_json_accuracy_value(json::JsonWriter &writer, const char *key, float value,
+                                      int8_t accuracy_decimals, const StringRef &uom) {
+  char buf[32];
+  size_t len = value_accuracy_to_buf(buf, sizeof(buf), value, accuracy_decimals);
+  writer.begin_string(key);
+  writer.string_part(buf, len);
+  if (!uom.empty()) {
+    writer.string_part(" ", 1);
+    writer.string_part(uom.c_str(), uom.size());
+  }
+  writer.end_string();
+}
+#endif
+
+#if defined(USE_SWITCH) || defined(USE_BINARY_SENSOR)
+static void write_json_on_off_state(json::JsonWriter &writer, bool value) {
+  writer.add("value", value);
+  writer.add("state", value ? "ON" : "OFF");
+}
+#endif
+
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (this->events_.empty())
@@ -421,7 +565,7 @@ void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (sensor::Sensor *obj : App.get_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -429,14 +573,74 @@ void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlM
       request->send(200, "application/json", data.c_str());
       return;
     }
+#ifdef USE_HISTORY
+    if (request->method() == HTTP_GET && match.method_equals("history")) {
+      this->handle_sensor_history_request_(request, obj);
+      return;
+    }
+#endif
   }
   request->send(404);
 }
-std::string WebServer::sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_STATE);
+#ifdef USE_HISTORY
+void WebServer::handle_sensor_history_request_(AsyncWebServerRequest *request, sensor::Sensor *obj) {
+  history::SensorHistory *history = nullptr;
+  for (auto *h : history::SensorHistory::get_histories()) {
+    if (h->get_sensor() == obj)
+      history = h;
+  }
+  if (history == nullptr) {
+    request->send(404);
+    return;
+  }
+  // Both in seconds, the default is the last hour by the minute
+  uint32_t duration = 3600;
+  uint32_t resolution = 60;
+  if (request->hasParam("duration"))
+    duration = parse_number<uint32_t>(request->getParam("duration")->value().c_str()).value_or(0);
+  if (request->hasParam("resolution"))
+    resolution = parse_number<uint32_t>(request->getParam("resolution")->value().c_str()).value_or(0);
+  if (resolution == 0 || duration == 0 || duration > UINT32_MAX / 1000 ||
+      duration / resolution > MAX_HISTORY_BUCKETS) {
+    request->send(400);
+    return;
+  }
+
+  std::string data;
+  json::JsonWriter writer(data);
+  writer.begin_object();
+  write_json_id_(writer, obj, "sensor-");
+  writer.add("resolution", resolution);
+  writer.begin_array("buckets");
+  history->for_each_bucket(duration * 1000, resolution * 1000, [&writer](const history::HistoryBucket &bucket) {
+    writer.begin_object();
+    writer.add("min", bucket.min);
+    writer.add("max", bucket.max);
+    writer.add("avg", bucket.avg);
+    writer.add("count", bucket.count);
+    writer.end_object();
+  });
+  writer.end_array();
+  writer.end_object();
+  request->send(200, "application/json", data.c_str());
+}
+#endif
+void WebServer::sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (sensor::Sensor *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "sensor-");
+  writer.add("value", obj->state);
+  if (std::isnan(obj->state)) {
+    writer.add("state", "NA");
+  } else {
+    write_json_accuracy_value(writer, "state", obj->state, obj->get_accuracy_decimals(),
+                              obj->get_unit_of_measurement_ref());
+  }
+  writer.end_object();
 }
-std::string WebServer::sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
+void WebServer::sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (sensor::Sensor *) (source);
+  writer.add_raw(nullptr, web_server->sensor_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -470,7 +674,7 @@ void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -481,13 +685,17 @@ void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const
   }
   request->send(404);
 }
-std::string WebServer::text_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
-                                      ((text_sensor::TextSensor *) (source))->state, DETAIL_STATE);
+void WebServer::text_sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (text_sensor::TextSensor *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "text_sensor-");
+  writer.add("value", obj->state);
+  writer.add("state", obj->state);
+  writer.end_object();
 }
-std::string WebServer::text_sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
-                                      ((text_sensor::TextSensor *) (source))->state, DETAIL_ALL);
+void WebServer::text_sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (text_sensor::TextSensor *) (source);
+  writer.add_raw(nullptr, web_server->text_sensor_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
@@ -511,7 +719,7 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (switch_::Switch *obj : App.get_switches()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -557,11 +765,16 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::switch_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_STATE);
+void WebServer::switch_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (switch_::Switch *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "switch-");
+  write_json_on_off_state(writer, obj->state);
+  writer.end_object();
 }
-std::string WebServer::switch_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
+void WebServer::switch_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (switch_::Switch *) (source);
+  writer.add_raw(nullptr, web_server->switch_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -580,7 +793,7 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (button::Button *obj : App.get_buttons()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -597,11 +810,11 @@ void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::button_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->button_json((button::Button *) (source), DETAIL_STATE);
+void WebServer::button_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->button_json((button::Button *) (source), DETAIL_STATE));
 }
-std::string WebServer::button_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->button_json((button::Button *) (source), DETAIL_ALL);
+void WebServer::button_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->button_json((button::Button *) (source), DETAIL_ALL));
 }
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -624,7 +837,7 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj) {
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -635,13 +848,16 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
   }
   request->send(404);
 }
-std::string WebServer::binary_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
-                                        ((binary_sensor::BinarySensor *) (source))->state, DETAIL_STATE);
+void WebServer::binary_sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (binary_sensor::BinarySensor *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "binary_sensor-");
+  write_json_on_off_state(writer, obj->state);
+  writer.end_object();
 }
-std::string WebServer::binary_sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
-                                        ((binary_sensor::BinarySensor *) (source))->state, DETAIL_ALL);
+void WebServer::binary_sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (binary_sensor::BinarySensor *) (source);
+  writer.add_raw(nullptr, web_server->binary_sensor_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -665,7 +881,7 @@ void WebServer::on_fan_update(fan::Fan *obj) {
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (fan::Fan *obj : App.get_fans()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -707,11 +923,11 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
   }
   request->send(404);
 }
-std::string WebServer::fan_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->fan_json((fan::Fan *) (source), DETAIL_STATE);
+void WebServer::fan_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->fan_json((fan::Fan *) (source), DETAIL_STATE));
 }
-std::string WebServer::fan_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->fan_json((fan::Fan *) (source), DETAIL_ALL);
+void WebServer::fan_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->fan_json((fan::Fan *) (source), DETAIL_ALL));
 }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -742,7 +958,7 @@ void WebServer::on_light_update(light::LightState *obj) {
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (light::LightState *obj : App.get_lights()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -783,11 +999,11 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::light_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->light_json((light::LightState *) (source), DETAIL_STATE);
+void WebServer::light_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->light_json((light::LightState *) (source), DETAIL_STATE));
 }
-std::string WebServer::light_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->light_json((light::LightState *) (source), DETAIL_ALL);
+void WebServer::light_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->light_json((light::LightState *) (source), DETAIL_ALL));
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -818,7 +1034,7 @@ void WebServer::on_cover_update(cover::Cover *obj) {
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (cover::Cover *obj : App.get_covers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -858,11 +1074,11 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::cover_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->cover_json((cover::Cover *) (source), DETAIL_STATE);
+void WebServer::cover_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->cover_json((cover::Cover *) (source), DETAIL_STATE));
 }
-std::string WebServer::cover_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->cover_json((cover::Cover *) (source), DETAIL_ALL);
+void WebServer::cover_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->cover_json((cover::Cover *) (source), DETAIL_ALL));
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -892,7 +1108,7 @@ void WebServer::on_number_update(number::Number *obj, float state) {
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_numbers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -916,11 +1132,23 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 
-std::string WebServer::number_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_STATE);
+void WebServer::number_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (number::Number *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "number-");
+  if (std::isnan(obj->state)) {
+    writer.add("value", "\"NaN\"");
+    writer.add("state", "NA");
+  } else {
+    int8_t accuracy = step_to_accuracy_decimals(obj->traits.get_step());
+    write_json_accuracy_value(writer, "value", obj->state, accuracy, StringRef());
+    write_json_accuracy_value(writer, "state", obj->state, accuracy, obj->traits.get_unit_of_measurement_ref());
+  }
+  writer.end_object();
 }
-std::string WebServer::number_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_ALL);
+void WebServer::number_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (number::Number *) (source);
+  writer.add_raw(nullptr, web_server->number_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -961,7 +1189,7 @@ void WebServer::on_date_update(datetime::DateEntity *obj) {
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_dates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -990,11 +1218,11 @@ void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::date_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->date_json((datetime::DateEntity *) (source), DETAIL_STATE);
+void WebServer::date_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->date_json((datetime::DateEntity *) (source), DETAIL_STATE));
 }
-std::string WebServer::date_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->date_json((datetime::DateEntity *) (source), DETAIL_ALL);
+void WebServer::date_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->date_json((datetime::DateEntity *) (source), DETAIL_ALL));
 }
 std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1020,7 +1248,7 @@ void WebServer::on_time_update(datetime::TimeEntity *obj) {
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_times()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1048,11 +1276,11 @@ void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::time_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_STATE);
+void WebServer::time_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->time_json((datetime::TimeEntity *) (source), DETAIL_STATE));
 }
-std::string WebServer::time_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_ALL);
+void WebServer::time_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->time_json((datetime::TimeEntity *) (source), DETAIL_ALL));
 }
 std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1078,7 +1306,7 @@ void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_datetimes()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1106,11 +1334,11 @@ void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const Ur
   }
   request->send(404);
 }
-std::string WebServer::datetime_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_STATE);
+void WebServer::datetime_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_STATE));
 }
-std::string WebServer::datetime_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_ALL);
+void WebServer::datetime_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_ALL));
 }
 std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1137,7 +1365,7 @@ void WebServer::on_text_update(text::Text *obj, const std::string &state) {
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_texts()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1161,11 +1389,13 @@ void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::text_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_STATE);
+void WebServer::text_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (text::Text *) (source);
+  writer.add_raw(nullptr, web_server->text_json(obj, obj->state, DETAIL_STATE));
 }
-std::string WebServer::text_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_ALL);
+void WebServer::text_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (text::Text *) (source);
+  writer.add_raw(nullptr, web_server->text_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1198,7 +1428,7 @@ void WebServer::on_select_update(select::Select *obj, const std::string &state,
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_selects()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1222,11 +1452,17 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::select_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_STATE);
+void WebServer::select_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (select::Select *) (source);
+  writer.begin_object();
+  write_json_id_(writer, obj, "select-");
+  writer.add("value", obj->state);
+  writer.add("state", obj->state);
+  writer.end_object();
 }
-std::string WebServer::select_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_ALL);
+void WebServer::select_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (select::Select *) (source);
+  writer.add_raw(nullptr, web_server->select_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1256,7 +1492,7 @@ void WebServer::on_climate_update(climate::Climate *obj) {
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_climates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1289,13 +1525,13 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
   }
   request->send(404);
 }
-std::string WebServer::climate_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::climate_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->climate_json((climate::Climate *) (source), DETAIL_STATE);
+  writer.add_raw(nullptr, web_server->climate_json((climate::Climate *) (source), DETAIL_STATE));
 }
-std::string WebServer::climate_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::climate_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->climate_json((climate::Climate *) (source), DETAIL_ALL);
+  writer.add_raw(nullptr, web_server->climate_json((climate::Climate *) (source), DETAIL_ALL));
 }
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
@@ -1398,7 +1634,7 @@ void WebServer::on_lock_update(lock::Lock *obj) {
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (lock::Lock *obj : App.get_locks()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1444,11 +1680,13 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::lock_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_STATE);
+void WebServer::lock_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (lock::Lock *) (source);
+  writer.add_raw(nullptr, web_server->lock_json(obj, obj->state, DETAIL_STATE));
 }
-std::string WebServer::lock_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_ALL);
+void WebServer::lock_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  auto *obj = (lock::Lock *) (source);
+  writer.add_raw(nullptr, web_server->lock_json(obj, obj->state, DETAIL_ALL));
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1472,7 +1710,7 @@ void WebServer::on_valve_update(valve::Valve *obj) {
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (valve::Valve *obj : App.get_valves()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1510,11 +1748,11 @@ void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::valve_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->valve_json((valve::Valve *) (source), DETAIL_STATE);
+void WebServer::valve_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->valve_json((valve::Valve *) (source), DETAIL_STATE));
 }
-std::string WebServer::valve_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->valve_json((valve::Valve *) (source), DETAIL_ALL);
+void WebServer::valve_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
+  writer.add_raw(nullptr, web_server->valve_json((valve::Valve *) (source), DETAIL_ALL));
 }
 std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1542,7 +1780,7 @@ void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlP
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1576,15 +1814,15 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
   }
   request->send(404);
 }
-std::string WebServer::alarm_control_panel_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
-                                              ((alarm_control_panel::AlarmControlPanel *) (source))->get_state(),
-                                              DETAIL_STATE);
+void WebServer::alarm_control_panel_state_json_generator(WebServer *web_server, void *source,
+                                                         json::JsonWriter &writer) {
+  auto *obj = (alarm_control_panel::AlarmControlPanel *) (source);
+  writer.add_raw(nullptr, web_server->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE));
 }
-std::string WebServer::alarm_control_panel_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
-                                              ((alarm_control_panel::AlarmControlPanel *) (source))->get_state(),
-                                              DETAIL_ALL);
+void WebServer::alarm_control_panel_all_json_generator(WebServer *web_server, void *source,
+                                                       json::JsonWriter &writer) {
+  auto *obj = (alarm_control_panel::AlarmControlPanel *) (source);
+  writer.add_raw(nullptr, web_server->alarm_control_panel_json(obj, obj->get_state(), DETAIL_ALL));
 }
 std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                                 alarm_control_panel::AlarmControlPanelState value,
@@ -1610,7 +1848,7 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
 
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (event::Event *obj : App.get_events()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1627,13 +1865,13 @@ static std::string get_event_type(event::Event *event) {
   return (event && event->last_event_type) ? *event->last_event_type : "";
 }
 
-std::string WebServer::event_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::event_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   auto *event = static_cast<event::Event *>(source);
-  return web_server->event_json(event, get_event_type(event), DETAIL_STATE);
+  writer.add_raw(nullptr, web_server->event_json(event, get_event_type(event), DETAIL_STATE));
 }
-std::string WebServer::event_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::event_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   auto *event = static_cast<event::Event *>(source);
-  return web_server->event_json(event, get_event_type(event), DETAIL_ALL);
+  writer.add_raw(nullptr, web_server->event_json(event, get_event_type(event), DETAIL_ALL));
 }
 std::string WebServer::event_json(event::Event *obj, const std::string &event_type, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1677,7 +1915,7 @@ void WebServer::on_update(update::UpdateEntity *obj) {
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (update::UpdateEntity *obj : App.get_updates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1698,13 +1936,13 @@ void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::update_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::update_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
+  writer.add_raw(nullptr, web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE));
 }
-std::string WebServer::update_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::update_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
+  writer.add_raw(nullptr, web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE));
 }
 std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_config) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
@@ -1735,6 +1973,9 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) const {
   if (url == "/")
     return true;
 
+  if (url == "/states" && method == HTTP_GET)
+    return true;
+
 #ifdef USE_ARDUINO
   if (url == "/events")
     return true;
@@ -1867,6 +2108,11 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
     return;
   }
 
+  if (url == "/states") {
+    this->handle_states_request(request);
+    return;
+  }
+
 #ifdef USE_ARDUINO
   if (url == "/events") {
     this->events_.add_new_client(this, request);
@@ -1979,6 +2225,80 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
 
 bool WebServer::isRequestHandlerTrivial() const { return false; }
 
+template<typename T>
+void WebServer::write_states_(json::JsonWriter &writer, const T &entities, message_generator_t *generator) {
+  for (auto *obj : entities) {
+    if (this->include_internal_ || !obj->is_internal())
+      generator(this, obj, writer);
+  }
+}
+
+void WebServer::handle_states_request(AsyncWebServerRequest *request) {
+  // Same objects as the state events, buttons are left out as they have no state
+  std::string data;
+  json::JsonWriter writer(data);
+  writer.begin_array();
+#ifdef USE_SENSOR
+  this->write_states_(writer, App.get_sensors(), sensor_state_json_generator);
+#endif
+#ifdef USE_BINARY_SENSOR
+  this->write_states_(writer, App.get_binary_sensors(), binary_sensor_state_json_generator);
+#endif
+#ifdef USE_TEXT_SENSOR
+  this->write_states_(writer, App.get_text_sensors(), text_sensor_state_json_generator);
+#endif
+#ifdef USE_SWITCH
+  this->write_states_(writer, App.get_switches(), switch_state_json_generator);
+#endif
+#ifdef USE_FAN
+  this->write_states_(writer, App.get_fans(), fan_state_json_generator);
+#endif
+#ifdef USE_LIGHT
+  this->write_states_(writer, App.get_lights(), light_state_json_generator);
+#endif
+#ifdef USE_COVER
+  this->write_states_(writer, App.get_covers(), cover_state_json_generator);
+#endif
+#ifdef USE_NUMBER
+  this->write_states_(writer, App.get_numbers(), number_state_json_generator);
+#endif
+#ifdef USE_DATETIME_DATE
+  this->write_states_(writer, App.get_dates(), date_state_json_generator);
+#endif
+#ifdef USE_DATETIME_TIME
+  this->write_states_(writer, App.get_times(), time_state_json_generator);
+#endif
+#ifdef USE_DATETIME_DATETIME
+  this->write_states_(writer, App.get_datetimes(), datetime_state_json_generator);
+#endif
+#ifdef USE_TEXT
+  this->write_states_(writer, App.get_texts(), text_state_json_generator);
+#endif
+#ifdef USE_SELECT
+  this->write_states_(writer, App.get_selects(), select_state_json_generator);
+#endif
+#ifdef USE_CLIMATE
+  this->write_states_(writer, App.get_climates(), climate_state_json_generator);
+#endif
+#ifdef USE_LOCK
+  this->write_states_(writer, App.get_locks(), lock_state_json_generator);
+#endif
+#ifdef USE_VALVE
+  this->write_states_(writer, App.get_valves(), valve_state_json_generator);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  this->write_states_(writer, App.get_alarm_control_panels(), alarm_control_panel_state_json_generator);
+#endif
+#ifdef USE_EVENT
+  this->write_states_(writer, App.get_events(), event_state_json_generator);
+#endif
+#ifdef USE_UPDATE
+  this->write_states_(writer, App.get_updates(), update_state_json_generator);
+#endif
+  writer.end_array();
+  request->send(200, "application/json", data.c_str());
+}
+
 void WebServer::add_sorting_info_(JsonObject &root, EntityBase *entity) {
 #ifdef USE_WEBSERVER_SORTING
   if (this->sorting_entitys_.find(entity) != this->sorting_entitys_.end()) {
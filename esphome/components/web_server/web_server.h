@@ -4,6 +4,7 @@
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #ifdef USE_WEBSERVER
+#include "esphome/components/json/json_writer.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
@@ -11,6 +12,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,16 +20,23 @@
 #if USE_WEBSERVER_VERSION >= 2
 extern const uint8_t ESPHOME_WEBSERVER_INDEX_HTML[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_INDEX_HTML_SIZE;
+extern const char ESPHOME_WEBSERVER_INDEX_HTML_ETAG[];
+#endif
+
+#ifdef USE_WEBSERVER_LOCAL
+extern const char ESPHOME_WEBSERVER_INDEX_GZ_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_JS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_JS_INCLUDE_ETAG[];
 #endif
 
 namespace esphome {
@@ -41,6 +50,7 @@ struct UrlMatch {
   uint8_t domain_len;  ///< Length of domain string
   uint8_t id_len;      ///< Length of id string
   uint8_t method_len;  ///< Length of method string
+  uint32_t id_hash;    ///< FNV-1 hash of the id, same as the object id hash of the entity it refers to
   bool valid;          ///< Whether this match is valid
 
   // Helper methods for string comparisons
@@ -48,8 +58,14 @@ struct UrlMatch {
     return domain && domain_len == strlen(str) && memcmp(domain, str, domain_len) == 0;
   }
 
-  bool id_equals(const std::string &str) const {
-    return id && id_len == str.length() && memcmp(id, str.c_str(), id_len) == 0;
+  bool id_equals(const StringRef &str) const {
+    return id && id_len == str.size() && memcmp(id, str.c_str(), id_len) == 0;
+  }
+
+  /// Whether the id refers to \p entity. The object id hash is generated at build time, so most entities are ruled
+  /// out by comparing it before the string.
+  bool id_equals(EntityBase *entity) const {
+    return id && id_hash == entity->get_object_id_hash() && this->id_equals(entity->get_object_id_ref());
   }
 
   bool method_equals(const char *str) const {
@@ -82,7 +98,7 @@ enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
   can be forgotten.
 */
 #ifdef USE_ARDUINO
-using message_generator_t = std::string(WebServer *, void *);
+using message_generator_t = void(WebServer *, void *, json::JsonWriter &);
 
 class DeferredUpdateEventSourceList;
 class DeferredUpdateEventSource : public AsyncEventSource {
@@ -91,10 +107,10 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   /*
     This class holds a pointer to the source component that wants to publish a state event, and a pointer to a function
     that will lazily generate that event.  The two pointers allow dedup in the deferred queue if multiple publishes for
-    the same component are backed up, and take up only 8 bytes of memory.  The entry in the deferred queue (a
-    std::vector) is the DeferredEvent instance itself (not a pointer to one elsewhere in heap) so still only 8 bytes per
-    entry (and no heap fragmentation).  Even 100 backed up events (you'd have to have at least 100 sensors publishing
-    because of dedup) would take up only 0.8 kB.
+    the same component are backed up.  When the event was already encoded once for several event sources, the entry
+    also references that shared message instead of generating it again.  The entry in the deferred queue (a
+    std::vector) is the DeferredEvent instance itself (not a pointer to one elsewhere in heap) so there is no heap
+    fragmentation per entry.
   */
   struct DeferredEvent {
     friend class DeferredUpdateEventSource;
@@ -102,14 +118,16 @@ class DeferredUpdateEventSource : public AsyncEventSource {
    protected:
     void *source_;
     message_generator_t *message_generator_;
+    // nullptr when the message is generated at send time
+    std::shared_ptr<const std::string> message_;
 
    public:
-    DeferredEvent(void *source, message_generator_t *message_generator)
-        : source_(source), message_generator_(message_generator) {}
+    DeferredEvent(void *source, message_generator_t *message_generator, std::shared_ptr<const std::string> message)
+        : source_(source), message_generator_(message_generator), message_(std::move(message)) {}
     bool operator==(const DeferredEvent &test) const {
       return (source_ == test.source_ && message_generator_ == test.message_generator_);
     }
-  } __attribute__((packed));
+  };
 
  protected:
   // surface a couple methods from the base class
@@ -120,14 +138,30 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   // vector is used very specifically for its zero memory overhead even though items are popped from the front (memory
   // footprint is more important than speed here)
   std::vector<DeferredEvent> deferred_queue_;
+  // Bytes of shared messages referenced by deferred_queue_
+  size_t deferred_queue_bytes_{0};
   WebServer *web_server_;
+  // Reused for every generated state event, keeps its capacity so events are built without allocating
+  std::string message_buffer_;
   uint16_t consecutive_send_failures_{0};
   static constexpr uint16_t MAX_CONSECUTIVE_SEND_FAILURES = 2500;  // ~20 seconds at 125Hz loop rate
+  // A client that is this far behind is dropped, the browser reconnects and gets the current state anyway
+  static constexpr size_t MAX_DEFERRED_QUEUE_BYTES = 8 * 1024;
 
   // helper for allowing only unique entries in the queue
-  void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
+  void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator,
+                                 std::shared_ptr<const std::string> message);
+  /// Whether a state event of this type should be sent to the client yet.
+  bool accepts_state_(const char *event_type) const;
+  /// Send a state event or queue it, message is the shared encoding or nullptr to generate it when sent.
+  void send_or_defer_state_(void *source, message_generator_t *message_generator,
+                            const std::shared_ptr<const std::string> &message);
+  /// Close a client whose deferred queue grew past MAX_DEFERRED_QUEUE_BYTES.
+  void drop_();
 
   void process_deferred_queue_();
+  /// Run message_generator into message_buffer_.
+  const char *generate_message_(void *source, message_generator_t *message_generator);
 
  public:
   DeferredUpdateEventSource(WebServer *ws, const String &url)
@@ -143,6 +177,12 @@ class DeferredUpdateEventSourceList : public std::list<DeferredUpdateEventSource
  protected:
   void on_client_connect_(WebServer *ws, DeferredUpdateEventSource *source);
   void on_client_disconnect_(DeferredUpdateEventSource *source);
+  /// Encode a state event once into shared_message_ for all event sources.
+  const std::shared_ptr<std::string> &encode_shared_message_(WebServer *ws, void *source,
+                                                             message_generator_t *message_generator);
+
+  // Last state event encoded for more than one event source, reused once no event source queues it anymore
+  std::shared_ptr<std::string> shared_message_;
 
  public:
   void loop();
@@ -232,6 +272,10 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Return the webserver configuration as JSON.
   std::string get_config_json();
 
+  /// Handle a request for the states of all entities under '/states', so a client needs one round trip instead of
+  /// one per entity.
+  void handle_states_request(AsyncWebServerRequest *request);
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   /// Handle included css request under '/0.css'.
   void handle_css_request(AsyncWebServerRequest *request);
@@ -252,8 +296,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a sensor request under '/sensor/<id>'.
   void handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string sensor_all_json_generator(WebServer *web_server, void *source);
+  static void sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the sensor state with its value as a JSON string.
   std::string sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config);
 #endif
@@ -264,8 +308,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a switch request under '/switch/<id>/</turn_on/turn_off/toggle>'.
   void handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string switch_state_json_generator(WebServer *web_server, void *source);
-  static std::string switch_all_json_generator(WebServer *web_server, void *source);
+  static void switch_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void switch_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the switch state with its value as a JSON string.
   std::string switch_json(switch_::Switch *obj, bool value, JsonDetail start_config);
 #endif
@@ -274,8 +318,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a button request under '/button/<id>/press'.
   void handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string button_state_json_generator(WebServer *web_server, void *source);
-  static std::string button_all_json_generator(WebServer *web_server, void *source);
+  static void button_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void button_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the button details with its value as a JSON string.
   std::string button_json(button::Button *obj, JsonDetail start_config);
 #endif
@@ -286,8 +330,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a binary sensor request under '/binary_sensor/<id>'.
   void handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string binary_sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string binary_sensor_all_json_generator(WebServer *web_server, void *source);
+  static void binary_sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void binary_sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the binary sensor state with its value as a JSON string.
   std::string binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config);
 #endif
@@ -298,8 +342,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a fan request under '/fan/<id>/</turn_on/turn_off/toggle>'.
   void handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string fan_state_json_generator(WebServer *web_server, void *source);
-  static std::string fan_all_json_generator(WebServer *web_server, void *source);
+  static void fan_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void fan_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the fan state as a JSON string.
   std::string fan_json(fan::Fan *obj, JsonDetail start_config);
 #endif
@@ -310,8 +354,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a light request under '/light/<id>/</turn_on/turn_off/toggle>'.
   void handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string light_state_json_generator(WebServer *web_server, void *source);
-  static std::string light_all_json_generator(WebServer *web_server, void *source);
+  static void light_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void light_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the light state as a JSON string.
   std::string light_json(light::LightState *obj, JsonDetail start_config);
 #endif
@@ -322,8 +366,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a text sensor request under '/text_sensor/<id>'.
   void handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string text_sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string text_sensor_all_json_generator(WebServer *web_server, void *source);
+  static void text_sensor_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void text_sensor_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the text sensor state with its value as a JSON string.
   std::string text_sensor_json(text_sensor::TextSensor *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -334,8 +378,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a cover request under '/cover/<id>/<open/close/stop/set>'.
   void handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string cover_state_json_generator(WebServer *web_server, void *source);
-  static std::string cover_all_json_generator(WebServer *web_server, void *source);
+  static void cover_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void cover_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the cover state as a JSON string.
   std::string cover_json(cover::Cover *obj, JsonDetail start_config);
 #endif
@@ -345,8 +389,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a number request under '/number/<id>'.
   void handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string number_state_json_generator(WebServer *web_server, void *source);
-  static std::string number_all_json_generator(WebServer *web_server, void *source);
+  static void number_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void number_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the number state with its value as a JSON string.
   std::string number_json(number::Number *obj, float value, JsonDetail start_config);
 #endif
@@ -356,8 +400,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a date request under '/date/<id>'.
   void handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string date_state_json_generator(WebServer *web_server, void *source);
-  static std::string date_all_json_generator(WebServer *web_server, void *source);
+  static void date_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void date_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the date state with its value as a JSON string.
   std::string date_json(datetime::DateEntity *obj, JsonDetail start_config);
 #endif
@@ -367,8 +411,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a time request under '/time/<id>'.
   void handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string time_state_json_generator(WebServer *web_server, void *source);
-  static std::string time_all_json_generator(WebServer *web_server, void *source);
+  static void time_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void time_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the time state with its value as a JSON string.
   std::string time_json(datetime::TimeEntity *obj, JsonDetail start_config);
 #endif
@@ -378,8 +422,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a datetime request under '/datetime/<id>'.
   void handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string datetime_state_json_generator(WebServer *web_server, void *source);
-  static std::string datetime_all_json_generator(WebServer *web_server, void *source);
+  static void datetime_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void datetime_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the datetime state with its value as a JSON string.
   std::string datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config);
 #endif
@@ -389,8 +433,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a text input request under '/text/<id>'.
   void handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string text_state_json_generator(WebServer *web_server, void *source);
-  static std::string text_all_json_generator(WebServer *web_server, void *source);
+  static void text_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void text_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the text state with its value as a JSON string.
   std::string text_json(text::Text *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -400,8 +444,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a select request under '/select/<id>'.
   void handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string select_state_json_generator(WebServer *web_server, void *source);
-  static std::string select_all_json_generator(WebServer *web_server, void *source);
+  static void select_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void select_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the select state with its value as a JSON string.
   std::string select_json(select::Select *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -411,8 +455,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a climate request under '/climate/<id>'.
   void handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string climate_state_json_generator(WebServer *web_server, void *source);
-  static std::string climate_all_json_generator(WebServer *web_server, void *source);
+  static void climate_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void climate_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the climate details
   std::string climate_json(climate::Climate *obj, JsonDetail start_config);
 #endif
@@ -423,8 +467,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a lock request under '/lock/<id>/</lock/unlock/open>'.
   void handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string lock_state_json_generator(WebServer *web_server, void *source);
-  static std::string lock_all_json_generator(WebServer *web_server, void *source);
+  static void lock_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void lock_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the lock state with its value as a JSON string.
   std::string lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config);
 #endif
@@ -435,8 +479,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a valve request under '/valve/<id>/<open/close/stop/set>'.
   void handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string valve_state_json_generator(WebServer *web_server, void *source);
-  static std::string valve_all_json_generator(WebServer *web_server, void *source);
+  static void valve_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void valve_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the valve state as a JSON string.
   std::string valve_json(valve::Valve *obj, JsonDetail start_config);
 #endif
@@ -447,8 +491,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a alarm_control_panel request under '/alarm_control_panel/<id>'.
   void handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string alarm_control_panel_state_json_generator(WebServer *web_server, void *source);
-  static std::string alarm_control_panel_all_json_generator(WebServer *web_server, void *source);
+  static void alarm_control_panel_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void alarm_control_panel_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the alarm_control_panel state with its value as a JSON string.
   std::string alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                        alarm_control_panel::AlarmControlPanelState value, JsonDetail start_config);
@@ -457,8 +501,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 #ifdef USE_EVENT
   void on_event(event::Event *obj, const std::string &event_type) override;
 
-  static std::string event_state_json_generator(WebServer *web_server, void *source);
-  static std::string event_all_json_generator(WebServer *web_server, void *source);
+  static void event_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void event_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
 
   /// Handle a event request under '/event<id>'.
   void handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match);
@@ -473,8 +517,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a update request under '/update/<id>'.
   void handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string update_state_json_generator(WebServer *web_server, void *source);
-  static std::string update_all_json_generator(WebServer *web_server, void *source);
+  static void update_state_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
+  static void update_all_json_generator(WebServer *web_server, void *source, json::JsonWriter &writer);
   /// Dump the update state with its value as a JSON string.
   std::string update_json(update::UpdateEntity *obj, JsonDetail start_config);
 #endif
@@ -497,7 +541,15 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool include_internal_{false};
 
  protected:
+  template<typename T>
+  void write_states_(json::JsonWriter &writer, const T &entities, message_generator_t *generator);
   void add_sorting_info_(JsonObject &root, EntityBase *entity);
+  /// Write the "id" member of a state event, "<prefix><object_id>", without building the string first.
+  static void write_json_id_(json::JsonWriter &writer, EntityBase *obj, const char *prefix);
+#ifdef USE_HISTORY
+  /// Handle '/sensor/<id>/history?duration=<s>&resolution=<s>' with min/max/avg buckets, oldest first.
+  void handle_sensor_history_request_(AsyncWebServerRequest *request, sensor::Sensor *obj);
+#endif
 
 #ifdef USE_LIGHT
   // Helper to parse and apply a float parameter with optional scaling
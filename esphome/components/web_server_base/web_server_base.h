@@ -36,6 +36,9 @@ class MiddlewareHandler : public AsyncWebHandler {
     next_->handleBody(request, data, len, index, total);
   }
   bool isRequestHandlerTrivial() const override { return next_->isRequestHandlerTrivial(); }
+#ifdef USE_WEBSERVER_WEBSOCKET
+  const char *websocket_url() const override { return next_->websocket_url(); }
+#endif
 
  protected:
   AsyncWebHandler *next_;
@@ -94,11 +97,11 @@ class WebServerBase : public Component {
     this->server_ = std::make_shared<AsyncWebServer>(this->port_);
     // All content is controlled and created by user - so allowing all origins is fine here.
     DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
-    this->server_->begin();
-
     for (auto *handler : this->handlers_)
       this->server_->addHandler(handler);
 
+    this->server_->begin();
+
     this->initialized_++;
   }
   void deinit() {
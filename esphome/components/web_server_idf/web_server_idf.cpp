@@ -1,5 +1,6 @@
 #ifdef USE_ESP_IDF
 
+#include <algorithm>
 #include <cstdarg>
 #include <memory>
 #include <cstring>
@@ -21,6 +22,7 @@
 #endif
 
 #ifdef USE_WEBSERVER
+#include "esphome/components/json/json_writer.h"
 #include "esphome/components/web_server/web_server.h"
 #include "esphome/components/web_server/list_entities.h"
 #endif  // USE_WEBSERVER
@@ -35,6 +37,20 @@ namespace web_server_idf {
 #define CRLF_STR "\r\n"
 #define CRLF_LEN (sizeof(CRLF_STR) - 1)
 
+#ifdef USE_WEBSERVER
+// 8 spaces are standing in for the hexidecimal chunk length of an event to print later
+static const char CHUNK_LEN_HEADER[] = "        " CRLF_STR;
+static constexpr size_t CHUNK_LEN_HEADER_LEN = sizeof(CHUNK_LEN_HEADER) - 1;
+#endif
+
+#ifdef USE_WEBSERVER_WEBSOCKET
+// Room for the longest websocket frame header a server sends for events up to 64 KiB
+static constexpr size_t WS_HEADER_LEN = 4;
+static constexpr char WS_TEXT_FRAME = static_cast<char>(0x81);  // FIN bit and the text opcode
+static constexpr char WS_CLOSE_FRAME = static_cast<char>(0x88);
+static constexpr char WS_PONG_FRAME = static_cast<char>(0x8A);
+#endif
+
 static const char *const TAG = "web_server_idf";
 
 // Global instance to avoid guard variable (saves 8 bytes)
@@ -59,12 +75,53 @@ void AsyncWebServer::begin() {
   }
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
+#ifdef USE_WEBSERVER_WEBSOCKET
+  // The catch-all handlers have an empty URI, the websocket handlers only take their own URL
+  config.uri_match_fn = [](const char *reference_uri, const char *uri, size_t match_upto) {
+    return *reference_uri == '\0' ||
+           (strlen(reference_uri) == match_upto && strncmp(reference_uri, uri, match_upto) == 0);
+  };
+#else
   config.uri_match_fn = [](const char * /*unused*/, const char * /*unused*/, size_t /*unused*/) { return true; };
+#endif
+#ifdef USE_WEBSERVER_MAX_CONNECTIONS
+  config.max_open_sockets = USE_WEBSERVER_MAX_CONNECTIONS;
+#endif
+#ifdef USE_WEBSERVER_LRU_PURGE
+  // Browsers and REST clients keep idle connections open, close the least recently used one for a new client
+  // instead of refusing it once all sockets are taken. This can also close an event stream or websocket that was
+  // quiet for a while, so it is opt-in.
+  config.lru_purge_enable = true;
+#endif
   if (httpd_start(&this->server_, &config) == ESP_OK) {
+#ifdef USE_WEBSERVER_WEBSOCKET
+    // Registered ahead of the catch-all GET handler, so httpd only answers an upgrade with 101 at these URLs
+    for (auto *handler : this->handlers_) {
+      const char *url = handler->websocket_url();
+      if (url == nullptr)
+        continue;
+      const httpd_uri_t handler_websocket = {
+          .uri = url,
+          .method = HTTP_GET,
+          .handler = AsyncWebServer::websocket_handler,
+          .user_ctx = this,
+          // httpd only answers the upgrade if the request asks for it, plain requests reach the handler unchanged
+          .is_websocket = true,
+          // PING and CLOSE reach the handler too, they are answered from the main loop between event frames
+          .handle_ws_control_frames = true,
+      };
+      httpd_register_uri_handler(this->server_, &handler_websocket);
+    }
+#endif
+
     const httpd_uri_t handler_get = {
         .uri = "",
         .method = HTTP_GET,
+#ifdef USE_WEBSERVER_WEBSOCKET
+        .handler = AsyncWebServer::request_get_handler,
+#else
         .handler = AsyncWebServer::request_handler,
+#endif
         .user_ctx = this,
     };
     httpd_register_uri_handler(this->server_, &handler_get);
@@ -146,6 +203,31 @@ esp_err_t AsyncWebServer::request_handler(httpd_req_t *r) {
   return static_cast<AsyncWebServer *>(r->user_ctx)->request_handler_(&req);
 }
 
+#ifdef USE_WEBSERVER_WEBSOCKET
+esp_err_t AsyncWebServer::request_get_handler(httpd_req_t *r) {
+  // None of the handlers of this URL accepts a websocket, refuse the upgrade instead of serving a plain response
+  auto upgrade = request_get_header(r, "Upgrade");
+  if (upgrade.has_value() && str_lower_case(upgrade.value()) == "websocket") {
+    httpd_resp_send_err(r, HTTPD_400_BAD_REQUEST, "No websocket at this URL");
+    return ESP_OK;
+  }
+  return AsyncWebServer::request_handler(r);
+}
+
+esp_err_t AsyncWebServer::websocket_handler(httpd_req_t *r) {
+  // Plain requests and the completed handshake of a websocket come in as GET, the frames after that don't
+  if (r->method == HTTP_GET) {
+    return AsyncWebServer::request_handler(r);
+  }
+  auto *session = static_cast<AsyncEventSourceResponse *>(r->sess_ctx);
+  if (session == nullptr) {
+    // The event source did not accept the session, returning an error closes the socket
+    return ESP_FAIL;
+  }
+  return session->handle_websocket_frame(r);
+}
+#endif
+
 esp_err_t AsyncWebServer::request_handler_(AsyncWebServerRequest *request) const {
   for (auto *handler : this->handlers_) {
     if (handler->canHandle(request)) {
@@ -186,10 +268,18 @@ std::string AsyncWebServerRequest::url() const {
 std::string AsyncWebServerRequest::host() const { return this->get_header("Host").value(); }
 
 void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->discard_response_)
+    return;
+#endif
   httpd_resp_send(*this, response->get_content_data(), response->get_content_size());
 }
 
 void AsyncWebServerRequest::send(int code, const char *content_type, const char *content) {
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->discard_response_)
+    return;
+#endif
   this->init_response_(nullptr, code, content_type);
   if (content) {
     httpd_resp_send(*this, content, HTTPD_RESP_USE_STRLEN);
@@ -199,6 +289,10 @@ void AsyncWebServerRequest::send(int code, const char *content_type, const char
 }
 
 void AsyncWebServerRequest::redirect(const std::string &url) {
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->discard_response_)
+    return;
+#endif
   httpd_resp_set_status(*this, "302 Found");
   httpd_resp_set_hdr(*this, "Location", url.c_str());
   httpd_resp_send(*this, nullptr, 0);
@@ -206,6 +300,7 @@ void AsyncWebServerRequest::redirect(const std::string &url) {
 
 void AsyncWebServerRequest::init_response_(AsyncWebServerResponse *rsp, int code, const char *content_type) {
   httpd_resp_set_status(*this, code == 200   ? HTTPD_200
+                               : code == 304 ? "304 Not Modified"
                                : code == 404 ? HTTPD_404
                                : code == 409 ? HTTPD_409
                                              : to_string(code).c_str());
@@ -317,8 +412,14 @@ AsyncEventSource::~AsyncEventSource() {
 }
 
 void AsyncEventSource::handleRequest(AsyncWebServerRequest *request) {
+  bool websocket = false;
+#ifdef USE_WEBSERVER_WEBSOCKET
+  // httpd already completed the handshake if the client asked for a websocket
+  httpd_req_t *req = *request;
+  websocket = httpd_ws_get_fd_info(req->handle, httpd_req_to_sockfd(req)) == HTTPD_WS_CLIENT_WEBSOCKET;
+#endif
   // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,clang-analyzer-cplusplus.NewDeleteLeaks)
-  auto *rsp = new AsyncEventSourceResponse(request, this, this->web_server_);
+  auto *rsp = new AsyncEventSourceResponse(request, this, this->web_server_, websocket);
   if (this->on_connect_) {
     this->on_connect_(rsp);
   }
@@ -354,29 +455,66 @@ void AsyncEventSource::try_send_nodefer(const char *message, const char *event,
 
 void AsyncEventSource::deferrable_send_state(void *source, const char *event_type,
                                              message_generator_t *message_generator) {
+  // A single session writes the event straight into its own buffer. The "state_detail_all" events of the initial
+  // entity listing are generated per session too, so only live state updates are held in the deferred queues.
+  if (this->sessions_.size() == 1 || event_type == nullptr || 0 != strcmp(event_type, "state")) {
+    for (auto *ses : this->sessions_) {
+      if (ses->fd_.load() != 0) {  // Skip dead sessions
+        ses->deferrable_send_state(source, event_type, message_generator);
+      }
+    }
+    return;
+  }
+
+  if (source == nullptr || message_generator == nullptr)
+    return;
+
+  // Encode the event once on first use and hand the same message to every session
+  std::shared_ptr<const std::string> message;
   for (auto *ses : this->sessions_) {
-    if (ses->fd_.load() != 0) {  // Skip dead sessions
-      ses->deferrable_send_state(source, event_type, message_generator);
+    if (ses->fd_.load() == 0 || !ses->accepts_state_(event_type)) {  // Skip dead sessions
+      continue;
+    }
+    if (!message) {
+      message = this->encode_shared_message_(source, message_generator);
     }
+    ses->send_or_defer_state_(source, message_generator, message);
   }
 }
 
+const std::shared_ptr<std::string> &AsyncEventSource::encode_shared_message_(void *source,
+                                                                            message_generator_t *message_generator) {
+  // Sessions that could not send the last message still reference it, otherwise the buffer keeps its capacity
+  if (this->shared_message_.use_count() != 1) {
+    this->shared_message_ = std::make_shared<std::string>();
+  }
+  this->shared_message_->clear();
+  json::JsonWriter writer(*this->shared_message_);
+  message_generator(this->web_server_, source, writer);
+  return this->shared_message_;
+}
+
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request,
                                                    esphome::web_server_idf::AsyncEventSource *server,
-                                                   esphome::web_server::WebServer *ws)
-    : server_(server), web_server_(ws), entities_iterator_(new esphome::web_server::ListEntitiesIterator(ws, server)) {
+                                                   esphome::web_server::WebServer *ws, bool websocket)
+    : server_(server),
+      web_server_(ws),
+      entities_iterator_(new esphome::web_server::ListEntitiesIterator(ws, server)),
+      websocket_(websocket) {
   httpd_req_t *req = *request;
 
-  httpd_resp_set_status(req, HTTPD_200);
-  httpd_resp_set_type(req, "text/event-stream");
-  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-  httpd_resp_set_hdr(req, "Connection", "keep-alive");
+  if (!websocket) {
+    httpd_resp_set_status(req, HTTPD_200);
+    httpd_resp_set_type(req, "text/event-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "Connection", "keep-alive");
 
-  for (const auto &pair : DefaultHeaders::Instance().headers_) {
-    httpd_resp_set_hdr(req, pair.first.c_str(), pair.second.c_str());
-  }
+    for (const auto &pair : DefaultHeaders::Instance().headers_) {
+      httpd_resp_set_hdr(req, pair.first.c_str(), pair.second.c_str());
+    }
 
-  httpd_resp_send_chunk(req, CRLF_STR, CRLF_LEN);
+    httpd_resp_send_chunk(req, CRLF_STR, CRLF_LEN);
+  }
 
   req->sess_ctx = this;
   req->free_ctx = AsyncEventSourceResponse::destroy;
@@ -423,24 +561,47 @@ void AsyncEventSourceResponse::destroy(void *ptr) {
 }
 
 // helper for allowing only unique entries in the queue
-void AsyncEventSourceResponse::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator) {
-  DeferredEvent item(source, message_generator);
+void AsyncEventSourceResponse::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator,
+                                                         std::shared_ptr<const std::string> message) {
+  DeferredEvent item(source, message_generator, std::move(message));
+  size_t message_bytes = item.message_ ? item.message_->size() : 0;
 
   // Use range-based for loop instead of std::find_if to reduce template instantiation overhead and binary size
+  bool found = false;
   for (auto &event : this->deferred_queue_) {
     if (event == item) {
-      event = item;
-      return;
+      this->deferred_queue_bytes_ -= event.message_ ? event.message_->size() : 0;
+      event = std::move(item);
+      found = true;
+      break;
     }
   }
-  this->deferred_queue_.push_back(item);
+  if (!found) {
+    this->deferred_queue_.push_back(std::move(item));
+  }
+  this->deferred_queue_bytes_ += message_bytes;
+
+  if (this->deferred_queue_bytes_ > MAX_DEFERRED_QUEUE_BYTES) {
+    this->drop_();
+  }
+}
+
+void AsyncEventSourceResponse::drop_() {
+  ESP_LOGW(TAG, "Closing event source connection that fell behind (fd: %d, %zu bytes queued)", this->fd_.load(),
+           this->deferred_queue_bytes_);
+  this->deferred_queue_.clear();
+  this->deferred_queue_bytes_ = 0;
+  // destroy() is called once httpd has closed the socket, the session is then removed in the main loop
+  httpd_sess_trigger_close(this->hd_, this->fd_.load());
 }
 
 void AsyncEventSourceResponse::process_deferred_queue_() {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
-    if (this->try_send_nodefer(message.c_str(), "state")) {
+    bool sent =
+        de.message_ ? this->try_send_state_(*de.message_) : this->try_send_state_(de.source_, de.message_generator_);
+    if (sent) {
+      this->deferred_queue_bytes_ -= de.message_ ? de.message_->size() : 0;
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
     } else {
@@ -450,6 +611,12 @@ void AsyncEventSourceResponse::process_deferred_queue_() {
 }
 
 void AsyncEventSourceResponse::process_buffer_() {
+#ifdef USE_WEBSERVER_WEBSOCKET
+  // Control frames only go out between whole event frames
+  if (this->websocket_ && event_buffer_.empty()) {
+    this->queue_control_frame_();
+  }
+#endif
   if (event_buffer_.empty()) {
     return;
   }
@@ -471,6 +638,12 @@ void AsyncEventSourceResponse::process_buffer_() {
   if (event_bytes_sent_ == event_buffer_.size()) {
     event_buffer_.resize(0);
     event_bytes_sent_ = 0;
+#ifdef USE_WEBSERVER_WEBSOCKET
+    if (this->closing_) {
+      // The close reply went out, which completes the closing handshake
+      httpd_sess_trigger_close(this->hd_, this->fd_.load());
+    }
+#endif
   }
 }
 
@@ -481,11 +654,15 @@ void AsyncEventSourceResponse::loop() {
     this->entities_iterator_->advance();
 }
 
-bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char *event, uint32_t id,
-                                                uint32_t reconnect) {
+bool AsyncEventSourceResponse::begin_event_(const char *event, uint32_t id, uint32_t reconnect) {
   if (this->fd_.load() == 0) {
     return false;
   }
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->closing_) {
+    return false;
+  }
+#endif
 
   process_buffer_();
   if (!event_buffer_.empty()) {
@@ -493,11 +670,19 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
     return false;
   }
 
-  // 8 spaces are standing in for the hexidecimal chunk length to print later
-  const char chunk_len_header[] = "        " CRLF_STR;
-  const int chunk_len_header_len = sizeof(chunk_len_header) - 1;
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->websocket_) {
+    // The frame header is filled in by end_event_(), the reconnect time and id only mean something to an EventSource
+    event_buffer_.append(WS_HEADER_LEN, '\0');
+    if (event) {
+      event_buffer_.append(event);
+    }
+    event_buffer_.push_back('\n');
+    return true;
+  }
+#endif
 
-  event_buffer_.append(chunk_len_header);
+  event_buffer_.append(CHUNK_LEN_HEADER, CHUNK_LEN_HEADER_LEN);
 
   if (reconnect) {
     event_buffer_.append("retry: ", sizeof("retry: ") - 1);
@@ -516,39 +701,113 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
     event_buffer_.append(event);
     event_buffer_.append(CRLF_STR, CRLF_LEN);
   }
+  return true;
+}
 
-  if (message && *message) {
-    event_buffer_.append("data: ", sizeof("data: ") - 1);
-    event_buffer_.append(message);
-    event_buffer_.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (event_buffer_.empty()) {
-    return true;
+void AsyncEventSourceResponse::end_event_() {
+#ifdef USE_WEBSERVER_WEBSOCKET
+  if (this->websocket_) {
+    // A server sends unmasked frames and has to use the shortest length encoding, for short events the unused
+    // header bytes at the start are skipped
+    size_t len = event_buffer_.size() - WS_HEADER_LEN;
+    if (len < 126) {
+      event_buffer_[2] = WS_TEXT_FRAME;
+      event_buffer_[3] = static_cast<char>(len);
+      event_bytes_sent_ = 2;
+    } else if (len <= 0xFFFF) {
+      event_buffer_[0] = WS_TEXT_FRAME;
+      event_buffer_[1] = 126;
+      event_buffer_[2] = static_cast<char>(len >> 8);
+      event_buffer_[3] = static_cast<char>(len & 0xFF);
+      event_bytes_sent_ = 0;
+    } else {
+      ESP_LOGW(TAG, "Event too large for websocket: %zu bytes", len);
+      event_buffer_.resize(0);
+      event_bytes_sent_ = 0;
+      return;
+    }
+    process_buffer_();
+    return;
   }
+#endif
 
   event_buffer_.append(CRLF_STR, CRLF_LEN);
   event_buffer_.append(CRLF_STR, CRLF_LEN);
 
   // chunk length header itself and the final chunk terminating CRLF are not counted as part of the chunk
-  int chunk_len = event_buffer_.size() - CRLF_LEN - chunk_len_header_len;
+  int chunk_len = event_buffer_.size() - CRLF_LEN - CHUNK_LEN_HEADER_LEN;
   char chunk_len_str[9];
   snprintf(chunk_len_str, 9, "%08x", chunk_len);
   std::memcpy(&event_buffer_[0], chunk_len_str, 8);
 
   event_bytes_sent_ = 0;
   process_buffer_();
+}
+
+bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char *event, uint32_t id,
+                                                uint32_t reconnect) {
+  if (!this->begin_event_(event, id, reconnect)) {
+    return false;
+  }
 
+  if (message && *message) {
+    this->begin_data_();
+    event_buffer_.append(message);
+    this->end_data_();
+  }
+
+  this->end_event_();
   return true;
 }
 
-void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
-                                                     message_generator_t *message_generator) {
+bool AsyncEventSourceResponse::try_send_state_(void *source, message_generator_t *message_generator) {
+  if (!this->begin_event_("state", 0, 0)) {
+    return false;
+  }
+
+  // The json is written straight after the event header, event_buffer_ keeps its capacity between events
+  this->begin_data_();
+  json::JsonWriter writer(event_buffer_);
+  message_generator(web_server_, source, writer);
+  this->end_data_();
+
+  this->end_event_();
+  return true;
+}
+
+bool AsyncEventSourceResponse::try_send_state_(const std::string &message) {
+  if (!this->begin_event_("state", 0, 0)) {
+    return false;
+  }
+
+  this->begin_data_();
+  event_buffer_.append(message);
+  this->end_data_();
+
+  this->end_event_();
+  return true;
+}
+
+void AsyncEventSourceResponse::begin_data_() {
+  if (!this->websocket_) {
+    event_buffer_.append("data: ", sizeof("data: ") - 1);
+  }
+}
+
+void AsyncEventSourceResponse::end_data_() {
+  if (!this->websocket_) {
+    event_buffer_.append(CRLF_STR, CRLF_LEN);
+  }
+}
+
+bool AsyncEventSourceResponse::accepts_state_(const char *event_type) const {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
-  if (!entities_iterator_->completed() && 0 != strcmp(event_type, "state_detail_all"))
-    return;
+  return this->entities_iterator_->completed() || 0 == strcmp(event_type, "state_detail_all");
+}
 
+void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
+                                                     message_generator_t *message_generator) {
   if (source == nullptr)
     return;
   if (event_type == nullptr)
@@ -556,24 +815,131 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
   if (message_generator == nullptr)
     return;
 
+  if (!this->accepts_state_(event_type))
+    return;
+
   if (0 != strcmp(event_type, "state_detail_all") && 0 != strcmp(event_type, "state")) {
     ESP_LOGE(TAG, "Can't defer non-state event");
   }
 
+  this->send_or_defer_state_(source, message_generator, nullptr);
+}
+
+void AsyncEventSourceResponse::send_or_defer_state_(void *source, message_generator_t *message_generator,
+                                                    const std::shared_ptr<const std::string> &message) {
   process_buffer_();
   process_deferred_queue_();
 
   if (!event_buffer_.empty() || !deferred_queue_.empty()) {
     // outgoing event buffer or deferred queue still not empty which means downstream tcp send buffer full, no point
     // trying to send first
-    deq_push_back_with_dedup_(source, message_generator);
+    deq_push_back_with_dedup_(source, message_generator, message);
+  } else {
+    bool sent = message ? this->try_send_state_(*message) : this->try_send_state_(source, message_generator);
+    if (!sent) {
+      deq_push_back_with_dedup_(source, message_generator, message);
+    }
+  }
+}
+
+#ifdef USE_WEBSERVER_WEBSOCKET
+esp_err_t AsyncEventSourceResponse::handle_websocket_frame(httpd_req_t *req) {
+  httpd_ws_frame_t frame{};
+  // Reading with a zero length only fills in the type and length of the frame
+  esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+  if (err != ESP_OK) {
+    return err;
+  }
+  if (frame.type == HTTPD_WS_TYPE_PING || frame.type == HTTPD_WS_TYPE_PONG || frame.type == HTTPD_WS_TYPE_CLOSE) {
+    return this->handle_control_frame_(req, frame);
+  }
+  // Anything but text is unexpected and would be left unread
+  if (frame.type != HTTPD_WS_TYPE_TEXT) {
+    ESP_LOGW(TAG, "Unsupported websocket frame type %d", frame.type);
+    return ESP_FAIL;
+  }
+
+  // The command is read straight into the URI of a copy of the request, so handlers see it like a POST request
+  httpd_req_t command = *req;
+  char *uri = const_cast<char *>(command.uri);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  if (frame.len == 0 || frame.len >= sizeof(command.uri)) {
+    ESP_LOGW(TAG, "Invalid websocket command length %zu", frame.len);
+    return ESP_FAIL;
+  }
+  frame.payload = reinterpret_cast<uint8_t *>(uri);
+  err = httpd_ws_recv_frame(req, &frame, frame.len);
+  if (err != ESP_OK) {
+    return err;
+  }
+  uri[frame.len] = '\0';
+  command.method = HTTP_POST;
+
+  AsyncWebServerRequest request(&command);
+  request.discard_response_ = true;
+  // The session passed authentication on the handshake, so the command goes to the web server directly. The new
+  // state comes back as a state event like for any other change.
+  if (this->web_server_->canHandle(&request)) {
+    this->web_server_->handleRequest(&request);
   } else {
-    std::string message = message_generator(web_server_, source);
-    if (!this->try_send_nodefer(message.c_str(), "state")) {
-      deq_push_back_with_dedup_(source, message_generator);
+    ESP_LOGW(TAG, "Unknown websocket command: %s", uri);
+  }
+  return ESP_OK;
+}
+
+esp_err_t AsyncEventSourceResponse::handle_control_frame_(httpd_req_t *req, httpd_ws_frame_t &frame) {
+  uint8_t payload[WS_MAX_CONTROL_PAYLOAD];
+  if (frame.len > sizeof(payload)) {
+    ESP_LOGW(TAG, "Invalid websocket control frame length %zu", frame.len);
+    return ESP_FAIL;
+  }
+  if (frame.len > 0) {
+    frame.payload = payload;
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, frame.len);
+    if (err != ESP_OK) {
+      return err;
     }
   }
+
+  // Replies written from the httpd task could land in the middle of an event frame the main loop is sending. They
+  // are only noted here and queued by the main loop between two frames.
+  LockGuard guard{this->control_lock_};
+  if (frame.type == HTTPD_WS_TYPE_PING) {
+    // Only the most recent ping needs an answer
+    std::memcpy(this->pong_payload_, payload, frame.len);
+    this->pong_len_ = frame.len;
+    this->pong_pending_ = true;
+  } else if (frame.type == HTTPD_WS_TYPE_CLOSE) {
+    // The reply echoes the status code of the client
+    this->close_len_ = std::min<size_t>(frame.len, sizeof(this->close_status_));
+    std::memcpy(this->close_status_, payload, this->close_len_);
+    this->close_pending_ = true;
+  }
+  return ESP_OK;
 }
+
+void AsyncEventSourceResponse::queue_control_frame_() {
+  if (this->closing_) {
+    return;
+  }
+  LockGuard guard{this->control_lock_};
+  if (this->close_pending_) {
+    event_buffer_.push_back(WS_CLOSE_FRAME);
+    event_buffer_.push_back(static_cast<char>(this->close_len_));
+    event_buffer_.append(reinterpret_cast<const char *>(this->close_status_), this->close_len_);
+    this->close_pending_ = false;
+    this->pong_pending_ = false;
+    this->closing_ = true;
+  } else if (this->pong_pending_) {
+    event_buffer_.push_back(WS_PONG_FRAME);
+    event_buffer_.push_back(static_cast<char>(this->pong_len_));
+    event_buffer_.append(reinterpret_cast<const char *>(this->pong_payload_), this->pong_len_);
+    this->pong_pending_ = false;
+  } else {
+    return;
+  }
+  event_bytes_sent_ = 0;
+}
+#endif
 #endif
 
 #ifdef USE_WEBSERVER_OTA
@@ -2,12 +2,14 @@
 #ifdef USE_ESP_IDF
 
 #include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
 #include <esp_http_server.h>
 
 #include <atomic>
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -19,6 +21,9 @@ namespace web_server {
 class WebServer;
 class ListEntitiesIterator;
 };  // namespace web_server
+namespace json {
+class JsonWriter;
+}  // namespace json
 #endif
 namespace web_server_idf {
 
@@ -83,6 +88,10 @@ class AsyncResponseStream : public AsyncWebServerResponse {
 
   void print(const char *str) { this->content_.append(str); }
   void print(const std::string &str) { this->content_.append(str); }
+  size_t write(const uint8_t *data, size_t len) {
+    this->content_.append(reinterpret_cast<const char *>(data), len);
+    return len;
+  }
   void print(float value);
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 
@@ -105,6 +114,9 @@ class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
 
 class AsyncWebServerRequest {
   friend class AsyncWebServer;
+#ifdef USE_WEBSERVER_WEBSOCKET
+  friend class AsyncEventSourceResponse;
+#endif
 
  public:
   ~AsyncWebServerRequest();
@@ -176,6 +188,10 @@ class AsyncWebServerRequest {
   AsyncWebServerResponse *rsp_{};
   std::map<std::string, AsyncWebParameter *> params_;
   std::string post_query_;
+#ifdef USE_WEBSERVER_WEBSOCKET
+  // Commands received over a websocket have no HTTP response, whatever the handler sends is dropped
+  bool discard_response_{false};
+#endif
   AsyncWebServerRequest(httpd_req_t *req) : req_(req) {}
   AsyncWebServerRequest(httpd_req_t *req, std::string post_query) : req_(req), post_query_(std::move(post_query)) {}
   void init_response_(AsyncWebServerResponse *rsp, int code, const char *content_type);
@@ -197,6 +213,11 @@ class AsyncWebServer {
   // NOLINTNEXTLINE(readability-identifier-naming)
   AsyncWebHandler &addHandler(AsyncWebHandler *handler) {
     this->handlers_.push_back(handler);
+#ifdef USE_WEBSERVER_WEBSOCKET
+    // The websocket handler of its URL has to be registered ahead of the catch-all GET handler
+    if (this->server_ && handler->websocket_url() != nullptr)
+      this->begin();
+#endif
     return *handler;
   }
 
@@ -205,6 +226,10 @@ class AsyncWebServer {
   httpd_handle_t server_{};
   static esp_err_t request_handler(httpd_req_t *r);
   static esp_err_t request_post_handler(httpd_req_t *r);
+#ifdef USE_WEBSERVER_WEBSOCKET
+  static esp_err_t request_get_handler(httpd_req_t *r);
+  static esp_err_t websocket_handler(httpd_req_t *r);
+#endif
   esp_err_t request_handler_(AsyncWebServerRequest *request) const;
 #ifdef USE_WEBSERVER_OTA
   esp_err_t handle_multipart_upload_(httpd_req_t *r, const char *content_type);
@@ -227,21 +252,24 @@ class AsyncWebHandler {
   virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
   // NOLINTNEXTLINE(readability-identifier-naming)
   virtual bool isRequestHandlerTrivial() const { return true; }
+#ifdef USE_WEBSERVER_WEBSOCKET
+  /// URL at which this handler accepts a websocket upgrade, nullptr if it does not.
+  virtual const char *websocket_url() const { return nullptr; }
+#endif
 };
 
 #ifdef USE_WEBSERVER
 class AsyncEventSource;
 class AsyncEventSourceResponse;
 
-using message_generator_t = std::string(esphome::web_server::WebServer *, void *);
+using message_generator_t = void(esphome::web_server::WebServer *, void *, esphome::json::JsonWriter &);
 
 /*
   This class holds a pointer to the source component that wants to publish a state event, and a pointer to a function
   that will lazily generate that event.  The two pointers allow dedup in the deferred queue if multiple publishes for
-  the same component are backed up, and take up only 8 bytes of memory.  The entry in the deferred queue (a
-  std::vector) is the DeferredEvent instance itself (not a pointer to one elsewhere in heap) so still only 8 bytes per
-  entry (and no heap fragmentation).  Even 100 backed up events (you'd have to have at least 100 sensors publishing
-  because of dedup) would take up only 0.8 kB.
+  the same component are backed up.  When the event was already encoded once for several sessions, the entry also
+  references that shared message instead of generating it again.  The entry in the deferred queue (a std::vector) is the
+  DeferredEvent instance itself (not a pointer to one elsewhere in heap) so there is no heap fragmentation per entry.
 */
 struct DeferredEvent {
   friend class AsyncEventSourceResponse;
@@ -249,14 +277,16 @@ struct DeferredEvent {
  protected:
   void *source_;
   message_generator_t *message_generator_;
+  // nullptr when the message is generated at send time
+  std::shared_ptr<const std::string> message_;
 
  public:
-  DeferredEvent(void *source, message_generator_t *message_generator)
-      : source_(source), message_generator_(message_generator) {}
+  DeferredEvent(void *source, message_generator_t *message_generator, std::shared_ptr<const std::string> message)
+      : source_(source), message_generator_(message_generator), message_(std::move(message)) {}
   bool operator==(const DeferredEvent &test) const {
     return (source_ == test.source_ && message_generator_ == test.message_generator_);
   }
-} __attribute__((packed));
+};
 
 class AsyncEventSourceResponse {
   friend class AsyncEventSource;
@@ -265,28 +295,81 @@ class AsyncEventSourceResponse {
   bool try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
   void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
   void loop();
+#ifdef USE_WEBSERVER_WEBSOCKET
+  /// Read a frame from the websocket of this session and run the command it carries.
+  esp_err_t handle_websocket_frame(httpd_req_t *req);
+#endif
 
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, esphome::web_server_idf::AsyncEventSource *server,
-                           esphome::web_server::WebServer *ws);
-
-  void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
+                           esphome::web_server::WebServer *ws, bool websocket);
+
+  /// Whether a state event of this type should be sent to the session yet.
+  bool accepts_state_(const char *event_type) const;
+  /// Send a state event or queue it, message is the shared encoding or nullptr to generate it when sent.
+  void send_or_defer_state_(void *source, message_generator_t *message_generator,
+                            const std::shared_ptr<const std::string> &message);
+  void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator,
+                                 std::shared_ptr<const std::string> message);
   void process_deferred_queue_();
   void process_buffer_();
+  /// Start a new event in event_buffer_, false if the previous one has not been sent yet.
+  bool begin_event_(const char *event, uint32_t id, uint32_t reconnect);
+  /// Terminate the event and fill in its chunk length, then start sending it.
+  void end_event_();
+  /// Frame the data of an event for the transport of the session.
+  void begin_data_();
+  void end_data_();
+  /// Generate a state event straight into event_buffer_.
+  bool try_send_state_(void *source, message_generator_t *message_generator);
+  /// Send a state event that was already encoded.
+  bool try_send_state_(const std::string &message);
+  /// Close a session whose deferred queue grew past MAX_DEFERRED_QUEUE_BYTES.
+  void drop_();
+#ifdef USE_WEBSERVER_WEBSOCKET
+  /// Note a PING or CLOSE from the client, it is answered from the main loop by queue_control_frame_().
+  esp_err_t handle_control_frame_(httpd_req_t *req, httpd_ws_frame_t &frame);
+  /// Put the reply to a pending PING or CLOSE into the empty event_buffer_.
+  void queue_control_frame_();
+#endif
 
   static void destroy(void *p);
   AsyncEventSource *server_;
   httpd_handle_t hd_{};
   std::atomic<int> fd_{};
   std::vector<DeferredEvent> deferred_queue_;
+  // Bytes of shared messages referenced by deferred_queue_
+  size_t deferred_queue_bytes_{0};
   esphome::web_server::WebServer *web_server_;
   std::unique_ptr<esphome::web_server::ListEntitiesIterator> entities_iterator_;
   std::string event_buffer_{""};
   size_t event_bytes_sent_;
+  // Events are sent as websocket text frames instead of a chunked text/event-stream response
+  bool websocket_{false};
+#ifdef USE_WEBSERVER_WEBSOCKET
+  static constexpr size_t WS_MAX_CONTROL_PAYLOAD = 125;
+  // Control frames are read on the httpd task, all frames are written from the main loop so they never interleave
+  Mutex control_lock_;
+  uint8_t pong_payload_[WS_MAX_CONTROL_PAYLOAD];
+  uint8_t pong_len_{0};
+  uint8_t close_status_[2];
+  uint8_t close_len_{0};
+  bool pong_pending_{false};
+  bool close_pending_{false};
+  // The close reply is queued, no other frame may follow it
+  bool closing_{false};
+#endif
+  // A session that is this far behind is dropped, the browser reconnects and gets the current state anyway
+  static constexpr size_t MAX_DEFERRED_QUEUE_BYTES = 8 * 1024;
 };
 
 using AsyncEventSourceClient = AsyncEventSourceResponse;
 
+/*
+  With USE_WEBSERVER_WEBSOCKET the event source URL also accepts a websocket upgrade. That session gets the same events
+  and deferred queue as an event stream, each one a text frame of the event name, a newline and the data. Text frames
+  from the client are commands in the form of a POST request URL, e.g. "/light/kitchen/turn_on?brightness=128".
+*/
 class AsyncEventSource : public AsyncWebHandler {
   friend class AsyncEventSourceResponse;
   using connect_handler_t = std::function<void(AsyncEventSourceClient *)>;
@@ -303,6 +386,9 @@ class AsyncEventSource : public AsyncWebHandler {
   void handleRequest(AsyncWebServerRequest *request) override;
   // NOLINTNEXTLINE(readability-identifier-naming)
   void onConnect(connect_handler_t cb) { this->on_connect_ = std::move(cb); }
+#ifdef USE_WEBSERVER_WEBSOCKET
+  const char *websocket_url() const override { return this->url_.c_str(); }
+#endif
 
   void try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
   void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
@@ -312,10 +398,15 @@ class AsyncEventSource : public AsyncWebHandler {
   size_t count() const { return this->sessions_.size(); }
 
  protected:
+  /// Encode a state event once into shared_message_ for all sessions.
+  const std::shared_ptr<std::string> &encode_shared_message_(void *source, message_generator_t *message_generator);
+
   std::string url_;
   std::set<AsyncEventSourceResponse *> sessions_;
   connect_handler_t on_connect_{};
   esphome::web_server::WebServer *web_server_;
+  // Last state event encoded for more than one session, reused once no session queues it anymore
+  std::shared_ptr<std::string> shared_message_;
 };
 #endif  // USE_WEBSERVER
 
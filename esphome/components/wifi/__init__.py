@@ -23,8 +23,10 @@ from esphome.const import (
     CONF_FAST_CONNECT,
     CONF_GATEWAY,
     CONF_HIDDEN,
+    CONF_HYSTERESIS,
     CONF_ID,
     CONF_IDENTITY,
+    CONF_INTERVAL,
     CONF_KEY,
     CONF_MANUAL_IP,
     CONF_NETWORKS,
@@ -38,6 +40,7 @@ from esphome.const import (
     CONF_SSID,
     CONF_STATIC_IP,
     CONF_SUBNET,
+    CONF_THRESHOLD,
     CONF_TIMEOUT,
     CONF_TTLS_PHASE_2,
     CONF_USE_ADDRESS,
@@ -252,6 +255,17 @@ def _validate(config):
 
 CONF_OUTPUT_POWER = "output_power"
 CONF_PASSIVE_SCAN = "passive_scan"
+CONF_ROAMING = "roaming"
+
+ROAMING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_THRESHOLD, default=-75): cv.int_range(min=-100, max=-30),
+        cv.Optional(
+            CONF_INTERVAL, default="1min"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_HYSTERESIS, default=8): cv.int_range(min=0, max=40),
+    }
+)
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -287,6 +301,7 @@ CONFIG_SCHEMA = cv.All(
                 cv.boolean, cv.only_with_esp_idf
             ),
             cv.Optional(CONF_PASSIVE_SCAN, default=False): cv.boolean,
+            cv.Optional(CONF_ROAMING): ROAMING_SCHEMA,
             cv.Optional("enable_mdns"): cv.invalid(
                 "This option has been removed. Please use the [disabled] option under the "
                 "new mdns component instead."
@@ -409,6 +424,15 @@ async def to_code(config):
     cg.add(var.set_power_save_mode(config[CONF_POWER_SAVE_MODE]))
     cg.add(var.set_fast_connect(config[CONF_FAST_CONNECT]))
     cg.add(var.set_passive_scan(config[CONF_PASSIVE_SCAN]))
+    if roaming := config.get(CONF_ROAMING):
+        cg.add_define("USE_WIFI_ROAMING")
+        cg.add(
+            var.set_roaming(
+                roaming[CONF_THRESHOLD],
+                roaming[CONF_INTERVAL],
+                roaming[CONF_HYSTERESIS],
+            )
+        )
     if CONF_OUTPUT_POWER in config:
         cg.add(var.set_output_power(config[CONF_OUTPUT_POWER]))
 
@@ -420,6 +444,10 @@ async def to_code(config):
         cg.add_library("WiFi", None)
 
     if CORE.is_esp32 and CORE.using_esp_idf:
+        if config[CONF_FAST_CONNECT]:
+            # Ask the DHCP server for the previous address straight away instead of
+            # going through discover/offer, which the server may still refuse.
+            add_idf_sdkconfig_option("CONFIG_LWIP_DHCP_RESTORE_LAST_IP", True)
         if config[CONF_ENABLE_BTM] or config[CONF_ENABLE_RRM]:
             add_idf_sdkconfig_option("CONFIG_WPA_11KV_SUPPORT", True)
             cg.add_define("USE_WIFI_11KV_SUPPORT")
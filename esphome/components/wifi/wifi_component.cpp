@@ -37,6 +37,10 @@
 #include "esphome/components/esp32_improv/esp32_improv_component.h"
 #endif
 
+#ifdef USE_BOOT_TIMELINE
+#include "esphome/components/boot_timeline/boot_timeline.h"
+#endif
+
 namespace esphome {
 namespace wifi {
 
@@ -175,11 +179,17 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_STA_CONNECTED: {
         if (!this->is_connected()) {
           ESP_LOGW(TAG, "Connection lost; reconnecting");
+#ifdef USE_WIFI_ROAMING
+          this->roaming_scan_ = false;
+#endif
           this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTING;
           this->retry_connect();
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+#ifdef USE_WIFI_ROAMING
+          this->check_roaming_(now);
+#endif
         }
         break;
       }
@@ -618,44 +628,99 @@ void WiFiComponent::check_scanning_finished() {
   WiFiScanResult scan_res = this->scan_result_[0];
   for (auto &config : this->sta_) {
     // search for matching STA config, at least one will match (from checks before)
-    if (!scan_res.matches(config)) {
-      continue;
+    if (scan_res.matches(config)) {
+      connect_params = this->build_connect_params_(scan_res, config);
+      break;
     }
+  }
 
-    if (config.get_hidden()) {
-      // selected network is hidden, we use the data from the config
-      connect_params.set_hidden(true);
-      connect_params.set_ssid(config.get_ssid());
-      // don't set BSSID and channel, there might be multiple hidden networks
-      // but we can't know which one is the correct one. Rely on probe-req with just SSID.
-    } else {
-      // selected network is visible, we use the data from the scan
-      // limit the connect params to only connect to exactly this network
-      // (network selection is done during scan phase).
-      connect_params.set_hidden(false);
-      connect_params.set_ssid(scan_res.get_ssid());
-      connect_params.set_channel(scan_res.get_channel());
-      connect_params.set_bssid(scan_res.get_bssid());
-    }
-    // copy manual IP (if set)
-    connect_params.set_manual_ip(config.get_manual_ip());
+  yield();
+
+  this->selected_ap_ = connect_params;
+  this->start_connecting(connect_params, false);
+}
+
+WiFiAP WiFiComponent::build_connect_params_(const WiFiScanResult &res, const WiFiAP &config) {
+  WiFiAP connect_params;
+  if (config.get_hidden()) {
+    // selected network is hidden, we use the data from the config
+    connect_params.set_hidden(true);
+    connect_params.set_ssid(config.get_ssid());
+    // don't set BSSID and channel, there might be multiple hidden networks
+    // but we can't know which one is the correct one. Rely on probe-req with just SSID.
+  } else {
+    // selected network is visible, we use the data from the scan
+    // limit the connect params to only connect to exactly this network
+    // (network selection is done during scan phase).
+    connect_params.set_hidden(false);
+    connect_params.set_ssid(res.get_ssid());
+    connect_params.set_channel(res.get_channel());
+    connect_params.set_bssid(res.get_bssid());
+  }
+  // copy manual IP (if set)
+  connect_params.set_manual_ip(config.get_manual_ip());
 
 #ifdef USE_WIFI_WPA2_EAP
-    // copy EAP parameters (if set)
-    connect_params.set_eap(config.get_eap());
+  // copy EAP parameters (if set)
+  connect_params.set_eap(config.get_eap());
 #endif
 
-    // copy password (if set)
-    connect_params.set_password(config.get_password());
+  // copy password (if set)
+  connect_params.set_password(config.get_password());
+  return connect_params;
+}
 
-    break;
+#ifdef USE_WIFI_ROAMING
+void WiFiComponent::check_roaming_(uint32_t now) {
+  if (!this->roaming_scan_) {
+    if (now - this->last_roaming_check_ < this->roaming_interval_)
+      return;
+    this->last_roaming_check_ = now;
+    int8_t rssi = this->wifi_rssi();
+    if (rssi >= this->roaming_threshold_)
+      return;
+    ESP_LOGD(TAG, "Signal weak (%d dB); scanning for a better access point", rssi);
+    // scanning while connected only leaves the channel briefly, the connection stays up
+    this->roaming_scan_ = this->wifi_scan_start_(this->passive_scan_);
+    return;
   }
+  if (!this->scan_done_) {
+    if (now - this->last_roaming_check_ > 30000) {
+      ESP_LOGW(TAG, "Roaming scan timeout");
+      this->roaming_scan_ = false;
+    }
+    return;
+  }
+  this->scan_done_ = false;
+  this->roaming_scan_ = false;
 
-  yield();
-
-  this->selected_ap_ = connect_params;
-  this->start_connecting(connect_params, false);
+  // only visible networks can be told apart by BSSID
+  const bssid_t current_bssid = this->wifi_bssid();
+  WiFiScanResult *best = nullptr;
+  const WiFiAP *best_config = nullptr;
+  for (auto &res : this->scan_result_) {
+    if (res.get_bssid() == current_bssid || (best != nullptr && res.get_rssi() <= best->get_rssi()))
+      continue;
+    for (auto &config : this->sta_) {
+      if (!config.get_hidden() && res.matches(config)) {
+        best = &res;
+        best_config = &config;
+        break;
+      }
+    }
+  }
+  int8_t rssi = this->wifi_rssi();
+  if (best == nullptr || best->get_rssi() < rssi + this->roaming_hysteresis_) {
+    ESP_LOGD(TAG, "No better access point found");
+    return;
+  }
+  ESP_LOGI(TAG, "Roaming to " LOG_SECRET("%s") " on channel %u (%d dB, currently %d dB)",
+           format_mac_address_pretty(best->get_bssid().data()).c_str(), best->get_channel(), best->get_rssi(), rssi);
+  this->selected_ap_ = this->build_connect_params_(*best, *best_config);
+  this->start_connecting(this->selected_ap_, false);
 }
+#endif
+
 
 void WiFiComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "WiFi:");
@@ -697,6 +762,10 @@ void WiFiComponent::check_connecting_finished() {
 
     this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTED;
     this->num_retried_ = 0;
+#ifdef USE_BOOT_TIMELINE
+    if (global_boot_timeline != nullptr)
+      global_boot_timeline->record_once(boot_timeline::BOOT_EVENT_NETWORK_CONNECTED);
+#endif
 
     if (this->fast_connect_) {
       this->save_fast_connect_settings_();
@@ -250,6 +250,19 @@ class WiFiComponent : public Component {
 
   void set_passive_scan(bool passive);
 
+#ifdef USE_WIFI_ROAMING
+  /** Look for a better access point of the configured networks while connected.
+   *
+   * Every interval the signal strength is checked. When it is below the threshold, the networks are scanned and the
+   * device moves to the strongest matching access point if it is at least hysteresis dB stronger than the current one.
+   */
+  void set_roaming(int8_t threshold, uint32_t interval, uint8_t hysteresis) {
+    this->roaming_threshold_ = threshold;
+    this->roaming_interval_ = interval;
+    this->roaming_hysteresis_ = hysteresis;
+  }
+#endif
+
   void save_wifi_sta(const std::string &ssid, const std::string &password);
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -357,6 +370,11 @@ class WiFiComponent : public Component {
 
   bool load_fast_connect_settings_();
   void save_fast_connect_settings_();
+  /// Returns the parameters to connect to the network of a scan result with the matching configuration.
+  WiFiAP build_connect_params_(const WiFiScanResult &res, const WiFiAP &config);
+#ifdef USE_WIFI_ROAMING
+  void check_roaming_(uint32_t now);
+#endif
 
 #ifdef USE_ESP8266
   static void wifi_event_callback(System_Event_t *event);
@@ -397,12 +415,20 @@ class WiFiComponent : public Component {
   uint32_t last_connected_{0};
   uint32_t reboot_timeout_{};
   uint32_t ap_timeout_{};
+#ifdef USE_WIFI_ROAMING
+  uint32_t roaming_interval_{};
+  uint32_t last_roaming_check_{0};
+#endif
 
   // Group all 8-bit values together
   WiFiComponentState state_{WIFI_COMPONENT_STATE_OFF};
   WiFiPowerSaveMode power_save_{WIFI_POWER_SAVE_NONE};
   uint8_t num_retried_{0};
   uint8_t ap_index_{0};
+#ifdef USE_WIFI_ROAMING
+  int8_t roaming_threshold_{};
+  uint8_t roaming_hysteresis_{};
+#endif
 #if USE_NETWORK_IPV6
   uint8_t num_ipv6_addresses_{0};
 #endif /* USE_NETWORK_IPV6 */
@@ -418,6 +444,9 @@ class WiFiComponent : public Component {
   bool ap_setup_{false};
   bool passive_scan_{false};
   bool has_saved_wifi_settings_{false};
+#ifdef USE_WIFI_ROAMING
+  bool roaming_scan_{false};
+#endif
 #ifdef USE_WIFI_11KV_SUPPORT
   bool btm_{false};
   bool rrm_{false};
@@ -4,6 +4,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #ifdef USE_ESP32
 #include <WiFi.h>
 #endif
@@ -67,16 +69,15 @@ void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_co
     }
   }
 
-  std::vector<uint8_t> payload;
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
+    this->payload_.resize(packet_size);
 
-    if (!udp_->read(&payload[0], payload.size())) {
+    if (!udp_->read(&this->payload_[0], packet_size)) {
       continue;
     }
 
-    if (!this->parse_frame_(it, &payload[0], payload.size())) {
-      ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload.size(), payload[0]);
+    if (!this->parse_frame_(it, &this->payload_[0], packet_size)) {
+      ESP_LOGD(TAG, "Frame: Invalid (size=%u, first=0x%02X).", packet_size, this->payload_[0]);
       continue;
     }
   }
@@ -211,17 +212,11 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
+  // LEDs beyond the strip are ignored
+  int count = std::min<int>(size / 3, it.size());
 
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
+  for (int led = 0; led < count; ++led, payload += 3) {
+    it[led].set(Color(payload[0], payload[1], payload[2]));
   }
 
   return true;
@@ -233,18 +228,11 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 4;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
+  // LEDs beyond the strip are ignored
+  int count = std::min<int>(size / 4, it.size());
 
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
-    }
+  for (int led = 0; led < count; ++led, payload += 4) {
+    it[led].set(Color(payload[0], payload[1], payload[2], payload[3]));
   }
 
   return true;
@@ -265,17 +253,11 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
+  // LEDs beyond the strip are ignored, also when the offset itself is past its end
+  int count = std::min<int>(size / 3, std::max<int>(it.size() - led, 0));
 
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
+  for (int i = 0; i < count; i++, payload += 3) {
+    it[led + i].set(Color(payload[0], payload[1], payload[2]));
   }
 
   return true;
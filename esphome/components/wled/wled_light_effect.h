@@ -35,6 +35,7 @@ class WLEDLightEffect : public light::AddressableLightEffect {
 
   uint16_t port_{0};
   std::unique_ptr<UDP> udp_;
+  std::vector<uint8_t> payload_;  // kept between packets, so a stream of frames doesn't allocate
   uint32_t blank_at_{0};
   uint32_t dropped_{0};
   uint8_t sync_group_mask_{0};
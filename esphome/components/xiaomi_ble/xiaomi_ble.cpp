@@ -5,7 +5,6 @@
 #ifdef USE_ESP32
 
 #include <vector>
-#include "mbedtls/ccm.h"
 
 namespace esphome {
 namespace xiaomi_ble {
@@ -261,11 +260,30 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
 }
 
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address) {
+  XiaomiDecryptor decryptor;
+  decryptor.set_bindkey(bindkey);
+  return decryptor.decrypt(raw, address);
+}
+
+void XiaomiDecryptor::set_bindkey(const uint8_t *bindkey) {
+  this->has_key_ = mbedtls_ccm_setkey(&this->ctx_, MBEDTLS_CIPHER_ID_AES, bindkey, 128) == 0;
+  this->has_frame_ = false;
+  if (!this->has_key_)
+    ESP_LOGVV(TAG, "XiaomiDecryptor::set_bindkey(): mbedtls_ccm_setkey() failed.");
+}
+
+bool XiaomiDecryptor::decrypt(std::vector<uint8_t> &raw, uint64_t address) {
   if ((raw.size() != 19) && ((raw.size() < 22) || (raw.size() > 24))) {
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", raw.size());
     ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
     return false;
   }
+  if (!this->has_key_)
+    return false;
+  if (this->has_frame_ && this->last_frame_ == raw[4]) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): frame %d was already decrypted.", static_cast<int>(raw[4]));
+    return false;
+  }
 
   uint8_t mac_reverse[6] = {0};
   mac_reverse[5] = (uint8_t) (address >> 40);
@@ -292,25 +310,14 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
 
   const uint8_t *v = raw.data();
 
-  memcpy(vector.key, bindkey, vector.keysize);
   memcpy(vector.ciphertext, v + cipher_pos, vector.datasize);
   memcpy(vector.tag, v + raw.size() - vector.tagsize, vector.tagsize);
   memcpy(vector.iv, mac_reverse, 6);             // MAC address reverse
   memcpy(vector.iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
   memcpy(vector.iv + 9, v + raw.size() - 7, 3);  // payload counter
 
-  mbedtls_ccm_context ctx;
-  mbedtls_ccm_init(&ctx);
-
-  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, vector.key, vector.keysize * 8);
-  if (ret) {
-    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
-    mbedtls_ccm_free(&ctx);
-    return false;
-  }
-
-  ret = mbedtls_ccm_auth_decrypt(&ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
-                                 vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
+  int ret = mbedtls_ccm_auth_decrypt(&this->ctx_, vector.datasize, vector.iv, vector.ivsize, vector.authdata,
+                                     vector.authsize, vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
   if (ret) {
     uint8_t mac_address[6] = {0};
     memcpy(mac_address, mac_reverse + 5, 1);
@@ -322,13 +329,13 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption failed.");
     ESP_LOGVV(TAG, "  MAC address : %s", format_mac_address_pretty(mac_address).c_str());
     ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
-    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(vector.key, vector.keysize).c_str());
     ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(vector.iv, vector.ivsize).c_str());
     ESP_LOGVV(TAG, "       Cipher : %s", format_hex_pretty(vector.ciphertext, vector.datasize).c_str());
     ESP_LOGVV(TAG, "          Tag : %s", format_hex_pretty(vector.tag, vector.tagsize).c_str());
-    mbedtls_ccm_free(&ctx);
     return false;
   }
+  this->has_frame_ = true;
+  this->last_frame_ = raw[4];
 
   // replace encrypted payload with plaintext
   uint8_t *p = vector.plaintext;
@@ -344,7 +351,6 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
   ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw.data() + cipher_pos, vector.datasize).c_str(),
             static_cast<int>(raw[4]));
 
-  mbedtls_ccm_free(&ctx);
   return true;
 }
 
@@ -7,6 +7,8 @@
 
 #ifdef USE_ESP32
 
+#include "mbedtls/ccm.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -71,6 +73,30 @@ bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_
 bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result);
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data);
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
+
+/** Decrypts the MiBeacon payloads of one device.
+ *
+ * The AES key schedule of the bindkey is set up once instead of for every advertisement, and a packet carrying the
+ * frame counter of the last one accepted is not decrypted again. mbedtls uses the AES peripheral of the ESP32 for the
+ * block cipher where the chip has one.
+ */
+class XiaomiDecryptor {
+ public:
+  XiaomiDecryptor() { mbedtls_ccm_init(&this->ctx_); }
+  ~XiaomiDecryptor() { mbedtls_ccm_free(&this->ctx_); }
+  XiaomiDecryptor(const XiaomiDecryptor &) = delete;
+  XiaomiDecryptor &operator=(const XiaomiDecryptor &) = delete;
+
+  void set_bindkey(const uint8_t *bindkey);
+  /// Decrypt the payload in place, returns false if it fails authentication or repeats the last packet.
+  bool decrypt(std::vector<uint8_t> &raw, uint64_t address);
+
+ protected:
+  mbedtls_ccm_context ctx_;
+  bool has_key_{false};
+  bool has_frame_{false};
+  uint8_t last_frame_{0};
+};
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
@@ -35,8 +35,7 @@ bool XiaomiCGG1::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
       continue;
     }
     if (res->has_encryption &&
-        (!(xiaomi_ble::decrypt_xiaomi_payload(const_cast<std::vector<uint8_t> &>(service_data.data), this->bindkey_,
-                                              this->address_)))) {
+        !this->decryptor_.decrypt(const_cast<std::vector<uint8_t> &>(service_data.data), this->address_)) {
       continue;
     }
     if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
@@ -67,6 +66,7 @@ void XiaomiCGG1::set_bindkey(const std::string &bindkey) {
     strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
     bindkey_[i] = std::strtoul(temp, nullptr, 16);
   }
+  this->decryptor_.set_bindkey(this->bindkey_);
 }
 
 }  // namespace xiaomi_cgg1
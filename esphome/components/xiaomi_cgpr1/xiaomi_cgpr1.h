@@ -16,6 +16,7 @@ class XiaomiCGPR1 : public Component,
                     public esp32_ble_tracker::ESPBTDeviceListener {
  public:
   void set_address(uint64_t address) { address_ = address; }
+  uint64_t get_address_filter() const override { return this->address_; }
   void set_bindkey(const std::string &bindkey);
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
@@ -28,6 +29,7 @@ class XiaomiCGPR1 : public Component,
  protected:
   uint64_t address_;
   uint8_t bindkey_[16];
+  xiaomi_ble::XiaomiDecryptor decryptor_;
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
   sensor::Sensor *illuminance_{nullptr};
@@ -13,6 +13,7 @@ namespace xiaomi_gcls002 {
 class XiaomiGCLS002 : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
  public:
   void set_address(uint64_t address) { address_ = address; }
+  uint64_t get_address_filter() const override { return this->address_; }
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
@@ -3,6 +3,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace zwave_proxy {
 
@@ -12,6 +14,7 @@ static constexpr uint8_t ZWAVE_COMMAND_GET_NETWORK_IDS = 0x20;
 // GET_NETWORK_IDS response: [SOF][LENGTH][TYPE][CMD][HOME_ID(4)][NODE_ID][...]
 static constexpr uint8_t ZWAVE_COMMAND_TYPE_RESPONSE = 0x01;    // Response type field value
 static constexpr uint8_t ZWAVE_MIN_GET_NETWORK_IDS_LENGTH = 9;  // TYPE + CMD + HOME_ID(4) + NODE_ID + checksum
+static constexpr size_t ZWAVE_READ_CHUNK_SIZE = 64;
 
 static uint8_t calculate_frame_checksum(const uint8_t *data, uint8_t length) {
   // Calculate Z-Wave frame checksum
@@ -37,45 +40,55 @@ void ZWaveProxy::loop() {
     this->api_connection_ = nullptr;  // Unsubscribe if disconnected
   }
 
-  while (this->available()) {
-    uint8_t byte;
-    if (!this->read_byte(&byte)) {
+  // Read in chunks, a firmware update or network inclusion can keep the UART busy
+  uint8_t chunk[ZWAVE_READ_CHUNK_SIZE];
+  size_t avail;
+  while ((avail = this->available()) > 0) {
+    const size_t len = std::min(avail, sizeof(chunk));
+    if (!this->read_array(chunk, len)) {
       this->status_set_warning("UART read failed");
       return;
     }
-    if (this->parse_byte_(byte)) {
-      // Check if this is a GET_NETWORK_IDS response frame
-      // Frame format: [SOF][LENGTH][TYPE][CMD][HOME_ID(4)][NODE_ID][...]
-      // We verify:
-      // - buffer_[0]: Start of frame marker (0x01)
-      // - buffer_[1]: Length field must be >= 9 to contain all required data
-      // - buffer_[2]: Command type (0x01 for response)
-      // - buffer_[3]: Command ID (0x20 for GET_NETWORK_IDS)
-      if (this->buffer_[3] == ZWAVE_COMMAND_GET_NETWORK_IDS && this->buffer_[2] == ZWAVE_COMMAND_TYPE_RESPONSE &&
-          this->buffer_[1] >= ZWAVE_MIN_GET_NETWORK_IDS_LENGTH && this->buffer_[0] == ZWAVE_FRAME_TYPE_START) {
-        // Extract the 4-byte Home ID starting at offset 4
-        // The frame parser has already validated the checksum and ensured all bytes are present
-        std::memcpy(this->home_id_.data(), this->buffer_.data() + 4, this->home_id_.size());
-        ESP_LOGI(TAG, "Home ID: %s",
-                 format_hex_pretty(this->home_id_.data(), this->home_id_.size(), ':', false).c_str());
-      }
-      ESP_LOGV(TAG, "Sending to client: %s", YESNO(this->api_connection_ != nullptr));
-      if (this->api_connection_ != nullptr) {
-        // minimize copying to reduce CPU overhead
-        if (this->in_bootloader_) {
-          this->outgoing_proto_msg_.data_len = this->buffer_index_;
-        } else {
-          // If this is a data frame, use frame length indicator + 2 (for SoF + checksum), else assume 1 for ACK/NAK/CAN
-          this->outgoing_proto_msg_.data_len = this->buffer_[0] == ZWAVE_FRAME_TYPE_START ? this->buffer_[1] + 2 : 1;
-        }
-        std::memcpy(this->outgoing_proto_msg_.data, this->buffer_.data(), this->outgoing_proto_msg_.data_len);
-        this->api_connection_->send_message(this->outgoing_proto_msg_, api::ZWaveProxyFrame::MESSAGE_TYPE);
+    for (size_t i = 0; i < len; i++) {
+      if (this->parsing_state_ == ZWAVE_PARSING_STATE_WAIT_PAYLOAD) {
+        i += this->parse_payload_(chunk + i, len - i) - 1;
+      } else if (this->parse_byte_(chunk[i])) {
+        this->handle_frame_();
       }
     }
   }
   this->status_clear_warning();
 }
 
+void ZWaveProxy::handle_frame_() {
+  // Check if this is a GET_NETWORK_IDS response frame
+  // Frame format: [SOF][LENGTH][TYPE][CMD][HOME_ID(4)][NODE_ID][...]
+  // We verify:
+  // - buffer_[0]: Start of frame marker (0x01)
+  // - buffer_[1]: Length field must be >= 9 to contain all required data
+  // - buffer_[2]: Command type (0x01 for response)
+  // - buffer_[3]: Command ID (0x20 for GET_NETWORK_IDS)
+  if (this->buffer_[3] == ZWAVE_COMMAND_GET_NETWORK_IDS && this->buffer_[2] == ZWAVE_COMMAND_TYPE_RESPONSE &&
+      this->buffer_[1] >= ZWAVE_MIN_GET_NETWORK_IDS_LENGTH && this->buffer_[0] == ZWAVE_FRAME_TYPE_START) {
+    // Extract the 4-byte Home ID starting at offset 4
+    // The frame parser has already validated the checksum and ensured all bytes are present
+    std::memcpy(this->home_id_.data(), this->buffer_.data() + 4, this->home_id_.size());
+    ESP_LOGI(TAG, "Home ID: %s", format_hex_pretty(this->home_id_.data(), this->home_id_.size(), ':', false).c_str());
+  }
+  ESP_LOGV(TAG, "Sending to client: %s", YESNO(this->api_connection_ != nullptr));
+  if (this->api_connection_ != nullptr) {
+    // minimize copying to reduce CPU overhead
+    if (this->in_bootloader_) {
+      this->outgoing_proto_msg_.data_len = this->buffer_index_;
+    } else {
+      // If this is a data frame, use frame length indicator + 2 (for SoF + checksum), else assume 1 for ACK/NAK/CAN
+      this->outgoing_proto_msg_.data_len = this->buffer_[0] == ZWAVE_FRAME_TYPE_START ? this->buffer_[1] + 2 : 1;
+    }
+    std::memcpy(this->outgoing_proto_msg_.data, this->buffer_.data(), this->outgoing_proto_msg_.data_len);
+    this->api_connection_->send_message(this->outgoing_proto_msg_, api::ZWaveProxyFrame::MESSAGE_TYPE);
+  }
+}
+
 void ZWaveProxy::dump_config() { ESP_LOGCONFIG(TAG, "Z-Wave Proxy"); }
 
 void ZWaveProxy::zwave_proxy_request(api::APIConnection *api_connection, api::enums::ZWaveProxyRequestType type) {
@@ -188,6 +201,20 @@ bool ZWaveProxy::parse_byte_(uint8_t byte) {
   return frame_completed;
 }
 
+size_t ZWaveProxy::parse_payload_(const uint8_t *data, size_t len) {
+  // Same as parse_byte_() in ZWAVE_PARSING_STATE_WAIT_PAYLOAD, for as many payload bytes as are at hand:
+  // at least one byte is taken, then everything up to the checksum
+  size_t count = this->end_frame_after_ > this->buffer_index_ ? this->end_frame_after_ - this->buffer_index_ : 1;
+  count = std::min(count, len);
+  std::memcpy(this->buffer_.data() + this->buffer_index_, data, count);
+  this->buffer_index_ += count;
+  ESP_LOGVV(TAG, "Received PAYLOAD: %s", format_hex_pretty(data, count).c_str());
+  if (this->buffer_index_ >= this->end_frame_after_) {
+    this->parsing_state_ = ZWAVE_PARSING_STATE_WAIT_CHECKSUM;
+  }
+  return count;
+}
+
 void ZWaveProxy::parse_start_(uint8_t byte) {
   this->buffer_index_ = 0;
   this->parsing_state_ = ZWAVE_PARSING_STATE_WAIT_START;
@@ -58,6 +58,8 @@ class ZWaveProxy : public uart::UARTDevice, public Component {
  protected:
   void send_simple_command_(uint8_t command_id);
   bool parse_byte_(uint8_t byte);  // Returns true if frame parsing was completed (a frame is ready in the buffer)
+  size_t parse_payload_(const uint8_t *data, size_t len);  // Returns the number of payload bytes consumed
+  void handle_frame_();
   void parse_start_(uint8_t byte);
   bool response_handler_();
 
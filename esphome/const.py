@@ -222,6 +222,7 @@ CONF_COMPENSATION = "compensation"
 CONF_COMPILE_PROCESS_LIMIT = "compile_process_limit"
 CONF_COMPONENT_ID = "component_id"
 CONF_COMPONENTS = "components"
+CONF_CONCURRENT_SETUP = "concurrent_setup"
 CONF_CONDITION = "condition"
 CONF_CONDITION_ID = "condition_id"
 CONF_CONDUCTIVITY = "conductivity"
@@ -552,6 +553,7 @@ CONF_MAX_POWER = "max_power"
 CONF_MAX_RANGE = "max_range"
 CONF_MAX_REFRESH_RATE = "max_refresh_rate"
 CONF_MAX_SPEED = "max_speed"
+CONF_MAX_STATE_INTERVAL = "max_state_interval"
 CONF_MAX_TEMPERATURE = "max_temperature"
 CONF_MAX_VALUE = "max_value"
 CONF_MAX_VOLTAGE = "max_voltage"
@@ -582,6 +584,8 @@ CONF_MIN_LEVEL = "min_level"
 CONF_MIN_POWER = "min_power"
 CONF_MIN_RANGE = "min_range"
 CONF_MIN_RSSI = "min_rssi"
+CONF_MIN_STATE_DELTA = "min_state_delta"
+CONF_MIN_STATE_INTERVAL = "min_state_interval"
 CONF_MIN_TEMPERATURE = "min_temperature"
 CONF_MIN_VALUE = "min_value"
 CONF_MIN_VERSION = "min_version"
@@ -846,6 +850,7 @@ CONF_SAMSUNG = "samsung"
 CONF_SATELLITES = "satellites"
 CONF_SCAN = "scan"
 CONF_SCAN_RESULTS = "scan_results"
+CONF_SCHEDULER_BACKEND = "scheduler_backend"
 CONF_SCL = "scl"
 CONF_SCL_PIN = "scl_pin"
 CONF_SDA = "sda"
@@ -870,6 +875,7 @@ CONF_SERVICE_UUID = "service_uuid"
 CONF_SERVICES = "services"
 CONF_SET_ACTION = "set_action"
 CONF_SET_POINT_MINIMUM_DIFFERENTIAL = "set_point_minimum_differential"
+CONF_SETUP_ARENA = "setup_arena"
 CONF_SETUP_MODE = "setup_mode"
 CONF_SETUP_PRIORITY = "setup_priority"
 CONF_SHOW_LINES = "show_lines"
@@ -968,6 +974,7 @@ CONF_THEN = "then"
 CONF_THERMOCOUPLE_TYPE = "thermocouple_type"
 CONF_THRESHOLD = "threshold"
 CONF_THROTTLE = "throttle"
+CONF_TICKLESS_IDLE = "tickless_idle"
 CONF_TILT = "tilt"
 CONF_TILT_ACTION = "tilt_action"
 CONF_TILT_COMMAND_TOPIC = "tilt_command_topic"
@@ -1327,6 +1334,7 @@ KEY_FRAMEWORK_VERSION = "framework_version"
 KEY_NAME = "name"
 KEY_VARIANT = "variant"
 KEY_PAST_SAFE_MODE = "past_safe_mode"
+KEY_SETUP_ARENA = "setup_arena"
 
 # Entity categories
 ENTITY_CATEGORY_NONE = ""
@@ -1,4 +1,5 @@
 #include "esphome/core/application.h"
+#include "esphome/core/arena.h"
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
@@ -7,10 +8,16 @@
 #ifdef USE_RUNTIME_STATS
 #include "esphome/components/runtime_stats/runtime_stats.h"
 #endif
+#ifdef USE_BOOT_TIMELINE
+#include "esphome/components/boot_timeline/boot_timeline.h"
+#endif
 
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+#include "esphome/components/socket/socket.h"
+#endif
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
 #include <cerrno>
@@ -26,6 +33,9 @@
 #else
 // True BSD sockets (e.g., host platform)
 #include <sys/select.h>
+#ifdef USE_SOCKET_SELECT_EPOLL
+#include <sys/epoll.h>
+#endif
 #endif
 #endif
 #endif
@@ -34,6 +44,13 @@ namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef ESPHOME_TICKLESS_IDLE
+// Longest sleep of the tickless idle loop. Scheduler items added from other threads wake the loop through the wake
+// socket, this only bounds the latency of enable_loop_soon_any_context() from ISRs (and of everything on platforms
+// without select() support) and keeps the WDT fed.
+static constexpr uint32_t TICKLESS_IDLE_MAX_SLEEP_MS = 1000;
+#endif
+
 // Helper function for insertion sort of components by priority
 // Using insertion sort instead of std::stable_sort saves ~1.3KB of flash
 // by avoiding template instantiations (std::rotate, std::stable_sort, lambdas)
@@ -80,6 +97,9 @@ void Application::setup() {
   // Initialize looping_components_ early so enable_pending_loops_() works during setup
   this->calculate_looping_components_();
 
+#ifdef ESPHOME_CONCURRENT_SETUP
+  this->setup_concurrent_();
+#else
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
 
@@ -116,19 +136,138 @@ void Application::setup() {
       yield();
     } while (!component->can_proceed());
   }
+#endif
 
   ESP_LOGI(TAG, "setup() finished successfully!");
+#ifdef USE_BOOT_TIMELINE
+  if (global_boot_timeline != nullptr)
+    global_boot_timeline->record(boot_timeline::BOOT_EVENT_SETUP_COMPLETE);
+#endif
 
   // Clear setup priority overrides to free memory
   clear_setup_priority_overrides();
+#ifdef ESPHOME_SETUP_ARENA
+  global_arena.seal();
+#endif
 
   this->schedule_dump_config();
 }
+#ifdef ESPHOME_CONCURRENT_SETUP
+void Application::setup_concurrent_() {
+  // Like the sequential setup, but a component that is not ready yet only holds back the components that depend on
+  // it (as registered with add_setup_dependency()) instead of everything after it:
+  // - Components are started in priority order as soon as all their dependencies can proceed.
+  // - Components at or below WIFI priority (network, API, OTA, ...) keep the strict sequential order, they only start
+  //   once everything before them is ready.
+  // - Components between HARDWARE and WIFI priority that nothing depends on (displays, sensors, ...) are deferred
+  //   until all other components above WIFI priority are ready, and are then started one per loop round so that the
+  //   network and API keep being serviced in between. They never wait for the network, which may not connect at all.
+  enum : uint8_t { SETUP_WAITING, SETUP_STARTED, SETUP_READY };
+  const size_t count = this->components_.size();
+  std::vector<uint8_t> state(count, SETUP_WAITING);
+  std::vector<bool> deferred(count, false);
+  std::vector<bool> in_order(count, false);
+
+  // (component, dependency) as indices into components_
+  std::vector<std::pair<uint16_t, uint16_t>> edges;
+  std::vector<bool> depended_on(count, false);
+  auto index_of = [this](Component *c) {
+    return static_cast<size_t>(std::find(this->components_.begin(), this->components_.end(), c) -
+                               this->components_.begin());
+  };
+  for (const auto &dep : this->setup_dependencies_) {
+    const size_t component = index_of(dep.first);
+    const size_t dependency = index_of(dep.second);
+    if (component >= count || dependency >= count)
+      continue;
+    depended_on[dependency] = true;
+    // A dependency that sorts after the component is set up after it anyway, keeping the priority order also
+    // rules out dependency cycles
+    if (dependency < component)
+      edges.emplace_back(component, dependency);
+  }
+  this->setup_dependencies_.clear();
+  this->setup_dependencies_.shrink_to_fit();
+
+  size_t required = 0;
+  for (size_t i = 0; i < count; i++) {
+    const float priority = this->components_[i]->get_actual_setup_priority();
+    in_order[i] = priority <= setup_priority::WIFI;
+    deferred[i] = !depended_on[i] && priority < setup_priority::HARDWARE && priority > setup_priority::WIFI;
+    if (!deferred[i] && !in_order[i])
+      required++;
+  }
+
+  size_t remaining = count;
+  while (true) {
+    bool blocked = false;
+    bool deferred_started = false;
+    for (size_t i = 0; i < count; i++) {
+      if (state[i] == SETUP_WAITING) {
+        bool can_start = std::none_of(edges.begin(), edges.end(), [&state, i](const std::pair<uint16_t, uint16_t> &e) {
+          return e.first == i && state[e.second] != SETUP_READY;
+        });
+        if (deferred[i]) {
+          can_start = can_start && required == 0 && !deferred_started;
+        } else if (in_order[i]) {
+          can_start = can_start && !blocked;
+        }
+        if (can_start) {
+          if (deferred[i]) {
+            ESP_LOGV(TAG, "Deferred setup of %s", LOG_STR_ARG(this->components_[i]->get_component_log_str()));
+            deferred_started = true;
+          }
+          // Update loop_component_start_time_ before calling each component during setup
+          this->loop_component_start_time_ = millis();
+          this->components_[i]->call();
+          this->scheduler.process_to_add();
+          this->feed_wdt();
+          state[i] = SETUP_STARTED;
+        }
+      }
+      if (state[i] == SETUP_STARTED && this->components_[i]->can_proceed()) {
+        state[i] = SETUP_READY;
+        remaining--;
+        if (!deferred[i] && !in_order[i])
+          required--;
+      }
+      if (state[i] != SETUP_READY && !deferred[i])
+        blocked = true;
+    }
+    if (remaining == 0)
+      break;
+
+    // Loop all started components until the pending ones can proceed
+    uint8_t new_app_state = STATUS_LED_WARNING;
+    uint32_t now = millis();
+
+    // Process pending loop enables to handle GPIO interrupts during setup
+    this->before_loop_tasks_(now);
+
+    for (size_t i = 0; i < count; i++) {
+      if (state[i] == SETUP_WAITING)
+        continue;
+      // Update loop_component_start_time_ right before calling each component
+      this->loop_component_start_time_ = millis();
+      this->components_[i]->call();
+      new_app_state |= this->components_[i]->get_component_state();
+      this->app_state_ |= new_app_state;
+      this->feed_wdt();
+    }
+
+    this->after_loop_tasks_();
+    this->app_state_ = new_app_state;
+    yield();
+  }
+}
+#endif
+
 void Application::loop() {
   uint8_t new_app_state = 0;
 
   // Get the initial loop time at the start
   uint32_t last_op_end_time = millis();
+  this->loop_count_++;
 
   this->before_loop_tasks_(last_op_end_time);
 
@@ -142,7 +281,14 @@ void Application::loop() {
     {
       this->set_current_component(component);
       WarnIfComponentBlockingGuard guard{component, last_op_end_time};
+#ifdef USE_RUNTIME_STATS
+      const uint32_t start_us = micros();
+#endif
       component->call();
+#ifdef USE_RUNTIME_STATS
+      if (global_runtime_stats != nullptr)
+        global_runtime_stats->record_latency(component, runtime_stats::SOURCE_LOOP, micros() - start_us);
+#endif
       // Use the finish method to get the current time as the end time
       last_op_end_time = guard.finish();
     }
@@ -164,7 +310,16 @@ void Application::loop() {
 
   // Use the last component's end time instead of calling millis() again
   auto elapsed = last_op_end_time - this->last_loop_;
-  if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
+#ifdef ESPHOME_TICKLESS_IDLE
+  const bool idle = this->is_idle_();
+#else
+  constexpr bool idle = false;
+#endif
+  if (idle) {
+#ifdef ESPHOME_TICKLESS_IDLE
+    this->tickless_sleep_(last_op_end_time);
+#endif
+  } else if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
     // Even if we overran the loop interval, we still need to select()
     // to know if any sockets have data ready
     this->yield_with_select_(0);
@@ -508,6 +663,29 @@ bool Application::register_socket_fd(int fd) {
   if (fd < 0)
     return false;
 
+#ifdef USE_SOCKET_SELECT_EPOLL
+  if (this->epoll_fd_ < 0) {
+    this->epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (this->epoll_fd_ < 0) {
+      ESP_LOGE(TAG, "epoll_create1() failed with errno %d", errno);
+      return false;
+    }
+  }
+  struct epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(this->epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+    ESP_LOGE(TAG, "epoll_ctl() failed for fd %d with errno %d", fd, errno);
+    return false;
+  }
+  if (static_cast<size_t>(fd) >= this->socket_ready_.size())
+    this->socket_ready_.resize(fd + 1, 0);
+
+  this->socket_fds_.push_back(fd);
+  // Room for every socket to be reported by a single epoll_wait()
+  if (this->epoll_events_.size() < this->socket_fds_.size())
+    this->epoll_events_.resize(this->socket_fds_.size());
+#else
 #ifndef USE_ESP32
   // Only check on non-ESP32 platforms
   // On ESP32 (both Arduino and ESP-IDF), CONFIG_LWIP_MAX_SOCKETS is always <= FD_SETSIZE by design
@@ -525,6 +703,7 @@ bool Application::register_socket_fd(int fd) {
   if (fd > this->max_fd_) {
     this->max_fd_ = fd;
   }
+#endif
 
   return true;
 }
@@ -543,6 +722,11 @@ void Application::unregister_socket_fd(int fd) {
     if (i < this->socket_fds_.size() - 1)
       this->socket_fds_[i] = this->socket_fds_.back();
     this->socket_fds_.pop_back();
+#ifdef USE_SOCKET_SELECT_EPOLL
+    // Called before the socket is closed, the fd may be reused right after
+    epoll_ctl(this->epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    this->socket_ready_[fd] = 0;
+#else
     this->socket_fds_changed_ = true;
 
     // Only recalculate max_fd if we removed the current max
@@ -553,6 +737,7 @@ void Application::unregister_socket_fd(int fd) {
           this->max_fd_ = sock_fd;
       }
     }
+#endif
     return;
   }
 }
@@ -560,19 +745,95 @@ void Application::unregister_socket_fd(int fd) {
 bool Application::is_socket_ready(int fd) const {
   // This function is thread-safe for reading the result of select()
   // However, it should only be called after select() has been executed in the main loop
-  // The read_fds_ is only modified by select() in the main loop
+  // The readiness state is only modified by select()/epoll_wait() in the main loop
+#ifdef USE_SOCKET_SELECT_EPOLL
+  return fd >= 0 && static_cast<size_t>(fd) < this->socket_ready_.size() && this->socket_ready_[fd] != 0;
+#else
   if (fd < 0 || fd >= FD_SETSIZE)
     return false;
 
   return FD_ISSET(fd, &this->read_fds_);
+#endif
 }
 #endif
 
+#ifdef ESPHOME_TICKLESS_IDLE
+void Application::tickless_sleep_(uint32_t now) {
+  // No component needs loop(), sleep until the next scheduler item is due or a socket becomes readable
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (!this->wake_socket_setup_)
+    this->setup_wake_socket_();
+  // Set before the scheduler is checked: an item added from another thread after that check sees the flag and
+  // wakes the select() below, one added before it is found by next_schedule_in()
+  this->tickless_sleeping_ = this->wake_socket_ != nullptr;
+#endif
+  uint32_t delay_time = this->scheduler.next_schedule_in(now).value_or(TICKLESS_IDLE_MAX_SLEEP_MS);
+  this->yield_with_select_(std::min(delay_time, TICKLESS_IDLE_MAX_SLEEP_MS));
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  this->tickless_sleeping_ = false;
+  if (this->wake_socket_ != nullptr && this->wake_socket_->ready()) {
+    uint8_t buf[16];
+    while (this->wake_socket_->read(buf, sizeof(buf)) > 0) {
+    }
+  }
+#endif
+}
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+void Application::setup_wake_socket_() {
+  // Created on the first idle sleep instead of in setup(), the network stack is only up once setup() is done
+  this->wake_socket_setup_ = true;
+  auto sock = socket::socket_loop_monitored(AF_INET, SOCK_DGRAM, 0);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create the wake socket, cross-thread wakeups wait for the idle timeout");
+    return;
+  }
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t addr_len = sizeof(addr);
+  // Bind to an ephemeral loopback port and connect to it, so a plain write() sends to the socket itself
+  if (sock->bind(reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      sock->getsockname(reinterpret_cast<struct sockaddr *>(&addr), &addr_len) != 0 ||
+      sock->connect(reinterpret_cast<struct sockaddr *>(&addr), addr_len) != 0 || sock->setblocking(false) != 0) {
+    ESP_LOGW(TAG, "Could not set up the wake socket, errno %d", errno);
+    return;
+  }
+  // Never freed, the application lives until reboot
+  this->wake_socket_ = sock.release();
+}
+
+void Application::send_wake_() {
+  const uint8_t byte = 1;
+  // A full receive buffer already guarantees a wakeup, so a failed write is fine
+  this->wake_socket_->write(&byte, 1);
+}
+#endif
+#endif
+
 void Application::yield_with_select_(uint32_t delay_ms) {
+#ifdef USE_HOST_VIRTUAL_TIME
+  // Only poll the sockets, then jump the clock ahead instead of waiting. Every loop takes at least 1ms of virtual
+  // time, so time also passes while a component keeps the loop busy.
+  const uint32_t virtual_delay_ms = std::max<uint32_t>(delay_ms, 1);
+  delay_ms = 0;
+#endif
   // Delay while monitoring sockets. When delay_ms is 0, always yield() to ensure other tasks run
   // since select() with 0 timeout only polls without yielding.
 #ifdef USE_SOCKET_SELECT_SUPPORT
   if (!this->socket_fds_.empty()) {
+#ifdef USE_SOCKET_SELECT_EPOLL
+    // Level triggered like select(): a socket that still has unread data is reported again
+    for (int i = 0; i < this->epoll_ready_count_; i++)
+      this->socket_ready_[this->epoll_events_[i].data.fd] = 0;
+
+    int ret = epoll_wait(this->epoll_fd_, this->epoll_events_.data(), static_cast<int>(this->epoll_events_.size()),
+                         static_cast<int>(delay_ms));
+    this->epoll_ready_count_ = ret > 0 ? ret : 0;
+    for (int i = 0; i < this->epoll_ready_count_; i++)
+      this->socket_ready_[this->epoll_events_[i].data.fd] = 1;
+#else
     // Update fd_set if socket list has changed
     if (this->socket_fds_changed_) {
       FD_ZERO(&this->base_read_fds_);
@@ -598,6 +859,7 @@ void Application::yield_with_select_(uint32_t delay_ms) {
 #else
     int ret = ::select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv);
 #endif
+#endif  // USE_SOCKET_SELECT_EPOLL
 
     // Process select() result:
     // ret < 0: error (except EINTR which is normal)
@@ -605,7 +867,7 @@ void Application::yield_with_select_(uint32_t delay_ms) {
     // ret == 0: timeout occurred - normal and expected
     if (ret < 0 && errno != EINTR) {
       // Actual error - log and fall back to delay
-      ESP_LOGW(TAG, "select() failed with errno %d", errno);
+      ESP_LOGW(TAG, "Waiting for sockets failed with errno %d", errno);
       delay(delay_ms);
     }
     // When delay_ms is 0, we need to yield since select(0) doesn't yield
@@ -620,6 +882,9 @@ void Application::yield_with_select_(uint32_t delay_ms) {
   // No select support, use regular delay
   delay(delay_ms);
 #endif
+#ifdef USE_HOST_VIRTUAL_TIME
+  delay(virtual_delay_ms);
+#endif
 }
 
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
@@ -21,6 +22,9 @@
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
 #include <sys/select.h>
+#ifdef USE_SOCKET_SELECT_EPOLL
+#include <sys/epoll.h>
+#endif
 #endif
 
 #ifdef USE_BINARY_SENSOR
@@ -89,12 +93,55 @@
 
 namespace esphome {
 
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+namespace socket {
+class Socket;
+}  // namespace socket
+#endif
+
 // Teardown timeout constant (in milliseconds)
 // For reboots, it's more important to shut down quickly than disconnect cleanly
 // since we're not entering deep sleep. The only consequence of not shutting down
 // cleanly is a warning in the log.
 static const uint32_t TEARDOWN_TIMEOUT_REBOOT_MS = 1000;  // 1 second for quick reboot
 
+/** Entities of one type in registration order, with an index sorted by object ID hash.
+ *
+ * Looking an entity up by key is a binary search over the index instead of a scan over all entities. The index is
+ * built on the first lookup, when all entities are registered.
+ */
+template<typename T, size_t N> class EntityList : public StaticVector<T *, N> {
+ public:
+  /// Returns the first entity with the given key for which \p matches returns true, or nullptr.
+  template<typename F> T *find(uint32_t key, F &&matches) {
+    if (this->indexed_ != this->size())
+      this->build_index_();
+    auto end = this->index_.begin() + this->indexed_;
+    auto it = std::lower_bound(this->index_.begin(), end, key, [this](uint16_t index, uint32_t value) {
+      return (*this)[index]->get_object_id_hash() < value;
+    });
+    // Entities of different devices can share a key
+    for (; it != end && (*this)[*it]->get_object_id_hash() == key; ++it) {
+      if (matches((*this)[*it]))
+        return (*this)[*it];
+    }
+    return nullptr;
+  }
+
+ protected:
+  void build_index_() {
+    this->indexed_ = this->size();
+    for (uint16_t i = 0; i < this->indexed_; i++)
+      this->index_[i] = i;
+    std::sort(this->index_.begin(), this->index_.begin() + this->indexed_, [this](uint16_t a, uint16_t b) {
+      return (*this)[a]->get_object_id_hash() < (*this)[b]->get_object_id_hash();
+    });
+  }
+
+  std::array<uint16_t, N> index_{};
+  size_t indexed_{0};
+};
+
 class Application {
  public:
   void pre_setup(const std::string &name, const std::string &friendly_name, const char *comment,
@@ -220,6 +267,14 @@ class Application {
     return c;
   }
 
+#ifdef ESPHOME_CONCURRENT_SETUP
+  /// Declare that component uses dependency, so its setup() has to wait until dependency can proceed.
+  /// Only used by setup(), the list is freed once setup is complete.
+  void add_setup_dependency(Component *component, Component *dependency) {
+    this->setup_dependencies_.emplace_back(component, dependency);
+  }
+#endif
+
   /// Set up all the registered components. Call this at the end of your setup() function.
   void setup();
 
@@ -255,6 +310,9 @@ class Application {
   /// Get the cached time in milliseconds from when the current component started its loop execution
   inline uint32_t IRAM_ATTR HOT get_loop_component_start_time() const { return this->loop_component_start_time_; }
 
+  /// Number of the current main loop iteration, for work that should run at most once per iteration (wraps around)
+  uint32_t get_loop_count() const { return this->loop_count_; }
+
   /** Set the target interval with which to run the loop() calls.
    * If the loop() method takes longer than the target interval, ESPHome won't
    * sleep in loop(), but if the time spent in loop() is small than the target, ESPHome
@@ -301,22 +359,16 @@ class Application {
 #ifdef USE_DEVICES
 #define GET_ENTITY_METHOD(entity_type, entity_name, entities_member) \
   entity_type *get_##entity_name##_by_key(uint32_t key, uint32_t device_id, bool include_internal = false) { \
-    for (auto *obj : this->entities_member##_) { \
-      if (obj->get_object_id_hash() == key && obj->get_device_id() == device_id && \
-          (include_internal || !obj->is_internal())) \
-        return obj; \
-    } \
-    return nullptr; \
+    return this->entities_member##_.find(key, [device_id, include_internal](entity_type *obj) { \
+      return obj->get_device_id() == device_id && (include_internal || !obj->is_internal()); \
+    }); \
   }
   const auto &get_devices() { return this->devices_; }
 #else
 #define GET_ENTITY_METHOD(entity_type, entity_name, entities_member) \
   entity_type *get_##entity_name##_by_key(uint32_t key, bool include_internal = false) { \
-    for (auto *obj : this->entities_member##_) { \
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal())) \
-        return obj; \
-    } \
-    return nullptr; \
+    return this->entities_member##_.find( \
+        key, [include_internal](entity_type *obj) { return include_internal || !obj->is_internal(); }); \
   }
 #endif  // USE_DEVICES
 #ifdef USE_AREAS
@@ -417,6 +469,7 @@ class Application {
   /// These functions update the fd_set used by select() in the main loop.
   /// WARNING: These functions are NOT thread-safe. They must only be called from the main loop.
   /// NOTE: File descriptors >= FD_SETSIZE (typically 10 on ESP) will be rejected with an error.
+  /// With USE_SOCKET_SELECT_EPOLL (Linux host) an epoll set is used instead and there is no such limit.
   /// @return true if registration was successful, false if fd exceeds limits
   bool register_socket_fd(int fd);
   void unregister_socket_fd(int fd);
@@ -425,6 +478,15 @@ class Application {
   bool is_socket_ready(int fd) const;
 #endif
 
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+  /// Wake the main loop if it sleeps in tickless idle, so work queued from another thread runs right away.
+  /// Thread-safe, but not ISR-safe. Only costs a flag check while the loop is not sleeping.
+  void wake_loop_threadsafe() {
+    if (this->tickless_sleeping_)
+      this->send_wake_();
+  }
+#endif
+
  protected:
   friend Component;
 
@@ -433,6 +495,10 @@ class Application {
   void calculate_looping_components_();
   void add_looping_components_by_state_(bool match_loop_done);
 
+#ifdef ESPHOME_CONCURRENT_SETUP
+  void setup_concurrent_();
+#endif
+
   // These methods are called by Component::disable_loop() and Component::enable_loop()
   // Components should not call these directly - use this->disable_loop() or this->enable_loop()
   // to ensure component state is properly updated along with the loop partition
@@ -448,10 +514,29 @@ class Application {
   /// Perform a delay while also monitoring socket file descriptors for readiness
   void yield_with_select_(uint32_t delay_ms);
 
+#ifdef ESPHOME_TICKLESS_IDLE
+  /// True if nothing needs loop() to run, so the main loop only has to wake for the scheduler or sockets
+  bool is_idle_() const {
+    // Pending dump_config() calls run one per loop, pending loop enables need the next loop to apply them
+    return this->looping_components_active_end_ == 0 && !this->has_pending_enable_loop_requests_ &&
+           this->dump_config_at_ >= this->components_.size() && !HighFrequencyLoopRequester::is_high_frequency();
+  }
+  /// Sleep until the next scheduler item is due, a socket becomes readable or the loop is woken
+  void tickless_sleep_(uint32_t now);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  void setup_wake_socket_();
+  void send_wake_();
+#endif
+#endif
+
   // === Member variables ordered by size to minimize padding ===
 
   // Pointer-sized members first
   Component *current_component_{nullptr};
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+  // Loopback UDP socket that wake_loop_threadsafe() sends to, monitored by the tickless idle select()
+  socket::Socket *wake_socket_{nullptr};
+#endif
   const char *comment_{nullptr};
   const char *compilation_time_{nullptr};
 
@@ -473,9 +558,17 @@ class Application {
   //   and active_end_ is incremented
   // - This eliminates branch mispredictions from flag checking in the hot loop
   std::vector<Component *> looping_components_{};
+#ifdef ESPHOME_CONCURRENT_SETUP
+  // (component, dependency) pairs registered by add_setup_dependency()
+  std::vector<std::pair<Component *, Component *>> setup_dependencies_{};
+#endif
 #ifdef USE_SOCKET_SELECT_SUPPORT
   std::vector<int> socket_fds_;  // Vector of all monitored socket file descriptors
 #endif
+#ifdef USE_SOCKET_SELECT_EPOLL
+  std::vector<struct epoll_event> epoll_events_;  // Filled by epoll_wait(), one slot per monitored socket
+  std::vector<uint8_t> socket_ready_;              // Indexed by fd, set for the sockets of the last epoll_wait()
+#endif
 
   // std::string members (typically 24-32 bytes each)
   std::string name_;
@@ -487,10 +580,15 @@ class Application {
   // 4-byte members
   uint32_t last_loop_{0};
   uint32_t loop_component_start_time_{0};
+  uint32_t loop_count_{0};
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#if defined(USE_SOCKET_SELECT_SUPPORT) && !defined(USE_SOCKET_SELECT_EPOLL)
   int max_fd_{-1};  // Highest file descriptor number for select()
 #endif
+#ifdef USE_SOCKET_SELECT_EPOLL
+  int epoll_fd_{-1};
+  int epoll_ready_count_{0};  // Valid entries in epoll_events_ after the last epoll_wait()
+#endif
 
   // 2-byte members (grouped together for alignment)
   uint16_t loop_interval_{16};                 // Loop interval in ms (max 65535ms = 65.5 seconds)
@@ -502,12 +600,16 @@ class Application {
   bool name_add_mac_suffix_;
   bool in_loop_{false};
   volatile bool has_pending_enable_loop_requests_{false};
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+  volatile bool tickless_sleeping_{false};
+  bool wake_socket_setup_{false};
+#endif
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#if defined(USE_SOCKET_SELECT_SUPPORT) && !defined(USE_SOCKET_SELECT_EPOLL)
   bool socket_fds_changed_{false};  // Flag to rebuild base_read_fds_ when socket_fds_ changes
 #endif
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#if defined(USE_SOCKET_SELECT_SUPPORT) && !defined(USE_SOCKET_SELECT_EPOLL)
   // Variable-sized members
   fd_set base_read_fds_{};  // Cached fd_set rebuilt only when socket_fds_ changes
   fd_set read_fds_{};       // Working fd_set for select(), copied from base_read_fds_
@@ -523,68 +625,68 @@ class Application {
   StaticVector<Area *, ESPHOME_AREA_COUNT> areas_{};
 #endif
 #ifdef USE_BINARY_SENSOR
-  StaticVector<binary_sensor::BinarySensor *, ESPHOME_ENTITY_BINARY_SENSOR_COUNT> binary_sensors_{};
+  EntityList<binary_sensor::BinarySensor, ESPHOME_ENTITY_BINARY_SENSOR_COUNT> binary_sensors_{};
 #endif
 #ifdef USE_SWITCH
-  StaticVector<switch_::Switch *, ESPHOME_ENTITY_SWITCH_COUNT> switches_{};
+  EntityList<switch_::Switch, ESPHOME_ENTITY_SWITCH_COUNT> switches_{};
 #endif
 #ifdef USE_BUTTON
-  StaticVector<button::Button *, ESPHOME_ENTITY_BUTTON_COUNT> buttons_{};
+  EntityList<button::Button, ESPHOME_ENTITY_BUTTON_COUNT> buttons_{};
 #endif
 #ifdef USE_EVENT
-  StaticVector<event::Event *, ESPHOME_ENTITY_EVENT_COUNT> events_{};
+  EntityList<event::Event, ESPHOME_ENTITY_EVENT_COUNT> events_{};
 #endif
 #ifdef USE_SENSOR
-  StaticVector<sensor::Sensor *, ESPHOME_ENTITY_SENSOR_COUNT> sensors_{};
+  EntityList<sensor::Sensor, ESPHOME_ENTITY_SENSOR_COUNT> sensors_{};
 #endif
 #ifdef USE_TEXT_SENSOR
-  StaticVector<text_sensor::TextSensor *, ESPHOME_ENTITY_TEXT_SENSOR_COUNT> text_sensors_{};
+  EntityList<text_sensor::TextSensor, ESPHOME_ENTITY_TEXT_SENSOR_COUNT> text_sensors_{};
 #endif
 #ifdef USE_FAN
-  StaticVector<fan::Fan *, ESPHOME_ENTITY_FAN_COUNT> fans_{};
+  EntityList<fan::Fan, ESPHOME_ENTITY_FAN_COUNT> fans_{};
 #endif
 #ifdef USE_COVER
-  StaticVector<cover::Cover *, ESPHOME_ENTITY_COVER_COUNT> covers_{};
+  EntityList<cover::Cover, ESPHOME_ENTITY_COVER_COUNT> covers_{};
 #endif
 #ifdef USE_CLIMATE
-  StaticVector<climate::Climate *, ESPHOME_ENTITY_CLIMATE_COUNT> climates_{};
+  EntityList<climate::Climate, ESPHOME_ENTITY_CLIMATE_COUNT> climates_{};
 #endif
 #ifdef USE_LIGHT
-  StaticVector<light::LightState *, ESPHOME_ENTITY_LIGHT_COUNT> lights_{};
+  EntityList<light::LightState, ESPHOME_ENTITY_LIGHT_COUNT> lights_{};
 #endif
 #ifdef USE_NUMBER
-  StaticVector<number::Number *, ESPHOME_ENTITY_NUMBER_COUNT> numbers_{};
+  EntityList<number::Number, ESPHOME_ENTITY_NUMBER_COUNT> numbers_{};
 #endif
 #ifdef USE_DATETIME_DATE
-  StaticVector<datetime::DateEntity *, ESPHOME_ENTITY_DATE_COUNT> dates_{};
+  EntityList<datetime::DateEntity, ESPHOME_ENTITY_DATE_COUNT> dates_{};
 #endif
 #ifdef USE_DATETIME_TIME
-  StaticVector<datetime::TimeEntity *, ESPHOME_ENTITY_TIME_COUNT> times_{};
+  EntityList<datetime::TimeEntity, ESPHOME_ENTITY_TIME_COUNT> times_{};
 #endif
 #ifdef USE_DATETIME_DATETIME
-  StaticVector<datetime::DateTimeEntity *, ESPHOME_ENTITY_DATETIME_COUNT> datetimes_{};
+  EntityList<datetime::DateTimeEntity, ESPHOME_ENTITY_DATETIME_COUNT> datetimes_{};
 #endif
 #ifdef USE_SELECT
-  StaticVector<select::Select *, ESPHOME_ENTITY_SELECT_COUNT> selects_{};
+  EntityList<select::Select, ESPHOME_ENTITY_SELECT_COUNT> selects_{};
 #endif
 #ifdef USE_TEXT
-  StaticVector<text::Text *, ESPHOME_ENTITY_TEXT_COUNT> texts_{};
+  EntityList<text::Text, ESPHOME_ENTITY_TEXT_COUNT> texts_{};
 #endif
 #ifdef USE_LOCK
-  StaticVector<lock::Lock *, ESPHOME_ENTITY_LOCK_COUNT> locks_{};
+  EntityList<lock::Lock, ESPHOME_ENTITY_LOCK_COUNT> locks_{};
 #endif
 #ifdef USE_VALVE
-  StaticVector<valve::Valve *, ESPHOME_ENTITY_VALVE_COUNT> valves_{};
+  EntityList<valve::Valve, ESPHOME_ENTITY_VALVE_COUNT> valves_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
-  StaticVector<media_player::MediaPlayer *, ESPHOME_ENTITY_MEDIA_PLAYER_COUNT> media_players_{};
+  EntityList<media_player::MediaPlayer, ESPHOME_ENTITY_MEDIA_PLAYER_COUNT> media_players_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
-  StaticVector<alarm_control_panel::AlarmControlPanel *, ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT>
+  EntityList<alarm_control_panel::AlarmControlPanel, ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT>
       alarm_control_panels_{};
 #endif
 #ifdef USE_UPDATE
-  StaticVector<update::UpdateEntity *, ESPHOME_ENTITY_UPDATE_COUNT> updates_{};
+  EntityList<update::UpdateEntity, ESPHOME_ENTITY_UPDATE_COUNT> updates_{};
 #endif
 };
 
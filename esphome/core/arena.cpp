@@ -0,0 +1,39 @@
+#include "esphome/core/arena.h"
+
+#ifdef ESPHOME_SETUP_ARENA
+
+#include <cstdlib>
+#include <new>
+
+namespace esphome {
+
+Arena global_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *Arena::allocate(size_t size) {
+  size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  if (this->sealed_ || size > MAX_OBJECT_SIZE)
+    return ::operator new(size);
+
+  if (this->block_ == nullptr || this->block_used_ + size > BLOCK_SIZE) {
+    // The rest of the current block stays unused
+    auto *block = static_cast<uint8_t *>(malloc(BLOCK_SIZE));  // NOLINT(cppcoreguidelines-no-malloc)
+    if (block == nullptr)
+      return ::operator new(size);
+    this->block_ = block;
+    this->block_used_ = 0;
+    this->reserved_ += BLOCK_SIZE;
+  }
+
+  void *ptr = this->block_ + this->block_used_;
+  this->block_used_ += size;
+  this->used_ += size;
+  this->allocations_++;
+  return ptr;
+}
+
+}  // namespace esphome
+
+void *operator new(size_t size, esphome::Arena &arena) { return arena.allocate(size); }
+void operator delete(void *ptr, esphome::Arena &arena) noexcept {}
+
+#endif  // ESPHOME_SETUP_ARENA
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef ESPHOME_SETUP_ARENA
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+/** Bump allocator for objects that are created during setup and never freed, like the components, automations and
+ * filters created by the generated code.
+ *
+ * Memory is taken from the heap in blocks and handed out back to back, which saves the bookkeeping overhead of the heap
+ * for each object and keeps the objects close together. Once setup is finished the arena is sealed and later
+ * allocations go to the heap directly. Objects in the arena must never be deleted.
+ */
+class Arena {
+ public:
+  /// Returns memory for an object of \p size bytes, from the heap if the object is large or the arena is sealed.
+  void *allocate(size_t size);
+  /// Stops handing out memory from the arena.
+  void seal() { this->sealed_ = true; }
+
+  bool is_sealed() const { return this->sealed_; }
+  /// Bytes handed out to objects, including alignment padding.
+  size_t get_used() const { return this->used_; }
+  /// Bytes taken from the heap for blocks.
+  size_t get_reserved() const { return this->reserved_; }
+  uint16_t get_allocations() const { return this->allocations_; }
+
+ protected:
+  static constexpr size_t BLOCK_SIZE = 1024;
+  /// Larger objects go to the heap, so they don't leave most of a block unused.
+  static constexpr size_t MAX_OBJECT_SIZE = BLOCK_SIZE / 4;
+  static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+  uint8_t *block_{nullptr};
+  size_t block_used_{0};
+  size_t used_{0};
+  size_t reserved_{0};
+  uint16_t allocations_{0};
+  bool sealed_{false};
+};
+
+extern Arena global_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+/// Placement form used by the generated code: `new (esphome::global_arena) T(...)`.
+void *operator new(size_t size, esphome::Arena &arena);
+/// Only called if a constructor throws, the memory stays in the arena.
+void operator delete(void *ptr, esphome::Arena &arena) noexcept;
+
+#endif  // ESPHOME_SETUP_ARENA
@@ -189,6 +189,24 @@ template<typename... Ts> class LambdaAction : public Action<Ts...> {
   std::function<void(Ts...)> f_;
 };
 
+/// Runs several lambdas one after the other as a single action. Stopping the automation from inside
+/// one lambda skips the remaining ones, just like it would for separate lambda actions.
+template<typename... Ts> class LambdaSequenceAction : public Action<Ts...> {
+ public:
+  explicit LambdaSequenceAction(std::initializer_list<std::function<void(Ts...)>> fs) : fs_(fs) {}
+
+  void play(Ts... x) override {
+    for (auto &f : this->fs_) {
+      if (this->num_running_ == 0)
+        return;
+      f(x...);
+    }
+  }
+
+ protected:
+  std::vector<std::function<void(Ts...)>> fs_;
+};
+
 template<typename... Ts> class IfAction : public Action<Ts...> {
  public:
   explicit IfAction(Condition<Ts...> *condition) : condition_(condition) {}
@@ -12,6 +12,9 @@
 #ifdef USE_RUNTIME_STATS
 #include "esphome/components/runtime_stats/runtime_stats.h"
 #endif
+#ifdef USE_BOOT_TIMELINE
+#include "esphome/components/boot_timeline/boot_timeline.h"
+#endif
 
 namespace esphome {
 
@@ -85,11 +88,11 @@ void Component::setup() {}
 
 void Component::loop() {}
 
-void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+void Component::set_interval(const std::string &name, uint32_t interval, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_interval(this, name, interval, std::move(f));
 }
 
-void Component::set_interval(const char *name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+void Component::set_interval(const char *name, uint32_t interval, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_interval(this, name, interval, std::move(f));
 }
 
@@ -110,11 +113,11 @@ bool Component::cancel_retry(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_retry(this, name);
 }
 
-void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+void Component::set_timeout(const std::string &name, uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, timeout, std::move(f));
 }
 
-void Component::set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+void Component::set_timeout(const char *name, uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, timeout, std::move(f));
 }
 
@@ -156,8 +159,16 @@ void Component::call() {
       ESP_LOGV(TAG, "Setup %s", LOG_STR_ARG(this->get_component_log_str()));
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
       uint32_t start_time = millis();
+#endif
+#ifdef USE_BOOT_TIMELINE
+      if (global_boot_timeline != nullptr)
+        global_boot_timeline->record(boot_timeline::BOOT_EVENT_SETUP_START, this);
 #endif
       this->call_setup();
+#ifdef USE_BOOT_TIMELINE
+      if (global_boot_timeline != nullptr)
+        global_boot_timeline->record(boot_timeline::BOOT_EVENT_SETUP_END, this);
+#endif
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
       uint32_t setup_time = millis() - start_time;
       ESP_LOGCONFIG(TAG, "Setup %s took %ums", LOG_STR_ARG(this->get_component_log_str()), (unsigned) setup_time);
@@ -246,22 +257,22 @@ void Component::reset_to_construction_state() {
 bool Component::is_in_loop_state() const {
   return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP;
 }
-void Component::defer(std::function<void()> &&f) {  // NOLINT
+void Component::defer(SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, static_cast<const char *>(nullptr), 0, std::move(f));
 }
 bool Component::cancel_defer(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
-void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
+void Component::defer(const std::string &name, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
-void Component::defer(const char *name, std::function<void()> &&f) {  // NOLINT
+void Component::defer(const char *name, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
-void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+void Component::set_timeout(uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, static_cast<const char *>(nullptr), timeout, std::move(f));
 }
-void Component::set_interval(uint32_t interval, std::function<void()> &&f) {  // NOLINT
+void Component::set_interval(uint32_t interval, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_interval(this, static_cast<const char *>(nullptr), interval, std::move(f));
 }
 void Component::set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std::function<RetryResult(uint8_t)> &&f,
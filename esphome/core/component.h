@@ -5,6 +5,7 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/inline_function.h"
 #include "esphome/core/log.h"
 #include "esphome/core/optional.h"
 
@@ -13,6 +14,17 @@ namespace esphome {
 // Forward declaration for LogString
 struct LogString;
 
+#ifdef USE_RUNTIME_STATS
+namespace runtime_stats {
+struct ComponentStatsEntry;
+class RuntimeStatsCollector;
+}  // namespace runtime_stats
+#endif
+
+/// Callback type of set_timeout()/set_interval()/defer(). Callables of up to four pointers (e.g. a lambda
+/// capturing `this` and a few values, or a std::function) are stored inline without a heap allocation.
+using SchedulerCallback = InlineFunction<void(), 4 * sizeof(void *)>;
+
 /** Default setup priorities for components of different types.
  *
  * Components should return one of these setup priorities in get_setup_priority.
@@ -235,6 +247,9 @@ class Component {
 
  protected:
   friend class Application;
+#ifdef USE_RUNTIME_STATS
+  friend class runtime_stats::RuntimeStatsCollector;
+#endif
 
   virtual void call_loop();
   virtual void call_setup();
@@ -265,7 +280,7 @@ class Component {
    *
    * @see cancel_interval()
    */
-  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(const std::string &name, uint32_t interval, SchedulerCallback &&f);  // NOLINT
 
   /** Set an interval function with a const char* name.
    *
@@ -281,9 +296,9 @@ class Component {
    * @param interval The interval in ms
    * @param f The function to call
    */
-  void set_interval(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(const char *name, uint32_t interval, SchedulerCallback &&f);  // NOLINT
 
-  void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(uint32_t interval, SchedulerCallback &&f);  // NOLINT
 
   /** Cancel an interval function.
    *
@@ -350,7 +365,7 @@ class Component {
    *
    * @see cancel_timeout()
    */
-  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(const std::string &name, uint32_t timeout, SchedulerCallback &&f);  // NOLINT
 
   /** Set a timeout function with a const char* name.
    *
@@ -366,9 +381,9 @@ class Component {
    * @param timeout The timeout in ms
    * @param f The function to call
    */
-  void set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(const char *name, uint32_t timeout, SchedulerCallback &&f);  // NOLINT
 
-  void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(uint32_t timeout, SchedulerCallback &&f);  // NOLINT
 
   /** Cancel a timeout function.
    *
@@ -385,7 +400,7 @@ class Component {
    * @param name The name of the defer function.
    * @param f The callback.
    */
-  void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const std::string &name, SchedulerCallback &&f);  // NOLINT
 
   /** Defer a callback to the next loop() call with a const char* name.
    *
@@ -400,10 +415,10 @@ class Component {
    * @param name The name of the defer function (must have static lifetime)
    * @param f The callback
    */
-  void defer(const char *name, std::function<void()> &&f);  // NOLINT
+  void defer(const char *name, SchedulerCallback &&f);  // NOLINT
 
   /// Defer a callback to the next loop() call.
-  void defer(std::function<void()> &&f);  // NOLINT
+  void defer(SchedulerCallback &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
@@ -418,6 +433,9 @@ class Component {
   /// Bits 5-7: Unused - reserved for future expansion
   uint8_t component_state_{0x00};
   volatile bool pending_enable_loop_{false};  ///< ISR-safe flag for enable_loop_soon_any_context
+#ifdef USE_RUNTIME_STATS
+  runtime_stats::ComponentStatsEntry *runtime_stats_{nullptr};  ///< Cached entry in global_runtime_stats
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
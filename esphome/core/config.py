@@ -15,6 +15,7 @@ from esphome.const import (
     CONF_BUILD_PATH,
     CONF_COMMENT,
     CONF_COMPILE_PROCESS_LIMIT,
+    CONF_CONCURRENT_SETUP,
     CONF_DEBUG_SCHEDULER,
     CONF_DEVICES,
     CONF_ESPHOME,
@@ -33,15 +34,21 @@ from esphome.const import (
     CONF_PLATFORMIO_OPTIONS,
     CONF_PRIORITY,
     CONF_PROJECT,
+    CONF_SCHEDULER_BACKEND,
+    CONF_SETUP_ARENA,
+    CONF_TICKLESS_IDLE,
     CONF_TRIGGER_ID,
     CONF_VERSION,
     KEY_CORE,
+    KEY_SETUP_ARENA,
     PlatformFramework,
     __version__ as ESPHOME_VERSION,
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
+from esphome.core.entity_helpers import get_entity_strings
 from esphome.helpers import (
     copy_file_if_changed,
+    cpp_string_escape,
     fnv1a_32bit_hash,
     get_str_env,
     walk_files,
@@ -67,6 +74,10 @@ Area = cg.esphome_ns.class_("Area")
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
 
+SCHEDULER_BACKEND_HEAP = "heap"
+SCHEDULER_BACKEND_TIMER_WHEEL = "timer_wheel"
+SCHEDULER_BACKENDS = [SCHEDULER_BACKEND_HEAP, SCHEDULER_BACKEND_TIMER_WHEEL]
+
 
 def validate_hostname(config):
     max_length = 31
@@ -230,6 +241,12 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
             cv.Optional(CONF_DEBUG_SCHEDULER, default=False): cv.boolean,
+            cv.Optional(
+                CONF_SCHEDULER_BACKEND, default=SCHEDULER_BACKEND_HEAP
+            ): cv.one_of(*SCHEDULER_BACKENDS, lower=True),
+            cv.Optional(CONF_TICKLESS_IDLE, default=False): cv.boolean,
+            cv.Optional(CONF_CONCURRENT_SETUP, default=False): cv.boolean,
+            cv.Optional(CONF_SETUP_ARENA, default=False): cv.boolean,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -442,6 +459,64 @@ async def _add_platform_defines() -> None:
             cg.add_define(f"USE_{platform_name.upper()}")
 
 
+@coroutine_with_priority(CoroPriority.FINAL)
+async def _add_entity_strings() -> None:
+    # Always defined, EntityBase refers to it even without any entities
+    entity_strings = get_entity_strings()
+    strings = ", ".join(cpp_string_escape(s) for s in entity_strings)
+    cg.add_global(
+        cg.RawStatement(
+            f"const char *const esphome::ENTITY_STRINGS[] = {{{strings}}};"
+        )
+    )
+    cg.add_global(
+        cg.RawStatement(
+            f"const uint16_t esphome::ENTITY_STRINGS_COUNT = {len(entity_strings)};"
+        )
+    )
+
+
+def _iter_setup_dependencies(config, components, owner=None):
+    """Yield (component, referenced) ID pairs for the IDs each component's config refers to.
+
+    Triggers (on_* options) are skipped, their actions only run once setup is done.
+    """
+    if isinstance(config, dict):
+        id_ = config.get(CONF_ID)
+        if isinstance(id_, core.ID) and id_.is_declaration and id_.id in components:
+            owner = id_
+        for key, value in config.items():
+            if isinstance(key, str) and key.startswith("on_"):
+                continue
+            yield from _iter_setup_dependencies(value, components, owner)
+    elif isinstance(config, list):
+        for item in config:
+            yield from _iter_setup_dependencies(item, components, owner)
+    elif isinstance(config, core.ID) and owner is not None and not config.is_declaration:
+        yield owner, config
+
+
+@coroutine_with_priority(CoroPriority.FINAL)
+async def _add_setup_dependencies() -> None:
+    # Registered components by ID, the declared IDs carry the concrete type
+    components = {
+        id_.id: var
+        for id_, var in CORE.variables.items()
+        if isinstance(id_.type, cg.MockObjClass)
+        and id_.type.inherits_from(cg.Component)
+        and id_.id not in CORE.component_ids
+    }
+    added = set()
+    for owner, ref in _iter_setup_dependencies(CORE.config, components):
+        edge = (owner.id, ref.id)
+        if owner.id == ref.id or ref.id not in components or edge in added:
+            continue
+        added.add(edge)
+        cg.add(
+            cg.App.add_setup_dependency(components[owner.id], components[ref.id])
+        )
+
+
 @coroutine_with_priority(CoroPriority.CORE)
 async def to_code(config: ConfigType) -> None:
     cg.add_global(cg.global_ns.namespace("esphome").using)
@@ -463,6 +538,7 @@ async def to_code(config: ConfigType) -> None:
     cg.add_define("ESPHOME_COMPONENT_COUNT", len(CORE.component_ids))
 
     CORE.add_job(_add_platform_defines)
+    CORE.add_job(_add_entity_strings)
 
     CORE.add_job(_add_automations, config)
 
@@ -489,6 +565,17 @@ async def to_code(config: ConfigType) -> None:
     cg.add_build_flag("-Wno-sign-compare")
     if config[CONF_DEBUG_SCHEDULER]:
         cg.add_define("ESPHOME_DEBUG_SCHEDULER")
+    if config[CONF_SCHEDULER_BACKEND] == SCHEDULER_BACKEND_TIMER_WHEEL:
+        cg.add_define("ESPHOME_SCHEDULER_TIMER_WHEEL")
+    if config[CONF_TICKLESS_IDLE]:
+        cg.add_define("ESPHOME_TICKLESS_IDLE")
+    if config[CONF_CONCURRENT_SETUP]:
+        cg.add_define("ESPHOME_CONCURRENT_SETUP")
+        CORE.add_job(_add_setup_dependencies)
+    if config[CONF_SETUP_ARENA]:
+        # Objects created with new_Pvariable() from here on are placed in the arena
+        cg.add_define("ESPHOME_SETUP_ARENA")
+        CORE.data[KEY_CORE][KEY_SETUP_ARENA] = True
 
     if CORE.using_arduino and not CORE.is_bk72xx:
         CORE.add_job(add_arduino_global_workaround)
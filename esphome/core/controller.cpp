@@ -1,15 +1,20 @@
 #include "controller.h"
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 
 void Controller::setup_controller(bool include_internal) {
 #ifdef USE_BINARY_SENSOR
   for (auto *obj : App.get_binary_sensors()) {
     if (include_internal || !obj->is_internal()) {
-      obj->add_full_state_callback(
-          [this, obj](optional<bool> previous, optional<bool> state) { this->on_binary_sensor_update(obj); });
+      obj->add_full_state_callback([this, obj](optional<bool> previous, optional<bool> state) {
+        if (this->should_send_state_(obj, ThrottledType::BINARY_SENSOR))
+          this->on_binary_sensor_update(obj);
+      });
     }
   }
 #endif
@@ -28,7 +33,10 @@ void Controller::setup_controller(bool include_internal) {
 #ifdef USE_SENSOR
   for (auto *obj : App.get_sensors()) {
     if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](float state) { this->on_sensor_update(obj, state); });
+      obj->add_on_state_callback([this, obj](float state) {
+        if (this->should_send_state_(obj, ThrottledType::SENSOR, state))
+          this->on_sensor_update(obj, state);
+      });
   }
 #endif
 #ifdef USE_SWITCH
@@ -46,7 +54,10 @@ void Controller::setup_controller(bool include_internal) {
 #ifdef USE_TEXT_SENSOR
   for (auto *obj : App.get_text_sensors()) {
     if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](const std::string &state) { this->on_text_sensor_update(obj, state); });
+      obj->add_on_state_callback([this, obj](const std::string &state) {
+        if (this->should_send_state_(obj, ThrottledType::TEXT_SENSOR))
+          this->on_text_sensor_update(obj, state);
+      });
   }
 #endif
 #ifdef USE_CLIMATE
@@ -131,4 +142,91 @@ void Controller::setup_controller(bool include_internal) {
 #endif
 }
 
+static bool within_deadband(float last, float value, float delta) {
+  if (std::isnan(last) || std::isnan(value))
+    return std::isnan(last) && std::isnan(value);
+  return std::fabs(value - last) < delta;
+}
+
+bool Controller::should_send_state_(EntityBase *obj, ThrottledType type, float value) {
+  if (this->min_state_interval_ == 0 && this->min_state_delta_ == 0.0f)
+    return true;
+
+  const uint32_t now = millis();
+  // Linear search, there is one entry per entity that ever published
+  for (auto &state : this->throttled_states_) {
+    if (state.obj != obj)
+      continue;
+    const uint32_t elapsed = now - state.last_sent;
+    if (type == ThrottledType::SENSOR && within_deadband(state.last_value, value, this->min_state_delta_) &&
+        (this->max_state_interval_ == 0 || elapsed < this->max_state_interval_))
+      return false;
+    if (elapsed >= this->min_state_interval_) {
+      state.last_sent = now;
+      state.last_value = value;
+      state.pending = false;
+      return true;
+    }
+    state.pending = true;
+    if (!this->send_scheduled_) {
+      this->send_scheduled_ = true;
+      App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), this->min_state_interval_ - elapsed,
+                                [this]() { this->send_pending_states_(); });
+    }
+    return false;
+  }
+  this->throttled_states_.push_back({obj, now, value, type, false});
+  return true;
+}
+
+void Controller::send_throttled_state_(ThrottledState &state) {
+  switch (state.type) {
+#ifdef USE_BINARY_SENSOR
+    case ThrottledType::BINARY_SENSOR:
+      this->on_binary_sensor_update(static_cast<binary_sensor::BinarySensor *>(state.obj));
+      break;
+#endif
+#ifdef USE_SENSOR
+    case ThrottledType::SENSOR: {
+      auto *obj = static_cast<sensor::Sensor *>(state.obj);
+      state.last_value = obj->state;
+      this->on_sensor_update(obj, obj->state);
+      break;
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case ThrottledType::TEXT_SENSOR: {
+      auto *obj = static_cast<text_sensor::TextSensor *>(state.obj);
+      this->on_text_sensor_update(obj, obj->state);
+      break;
+    }
+#endif
+    default:
+      break;
+  }
+}
+
+void Controller::send_pending_states_() {
+  this->send_scheduled_ = false;
+  const uint32_t now = millis();
+  uint32_t next = UINT32_MAX;
+  for (auto &state : this->throttled_states_) {
+    if (!state.pending)
+      continue;
+    const uint32_t elapsed = now - state.last_sent;
+    if (elapsed >= this->min_state_interval_) {
+      state.last_sent = now;
+      state.pending = false;
+      this->send_throttled_state_(state);
+    } else {
+      next = std::min(next, this->min_state_interval_ - elapsed);
+    }
+  }
+  if (next != UINT32_MAX) {
+    this->send_scheduled_ = true;
+    App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), next,
+                              [this]() { this->send_pending_states_(); });
+  }
+}
+
 }  // namespace esphome
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "esphome/core/defines.h"
+#include "esphome/core/entity_base.h"
+#include <cmath>
+#include <vector>
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -70,6 +73,22 @@ namespace esphome {
 class Controller {
  public:
   void setup_controller(bool include_internal = false);
+  /** Hand sensor, binary sensor and text sensor states on at most once per interval and entity.
+   *
+   * States that arrive before the interval is over are coalesced, the latest one is handed on when it ends.
+   * @param min_state_interval The interval in ms, 0 hands every state on right away.
+   */
+  void set_min_state_interval(uint32_t min_state_interval) { this->min_state_interval_ = min_state_interval; }
+  /** Hand a sensor state on only if it moved at least min_state_delta from the last one handed on.
+   *
+   * @param min_state_delta The deadband, in the unit of the sensor.
+   * @param max_state_interval A state within the deadband is still handed on once the last one is this old, in ms.
+   * 0 holds it back however long ago that was.
+   */
+  void set_min_state_delta(float min_state_delta, uint32_t max_state_interval) {
+    this->min_state_delta_ = min_state_delta;
+    this->max_state_interval_ = max_state_interval;
+  }
 #ifdef USE_BINARY_SENSOR
   virtual void on_binary_sensor_update(binary_sensor::BinarySensor *obj){};
 #endif
@@ -130,6 +149,37 @@ class Controller {
 #ifdef USE_UPDATE
   virtual void on_update(update::UpdateEntity *obj){};
 #endif
+
+ protected:
+  enum class ThrottledType : uint8_t {
+    BINARY_SENSOR,
+    SENSOR,
+    TEXT_SENSOR,
+  };
+  struct ThrottledState {
+    EntityBase *obj;
+    uint32_t last_sent;
+    /// The sensor state handed on last, for the deadband.
+    float last_value;
+    ThrottledType type;
+    bool pending;
+  };
+
+  /** Whether a new state of obj is to be handed on right away.
+   *
+   * A sensor state within the deadband is dropped, any other state within min_state_interval is held back until the
+   * interval is over.
+   * @param value The new state for sensors, NAN for the other types.
+   */
+  bool should_send_state_(EntityBase *obj, ThrottledType type, float value = NAN);
+  void send_throttled_state_(ThrottledState &state);
+  void send_pending_states_();
+
+  std::vector<ThrottledState> throttled_states_;
+  uint32_t min_state_interval_{0};
+  uint32_t max_state_interval_{0};
+  float min_state_delta_{0.0f};
+  bool send_scheduled_{false};
 };
 
 }  // namespace esphome
@@ -14,6 +14,9 @@
 #define ESPHOME_PROJECT_VERSION_30 "v2"
 #define ESPHOME_VARIANT "ESP32"
 #define ESPHOME_DEBUG_SCHEDULER
+#define ESPHOME_TICKLESS_IDLE
+#define ESPHOME_CONCURRENT_SETUP
+#define ESPHOME_SETUP_ARENA
 
 // Default threading model for static analysis (ESP32 is multi-threaded with atomics)
 #define ESPHOME_THREAD_MULTI_ATOMICS
@@ -25,6 +28,8 @@
 #define USE_ALARM_CONTROL_PANEL
 #define USE_AREAS
 #define USE_BINARY_SENSOR
+#define USE_BOOT_TIMELINE
+#define BOOT_TIMELINE_MAX_EVENTS 128
 #define USE_BUTTON
 #define USE_CAMERA
 #define USE_CLIMATE
@@ -42,12 +47,14 @@
 #define USE_FAN
 #define USE_GRAPH
 #define USE_GRAPHICAL_DISPLAY_MENU
+#define USE_HISTORY
 #define USE_HOMEASSISTANT_TIME
 #define USE_HTTP_REQUEST_OTA_WATCHDOG_TIMEOUT 8000  // NOLINT
 #define USE_JSON
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOGGER_BINARY
 #define USE_LVGL
 #define USE_LVGL_ANIMIMG
 #define USE_LVGL_ARC
@@ -83,6 +90,7 @@
 #define USE_LVGL_TOUCHSCREEN
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
+#define USE_MODBUS_RTU
 #define USE_NEXTION_TFT_UPLOAD
 #define USE_NUMBER
 #define USE_OUTPUT
@@ -108,15 +116,22 @@
 #define USE_AUDIO_FLAC_SUPPORT
 #define USE_AUDIO_MP3_SUPPORT
 #define USE_API
+#define USE_API_ADAPTIVE_BATCH_DELAY
+#define USE_API_BATCH_PRIORITIES
 #define USE_API_CLIENT_CONNECTED_TRIGGER
 #define USE_API_CLIENT_DISCONNECTED_TRIGGER
 #define USE_API_HOMEASSISTANT_SERVICES
 #define USE_API_HOMEASSISTANT_STATES
+#define USE_API_LIST_ENTITIES_CACHE
 #define USE_API_NOISE
+#define USE_API_NOISE_COALESCE_FRAMES
+#define USE_API_PARTIAL_STATES
 #define USE_API_PLAINTEXT
 #define USE_API_SERVICES
+#define USE_API_SHARED_STATE_ENCODING
 #define USE_MD5
 #define USE_MQTT
+#define USE_MQTT_DISCOVERY_CACHE
 #define USE_NETWORK
 #define USE_ONLINE_IMAGE_BMP_SUPPORT
 #define USE_ONLINE_IMAGE_PNG_SUPPORT
@@ -128,12 +143,14 @@
 #define USE_TIME_TIMEZONE
 #define USE_WIFI
 #define USE_WIFI_AP
+#define USE_WIFI_ROAMING
 #define USE_WIREGUARD
 #endif
 
 // Arduino-specific feature flags
 #ifdef USE_ARDUINO
 #define USE_PROMETHEUS
+#define USE_PROMETHEUS_GZIP
 #define USE_WIFI_WPA2_EAP
 #define USE_I2S_LEGACY
 #endif
@@ -147,9 +164,12 @@
 #ifdef USE_ESP32
 #define USE_ESPHOME_TASK_LOG_BUFFER
 
+#define USE_ADC_CONTINUOUS
+
 #define USE_BLUETOOTH_PROXY
 #define BLUETOOTH_PROXY_MAX_CONNECTIONS 3
 #define BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE 16
+#define USE_BLUETOOTH_PROXY_CACHE_SERVICES
 #define USE_CAPTIVE_PORTAL
 #define USE_ESP32_BLE
 #define USE_ESP32_BLE_CLIENT
@@ -157,6 +177,7 @@
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_BLE_UUID
 #define USE_ESP32_BLE_ADVERTISING
+#define USE_DEBUG_ALLOCATION_TRACING
 #define USE_I2C
 #define USE_IMPROV
 #define USE_MICROPHONE
@@ -240,6 +261,9 @@
 #ifdef USE_HOST
 #define USE_SOCKET_IMPL_BSD_SOCKETS
 #define USE_SOCKET_SELECT_SUPPORT
+#ifdef __linux__
+#define USE_SOCKET_SELECT_EPOLL
+#endif
 #endif
 
 #ifdef USE_NRF52
@@ -256,6 +280,7 @@
 #define ESPHOME_COMPONENT_COUNT 50
 #define ESPHOME_DEVICE_COUNT 10
 #define ESPHOME_AREA_COUNT 10
+#define ESPHOME_LOG_LISTENERS 4
 #define ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT 1
 #define ESPHOME_ENTITY_BINARY_SENSOR_COUNT 1
 #define ESPHOME_ENTITY_BUTTON_COUNT 1
@@ -3,10 +3,45 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/string_ref.h"
 
+#include <cstring>
+#include <vector>
+
 namespace esphome {
 
 static const char *const TAG = "entity_base";
 
+// Device classes, units and icons set from C++ that codegen did not know about, indexed after ENTITY_STRINGS
+static std::vector<const char *> &runtime_entity_strings() {
+  static std::vector<const char *> strings;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  return strings;
+}
+
+const char *entity_string(uint16_t index) {
+  if (index < ENTITY_STRINGS_COUNT)
+    return ENTITY_STRINGS[index];
+  return runtime_entity_strings()[index - ENTITY_STRINGS_COUNT];
+}
+
+uint16_t entity_string_index(const char *value) {
+  if (value == nullptr || value[0] == '\0')
+    return 0;
+  for (uint16_t i = 0; i < ENTITY_STRINGS_COUNT; i++) {
+    if (strcmp(ENTITY_STRINGS[i], value) == 0)
+      return i;
+  }
+  auto &strings = runtime_entity_strings();
+  for (size_t i = 0; i < strings.size(); i++) {
+    if (strcmp(strings[i], value) == 0)
+      return ENTITY_STRINGS_COUNT + i;
+  }
+  if (ENTITY_STRINGS_COUNT + strings.size() >= UINT16_MAX) {
+    ESP_LOGE(TAG, "Too many entity strings, ignoring '%s'", value);
+    return 0;
+  }
+  strings.push_back(value);
+  return ENTITY_STRINGS_COUNT + strings.size() - 1;
+}
+
 // Entity Name
 const StringRef &EntityBase::get_name() const { return this->name_; }
 void EntityBase::set_name(const char *name) {
@@ -27,19 +62,10 @@ void EntityBase::set_name(const char *name) {
 }
 
 // Entity Icon
-std::string EntityBase::get_icon() const {
+std::string EntityBase::get_icon() const { return this->get_icon_ref(); }
+void EntityBase::set_icon(uint16_t icon_id) {
 #ifdef USE_ENTITY_ICON
-  if (this->icon_c_str_ == nullptr) {
-    return "";
-  }
-  return this->icon_c_str_;
-#else
-  return "";
-#endif
-}
-void EntityBase::set_icon(const char *icon) {
-#ifdef USE_ENTITY_ICON
-  this->icon_c_str_ = icon;
+  this->icon_id_ = icon_id;
 #else
   // No-op when USE_ENTITY_ICON is not defined
 #endif
@@ -51,14 +77,18 @@ bool EntityBase::is_object_id_dynamic_() const {
 }
 
 // Entity Object ID
-std::string EntityBase::get_object_id() const {
+std::string EntityBase::get_object_id() const { return this->get_object_id_ref(); }
+StringRef EntityBase::get_object_id_ref() const {
   // Check if `App.get_friendly_name()` is constant or dynamic.
   if (this->is_object_id_dynamic_()) {
-    // `App.get_friendly_name()` is dynamic.
-    return str_sanitize(str_snake_case(App.get_friendly_name()));
+    // `App.get_friendly_name()` is dynamic, but it doesn't change once the MAC suffix is added. All entities without
+    // an own name share the same object_id, so it is only built once.
+    static const std::string DYNAMIC_OBJECT_ID = str_sanitize(str_snake_case(App.get_friendly_name()));
+    return StringRef(DYNAMIC_OBJECT_ID);
   }
   // `App.get_friendly_name()` is constant.
-  return this->object_id_c_str_ == nullptr ? "" : this->object_id_c_str_;
+  static constexpr auto EMPTY_STRING = StringRef::from_lit("");
+  return this->object_id_c_str_ == nullptr ? EMPTY_STRING : StringRef(this->object_id_c_str_);
 }
 StringRef EntityBase::get_object_id_ref_for_api_() const {
   static constexpr auto EMPTY_STRING = StringRef::from_lit("");
@@ -73,6 +103,14 @@ void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
   this->calc_object_id_();
 }
+void EntityBase::set_object_id(const char *object_id, uint32_t object_id_hash) {
+  this->object_id_c_str_ = object_id;
+  if (this->is_object_id_dynamic_()) {
+    this->calc_object_id_();
+  } else {
+    this->object_id_hash_ = object_id_hash;
+  }
+}
 
 // Calculate Object ID Hash from Entity Name
 void EntityBase::calc_object_id_() {
@@ -82,22 +120,8 @@ void EntityBase::calc_object_id_() {
 
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
 
-std::string EntityBase_DeviceClass::get_device_class() {
-  if (this->device_class_ == nullptr) {
-    return "";
-  }
-  return this->device_class_;
-}
-
-void EntityBase_DeviceClass::set_device_class(const char *device_class) { this->device_class_ = device_class; }
+std::string EntityBase_DeviceClass::get_device_class() { return this->get_device_class_ref(); }
 
-std::string EntityBase_UnitOfMeasurement::get_unit_of_measurement() {
-  if (this->unit_of_measurement_ == nullptr)
-    return "";
-  return this->unit_of_measurement_;
-}
-void EntityBase_UnitOfMeasurement::set_unit_of_measurement(const char *unit_of_measurement) {
-  this->unit_of_measurement_ = unit_of_measurement;
-}
+std::string EntityBase_UnitOfMeasurement::get_unit_of_measurement() { return this->get_unit_of_measurement_ref(); }
 
 }  // namespace esphome
@@ -16,6 +16,21 @@ namespace esphome {
 namespace api {
 class APIConnection;
 }  // namespace api
+namespace web_server {
+class WebServer;
+}  // namespace web_server
+
+/// Device classes, units of measurement and icons of all entities, deduplicated by codegen and defined in the
+/// generated code. Entities store the index of their strings in this table, index 0 is the empty string.
+extern const char *const ENTITY_STRINGS[];
+/// Number of entries in ENTITY_STRINGS.
+extern const uint16_t ENTITY_STRINGS_COUNT;
+
+/// String with the given index: the entries of ENTITY_STRINGS, followed by the ones added by entity_string_index().
+const char *entity_string(uint16_t index);
+/// Index of \p value for the index based setters. A string that is not in ENTITY_STRINGS is added to a runtime
+/// table, which only keeps the pointer: it must stay valid, like with the pointer based setters before.
+uint16_t entity_string_index(const char *value);
 
 enum EntityCategory : uint8_t {
   ENTITY_CATEGORY_NONE = 0,
@@ -35,7 +50,11 @@ class EntityBase {
 
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
+  // Get the sanitized name of this Entity as an ID, without copying it.
+  StringRef get_object_id_ref() const;
   void set_object_id(const char *object_id);
+  // Set the object ID together with its fnv1_hash(), as precomputed by codegen.
+  void set_object_id(const char *object_id, uint32_t object_id_hash);
 
   // Get the unique Object ID of this Entity
   uint32_t get_object_id_hash();
@@ -56,14 +75,16 @@ class EntityBase {
     this->flags_.entity_category = static_cast<uint8_t>(entity_category);
   }
 
-  // Get/set this entity's icon
+  // Get/set this entity's icon, codegen sets it by its index in ENTITY_STRINGS
   std::string get_icon() const;
-  void set_icon(const char *icon);
+  void set_icon(uint16_t icon_id);
+  // For icons set from C++. A template only so that the index form is preferred for a literal 0.
+  template<typename = void> void set_icon(const char *icon) { this->set_icon(entity_string_index(icon)); }
   StringRef get_icon_ref() const {
-    static constexpr auto EMPTY_STRING = StringRef::from_lit("");
 #ifdef USE_ENTITY_ICON
-    return this->icon_c_str_ == nullptr ? EMPTY_STRING : StringRef(this->icon_c_str_);
+    return StringRef(entity_string(this->icon_id_));
 #else
+    static constexpr auto EMPTY_STRING = StringRef::from_lit("");
     return EMPTY_STRING;
 #endif
   }
@@ -116,6 +137,7 @@ class EntityBase {
 
  protected:
   friend class api::APIConnection;
+  friend class web_server::WebServer;
 
   // Get object_id as StringRef when it's static (for API usage)
   // Returns empty StringRef if object_id is dynamic (needs allocation)
@@ -131,9 +153,6 @@ class EntityBase {
 
   StringRef name_;
   const char *object_id_c_str_{nullptr};
-#ifdef USE_ENTITY_ICON
-  const char *icon_c_str_{nullptr};
-#endif
   uint32_t object_id_hash_{};
 #ifdef USE_DEVICES
   Device *device_{};
@@ -148,38 +167,47 @@ class EntityBase {
     uint8_t entity_category : 2;  // Supports up to 4 categories
     uint8_t reserved : 2;         // Reserved for future use
   } flags_{};
+#ifdef USE_ENTITY_ICON
+  // Next to the flags, so it fits in their padding
+  uint16_t icon_id_{0};
+#endif
 };
 
 class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the device class, using the manual override if set.
   std::string get_device_class();
-  /// Manually set the device class.
-  void set_device_class(const char *device_class);
-  /// Get the device class as StringRef
-  StringRef get_device_class_ref() const {
-    static constexpr auto EMPTY_STRING = StringRef::from_lit("");
-    return this->device_class_ == nullptr ? EMPTY_STRING : StringRef(this->device_class_);
+  /// Manually set the device class by its index in ENTITY_STRINGS, as codegen does.
+  void set_device_class(uint16_t device_class_id) { this->device_class_id_ = device_class_id; }
+  /// Manually set the device class from C++. A template only so that the index form is preferred for a literal 0.
+  template<typename = void> void set_device_class(const char *device_class) {
+    this->device_class_id_ = entity_string_index(device_class);
   }
+  /// Get the device class as StringRef
+  StringRef get_device_class_ref() const { return StringRef(entity_string(this->device_class_id_)); }
 
  protected:
-  const char *device_class_{nullptr};  ///< Device class override
+  uint16_t device_class_id_{0};  ///< Device class override
 };
 
 class EntityBase_UnitOfMeasurement {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the unit of measurement, using the manual override if set.
   std::string get_unit_of_measurement();
-  /// Manually set the unit of measurement.
-  void set_unit_of_measurement(const char *unit_of_measurement);
-  /// Get the unit of measurement as StringRef
-  StringRef get_unit_of_measurement_ref() const {
-    static constexpr auto EMPTY_STRING = StringRef::from_lit("");
-    return this->unit_of_measurement_ == nullptr ? EMPTY_STRING : StringRef(this->unit_of_measurement_);
+  /// Manually set the unit of measurement by its index in ENTITY_STRINGS, as codegen does.
+  void set_unit_of_measurement(uint16_t unit_of_measurement_id) {
+    this->unit_of_measurement_id_ = unit_of_measurement_id;
+  }
+  /// Manually set the unit of measurement from C++. A template only so that the index form is preferred for a
+  /// literal 0.
+  template<typename = void> void set_unit_of_measurement(const char *unit_of_measurement) {
+    this->unit_of_measurement_id_ = entity_string_index(unit_of_measurement);
   }
+  /// Get the unit of measurement as StringRef
+  StringRef get_unit_of_measurement_ref() const { return StringRef(entity_string(this->unit_of_measurement_id_)); }
 
  protected:
-  const char *unit_of_measurement_{nullptr};  ///< Unit of measurement override
+  uint16_t unit_of_measurement_id_{0};  ///< Unit of measurement override
 };
 
 /**
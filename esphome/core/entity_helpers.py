@@ -12,14 +12,43 @@ from esphome.const import (
     CONF_INTERNAL,
     CONF_NAME,
 )
-from esphome.core import CORE, ID
+from esphome.core import CORE, ID, EsphomeError
 from esphome.cpp_generator import MockObj, add, get_variable
 import esphome.final_validate as fv
-from esphome.helpers import sanitize, snake_case
+from esphome.helpers import fnv1_hash, sanitize, snake_case
 from esphome.types import ConfigType, EntityMetadata
 
 _LOGGER = logging.getLogger(__name__)
 
+KEY_ENTITY_STRINGS = "entity_strings"
+KEY_ENTITY_STRINGS_WRITTEN = "entity_strings_written"
+
+
+def entity_string(value: str) -> int:
+    """Return the index of a device class, unit or icon in ENTITY_STRINGS.
+
+    Equal strings share one entry, so entities only store a 16 bit index.
+    """
+    strings: dict[str, int] = CORE.data.setdefault(KEY_ENTITY_STRINGS, {"": 0})
+    if value not in strings:
+        if CORE.data.get(KEY_ENTITY_STRINGS_WRITTEN):
+            raise EsphomeError(
+                f"Entity string '{value}' added after ENTITY_STRINGS was written"
+            )
+        if len(strings) > 0xFFFF:
+            raise cv.Invalid("Too many distinct entity device classes, units and icons")
+        strings[value] = len(strings)
+    return strings[value]
+
+
+def get_entity_strings() -> list[str]:
+    """Return the strings of ENTITY_STRINGS, ordered by their index.
+
+    No new strings can be added afterwards.
+    """
+    CORE.data[KEY_ENTITY_STRINGS_WRITTEN] = True
+    return list(CORE.data.get(KEY_ENTITY_STRINGS, {"": 0}))
+
 
 def get_base_entity_object_id(
     name: str, friendly_name: str | None, device_name: str | None = None
@@ -97,8 +126,8 @@ async def setup_entity(var: MockObj, config: ConfigType, platform: str) -> None:
             "Entity has empty name, using '%s' as object_id base", base_object_id
         )
 
-    # Set the object ID
-    add(var.set_object_id(base_object_id))
+    # Set the object ID, with its hash so it doesn't have to be computed on boot
+    add(var.set_object_id(base_object_id, fnv1_hash(base_object_id)))
     _LOGGER.debug(
         "Setting object_id '%s' for entity '%s' on platform '%s'",
         base_object_id,
@@ -111,7 +140,7 @@ async def setup_entity(var: MockObj, config: ConfigType, platform: str) -> None:
     if CONF_ICON in config:
         # Add USE_ENTITY_ICON define when icons are used
         cg.add_define("USE_ENTITY_ICON")
-        add(var.set_icon(config[CONF_ICON]))
+        add(var.set_icon(entity_string(config[CONF_ICON])))
     if CONF_ENTITY_CATEGORY in config:
         add(var.set_entity_category(config[CONF_ENTITY_CATEGORY]))
 
@@ -33,6 +33,9 @@ template<class T, uint8_t SIZE> class EventPool {
     }
   }
 
+  /// Create the events beyond this many in external RAM when there is some, the first ones stay internal.
+  void set_internal_limit(uint8_t limit) { this->internal_limit_ = limit; }
+
   // Allocate an event from the pool
   // Returns nullptr if pool is full
   T *allocate() {
@@ -47,8 +50,9 @@ template<class T, uint8_t SIZE> class EventPool {
       return nullptr;
     }
 
-    // Use internal RAM for better performance
-    RAMAllocator<T> allocator(RAMAllocator<T>::ALLOC_INTERNAL);
+    // Use internal RAM for better performance, up to the internal limit
+    RAMAllocator<T> allocator(this->total_created_ < this->internal_limit_ ? RAMAllocator<T>::ALLOC_INTERNAL
+                                                                            : RAMAllocator<T>::NONE);
     event = allocator.allocate(1);
 
     if (event == nullptr) {
@@ -74,6 +78,7 @@ template<class T, uint8_t SIZE> class EventPool {
  private:
   LockFreeQueue<T, SIZE> free_list_;  // Free events ready for reuse
   uint8_t total_created_;             // Total events created (high water mark, max 255)
+  uint8_t internal_limit_{SIZE};      // Events created in internal RAM
 };
 
 }  // namespace esphome
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+/** Pool that keeps up to N blocks for objects of type T, so they are reused instead of going back to the heap.
+ *
+ * Blocks are taken from the heap on first use. When an object is released it is destroyed, and its block is kept for
+ * the next allocation as long as fewer than N are kept, so a component that keeps creating and destroying objects of
+ * the same type stops touching the heap once it reached its peak usage. There is no upper limit on the number of live
+ * objects, blocks beyond N are freed again.
+ *
+ * The pool is not thread safe, use EventPool to pass objects between tasks.
+ *
+ * @tparam T The type of objects in the pool
+ * @tparam N The maximum number of unused blocks to keep
+ */
+template<class T, size_t N> class FixedBlockPool {
+ public:
+  /// Returns objects to the pool they came from.
+  struct Deleter {
+    FixedBlockPool *pool;
+    void operator()(T *obj) const { this->pool->release(obj); }
+  };
+  using Ptr = std::unique_ptr<T, Deleter>;
+
+  /// @param ram_flags RAMAllocator flags for new blocks, for example RAMAllocator<T>::NONE to prefer PSRAM
+  explicit FixedBlockPool(uint8_t ram_flags = RAMAllocator<T>::ALLOC_INTERNAL) : allocator_(ram_flags) {}
+  FixedBlockPool(const FixedBlockPool &) = delete;
+  FixedBlockPool &operator=(const FixedBlockPool &) = delete;
+  ~FixedBlockPool() {
+    while (this->free_count_ > 0)
+      this->allocator_.deallocate(this->free_[--this->free_count_], 1);
+  }
+
+  /// Constructs an object in a pooled block, returns nullptr if no memory is left.
+  template<typename... Args> T *allocate(Args &&...args) {
+    T *block = this->free_count_ > 0 ? this->free_[--this->free_count_] : this->allocator_.allocate(1);
+    if (block == nullptr)
+      return nullptr;
+    return new (block) T(std::forward<Args>(args)...);
+  }
+  /// Like allocate(), but the returned pointer releases the object when it goes out of scope.
+  template<typename... Args> Ptr make(Args &&...args) {
+    return Ptr(this->allocate(std::forward<Args>(args)...), Deleter{this});
+  }
+
+  /// Destroys an object from allocate() and keeps its block for reuse.
+  void release(T *obj) {
+    if (obj == nullptr)
+      return;
+    obj->~T();
+    if (this->free_count_ < N) {
+      this->free_[this->free_count_++] = obj;
+    } else {
+      this->allocator_.deallocate(obj, 1);
+    }
+  }
+
+  /// Number of unused blocks kept for reuse.
+  size_t get_free_count() const { return this->free_count_; }
+
+ protected:
+  RAMAllocator<T> allocator_;
+  std::array<T *, N> free_{};
+  size_t free_count_{0};
+};
+
+}  // namespace esphome
@@ -135,6 +135,52 @@ template<typename T, size_t N> class StaticVector {
   const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 };
 
+/// Double ended queue in a single allocation, for sliding windows. Unlike std::deque it doesn't allocate blocks much
+/// larger than the window, and it doesn't allocate again as values move through it.
+template<typename T> class FixedRingBuffer {
+ public:
+  /// Make room for at least `capacity` elements, keeping the current ones.
+  void reserve(size_t capacity) {
+    if (capacity <= this->data_.size())
+      return;
+    std::vector<T> data(capacity);
+    for (size_t i = 0; i != this->count_; i++)
+      data[i] = (*this)[i];
+    this->data_ = std::move(data);
+    this->head_ = 0;
+  }
+
+  size_t size() const { return this->count_; }
+  bool empty() const { return this->count_ == 0; }
+  size_t capacity() const { return this->data_.size(); }
+
+  /// Append an element, the caller makes sure there is room for it.
+  void push_back(const T &value) { this->data_[this->index_(this->count_++)] = value; }
+  void pop_front() {
+    this->head_ = this->index_(1);
+    this->count_--;
+  }
+  void pop_back() { this->count_--; }
+
+  T &front() { return this->data_[this->head_]; }
+  const T &front() const { return this->data_[this->head_]; }
+  T &back() { return this->data_[this->index_(this->count_ - 1)]; }
+  const T &back() const { return this->data_[this->index_(this->count_ - 1)]; }
+  /// Element `i`, counted from the front.
+  T &operator[](size_t i) { return this->data_[this->index_(i)]; }
+  const T &operator[](size_t i) const { return this->data_[this->index_(i)]; }
+
+ protected:
+  size_t index_(size_t i) const {
+    i += this->head_;
+    return i >= this->data_.size() ? i - this->data_.size() : i;
+  }
+
+  std::vector<T> data_;
+  size_t head_{0};
+  size_t count_{0};
+};
+
 ///@}
 
 /// @name Mathematics
@@ -156,6 +202,8 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t p
 
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const char *str);
+/// Calculate a FNV-1 hash of the first \p len characters of \p str, which doesn't need to be null-terminated.
+uint32_t fnv1_hash(const char *str, size_t len);
 inline uint32_t fnv1_hash(const std::string &str) { return fnv1_hash(str.c_str()); }
 
 /// Return a random 32-bit unsigned integer.
@@ -589,6 +637,8 @@ ParseOnOffState parse_on_off(const char *str, const char *on = nullptr, const ch
 
 /// Create a string from a value and an accuracy in decimals.
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
+/// Format a value with an accuracy in decimals into buf like value_accuracy_to_string(), returns the length.
+size_t value_accuracy_to_buf(char *buf, size_t size, float value, int8_t accuracy_decimals);
 
 /// Derive accuracy in decimals from an increment step.
 int8_t step_to_accuracy_decimals(float step);
@@ -654,6 +704,46 @@ template<typename... Ts> class CallbackManager<void(Ts...)> {
   std::vector<std::function<void(Ts...)>> callbacks_;
 };
 
+template<typename X, size_t N> class StaticCallbackManager;
+
+/** Fixed capacity variant of CallbackManager, for callbacks whose number is known at compile time.
+ *
+ * Callbacks are a function pointer with a context pointer instead of a std::function, so adding one doesn't allocate
+ * and calling one is a single indirect call.
+ *
+ * @tparam Ts The arguments for the callbacks, wrapped in void().
+ * @tparam N The maximum number of callbacks.
+ */
+template<typename... Ts, size_t N> class StaticCallbackManager<void(Ts...), N> {
+ public:
+  using callback_t = void (*)(void *, Ts...);
+
+  /// Add a callback that is called with \p context as first argument, returns false if the manager is full.
+  bool add(callback_t callback, void *context) {
+    if (this->callbacks_.size() == N)
+      return false;
+    this->callbacks_.push_back(Entry{callback, context});
+    return true;
+  }
+
+  /// Call all callbacks in this manager.
+  void call(Ts... args) {
+    for (auto &entry : this->callbacks_)
+      entry.callback(entry.context, args...);
+  }
+  size_t size() const { return this->callbacks_.size(); }
+
+  /// Call all callbacks in this manager.
+  void operator()(Ts... args) { call(args...); }
+
+ protected:
+  struct Entry {
+    callback_t callback;
+    void *context;
+  };
+  StaticVector<Entry, N> callbacks_;
+};
+
 /// Helper class to deduplicate items in a series of values.
 template<typename T> class Deduplicator {
  public:
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace esphome {
+
+template<typename Signature, size_t Capacity> class InlineFunction;
+
+/** Move-only callable wrapper with fixed small-buffer storage.
+ *
+ * A drop-in replacement for std::function in hot paths that must not touch the heap, such as scheduler items
+ * that are re-armed many times per second. Callables of up to Capacity bytes (that are nothrow-movable and not
+ * over-aligned) are stored inline. Larger callables fall back to a single heap allocation, which is no worse
+ * than std::function (whose own inline buffer only holds a couple of pointers).
+ * Use InlineFunction::fits_inline<F>() in a static_assert to turn the fallback into a compile error.
+ *
+ * Unlike std::function, copies are not supported: the wrapper is moved into its final place once.
+ *
+ * @tparam R Return type
+ * @tparam Args Argument types
+ * @tparam Capacity Size of the inline buffer in bytes
+ */
+template<typename R, typename... Args, size_t Capacity> class InlineFunction<R(Args...), Capacity> {
+ public:
+  InlineFunction() = default;
+  InlineFunction(std::nullptr_t) {}  // NOLINT(google-explicit-constructor)
+
+  template<typename F, typename D = std::decay_t<F>,
+           typename = std::enable_if_t<!std::is_same_v<D, InlineFunction> && !std::is_same_v<D, std::nullptr_t> &&
+                                       std::is_invocable_r_v<R, D &, Args...>>>
+  InlineFunction(F &&f) {  // NOLINT(google-explicit-constructor,bugprone-forwarding-reference-overload)
+    if constexpr (std::is_pointer_v<D> || std::is_member_pointer_v<D> || std::is_constructible_v<bool, D &>) {
+      // Function pointers and nullable callables (e.g. std::function) may be empty
+      if (!static_cast<bool>(f))
+        return;
+    }
+    if constexpr (fits_inline<D>()) {
+      new (&this->storage_) D(std::forward<F>(f));
+      this->ops_ = &InlineOps<D>::OPS;
+    } else {
+      *reinterpret_cast<D **>(&this->storage_) = new D(std::forward<F>(f));  // NOLINT
+      this->ops_ = &HeapOps<D>::OPS;
+    }
+  }
+
+  InlineFunction(InlineFunction &&other) noexcept { this->move_from_(other); }
+  InlineFunction &operator=(InlineFunction &&other) noexcept {
+    if (this != &other) {
+      this->reset();
+      this->move_from_(other);
+    }
+    return *this;
+  }
+  InlineFunction &operator=(std::nullptr_t) {
+    this->reset();
+    return *this;
+  }
+  InlineFunction(const InlineFunction &) = delete;
+  InlineFunction &operator=(const InlineFunction &) = delete;
+
+  ~InlineFunction() { this->reset(); }
+
+  /// True if a callable of type F is stored without a heap allocation.
+  template<typename F> static constexpr bool fits_inline() {
+    return sizeof(F) <= Capacity && alignof(F) <= alignof(Storage) && std::is_nothrow_move_constructible_v<F>;
+  }
+
+  /// True if the stored callable lives on the heap (it did not fit inline).
+  bool is_heap_allocated() const { return this->ops_ != nullptr && this->ops_->heap; }
+
+  void reset() {
+    if (this->ops_ != nullptr) {
+      this->ops_->destroy(&this->storage_);
+      this->ops_ = nullptr;
+    }
+  }
+
+  explicit operator bool() const { return this->ops_ != nullptr; }
+
+  R operator()(Args... args) const { return this->ops_->invoke(&this->storage_, std::forward<Args>(args)...); }
+
+ protected:
+  using Storage = std::aligned_storage_t<Capacity < sizeof(void *) ? sizeof(void *) : Capacity, alignof(void *)>;
+
+  struct Ops {
+    R (*invoke)(const Storage *storage, Args &&...args);
+    // Move-construct into dst and destroy the source
+    void (*relocate)(Storage *dst, Storage *src);
+    void (*destroy)(Storage *storage);
+    bool heap;
+  };
+
+  template<typename F> struct InlineOps {
+    static F *get(const Storage *storage) {
+      return std::launder(reinterpret_cast<F *>(const_cast<Storage *>(storage)));  // NOLINT
+    }
+    static R invoke(const Storage *storage, Args &&...args) { return (*get(storage))(std::forward<Args>(args)...); }
+    static void relocate(Storage *dst, Storage *src) {
+      new (dst) F(std::move(*get(src)));
+      get(src)->~F();
+    }
+    static void destroy(Storage *storage) { get(storage)->~F(); }
+    static constexpr Ops OPS{invoke, relocate, destroy, false};
+  };
+
+  template<typename F> struct HeapOps {
+    static F *get(const Storage *storage) { return *reinterpret_cast<F *const *>(storage); }  // NOLINT
+    static R invoke(const Storage *storage, Args &&...args) { return (*get(storage))(std::forward<Args>(args)...); }
+    static void relocate(Storage *dst, Storage *src) {
+      *reinterpret_cast<F **>(dst) = get(src);  // NOLINT
+    }
+    static void destroy(Storage *storage) { delete get(storage); }
+    static constexpr Ops OPS{invoke, relocate, destroy, true};
+  };
+
+  void move_from_(InlineFunction &other) {
+    if (other.ops_ == nullptr)
+      return;
+    other.ops_->relocate(&this->storage_, &other.storage_);
+    this->ops_ = other.ops_;
+    other.ops_ = nullptr;
+  }
+
+  Storage storage_;
+  const Ops *ops_{nullptr};
+};
+
+}  // namespace esphome
@@ -30,6 +30,9 @@ class ESPPreferenceObject {
     return backend_->load(reinterpret_cast<uint8_t *>(dest), sizeof(T));
   }
 
+  /// The backend of this preference, nullptr if it could not be created.
+  ESPPreferenceBackend *get_backend() const { return backend_; }
+
  protected:
   ESPPreferenceBackend *backend_{nullptr};
 };
@@ -126,6 +126,134 @@ bool RingBuffer::discard_bytes_(size_t discard_bytes) {
   return (bytes_read == discard_bytes);
 }
 
+SharedRingBuffer::~SharedRingBuffer() {
+  if (this->event_group_ != nullptr) {
+    vEventGroupDelete(this->event_group_);
+  }
+  if (this->storage_ != nullptr) {
+    RAMAllocator<uint8_t> allocator;
+    allocator.deallocate(this->storage_, this->size_);
+  }
+}
+
+std::shared_ptr<SharedRingBuffer> SharedRingBuffer::create(size_t len) {
+  std::shared_ptr<SharedRingBuffer> rb = std::make_shared<SharedRingBuffer>();
+
+  rb->size_ = len;
+
+  RAMAllocator<uint8_t> allocator;
+  rb->storage_ = allocator.allocate(rb->size_);
+  if (rb->storage_ == nullptr) {
+    return nullptr;
+  }
+
+  rb->event_group_ = xEventGroupCreate();
+  if (rb->event_group_ == nullptr) {
+    return nullptr;
+  }
+  ESP_LOGD(TAG, "Created shared ring buffer with size %u", len);
+
+  return rb;
+}
+
+std::unique_ptr<SharedRingBuffer::Reader> SharedRingBuffer::create_reader() {
+  EventBits_t bits = this->reader_bits_.load();
+  EventBits_t bit;
+  do {
+    bit = 0;
+    for (uint8_t i = 0; i < MAX_READERS; i++) {
+      if (!(bits & (1 << i))) {
+        bit = 1 << i;
+        break;
+      }
+    }
+    if (bit == 0) {
+      return nullptr;
+    }
+  } while (!this->reader_bits_.compare_exchange_weak(bits, bits | bit));
+
+  xEventGroupClearBits(this->event_group_, bit);
+  return std::unique_ptr<Reader>(new Reader(this->shared_from_this(), bit));  // NOLINT
+}
+
+size_t SharedRingBuffer::write(const void *data, size_t len) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  const uint32_t written = this->written_.load(std::memory_order_relaxed);
+
+  // Only the newest size_ bytes of a larger write can be kept
+  size_t skipped = len > this->size_ ? len - this->size_ : 0;
+  size_t to_copy = len - skipped;
+  size_t offset = (written + skipped) % this->size_;
+
+  this->writing_.store(written + len, std::memory_order_relaxed);
+  // Readers must see the new writing_ before any of the data it announces changes
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  size_t first = std::min(to_copy, this->size_ - offset);
+  std::memcpy(this->storage_ + offset, bytes + skipped, first);
+  std::memcpy(this->storage_, bytes + skipped + first, to_copy - first);
+
+  this->written_.store(written + len, std::memory_order_release);
+  xEventGroupSetBits(this->event_group_, this->reader_bits_.load());
+
+  return len;
+}
+
+SharedRingBuffer::Reader::Reader(std::shared_ptr<SharedRingBuffer> buffer, EventBits_t bit)
+    : buffer_(std::move(buffer)), bit_(bit) {
+  this->position_ = this->buffer_->written_.load(std::memory_order_acquire);
+}
+
+SharedRingBuffer::Reader::~Reader() { this->buffer_->reader_bits_.fetch_and(~this->bit_); }
+
+size_t SharedRingBuffer::Reader::available() const {
+  uint32_t unread = this->buffer_->written_.load(std::memory_order_acquire) - this->position_;
+  return std::min<size_t>(unread, this->buffer_->size_);
+}
+
+void SharedRingBuffer::Reader::reset() {
+  this->position_ = this->buffer_->written_.load(std::memory_order_acquire);
+}
+
+size_t SharedRingBuffer::Reader::read(void *data, size_t len, TickType_t ticks_to_wait) {
+  SharedRingBuffer *buffer = this->buffer_.get();
+
+  if ((this->available() == 0) && (ticks_to_wait > 0)) {
+    xEventGroupWaitBits(buffer->event_group_, this->bit_, pdTRUE, pdTRUE, ticks_to_wait);
+  }
+  // Any data that arrived is read now, so a later wait must not return right away because of it
+  xEventGroupClearBits(buffer->event_group_, this->bit_);
+
+  uint32_t written = buffer->written_.load(std::memory_order_acquire);
+  if (written - this->position_ > buffer->size_) {
+    // The writer lapped this reader, continue with the oldest data still stored
+    this->position_ = written - buffer->size_;
+    this->overruns_++;
+  }
+
+  size_t to_read = std::min<size_t>(len, written - this->position_);
+  if (to_read == 0) {
+    return 0;
+  }
+
+  size_t offset = this->position_ % buffer->size_;
+  size_t first = std::min(to_read, buffer->size_ - offset);
+  std::memcpy(data, buffer->storage_ + offset, first);
+  std::memcpy(static_cast<uint8_t *>(data) + first, buffer->storage_, to_read - first);
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint32_t writing = buffer->writing_.load(std::memory_order_relaxed);
+  if (writing - this->position_ > buffer->size_) {
+    // The writer overwrote part of the copied data, drop it and continue after the overwritten part
+    this->position_ = writing - buffer->size_;
+    this->overruns_++;
+    return 0;
+  }
+
+  this->position_ += to_read;
+  return to_read;
+}
+
 }  // namespace esphome
 
 #endif
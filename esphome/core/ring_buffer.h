@@ -3,8 +3,10 @@
 #ifdef USE_ESP32
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
 #include <freertos/ringbuf.h>
 
+#include <atomic>
 #include <cinttypes>
 #include <memory>
 
@@ -94,6 +96,93 @@ class RingBuffer {
   size_t size_{0};
 };
 
+/** Ring buffer with a single writer and several readers that each keep their own position in the same storage.
+ *
+ * Writing never blocks and always overwrites the oldest data, so a slow reader cannot hold up the writer or the other
+ * readers. A reader that falls more than the buffer size behind skips ahead to the oldest data still stored and counts
+ * an overrun. Readers copy the data out and check afterwards that the writer did not reach it in the meantime, so
+ * neither side takes a lock.
+ */
+class SharedRingBuffer : public std::enable_shared_from_this<SharedRingBuffer> {
+ public:
+  class Reader {
+   public:
+    ~Reader();
+
+    /**
+     * @brief Reads from the reader's position, waiting up to a specified number of ticks if no data is available.
+     *
+     * @param data Pointer to copy read data into
+     * @param len Number of bytes to read
+     * @param ticks_to_wait Maximum number of FreeRTOS ticks to wait (default: 0)
+     * @return Number of bytes read
+     */
+    size_t read(void *data, size_t len, TickType_t ticks_to_wait = 0);
+
+    /// @brief Returns the number of bytes written since the reader's position, at most the buffer size.
+    size_t available() const;
+
+    /// @brief Discards all data written so far, the next read only returns newer data.
+    void reset();
+
+    /// @brief Returns how often data was overwritten before this reader got to it since the last call.
+    uint32_t get_and_reset_overruns() {
+      uint32_t overruns = this->overruns_;
+      this->overruns_ = 0;
+      return overruns;
+    }
+
+   protected:
+    friend class SharedRingBuffer;
+    Reader(std::shared_ptr<SharedRingBuffer> buffer, EventBits_t bit);
+
+    std::shared_ptr<SharedRingBuffer> buffer_;
+    EventBits_t bit_;
+    uint32_t position_;
+    uint32_t overruns_{0};
+  };
+
+  ~SharedRingBuffer();
+
+  /**
+   * @brief Writes to the ring buffer, overwriting the oldest data if necessary.
+   *
+   * Must only be called from one task at a time.
+   *
+   * @param data Pointer to data for writing
+   * @param len Number of bytes to write
+   * @return Number of bytes written
+   */
+  size_t write(const void *data, size_t len);
+
+  /**
+   * @brief Adds a reader that starts at the current write position.
+   *
+   * The reader keeps the buffer allocated until it is destroyed.
+   *
+   * @return unique_ptr to the reader, nullptr if MAX_READERS readers already exist
+   */
+  std::unique_ptr<Reader> create_reader();
+
+  size_t size() const { return this->size_; }
+
+  static std::shared_ptr<SharedRingBuffer> create(size_t len);
+
+  /// One event group bit is used per reader to wake it up on new data
+  static const uint8_t MAX_READERS = 8;
+
+ protected:
+  uint8_t *storage_{nullptr};
+  size_t size_{0};
+  EventGroupHandle_t event_group_{nullptr};
+  std::atomic<EventBits_t> reader_bits_{0};
+  /// Total number of bytes written, updated once the data is in place.
+  std::atomic<uint32_t> written_{0};
+  /// Total number of bytes written once the current write finishes, updated before the data is copied. Readers
+  /// compare against it to detect data that was overwritten while they copied it.
+  std::atomic<uint32_t> writing_{0};
+};
+
 }  // namespace esphome
 
 #endif
@@ -5,6 +5,9 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#ifdef USE_RUNTIME_STATS
+#include "esphome/components/runtime_stats/runtime_stats.h"
+#endif
 #include <algorithm>
 #include <cinttypes>
 #include <cstring>
@@ -75,9 +78,24 @@ static void validate_static_string(const char *name) {
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
 // avoid the main thread modifying the list while it is being accessed.
 
+float Scheduler::next_interval_phase_(uint32_t interval) {
+  uint16_t index = 0;
+  auto it = std::find_if(this->interval_phases_.begin(), this->interval_phases_.end(),
+                         [interval](const std::pair<uint32_t, uint16_t> &phase) { return phase.first == interval; });
+  if (it == this->interval_phases_.end()) {
+    this->interval_phases_.emplace_back(interval, 0);
+  } else {
+    index = ++it->second;
+  }
+  // Fractional part of index * golden ratio: however many intervals there are, each new one lands in the largest
+  // gap left by the previous ones, and the same configuration always gets the same phases
+  float phase = index * 0.618034f;
+  return phase - static_cast<uint32_t>(phase);
+}
+
 // Common implementation for both timeout and interval
 void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type type, bool is_static_string,
-                                      const void *name_ptr, uint32_t delay, std::function<void()> func, bool is_retry,
+                                      const void *name_ptr, uint32_t delay, SchedulerCallback func, bool is_retry,
                                       bool skip_cancel) {
   // Get the name as const char*
   const char *name_cstr = this->get_name_cstr_(is_static_string, name_ptr);
@@ -125,6 +143,8 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   item->remove = false;
 #endif
   item->is_retry = is_retry;
+  if (name_cstr != nullptr)
+    item->index_hash_ = index_hash_(component, name_cstr, type);
 
 #ifndef ESPHOME_THREAD_SINGLE
   // Special handling for defer() (delay = 0, type = TIMEOUT)
@@ -134,7 +154,13 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
     if (!skip_cancel) {
       this->cancel_item_locked_(component, name_cstr, type);
     }
+    item->location = SchedulerItem::LOCATION_DEFER;
+    if (name_cstr != nullptr)
+      this->index_.insert(item.get());
     this->defer_queue_.push_back(std::move(item));
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+    App.wake_loop_threadsafe();
+#endif
     return;
   }
 #endif /* not ESPHOME_THREAD_SINGLE */
@@ -142,9 +168,9 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   // Type-specific setup
   if (type == SchedulerItem::INTERVAL) {
     item->interval = delay;
-    // first execution happens immediately after a random smallish offset
-    // Calculate random offset (0 to min(interval/2, 5s))
-    uint32_t offset = (uint32_t) (std::min(delay / 2, MAX_INTERVAL_DELAY) * random_float());
+    // first execution happens after a smallish offset (0 to min(interval/2, 5s)), spread evenly among the intervals
+    // of the same length so components polling at the same rate don't all run in the same loop iteration
+    uint32_t offset = (uint32_t) (std::min(delay / 2, MAX_INTERVAL_DELAY) * this->next_interval_phase_(delay));
     item->set_next_execution(now + offset);
     ESP_LOGV(TAG, "Scheduler interval for %s is %" PRIu32 "ms, offset %" PRIu32 "ms", name_cstr ? name_cstr : "", delay,
              offset);
@@ -173,8 +199,7 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
 
   // For retries, check if there's a cancelled timeout first
   if (is_retry && name_cstr != nullptr && type == SchedulerItem::TIMEOUT &&
-      (has_cancelled_timeout_in_container_(this->items_, component, name_cstr, /* match_retry= */ true) ||
-       has_cancelled_timeout_in_container_(this->to_add_, component, name_cstr, /* match_retry= */ true))) {
+      this->has_cancelled_retry_locked_(component, name_cstr)) {
     // Skip scheduling - the retry was cancelled
 #ifdef ESPHOME_DEBUG_SCHEDULER
     ESP_LOGD(TAG, "Skipping retry '%s' - found cancelled item", name_cstr);
@@ -189,15 +214,22 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   }
   // Add new item directly to to_add_
   // since we have the lock held
+  item->location = SchedulerItem::LOCATION_TO_ADD;
+  if (name_cstr != nullptr)
+    this->index_.insert(item.get());
   this->to_add_.push_back(std::move(item));
+#if defined(ESPHOME_TICKLESS_IDLE) && defined(USE_SOCKET_SELECT_SUPPORT)
+  // Only does something when called from another thread, the main loop never sleeps while it adds items
+  App.wake_loop_threadsafe();
+#endif
 }
 
-void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> func) {
+void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout, SchedulerCallback func) {
   this->set_timer_common_(component, SchedulerItem::TIMEOUT, true, name, timeout, std::move(func));
 }
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
-                                std::function<void()> func) {
+                                SchedulerCallback func) {
   this->set_timer_common_(component, SchedulerItem::TIMEOUT, false, &name, timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
@@ -207,12 +239,12 @@ bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
   return this->cancel_item_(component, true, name, SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> func) {
+                                 SchedulerCallback func) {
   this->set_timer_common_(component, SchedulerItem::INTERVAL, false, &name, interval, std::move(func));
 }
 
 void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval,
-                                 std::function<void()> func) {
+                                 SchedulerCallback func) {
   this->set_timer_common_(component, SchedulerItem::INTERVAL, true, name, interval, std::move(func));
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
@@ -305,14 +337,37 @@ optional<uint32_t> HOT Scheduler::next_schedule_in(uint32_t now) {
   // It performs cleanup and accesses items_[0] without holding a lock, which is only
   // safe when called from the main thread. Other threads must not call this method.
 
+  {
+    // Items added from callbacks or other threads are due on the next call()
+    LockGuard guard{this->lock_};
+    if (!this->to_add_.empty())
+      return 0;
+#ifndef ESPHOME_THREAD_SINGLE
+    if (!this->defer_queue_.empty())
+      return 0;
+#endif
+  }
+
   // If no items, return empty optional
   if (this->cleanup_() == 0)
     return {};
 
-  auto &item = this->items_[0];
   // Convert the fresh timestamp from caller (usually Application::loop()) to 64-bit
   const auto now_64 = this->millis_64_(now);  // 'now' from parameter - fresh from caller
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+  uint64_t next_exec;
+  {
+    // Other threads unlink cancelled items from the wheel slots, so the lock is needed to walk them
+    LockGuard guard{this->lock_};
+    auto next = this->items_.next_expiry();
+    if (!next.has_value())
+      return {};
+    next_exec = *next;
+  }
+#else
+  auto &item = this->items_[0];
   const uint64_t next_exec = item->get_next_execution();
+#endif
   if (next_exec < now_64)
     return 0;
   return next_exec - now_64;
@@ -347,7 +402,8 @@ void HOT Scheduler::call(uint32_t now) {
     if (!this->should_skip_item_(item.get())) {
       now = this->execute_item_(item.get(), now);
     }
-    // Recycle the defer item after execution
+    // Recycle the defer item after execution (the pool and index are protected by the lock)
+    LockGuard guard{this->lock_};
     this->recycle_item_(std::move(item));
   }
 #endif /* not ESPHOME_THREAD_SINGLE */
@@ -376,6 +432,19 @@ void HOT Scheduler::call(uint32_t now) {
 #endif /* else ESPHOME_THREAD_MULTI_ATOMICS */
     // Cleanup before debug output
     this->cleanup_();
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+    {
+      LockGuard guard{this->lock_};
+      this->items_.for_each([this, now_64](SchedulerItem *item) {
+        const char *name = item->get_name();
+        bool is_cancelled = is_item_removed_(item);
+        ESP_LOGD(TAG, "  %s '%s/%s' interval=%" PRIu32 " next_execution in %" PRIu64 "ms at %" PRIu64 "%s",
+                 item->get_type_str(), LOG_STR_ARG(item->get_source()), name ? name : "(null)", item->interval,
+                 item->get_next_execution() - now_64, item->get_next_execution(), is_cancelled ? " [CANCELLED]" : "");
+      });
+    }
+    ESP_LOGD(TAG, "\n");
+#else
     while (!this->items_.empty()) {
       std::unique_ptr<SchedulerItem> item;
       {
@@ -400,9 +469,72 @@ void HOT Scheduler::call(uint32_t now) {
       // Rebuild heap after moving items back
       std::make_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
     }
+#endif /* ESPHOME_SCHEDULER_TIMER_WHEEL */
   }
 #endif /* ESPHOME_DEBUG_SCHEDULER */
 
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+  // Move everything that is due to the wheel's expired list. Cancelled items are unlinked from the wheel
+  // immediately, so unlike the heap there is no bulk cleanup to do here.
+  {
+    LockGuard guard{this->lock_};
+    this->items_.advance(now_64);
+  }
+
+  // Other threads never remove items from the expired list (cancel only marks them), so reading
+  // the front without the lock is safe from the loop task.
+  while (SchedulerItem *item = this->items_.front()) {
+    // Don't run on failed components, and drop items cancelled after they expired
+    bool skip = item->component != nullptr && item->component->is_failed();
+#ifdef ESPHOME_THREAD_MULTI_NO_ATOMICS
+    if (!skip) {
+      // Multi-threaded platforms without atomics: must take lock to safely read remove flag
+      LockGuard guard{this->lock_};
+      skip = is_item_removed_(item);
+    }
+#else
+    skip = skip || is_item_removed_(item);
+#endif
+    if (skip) {
+      LockGuard guard{this->lock_};
+      this->recycle_item_(this->items_.pop_front());
+      continue;
+    }
+
+#ifdef ESPHOME_DEBUG_SCHEDULER
+    const char *item_name = item->get_name();
+    ESP_LOGV(TAG, "Running %s '%s/%s' with interval=%" PRIu32 " next_execution=%" PRIu64 " (now=%" PRIu64 ")",
+             item->get_type_str(), LOG_STR_ARG(item->get_source()), item_name ? item_name : "(null)", item->interval,
+             item->get_next_execution(), now_64);
+#endif /* ESPHOME_DEBUG_SCHEDULER */
+
+    // The item stays at the front of the expired list while it runs, so a cancel from the callback
+    // finds it and marks it removed.
+    now = this->execute_item_(item, now);
+
+    LockGuard guard{this->lock_};
+    auto executed_item = this->items_.pop_front();
+
+    if (executed_item->remove) {
+      // We were removed/cancelled in the function call, stop
+      this->recycle_item_(std::move(executed_item));
+      continue;
+    }
+
+    if (executed_item->type == SchedulerItem::INTERVAL) {
+      executed_item->set_next_execution(now_64 + executed_item->interval);
+      // Add new item directly to to_add_
+      // since we have the lock held
+      executed_item->location = SchedulerItem::LOCATION_TO_ADD;
+      this->to_add_.push_back(std::move(executed_item));
+    } else {
+      // Timeout completed - recycle it
+      this->recycle_item_(std::move(executed_item));
+    }
+
+    has_added_items |= !this->to_add_.empty();
+  }
+#else  /* not ESPHOME_SCHEDULER_TIMER_WHEEL */
   // Cleanup removed items before processing
   // First try to clean items from the top of the heap (fast path)
   this->cleanup_();
@@ -495,6 +627,7 @@ void HOT Scheduler::call(uint32_t now) {
     if (executed_item->remove) {
       // We were removed/cancelled in the function call, stop
       this->to_remove_--;
+      this->recycle_item_(std::move(executed_item));
       continue;
     }
 
@@ -502,6 +635,7 @@ void HOT Scheduler::call(uint32_t now) {
       executed_item->set_next_execution(now_64 + executed_item->interval);
       // Add new item directly to to_add_
       // since we have the lock held
+      executed_item->location = SchedulerItem::LOCATION_TO_ADD;
       this->to_add_.push_back(std::move(executed_item));
     } else {
       // Timeout completed - recycle it
@@ -510,6 +644,7 @@ void HOT Scheduler::call(uint32_t now) {
 
     has_added_items |= !this->to_add_.empty();
   }
+#endif /* ESPHOME_SCHEDULER_TIMER_WHEEL */
 
   if (has_added_items) {
     this->process_to_add();
@@ -524,12 +659,28 @@ void HOT Scheduler::process_to_add() {
       continue;
     }
 
+    it->location = SchedulerItem::LOCATION_ITEMS;
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+    this->items_.push(std::move(it));
+#else
     this->items_.push_back(std::move(it));
     std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+#endif
   }
   this->to_add_.clear();
 }
 size_t HOT Scheduler::cleanup_() {
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+  // Cancelled items are unlinked from the wheel right away, only those that were already in the
+  // expired list are left behind (and only marked). Drop them from the front.
+  LockGuard guard{this->lock_};
+  while (SchedulerItem *item = this->items_.front()) {
+    if (!is_item_removed_(item))
+      break;
+    this->recycle_item_(this->items_.pop_front());
+  }
+  return this->items_.size();
+#else
   // Fast path: if nothing to remove, just return the current size
   // Reading to_remove_ without lock is safe because:
   // 1. We only call this from the main thread during call()
@@ -557,7 +708,9 @@ size_t HOT Scheduler::cleanup_() {
     this->pop_raw_();
   }
   return this->items_.size();
+#endif /* ESPHOME_SCHEDULER_TIMER_WHEEL */
 }
+#ifndef ESPHOME_SCHEDULER_TIMER_WHEEL
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
 
@@ -566,12 +719,26 @@ void HOT Scheduler::pop_raw_() {
 
   this->items_.pop_back();
 }
+#endif
 
 // Helper to execute a scheduler item
 uint32_t HOT Scheduler::execute_item_(SchedulerItem *item, uint32_t now) {
   App.set_current_component(item->component);
   WarnIfComponentBlockingGuard guard{item->component, now};
+#ifdef USE_RUNTIME_STATS
+  const uint32_t start_us = micros();
+#endif
   item->callback();
+#ifdef USE_RUNTIME_STATS
+  if (global_runtime_stats != nullptr) {
+    // PollingComponent::update() runs from the interval it registers as "update"
+    const char *name = item->get_name();
+    const bool is_update = item->type == SchedulerItem::INTERVAL && name != nullptr && strcmp(name, "update") == 0;
+    global_runtime_stats->record_latency(item->component,
+                                         is_update ? runtime_stats::SOURCE_UPDATE : runtime_stats::SOURCE_SCHEDULER,
+                                         micros() - start_us);
+  }
+#endif
   return guard.finish();
 }
 
@@ -596,51 +763,46 @@ bool HOT Scheduler::cancel_item_locked_(Component *component, const char *name_c
 
   size_t total_cancelled = 0;
 
-  // Check all containers for matching items
-#ifndef ESPHOME_THREAD_SINGLE
-  // Mark items in defer queue as cancelled (they'll be skipped when processed)
-  if (type == SchedulerItem::TIMEOUT) {
-    for (auto &item : this->defer_queue_) {
-      if (this->matches_item_(item, component, name_cstr, type, match_retry)) {
-        this->mark_item_removed_(item.get());
-        total_cancelled++;
-      }
-    }
-  }
-#endif /* not ESPHOME_THREAD_SINGLE */
-
-  // Cancel items in the main heap
-  // Special case: if the last item in the heap matches, we can remove it immediately
-  // (removing the last element doesn't break heap structure)
-  if (!this->items_.empty()) {
-    auto &last_item = this->items_.back();
-    if (this->matches_item_(last_item, component, name_cstr, type, match_retry)) {
-      this->recycle_item_(std::move(this->items_.back()));
-      this->items_.pop_back();
-      total_cancelled++;
-    }
-    // For other items in heap, we can only mark for removal (can't remove from middle of heap)
-    for (auto &item : this->items_) {
-      if (this->matches_item_(item, component, name_cstr, type, match_retry)) {
-        this->mark_item_removed_(item.get());
-        total_cancelled++;
-        this->to_remove_++;  // Track removals for heap items
-      }
-    }
-  }
-
-  // Cancel items in to_add_
-  for (auto &item : this->to_add_) {
-    if (this->matches_item_(item, component, name_cstr, type, match_retry)) {
-      this->mark_item_removed_(item.get());
+  // All named items in items_, to_add_ and defer_queue_ are indexed, so only the few candidates
+  // sharing the key hash need to be checked instead of every container.
+  this->index_.find(index_hash_(component, name_cstr, type), [&](SchedulerItem *item) {
+    if (!this->matches_item_(item, component, name_cstr, type, match_retry))
+      return;
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+    // Items waiting in the wheel are unlinked and recycled right away. Expired items may be running
+    // (or about to run) in call(), so like items in to_add_ and defer_queue_ they are only marked.
+    if (item->location == SchedulerItem::LOCATION_ITEMS && !TimerWheel<SchedulerItem>::is_expired(item)) {
+      this->recycle_item_(this->items_.remove(item));
       total_cancelled++;
-      // Don't track removals for to_add_ items
+      return;
     }
-  }
+#else
+    // Items can't be removed from the middle of the heap (and the top one may be running right now),
+    // so mark them and let cleanup_() drop them. Items in to_add_ and defer_queue_ are dropped when processed.
+    if (item->location == SchedulerItem::LOCATION_ITEMS)
+      this->to_remove_++;  // Track removals for heap items
+#endif
+    this->mark_item_removed_(item);
+    total_cancelled++;
+  });
 
   return total_cancelled > 0;
 }
 
+// Check for a cancelled retry timeout that is still queued - must be called with lock held
+bool HOT Scheduler::has_cancelled_retry_locked_(Component *component, const char *name_cstr) {
+  bool found = false;
+  this->index_.find(index_hash_(component, name_cstr, SchedulerItem::TIMEOUT), [&](SchedulerItem *item) {
+    // Only items_ and to_add_ are considered, the defer queue holds the first attempt of a retry
+    if (!found && item->location != SchedulerItem::LOCATION_DEFER && is_item_removed_(item) &&
+        this->matches_item_(item, component, name_cstr, SchedulerItem::TIMEOUT, /* match_retry= */ true,
+                            /* skip_removed= */ false)) {
+      found = true;
+    }
+  });
+  return found;
+}
+
 uint64_t Scheduler::millis_64_(uint32_t now) {
   // THREAD SAFETY NOTE:
   // This function has three implementations, based on the precompiler flags
@@ -811,6 +973,11 @@ void Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
   if (!item)
     return;
 
+  // Every named item that leaves the scheduler passes through here, drop it from the index
+  if (item->get_name() != nullptr)
+    this->index_.erase(item.get());
+  item->location = SchedulerItem::LOCATION_NONE;
+
   if (this->scheduler_item_pool_.size() < MAX_POOL_SIZE) {
     // Clear callback to release captured resources
     item->callback = nullptr;
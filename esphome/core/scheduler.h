@@ -5,12 +5,17 @@
 #include <memory>
 #include <cstring>
 #include <deque>
+#include <utility>
 #ifdef ESPHOME_THREAD_MULTI_ATOMICS
 #include <atomic>
 #endif
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/scheduler_index.h"
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+#include "esphome/core/timer_wheel.h"
+#endif
 
 namespace esphome {
 
@@ -31,7 +36,7 @@ class Scheduler {
 
  public:
   // Public API - accepts std::string for backward compatibility
-  void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
+  void set_timeout(Component *component, const std::string &name, uint32_t timeout, SchedulerCallback func);
 
   /** Set a timeout with a const char* name.
    *
@@ -43,12 +48,12 @@ class Scheduler {
    *
    * For dynamic strings, use the std::string overload instead.
    */
-  void set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> func);
+  void set_timeout(Component *component, const char *name, uint32_t timeout, SchedulerCallback func);
 
   bool cancel_timeout(Component *component, const std::string &name);
   bool cancel_timeout(Component *component, const char *name);
 
-  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
+  void set_interval(Component *component, const std::string &name, uint32_t interval, SchedulerCallback func);
 
   /** Set an interval with a const char* name.
    *
@@ -60,7 +65,7 @@ class Scheduler {
    *
    * For dynamic strings, use the std::string overload instead.
    */
-  void set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> func);
+  void set_interval(Component *component, const char *name, uint32_t interval, SchedulerCallback func);
 
   bool cancel_interval(Component *component, const std::string &name);
   bool cancel_interval(Component *component, const char *name);
@@ -74,6 +79,7 @@ class Scheduler {
   // Calculate when the next scheduled item should run
   // @param now Fresh timestamp from millis() - must not be stale/cached
   // Returns the time in milliseconds until the next scheduled item, or nullopt if no items
+  // Returns 0 if items added by callbacks or other threads (including defers) are waiting for the next call()
   // This method performs cleanup of removed items before checking the schedule
   // IMPORTANT: This method should only be called from the main thread (loop task).
   optional<uint32_t> next_schedule_in(uint32_t now);
@@ -102,7 +108,9 @@ class Scheduler {
     // even when devices run for months. Split into two fields for better memory
     // alignment on 32-bit systems.
     uint32_t next_execution_low_;  // Lower 32 bits of execution time (millis value)
-    std::function<void()> callback;
+    // Key hash of (component, name, type) for the scheduler's index, only meaningful for named items
+    uint32_t index_hash_;
+    SchedulerCallback callback;
     uint16_t next_execution_high_;  // Upper 16 bits (millis_major counter)
 
 #ifdef ESPHOME_THREAD_MULTI_ATOMICS
@@ -110,19 +118,30 @@ class Scheduler {
     // Place atomic<bool> separately since it can't be packed with bit fields
     std::atomic<bool> remove{false};
 
-    // Bit-packed fields (3 bits used, 5 bits padding in 1 byte)
+    // Bit-packed fields (5 bits used, 3 bits padding in 1 byte)
     enum Type : uint8_t { TIMEOUT, INTERVAL } type : 1;
     bool name_is_dynamic : 1;  // True if name was dynamically allocated (needs delete[])
     bool is_retry : 1;         // True if this is a retry timeout
-                               // 5 bits padding
+    // Which container currently holds the item
+    enum Location : uint8_t { LOCATION_NONE, LOCATION_TO_ADD, LOCATION_ITEMS, LOCATION_DEFER } location : 2;
+    // 3 bits padding
 #else
     // Single-threaded or multi-threaded without atomics: can pack all fields together
-    // Bit-packed fields (4 bits used, 4 bits padding in 1 byte)
+    // Bit-packed fields (6 bits used, 2 bits padding in 1 byte)
     enum Type : uint8_t { TIMEOUT, INTERVAL } type : 1;
     bool remove : 1;
     bool name_is_dynamic : 1;  // True if name was dynamically allocated (needs delete[])
     bool is_retry : 1;         // True if this is a retry timeout
-                               // 4 bits padding
+    // Which container currently holds the item
+    enum Location : uint8_t { LOCATION_NONE, LOCATION_TO_ADD, LOCATION_ITEMS, LOCATION_DEFER } location : 2;
+    // 2 bits padding
+#endif
+
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+    // Intrusive links for the timer wheel backend, managed by TimerWheel
+    SchedulerItem *wheel_next_{nullptr};
+    SchedulerItem *wheel_prev_{nullptr};
+    uint8_t wheel_slot_{TimerWheel<SchedulerItem>::SLOT_NONE};
 #endif
 
     // Constructor
@@ -130,17 +149,20 @@ class Scheduler {
         : component(nullptr),
           interval(0),
           next_execution_low_(0),
+          index_hash_(0),
           next_execution_high_(0),
 #ifdef ESPHOME_THREAD_MULTI_ATOMICS
           // remove is initialized in the member declaration as std::atomic<bool>{false}
           type(TIMEOUT),
           name_is_dynamic(false),
-          is_retry(false) {
+          is_retry(false),
+          location(LOCATION_NONE) {
 #else
           type(TIMEOUT),
           remove(false),
           name_is_dynamic(false),
-          is_retry(false) {
+          is_retry(false),
+          location(LOCATION_NONE) {
 #endif
       name_.static_name = nullptr;
     }
@@ -209,7 +231,7 @@ class Scheduler {
 
   // Common implementation for both timeout and interval
   void set_timer_common_(Component *component, SchedulerItem::Type type, bool is_static_string, const void *name_ptr,
-                         uint32_t delay, std::function<void()> func, bool is_retry = false, bool skip_cancel = false);
+                         uint32_t delay, SchedulerCallback func, bool is_retry = false, bool skip_cancel = false);
 
   // Common implementation for retry
   void set_retry_common_(Component *component, bool is_static_string, const void *name_ptr, uint32_t initial_wait_time,
@@ -220,12 +242,18 @@ class Scheduler {
   // Returns the number of items remaining after cleanup
   // IMPORTANT: This method should only be called from the main thread (loop task).
   size_t cleanup_();
+#ifndef ESPHOME_SCHEDULER_TIMER_WHEEL
   void pop_raw_();
+#endif
 
  private:
   // Helper to cancel items by name - must be called with lock held
   bool cancel_item_locked_(Component *component, const char *name, SchedulerItem::Type type, bool match_retry = false);
 
+  // Returns the phase (0 to 1) of the first execution of the next interval of this length - must be called with lock
+  // held
+  float next_interval_phase_(uint32_t interval);
+
   // Helper to extract name as const char* from either static string or std::string
   inline const char *get_name_cstr_(bool is_static_string, const void *name_ptr) {
     return is_static_string ? static_cast<const char *>(name_ptr) : static_cast<const std::string *>(name_ptr)->c_str();
@@ -244,7 +272,7 @@ class Scheduler {
   }
 
   // Helper function to check if item matches criteria for cancellation
-  inline bool HOT matches_item_(const std::unique_ptr<SchedulerItem> &item, Component *component, const char *name_cstr,
+  inline bool HOT matches_item_(const SchedulerItem *item, Component *component, const char *name_cstr,
                                 SchedulerItem::Type type, bool match_retry, bool skip_removed = true) const {
     if (item->component != component || item->type != type || (skip_removed && item->remove) ||
         (match_retry && !item->is_retry)) {
@@ -295,28 +323,35 @@ class Scheduler {
 #endif
   }
 
-  // Template helper to check if any item in a container matches our criteria
-  template<typename Container>
-  bool has_cancelled_timeout_in_container_(const Container &container, Component *component, const char *name_cstr,
-                                           bool match_retry) const {
-    for (const auto &item : container) {
-      if (is_item_removed_(item.get()) &&
-          this->matches_item_(item, component, name_cstr, SchedulerItem::TIMEOUT, match_retry,
-                              /* skip_removed= */ false)) {
-        return true;
-      }
-    }
-    return false;
+  // Check if there is a cancelled retry timeout that is still queued (used to stop a retry chain)
+  bool has_cancelled_retry_locked_(Component *component, const char *name_cstr);
+
+  // Key hash for the item index
+  static uint32_t index_hash_(Component *component, const char *name_cstr, SchedulerItem::Type type) {
+    return fnv1_hash(name_cstr) ^ (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 2654435761UL) ^
+           static_cast<uint32_t>(type);
   }
 
   Mutex lock_;
+#ifdef ESPHOME_SCHEDULER_TIMER_WHEEL
+  // Hierarchical timer wheel: O(1) insert/cancel, items are due once they reach the wheel's expired list
+  TimerWheel<SchedulerItem> items_;
+#else
+  // Min-heap ordered by next execution time
   std::vector<std::unique_ptr<SchedulerItem>> items_;
+#endif
+  // Index of all named items in items_, to_add_ and defer_queue_, so that cancel and replace
+  // don't have to walk every container. Items leave the index when they are recycled.
+  SchedulerIndex<SchedulerItem> index_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
 #ifndef ESPHOME_THREAD_SINGLE
   // Single-core platforms don't need the defer queue and save 40 bytes of RAM
   std::deque<std::unique_ptr<SchedulerItem>> defer_queue_;  // FIFO queue for defer() calls
 #endif                                                      /* ESPHOME_THREAD_SINGLE */
+#ifndef ESPHOME_SCHEDULER_TIMER_WHEEL
+  // Number of cancelled items still in the heap, the timer wheel unlinks them immediately instead
   uint32_t to_remove_{0};
+#endif
 
   // Memory pool for recycling SchedulerItem objects to reduce heap churn.
   // Design decisions:
@@ -328,6 +363,10 @@ class Scheduler {
   //   to synchronize between tasks (see https://github.com/esphome/backlog/issues/52)
   std::vector<std::unique_ptr<SchedulerItem>> scheduler_item_pool_;
 
+  // Number of intervals registered so far for each interval length, e.g. all polling components updating every 30s.
+  // Only touched when an interval is set, a configuration rarely has more than a handful of different lengths.
+  std::vector<std::pair<uint32_t, uint16_t>> interval_phases_;
+
 #ifdef ESPHOME_THREAD_MULTI_ATOMICS
   /*
    * Multi-threaded platforms with atomic support: last_millis_ needs atomic for lock-free updates
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+
+// Compact open-addressing hash index used by the Scheduler to find items by (component, name, type)
+// without walking all of its containers.
+//
+// Only pointers are stored, every item carries its precomputed key hash in `index_hash_`. Several items
+// may share a key (parallel DelayAction instances, or cancelled items that have not been recycled yet),
+// find() visits all of them and the caller does the exact match. Linear probing over a power-of-two table;
+// erased entries leave a tombstone until the next rehash, which happens when more than 3/4 of the slots
+// are in use (tombstones included).
+//
+// @tparam T Item type. Must provide a `uint32_t index_hash_` member that does not change while indexed.
+//
+// Not thread-safe, callers must provide their own locking.
+template<class T> class SchedulerIndex {
+ public:
+  size_t size() const { return this->size_; }
+
+  void insert(T *item) {
+    if ((this->used_ + 1) * 4 > this->capacity_ * 3)
+      this->rehash_();
+    const uint32_t mask = this->capacity_ - 1;
+    uint32_t i = item->index_hash_ & mask;
+    while (this->table_[i] != nullptr && this->table_[i] != tombstone())
+      i = (i + 1) & mask;
+    if (this->table_[i] == nullptr)
+      this->used_++;
+    this->table_[i] = item;
+    this->size_++;
+  }
+
+  /// Remove an item, returns false if it was not indexed.
+  bool erase(T *item) {
+    if (this->capacity_ == 0)
+      return false;
+    const uint32_t mask = this->capacity_ - 1;
+    for (uint32_t i = item->index_hash_ & mask; this->table_[i] != nullptr; i = (i + 1) & mask) {
+      if (this->table_[i] == item) {
+        this->table_[i] = tombstone();
+        this->size_--;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Call f(T *) for every indexed item with the given key hash. f may erase the item it is called with.
+  template<typename F> void find(uint32_t hash, F &&f) const {
+    if (this->capacity_ == 0)
+      return;
+    const uint32_t mask = this->capacity_ - 1;
+    for (uint32_t i = hash & mask; this->table_[i] != nullptr; i = (i + 1) & mask) {
+      T *item = this->table_[i];
+      if (item != tombstone() && item->index_hash_ == hash)
+        f(item);
+    }
+  }
+
+ protected:
+  // Marks an erased slot, probing continues past it
+  static T *tombstone() {
+    return reinterpret_cast<T *>(alignof(T));  // NOLINT(performance-no-int-to-ptr)
+  }
+
+  // Resize for the live items only (drops tombstones), keeping the load factor at or below 1/2
+  void rehash_() {
+    uint32_t capacity = 8;
+    while (capacity < (this->size_ + 1) * 2)
+      capacity <<= 1;
+    std::unique_ptr<T *[]> old = std::move(this->table_);
+    const uint32_t old_capacity = this->capacity_;
+    this->table_ = std::unique_ptr<T *[]>(new T *[capacity]());
+    this->capacity_ = capacity;
+    this->size_ = 0;
+    this->used_ = 0;
+    for (uint32_t i = 0; i < old_capacity; i++) {
+      if (old[i] != nullptr && old[i] != tombstone())
+        this->insert(old[i]);
+    }
+  }
+
+  std::unique_ptr<T *[]> table_;
+  uint32_t capacity_{0};
+  // Live entries
+  uint32_t size_{0};
+  // Live entries + tombstones
+  uint32_t used_{0};
+};
+
+}  // namespace esphome
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include "esphome/core/optional.h"
+
+namespace esphome {
+
+// Hierarchical timer wheel - alternative backend for the Scheduler (ESPHOME_SCHEDULER_TIMER_WHEEL)
+//
+// Items are kept in intrusive doubly linked lists, one per slot. Level 0 has 1ms resolution, every
+// higher level covers SLOTS times the range of the level below it. Items that are further away than
+// the range of the top level are parked in an overflow list that is re-examined on every top level wrap.
+// When the wheel advances, slots of higher levels are cascaded down so that items always expire at
+// their exact millisecond, and expired items are moved to a FIFO list that the owner consumes.
+//
+// Complexity: push/remove are O(1), advance is O(slots passed), next_expiry is O(LEVELS + slot length).
+//
+// The wheel works on the 48-bit scheduler time space (see Scheduler::SchedulerItem), stored in uint64_t.
+//
+// @tparam T Item type. Must provide `T *wheel_next_`, `T *wheel_prev_`, `uint8_t wheel_slot_` members and
+//           a `uint64_t get_next_execution() const` method returning the absolute expiry time in ms.
+//
+// The wheel owns the items it holds; ownership is transferred in push() and handed back by pop_front()
+// and remove(). It is not thread-safe, callers must provide their own locking.
+template<class T> class TimerWheel {
+ public:
+  static constexpr uint8_t SLOT_BITS = 5;
+  static constexpr uint8_t SLOTS = 1 << SLOT_BITS;
+  static constexpr uint32_t SLOT_MASK = SLOTS - 1;
+  // 4 levels of 32 slots cover 2^20 ms (~17.5 minutes), anything beyond goes to the overflow list
+  static constexpr uint8_t LEVELS = 4;
+  static constexpr uint8_t SLOT_OVERFLOW = LEVELS * SLOTS;
+  static constexpr uint8_t SLOT_EXPIRED = SLOT_OVERFLOW + 1;
+  static constexpr uint8_t SLOT_NONE = 0xFF;
+
+  TimerWheel() = default;
+  TimerWheel(const TimerWheel &) = delete;
+  TimerWheel &operator=(const TimerWheel &) = delete;
+
+  ~TimerWheel() {
+    this->for_each([](T *item) { delete item; });
+  }
+
+  /// Total number of items held, including expired ones that have not been popped yet
+  size_t size() const { return this->wheel_count_ + this->expired_count_; }
+  bool empty() const { return this->size() == 0; }
+
+  /// Insert an item, placing it by its expiry relative to the current wheel time.
+  /// Items that are already due go straight to the expired list.
+  void push(std::unique_ptr<T> item) { this->place_(item.release()); }
+
+  /// Oldest expired item, or nullptr if nothing is due. The item stays owned by the wheel.
+  T *front() const { return this->expired_head_; }
+
+  /// Remove and return the oldest expired item.
+  std::unique_ptr<T> pop_front() {
+    T *item = this->expired_head_;
+    if (item == nullptr)
+      return nullptr;
+    this->unlink_(item);
+    return std::unique_ptr<T>(item);
+  }
+
+  /// Remove an item from wherever it is in the wheel in O(1). The item must be held by this wheel.
+  std::unique_ptr<T> remove(T *item) {
+    this->unlink_(item);
+    return std::unique_ptr<T>(item);
+  }
+
+  /// True if the item is in the expired list (i.e. due and waiting to be executed).
+  static bool is_expired(const T *item) { return item->wheel_slot_ == SLOT_EXPIRED; }
+
+  /// Move all items with an expiry <= now to the expired list.
+  void advance(uint64_t now) {
+    while (this->current_ <= now) {
+      if (this->wheel_count_ == 0) {
+        // Nothing to cascade, jump straight to now
+        this->current_ = now + 1;
+        return;
+      }
+      const uint32_t idx = this->current_ & SLOT_MASK;
+      if (idx == 0)
+        this->cascade_(1);
+      const uint32_t pending = this->occupied_[0] >> idx;
+      if (pending == 0) {
+        // Nothing left in this row of level 0. Nothing can expire before the next slot boundary of the
+        // lowest occupied level cascades, so jump straight there (but never past now + 1).
+        uint8_t level = 0;
+        while (level < LEVELS && this->occupied_[level] == 0)
+          level++;
+        if (level == 0)
+          level = 1;
+        const uint64_t range_mask = (uint64_t(1) << (SLOT_BITS * level)) - 1;
+        const uint64_t next_boundary = (this->current_ | range_mask) + 1;
+        this->current_ = next_boundary > now + 1 ? now + 1 : next_boundary;
+        continue;
+      }
+      const uint32_t slot = idx + __builtin_ctz(pending);
+      const uint64_t expiry = this->current_ + (slot - idx);
+      if (expiry > now) {
+        this->current_ = now + 1;
+        return;
+      }
+      this->expire_slot_(slot);
+      this->current_ = expiry + 1;
+    }
+  }
+
+  /// Earliest expiry of all items held, or nullopt if empty.
+  /// If there are expired items, the expiry of the oldest one is returned.
+  optional<uint64_t> next_expiry() const {
+    if (this->expired_head_ != nullptr)
+      return this->expired_head_->get_next_execution();
+    if (this->wheel_count_ == 0)
+      return {};
+
+    uint64_t best = UINT64_MAX;
+    // Level 0: all items in a slot share the same expiry, so the first occupied slot is exact
+    const uint32_t bits = this->occupied_[0];
+    if (bits != 0) {
+      const uint32_t idx = this->current_ & SLOT_MASK;
+      const uint32_t ahead = bits >> idx;
+      const uint32_t offset = ahead != 0 ? __builtin_ctz(ahead) : SLOTS - idx + __builtin_ctz(bits);
+      best = this->current_ + offset;
+    }
+    // Higher levels: the first occupied slot (in wheel order) holds the earliest items of that level.
+    // The slot of the current index has already been cascaded unless current_ sits exactly on its start,
+    // so it only holds items one full revolution ahead and is checked last.
+    for (uint8_t level = 1; level < LEVELS; level++) {
+      const uint32_t level_bits = this->occupied_[level];
+      if (level_bits == 0)
+        continue;
+      const uint8_t shift = SLOT_BITS * level;
+      const uint32_t idx = (this->current_ >> shift) & SLOT_MASK;
+      const bool at_slot_start = (this->current_ & ((uint64_t(1) << shift) - 1)) == 0;
+      const uint32_t start = at_slot_start ? idx : (idx + 1) & SLOT_MASK;
+      const uint32_t rotated = (level_bits >> start) | (start == 0 ? 0 : level_bits << (SLOTS - start));
+      const uint32_t slot = (start + __builtin_ctz(rotated)) & SLOT_MASK;
+      best = std::min(best, min_expiry_(this->heads_[level * SLOTS + slot]));
+    }
+    // Overflow items always expire at or after the next top level wrap
+    const uint64_t top_range = uint64_t(1) << (SLOT_BITS * LEVELS);
+    // (current_ sitting exactly on a wrap means that wrap has not been cascaded yet)
+    const uint64_t last = this->current_ == 0 ? 0 : this->current_ - 1;
+    const uint64_t next_wrap = (last & ~(top_range - 1)) + top_range;
+    if (best >= next_wrap)
+      best = std::min(best, min_expiry_(this->heads_[SLOT_OVERFLOW]));
+    return best;
+  }
+
+  /// Call f(T *) for every item held, expired items first. f may remove the item it is called with.
+  template<typename F> void for_each(F &&f) {
+    for_each_in_list_(this->expired_head_, f);
+    for (uint8_t slot = 0; slot <= SLOT_OVERFLOW; slot++)
+      for_each_in_list_(this->heads_[slot], f);
+  }
+
+ protected:
+  template<typename F> static void for_each_in_list_(T *item, F &f) {
+    while (item != nullptr) {
+      T *next = item->wheel_next_;
+      f(item);
+      item = next;
+    }
+  }
+
+  static uint64_t min_expiry_(const T *item) {
+    uint64_t best = UINT64_MAX;
+    for (; item != nullptr; item = item->wheel_next_)
+      best = std::min(best, item->get_next_execution());
+    return best;
+  }
+
+  void place_(T *item) {
+    const uint64_t expiry = item->get_next_execution();
+    if (expiry < this->current_) {
+      this->append_expired_(item);
+      return;
+    }
+    const uint64_t delta = expiry - this->current_;
+    for (uint8_t level = 0; level < LEVELS; level++) {
+      if (delta < (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        this->link_(level * SLOTS + ((expiry >> (SLOT_BITS * level)) & SLOT_MASK), item);
+        return;
+      }
+    }
+    this->link_(SLOT_OVERFLOW, item);
+  }
+
+  void link_(uint8_t slot, T *item) {
+    item->wheel_slot_ = slot;
+    item->wheel_prev_ = nullptr;
+    item->wheel_next_ = this->heads_[slot];
+    if (item->wheel_next_ != nullptr)
+      item->wheel_next_->wheel_prev_ = item;
+    this->heads_[slot] = item;
+    if (slot < SLOT_OVERFLOW)
+      this->occupied_[slot >> SLOT_BITS] |= 1u << (slot & SLOT_MASK);
+    this->wheel_count_++;
+  }
+
+  void append_expired_(T *item) {
+    item->wheel_slot_ = SLOT_EXPIRED;
+    item->wheel_next_ = nullptr;
+    item->wheel_prev_ = this->expired_tail_;
+    if (this->expired_tail_ != nullptr) {
+      this->expired_tail_->wheel_next_ = item;
+    } else {
+      this->expired_head_ = item;
+    }
+    this->expired_tail_ = item;
+    this->expired_count_++;
+  }
+
+  void unlink_(T *item) {
+    const uint8_t slot = item->wheel_slot_;
+    T *prev = item->wheel_prev_;
+    T *next = item->wheel_next_;
+    if (next != nullptr)
+      next->wheel_prev_ = prev;
+    if (slot == SLOT_EXPIRED) {
+      if (prev != nullptr) {
+        prev->wheel_next_ = next;
+      } else {
+        this->expired_head_ = next;
+      }
+      if (next == nullptr)
+        this->expired_tail_ = prev;
+      this->expired_count_--;
+    } else {
+      if (prev != nullptr) {
+        prev->wheel_next_ = next;
+      } else {
+        this->heads_[slot] = next;
+      }
+      if (this->heads_[slot] == nullptr && slot < SLOT_OVERFLOW)
+        this->occupied_[slot >> SLOT_BITS] &= ~(1u << (slot & SLOT_MASK));
+      this->wheel_count_--;
+    }
+    item->wheel_slot_ = SLOT_NONE;
+    item->wheel_next_ = nullptr;
+    item->wheel_prev_ = nullptr;
+  }
+
+  // Detach a slot's list and return its head
+  T *detach_(uint8_t slot) {
+    T *head = this->heads_[slot];
+    this->heads_[slot] = nullptr;
+    if (slot < SLOT_OVERFLOW)
+      this->occupied_[slot >> SLOT_BITS] &= ~(1u << (slot & SLOT_MASK));
+    for (T *item = head; item != nullptr; item = item->wheel_next_)
+      this->wheel_count_--;
+    return head;
+  }
+
+  void expire_slot_(uint8_t slot) {
+    T *item = this->detach_(slot);
+    if (item == nullptr)
+      return;
+    // Slots are filled at the head, walk back from the tail to keep insertion (FIFO) order
+    while (item->wheel_next_ != nullptr)
+      item = item->wheel_next_;
+    while (item != nullptr) {
+      T *prev = item->wheel_prev_;
+      this->append_expired_(item);
+      item = prev;
+    }
+  }
+
+  // Re-distribute the current slot of a level into the levels below it.
+  // Must be called when all lower level indices of current_ are 0.
+  void cascade_(uint8_t level) {
+    uint8_t slot = SLOT_OVERFLOW;
+    if (level < LEVELS) {
+      const uint32_t idx = (this->current_ >> (SLOT_BITS * level)) & SLOT_MASK;
+      if (idx == 0)
+        this->cascade_(level + 1);
+      slot = level * SLOTS + idx;
+    }
+    T *item = this->detach_(slot);
+    while (item != nullptr) {
+      T *next = item->wheel_next_;
+      this->place_(item);
+      item = next;
+    }
+  }
+
+  T *heads_[SLOT_OVERFLOW + 1]{};
+  T *expired_head_{nullptr};
+  T *expired_tail_{nullptr};
+  // Time (ms) up to which the wheel has been advanced, all items expiring before it are in the expired list
+  uint64_t current_{0};
+  uint32_t occupied_[LEVELS]{};
+  uint32_t wheel_count_{0};
+  uint32_t expired_count_{0};
+};
+
+}  // namespace esphome
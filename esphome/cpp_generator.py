@@ -5,6 +5,7 @@ import math
 import re
 from typing import Any
 
+from esphome.const import KEY_CORE, KEY_SETUP_ARENA
 from esphome.core import (
     CORE,
     ID,
@@ -588,7 +589,10 @@ def new_Pvariable(id_: ID, *args: SafeExpType) -> Pvariable:
         id_ = id_.copy()
         id_.type = id_.type.template(args[0])
         args = args[1:]
-    rhs = id_.type.new(*args)
+    if CORE.data.get(KEY_CORE, {}).get(KEY_SETUP_ARENA):
+        rhs = MockObj(f"new (esphome::global_arena) {id_.type}", "->")(*args)
+    else:
+        rhs = id_.type.new(*args)
     return Pvariable(id_, rhs)
 
 
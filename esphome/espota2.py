@@ -24,6 +24,7 @@ RESPONSE_RECEIVE_OK = 0x44
 RESPONSE_UPDATE_END_OK = 0x45
 RESPONSE_SUPPORTS_COMPRESSION = 0x46
 RESPONSE_CHUNK_OK = 0x47
+RESPONSE_RESUME_OK = 0x48
 
 RESPONSE_ERROR_MAGIC = 0x80
 RESPONSE_ERROR_UPDATE_PREPARE = 0x81
@@ -45,10 +46,15 @@ OTA_VERSION_2_0 = 2
 MAGIC_BYTES = [0x6C, 0x26, 0xF7, 0x5C, 0x45]
 
 FEATURE_SUPPORTS_COMPRESSION = 0x01
+FEATURE_SUPPORTS_RESUME = 0x02
 
 
 UPLOAD_BLOCK_SIZE = 8192
 UPLOAD_BUFFER_SIZE = UPLOAD_BLOCK_SIZE * 8
+# Number of blocks that may be sent before their acknowledgement arrives
+UPLOAD_WINDOW = 4
+# How often a broken upload is reconnected and resumed before giving up
+UPLOAD_RESUME_ATTEMPTS = 3
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -81,6 +87,10 @@ class OTAError(EsphomeError):
     pass
 
 
+class OTATransferError(OTAError):
+    """The connection broke while sending the image, the upload can be resumed."""
+
+
 def recv_decode(sock, amount, decode=True):
     data = sock.recv(amount)
     if not decode:
@@ -177,6 +187,16 @@ def check_error(data, expect):
         raise OTAError(f"Unexpected response from ESP: 0x{data[0]:02X}")
 
 
+def receive_chunk_ok(sock):
+    try:
+        data = recv_decode(sock, 1)
+    except OSError as err:
+        raise OTATransferError(f"Error receiving chunk OK: {err}") from err
+    if not data:
+        raise OTATransferError("Connection closed while receiving chunk OK")
+    check_error(data, RESPONSE_CHUNK_OK)
+
+
 def send_check(sock, data, msg):
     try:
         if isinstance(data, (list, tuple)):
@@ -211,13 +231,16 @@ def perform_ota(
         )
 
     # Features
-    send_check(sock, FEATURE_SUPPORTS_COMPRESSION, "features")
+    send_check(
+        sock, FEATURE_SUPPORTS_COMPRESSION | FEATURE_SUPPORTS_RESUME, "features"
+    )
     features = receive_exactly(
         sock, 1, "features", [RESPONSE_HEADER_OK, RESPONSE_SUPPORTS_COMPRESSION]
     )[0]
 
     if features == RESPONSE_SUPPORTS_COMPRESSION:
-        upload_contents = gzip.compress(file_contents, compresslevel=9)
+        # Fixed mtime so a resumed upload produces the same image and MD5
+        upload_contents = gzip.compress(file_contents, compresslevel=9, mtime=0)
         _LOGGER.info("Compressed to %s bytes", len(upload_contents))
     else:
         upload_contents = file_contents
@@ -264,7 +287,13 @@ def perform_ota(
     _LOGGER.debug("MD5 of upload is %s", upload_md5)
 
     send_check(sock, upload_md5, "file checksum")
-    receive_exactly(sock, 1, "file checksum", RESPONSE_BIN_MD5_OK)
+    (md5_ok,) = receive_exactly(
+        sock, 1, "file checksum", [RESPONSE_BIN_MD5_OK, RESPONSE_RESUME_OK]
+    )
+    offset = 0
+    if md5_ok == RESPONSE_RESUME_OK:
+        offset = int.from_bytes(bytes(receive_exactly(sock, 4, "resume offset", [])))
+        _LOGGER.info("Resuming upload at %s bytes", offset)
 
     # Disable nodelay for transfer
     sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 0)
@@ -274,23 +303,32 @@ def perform_ota(
     sock.setsockopt(socket.SOL_SOCKET, socket.SO_SNDBUF, UPLOAD_BUFFER_SIZE)
     start_time = time.perf_counter()
 
-    offset = 0
     progress = ProgressBar()
-    while True:
-        chunk = upload_contents[offset : offset + UPLOAD_BLOCK_SIZE]
-        if not chunk:
-            break
-        offset += len(chunk)
+    # Keep up to UPLOAD_WINDOW blocks in flight instead of waiting for each ack
+    unacknowledged = 0
+    try:
+        while True:
+            chunk = upload_contents[offset : offset + UPLOAD_BLOCK_SIZE]
+            if not chunk:
+                break
+            offset += len(chunk)
 
-        try:
-            sock.sendall(chunk)
+            try:
+                sock.sendall(chunk)
+            except OSError as err:
+                raise OTATransferError(f"Error sending data: {err}") from err
             if version >= OTA_VERSION_2_0:
-                receive_exactly(sock, 1, "chunk OK", RESPONSE_CHUNK_OK)
-        except OSError as err:
-            sys.stderr.write("\n")
-            raise OTAError(f"Error sending data: {err}") from err
-
-        progress.update(offset / upload_size)
+                unacknowledged += 1
+                if unacknowledged == UPLOAD_WINDOW:
+                    receive_chunk_ok(sock)
+                    unacknowledged -= 1
+
+            progress.update(offset / upload_size)
+        for _ in range(unacknowledged):
+            receive_chunk_ok(sock)
+    except OTAError:
+        sys.stderr.write("\n")
+        raise
     progress.done()
 
     # Enable nodelay for last checks
@@ -344,14 +382,33 @@ def run_ota_impl_(
             continue
 
         _LOGGER.info("Connected to %s", sa[0])
-        with open(filename, "rb") as file_handle:
+        attempt = 0
+        while True:
+            with open(filename, "rb") as file_handle:
+                try:
+                    perform_ota(sock, password, file_handle, filename)
+                    break
+                except OTATransferError as err:
+                    if attempt == UPLOAD_RESUME_ATTEMPTS:
+                        _LOGGER.error(str(err))
+                        return 1, None
+                    _LOGGER.warning("%s, reconnecting to resume the upload", err)
+                except OTAError as err:
+                    _LOGGER.error(str(err))
+                    return 1, None
+                finally:
+                    sock.close()
+            attempt += 1
+            sock = socket.socket(af, socktype)
+            sock.settimeout(10.0)
             try:
-                perform_ota(sock, password, file_handle, filename)
-            except OTAError as err:
-                _LOGGER.error(str(err))
-                return 1, None
-            finally:
+                sock.connect(sa)
+            except OSError as err:
                 sock.close()
+                _LOGGER.error(
+                    "Reconnecting to %s port %s failed: %s", sa[0], sa[1], err
+                )
+                return 1, None
 
         # Successfully uploaded to sa[0]
         return 0, sa[0]
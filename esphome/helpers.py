@@ -49,6 +49,15 @@ def ensure_unique_string(preferred_string, current_strings):
     return test_string
 
 
+def fnv1_hash(string: str) -> int:
+    """FNV-1 32-bit hash, the same as fnv1_hash() in esphome/core/helpers.cpp."""
+    hash_value = 2166136261
+    for char in string.encode():
+        hash_value = (hash_value * 16777619) & 0xFFFFFFFF
+        hash_value ^= char
+    return hash_value
+
+
 def fnv1a_32bit_hash(string: str) -> int:
     """FNV-1a 32-bit hash function.
 
@@ -3,15 +3,35 @@ from __future__ import annotations
 
 from abc import ABC, abstractmethod
 from enum import IntEnum
+import importlib
 from pathlib import Path
 import re
-from subprocess import call
+from subprocess import call, check_call
 import sys
+import tempfile
+from types import ModuleType
 from typing import Any
 
-import aioesphomeapi.api_options_pb2 as pb
 import google.protobuf.descriptor_pb2 as descriptor
 
+API_DIR = Path(__file__).resolve().parents[2] / "esphome" / "components" / "api"
+
+
+def load_api_options() -> ModuleType:
+    """Compile api_options.proto from this tree and import it.
+
+    The copy shipped with aioesphomeapi lags behind the options used in api.proto.
+    """
+    out_dir = tempfile.mkdtemp()
+    check_call(
+        ["protoc", f"--python_out={out_dir}", "-I", str(API_DIR), "api_options.proto"]
+    )
+    sys.path.insert(0, out_dir)
+    return importlib.import_module("api_options_pb2")
+
+
+pb = load_api_options()
+
 
 class WireType(IntEnum):
     """Protocol Buffer wire types as defined in the protobuf spec.
@@ -28,10 +48,6 @@ class WireType(IntEnum):
     FIXED32 = 5  # fixed32, sfixed32, float
 
 
-# Generate with
-# protoc --python_out=script/api_protobuf -I esphome/components/api/ api_options.proto
-
-
 """Python 3 script to automatically generate C++ classes for ESPHome's native API.
 
 It's pretty crappy spaghetti code, but it works.
@@ -1089,10 +1105,7 @@ class FixedArrayRepeatedType(TypeInfo):
         self.array_size = size
         self.is_define = isinstance(size, str)
         # Check if we should skip encoding when all elements are zero
-        # Use getattr to handle older versions of api_options_pb2
-        self.skip_zero = get_field_opt(
-            field, getattr(pb, "fixed_array_skip_zero", None), False
-        )
+        self.skip_zero = get_field_opt(field, pb.fixed_array_skip_zero, False)
         # Create the element type info
         validate_field_type(field.type, field.name)
         self._ti: TypeInfo = TYPE_INFO[field.type](field)
@@ -1908,8 +1921,16 @@ def build_message_type(
         prot = "bool decode_64bit(uint32_t field_id, Proto64Bit value) override;"
         protected_content.insert(0, prot)
 
+    # Messages with inline_encode get encode/calculate_size in the class body
+    inline_encode = get_opt(desc, pb.inline_encode, False)
+
     # Only generate encode method if this message needs encoding and has fields
-    if needs_encode and encode:
+    if needs_encode and encode and inline_encode:
+        o = "void encode(ProtoWriteBuffer buffer) const override {\n"
+        o += indent("\n".join(encode)) + "\n"
+        o += "}"
+        public_content.append(o)
+    elif needs_encode and encode:
         o = f"void {desc.name}::encode(ProtoWriteBuffer buffer) const {{"
         if len(encode) == 1 and len(encode[0]) + len(o) + 3 < 120:
             o += f" {encode[0]} }}\n"
@@ -1923,7 +1944,12 @@ def build_message_type(
     # If no fields to encode or message doesn't need encoding, the default implementation in ProtoMessage will be used
 
     # Add calculate_size method only if this message needs encoding and has fields
-    if needs_encode and size_calc:
+    if needs_encode and size_calc and inline_encode:
+        o = "void calculate_size(ProtoSize &size) const override {\n"
+        o += indent("\n".join(size_calc)) + "\n"
+        o += "}"
+        public_content.append(o)
+    elif needs_encode and size_calc:
         o = f"void {desc.name}::calculate_size(ProtoSize &size) const {{"
         # For a single field, just inline it for simplicity
         if len(size_calc) == 1 and len(size_calc[0]) + len(o) + 3 < 120:
@@ -2263,8 +2289,7 @@ def build_service_message_type(
 
 def main() -> None:
     """Main function to generate the C++ classes."""
-    cwd = Path(__file__).resolve().parent
-    root = cwd.parent.parent / "esphome" / "components" / "api"
+    root = API_DIR
     prot_file = root / "api.protoc"
     call(["protoc", "-o", str(prot_file), "-I", str(root), "api.proto"])
     proto_content = prot_file.read_bytes()
@@ -1,5 +1,7 @@
 """Tests for the sensor component."""
 
+import re
+
 
 def test_sensor_device_class_set(generate_main):
     """
@@ -11,4 +13,6 @@ def test_sensor_device_class_set(generate_main):
     main_cpp = generate_main("tests/component_tests/sensor/test_sensor.yaml")
 
     # Then
-    assert 's_1->set_device_class("voltage");' in main_cpp
+    strings = re.search(r"ENTITY_STRINGS\[\] = \{(.*)\};", main_cpp)[1].split(", ")
+    voltage = strings.index('"voltage"')
+    assert f"s_1->set_device_class({voltage});" in main_cpp
@@ -1,5 +1,7 @@
 """Tests for the text sensor component."""
 
+import re
+
 
 def test_text_sensor_is_setup(generate_main):
     """
@@ -54,5 +56,8 @@ def test_text_sensor_device_class_set(generate_main):
     main_cpp = generate_main("tests/component_tests/text_sensor/test_text_sensor.yaml")
 
     # Then
-    assert 'ts_2->set_device_class("timestamp");' in main_cpp
-    assert 'ts_3->set_device_class("date");' in main_cpp
+    strings = re.search(r"ENTITY_STRINGS\[\] = \{(.*)\};", main_cpp)[1].split(", ")
+    timestamp = strings.index('"timestamp"')
+    date = strings.index('"date"')
+    assert f"ts_2->set_device_class({timestamp});" in main_cpp
+    assert f"ts_3->set_device_class({date});" in main_cpp
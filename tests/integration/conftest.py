@@ -499,7 +499,7 @@ async def run_binary_and_wait_for_port(
     port: int,
     timeout: float = PORT_WAIT_TIMEOUT,
     line_callback: Callable[[str], None] | None = None,
-) -> AsyncGenerator[None]:
+) -> AsyncGenerator[asyncio.subprocess.Process]:
     """Run a binary, wait for it to open a port, and clean up on exit."""
     # Create a pseudo-terminal to make the binary think it's running interactively
     # This is needed because the ESPHome host logger checks isatty()
@@ -563,7 +563,7 @@ async def run_binary_and_wait_for_port(
                 writer.close()
                 await writer.wait_closed()
                 # Port is open, yield control
-                yield
+                yield process
                 return
             except (ConnectionRefusedError, OSError):
                 # Check if process died
@@ -630,7 +630,7 @@ async def run_compiled_context(
     port: int,
     port_socket: socket.socket | None = None,
     line_callback: Callable[[str], None] | None = None,
-) -> AsyncGenerator[None]:
+) -> AsyncGenerator[asyncio.subprocess.Process]:
     """Context manager to write, compile and run an ESPHome configuration."""
     # Write the YAML config
     config_path = await write_yaml_config(yaml_content, filename)
@@ -645,8 +645,8 @@ async def run_compiled_context(
     # Run the binary and wait for the API server to start
     async with run_binary_and_wait_for_port(
         binary_path, LOCALHOST, port, line_callback=line_callback
-    ):
-        yield
+    ) as process:
+        yield process
 
 
 @pytest_asyncio.fixture
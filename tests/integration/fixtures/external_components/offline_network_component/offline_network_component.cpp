@@ -0,0 +1,12 @@
+#include "offline_network_component.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace offline_network_component {
+
+static const char *const TAG = "offline_network";
+
+void OfflineNetworkComponent::setup() { ESP_LOGI(TAG, "Network setup started, it will never connect"); }
+
+}  // namespace offline_network_component
+}  // namespace esphome
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace offline_network_component {
+
+// Stands in for a network component (like WiFi) that never connects
+class OfflineNetworkComponent : public Component {
+ public:
+  void setup() override;
+  bool can_proceed() override { return false; }
+  float get_setup_priority() const override { return setup_priority::WIFI; }
+};
+
+}  // namespace offline_network_component
+}  // namespace esphome
@@ -0,0 +1,40 @@
+#include "tickless_wake_component.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <chrono>
+#include <thread>
+
+namespace esphome {
+namespace tickless_wake_component {
+
+static const char *const TAG = "tickless_wake";
+
+static constexpr int ROUNDS = 6;
+// Long enough for the main loop to fall asleep between the rounds
+static constexpr auto ROUND_PAUSE = std::chrono::milliseconds(300);
+
+void TicklessWakeComponent::setup() {
+  ESP_LOGI(TAG, "Starting %d cross-thread rounds", ROUNDS);
+  std::thread([this]() {
+    for (int round = 0; round < ROUNDS; round++) {
+      std::this_thread::sleep_for(ROUND_PAUSE);
+      // Alternate between defer() and a short timeout, they are queued in different places
+      this->schedule_from_thread_(round, (round % 2) * 20);
+    }
+  }).detach();
+}
+
+void TicklessWakeComponent::schedule_from_thread_(int round, uint32_t delay_ms) {
+  const uint32_t start = millis();
+  const uint32_t start_loops = App.get_loop_count();
+  App.scheduler.set_timeout(this, "cross_thread", delay_ms, [round, delay_ms, start, start_loops]() {
+    const uint32_t latency = millis() - start - delay_ms;
+    ESP_LOGI(TAG, "Round %d latency %" PRIu32 " ms after %" PRIu32 " loops", round, latency,
+             App.get_loop_count() - start_loops);
+  });
+}
+
+}  // namespace tickless_wake_component
+}  // namespace esphome
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace tickless_wake_component {
+
+// Schedules work from a separate thread while the main loop sleeps in tickless idle and logs how long it took to run
+class TicklessWakeComponent : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+ protected:
+  void schedule_from_thread_(int round, uint32_t delay_ms);
+};
+
+}  // namespace tickless_wake_component
+}  // namespace esphome
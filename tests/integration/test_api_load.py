@@ -0,0 +1,172 @@
+"""Load and soak test for the API server.
+
+Runs a host build with many synthetic sensors updating at a fixed rate while several
+clients are subscribed, then checks the state latency, throughput and memory use.
+
+The load is small by default so the test fits in a normal CI run. Set these
+environment variables for a longer soak:
+
+- ESPHOME_API_LOAD_ENTITIES: number of sensors (default 200)
+- ESPHOME_API_LOAD_INTERVAL_MS: update interval of every sensor (default 100)
+- ESPHOME_API_LOAD_CLIENTS: number of connected clients (default 4)
+- ESPHOME_API_LOAD_DURATION: seconds to measure for (default 10)
+- ESPHOME_API_LOAD_MAX_P99_MS: latency gate (default 500)
+- ESPHOME_API_LOAD_MAX_RSS_KB: memory high-water mark gate (default 131072)
+- ESPHOME_API_LOAD_REPORT: write the results as JSON, one file per mode
+"""
+
+from __future__ import annotations
+
+import asyncio
+from contextlib import AsyncExitStack
+import json
+import os
+from pathlib import Path
+
+from aioesphomeapi import EntityState, NumberInfo, NumberState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+NOISE_KEY = "N4Yle5YirwZhPiHHsdZLdOA73ndj/84veVaLhTvxCuU="
+
+ENTITIES = int(os.environ.get("ESPHOME_API_LOAD_ENTITIES", "200"))
+INTERVAL_MS = int(os.environ.get("ESPHOME_API_LOAD_INTERVAL_MS", "100"))
+CLIENTS = int(os.environ.get("ESPHOME_API_LOAD_CLIENTS", "4"))
+DURATION = float(os.environ.get("ESPHOME_API_LOAD_DURATION", "10"))
+MAX_P99_MS = float(os.environ.get("ESPHOME_API_LOAD_MAX_P99_MS", "500"))
+MAX_RSS_KB = int(os.environ.get("ESPHOME_API_LOAD_MAX_RSS_KB", "131072"))
+REPORT = os.environ.get("ESPHOME_API_LOAD_REPORT")
+
+PROBE_INTERVAL = 0.1
+
+
+def _sensor_config() -> str:
+    lines = ["sensor:"]
+    for i in range(ENTITIES):
+        lines += [
+            "  - platform: template",
+            f'    name: "Load Sensor {i}"',
+            "    lambda: return millis();",
+            f"    update_interval: {INTERVAL_MS}ms",
+        ]
+    return "\n".join(lines) + "\n"
+
+
+def _percentile(values: list[float], percent: float) -> float:
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * percent / 100))]
+
+
+def _process_stats(pid: int) -> tuple[int | None, float | None]:
+    """Return the memory high-water mark in kB and the CPU time in seconds."""
+    proc = Path(f"/proc/{pid}")
+    if not proc.exists():
+        # Only Linux exposes these
+        return None, None
+    rss_kb = None
+    for line in (proc / "status").read_text().splitlines():
+        if line.startswith("VmHWM:"):
+            rss_kb = int(line.split()[1])
+    # The command may contain spaces, the fields after it are fixed
+    fields = (proc / "stat").read_text().rpartition(")")[2].split()
+    cpu = (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+    return rss_kb, cpu
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize("encrypted", [False, True], ids=["plaintext", "noise"])
+async def test_api_load(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+    encrypted: bool,
+) -> None:
+    """Measure the API server under a sustained state load."""
+    config = yaml_config + "\n" + _sensor_config()
+    noise_psk = None
+    if encrypted:
+        noise_psk = NOISE_KEY
+        config = config.replace(
+            "api:\n", f"api:\n  encryption:\n    key: {NOISE_KEY}\n", 1
+        )
+
+    loop = asyncio.get_running_loop()
+    async with run_compiled(config) as process, AsyncExitStack() as stack:
+        clients = [
+            await stack.enter_async_context(
+                api_client_connected(noise_psk=noise_psk, client_info=f"load-{i}")
+            )
+            for i in range(CLIENTS)
+        ]
+        entities, _ = await clients[0].list_entities_services()
+        probe = next(e for e in entities if isinstance(e, NumberInfo))
+        assert len(entities) == ENTITIES + 1
+
+        sent: dict[float, float] = {}
+        latencies: list[float] = []
+        received = [0] * CLIENTS
+        last_probe = [0.0] * CLIENTS
+
+        def make_callback(index: int):
+            def on_state(state: EntityState) -> None:
+                received[index] += 1
+                if not isinstance(state, NumberState) or state.key != probe.key:
+                    return
+                if (sent_at := sent.get(state.state)) is not None:
+                    latencies.append(loop.time() - sent_at)
+                    last_probe[index] = state.state
+
+            return on_state
+
+        for index, client in enumerate(clients):
+            client.subscribe_states(make_callback(index))
+
+        # Let the initial states settle before measuring
+        await asyncio.sleep(1.0)
+        received[:] = [0] * CLIENTS
+        _, cpu_before = _process_stats(process.pid)
+
+        start = loop.time()
+        probe_value = 1.0
+        while loop.time() - start < DURATION:
+            sent[probe_value] = loop.time()
+            clients[0].number_command(probe.key, probe_value)
+            probe_value += 1
+            await asyncio.sleep(PROBE_INTERVAL)
+        # Give the last probe time to arrive
+        await asyncio.sleep(1.0)
+        elapsed = loop.time() - start
+
+        rss_kb, cpu_after = _process_stats(process.pid)
+
+    mode = "noise" if encrypted else "plaintext"
+    results = {
+        "mode": mode,
+        "entities": ENTITIES,
+        "interval_ms": INTERVAL_MS,
+        "clients": CLIENTS,
+        "duration_s": round(elapsed, 2),
+        "states_per_s": round(sum(received) / elapsed, 1),
+        "latency_p50_ms": round(_percentile(latencies, 50) * 1000, 2),
+        "latency_p95_ms": round(_percentile(latencies, 95) * 1000, 2),
+        "latency_p99_ms": round(_percentile(latencies, 99) * 1000, 2),
+        "rss_high_water_kb": rss_kb,
+        "cpu_percent": (
+            round((cpu_after - cpu_before) * 100 / elapsed, 1)
+            if cpu_before is not None and cpu_after is not None
+            else None
+        ),
+    }
+    print(f"API load results: {json.dumps(results)}")
+    if REPORT:
+        report = Path(REPORT)
+        report = report.with_name(f"{report.stem}-{mode}{report.suffix}")
+        report.write_text(json.dumps(results, indent=2) + "\n")
+
+    # Probes sent within one batch interval are merged, but the last one has to
+    # reach every client or a connection stalled under the load
+    assert last_probe == [probe_value - 1] * CLIENTS, last_probe
+    assert results["latency_p99_ms"] <= MAX_P99_MS, results
+    if rss_kb is not None:
+        assert rss_kb <= MAX_RSS_KB, results
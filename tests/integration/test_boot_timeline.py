@@ -0,0 +1,58 @@
+"""Test boot timeline component."""
+
+from __future__ import annotations
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_boot_timeline(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test boot timeline records per-component setup durations and boot milestones."""
+    loop = asyncio.get_running_loop()
+    setup_complete_future = loop.create_future()
+
+    setup_durations: dict[str, float] = {}
+    milestones: dict[str, float] = {}
+
+    setup_pattern = re.compile(r"\s+([\d.]+)ms setup ([\w.]+) took ([\d.]+)ms")
+    milestone_pattern = re.compile(
+        r"\s+([\d.]+)ms (setup complete|first state|API client connected)"
+    )
+
+    def check_output(line: str) -> None:
+        """Collect boot timeline entries from the dump_config output."""
+        if match := setup_pattern.search(line):
+            setup_durations[match.group(2)] = float(match.group(3))
+        elif match := milestone_pattern.search(line):
+            milestones[match.group(2)] = float(match.group(1))
+            if match.group(2) == "setup complete" and not setup_complete_future.done():
+                setup_complete_future.set_result(True)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+
+        try:
+            await asyncio.wait_for(setup_complete_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Boot timeline 'setup complete' entry not seen")
+
+        assert "template.sensor" in setup_durations, (
+            f"Expected template.sensor setup duration, found: {setup_durations}"
+        )
+        assert "api" in setup_durations, (
+            f"Expected api setup duration, found: {setup_durations}"
+        )
+        assert all(duration >= 0 for duration in setup_durations.values())
@@ -0,0 +1,63 @@
+"""Test the concurrent (dependency ordered) setup mode."""
+
+from __future__ import annotations
+
+import asyncio
+
+from aioesphomeapi import LightInfo, SensorInfo, SensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_concurrent_setup(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that all components are set up and working with concurrent_setup."""
+    loop = asyncio.get_running_loop()
+    setup_finished = loop.create_future()
+    output_written = loop.create_future()
+
+    def check_output(line: str) -> None:
+        if "setup() finished successfully!" in line and not setup_finished.done():
+            setup_finished.set_result(True)
+        if "Output written: 1.00" in line and not output_written.done():
+            output_written.set_result(True)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "concurrent-setup"
+
+        await asyncio.wait_for(setup_finished, timeout=5.0)
+
+        entities, _ = await client.list_entities_services()
+        light = next((e for e in entities if isinstance(e, LightInfo)), None)
+        sensor = next((e for e in entities if isinstance(e, SensorInfo)), None)
+        assert light is not None
+        assert sensor is not None
+
+        # The deferred sensor is set up and publishing
+        sensor_state = loop.create_future()
+
+        def on_state(state) -> None:
+            if (
+                isinstance(state, SensorState)
+                and state.key == sensor.key
+                and not sensor_state.done()
+            ):
+                sensor_state.set_result(state)
+
+        client.subscribe_states(on_state)
+        state = await asyncio.wait_for(sensor_state, timeout=5.0)
+        assert state.state == pytest.approx(42.0)
+
+        # The light was set up after the output it depends on
+        client.light_command(key=light.key, state=True, brightness=1.0)
+        await asyncio.wait_for(output_written, timeout=5.0)
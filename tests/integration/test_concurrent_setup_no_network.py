@@ -0,0 +1,42 @@
+"""Test that concurrent setup does not hold back leaf components on the network."""
+
+from __future__ import annotations
+
+import asyncio
+
+import pytest
+
+from .types import RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_concurrent_setup_no_network(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+) -> None:
+    """Test that deferred components are set up while the network never connects."""
+    loop = asyncio.get_running_loop()
+    network_started = loop.create_future()
+    sensor_value = loop.create_future()
+    setup_finished = False
+
+    def check_output(line: str) -> None:
+        nonlocal setup_finished
+        if "Network setup started" in line and not network_started.done():
+            network_started.set_result(True)
+        if "Sensor value: 42.00" in line and not sensor_value.done():
+            sensor_value.set_result(True)
+        if "setup() finished successfully!" in line:
+            setup_finished = True
+
+    # The network stand-in never becomes ready, so the API never starts and no
+    # client can connect; everything is observed through the log output
+    async with run_compiled(yaml_config, line_callback=check_output):
+        await asyncio.wait_for(network_started, timeout=5.0)
+        try:
+            await asyncio.wait_for(sensor_value, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Deferred sensor was not set up while the network is down")
+
+        # Setup itself is still waiting on the network
+        assert not setup_finished
@@ -0,0 +1,34 @@
+"""Integration test for the virtual clock of host builds."""
+
+from __future__ import annotations
+
+import asyncio
+import re
+
+import pytest
+
+from .types import RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_host_virtual_time(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+) -> None:
+    """Test that a simulated day across the millis() rollover passes in seconds."""
+    loop = asyncio.get_running_loop()
+    day_done: asyncio.Future[str] = loop.create_future()
+    day_pattern = re.compile(r"Simulated a day, millis wrapped: (\w+)")
+
+    def check_output(line: str) -> None:
+        if not day_done.done() and (match := day_pattern.search(line)):
+            day_done.set_result(match[1])
+
+    async with run_compiled(yaml_config, line_callback=check_output):
+        try:
+            wrapped = await asyncio.wait_for(day_done, timeout=30.0)
+        except TimeoutError:
+            pytest.fail("A simulated day did not pass within 30 seconds")
+
+    # The 1h interval kept firing after millis() wrapped around
+    assert wrapped == "YES"
@@ -26,6 +26,8 @@ async def test_runtime_stats(
 
     # Track component stats
     component_stats_found = set()
+    # Track (component, source) pairs with latency percentiles
+    latency_stats_found = set()
 
     # Patterns to match - need to handle ANSI color codes and timestamps
     # The log format is: [HH:MM:SS][color codes][I][tag]: message
@@ -34,6 +36,10 @@ async def test_runtime_stats(
     component_pattern = re.compile(
         r"^\[[^\]]+\].*?\s+([\w.]+):\s+count=(\d+),\s+avg=([\d.]+)ms"
     )
+    latency_pattern = re.compile(
+        r"([\w.]+) \[(loop|update|scheduler)\]: n=(\d+), p50=([\d.]+)ms, "
+        r"p99=([\d.]+)ms, p999=([\d.]+)ms, max=([\d.]+)ms"
+    )
 
     def check_output(line: str) -> None:
         """Check log output for runtime stats messages."""
@@ -54,6 +60,11 @@ async def test_runtime_stats(
             component_name = match.group(1)
             component_stats_found.add(component_name)
 
+        if match := latency_pattern.search(line):
+            p50, p99, p999, max_ms = (float(match.group(i)) for i in range(4, 8))
+            assert p50 <= p99 <= p999 <= max_ms, f"Percentiles out of order: {line}"
+            latency_stats_found.add((match.group(1), match.group(2)))
+
     async with (
         run_compiled(yaml_config, line_callback=check_output),
         api_client_connected() as client,
@@ -86,3 +97,14 @@ async def test_runtime_stats(
         assert "template.switch" in component_stats_found, (
             f"Expected template.switch stats, found: {component_stats_found}"
         )
+        assert ("template.sensor", "update") in latency_stats_found, (
+            f"Expected template.sensor update latency, found: {latency_stats_found}"
+        )
+        assert ("template.switch", "loop") in latency_stats_found, (
+            f"Expected template.switch loop latency, found: {latency_stats_found}"
+        )
+
+        entities, _ = await client.list_entities_services()
+        assert any(e.name == "Test Sensor 1 Update p99" for e in entities), (
+            "runtime_stats sensor not found"
+        )
@@ -0,0 +1,54 @@
+"""Test scheduler cancel and replace through the item index."""
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_index_cancel(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that re-armed and cancelled items are found by (component, name, type)."""
+
+    loop = asyncio.get_running_loop()
+    result_future: asyncio.Future[re.Match[str]] = loop.create_future()
+
+    result_pattern = re.compile(r"Self cancel: (\d+), replaced: (\d+)")
+
+    def check_output(line: str) -> None:
+        """Check log output for the test result."""
+        if not result_future.done() and (match := result_pattern.search(line)):
+            result_future.set_result(match)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-index-cancel"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+        test_service = next(
+            (s for s in services if s.name == "run_index_cancel_test"), None
+        )
+        assert test_service is not None, "run_index_cancel_test service not found"
+
+        client.execute_service(test_service, {})
+
+        try:
+            match = await asyncio.wait_for(result_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Scheduler index test did not complete")
+
+        assert int(match.group(1)) == 3, "Interval should stop after cancelling itself"
+        # One run each for rearm_a, rearm_b, rearm_dynamic and the shared-name timeout
+        assert int(match.group(2)) == 4
@@ -0,0 +1,60 @@
+"""Test scheduler callbacks with inline and heap-allocated captures."""
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_inline_callback(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that callbacks of every size and kind run and release their captures."""
+
+    loop = asyncio.get_running_loop()
+    result_future: asyncio.Future[re.Match[str]] = loop.create_future()
+
+    result_pattern = re.compile(
+        r"Small: (\d+), large: (-?\d+), function: (\d+), interval: (\d+), "
+        r"released: (\w+)"
+    )
+
+    def check_output(line: str) -> None:
+        """Check log output for the test result."""
+        if not result_future.done() and (match := result_pattern.search(line)):
+            result_future.set_result(match)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-inline-callback"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+        test_service = next(
+            (s for s in services if s.name == "run_inline_callback_test"), None
+        )
+        assert test_service is not None, "run_inline_callback_test service not found"
+
+        client.execute_service(test_service, {})
+
+        try:
+            match = await asyncio.wait_for(result_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Scheduler inline callback test did not complete")
+
+        assert int(match.group(1)) == 1
+        assert int(match.group(2)) == 40 + 16 * 2
+        assert int(match.group(3)) == 2, "std::function and std::bind should run"
+        assert int(match.group(4)) == 5
+        # Only the running done callback may still hold the shared_ptr
+        assert match.group(5) == "yes", "Replaced callback should release its captures"
@@ -0,0 +1,54 @@
+"""Test the hierarchical timer wheel scheduler backend."""
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_timer_wheel(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test ordering, cancellation, intervals and retries with the timer wheel."""
+
+    loop = asyncio.get_running_loop()
+    result_future: asyncio.Future[re.Match[str]] = loop.create_future()
+
+    result_pattern = re.compile(r"Order: (\w*), intervals: (\d+), retries: (\d+)")
+
+    def check_output(line: str) -> None:
+        """Check log output for the test result."""
+        if not result_future.done() and (match := result_pattern.search(line)):
+            result_future.set_result(match)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-timer-wheel"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+        test_service = next(
+            (s for s in services if s.name == "run_timer_wheel_test"), None
+        )
+        assert test_service is not None, "run_timer_wheel_test service not found"
+
+        client.execute_service(test_service, {})
+
+        try:
+            match = await asyncio.wait_for(result_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Timer wheel test did not complete")
+
+        assert match.group(1) == "abrc", f"Unexpected execution order {match.group(1)}"
+        assert int(match.group(2)) == 5, "Interval should stop after cancelling itself"
+        assert int(match.group(3)) == 3, "Retry should run for all attempts"
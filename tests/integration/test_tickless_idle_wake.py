@@ -0,0 +1,42 @@
+"""Test that work scheduled from another thread wakes the tickless idle loop."""
+
+from __future__ import annotations
+
+import asyncio
+import re
+
+import pytest
+
+from .types import RunCompiledFunction
+
+ROUNDS = 6
+
+
+@pytest.mark.asyncio
+async def test_tickless_idle_wake(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+) -> None:
+    """Test the latency of scheduler items added from another thread while idle."""
+    loop = asyncio.get_running_loop()
+    all_rounds = loop.create_future()
+    round_pattern = re.compile(r"Round (\d+) latency (\d+) ms after (\d+) loops")
+    rounds: dict[int, tuple[int, int]] = {}
+
+    def check_output(line: str) -> None:
+        if match := round_pattern.search(line):
+            rounds[int(match.group(1))] = (int(match.group(2)), int(match.group(3)))
+            if len(rounds) == ROUNDS and not all_rounds.done():
+                all_rounds.set_result(True)
+
+    async with run_compiled(yaml_config, line_callback=check_output):
+        try:
+            await asyncio.wait_for(all_rounds, timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Only {len(rounds)} of {ROUNDS} rounds completed")
+
+    for round_, (latency, loops) in sorted(rounds.items()):
+        # Without a wakeup the loop sleeps until the 1s idle timeout
+        assert latency < 100, f"Round {round_} took {latency} ms to run"
+        # The loop slept while waiting instead of ticking every 16 ms
+        assert loops < 5, f"Round {round_} ran {loops} loops while waiting"
@@ -23,7 +23,7 @@ class RunCompiledFunction(Protocol):
         yaml_content: str,
         filename: str | None = None,
         line_callback: Callable[[str], None] | None = None,
-    ) -> AbstractAsyncContextManager[None]: ...
+    ) -> AbstractAsyncContextManager[asyncio.subprocess.Process]: ...
 
 
 WaitFunction = Callable[[APIClient, float], Awaitable[bool]]
@@ -19,7 +19,9 @@ from esphome.const import (
 from esphome.core import CORE, ID, entity_helpers
 from esphome.core.entity_helpers import (
     entity_duplicate_validator,
+    entity_string,
     get_base_entity_object_id,
+    get_entity_strings,
     setup_entity,
 )
 from esphome.cpp_generator import MockObj
@@ -28,7 +30,7 @@ from esphome.helpers import sanitize, snake_case
 from .common import load_config_from_fixture
 
 # Pre-compiled regex pattern for extracting object IDs from expressions
-OBJECT_ID_PATTERN = re.compile(r'\.set_object_id\(["\'](.*?)["\']\)')
+OBJECT_ID_PATTERN = re.compile(r'\.set_object_id\(["\'](.*?)["\'][,)]')
 
 FIXTURES_DIR = Path(__file__).parent.parent / "fixtures" / "core" / "entity_helpers"
 
@@ -274,7 +276,7 @@ def extract_object_id_from_expressions(expressions: list[str]) -> str | None:
     """Extract the object ID that was set from the generated expressions."""
     for expr in expressions:
         # Look for set_object_id calls with regex to handle various formats
-        # Matches: var.set_object_id("temperature_2") or var.set_object_id('temperature_2')
+        # Matches: var.set_object_id("temperature_2", 123) or var.set_object_id('temperature_2')
         if match := OBJECT_ID_PATTERN.search(expr):
             return match.group(1)
     return None
@@ -473,10 +475,19 @@ async def test_setup_entity_with_icon(setup_test_environment: list[str]) -> None
 
     await setup_entity(var, config, "sensor")
 
-    # Check icon was set
-    assert any(
-        'sensor1.set_icon("mdi:thermometer")' in expr for expr in added_expressions
-    )
+    # Check icon was set by its index in the entity string table
+    icon_id = entity_string("mdi:thermometer")
+    assert icon_id > 0
+    assert any(f"sensor1.set_icon({icon_id})" in expr for expr in added_expressions)
+
+
+def test_entity_string_deduplicates() -> None:
+    """Test entity_string returns the same index for equal strings."""
+    assert entity_string("") == 0
+    first = entity_string("°C")
+    assert entity_string("temperature") != first
+    assert entity_string("°C") == first
+    assert get_entity_strings()[first] == "°C"
 
 
 @pytest.mark.asyncio